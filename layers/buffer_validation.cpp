@@ -23,6 +23,7 @@
 // Allow use of STL min and max functions in Windows
 #define NOMINMAX
 
+#include <bitset>
 #include <cmath>
 #include <set>
 #include <sstream>
@@ -89,6 +90,10 @@ IMAGE_STATE::IMAGE_STATE(VkImage img, const VkImageCreateInfo *pCreateInfo)
             (FormatHasDepth(format) ? VK_IMAGE_ASPECT_DEPTH_BIT : 0) | (FormatHasStencil(format) ? VK_IMAGE_ASPECT_STENCIL_BIT : 0);
     }
     full_range = NormalizeSubresourceRange(*this, init_range);
+    whole_image_layout = createInfo.initialLayout;
+    global_layouts.assign(static_cast<size_t>(std::bitset<32>(full_range.aspectMask).count()) * full_range.levelCount *
+                              full_range.layerCount,
+                          VK_IMAGE_LAYOUT_MAX_ENUM);
 
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
     auto external_format = lvl_find_in_chain<VkExternalFormatANDROID>(createInfo.pNext);
@@ -183,65 +188,51 @@ void CoreChecks::SetLayout(ImageSubresPairLayoutMap &imageLayoutMap, ImageSubres
     }
 }
 
-bool CoreChecks::FindLayoutVerifyLayout(ImageSubresourcePair imgpair, VkImageLayout &layout, const VkImageAspectFlags aspectMask) {
-    if (!(imgpair.subresource.aspectMask & aspectMask)) {
-        return false;
+// Dense index of a single-aspect subresource within IMAGE_STATE::global_layouts, or -1 if the
+// subresource falls outside the image's normalized full range
+static int GlobalLayoutIndex(const IMAGE_STATE &image_state, const VkImageSubresource &subresource) {
+    const VkImageAspectFlags tracked = image_state.full_range.aspectMask;
+    const VkImageAspectFlags aspect = subresource.aspectMask;
+    if (!(aspect & tracked) || (aspect & (aspect - 1))) return -1;  // Only single, tracked aspect bits are stored
+    if ((subresource.mipLevel >= image_state.full_range.levelCount) ||
+        (subresource.arrayLayer >= image_state.full_range.layerCount)) {
+        return -1;
     }
-    VkImageAspectFlags oldAspectMask = imgpair.subresource.aspectMask;
-    imgpair.subresource.aspectMask = aspectMask;
-    auto imgsubIt = imageLayoutMap.find(imgpair);
-    if (imgsubIt == imageLayoutMap.end()) {
-        return false;
-    }
-    if (layout != VK_IMAGE_LAYOUT_MAX_ENUM && layout != imgsubIt->second.layout) {
-        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, HandleToUint64(imgpair.image),
-                kVUID_Core_DrawState_InvalidLayout,
-                "Cannot query for %s layout when combined aspect mask %d has multiple layout types: %s and %s",
-                report_data->FormatHandle(imgpair.image).c_str(), oldAspectMask, string_VkImageLayout(layout),
-                string_VkImageLayout(imgsubIt->second.layout));
-    }
-    layout = imgsubIt->second.layout;
-    return true;
+    const uint32_t aspect_index = static_cast<uint32_t>(std::bitset<32>(tracked & (aspect - 1)).count());
+    return static_cast<int>(((aspect_index * image_state.full_range.levelCount) + subresource.mipLevel) *
+                                image_state.full_range.layerCount +
+                            subresource.arrayLayer);
 }
 
 // Find layout(s) on the global level
-bool CoreChecks::FindGlobalLayout(ImageSubresourcePair imgpair, VkImageLayout &layout) {
-    layout = VK_IMAGE_LAYOUT_MAX_ENUM;
-    FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_COLOR_BIT);
-    FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_DEPTH_BIT);
-    FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_STENCIL_BIT);
-    FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_METADATA_BIT);
-    if (device_extensions.vk_khr_sampler_ycbcr_conversion) {
-        FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_PLANE_0_BIT_KHR);
-        FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_PLANE_1_BIT_KHR);
-        FindLayoutVerifyLayout(imgpair, layout, VK_IMAGE_ASPECT_PLANE_2_BIT_KHR);
-    }
-    if (layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
-        imgpair = {imgpair.image, false, VkImageSubresource()};
-        auto imgsubIt = imageLayoutMap.find(imgpair);
-        if (imgsubIt == imageLayoutMap.end()) return false;
-        layout = imgsubIt->second.layout;
+bool CoreChecks::FindGlobalLayout(ImageSubresourcePair imgpair, VkImageLayout &layout) const {
+    const auto *image_state = GetImageState(imgpair.image);
+    if (!image_state) return false;
+    if (imgpair.hasSubresource) {
+        const int index = GlobalLayoutIndex(*image_state, imgpair.subresource);
+        if ((index >= 0) && (image_state->global_layouts[index] != VK_IMAGE_LAYOUT_MAX_ENUM)) {
+            layout = image_state->global_layouts[index];
+            return true;
+        }
     }
+    // Subresource never individually transitioned -- fall back to the whole-image layout
+    layout = image_state->whole_image_layout;
     return true;
 }
 
-bool CoreChecks::FindLayouts(VkImage image, std::vector<VkImageLayout> &layouts) {
-    auto sub_data = imageSubresourceMap.find(image);
-    if (sub_data == imageSubresourceMap.end()) return false;
-    auto image_state = GetImageState(image);
+bool CoreChecks::FindLayouts(VkImage image, std::vector<VkImageLayout> &layouts) const {
+    const auto *image_state = GetImageState(image);
     if (!image_state) return false;
-    bool ignoreGlobal = false;
-    // TODO: Make this robust for >1 aspect mask. Now it will just say ignore potential errors in this case.
-    if (sub_data->second.size() >= (image_state->createInfo.arrayLayers * image_state->createInfo.mipLevels + 1)) {
-        ignoreGlobal = true;
-    }
-    for (auto imgsubpair : sub_data->second) {
-        if (ignoreGlobal && !imgsubpair.hasSubresource) continue;
-        auto img_data = imageLayoutMap.find(imgsubpair);
-        if (img_data != imageLayoutMap.end()) {
-            layouts.push_back(img_data->second.layout);
+    bool has_untracked = false;
+    for (const auto layout : image_state->global_layouts) {
+        if (layout == VK_IMAGE_LAYOUT_MAX_ENUM) {
+            has_untracked = true;
+        } else {
+            layouts.push_back(layout);
         }
     }
+    // Subresources never individually transitioned still hold the whole-image layout
+    if (has_untracked) layouts.push_back(image_state->whole_image_layout);
     return true;
 }
 
@@ -282,20 +273,24 @@ bool CoreChecks::FindLayout(const ImageSubresPairLayoutMap &imageLayoutMap, Imag
     return true;
 }
 
-// Set the layout on the global level
-void CoreChecks::SetGlobalLayout(ImageSubresourcePair imgpair, const VkImageLayout &layout) {
-    VkImage &image = imgpair.image;
-    auto data = imageLayoutMap.find(imgpair);
-    if (data != imageLayoutMap.end()) {
-        data->second.layout = layout;  // Update
+// Set the layout on the global level.  Returns whether a layout value actually changed, and
+// bumps the image's layout generation when one did.
+bool CoreChecks::SetGlobalLayout(ImageSubresourcePair imgpair, const VkImageLayout &layout) {
+    auto *image_state = GetImageState(imgpair.image);
+    if (!image_state) return false;
+    bool changed = false;
+    if (!imgpair.hasSubresource) {
+        changed = (image_state->whole_image_layout != layout);
+        image_state->whole_image_layout = layout;
     } else {
-        imageLayoutMap[imgpair].layout = layout;  // Insert
-    }
-    auto &image_subresources = imageSubresourceMap[image];
-    auto subresource = std::find(image_subresources.begin(), image_subresources.end(), imgpair);
-    if (subresource == image_subresources.end()) {
-        image_subresources.push_back(imgpair);
+        const int index = GlobalLayoutIndex(*image_state, imgpair.subresource);
+        if (index >= 0) {
+            changed = (image_state->global_layouts[index] != layout);
+            image_state->global_layouts[index] = layout;
+        }
     }
+    if (changed) image_state->layout_generation++;
+    return changed;
 }
 
 // Set image layout for given VkImageSubresourceRange struct
@@ -358,19 +353,29 @@ bool CoreChecks::ValidateRenderPassLayoutAgainstFramebufferImageUsage(RenderPass
                                                                       VkImage image, VkImageView image_view,
                                                                       VkFramebuffer framebuffer, VkRenderPass renderpass,
                                                                       uint32_t attachment_index, const char *variable_name) {
-    bool skip = false;
     auto image_state = GetImageState(image);
-    const char *vuid;
-    const bool use_rp2 = (rp_version == RENDER_PASS_VERSION_2);
-
     if (!image_state) {
-        skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, HandleToUint64(image),
-                        "VUID-VkRenderPassBeginInfo-framebuffer-parameter",
-                        "Render Pass begin with %s uses %s where pAttachments[%" PRIu32 "] = %s, which refers to an invalid image",
-                        report_data->FormatHandle(renderpass).c_str(), report_data->FormatHandle(framebuffer).c_str(),
-                        attachment_index, report_data->FormatHandle(image_view).c_str());
-        return skip;
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, HandleToUint64(image),
+                       "VUID-VkRenderPassBeginInfo-framebuffer-parameter",
+                       "Render Pass begin with %s uses %s where pAttachments[%" PRIu32 "] = %s, which refers to an invalid image",
+                       report_data->FormatHandle(renderpass).c_str(), report_data->FormatHandle(framebuffer).c_str(),
+                       attachment_index, report_data->FormatHandle(image_view).c_str());
     }
+    return ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, layout, image_state, image_view, framebuffer,
+                                                                renderpass, attachment_index, variable_name);
+}
+
+// Resolved-state core of the check above, used directly when the caller already holds the image
+// state -- in particular by the precomputed attachment-table scan in
+// VerifyFramebufferAndRenderPassLayouts()
+bool CoreChecks::ValidateRenderPassLayoutAgainstFramebufferImageUsage(RenderPassCreateVersion rp_version, VkImageLayout layout,
+                                                                      const IMAGE_STATE *image_state, VkImageView image_view,
+                                                                      VkFramebuffer framebuffer, VkRenderPass renderpass,
+                                                                      uint32_t attachment_index, const char *variable_name) {
+    bool skip = false;
+    const VkImage image = image_state->image;
+    const char *vuid;
+    const bool use_rp2 = (rp_version == RENDER_PASS_VERSION_2);
 
     auto image_usage = image_state->createInfo.usage;
 
@@ -477,9 +482,27 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion r
 
     if (attachments != nullptr) {
         const auto *const_pCB = static_cast<const CMD_BUFFER_STATE *>(pCB);
+
+        // Use the attachment table resolved at vkCreateFramebuffer time when it is still
+        // current. One lookup per row re-validates the table against views or images the app
+        // destroyed out from under the framebuffer; the lookup path below keeps its error
+        // reporting for those cases.
+        const auto &fb_table = framebuffer_state->attachments;
+        bool use_table = (attachments == framebufferInfo.pAttachments) && (fb_table.size() == pRenderPassInfo->attachmentCount);
+        if (use_table) {
+            for (uint32_t i = 0; i < pRenderPassInfo->attachmentCount; ++i) {
+                const auto &fb_info = fb_table[i];
+                if (!fb_info.view_state || (fb_info.view_state != GetImageViewState(attachments[i])) || !fb_info.image_state ||
+                    (fb_info.image_state != GetImageState(fb_info.image))) {
+                    use_table = false;
+                    break;
+                }
+            }
+        }
+
         for (uint32_t i = 0; i < pRenderPassInfo->attachmentCount; ++i) {
             auto image_view = attachments[i];
-            auto view_state = GetImageViewState(image_view);
+            auto view_state = use_table ? fb_table[i].view_state : GetImageViewState(image_view);
 
             if (!view_state) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT,
@@ -491,7 +514,7 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion r
             }
 
             const VkImage image = view_state->create_info.image;
-            const IMAGE_STATE *image_state = GetImageState(image);
+            const IMAGE_STATE *image_state = use_table ? fb_table[i].image_state : GetImageState(image);
 
             if (!image_state) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT,
@@ -527,67 +550,54 @@ bool CoreChecks::VerifyFramebufferAndRenderPassLayouts(RenderPassCreateVersion r
                     return !subres_skip;  // quit checking subresources once we fail once
                 };
 
-                subresource_map->ForRange(view_state->normalized_subresource_range, subresource_cb);
+                const VkImageSubresourceRange &subres_range =
+                    use_table ? fb_table[i].subresource_range : view_state->normalized_subresource_range;
+                subresource_map->ForRange(subres_range, subresource_cb);
                 skip |= subres_skip;
             }
 
-            ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_initial_layout, image, image_view,
+            ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_initial_layout, image_state, image_view,
                                                                  framebuffer, render_pass, i, "initial layout");
 
-            ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, final_layout, image, image_view, framebuffer,
+            ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, final_layout, image_state, image_view, framebuffer,
                                                                  render_pass, i, "final layout");
         }
 
+        // Shared by the three attachment-reference loops below
+        auto validate_ref_layout = [&](const VkAttachmentReference2KHR &attachment_ref, const char *variable_name) {
+            if (attachment_ref.attachment == VK_ATTACHMENT_UNUSED) return;
+            auto image_view = attachments[attachment_ref.attachment];
+            if (use_table) {
+                ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_ref.layout,
+                                                                     fb_table[attachment_ref.attachment].image_state, image_view,
+                                                                     framebuffer, render_pass, attachment_ref.attachment,
+                                                                     variable_name);
+            } else {
+                auto view_state = GetImageViewState(image_view);
+                if (view_state) {
+                    ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_ref.layout,
+                                                                         view_state->create_info.image, image_view, framebuffer,
+                                                                         render_pass, attachment_ref.attachment, variable_name);
+                }
+            }
+        };
+
         for (uint32_t j = 0; j < pRenderPassInfo->subpassCount; ++j) {
             auto &subpass = pRenderPassInfo->pSubpasses[j];
             for (uint32_t k = 0; k < pRenderPassInfo->pSubpasses[j].inputAttachmentCount; ++k) {
-                auto &attachment_ref = subpass.pInputAttachments[k];
-                if (attachment_ref.attachment != VK_ATTACHMENT_UNUSED) {
-                    auto image_view = attachments[attachment_ref.attachment];
-                    auto view_state = GetImageViewState(image_view);
-
-                    if (view_state) {
-                        auto image = view_state->create_info.image;
-                        ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_ref.layout, image, image_view,
-                                                                             framebuffer, render_pass, attachment_ref.attachment,
-                                                                             "input attachment layout");
-                    }
-                }
+                validate_ref_layout(subpass.pInputAttachments[k], "input attachment layout");
             }
 
             for (uint32_t k = 0; k < pRenderPassInfo->pSubpasses[j].colorAttachmentCount; ++k) {
                 auto &attachment_ref = subpass.pColorAttachments[k];
-                if (attachment_ref.attachment != VK_ATTACHMENT_UNUSED) {
-                    auto image_view = attachments[attachment_ref.attachment];
-                    auto view_state = GetImageViewState(image_view);
-
-                    if (view_state) {
-                        auto image = view_state->create_info.image;
-                        ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_ref.layout, image, image_view,
-                                                                             framebuffer, render_pass, attachment_ref.attachment,
-                                                                             "color attachment layout");
-                        if (subpass.pResolveAttachments) {
-                            ValidateRenderPassLayoutAgainstFramebufferImageUsage(
-                                rp_version, attachment_ref.layout, image, image_view, framebuffer, render_pass,
-                                attachment_ref.attachment, "resolve attachment layout");
-                        }
-                    }
+                validate_ref_layout(attachment_ref, "color attachment layout");
+                if (subpass.pResolveAttachments) {
+                    validate_ref_layout(attachment_ref, "resolve attachment layout");
                 }
             }
 
             if (pRenderPassInfo->pSubpasses[j].pDepthStencilAttachment) {
-                auto &attachment_ref = *subpass.pDepthStencilAttachment;
-                if (attachment_ref.attachment != VK_ATTACHMENT_UNUSED) {
-                    auto image_view = attachments[attachment_ref.attachment];
-                    auto view_state = GetImageViewState(image_view);
-
-                    if (view_state) {
-                        auto image = view_state->create_info.image;
-                        ValidateRenderPassLayoutAgainstFramebufferImageUsage(rp_version, attachment_ref.layout, image, image_view,
-                                                                             framebuffer, render_pass, attachment_ref.attachment,
-                                                                             "input attachment layout");
-                    }
-                }
+                validate_ref_layout(*subpass.pDepthStencilAttachment, "input attachment layout");
             }
         }
     }
@@ -722,55 +732,62 @@ struct ImageBarrierScoreboardEntry {
     const VkImageMemoryBarrier *barrier;
 };
 using ImageBarrierScoreboardSubresMap = std::unordered_map<VkImageSubresourceRange, ImageBarrierScoreboardEntry>;
-using ImageBarrierScoreboardImageMap = std::unordered_map<VkImage, ImageBarrierScoreboardSubresMap>;
 
 // Verify image barriers are compatible with the images they reference.
 bool CoreChecks::ValidateBarriersToImages(CMD_BUFFER_STATE const *cb_state, uint32_t imageMemoryBarrierCount,
                                           const VkImageMemoryBarrier *pImageMemoryBarriers, const char *func_name) {
     bool skip = false;
 
-    // Scoreboard for duplicate layout transition barriers within the list
+    // Walk the barriers grouped by image (the sort is stable, so within a group barriers keep their
+    // submission order): the image state, the command buffer's layout map for the image, and the
+    // duplicate-transition scoreboard are all resolved once per unique image instead of per barrier.
+    const auto barrier_order = GetBarrierHandleSortOrder(imageMemoryBarrierCount, pImageMemoryBarriers, &VkImageMemoryBarrier::image);
+
+    IMAGE_STATE *image_state = nullptr;
+    const ImageSubresourceLayoutMap *subresource_map = nullptr;
+
+    // Scoreboard for duplicate layout transition barriers within the current image's group
     // Pointers retained in the scoreboard only have the lifetime of *this* call (i.e. within the scope of the API call)
-    ImageBarrierScoreboardImageMap layout_transitions;
+    ImageBarrierScoreboardSubresMap layout_transitions;
 
-    for (uint32_t i = 0; i < imageMemoryBarrierCount; ++i) {
+    for (uint32_t n = 0; n < imageMemoryBarrierCount; ++n) {
+        const uint32_t i = barrier_order[n];
         auto img_barrier = &pImageMemoryBarriers[i];
         if (!img_barrier) continue;
 
+        if ((n == 0) || (img_barrier->image != pImageMemoryBarriers[barrier_order[n - 1]].image)) {
+            image_state = GetImageState(img_barrier->image);
+            subresource_map = image_state ? GetImageSubresourceLayoutMap(cb_state, img_barrier->image) : nullptr;
+            layout_transitions.clear();
+        }
+
         // Update the scoreboard of layout transitions and check for barriers affecting the same image and subresource
         // TODO: a higher precision could be gained by adapting the command_buffer image_layout_map logic looking for conflicts
         // at a per sub-resource level
         if (img_barrier->oldLayout != img_barrier->newLayout) {
             ImageBarrierScoreboardEntry new_entry{i, img_barrier};
-            auto image_it = layout_transitions.find(img_barrier->image);
-            if (image_it != layout_transitions.end()) {
-                auto &subres_map = image_it->second;
-                auto subres_it = subres_map.find(img_barrier->subresourceRange);
-                if (subres_it != subres_map.end()) {
-                    auto &entry = subres_it->second;
-                    if ((entry.barrier->newLayout != img_barrier->oldLayout) &&
-                        (img_barrier->oldLayout != VK_IMAGE_LAYOUT_UNDEFINED)) {
-                        const VkImageSubresourceRange &range = img_barrier->subresourceRange;
-                        skip = log_msg(
-                            report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            HandleToUint64(cb_state->commandBuffer), "VUID-VkImageMemoryBarrier-oldLayout-01197",
-                            "%s: pImageMemoryBarrier[%u] conflicts with earlier entry pImageMemoryBarrier[%u]. %s"
-                            " subresourceRange: aspectMask=%u baseMipLevel=%u levelCount=%u, baseArrayLayer=%u, layerCount=%u; "
-                            "conflicting barrier transitions image layout from %s when earlier barrier transitioned to layout %s.",
-                            func_name, i, entry.index, report_data->FormatHandle(img_barrier->image).c_str(), range.aspectMask,
-                            range.baseMipLevel, range.levelCount, range.baseArrayLayer, range.layerCount,
-                            string_VkImageLayout(img_barrier->oldLayout), string_VkImageLayout(entry.barrier->newLayout));
-                    }
-                    entry = new_entry;
-                } else {
-                    subres_map[img_barrier->subresourceRange] = new_entry;
+            auto subres_it = layout_transitions.find(img_barrier->subresourceRange);
+            if (subres_it != layout_transitions.end()) {
+                auto &entry = subres_it->second;
+                if ((entry.barrier->newLayout != img_barrier->oldLayout) &&
+                    (img_barrier->oldLayout != VK_IMAGE_LAYOUT_UNDEFINED)) {
+                    const VkImageSubresourceRange &range = img_barrier->subresourceRange;
+                    skip = log_msg(
+                        report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                        HandleToUint64(cb_state->commandBuffer), "VUID-VkImageMemoryBarrier-oldLayout-01197",
+                        "%s: pImageMemoryBarrier[%u] conflicts with earlier entry pImageMemoryBarrier[%u]. %s"
+                        " subresourceRange: aspectMask=%u baseMipLevel=%u levelCount=%u, baseArrayLayer=%u, layerCount=%u; "
+                        "conflicting barrier transitions image layout from %s when earlier barrier transitioned to layout %s.",
+                        func_name, i, entry.index, report_data->FormatHandle(img_barrier->image).c_str(), range.aspectMask,
+                        range.baseMipLevel, range.levelCount, range.baseArrayLayer, range.layerCount,
+                        string_VkImageLayout(img_barrier->oldLayout), string_VkImageLayout(entry.barrier->newLayout));
                 }
+                entry = new_entry;
             } else {
-                layout_transitions[img_barrier->image][img_barrier->subresourceRange] = new_entry;
+                layout_transitions[img_barrier->subresourceRange] = new_entry;
             }
         }
 
-        auto image_state = GetImageState(img_barrier->image);
         if (image_state) {
             VkImageUsageFlags usage_flags = image_state->createInfo.usage;
             skip |= ValidateBarrierLayoutToImageUsage(img_barrier, false, usage_flags, func_name);
@@ -804,7 +821,6 @@ bool CoreChecks::ValidateBarriersToImages(CMD_BUFFER_STATE const *cb_state, uint
                 }
             }
 
-            const auto *subresource_map = GetImageSubresourceLayoutMap(cb_state, img_barrier->image);
             if (img_barrier->oldLayout == VK_IMAGE_LAYOUT_UNDEFINED) {
                 // TODO: Set memory invalid which is in mem_tracker currently
                 // Not sure if this needs to be in the ForRange traversal, pulling it out as it is currently invariant with
@@ -857,16 +873,14 @@ bool CoreChecks::ValidateQFOTransferBarrierUniqueness(const char *func_name, CMD
         const BarrierRecord *barrier_record = nullptr;
         if (TempIsReleaseOp<Barrier, true /* Assume IsTransfer */>(pool, &barriers[b]) &&
             !IsSpecial(barriers[b].dstQueueFamilyIndex)) {
-            const auto found = barrier_sets.release.find(barriers[b]);
-            if (found != barrier_sets.release.cend()) {
-                barrier_record = &(*found);
+            barrier_record = QFOBarrierFind(barrier_sets.release, BarrierRecord(barriers[b]));
+            if (barrier_record != nullptr) {
                 transfer_type = "releasing";
             }
         } else if (IsAcquireOp<Barrier, true /*Assume IsTransfer */>(pool, &barriers[b]) &&
                    !IsSpecial(barriers[b].srcQueueFamilyIndex)) {
-            const auto found = barrier_sets.acquire.find(barriers[b]);
-            if (found != barrier_sets.acquire.cend()) {
-                barrier_record = &(*found);
+            barrier_record = QFOBarrierFind(barrier_sets.acquire, BarrierRecord(barriers[b]));
+            if (barrier_record != nullptr) {
                 transfer_type = "acquiring";
             }
         }
@@ -891,10 +905,10 @@ void CoreChecks::RecordQFOTransferBarriers(CMD_BUFFER_STATE *cb_state, uint32_t
         if (!IsTransferOp(&barriers[b])) continue;
         if (TempIsReleaseOp<Barrier, true /* Assume IsTransfer*/>(pool, &barriers[b]) &&
             !IsSpecial(barriers[b].dstQueueFamilyIndex)) {
-            barrier_sets.release.emplace(barriers[b]);
+            QFOBarrierInsert(barrier_sets.release, QFOTransferBarrier<Barrier>(barriers[b]));
         } else if (IsAcquireOp<Barrier, true /*Assume IsTransfer */>(pool, &barriers[b]) &&
                    !IsSpecial(barriers[b].srcQueueFamilyIndex)) {
-            barrier_sets.acquire.emplace(barriers[b]);
+            QFOBarrierInsert(barrier_sets.acquire, QFOTransferBarrier<Barrier>(barriers[b]));
         }
     }
 }
@@ -951,8 +965,8 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const CMD_BUFFER_STATE *cb_st
         const auto set_it = global_release_barriers.find(release.handle);
         if (set_it != global_release_barriers.cend()) {
             const QFOTransferBarrierSet<Barrier> &set_for_handle = set_it->second;
-            const auto found = set_for_handle.find(release);
-            if (found != set_for_handle.cend()) {
+            const BarrierRecord *found = QFOBarrierFind(set_for_handle, release);
+            if (found != nullptr) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                 HandleToUint64(cb_state->commandBuffer), BarrierRecord::ErrMsgDuplicateQFOSubmitted(),
                                 "%s: %s releasing queue ownership of %s (%s), from srcQueueFamilyIndex %" PRIu32
@@ -970,7 +984,7 @@ bool CoreChecks::ValidateQueuedQFOTransferBarriers(const CMD_BUFFER_STATE *cb_st
         bool matching_release_found = false;
         if (set_it != global_release_barriers.cend()) {
             const QFOTransferBarrierSet<Barrier> &set_for_handle = set_it->second;
-            matching_release_found = set_for_handle.find(acquire) != set_for_handle.cend();
+            matching_release_found = QFOBarrierFind(set_for_handle, acquire) != nullptr;
         }
         if (!matching_release_found) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
@@ -1004,8 +1018,8 @@ void CoreChecks::RecordQueuedQFOTransferBarriers(CMD_BUFFER_STATE *cb_state) {
     // Add release barriers from this submit to the global map
     for (const auto &release : cb_barriers.release) {
         // the global barrier list is mapped by resource handle to allow cleanup on resource destruction
-        // NOTE: We're using [] because creation of a Set is a needed side effect for new handles
-        global_release_barriers[release.handle].insert(release);
+        // NOTE: We're using [] because creation of a set is a needed side effect for new handles
+        QFOBarrierInsert(global_release_barriers[release.handle], release);
     }
 
     // Erase acquired barriers from this submit from the global map -- essentially marking releases as consumed
@@ -1014,7 +1028,7 @@ void CoreChecks::RecordQueuedQFOTransferBarriers(CMD_BUFFER_STATE *cb_state) {
         auto set_it = global_release_barriers.find(acquire.handle);
         if (set_it != global_release_barriers.end()) {
             QFOTransferBarrierSet<Barrier> &set_for_handle = set_it->second;
-            set_for_handle.erase(acquire);
+            QFOBarrierErase(set_for_handle, acquire);
             if (set_for_handle.size() == 0) {  // Clean up empty sets
                 global_release_barriers.erase(set_it);
             }
@@ -1498,13 +1512,7 @@ void CoreChecks::PostCallRecordCreateImage(VkDevice device, const VkImageCreateI
 
     StateTracker::PostCallRecordCreateImage(device, pCreateInfo, pAllocator, pImage, result);
 
-    IMAGE_LAYOUT_STATE image_state;
-    image_state.layout = pCreateInfo->initialLayout;
-    image_state.format = pCreateInfo->format;
-    ImageSubresourcePair subpair{*pImage, false, VkImageSubresource()};
-    imageSubresourceMap[*pImage].push_back(subpair);
-    imageLayoutMap[subpair] = image_state;
-    imageLayoutMap[subpair] = image_state;
+    // The IMAGE_STATE constructor seeds the whole-image layout from createInfo.initialLayout
 }
 
 bool CoreChecks::PreCallValidateDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
@@ -1538,14 +1546,6 @@ void CoreChecks::PreCallRecordDestroyImage(VkDevice device, VkImage image, const
     // Clean up validation specific data
     EraseQFOReleaseBarriers<VkImageMemoryBarrier>(image);
 
-    const auto &sub_entry = imageSubresourceMap.find(image);
-    if (sub_entry != imageSubresourceMap.end()) {
-        for (const auto &pair : sub_entry->second) {
-            imageLayoutMap.erase(pair);
-        }
-        imageSubresourceMap.erase(sub_entry);
-    }
-
     // Clean up generic image state
     StateTracker::PreCallRecordDestroyImage(device, image, pAllocator);
 }
@@ -3365,16 +3365,30 @@ void CoreChecks::PreCallRecordCmdBlitImage(VkCommandBuffer commandBuffer, VkImag
 }
 
 // This validates that the initial layout specified in the command buffer for the IMAGE is the same as the global IMAGE layout
-bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const ImageSubresPairLayoutMap &globalImageLayoutMap,
-                                            ImageSubresPairLayoutMap *overlayLayoutMap_arg) const {
+bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, ImageSubresPairLayoutMap *overlayLayoutMap_arg,
+                                            std::unordered_set<VkImage> *overlay_images_arg) const {
     bool skip = false;
     ImageSubresPairLayoutMap &overlayLayoutMap = *overlayLayoutMap_arg;
+    std::unordered_set<VkImage> &overlay_images = *overlay_images_arg;
     // Iterate over the layout maps for each referenced image
     for (const auto &layout_map_entry : pCB->image_layout_map) {
         const auto image = layout_map_entry.first;
         const auto *image_state = GetImageState(image);
         if (!image_state) continue;  // Can't check layouts of a dead image
-        auto subres_map = layout_map_entry.second.get();
+        auto subres_map = layout_map_entry.second;
+
+        // Watermark check: if this command buffer's use of the image last passed validation
+        // under the same layout map version and global layout generation, and no earlier
+        // command buffer in this submit has overlaid the image, the reconciliation below
+        // would repeat the identical (passing) checks and leave the same global values
+        const auto validated_it = pCB->validated_image_layouts.find(image);
+        if ((validated_it != pCB->validated_image_layouts.end()) &&
+            (validated_it->second.map_version == subres_map->Version()) &&
+            (validated_it->second.global_generation == image_state->layout_generation) &&
+            (0 == overlay_images.count(image))) {
+            continue;
+        }
+
         ImageSubresourcePair isr_pair;
         isr_pair.image = image;
         isr_pair.hasSubresource = true;
@@ -3395,7 +3409,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const I
             isr_pair.subresource = (*it_init).subresource;
             VkImageLayout initial_layout = (*it_init).layout;
             VkImageLayout image_layout;
-            if (FindLayout(overlayLayoutMap, isr_pair, image_layout) || FindLayout(globalImageLayoutMap, isr_pair, image_layout)) {
+            if (FindLayout(overlayLayoutMap, isr_pair, image_layout) || FindGlobalLayout(isr_pair, image_layout)) {
                 if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
                     // TODO: Set memory invalid which is in mem_tracker currently
                 } else if (image_layout != initial_layout) {
@@ -3423,6 +3437,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE *pCB, const I
             VkImageLayout layout = (*it_set).layout;
             isr_pair.subresource = (*it_set).subresource;
             SetLayout(overlayLayoutMap, isr_pair, layout);
+            overlay_images.insert(isr_pair.image);
         }
     }
 
@@ -3440,10 +3455,21 @@ void CoreChecks::UpdateCmdBufImageLayouts(CMD_BUFFER_STATE *pCB) {
         isr_pair.hasSubresource = true;
 
         // Update all layout set operations (which will be a subset of the initial_layouts
+        bool changed = false;
         for (auto it_set = subres_map->BeginSetLayout(); !it_set.AtEnd(); ++it_set) {
             VkImageLayout layout = (*it_set).layout;
             isr_pair.subresource = (*it_set).subresource;
-            SetGlobalLayout(isr_pair, layout);
+            changed |= SetGlobalLayout(isr_pair, layout);
+        }
+
+        // This submission validated successfully and left the global layouts untouched -- record
+        // the versions so steady-state resubmits of this command buffer skip re-reconciliation.
+        // Images bound to a swapchain validate against the swapchain image's state, so they are
+        // left unwatermarked.
+        if (!changed && (VK_NULL_HANDLE == image_state->bind_swapchain)) {
+            pCB->validated_image_layouts[image] = {subres_map->Version(), image_state->layout_generation};
+        } else {
+            pCB->validated_image_layouts.erase(image);
         }
     }
 }
@@ -4612,8 +4638,80 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
                                              const char *function) {
     bool skip = false;
 
+    // The per-image invariants are hoisted out of the region loop, and each region is first run
+    // through a branch-light screen over the same conditions the reporting code checks.  Clean
+    // regions -- the overwhelmingly common case for the multi-hundred-region copies streaming
+    // workloads issue -- never touch the reporting paths or their formatting costs.
+    const VkImageType image_type = image_state->createInfo.imageType;
+    const VkFormat image_format = image_state->createInfo.format;
+    const bool is_depth_and_stencil = FormatIsDepthAndStencil(image_format);
+    const bool is_compressed = FormatIsCompressed(image_format) || FormatIsSinglePlane_422(image_format);
+    const VkExtent3D block_size = is_compressed ? FormatTexelBlockExtent(image_format) : VkExtent3D{1, 1, 1};
+    const uint32_t block_size_in_bytes = is_compressed ? FormatElementSize(image_format) : 1;
+
+    // Element size, aspect validity, and subresource extent depend only on the region's aspect
+    // mask and mip level, which rarely vary across the regions of one call, so memoize them
+    // instead of recomputing them per region.
+    VkImageAspectFlags cached_aspect_mask = 0;
+    uint32_t cached_mip_level = 0;
+    bool cache_valid = false;
+    uint32_t element_size = 0;
+    bool aspect_single_bit = false;
+    bool aspects_present = false;
+    VkExtent3D adjusted_image_extent = {};
+
     for (uint32_t i = 0; i < regionCount; i++) {
-        if (image_state->createInfo.imageType == VK_IMAGE_TYPE_1D) {
+        const VkBufferImageCopy &region = pRegions[i];
+        const VkImageSubresourceLayers &subresource = region.imageSubresource;
+
+        if (!cache_valid || (subresource.aspectMask != cached_aspect_mask) || (subresource.mipLevel != cached_mip_level)) {
+            cached_aspect_mask = subresource.aspectMask;
+            cached_mip_level = subresource.mipLevel;
+            cache_valid = true;
+            element_size = FormatElementSize(image_format, subresource.aspectMask);
+            aspect_single_bit = (std::bitset<sizeof(VkFlags) * CHAR_BIT>(subresource.aspectMask).count() == 1);
+            aspects_present = VerifyAspectsPresent(subresource.aspectMask, image_format);
+            adjusted_image_extent = GetImageSubresourceExtent(image_state, &subresource);
+        }
+
+        bool region_clean = aspect_single_bit && aspects_present;
+        if (image_type == VK_IMAGE_TYPE_1D) {
+            region_clean &= (region.imageOffset.y == 0) && (region.imageExtent.height == 1);
+        }
+        if ((image_type == VK_IMAGE_TYPE_1D) || (image_type == VK_IMAGE_TYPE_2D)) {
+            region_clean &= (region.imageOffset.z == 0) && (region.imageExtent.depth == 1);
+        }
+        if (image_type == VK_IMAGE_TYPE_3D) {
+            region_clean &= (0 == subresource.baseArrayLayer) && (1 == subresource.layerCount);
+        }
+        region_clean &= is_depth_and_stencil || (SafeModulo(region.bufferOffset, element_size) == 0);
+        region_clean &= (SafeModulo(region.bufferOffset, 4) == 0);
+        region_clean &= (region.bufferRowLength == 0) || (region.bufferRowLength >= region.imageExtent.width);
+        region_clean &= (region.bufferImageHeight == 0) || (region.bufferImageHeight >= region.imageExtent.height);
+        region_clean &= (region.imageOffset.x >= 0) && (region.imageOffset.x <= static_cast<int32_t>(adjusted_image_extent.width)) &&
+                        ((region.imageOffset.x + region.imageExtent.width) <= static_cast<int32_t>(adjusted_image_extent.width));
+        region_clean &= (region.imageOffset.y >= 0) &&
+                        (region.imageOffset.y <= static_cast<int32_t>(adjusted_image_extent.height)) &&
+                        ((region.imageOffset.y + region.imageExtent.height) <= static_cast<int32_t>(adjusted_image_extent.height));
+        region_clean &= (region.imageOffset.z >= 0) && (region.imageOffset.z <= static_cast<int32_t>(adjusted_image_extent.depth)) &&
+                        ((region.imageOffset.z + region.imageExtent.depth) <= static_cast<int32_t>(adjusted_image_extent.depth));
+        if (is_compressed) {
+            region_clean &= (SafeModulo(region.bufferRowLength, block_size.width) == 0);
+            region_clean &= (SafeModulo(region.bufferImageHeight, block_size.height) == 0);
+            region_clean &= (SafeModulo(region.imageOffset.x, block_size.width) == 0) &&
+                            (SafeModulo(region.imageOffset.y, block_size.height) == 0) &&
+                            (SafeModulo(region.imageOffset.z, block_size.depth) == 0);
+            region_clean &= (SafeModulo(region.bufferOffset, block_size_in_bytes) == 0);
+            region_clean &= (SafeModulo(region.imageExtent.width, block_size.width) == 0) ||
+                            (region.imageExtent.width + region.imageOffset.x == adjusted_image_extent.width);
+            region_clean &= (SafeModulo(region.imageExtent.height, block_size.height) == 0) ||
+                            (region.imageExtent.height + region.imageOffset.y == adjusted_image_extent.height);
+            region_clean &= (SafeModulo(region.imageExtent.depth, block_size.depth) == 0) ||
+                            (region.imageExtent.depth + region.imageOffset.z == adjusted_image_extent.depth);
+        }
+        if (region_clean) continue;
+
+        if (image_type == VK_IMAGE_TYPE_1D) {
             if ((pRegions[i].imageOffset.y != 0) || (pRegions[i].imageExtent.height != 1)) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-srcImage-00199",
@@ -4623,7 +4721,7 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
             }
         }
 
-        if ((image_state->createInfo.imageType == VK_IMAGE_TYPE_1D) || (image_state->createInfo.imageType == VK_IMAGE_TYPE_2D)) {
+        if ((image_type == VK_IMAGE_TYPE_1D) || (image_type == VK_IMAGE_TYPE_2D)) {
             if ((pRegions[i].imageOffset.z != 0) || (pRegions[i].imageExtent.depth != 1)) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-srcImage-00201",
@@ -4633,7 +4731,7 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
             }
         }
 
-        if (image_state->createInfo.imageType == VK_IMAGE_TYPE_3D) {
+        if (image_type == VK_IMAGE_TYPE_3D) {
             if ((0 != pRegions[i].imageSubresource.baseArrayLayer) || (1 != pRegions[i].imageSubresource.layerCount)) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-baseArrayLayer-00213",
@@ -4645,9 +4743,7 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
 
         // If the the calling command's VkImage parameter's format is not a depth/stencil format,
         // then bufferOffset must be a multiple of the calling command's VkImage parameter's element size
-        uint32_t element_size = FormatElementSize(image_state->createInfo.format, pRegions[i].imageSubresource.aspectMask);
-
-        if (!FormatIsDepthAndStencil(image_state->createInfo.format) && SafeModulo(pRegions[i].bufferOffset, element_size) != 0) {
+        if (!is_depth_and_stencil && SafeModulo(pRegions[i].bufferOffset, element_size) != 0) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                             HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-bufferOffset-00193",
                             "%s(): pRegion[%d] bufferOffset 0x%" PRIxLEAST64
@@ -4681,39 +4777,37 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
                 function, i, pRegions[i].bufferImageHeight, pRegions[i].imageExtent.height);
         }
 
-        // Calculate adjusted image extent, accounting for multiplane image factors
-        VkExtent3D adusted_image_extent = GetImageSubresourceExtent(image_state, &pRegions[i].imageSubresource);
         // imageOffset.x and (imageExtent.width + imageOffset.x) must both be >= 0 and <= image subresource width
-        if ((pRegions[i].imageOffset.x < 0) || (pRegions[i].imageOffset.x > static_cast<int32_t>(adusted_image_extent.width)) ||
-            ((pRegions[i].imageOffset.x + pRegions[i].imageExtent.width) > static_cast<int32_t>(adusted_image_extent.width))) {
+        if ((pRegions[i].imageOffset.x < 0) || (pRegions[i].imageOffset.x > static_cast<int32_t>(adjusted_image_extent.width)) ||
+            ((pRegions[i].imageOffset.x + pRegions[i].imageExtent.width) > static_cast<int32_t>(adjusted_image_extent.width))) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                             HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-imageOffset-00197",
                             "%s(): Both pRegion[%d] imageoffset.x (%d) and (imageExtent.width + imageOffset.x) (%d) must be >= "
                             "zero or <= image subresource width (%d).",
                             function, i, pRegions[i].imageOffset.x, (pRegions[i].imageOffset.x + pRegions[i].imageExtent.width),
-                            adusted_image_extent.width);
+                            adjusted_image_extent.width);
         }
 
         // imageOffset.y and (imageExtent.height + imageOffset.y) must both be >= 0 and <= image subresource height
-        if ((pRegions[i].imageOffset.y < 0) || (pRegions[i].imageOffset.y > static_cast<int32_t>(adusted_image_extent.height)) ||
-            ((pRegions[i].imageOffset.y + pRegions[i].imageExtent.height) > static_cast<int32_t>(adusted_image_extent.height))) {
+        if ((pRegions[i].imageOffset.y < 0) || (pRegions[i].imageOffset.y > static_cast<int32_t>(adjusted_image_extent.height)) ||
+            ((pRegions[i].imageOffset.y + pRegions[i].imageExtent.height) > static_cast<int32_t>(adjusted_image_extent.height))) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                             HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-imageOffset-00198",
                             "%s(): Both pRegion[%d] imageoffset.y (%d) and (imageExtent.height + imageOffset.y) (%d) must be >= "
                             "zero or <= image subresource height (%d).",
                             function, i, pRegions[i].imageOffset.y, (pRegions[i].imageOffset.y + pRegions[i].imageExtent.height),
-                            adusted_image_extent.height);
+                            adjusted_image_extent.height);
         }
 
         // imageOffset.z and (imageExtent.depth + imageOffset.z) must both be >= 0 and <= image subresource depth
-        if ((pRegions[i].imageOffset.z < 0) || (pRegions[i].imageOffset.z > static_cast<int32_t>(adusted_image_extent.depth)) ||
-            ((pRegions[i].imageOffset.z + pRegions[i].imageExtent.depth) > static_cast<int32_t>(adusted_image_extent.depth))) {
+        if ((pRegions[i].imageOffset.z < 0) || (pRegions[i].imageOffset.z > static_cast<int32_t>(adjusted_image_extent.depth)) ||
+            ((pRegions[i].imageOffset.z + pRegions[i].imageExtent.depth) > static_cast<int32_t>(adjusted_image_extent.depth))) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                             HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-imageOffset-00200",
                             "%s(): Both pRegion[%d] imageoffset.z (%d) and (imageExtent.depth + imageOffset.z) (%d) must be >= "
                             "zero or <= image subresource depth (%d).",
                             function, i, pRegions[i].imageOffset.z, (pRegions[i].imageOffset.z + pRegions[i].imageExtent.depth),
-                            adusted_image_extent.depth);
+                            adjusted_image_extent.depth);
         }
 
         // subresource aspectMask must have exactly 1 bit set
@@ -4735,9 +4829,7 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
         }
 
         // Checks that apply only to compressed images
-        if (FormatIsCompressed(image_state->createInfo.format) || FormatIsSinglePlane_422(image_state->createInfo.format)) {
-            auto block_size = FormatTexelBlockExtent(image_state->createInfo.format);
-
+        if (is_compressed) {
             //  BufferRowLength must be a multiple of block width
             if (SafeModulo(pRegions[i].bufferRowLength, block_size.width) != 0) {
                 skip |= log_msg(
@@ -4769,7 +4861,6 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
             }
 
             // bufferOffset must be a multiple of block size (linear bytes)
-            uint32_t block_size_in_bytes = FormatElementSize(image_state->createInfo.format);
             if (SafeModulo(pRegions[i].bufferOffset, block_size_in_bytes) != 0) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-bufferOffset-00206",
@@ -4779,37 +4870,36 @@ bool CoreChecks::ValidateBufferImageCopyData(uint32_t regionCount, const VkBuffe
             }
 
             // imageExtent width must be a multiple of block width, or extent+offset width must equal subresource width
-            VkExtent3D mip_extent = GetImageSubresourceExtent(image_state, &(pRegions[i].imageSubresource));
             if ((SafeModulo(pRegions[i].imageExtent.width, block_size.width) != 0) &&
-                (pRegions[i].imageExtent.width + pRegions[i].imageOffset.x != mip_extent.width)) {
+                (pRegions[i].imageExtent.width + pRegions[i].imageOffset.x != adjusted_image_extent.width)) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-imageExtent-00207",
                                 "%s(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block width "
                                 "(%d), or when added to offset.x (%d) must equal the image subresource width (%d)..",
                                 function, i, pRegions[i].imageExtent.width, block_size.width, pRegions[i].imageOffset.x,
-                                mip_extent.width);
+                                adjusted_image_extent.width);
             }
 
             // imageExtent height must be a multiple of block height, or extent+offset height must equal subresource height
             if ((SafeModulo(pRegions[i].imageExtent.height, block_size.height) != 0) &&
-                (pRegions[i].imageExtent.height + pRegions[i].imageOffset.y != mip_extent.height)) {
+                (pRegions[i].imageExtent.height + pRegions[i].imageOffset.y != adjusted_image_extent.height)) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-imageExtent-00208",
                                 "%s(): pRegion[%d] extent height (%d) must be a multiple of the compressed texture block height "
                                 "(%d), or when added to offset.y (%d) must equal the image subresource height (%d)..",
                                 function, i, pRegions[i].imageExtent.height, block_size.height, pRegions[i].imageOffset.y,
-                                mip_extent.height);
+                                adjusted_image_extent.height);
             }
 
             // imageExtent depth must be a multiple of block depth, or extent+offset depth must equal subresource depth
             if ((SafeModulo(pRegions[i].imageExtent.depth, block_size.depth) != 0) &&
-                (pRegions[i].imageExtent.depth + pRegions[i].imageOffset.z != mip_extent.depth)) {
+                (pRegions[i].imageExtent.depth + pRegions[i].imageOffset.z != adjusted_image_extent.depth)) {
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT,
                                 HandleToUint64(image_state->image), "VUID-VkBufferImageCopy-imageExtent-00209",
                                 "%s(): pRegion[%d] extent width (%d) must be a multiple of the compressed texture block depth "
                                 "(%d), or when added to offset.z (%d) must equal the image subresource depth (%d)..",
                                 function, i, pRegions[i].imageExtent.depth, block_size.depth, pRegions[i].imageOffset.z,
-                                mip_extent.depth);
+                                adjusted_image_extent.depth);
             }
         }
     }
@@ -4821,6 +4911,15 @@ static bool ValidateImageBounds(const debug_report_data *report_data, const IMAG
                                 const VkBufferImageCopy *pRegions, const char *func_name, const char *msg_code) {
     bool skip = false;
     const VkImageCreateInfo *image_info = &(image_state->createInfo);
+    const bool is_compressed = FormatIsCompressed(image_info->format);
+    const VkExtent3D block_extent = is_compressed ? FormatTexelBlockExtent(image_info->format) : VkExtent3D{1, 1, 1};
+
+    // The subresource extent depends only on the region's aspect mask and mip level; memoize it
+    // (including the compressed-format round-up) instead of recomputing it per region.
+    VkImageAspectFlags cached_aspect_mask = 0;
+    uint32_t cached_mip_level = 0;
+    bool cache_valid = false;
+    VkExtent3D image_extent = {};
 
     for (uint32_t i = 0; i < regionCount; i++) {
         VkExtent3D extent = pRegions[i].imageExtent;
@@ -4834,19 +4933,24 @@ static bool ValidateImageBounds(const debug_report_data *report_data, const IMAG
                         func_name, i, extent.width, extent.height, extent.depth);
         }
 
-        VkExtent3D image_extent = GetImageSubresourceExtent(image_state, &(pRegions[i].imageSubresource));
+        const VkImageSubresourceLayers &subresource = pRegions[i].imageSubresource;
+        if (!cache_valid || (subresource.aspectMask != cached_aspect_mask) || (subresource.mipLevel != cached_mip_level)) {
+            cached_aspect_mask = subresource.aspectMask;
+            cached_mip_level = subresource.mipLevel;
+            cache_valid = true;
+            image_extent = GetImageSubresourceExtent(image_state, &subresource);
 
-        // If we're using a compressed format, valid extent is rounded up to multiple of block size (per 18.1)
-        if (FormatIsCompressed(image_info->format)) {
-            auto block_extent = FormatTexelBlockExtent(image_info->format);
-            if (image_extent.width % block_extent.width) {
-                image_extent.width += (block_extent.width - (image_extent.width % block_extent.width));
-            }
-            if (image_extent.height % block_extent.height) {
-                image_extent.height += (block_extent.height - (image_extent.height % block_extent.height));
-            }
-            if (image_extent.depth % block_extent.depth) {
-                image_extent.depth += (block_extent.depth - (image_extent.depth % block_extent.depth));
+            // If we're using a compressed format, valid extent is rounded up to multiple of block size (per 18.1)
+            if (is_compressed) {
+                if (image_extent.width % block_extent.width) {
+                    image_extent.width += (block_extent.width - (image_extent.width % block_extent.width));
+                }
+                if (image_extent.height % block_extent.height) {
+                    image_extent.height += (block_extent.height - (image_extent.height % block_extent.height));
+                }
+                if (image_extent.depth % block_extent.depth) {
+                    image_extent.depth += (block_extent.depth - (image_extent.depth % block_extent.depth));
+                }
             }
         }
 
@@ -4865,18 +4969,28 @@ static inline bool ValidateBufferBounds(const debug_report_data *report_data, IM
     bool skip = false;
 
     VkDeviceSize buffer_size = buff_state->createInfo.size;
+    const VkFormat image_format = image_state->createInfo.format;
+    const bool is_blocked = FormatIsCompressed(image_format) || FormatIsSinglePlane_422(image_format);
+    const VkExtent3D block_dim = is_blocked ? FormatTexelBlockExtent(image_format) : VkExtent3D{1, 1, 1};
+
+    // The element size depends only on the region's aspect mask; memoize it across regions.
+    VkImageAspectFlags cached_aspect_mask = 0;
+    bool cache_valid = false;
+    VkDeviceSize unit_size = 0;
 
     for (uint32_t i = 0; i < regionCount; i++) {
         VkExtent3D copy_extent = pRegions[i].imageExtent;
 
         VkDeviceSize buffer_width = (0 == pRegions[i].bufferRowLength ? copy_extent.width : pRegions[i].bufferRowLength);
         VkDeviceSize buffer_height = (0 == pRegions[i].bufferImageHeight ? copy_extent.height : pRegions[i].bufferImageHeight);
-        VkDeviceSize unit_size = FormatElementSize(image_state->createInfo.format,
-                                                   pRegions[i].imageSubresource.aspectMask);  // size (bytes) of texel or block
+        if (!cache_valid || (pRegions[i].imageSubresource.aspectMask != cached_aspect_mask)) {
+            cached_aspect_mask = pRegions[i].imageSubresource.aspectMask;
+            cache_valid = true;
+            unit_size = FormatElementSize(image_format, cached_aspect_mask);  // size (bytes) of texel or block
+        }
 
-        if (FormatIsCompressed(image_state->createInfo.format) || FormatIsSinglePlane_422(image_state->createInfo.format)) {
+        if (is_blocked) {
             // Switch to texel block units, rounding up for any partially-used blocks
-            auto block_dim = FormatTexelBlockExtent(image_state->createInfo.format);
             buffer_width = (buffer_width + block_dim.width - 1) / block_dim.width;
             buffer_height = (buffer_height + block_dim.height - 1) / block_dim.height;
 
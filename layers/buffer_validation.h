@@ -39,4 +39,20 @@ uint32_t ResolveRemainingLevels(const VkImageSubresourceRange *range, uint32_t m
 uint32_t ResolveRemainingLayers(const VkImageSubresourceRange *range, uint32_t layers);
 VkImageSubresourceRange NormalizeSubresourceRange(const IMAGE_STATE &image_state, const VkImageSubresourceRange &range);
 
+// Build a stable ordering of barrier array indices sorted by the handle each barrier references.
+// Barriers naming the same resource become adjacent (keeping their submission order within the
+// group), so the batched barrier validation paths can resolve per-resource state once per unique
+// handle instead of once per barrier.
+template <typename Barrier, typename Handle>
+std::vector<uint32_t> GetBarrierHandleSortOrder(uint32_t count, const Barrier *barriers, Handle Barrier::*handle) {
+    std::vector<uint32_t> order(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [barriers, handle](uint32_t lhs, uint32_t rhs) {
+        return HandleToUint64(barriers[lhs].*handle) < HandleToUint64(barriers[rhs].*handle);
+    });
+    return order;
+}
+
 #endif  // CORE_VALIDATION_BUFFER_VALIDATION_H_
@@ -64,6 +64,12 @@
 #include "buffer_validation.h"
 #include "shader_validation.h"
 #include "vk_layer_utils.h"
+#include "vl_thread_pool.h"
+#include "xxhash.h"
+
+// Defined in the chassis; gates population of the slot-indexed state tables, whose encoding only
+// exists when the layer is inventing the handle values
+extern bool wrap_handles;
 
 // These functions are defined *outside* the core_validation namespace as their type
 // is also defined outside that namespace
@@ -115,6 +121,16 @@ static const VkDeviceMemory MEMTRACKER_SWAP_CHAIN_IMAGE_KEY = (VkDeviceMemory)(-
 // 2nd special memory handle used to flag object as unbound from memory
 static const VkDeviceMemory MEMORY_UNBOUND = VkDeviceMemory(~((uint64_t)(0)) - 1);
 
+// Dictionary of canonical render pass compatibility signatures (see RenderPassCompatDef)
+static RenderPassCompatDict render_pass_compat_dict;
+static SamplerDict sampler_dict;
+
+SamplerDefId GetCanonicalSamplerId(const VkSamplerCreateInfo *pci) { return sampler_dict.look_up(SamplerDef(pci)); }
+
+RenderPassCompatId GetRenderPassCompatId(const VkRenderPassCreateInfo2KHR *ci) {
+    return render_pass_compat_dict.look_up(RenderPassCompatDef(ci));
+}
+
 // Get the global maps of pending releases
 const GlobalQFOTransferBarrierMap<VkImageMemoryBarrier> &CoreChecks::GetGlobalQFOReleaseBarrierMap(
     const QFOTransferBarrier<VkImageMemoryBarrier>::Tag &type_tag) const {
@@ -215,68 +231,70 @@ std::string FormatDebugLabel(const char *prefix, const LoggingLabel &label) {
 }
 
 // the ImageLayoutMap implementation bakes in the number of valid aspects -- we have to choose the correct one at construction time
+// Maps are placement-constructed in the collection's arena so a command buffer reset releases
+// them wholesale instead of one heap free per image
+template <typename MapType>
+static ImageSubresourceLayoutMap *MakeLayoutMap(ImageLayoutMapCollection &collection, const IMAGE_STATE &image_state) {
+    return new (collection.AllocFromArena(sizeof(MapType))) MapType(image_state);
+}
+
 template <uint32_t kThreshold>
-static std::unique_ptr<ImageSubresourceLayoutMap> LayoutMapFactoryByAspect(const IMAGE_STATE &image_state) {
+static ImageSubresourceLayoutMap *LayoutMapFactoryByAspect(ImageLayoutMapCollection &collection,
+                                                           const IMAGE_STATE &image_state) {
     ImageSubresourceLayoutMap *map = nullptr;
     switch (image_state.full_range.aspectMask) {
         case VK_IMAGE_ASPECT_COLOR_BIT:
-            map = new ImageSubresourceLayoutMapImpl<ColorAspectTraits, kThreshold>(image_state);
+            map = MakeLayoutMap<ImageSubresourceLayoutMapImpl<ColorAspectTraits, kThreshold>>(collection, image_state);
             break;
         case VK_IMAGE_ASPECT_DEPTH_BIT:
-            map = new ImageSubresourceLayoutMapImpl<DepthAspectTraits, kThreshold>(image_state);
+            map = MakeLayoutMap<ImageSubresourceLayoutMapImpl<DepthAspectTraits, kThreshold>>(collection, image_state);
             break;
         case VK_IMAGE_ASPECT_STENCIL_BIT:
-            map = new ImageSubresourceLayoutMapImpl<StencilAspectTraits, kThreshold>(image_state);
+            map = MakeLayoutMap<ImageSubresourceLayoutMapImpl<StencilAspectTraits, kThreshold>>(collection, image_state);
             break;
         case VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT:
-            map = new ImageSubresourceLayoutMapImpl<DepthStencilAspectTraits, kThreshold>(image_state);
+            map = MakeLayoutMap<ImageSubresourceLayoutMapImpl<DepthStencilAspectTraits, kThreshold>>(collection, image_state);
             break;
         case VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT:
-            map = new ImageSubresourceLayoutMapImpl<Multiplane2AspectTraits, kThreshold>(image_state);
+            map = MakeLayoutMap<ImageSubresourceLayoutMapImpl<Multiplane2AspectTraits, kThreshold>>(collection, image_state);
             break;
         case VK_IMAGE_ASPECT_PLANE_0_BIT | VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_PLANE_2_BIT:
-            map = new ImageSubresourceLayoutMapImpl<Multiplane3AspectTraits, kThreshold>(image_state);
+            map = MakeLayoutMap<ImageSubresourceLayoutMapImpl<Multiplane3AspectTraits, kThreshold>>(collection, image_state);
             break;
     }
 
     assert(map);  // We shouldn't be able to get here null unless the traits cases are incomplete
-    return std::unique_ptr<ImageSubresourceLayoutMap>(map);
+    return map;
 }
 
-static std::unique_ptr<ImageSubresourceLayoutMap> LayoutMapFactory(const IMAGE_STATE &image_state) {
-    std::unique_ptr<ImageSubresourceLayoutMap> map;
+static ImageSubresourceLayoutMap *LayoutMapFactory(ImageLayoutMapCollection &collection, const IMAGE_STATE &image_state) {
+    ImageSubresourceLayoutMap *map = nullptr;
     const uint32_t kAlwaysDenseLimit = 16;  // About a cacheline on deskop architectures
     if (image_state.full_range.layerCount <= kAlwaysDenseLimit) {
         // Create a dense row map
-        map = LayoutMapFactoryByAspect<0>(image_state);
+        map = LayoutMapFactoryByAspect<0>(collection, image_state);
     } else {
         // Create an initially sparse row map
-        map = LayoutMapFactoryByAspect<kAlwaysDenseLimit>(image_state);
+        map = LayoutMapFactoryByAspect<kAlwaysDenseLimit>(collection, image_state);
     }
     return map;
 }
 
 // The const variant only need the image as it is the key for the map
 const ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(const CMD_BUFFER_STATE *cb_state, VkImage image) {
-    auto it = cb_state->image_layout_map.find(image);
-    if (it == cb_state->image_layout_map.cend()) {
-        return nullptr;
-    }
-    return it->second.get();
+    return cb_state->image_layout_map.Find(image);
 }
 
 // The non-const variant only needs the image state, as the factory requires it to construct a new entry
 ImageSubresourceLayoutMap *GetImageSubresourceLayoutMap(CMD_BUFFER_STATE *cb_state, const IMAGE_STATE &image_state) {
-    auto it = cb_state->image_layout_map.find(image_state.image);
-    if (it == cb_state->image_layout_map.end()) {
+    ImageSubresourceLayoutMap *map = cb_state->image_layout_map.Find(image_state.image);
+    if (!map) {
         // Empty slot... fill it in.
-        auto insert_pair = cb_state->image_layout_map.insert(std::make_pair(image_state.image, LayoutMapFactory(image_state)));
-        assert(insert_pair.second);
-        ImageSubresourceLayoutMap *new_map = insert_pair.first->second.get();
-        assert(new_map);
-        return new_map;
+        map = LayoutMapFactory(cb_state->image_layout_map, image_state);
+        assert(map);
+        cb_state->image_layout_map.Insert(image_state.image, map);
     }
-    return it->second.get();
+    return map;
 }
 
 void ValidationStateTracker::AddMemObjInfo(void *object, const VkDeviceMemory mem, const VkMemoryAllocateInfo *pAllocateInfo) {
@@ -298,24 +316,35 @@ void ValidationStateTracker::AddMemObjInfo(void *object, const VkDeviceMemory me
     }
 }
 
+std::mutex &GetCommandBufferBindingLock() {
+    static std::mutex lock;
+    return lock;
+}
+
 // Create binding link between given sampler and command buffer node
 void ValidationStateTracker::AddCommandBufferBindingSampler(CMD_BUFFER_STATE *cb_node, SAMPLER_STATE *sampler_state) {
+    if (!state_tracking.command_buffer_bindings) return;
     auto inserted = cb_node->object_bindings.emplace(sampler_state->sampler, kVulkanObjectTypeSampler);
     if (inserted.second) {
         // Only need to complete the cross-reference if this is a new item
-        sampler_state->cb_bindings.insert(cb_node);
+        std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+        sampler_state->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
     }
 }
 
 // Create binding link between given image node and command buffer node
 void ValidationStateTracker::AddCommandBufferBindingImage(CMD_BUFFER_STATE *cb_node, IMAGE_STATE *image_state) {
+    if (!state_tracking.command_buffer_bindings) return;
     // Skip validation if this image was created through WSI
     if (image_state->binding.mem != MEMTRACKER_SWAP_CHAIN_IMAGE_KEY) {
         // First update cb binding for image
         auto image_inserted = cb_node->object_bindings.emplace(image_state->image, kVulkanObjectTypeImage);
         if (image_inserted.second) {
             // Only need to continue if this is a new item (the rest of the work would have be done previous)
-            image_state->cb_bindings.insert(cb_node);
+            {
+                std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+                image_state->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+            }
             // Now update CB binding in MemObj mini CB list
             for (auto mem_binding : image_state->GetBoundMemory()) {
                 DEVICE_MEMORY_STATE *pMemInfo = GetDevMemState(mem_binding);
@@ -324,7 +353,8 @@ void ValidationStateTracker::AddCommandBufferBindingImage(CMD_BUFFER_STATE *cb_n
                     auto mem_inserted = cb_node->memObjs.insert(mem_binding);
                     if (mem_inserted.second) {
                         // Only need to complete the cross-reference if this is a new item
-                        pMemInfo->cb_bindings.insert(cb_node);
+                        std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+                        pMemInfo->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node, true));
                     }
                 }
             }
@@ -334,11 +364,15 @@ void ValidationStateTracker::AddCommandBufferBindingImage(CMD_BUFFER_STATE *cb_n
 
 // Create binding link between given image view node and its image with command buffer node
 void ValidationStateTracker::AddCommandBufferBindingImageView(CMD_BUFFER_STATE *cb_node, IMAGE_VIEW_STATE *view_state) {
+    if (!state_tracking.command_buffer_bindings) return;
     // First add bindings for imageView
     auto inserted = cb_node->object_bindings.emplace(view_state->image_view, kVulkanObjectTypeImageView);
     if (inserted.second) {
         // Only need to continue if this is a new item
-        view_state->cb_bindings.insert(cb_node);
+        {
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            view_state->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+        }
         auto image_state = GetImageState(view_state->create_info.image);
         // Add bindings for image within imageView
         if (image_state) {
@@ -349,11 +383,15 @@ void ValidationStateTracker::AddCommandBufferBindingImageView(CMD_BUFFER_STATE *
 
 // Create binding link between given buffer node and command buffer node
 void ValidationStateTracker::AddCommandBufferBindingBuffer(CMD_BUFFER_STATE *cb_node, BUFFER_STATE *buffer_state) {
+    if (!state_tracking.command_buffer_bindings) return;
     // First update cb binding for buffer
     auto buffer_inserted = cb_node->object_bindings.emplace(buffer_state->buffer, kVulkanObjectTypeBuffer);
     if (buffer_inserted.second) {
         // Only need to continue if this is a new item
-        buffer_state->cb_bindings.insert(cb_node);
+        {
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            buffer_state->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+        }
         // Now update CB binding in MemObj mini CB list
         for (auto mem_binding : buffer_state->GetBoundMemory()) {
             DEVICE_MEMORY_STATE *pMemInfo = GetDevMemState(mem_binding);
@@ -362,7 +400,8 @@ void ValidationStateTracker::AddCommandBufferBindingBuffer(CMD_BUFFER_STATE *cb_
                 auto inserted = cb_node->memObjs.insert(mem_binding);
                 if (inserted.second) {
                     // Only need to complete the cross-reference if this is a new item
-                    pMemInfo->cb_bindings.insert(cb_node);
+                    std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+                    pMemInfo->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node, true));
                 }
             }
         }
@@ -371,11 +410,15 @@ void ValidationStateTracker::AddCommandBufferBindingBuffer(CMD_BUFFER_STATE *cb_
 
 // Create binding link between given buffer view node and its buffer with command buffer node
 void ValidationStateTracker::AddCommandBufferBindingBufferView(CMD_BUFFER_STATE *cb_node, BUFFER_VIEW_STATE *view_state) {
+    if (!state_tracking.command_buffer_bindings) return;
     // First add bindings for bufferView
     auto inserted = cb_node->object_bindings.emplace(view_state->buffer_view, kVulkanObjectTypeBufferView);
     if (inserted.second) {
         // Only need to complete the cross-reference if this is a new item
-        view_state->cb_bindings.insert(cb_node);
+        {
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            view_state->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+        }
         auto buffer_state = GetBufferState(view_state->create_info.buffer);
         // Add bindings for buffer within bufferView
         if (buffer_state) {
@@ -386,10 +429,14 @@ void ValidationStateTracker::AddCommandBufferBindingBufferView(CMD_BUFFER_STATE
 
 // Create binding link between given acceleration structure and command buffer node
 void CoreChecks::AddCommandBufferBindingAccelerationStructure(CMD_BUFFER_STATE *cb_node, ACCELERATION_STRUCTURE_STATE *as_state) {
+    if (!state_tracking.command_buffer_bindings) return;
     auto as_inserted = cb_node->object_bindings.emplace(as_state->acceleration_structure, kVulkanObjectTypeAccelerationStructureNV);
     if (as_inserted.second) {
         // Only need to complete the cross-reference if this is a new item
-        as_state->cb_bindings.insert(cb_node);
+        {
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            as_state->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+        }
         // Now update CB binding in MemObj mini CB list
         for (auto mem_binding : as_state->GetBoundMemory()) {
             DEVICE_MEMORY_STATE *pMemInfo = GetDevMemState(mem_binding);
@@ -398,7 +445,8 @@ void CoreChecks::AddCommandBufferBindingAccelerationStructure(CMD_BUFFER_STATE *
                 auto mem_inserted = cb_node->memObjs.insert(mem_binding);
                 if (mem_inserted.second) {
                     // Only need to complete the cross-reference if this is a new item
-                    pMemInfo->cb_bindings.insert(cb_node);
+                    std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+                    pMemInfo->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node, true));
                 }
             }
         }
@@ -409,12 +457,8 @@ void CoreChecks::AddCommandBufferBindingAccelerationStructure(CMD_BUFFER_STATE *
 void ValidationStateTracker::ClearCmdBufAndMemReferences(CMD_BUFFER_STATE *cb_node) {
     if (cb_node) {
         if (cb_node->memObjs.size() > 0) {
-            for (auto mem : cb_node->memObjs) {
-                DEVICE_MEMORY_STATE *pInfo = GetDevMemState(mem);
-                if (pInfo) {
-                    pInfo->cb_bindings.erase(cb_node);
-                }
-            }
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            cb_node->cb_binding_pool.ReleaseMemBindings();
             cb_node->memObjs.clear();
         }
     }
@@ -864,6 +908,26 @@ bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const
                                                  const char *error_code) const {
     bool skip = false;
 
+    // Render passes interned to the same canonical compatibility signature are compatible by
+    // construction; skip the structural walk.  Mismatched signatures fall through to the walk,
+    // which reports the specific incompatibilities (or none, when only normalization differs).
+    if (rp1_state->compat_id && (rp1_state->compat_id == rp2_state->compat_id)) {
+        return skip;
+    }
+
+    // Distinct signatures can still be compatible (when only normalization differs), and the same
+    // pairs recur every frame across begin-info, framebuffer, and inheritance checks.  A clean
+    // full walk proves the pair for the device's lifetime, so remember it and short-circuit
+    // repeats.  Compatibility is symmetric; order the key so both directions share an entry.
+    RenderPassCompatPair pair_key(reinterpret_cast<uintptr_t>(rp1_state->compat_id.get()),
+                                  reinterpret_cast<uintptr_t>(rp2_state->compat_id.get()));
+    if (pair_key.second < pair_key.first) std::swap(pair_key.first, pair_key.second);
+    const bool cacheable = pair_key.first && pair_key.second;
+    if (cacheable) {
+        std::lock_guard<std::mutex> cache_guard(render_pass_compat_cache_lock);
+        if (render_pass_compat_cache.count(pair_key)) return skip;
+    }
+
     if (rp1_state->createInfo.subpassCount != rp2_state->createInfo.subpassCount) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT,
                         HandleToUint64(rp1_state->renderPass), error_code,
@@ -877,6 +941,10 @@ bool CoreChecks::ValidateRenderPassCompatibility(const char *type1_string, const
             skip |= ValidateSubpassCompatibility(type1_string, rp1_state, type2_string, rp2_state, i, caller, error_code);
         }
     }
+    if (cacheable && !skip) {
+        std::lock_guard<std::mutex> cache_guard(render_pass_compat_cache_lock);
+        render_pass_compat_cache.insert(pair_key);
+    }
     return skip;
 }
 
@@ -1140,64 +1208,91 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE *cb_node, CMD_TY
     }
 
     bool result = false;
+    ScopedCheckSample telemetry_sample(check_telemetry, CheckTelemetry::kValidateCmdBufDrawState, result);
     auto const &state = last_bound_it->second;
 
+    // Determine which state categories changed since the last validated draw at this bind point.
+    // An unchanged category already passed validation at that draw, so rechecking it cannot
+    // produce new errors and is skipped.  The record hooks maintain the dirty flags; image layout
+    // changes (barriers, render pass transitions, ...) are caught by comparing the layout change
+    // sequence number instead of instrumenting every command that can transition a layout.
+    CBDrawDirtyFlags dirty = CBDIRTY_ALL;
+    const auto dirty_it = cb_node->draw_dirty.find(bind_point);
+    if (dirty_it != cb_node->draw_dirty.cend()) {
+        dirty = dirty_it->second.dirty_flags;
+        if (dirty_it->second.last_cmd_type != cmd_type) dirty = CBDIRTY_ALL;
+        if (dirty_it->second.validated_layout_count != cb_node->image_layout_change_count) dirty |= CBDIRTY_DESCRIPTOR_SETS;
+    }
+
     // First check flag states
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) result = ValidateDrawStateFlags(cb_node, pPipe, indexed, state_err_code);
+    if ((VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) &&
+        (dirty & (CBDIRTY_PIPELINE | CBDIRTY_DYNAMIC_STATE | CBDIRTY_VERTEX_INDEX)))
+        result = ValidateDrawStateFlags(cb_node, pPipe, indexed, state_err_code);
 
     // Now complete other state checks
     string errorString;
     auto const &pipeline_layout = pPipe->pipeline_layout;
 
-    for (const auto &set_binding_pair : pPipe->active_slots) {
-        uint32_t setIndex = set_binding_pair.first;
-        // If valid set is not bound throw an error
-        if ((state.boundDescriptorSets.size() <= setIndex) || (!state.boundDescriptorSets[setIndex])) {
-            result |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                        HandleToUint64(cb_node->commandBuffer), kVUID_Core_DrawState_DescriptorSetNotBound,
-                        "%s uses set #%u but that set is not bound.", report_data->FormatHandle(pPipe->pipeline).c_str(), setIndex);
-        } else if (!VerifySetLayoutCompatibility(state.boundDescriptorSets[setIndex], &pipeline_layout, setIndex, errorString)) {
-            // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
-            VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
-            result |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
-                              HandleToUint64(setHandle), kVUID_Core_DrawState_PipelineLayoutsIncompatible,
-                              "%s bound as set #%u is not compatible with overlapping %s due to: %s",
-                              report_data->FormatHandle(setHandle).c_str(), setIndex,
-                              report_data->FormatHandle(pipeline_layout.layout).c_str(), errorString.c_str());
-        } else {  // Valid set is bound and layout compatible, validate that it's updated
-            // Pull the set node
-            cvdescriptorset::DescriptorSet *descriptor_set = state.boundDescriptorSets[setIndex];
-            // Validate the draw-time state for this descriptor set
-            std::string err_str;
-            if (!descriptor_set->IsPushDescriptor()) {
-                // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor
-                // binding validation. Take the requested binding set and prefilter it to eliminate redundant validation checks.
-                // Here, the currently bound pipeline determines whether an image validation check is redundant...
-                // for images are the "req" portion of the binding_req is indirectly (but tightly) coupled to the pipeline.
-                cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second);
-                const auto &binding_req_map = reduced_map.FilteredMap(*cb_node, *pPipe);
-
-                if (!ValidateDrawState(descriptor_set, binding_req_map, state.dynamicOffsets[setIndex], cb_node, function,
-                                       &err_str)) {
-                    auto set = descriptor_set->GetSet();
-                    result |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
-                                      HandleToUint64(set), kVUID_Core_DrawState_DescriptorSetNotUpdated,
-                                      "%s bound as set #%u encountered the following validation error at %s time: %s",
-                                      report_data->FormatHandle(set).c_str(), setIndex, function, err_str.c_str());
+    if (dirty & (CBDIRTY_PIPELINE | CBDIRTY_DESCRIPTOR_SETS)) {
+        for (const auto &set_binding_pair : pPipe->active_slots) {
+            uint32_t setIndex = set_binding_pair.first;
+            // If valid set is not bound throw an error
+            if ((state.boundDescriptorSets.size() <= setIndex) || (!state.boundDescriptorSets[setIndex])) {
+                result |=
+                    log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                            HandleToUint64(cb_node->commandBuffer), kVUID_Core_DrawState_DescriptorSetNotBound,
+                            "%s uses set #%u but that set is not bound.", report_data->FormatHandle(pPipe->pipeline).c_str(), setIndex);
+            } else if (!VerifySetLayoutCompatibility(state.boundDescriptorSets[setIndex], &pipeline_layout, setIndex, errorString)) {
+                // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
+                VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
+                result |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
+                                  HandleToUint64(setHandle), kVUID_Core_DrawState_PipelineLayoutsIncompatible,
+                                  "%s bound as set #%u is not compatible with overlapping %s due to: %s",
+                                  report_data->FormatHandle(setHandle).c_str(), setIndex,
+                                  report_data->FormatHandle(pipeline_layout.layout).c_str(), errorString.c_str());
+            } else {  // Valid set is bound and layout compatible, validate that it's updated
+                // Pull the set node
+                cvdescriptorset::DescriptorSet *descriptor_set = state.boundDescriptorSets[setIndex];
+                // Validate the draw-time state for this descriptor set.  If the set passed this
+                // same validation before and nothing it depends on has changed since, the whole
+                // walk is skipped on a few integer compares.
+                std::string err_str;
+                if (!descriptor_set->IsPushDescriptor() &&
+                    !descriptor_set->CanSkipDrawStateValidation(cb_node, pPipe, state.dynamicOffsets[setIndex])) {
+                    // For the "bindless" style resource usage with many descriptors, need to optimize command <-> descriptor
+                    // binding validation. Take the requested binding set and prefilter it to eliminate redundant validation checks.
+                    // Here, the currently bound pipeline determines whether an image validation check is redundant...
+                    // for images are the "req" portion of the binding_req is indirectly (but tightly) coupled to the pipeline.
+                    cvdescriptorset::PrefilterBindRequestMap reduced_map(*descriptor_set, set_binding_pair.second);
+                    const auto &binding_req_map = reduced_map.FilteredMap(*cb_node, *pPipe);
+
+                    if (enabled.deferred_cb_validation) {
+                        // Capture the check and run it on the worker pool at submit instead of on
+                        // the recording thread -- see RunDeferredDrawChecks()
+                        cb_node->deferred_draw_checks.push_back(
+                            {descriptor_set, binding_req_map, state.dynamicOffsets[setIndex], setIndex, function});
+                    } else if (!ValidateDrawState(descriptor_set, binding_req_map, state.dynamicOffsets[setIndex], cb_node,
+                                                  function, &err_str)) {
+                        auto set = descriptor_set->GetSet();
+                        result |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
+                                          HandleToUint64(set), kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                                          "%s bound as set #%u encountered the following validation error at %s time: %s",
+                                          report_data->FormatHandle(set).c_str(), setIndex, function, err_str.c_str());
+                    }
                 }
             }
         }
     }
 
     // Check general pipeline state that needs to be validated at drawtime
-    if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point)
+    if ((VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) &&
+        (dirty & (CBDIRTY_PIPELINE | CBDIRTY_DYNAMIC_STATE | CBDIRTY_VERTEX_INDEX | CBDIRTY_RENDER_PASS)))
         result |= ValidatePipelineDrawtimeState(state, cb_node, cmd_type, pPipe, function);
 
     return result;
 }
 
-void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const VkPipelineBindPoint bind_point) {
+void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point) {
     auto const &state = cb_state->lastBound[bind_point];
     PIPELINE_STATE *pPipe = state.pipeline_state;
     if (VK_NULL_HANDLE != state.pipeline_layout) {
@@ -1222,12 +1317,21 @@ void ValidationStateTracker::UpdateDrawState(CMD_BUFFER_STATE *cb_state, const V
                 descriptor_set->UpdateDrawState(this, cb_state, binding_req_map);
                 // For given active slots record updated images & buffers
                 descriptor_set->GetStorageUpdates(binding_req_map, &cb_state->updateBuffers, &cb_state->updateImages);
+                // Reaching the record phase means draw-time validation of this set passed; remember
+                // that so identical draws can skip it (see CanSkipDrawStateValidation)
+                descriptor_set->RecordPassedDrawStateValidation(cb_state, pPipe, state.dynamicOffsets[setIndex]);
             }
         }
     }
     if (!pPipe->vertex_binding_descriptions_.empty()) {
         cb_state->vertex_buffer_used = true;
     }
+    // The matching PreCallValidate ran just before this record hook (a failing draw never reaches
+    // the record phase), so every draw-time category for this bind point is clean at this point
+    auto &dirty_state = cb_state->draw_dirty[bind_point];
+    dirty_state.dirty_flags = CBDIRTY_NONE;
+    dirty_state.last_cmd_type = cmd_type;
+    dirty_state.validated_layout_count = cb_state->image_layout_change_count;
 }
 
 bool CoreChecks::ValidatePipelineLocked(std::vector<std::unique_ptr<PIPELINE_STATE>> const &pPipelines, int pipelineIndex) const {
@@ -1587,9 +1691,7 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
     if (vi != NULL) {
         for (uint32_t j = 0; j < vi->vertexAttributeDescriptionCount; j++) {
             VkFormat format = vi->pVertexAttributeDescriptions[j].format;
-            // Internal call to get format info.  Still goes through layers, could potentially go directly to ICD.
-            VkFormatProperties properties;
-            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &properties);
+            VkFormatProperties properties = GetPDFormatProperties(format);
             if ((properties.bufferFeatures & VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT) == 0) {
                 skip |=
                     log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT,
@@ -1784,7 +1886,7 @@ bool CoreChecks::ValidatePipelineUnlocked(const PIPELINE_STATE *pPipeline, uint3
 // Return false if no errors occur
 // Return true if validation error occurs and callback returns true (to skip upcoming API call down the chain)
 bool CoreChecks::ValidateIdleDescriptorSet(VkDescriptorSet set, const char *func_str) {
-    if (disabled.idle_descriptor_set) return false;
+    if (disabled.IsDisabled(kDisableBitIdleDescriptorSet)) return false;
     bool skip = false;
     auto set_node = setMap.find(set);
     if (set_node == setMap.end()) {
@@ -1839,25 +1941,32 @@ bool CoreChecks::ValidateCmdSubpassState(const CMD_BUFFER_STATE *pCB, const CMD_
     return skip;
 }
 
+// Outlined error path of ValidateCmdQueueFlags(), which runs for every recorded command -- the
+// flag-name string building below stays out of that pass path
+bool CoreChecks::ReportInvalidCmdQueueFlags(const CMD_BUFFER_STATE *cb_node, const char *caller_name, VkQueueFlags required_flags,
+                                            const char *error_code) const {
+    string required_flags_string;
+    for (auto flag : {VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT, VK_QUEUE_COMPUTE_BIT}) {
+        if (flag & required_flags) {
+            if (required_flags_string.size()) {
+                required_flags_string += " or ";
+            }
+            required_flags_string += string_VkQueueFlagBits(flag);
+        }
+    }
+    return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                   HandleToUint64(cb_node->commandBuffer), error_code,
+                   "Cannot call %s on a command buffer allocated from a pool without %s capabilities..", caller_name,
+                   required_flags_string.c_str());
+}
+
 bool CoreChecks::ValidateCmdQueueFlags(const CMD_BUFFER_STATE *cb_node, const char *caller_name, VkQueueFlags required_flags,
                                        const char *error_code) const {
     auto pool = GetCommandPoolState(cb_node->createInfo.commandPool);
     if (pool) {
         VkQueueFlags queue_flags = GetPhysicalDeviceState()->queue_family_properties[pool->queueFamilyIndex].queueFlags;
         if (!(required_flags & queue_flags)) {
-            string required_flags_string;
-            for (auto flag : {VK_QUEUE_TRANSFER_BIT, VK_QUEUE_GRAPHICS_BIT, VK_QUEUE_COMPUTE_BIT}) {
-                if (flag & required_flags) {
-                    if (required_flags_string.size()) {
-                        required_flags_string += " or ";
-                    }
-                    required_flags_string += string_VkQueueFlagBits(flag);
-                }
-            }
-            return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                           HandleToUint64(cb_node->commandBuffer), error_code,
-                           "Cannot call %s on a command buffer allocated from a pool without %s capabilities..", caller_name,
-                           required_flags_string.c_str());
+            return ReportInvalidCmdQueueFlags(cb_node, caller_name, required_flags, error_code);
         }
     }
     return false;
@@ -2029,15 +2138,15 @@ BASE_NODE *ValidationStateTracker::GetStateStructPtrFromObject(const VulkanTyped
 // Tie the VulkanTypedHandle to the cmd buffer which includes:
 //  Add object_binding to cmd buffer
 //  Add cb_binding to object
-static void AddCommandBufferBinding(std::unordered_set<CMD_BUFFER_STATE *> *cb_bindings, const VulkanTypedHandle &obj,
-                                    CMD_BUFFER_STATE *cb_node) {
-    cb_bindings->insert(cb_node);
-    cb_node->object_bindings.insert(obj);
-}
-// For a given object, if cb_node is in that objects cb_bindings, remove cb_node
-void ValidationStateTracker::RemoveCommandBufferBinding(VulkanTypedHandle const &object, CMD_BUFFER_STATE *cb_node) {
-    BASE_NODE *base_obj = GetStateStructPtrFromObject(object);
-    if (base_obj) base_obj->cb_bindings.erase(cb_node);
+void ValidationStateTracker::AddCommandBufferBinding(BoundCommandBufferList *cb_bindings, const VulkanTypedHandle &obj,
+                                                     CMD_BUFFER_STATE *cb_node) {
+    if (!state_tracking.command_buffer_bindings) return;
+    auto inserted = cb_node->object_bindings.insert(obj);
+    if (inserted.second) {
+        // Only need to complete the cross-reference if this is a new item
+        std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+        cb_bindings->Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+    }
 }
 // Reset the command buffer state
 //  Maintain the createInfo and set state to CB_NEW, but clear all other state
@@ -2054,6 +2163,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->hasDispatchCmd = false;
         pCB->state = CB_NEW;
         pCB->submitCount = 0;
+        pCB->reset_count++;
         pCB->image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
         pCB->status = 0;
         pCB->static_status = 0;
@@ -2063,6 +2173,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         for (auto &item : pCB->lastBound) {
             item.second.reset();
         }
+        pCB->draw_dirty.clear();
 
         memset(&pCB->activeRenderPassBeginInfo, 0, sizeof(pCB->activeRenderPassBeginInfo));
         pCB->activeRenderPass = nullptr;
@@ -2076,6 +2187,7 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->activeQueries.clear();
         pCB->startedQueries.clear();
         pCB->image_layout_map.clear();
+        pCB->validated_image_layouts.clear();
         pCB->eventToStageMap.clear();
         pCB->cb_vertex_buffer_binding_info.clear();
         pCB->current_vertex_buffer_binding_info.vertex_buffer_bindings.clear();
@@ -2094,21 +2206,19 @@ void ValidationStateTracker::ResetCommandBufferState(const VkCommandBuffer cb) {
         pCB->updateImages.clear();
         pCB->updateBuffers.clear();
         ClearCmdBufAndMemReferences(pCB);
-        pCB->queue_submit_functions.clear();
         pCB->cmd_execute_commands_functions.clear();
+        pCB->validated_execute_linkage.clear();
         pCB->eventUpdates.clear();
         pCB->queryUpdates.clear();
+        pCB->deferred_draw_checks.clear();
 
-        // Remove object bindings
-        for (const auto &obj : pCB->object_bindings) {
-            RemoveCommandBufferBinding(obj, pCB);
+        // Remove object bindings: unlink every binding node this command buffer owns, which also
+        // covers the framebuffer and memory object references
+        {
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            pCB->cb_binding_pool.ReleaseAll();
         }
         pCB->object_bindings.clear();
-        // Remove this cmdBuffer's reference from each FrameBuffer's CB ref list
-        for (auto framebuffer : pCB->framebuffers) {
-            auto fb_state = GetFramebufferState(framebuffer);
-            if (fb_state) fb_state->cb_bindings.erase(pCB);
-        }
         pCB->framebuffers.clear();
         pCB->activeFramebuffer = VK_NULL_HANDLE;
         memset(&pCB->index_buffer_binding, 0, sizeof(pCB->index_buffer_binding));
@@ -2223,10 +2333,44 @@ void CoreChecks::InitGpuValidation() {
     }
 }
 
+void CoreChecks::InitDeferredShaderValidation() {
+    // Process the layer settings file.  When enabled, vkCreateShaderModule offloads spirv-val to
+    // the worker queue and returns after the cheap structural checks; results are joined (and
+    // reported) before the module can be used -- see JoinDeferredSpirvValidation().
+    const char *option = getLayerOption("khronos_validation.deferred_shader_validation");
+    if (option && ((0 == strcmp(option, "true")) || (0 == strcmp(option, "TRUE")))) {
+        instance_state->enabled.deferred_shader_validation = true;
+    }
+}
+
+void CoreChecks::InitDeferredCbValidation() {
+    // Process the layer settings file.  When enabled, the vkCmd* record-time hooks capture the
+    // expensive draw-time descriptor checks as compact records instead of running them on the
+    // recording thread; the captured checks run on the worker pool during vkQueueSubmit
+    // validation of the command buffer -- see RunDeferredDrawChecks().
+    const char *option = getLayerOption("khronos_validation.deferred_cb_validation");
+    if (option && ((0 == strcmp(option, "true")) || (0 == strcmp(option, "TRUE")))) {
+        instance_state->enabled.deferred_cb_validation = true;
+    }
+}
+
+void CoreChecks::InitCheckTelemetry() {
+    // Process the layer settings file.  When enabled, the instrumented check sites accumulate
+    // invocation counts and sampled costs, log_msg tallies per-VUID hits, and DumpCheckTelemetry
+    // reports both at vkDestroyDevice.
+    const char *option = getLayerOption("khronos_validation.check_telemetry");
+    if (option && ((0 == strcmp(option, "true")) || (0 == strcmp(option, "TRUE")))) {
+        check_telemetry.enabled = true;
+        report_data->vuid_hit_counting = true;
+    }
+}
+
 void CoreChecks::PostCallRecordCreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
                                               VkInstance *pInstance, VkResult result) {
     if (VK_SUCCESS != result) return;
     InitGpuValidation();
+    InitDeferredShaderValidation();
+    InitDeferredCbValidation();
 }
 
 bool CoreChecks::ValidateQueueFamilyIndex(const PHYSICAL_DEVICE_STATE *pd_state, uint32_t requested_queue_family,
@@ -2349,20 +2493,37 @@ void CoreChecks::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDevice
         core_checks->SetCommandBufferResetCallback(
             [core_checks](VkCommandBuffer command_buffer) -> void { core_checks->GpuResetCommandBuffer(command_buffer); });
     }
+    core_checks->InitDiskShaderValidationCache();
+    core_checks->InitCheckTelemetry();
     core_checks->SetSetImageViewInitialLayoutCallback(
         [core_checks](CMD_BUFFER_STATE *cb_node, const IMAGE_VIEW_STATE &iv_state, VkImageLayout layout) -> void {
             core_checks->SetImageViewInitialLayout(cb_node, iv_state, layout);
         });
 }
 
+// Derive the selective state tracking profile from the check disables.  Each flag answers "does
+// any enabled check family read this state?"; record hooks consult the flags to skip building
+// state nothing will consume.
+void ValidationStateTracker::ConfigureStateTrackingProfile() {
+    // Query bookkeeping is only read by the query validation family.
+    state_tracking.query_state = !disabled.IsDisabled(kDisableBitQueryValidation);
+    // The command-buffer/object cross references feed the object-in-use checks, invalidation of
+    // command buffers whose bound objects are destroyed, and the idle-descriptor-set check.
+    state_tracking.command_buffer_bindings =
+        !(disabled.IsDisabled(kDisableBitObjectInUse) && disabled.IsDisabled(kDisableBitCommandBufferState) && disabled.IsDisabled(kDisableBitIdleDescriptorSet));
+}
+
 void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
                                                         const VkAllocationCallbacks *pAllocator, VkDevice *pDevice,
                                                         VkResult result) {
     if (VK_SUCCESS != result) return;
 
+    // Index the create-info chain once -- the feature queries below probe it two dozen times
+    const LvlChainIndex create_info_chain(pCreateInfo->pNext);
+
     const VkPhysicalDeviceFeatures *enabled_features_found = pCreateInfo->pEnabledFeatures;
     if (nullptr == enabled_features_found) {
-        const auto *features2 = lvl_find_in_chain<VkPhysicalDeviceFeatures2KHR>(pCreateInfo->pNext);
+        const auto *features2 = create_info_chain.Find<VkPhysicalDeviceFeatures2KHR>();
         if (features2) {
             enabled_features_found = &(features2->features);
         }
@@ -2371,6 +2532,7 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
     ValidationObject *device_object = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
     ValidationObject *validation_data = GetValidationObject(device_object->object_dispatch, LayerObjectTypeCoreValidation);
     ValidationStateTracker *state_tracker = static_cast<ValidationStateTracker *>(validation_data);
+    state_tracker->ConfigureStateTrackingProfile();
 
     if (nullptr == enabled_features_found) {
         state_tracker->enabled_features.core = {};
@@ -2388,125 +2550,119 @@ void ValidationStateTracker::PostCallRecordCreateDevice(VkPhysicalDevice gpu, co
     // Save local link to this device's physical device state
     state_tracker->physical_device_state = pd_state;
 
-    const auto *device_group_ci = lvl_find_in_chain<VkDeviceGroupDeviceCreateInfo>(pCreateInfo->pNext);
+    const auto *device_group_ci = create_info_chain.Find<VkDeviceGroupDeviceCreateInfo>();
     state_tracker->physical_device_count =
         device_group_ci && device_group_ci->physicalDeviceCount > 0 ? device_group_ci->physicalDeviceCount : 1;
 
-    const auto *descriptor_indexing_features = lvl_find_in_chain<VkPhysicalDeviceDescriptorIndexingFeaturesEXT>(pCreateInfo->pNext);
+    const auto *descriptor_indexing_features = create_info_chain.Find<VkPhysicalDeviceDescriptorIndexingFeaturesEXT>();
     if (descriptor_indexing_features) {
         state_tracker->enabled_features.descriptor_indexing = *descriptor_indexing_features;
     }
 
-    const auto *eight_bit_storage_features = lvl_find_in_chain<VkPhysicalDevice8BitStorageFeaturesKHR>(pCreateInfo->pNext);
+    const auto *eight_bit_storage_features = create_info_chain.Find<VkPhysicalDevice8BitStorageFeaturesKHR>();
     if (eight_bit_storage_features) {
         state_tracker->enabled_features.eight_bit_storage = *eight_bit_storage_features;
     }
 
-    const auto *exclusive_scissor_features = lvl_find_in_chain<VkPhysicalDeviceExclusiveScissorFeaturesNV>(pCreateInfo->pNext);
+    const auto *exclusive_scissor_features = create_info_chain.Find<VkPhysicalDeviceExclusiveScissorFeaturesNV>();
     if (exclusive_scissor_features) {
         state_tracker->enabled_features.exclusive_scissor = *exclusive_scissor_features;
     }
 
-    const auto *shading_rate_image_features = lvl_find_in_chain<VkPhysicalDeviceShadingRateImageFeaturesNV>(pCreateInfo->pNext);
+    const auto *shading_rate_image_features = create_info_chain.Find<VkPhysicalDeviceShadingRateImageFeaturesNV>();
     if (shading_rate_image_features) {
         state_tracker->enabled_features.shading_rate_image = *shading_rate_image_features;
     }
 
-    const auto *mesh_shader_features = lvl_find_in_chain<VkPhysicalDeviceMeshShaderFeaturesNV>(pCreateInfo->pNext);
+    const auto *mesh_shader_features = create_info_chain.Find<VkPhysicalDeviceMeshShaderFeaturesNV>();
     if (mesh_shader_features) {
         state_tracker->enabled_features.mesh_shader = *mesh_shader_features;
     }
 
-    const auto *inline_uniform_block_features =
-        lvl_find_in_chain<VkPhysicalDeviceInlineUniformBlockFeaturesEXT>(pCreateInfo->pNext);
+    const auto *inline_uniform_block_features = create_info_chain.Find<VkPhysicalDeviceInlineUniformBlockFeaturesEXT>();
     if (inline_uniform_block_features) {
         state_tracker->enabled_features.inline_uniform_block = *inline_uniform_block_features;
     }
 
-    const auto *transform_feedback_features = lvl_find_in_chain<VkPhysicalDeviceTransformFeedbackFeaturesEXT>(pCreateInfo->pNext);
+    const auto *transform_feedback_features = create_info_chain.Find<VkPhysicalDeviceTransformFeedbackFeaturesEXT>();
     if (transform_feedback_features) {
         state_tracker->enabled_features.transform_feedback_features = *transform_feedback_features;
     }
 
-    const auto *float16_int8_features = lvl_find_in_chain<VkPhysicalDeviceFloat16Int8FeaturesKHR>(pCreateInfo->pNext);
+    const auto *float16_int8_features = create_info_chain.Find<VkPhysicalDeviceFloat16Int8FeaturesKHR>();
     if (float16_int8_features) {
         state_tracker->enabled_features.float16_int8 = *float16_int8_features;
     }
 
-    const auto *vtx_attrib_div_features = lvl_find_in_chain<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>(pCreateInfo->pNext);
+    const auto *vtx_attrib_div_features = create_info_chain.Find<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>();
     if (vtx_attrib_div_features) {
         state_tracker->enabled_features.vtx_attrib_divisor_features = *vtx_attrib_div_features;
     }
 
     const auto *uniform_buffer_standard_layout_features =
-        lvl_find_in_chain<VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR>(pCreateInfo->pNext);
+        create_info_chain.Find<VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR>();
     if (uniform_buffer_standard_layout_features) {
         state_tracker->enabled_features.uniform_buffer_standard_layout = *uniform_buffer_standard_layout_features;
     }
 
-    const auto *scalar_block_layout_features = lvl_find_in_chain<VkPhysicalDeviceScalarBlockLayoutFeaturesEXT>(pCreateInfo->pNext);
+    const auto *scalar_block_layout_features = create_info_chain.Find<VkPhysicalDeviceScalarBlockLayoutFeaturesEXT>();
     if (scalar_block_layout_features) {
         state_tracker->enabled_features.scalar_block_layout_features = *scalar_block_layout_features;
     }
 
-    const auto *buffer_address = lvl_find_in_chain<VkPhysicalDeviceBufferAddressFeaturesEXT>(pCreateInfo->pNext);
+    const auto *buffer_address = create_info_chain.Find<VkPhysicalDeviceBufferAddressFeaturesEXT>();
     if (buffer_address) {
         state_tracker->enabled_features.buffer_address = *buffer_address;
     }
 
-    const auto *cooperative_matrix_features = lvl_find_in_chain<VkPhysicalDeviceCooperativeMatrixFeaturesNV>(pCreateInfo->pNext);
+    const auto *cooperative_matrix_features = create_info_chain.Find<VkPhysicalDeviceCooperativeMatrixFeaturesNV>();
     if (cooperative_matrix_features) {
         state_tracker->enabled_features.cooperative_matrix_features = *cooperative_matrix_features;
     }
 
-    const auto *float_controls_features = lvl_find_in_chain<VkPhysicalDeviceFloatControlsPropertiesKHR>(pCreateInfo->pNext);
+    const auto *float_controls_features = create_info_chain.Find<VkPhysicalDeviceFloatControlsPropertiesKHR>();
     if (float_controls_features) {
         state_tracker->enabled_features.float_controls = *float_controls_features;
     }
 
-    const auto *host_query_reset_features = lvl_find_in_chain<VkPhysicalDeviceHostQueryResetFeaturesEXT>(pCreateInfo->pNext);
+    const auto *host_query_reset_features = create_info_chain.Find<VkPhysicalDeviceHostQueryResetFeaturesEXT>();
     if (host_query_reset_features) {
         state_tracker->enabled_features.host_query_reset_features = *host_query_reset_features;
     }
 
-    const auto *compute_shader_derivatives_features =
-        lvl_find_in_chain<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>(pCreateInfo->pNext);
+    const auto *compute_shader_derivatives_features = create_info_chain.Find<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>();
     if (compute_shader_derivatives_features) {
         state_tracker->enabled_features.compute_shader_derivatives_features = *compute_shader_derivatives_features;
     }
 
     const auto *fragment_shader_barycentric_features =
-        lvl_find_in_chain<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV>(pCreateInfo->pNext);
+        create_info_chain.Find<VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV>();
     if (fragment_shader_barycentric_features) {
         state_tracker->enabled_features.fragment_shader_barycentric_features = *fragment_shader_barycentric_features;
     }
 
-    const auto *shader_image_footprint_features =
-        lvl_find_in_chain<VkPhysicalDeviceShaderImageFootprintFeaturesNV>(pCreateInfo->pNext);
+    const auto *shader_image_footprint_features = create_info_chain.Find<VkPhysicalDeviceShaderImageFootprintFeaturesNV>();
     if (shader_image_footprint_features) {
         state_tracker->enabled_features.shader_image_footprint_features = *shader_image_footprint_features;
     }
 
-    const auto *fragment_shader_interlock_features =
-        lvl_find_in_chain<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>(pCreateInfo->pNext);
+    const auto *fragment_shader_interlock_features = create_info_chain.Find<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>();
     if (fragment_shader_interlock_features) {
         state_tracker->enabled_features.fragment_shader_interlock_features = *fragment_shader_interlock_features;
     }
 
     const auto *demote_to_helper_invocation_features =
-        lvl_find_in_chain<VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT>(pCreateInfo->pNext);
+        create_info_chain.Find<VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT>();
     if (demote_to_helper_invocation_features) {
         state_tracker->enabled_features.demote_to_helper_invocation_features = *demote_to_helper_invocation_features;
     }
 
-    const auto *texel_buffer_alignment_features =
-        lvl_find_in_chain<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>(pCreateInfo->pNext);
+    const auto *texel_buffer_alignment_features = create_info_chain.Find<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>();
     if (texel_buffer_alignment_features) {
         state_tracker->enabled_features.texel_buffer_alignment_features = *texel_buffer_alignment_features;
     }
 
-    const auto *imageless_framebuffer_features =
-        lvl_find_in_chain<VkPhysicalDeviceImagelessFramebufferFeaturesKHR>(pCreateInfo->pNext);
+    const auto *imageless_framebuffer_features = create_info_chain.Find<VkPhysicalDeviceImagelessFramebufferFeaturesKHR>();
     if (imageless_framebuffer_features) {
         state_tracker->enabled_features.imageless_framebuffer_features = *imageless_framebuffer_features;
     }
@@ -2572,7 +2728,6 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
 
     pipelineMap.clear();
     renderPassMap.clear();
-    commandBufferMap.clear();
     // This will also delete all sets in the pool & remove them from setMap
     DeleteDescriptorSetPools();
     // All sets should be removed
@@ -2584,15 +2739,80 @@ void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const V
     bufferMap.clear();
     // Queues persist until device is destroyed
     queueMap.clear();
+    // Command buffers are torn down without the usual reset, so their binding-node slabs must
+    // outlive every bound object above -- each object's destructor unlinks its nodes in place
+    commandBufferMap.clear();
     layer_debug_utils_destroy_device(device);
 }
+const char *CheckTelemetry::SiteName(uint32_t site) {
+    switch (site) {
+        case kValidateCmdBufDrawState:
+            return "ValidateCmdBufDrawState";
+        case kValidateImageBarrierImage:
+            return "ValidateImageBarrierImage";
+        case kValidateBarriers:
+            return "ValidateBarriers";
+        default:
+            return "unknown";
+    }
+}
+
+// Emit the per-site and per-VUID telemetry as INFO messages, most expensive / most-hit first.
+// Runs at vkDestroyDevice, before the state tracker tears down the debug callbacks.
+void CoreChecks::DumpCheckTelemetry() {
+    if (!check_telemetry.enabled) return;
+
+    for (uint32_t site = 0; site < CheckTelemetry::kCheckSiteCount; ++site) {
+        const auto &stats = check_telemetry.sites[site];
+        const uint64_t calls = stats.calls.load(std::memory_order_relaxed);
+        if (calls == 0) continue;
+        const uint64_t samples = stats.samples.load(std::memory_order_relaxed);
+        const uint64_t avg_ns = samples ? stats.sampled_ns.load(std::memory_order_relaxed) / samples : 0;
+        log_msg(report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
+                "UNASSIGNED-CoreValidation-CheckTelemetry",
+                "Check site %s: %" PRIu64 " calls, %" PRIu64 " failed, ~%" PRIu64 " ns/call (%" PRIu64 " sampled).",
+                CheckTelemetry::SiteName(site), calls, stats.fails.load(std::memory_order_relaxed), avg_ns, samples);
+    }
+
+    std::vector<std::pair<uint64_t, std::string>> ranked;
+    {
+        std::lock_guard<std::mutex> lock(report_data->vuid_hit_lock);
+        ranked.reserve(report_data->vuid_hit_counts.size());
+        for (const auto &entry : report_data->vuid_hit_counts) {
+            ranked.emplace_back(entry.second, entry.first);
+        }
+    }
+    std::sort(ranked.begin(), ranked.end(), std::greater<std::pair<uint64_t, std::string>>());
+    for (const auto &entry : ranked) {
+        log_msg(report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
+                "UNASSIGNED-CoreValidation-CheckTelemetry", "VUID %s fired %" PRIu64 " time(s).", entry.second.c_str(),
+                entry.first);
+    }
+}
+
+// Report the layer's own per-subsystem memory usage (VK_LAYER_MEMORY_ACCOUNTING).  Emitted before
+// device teardown starts releasing state, so the numbers reflect the steady-state footprint and
+// attribute long-run RSS growth to the subsystem holding it.
+void CoreChecks::DumpMemoryAccounting() {
+    if (!VlMemAccountingDumpEnabled()) return;
+    for (uint32_t subsystem = 0; subsystem < kVlMemSubsystemCount; ++subsystem) {
+        const auto &stats = VlMemStats()[subsystem];
+        log_msg(report_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
+                "UNASSIGNED-CoreValidation-MemoryAccounting", "Layer memory: %s: %" PRId64 " bytes in %" PRId64 " allocations.",
+                VlMemSubsystemName(subsystem), stats.bytes.load(std::memory_order_relaxed),
+                stats.allocations.load(std::memory_order_relaxed));
+    }
+}
+
 void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    JoinDeferredSpirvValidation();
     if (!device) return;
     if (enabled.gpu_validation) {
         GpuPreCallRecordDestroyDevice();
     }
-    imageSubresourceMap.clear();
-    imageLayoutMap.clear();
+    WriteDiskShaderValidationCache();
+    DumpCheckTelemetry();
+    DumpMemoryAccounting();
 
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 }
@@ -2726,29 +2946,51 @@ void ValidationStateTracker::DecrementBoundResources(CMD_BUFFER_STATE const *cb_
 }
 
 void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq) {
-    std::unordered_map<VkQueue, uint64_t> otherQueueSeqs;
+    // Phase 1 -- cheap bookkeeping: advance each affected queue's seq and move its retired
+    // submissions into one flat batch, following cross-queue semaphore waits iteratively (the old
+    // implementation recursed per queue and interleaved all cleanup with the roll-forward, so a
+    // heavy frame stalled waiters behind per-object bookkeeping before the queues even advanced).
+    std::vector<CB_SUBMISSION> retired;
+    std::vector<std::pair<QUEUE_STATE *, uint64_t>> worklist{{pQueue, seq}};
+    while (!worklist.empty()) {
+        QUEUE_STATE *queue = worklist.back().first;
+        const uint64_t target_seq = worklist.back().second;
+        worklist.pop_back();
 
-    // Roll this queue forward, one submission at a time.
-    while (pQueue->seq < seq) {
-        auto &submission = pQueue->submissions.front();
+        while (queue->seq < target_seq && !queue->submissions.empty()) {
+            retired.emplace_back(std::move(queue->submissions.front()));
+            queue->submissions.pop_front();
+            queue->seq++;
 
-        for (auto &wait : submission.waitSemaphores) {
+            // Semaphore waits retire the other queue's work up to the wait's seq
+            for (const auto &wait : retired.back().waitSemaphores) {
+                auto other_queue = GetQueueState(wait.queue);
+                if (other_queue && other_queue->seq < wait.seq) {
+                    worklist.emplace_back(other_queue, wait.seq);
+                }
+            }
+        }
+    }
+
+    // Phase 2 -- apply the per-submission cleanup over the batch: release in_use counts, apply
+    // deferred query/event state, and retire fences.  Each command buffer is resolved once here
+    // rather than mid-walk.
+    for (auto &submission : retired) {
+        for (const auto &wait : submission.waitSemaphores) {
             auto pSemaphore = GetSemaphoreState(wait.semaphore);
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
             }
-            auto &lastSeq = otherQueueSeqs[wait.queue];
-            lastSeq = std::max(lastSeq, wait.seq);
         }
 
-        for (auto &semaphore : submission.signalSemaphores) {
+        for (const auto &semaphore : submission.signalSemaphores) {
             auto pSemaphore = GetSemaphoreState(semaphore);
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
             }
         }
 
-        for (auto &semaphore : submission.externalSemaphores) {
+        for (const auto &semaphore : submission.externalSemaphores) {
             auto pSemaphore = GetSemaphoreState(semaphore);
             if (pSemaphore) {
                 pSemaphore->in_use.fetch_sub(1);
@@ -2768,8 +3010,8 @@ void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq
                     eventNode->second.write_in_use--;
                 }
             }
-            for (auto queryStatePair : cb_node->queryToStateMap) {
-                queryToStateMap[queryStatePair.first] = queryStatePair.second;
+            for (const auto &queryStatePair : cb_node->queryToStateMap) {
+                SetQueryPoolSlotState(queryStatePair.first, queryStatePair.second);
             }
             for (auto eventStagePair : cb_node->eventToStageMap) {
                 eventMap[eventStagePair.first].stageMask = eventStagePair.second;
@@ -2782,14 +3024,6 @@ void ValidationStateTracker::RetireWorkOnQueue(QUEUE_STATE *pQueue, uint64_t seq
         if (pFence && pFence->scope == kSyncScopeInternal) {
             pFence->state = FENCE_RETIRED;
         }
-
-        pQueue->submissions.pop_front();
-        pQueue->seq++;
-    }
-
-    // Roll other queues forward to the highest seq we saw a wait for
-    for (auto qs : otherQueueSeqs) {
-        RetireWorkOnQueue(GetQueueState(qs.first), qs.second);
     }
 }
 
@@ -2815,7 +3049,7 @@ bool CoreChecks::ValidateCommandBufferSimultaneousUse(const CMD_BUFFER_STATE *pC
 bool CoreChecks::ValidateCommandBufferState(const CMD_BUFFER_STATE *cb_state, const char *call_source, int current_submit_count,
                                             const char *vu_id) const {
     bool skip = false;
-    if (disabled.command_buffer_state) return skip;
+    if (disabled.IsDisabled(kDisableBitCommandBufferState)) return skip;
     // Validate ONE_TIME_SUBMIT_BIT CB is not being submitted more than once
     if ((cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) &&
         (cb_state->submitCount + current_submit_count > 1)) {
@@ -2917,19 +3151,17 @@ bool CoreChecks::ValidateQueueFamilyIndices(const CMD_BUFFER_STATE *pCB, VkQueue
     return skip;
 }
 
-bool CoreChecks::ValidatePrimaryCommandBufferState(const CMD_BUFFER_STATE *pCB, int current_submit_count,
-                                                   QFOTransferCBScoreboards<VkImageMemoryBarrier> *qfo_image_scoreboards,
-                                                   QFOTransferCBScoreboards<VkBufferMemoryBarrier> *qfo_buffer_scoreboards) const {
+// Per-command-buffer submit-time checks that depend neither on submission order nor on state
+// shared across the whole submit; these can run in parallel across every command buffer of a
+// vkQueueSubmit call (see PreCallValidateQueueSubmit)
+bool CoreChecks::ValidateCommandBufferForSubmit(VkQueue queue, const CMD_BUFFER_STATE *pCB, int current_submit_count) const {
     // Track in-use for resources off of primary and any secondary CBs
     bool skip = false;
 
     // If USAGE_SIMULTANEOUS_USE_BIT not set then CB cannot already be executing on device
     skip |= ValidateCommandBufferSimultaneousUse(pCB, current_submit_count);
 
-    skip |= ValidateQueuedQFOTransfers(pCB, qfo_image_scoreboards, qfo_buffer_scoreboards);
-
     for (auto pSubCB : pCB->linkedCommandBuffers) {
-        skip |= ValidateQueuedQFOTransfers(pSubCB, qfo_image_scoreboards, qfo_buffer_scoreboards);
         // TODO: replace with InvalidateCommandBuffers() at recording.
         if ((pSubCB->primaryCommandBuffer != pCB->commandBuffer) &&
             !(pSubCB->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
@@ -2944,6 +3176,47 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(const CMD_BUFFER_STATE *pCB,
 
     skip |= ValidateCommandBufferState(pCB, "vkQueueSubmit()", current_submit_count, "VUID-vkQueueSubmit-pCommandBuffers-00072");
 
+    skip |= ValidateQueueFamilyIndices(pCB, queue);
+
+    return skip;
+}
+
+// Run -- and drop -- the draw-state checks captured while recording the given command buffer
+// (enabled.deferred_cb_validation).  Called from the deduplicated deferred pass of the parallel
+// submit validation: every distinct command buffer of the call -- primaries and their linked
+// secondaries alike -- is drained by exactly one worker, under the read lock the caller holds
+// across validation.  An invalidated buffer's captures may reference destroyed state and are
+// dropped without running; the invalid-buffer check on this path reports the root cause.  Checks
+// recorded into a buffer that is never submitted are likewise never reported.
+bool CoreChecks::RunDeferredDrawChecks(const CMD_BUFFER_STATE *pCB) const {
+    bool skip = false;
+    if (pCB->deferred_draw_checks.empty()) return skip;
+    if ((pCB->state != CB_INVALID_COMPLETE) && (pCB->state != CB_INVALID_INCOMPLETE)) {
+        for (const auto &check : pCB->deferred_draw_checks) {
+            std::string err_str;
+            if (!ValidateDrawState(check.descriptor_set, check.binding_reqs, check.dynamic_offsets, pCB, check.function,
+                                   &err_str)) {
+                auto set = check.descriptor_set->GetSet();
+                skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
+                                HandleToUint64(set), kVUID_Core_DrawState_DescriptorSetNotUpdated,
+                                "%s bound as set #%u encountered the following validation error at %s time: %s",
+                                report_data->FormatHandle(set).c_str(), check.set_index, check.function, err_str.c_str());
+            }
+        }
+    }
+    pCB->deferred_draw_checks.clear();
+    return skip;
+}
+
+// The QFO transfer checks share duplicate-detection scoreboards across all command buffers of a
+// submission, so they stay on the ordered path
+bool CoreChecks::ValidateQueuedQFOTransfersForSubmit(const CMD_BUFFER_STATE *pCB,
+                                                     QFOTransferCBScoreboards<VkImageMemoryBarrier> *qfo_image_scoreboards,
+                                                     QFOTransferCBScoreboards<VkBufferMemoryBarrier> *qfo_buffer_scoreboards) const {
+    bool skip = ValidateQueuedQFOTransfers(pCB, qfo_image_scoreboards, qfo_buffer_scoreboards);
+    for (auto pSubCB : pCB->linkedCommandBuffers) {
+        skip |= ValidateQueuedQFOTransfers(pSubCB, qfo_image_scoreboards, qfo_buffer_scoreboards);
+    }
     return skip;
 }
 
@@ -3150,12 +3423,11 @@ bool CoreChecks::ValidateSemaphoresForSubmit(VkQueue queue, const VkSubmitInfo *
     return skip;
 }
 bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo *submit,
-                                                 ImageSubresPairLayoutMap *localImageLayoutMap_arg,
-                                                 vector<VkCommandBuffer> *current_cmds_arg) const {
+                                                 ImageSubresPairLayoutMap *localImageLayoutMap_arg) const {
     bool skip = false;
 
     ImageSubresPairLayoutMap &localImageLayoutMap = *localImageLayoutMap_arg;
-    vector<VkCommandBuffer> &current_cmds = *current_cmds_arg;
+    std::unordered_set<VkImage> overlay_images;  // Images with entries in localImageLayoutMap
 
     QFOTransferCBScoreboards<VkImageMemoryBarrier> qfo_image_scoreboards;
     QFOTransferCBScoreboards<VkBufferMemoryBarrier> qfo_buffer_scoreboards;
@@ -3163,27 +3435,20 @@ bool CoreChecks::ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitIn
     for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
         const auto *cb_node = GetCBState(submit->pCommandBuffers[i]);
         if (cb_node) {
-            skip |= ValidateCmdBufImageLayouts(cb_node, imageLayoutMap, &localImageLayoutMap);
-            current_cmds.push_back(submit->pCommandBuffers[i]);
-            skip |= ValidatePrimaryCommandBufferState(
-                cb_node, (int)std::count(current_cmds.begin(), current_cmds.end(), submit->pCommandBuffers[i]),
-                &qfo_image_scoreboards, &qfo_buffer_scoreboards);
-            skip |= ValidateQueueFamilyIndices(cb_node, queue);
+            skip |= ValidateCmdBufImageLayouts(cb_node, &localImageLayoutMap, &overlay_images);
+            skip |= ValidateQueuedQFOTransfersForSubmit(cb_node, &qfo_image_scoreboards, &qfo_buffer_scoreboards);
 
             // Potential early exit here as bad object state may crash in delayed function calls
             if (skip) {
                 return true;
             }
 
-            // Call submit-time functions to validate/update state
-            for (auto &function : cb_node->queue_submit_functions) {
-                skip |= function();
-            }
-            for (auto &function : cb_node->eventUpdates) {
-                skip |= function(queue);
+            // Replay the submit-time records to validate/update state
+            for (const auto &op : cb_node->eventUpdates) {
+                skip |= RunSubmitTimeOp(queue, op);
             }
-            for (auto &function : cb_node->queryUpdates) {
-                skip |= function(queue);
+            for (const auto &op : cb_node->queryUpdates) {
+                skip |= RunSubmitTimeOp(queue, op);
             }
         }
     }
@@ -3197,16 +3462,60 @@ bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount,
         return true;
     }
 
+    // Gather every command buffer of the call and run the order-independent per-CB checks in
+    // parallel.  Everything that depends on submission order -- semaphore chains, cross-CB image
+    // layout transitions, QFO transfer scoreboards and the recorded submit-time functions -- runs
+    // on the serial path below.  The read lock held across validation keeps the state the workers
+    // read stable.
+    {
+        std::vector<std::pair<const CMD_BUFFER_STATE *, int>> cb_submits;
+        std::unordered_map<VkCommandBuffer, int> submit_counts;
+        for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
+            const VkSubmitInfo *submit = &pSubmits[submit_idx];
+            for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
+                const auto *cb_node = GetCBState(submit->pCommandBuffers[i]);
+                if (cb_node) {
+                    cb_submits.emplace_back(cb_node, ++submit_counts[submit->pCommandBuffers[i]]);
+                }
+            }
+        }
+        std::atomic<bool> parallel_skip(false);
+        VlThreadPool::Instance().ParallelFor(static_cast<uint32_t>(cb_submits.size()), [this, queue, &cb_submits,
+                                                                                        &parallel_skip](uint32_t index) {
+            if (ValidateCommandBufferForSubmit(queue, cb_submits[index].first, cb_submits[index].second)) parallel_skip = true;
+        });
+        // The deferred checks drain (and clear) per-CB capture vectors, so each distinct command
+        // buffer -- a SIMULTANEOUS_USE buffer submitted twice in this call, or a secondary shared
+        // by two submitted primaries -- must be drained by exactly one worker.
+        if (enabled.deferred_cb_validation) {
+            std::vector<const CMD_BUFFER_STATE *> deferred_cbs;
+            unordered_set<const CMD_BUFFER_STATE *> seen_cbs;
+            for (const auto &entry : cb_submits) {
+                if (seen_cbs.insert(entry.first).second) deferred_cbs.push_back(entry.first);
+                for (const auto *sub_cb : entry.first->linkedCommandBuffers) {
+                    if (seen_cbs.insert(sub_cb).second) deferred_cbs.push_back(sub_cb);
+                }
+            }
+            VlThreadPool::Instance().ParallelFor(static_cast<uint32_t>(deferred_cbs.size()),
+                                                 [this, &deferred_cbs, &parallel_skip](uint32_t index) {
+                                                     if (RunDeferredDrawChecks(deferred_cbs[index])) parallel_skip = true;
+                                                 });
+        }
+        if (parallel_skip) {
+            // Bad object state may crash in the delayed submit-time functions on the serial path
+            return true;
+        }
+    }
+
     unordered_set<VkSemaphore> signaled_semaphores;
     unordered_set<VkSemaphore> unsignaled_semaphores;
     unordered_set<VkSemaphore> internal_semaphores;
-    vector<VkCommandBuffer> current_cmds;
     ImageSubresPairLayoutMap localImageLayoutMap;
     // Now verify each individual submit
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         skip |= ValidateSemaphoresForSubmit(queue, submit, &unsignaled_semaphores, &signaled_semaphores, &internal_semaphores);
-        skip |= ValidateCommandBuffersForSubmit(queue, submit, &localImageLayoutMap, &current_cmds);
+        skip |= ValidateCommandBuffersForSubmit(queue, submit, &localImageLayoutMap);
 
         auto chained_device_group_struct = lvl_find_in_chain<VkDeviceGroupSubmitInfo>(submit->pNext);
         if (chained_device_group_struct && chained_device_group_struct->commandBufferCount > 0) {
@@ -3378,9 +3687,10 @@ bool CoreChecks::PreCallValidateGetMemoryAndroidHardwareBufferANDROID(VkDevice d
 //
 bool CoreChecks::ValidateAllocateMemoryANDROID(const VkMemoryAllocateInfo *alloc_info) const {
     bool skip = false;
-    auto import_ahb_info = lvl_find_in_chain<VkImportAndroidHardwareBufferInfoANDROID>(alloc_info->pNext);
-    auto exp_mem_alloc_info = lvl_find_in_chain<VkExportMemoryAllocateInfo>(alloc_info->pNext);
-    auto mem_ded_alloc_info = lvl_find_in_chain<VkMemoryDedicatedAllocateInfo>(alloc_info->pNext);
+    const LvlChainIndex alloc_info_chain(alloc_info->pNext);
+    auto import_ahb_info = alloc_info_chain.Find<VkImportAndroidHardwareBufferInfoANDROID>();
+    auto exp_mem_alloc_info = alloc_info_chain.Find<VkExportMemoryAllocateInfo>();
+    auto mem_ded_alloc_info = alloc_info_chain.Find<VkMemoryDedicatedAllocateInfo>();
 
     if ((import_ahb_info) && (NULL != import_ahb_info->buffer)) {
         // This is an import with handleType of VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID
@@ -3753,7 +4063,7 @@ void ValidationStateTracker::PostCallRecordAllocateMemory(VkDevice device, const
 // For given obj node, if it is use, flag a validation error and return callback result, else return false
 bool CoreChecks::ValidateObjectNotInUse(const BASE_NODE *obj_node, const VulkanTypedHandle &obj_struct, const char *caller_name,
                                         const char *error_code) const {
-    if (disabled.object_in_use) return false;
+    if (disabled.IsDisabled(kDisableBitObjectInUse)) return false;
     bool skip = false;
     if (obj_node->in_use.load()) {
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, get_debug_report_enum[obj_struct.type], obj_struct.handle,
@@ -4028,6 +4338,7 @@ bool CoreChecks::PreCallValidateDestroyFence(VkDevice device, VkFence fence, con
 
 void CoreChecks::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
     if (!fence) return;
+    fence_slot_table.Erase(fence);
     fenceMap.erase(fence);
 }
 
@@ -4043,6 +4354,7 @@ bool CoreChecks::PreCallValidateDestroySemaphore(VkDevice device, VkSemaphore se
 
 void CoreChecks::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
     if (!semaphore) return;
+    semaphore_slot_table.Erase(semaphore);
     semaphoreMap.erase(semaphore);
 }
 
@@ -4065,7 +4377,7 @@ void CoreChecks::PreCallRecordDestroyEvent(VkDevice device, VkEvent event, const
 }
 
 bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     QUERY_POOL_STATE *qp_state = GetQueryPoolState(queryPool);
     const VulkanTypedHandle obj_struct(queryPool, kVulkanObjectTypeQueryPool);
     bool skip = false;
@@ -4078,6 +4390,7 @@ bool CoreChecks::PreCallValidateDestroyQueryPool(VkDevice device, VkQueryPool qu
 void CoreChecks::PreCallRecordDestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) {
     if (!queryPool) return;
     QUERY_POOL_STATE *qp_state = GetQueryPoolState(queryPool);
+    if (!qp_state) return;  // no state is recorded when query tracking is profiled out
     const VulkanTypedHandle obj_struct(queryPool, kVulkanObjectTypeQueryPool);
     InvalidateCommandBuffers(qp_state->cb_bindings, obj_struct);
     queryPoolMap.erase(queryPool);
@@ -4086,7 +4399,7 @@ void CoreChecks::PreCallRecordDestroyQueryPool(VkDevice device, VkQueryPool quer
 bool CoreChecks::PreCallValidateGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
                                                     uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride,
                                                     VkQueryResultFlags flags) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     bool skip = false;
     skip |= ValidateQueryPoolStride("VUID-vkGetQueryPoolResults-flags-00814", "VUID-vkGetQueryPoolResults-flags-00815", stride,
                                     "dataSize", dataSize, flags);
@@ -4106,13 +4419,7 @@ bool CoreChecks::PreCallValidateGetQueryPoolResults(VkDevice device, VkQueryPool
 
     for (uint32_t i = 0; i < queryCount; ++i) {
         query_obj.query = firstQuery + i;
-        auto query_data = queryToStateMap.find(query_obj);
-
-        if (query_data != queryToStateMap.end()) {
-            result_type = GetQueryResultType(query_data->second, flags);
-        } else {
-            result_type = QUERYRESULT_UNKNOWN;
-        }
+        result_type = GetQueryResultType(GetQueryPoolSlotState(queryPool, query_obj.query), flags);
 
         if (result_type != QUERYRESULT_SOME_DATA) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT,
@@ -4125,6 +4432,22 @@ bool CoreChecks::PreCallValidateGetQueryPoolResults(VkDevice device, VkQueryPool
     return skip;
 }
 
+// Invoke visit(MEMORY_RANGE *) on each bound range that could intersect [start, end] once
+// bufferImageGranularity padding is taken into account.  Candidates are found through the
+// start-ordered index: a range can only reach the window if it starts no more than the widest
+// bound size (plus padding) below it, so the visit is O(log n + candidates) rather than a walk
+// over every binding.  Callers still apply RangesIntersect as the exact test.
+template <typename Visitor>
+static void ForEachPotentiallyIntersectingRange(const DEVICE_MEMORY_STATE *mem_info, VkDeviceSize start, VkDeviceSize end,
+                                                VkDeviceSize pad_align, Visitor &&visit) {
+    const VkDeviceSize reach = mem_info->widest_bound_range + pad_align;
+    auto it = mem_info->bound_range_starts.lower_bound((start > reach) ? (start - reach) : 0);
+    const auto it_end = mem_info->bound_range_starts.upper_bound(end + pad_align);
+    for (; it != it_end; ++it) {
+        visit(it->second);
+    }
+}
+
 // Return true if given ranges intersect, else false
 // Prereq : For both ranges, range->end - range->start > 0. This case should have already resulted
 //  in an error so not checking that here
@@ -4164,8 +4487,8 @@ bool CoreChecks::ValidateInsertMemoryRange(const VulkanTypedHandle &typed_handle
     range.aliases.clear();
 
     // Check for aliasing problems.
-    for (auto &obj_range_pair : mem_info->bound_ranges) {
-        auto check_range = &obj_range_pair.second;
+    const VkDeviceSize pad_align = std::max<VkDeviceSize>(phys_dev_props.limits.bufferImageGranularity, 1);
+    ForEachPotentiallyIntersectingRange(mem_info, range.start, range.end, pad_align, [this, &range, &skip](MEMORY_RANGE *check_range) {
         if (RangesIntersect(&range, check_range)) {
             if (range.linear != check_range->linear) {
                 // In linear vs. non-linear case, warn of aliasing
@@ -4182,7 +4505,7 @@ bool CoreChecks::ValidateInsertMemoryRange(const VulkanTypedHandle &typed_handle
                     report_data->FormatHandle(MemoryRangeTypedHandle(*check_range)).c_str());
             }
         }
-    }
+    });
 
     if (memoryOffset >= mem_info->alloc_info.allocationSize) {
         const char *error_code = nullptr;
@@ -4231,16 +4554,30 @@ void ValidationStateTracker::InsertMemoryRange(const VulkanTypedHandle &typed_ha
     // Save aliased ranges so we can copy into final map entry below. Can't do it in loop b/c we don't yet have final ptr. If we
     // inserted into map before loop to get the final ptr, then we may enter loop when not needed & we check range against itself
     std::unordered_set<MEMORY_RANGE *> tmp_alias_ranges;
-    for (auto &obj_range_pair : mem_info->bound_ranges) {
-        auto check_range = &obj_range_pair.second;
-        if (RangesIntersect(&range, check_range)) {
-            range.aliases.insert(check_range);
-            tmp_alias_ranges.insert(check_range);
+    const VkDeviceSize pad_align = std::max<VkDeviceSize>(phys_dev_props.limits.bufferImageGranularity, 1);
+    ForEachPotentiallyIntersectingRange(mem_info, range.start, range.end, pad_align,
+                                        [this, &range, &tmp_alias_ranges](MEMORY_RANGE *check_range) {
+                                            if (RangesIntersect(&range, check_range)) {
+                                                range.aliases.insert(check_range);
+                                                tmp_alias_ranges.insert(check_range);
+                                            }
+                                        });
+    auto existing = mem_info->bound_ranges.find(typed_handle.handle);
+    if (existing != mem_info->bound_ranges.end()) {
+        // Rebinding an already-tracked object -- drop its stale index entry before overwriting
+        auto stale = mem_info->bound_range_starts.equal_range(existing->second.start);
+        for (auto it = stale.first; it != stale.second; ++it) {
+            if (it->second == &existing->second) {
+                mem_info->bound_range_starts.erase(it);
+                break;
+            }
         }
     }
-    mem_info->bound_ranges[typed_handle.handle] = std::move(range);
+    mem_info->widest_bound_range = std::max(mem_info->widest_bound_range, range.size);
+    MEMORY_RANGE &inserted_range = mem_info->bound_ranges[typed_handle.handle] = std::move(range);
+    mem_info->bound_range_starts.emplace(inserted_range.start, &inserted_range);
     for (auto tmp_range : tmp_alias_ranges) {
-        tmp_range->aliases.insert(&mem_info->bound_ranges[typed_handle.handle]);
+        tmp_range->aliases.insert(&inserted_range);
     }
 
     if (typed_handle.type == kVulkanObjectTypeImage) {
@@ -4296,6 +4633,13 @@ static void RemoveMemoryRange(uint64_t handle, DEVICE_MEMORY_STATE *mem_info, Vu
         alias_range->aliases.erase(erase_range);
     }
     erase_range->aliases.clear();
+    auto start_range = mem_info->bound_range_starts.equal_range(erase_range->start);
+    for (auto it = start_range.first; it != start_range.second; ++it) {
+        if (it->second == erase_range) {
+            mem_info->bound_range_starts.erase(it);
+            break;
+        }
+    }
     mem_info->bound_ranges.erase(handle);
     if (object_type == kVulkanObjectTypeImage) {
         mem_info->bound_images.erase(handle);
@@ -4728,8 +5072,14 @@ void ValidationStateTracker::FreeCommandBufferStates(COMMAND_POOL_STATE *pool_st
             pool_state->commandBuffers.erase(command_buffers[i]);
             // Remove the cb debug labels
             EraseCmdDebugUtilsLabel(report_data, cb_state->commandBuffer);
-            // Remove CBState from CB map
-            commandBufferMap.erase(cb_state->commandBuffer);
+            // Move the (already reset) CBState to the pool's recycle list and remove it from the
+            // CB map, so the next allocation from this pool reuses it along with the container
+            // capacity it has accumulated
+            auto cb_map_it = commandBufferMap.find(cb_state->commandBuffer);
+            if (cb_map_it != commandBufferMap.end()) {
+                pool_state->recycled_command_buffers.push_back(std::move(cb_map_it->second));
+                commandBufferMap.erase(cb_map_it);
+            }
         }
     }
 }
@@ -4771,7 +5121,7 @@ void ValidationStateTracker::PostCallRecordCreateCommandPool(VkDevice device, co
 
 bool CoreChecks::PreCallValidateCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     bool skip = false;
     if (pCreateInfo && pCreateInfo->queryType == VK_QUERY_TYPE_PIPELINE_STATISTICS) {
         if (!enabled_features.core.pipelineStatisticsQuery) {
@@ -4787,15 +5137,11 @@ bool CoreChecks::PreCallValidateCreateQueryPool(VkDevice device, const VkQueryPo
 void CoreChecks::PostCallRecordCreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo,
                                                const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool, VkResult result) {
     if (VK_SUCCESS != result) return;
+    if (!state_tracking.query_state) return;
     std::unique_ptr<QUERY_POOL_STATE> query_pool_state(new QUERY_POOL_STATE{});
     query_pool_state->createInfo = *pCreateInfo;
+    query_pool_state->query_states.assign(pCreateInfo->queryCount, QUERYSTATE_UNKNOWN);
     queryPoolMap[*pQueryPool] = std::move(query_pool_state);
-
-    QueryObject query_obj{*pQueryPool, 0u};
-    for (uint32_t i = 0; i < pCreateInfo->queryCount; ++i) {
-        query_obj.query = i;
-        queryToStateMap[query_obj] = QUERYSTATE_UNKNOWN;
-    }
 }
 
 bool CoreChecks::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
@@ -4864,21 +5210,39 @@ void CoreChecks::PostCallRecordResetFences(VkDevice device, uint32_t fenceCount,
     }
 }
 
+// Invalidate the given cb_node and track the object causing invalidation
+void ValidationStateTracker::InvalidateCommandBuffer(CMD_BUFFER_STATE *cb_node, const VulkanTypedHandle &obj) {
+    if (cb_node->state == CB_RECORDING) {
+        cb_node->state = CB_INVALID_INCOMPLETE;
+    } else if (cb_node->state == CB_RECORDED) {
+        cb_node->state = CB_INVALID_COMPLETE;
+    }
+    cb_node->broken_bindings.push_back(obj);
+
+    // if secondary, then propagate the invalidation to the primaries that will call us.
+    if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
+        InvalidateCommandBuffers(cb_node->linkedCommandBuffers, obj);
+    }
+}
+
 // For given cb_nodes, invalidate them and track object causing invalidation
 void ValidationStateTracker::InvalidateCommandBuffers(std::unordered_set<CMD_BUFFER_STATE *> const &cb_nodes,
                                                       const VulkanTypedHandle &obj) {
+    // Every path that destroys a trackable object or rewrites a bound descriptor set comes through
+    // here, so this count serves as a cheap global guard for caches that hold object pointers
+    // across calls (see DescriptorSet::CanSkipDrawStateValidation)
+    object_invalidate_count++;
     for (auto cb_node : cb_nodes) {
-        if (cb_node->state == CB_RECORDING) {
-            cb_node->state = CB_INVALID_INCOMPLETE;
-        } else if (cb_node->state == CB_RECORDED) {
-            cb_node->state = CB_INVALID_COMPLETE;
-        }
-        cb_node->broken_bindings.push_back(obj);
+        InvalidateCommandBuffer(cb_node, obj);
+    }
+}
 
-        // if secondary, then propagate the invalidation to the primaries that will call us.
-        if (cb_node->createInfo.level == VK_COMMAND_BUFFER_LEVEL_SECONDARY) {
-            InvalidateCommandBuffers(cb_node->linkedCommandBuffers, obj);
-        }
+// As above, for the command buffers linked into a bound object's intrusive binding list
+void ValidationStateTracker::InvalidateCommandBuffers(const BoundCommandBufferList &cb_bindings,
+                                                      const VulkanTypedHandle &obj) {
+    object_invalidate_count++;
+    for (const CbBindingNode *node = cb_bindings.head(); node; node = node->next) {
+        InvalidateCommandBuffer(node->cb, obj);
     }
 }
 
@@ -4924,9 +5288,21 @@ void CoreChecks::PreCallRecordDestroyRenderPass(VkDevice device, VkRenderPass re
 
 // Access helper functions for external modules
 VkFormatProperties CoreChecks::GetPDFormatProperties(const VkFormat format) const {
-    VkFormatProperties format_properties;
-    DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
-    return format_properties;
+    const uint32_t index = static_cast<uint32_t>(format);
+    if (index >= format_properties_cache.size()) {
+        // Extension format value outside the dense core range -- query the ICD directly
+        VkFormatProperties format_properties;
+        DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties);
+        return format_properties;
+    }
+    if (!format_properties_cached[index].load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(format_properties_cache_lock);
+        if (!format_properties_cached[index].load(std::memory_order_relaxed)) {
+            DispatchGetPhysicalDeviceFormatProperties(physical_device, format, &format_properties_cache[index]);
+            format_properties_cached[index].store(1, std::memory_order_release);
+        }
+    }
+    return format_properties_cache[index];
 }
 
 VkResult CoreChecks::GetPDImageFormatProperties(const VkImageCreateInfo *image_ci,
@@ -4948,6 +5324,7 @@ void CoreChecks::PostCallRecordCreateFence(VkDevice device, const VkFenceCreateI
     fence_state->fence = *pFence;
     fence_state->createInfo = *pCreateInfo;
     fence_state->state = (pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT) ? FENCE_RETIRED : FENCE_UNSIGNALED;
+    if (wrap_handles) fence_slot_table.Insert(*pFence, fence_state.get());
     fenceMap[*pFence] = std::move(fence_state);
 }
 
@@ -5061,10 +5438,126 @@ bool ValidationStateTracker::PreCallValidateCreateGraphicsPipelines(VkDevice dev
     return false;
 }
 
+// Fold the sType sequence of a pNext chain into the hash.  Extension-struct contents are not
+// walked generically; differing chains still produce distinct keys in practice because the
+// chained structs accompany differences in the fields hashed below.
+static uint64_t HashPnextChainTypes(uint64_t hash, const void *chain) {
+    struct Header {
+        VkStructureType sType;
+        const void *pNext;
+    };
+    for (const Header *entry = reinterpret_cast<const Header *>(chain); entry;
+         entry = reinterpret_cast<const Header *>(entry->pNext)) {
+        hash = XXH64(&entry->sType, sizeof(entry->sType), hash);
+    }
+    return hash;
+}
+
+uint64_t CoreChecks::HashGraphicsPipelineCI(const PIPELINE_STATE *pipeline) const {
+    const auto &ci = pipeline->graphicsPipelineCI;
+    uint64_t hash = 0;
+    auto mix = [&hash](const void *data, size_t size) { hash = XXH64(data, size, hash); };
+
+    mix(&ci.flags, sizeof(ci.flags));
+    mix(&ci.subpass, sizeof(ci.subpass));
+    hash = HashPnextChainTypes(hash, ci.pNext);
+
+    for (uint32_t i = 0; i < ci.stageCount; i++) {
+        const auto &stage = ci.pStages[i];
+        mix(&stage.flags, sizeof(stage.flags));
+        mix(&stage.stage, sizeof(stage.stage));
+        const auto *module_state = GetShaderModuleState(stage.module);
+        const uint32_t module_hash = module_state ? module_state->spirv_hash : 0;
+        mix(&module_hash, sizeof(module_hash));
+        if (stage.pName) mix(stage.pName, strlen(stage.pName));
+        if (stage.pSpecializationInfo) {
+            const auto *spec = stage.pSpecializationInfo;
+            if (spec->pMapEntries) mix(spec->pMapEntries, spec->mapEntryCount * sizeof(VkSpecializationMapEntry));
+            if (spec->pData) mix(spec->pData, spec->dataSize);
+        }
+        hash = HashPnextChainTypes(hash, stage.pNext);
+    }
+
+    if (ci.pVertexInputState) {
+        const auto *vi = ci.pVertexInputState;
+        if (vi->pVertexBindingDescriptions) {
+            mix(vi->pVertexBindingDescriptions, vi->vertexBindingDescriptionCount * sizeof(VkVertexInputBindingDescription));
+        }
+        if (vi->pVertexAttributeDescriptions) {
+            mix(vi->pVertexAttributeDescriptions, vi->vertexAttributeDescriptionCount * sizeof(VkVertexInputAttributeDescription));
+        }
+        hash = HashPnextChainTypes(hash, vi->pNext);
+    }
+    if (ci.pInputAssemblyState) {
+        mix(&ci.pInputAssemblyState->topology, sizeof(ci.pInputAssemblyState->topology));
+        mix(&ci.pInputAssemblyState->primitiveRestartEnable, sizeof(VkBool32));
+    }
+    if (ci.pTessellationState) {
+        mix(&ci.pTessellationState->patchControlPoints, sizeof(uint32_t));
+        hash = HashPnextChainTypes(hash, ci.pTessellationState->pNext);
+    }
+    if (ci.pViewportState) {
+        const auto *vp = ci.pViewportState;
+        mix(&vp->viewportCount, sizeof(vp->viewportCount));
+        mix(&vp->scissorCount, sizeof(vp->scissorCount));
+        if (vp->pViewports) mix(vp->pViewports, vp->viewportCount * sizeof(VkViewport));
+        if (vp->pScissors) mix(vp->pScissors, vp->scissorCount * sizeof(VkRect2D));
+        hash = HashPnextChainTypes(hash, vp->pNext);
+    }
+    if (ci.pRasterizationState) {
+        const auto *rs = ci.pRasterizationState;
+        // Scalar block from depthClampEnable through lineWidth
+        mix(&rs->depthClampEnable, sizeof(*rs) - offsetof(safe_VkPipelineRasterizationStateCreateInfo, depthClampEnable));
+        hash = HashPnextChainTypes(hash, rs->pNext);
+    }
+    if (ci.pMultisampleState) {
+        const auto *ms = ci.pMultisampleState;
+        mix(&ms->rasterizationSamples, sizeof(ms->rasterizationSamples));
+        mix(&ms->sampleShadingEnable, sizeof(VkBool32));
+        mix(&ms->minSampleShading, sizeof(float));
+        mix(&ms->alphaToCoverageEnable, sizeof(VkBool32));
+        mix(&ms->alphaToOneEnable, sizeof(VkBool32));
+        if (ms->pSampleMask) mix(ms->pSampleMask, ((ms->rasterizationSamples + 31) / 32) * sizeof(VkSampleMask));
+        hash = HashPnextChainTypes(hash, ms->pNext);
+    }
+    if (ci.pDepthStencilState) {
+        const auto *ds = ci.pDepthStencilState;
+        // Scalar block from depthTestEnable through maxDepthBounds
+        mix(&ds->depthTestEnable, sizeof(*ds) - offsetof(safe_VkPipelineDepthStencilStateCreateInfo, depthTestEnable));
+    }
+    if (ci.pColorBlendState) {
+        const auto *cb = ci.pColorBlendState;
+        mix(&cb->logicOpEnable, sizeof(VkBool32));
+        mix(&cb->logicOp, sizeof(cb->logicOp));
+        if (cb->pAttachments) mix(cb->pAttachments, cb->attachmentCount * sizeof(VkPipelineColorBlendAttachmentState));
+        mix(cb->blendConstants, sizeof(cb->blendConstants));
+        hash = HashPnextChainTypes(hash, cb->pNext);
+    }
+    if (ci.pDynamicState && ci.pDynamicState->pDynamicStates) {
+        mix(ci.pDynamicState->pDynamicStates, ci.pDynamicState->dynamicStateCount * sizeof(VkDynamicState));
+    }
+
+    // Interned canonical ids are unique per definition for the life of the process, so their
+    // pointer values stand in for the render pass and layout contents
+    if (pipeline->rp_state) {
+        const void *rp_compat = pipeline->rp_state->compat_id.get();
+        mix(&rp_compat, sizeof(rp_compat));
+    }
+    for (const auto &set_compat : pipeline->pipeline_layout.compat_for_set) {
+        const void *compat = set_compat.get();
+        mix(&compat, sizeof(compat));
+    }
+    const void *pcr = pipeline->pipeline_layout.push_constant_ranges.get();
+    mix(&pcr, sizeof(pcr));
+
+    return hash;
+}
+
 bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
                                                         const VkGraphicsPipelineCreateInfo *pCreateInfos,
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                         void *cgpl_state_data) {
+    JoinDeferredSpirvValidation();
     bool skip = StateTracker::PreCallValidateCreateGraphicsPipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                      pPipelines, cgpl_state_data);
     create_graphics_pipeline_api_state *cgpl_state = reinterpret_cast<create_graphics_pipeline_api_state *>(cgpl_state_data);
@@ -5073,9 +5566,28 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
         skip |= ValidatePipelineLocked(cgpl_state->pipe_state, i);
     }
 
-    for (uint32_t i = 0; i < count; i++) {
-        skip |= ValidatePipelineUnlocked(cgpl_state->pipe_state[i].get(), i);
-    }
+    // The unlocked checks for each element are independent of the other elements (the
+    // derivative-pipeline ordering rules are covered by ValidatePipelineLocked above), and apps
+    // batch hundreds of create infos precisely so this work can spread across cores.  The read
+    // lock held across validation keeps the state the workers read stable; messages identify
+    // their element by index.
+    std::atomic<bool> parallel_skip(false);
+    VlThreadPool::Instance().ParallelFor(count, [this, cgpl_state, &parallel_skip](uint32_t i) {
+        // Identical pipelines recreated on this device -- typically across swapchain rebuilds --
+        // hash to a verdict already in the cache and skip re-validation entirely
+        const uint64_t ci_hash = HashGraphicsPipelineCI(cgpl_state->pipe_state[i].get());
+        {
+            std::lock_guard<std::mutex> lock(pipeline_validation_verdict_lock);
+            if (pipeline_validation_verdicts.count(ci_hash)) return;
+        }
+        if (ValidatePipelineUnlocked(cgpl_state->pipe_state[i].get(), i)) {
+            parallel_skip = true;
+        } else {
+            std::lock_guard<std::mutex> lock(pipeline_validation_verdict_lock);
+            pipeline_validation_verdicts.insert(ci_hash);
+        }
+    });
+    skip |= parallel_skip;
 
     if (device_extensions.vk_ext_vertex_attribute_divisor) {
         skip |= ValidatePipelineVertexDivisors(cgpl_state->pipe_state, count, pCreateInfos);
@@ -5147,6 +5659,7 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                        const VkComputePipelineCreateInfo *pCreateInfos,
                                                        const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                        void *ccpl_state_data) {
+    JoinDeferredSpirvValidation();
     bool skip = StateTracker::PreCallValidateCreateComputePipelines(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                     pPipelines, ccpl_state_data);
 
@@ -5222,6 +5735,7 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                                                             const VkRayTracingPipelineCreateInfoNV *pCreateInfos,
                                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                             void *crtpl_state_data) {
+    JoinDeferredSpirvValidation();
     bool skip = StateTracker::PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, count, pCreateInfos, pAllocator,
                                                                          pPipelines, crtpl_state_data);
 
@@ -5300,7 +5814,7 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorSetLayout(VkDevice de
 // Note that the index argument is optional and only used by CreatePipelineLayout.
 bool CoreChecks::ValidatePushConstantRange(const uint32_t offset, const uint32_t size, const char *caller_name,
                                            uint32_t index = 0) const {
-    if (disabled.push_constant_range) return false;
+    if (disabled.IsDisabled(kDisableBitPushConstantRange)) return false;
     uint32_t const maxPushConstantsSize = phys_dev_props.limits.maxPushConstantsSize;
     bool skip = false;
     // Check that offset + size don't exceed the max.
@@ -6024,7 +6538,7 @@ void ValidationStateTracker::PostCallRecordCreateDescriptorPool(VkDevice device,
 bool CoreChecks::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                     VkDescriptorPoolResetFlags flags) {
     // Make sure sets being destroyed are not currently in-use
-    if (disabled.idle_descriptor_set) return false;
+    if (disabled.IsDisabled(kDisableBitIdleDescriptorSet)) return false;
     bool skip = false;
     DESCRIPTOR_POOL_STATE *pPool = GetDescriptorPoolState(descriptorPool);
     if (pPool != nullptr) {
@@ -6051,9 +6565,7 @@ void ValidationStateTracker::PostCallRecordResetDescriptorPool(VkDevice device,
     }
     pPool->sets.clear();
     // Reset available count for each type and available sets for this pool
-    for (auto it = pPool->availableDescriptorTypeCount.begin(); it != pPool->availableDescriptorTypeCount.end(); ++it) {
-        pPool->availableDescriptorTypeCount[it->first] = pPool->maxDescriptorTypeCount[it->first];
-    }
+    pPool->availableDescriptorTypeCount = pPool->maxDescriptorTypeCount;
     pPool->availableSets = pPool->maxSets;
 }
 
@@ -6114,7 +6626,7 @@ void ValidationStateTracker::PreCallRecordFreeDescriptorSets(VkDevice device, Vk
             auto descriptor_set = setMap[pDescriptorSets[i]].get();
             uint32_t type_index = 0, descriptor_count = 0;
             for (uint32_t j = 0; j < descriptor_set->GetBindingCount(); ++j) {
-                type_index = static_cast<uint32_t>(descriptor_set->GetTypeFromIndex(j));
+                type_index = DescriptorTypeIndex(descriptor_set->GetTypeFromIndex(j));
                 descriptor_count = descriptor_set->GetDescriptorCountFromIndex(j);
                 pool_state->availableDescriptorTypeCount[type_index] += descriptor_count;
             }
@@ -6154,7 +6666,15 @@ void ValidationStateTracker::PostCallRecordAllocateCommandBuffers(VkDevice devic
         for (uint32_t i = 0; i < pCreateInfo->commandBufferCount; i++) {
             // Add command buffer to its commandPool map
             pPool->commandBuffers.insert(pCommandBuffer[i]);
-            std::unique_ptr<CMD_BUFFER_STATE> pCB(new CMD_BUFFER_STATE{});
+            // Reuse a recycled CMD_BUFFER_STATE from this pool when one is available; it was
+            // reset when it was freed, so only the identity fields need to be rewritten
+            std::unique_ptr<CMD_BUFFER_STATE> pCB;
+            if (!pPool->recycled_command_buffers.empty()) {
+                pCB = std::move(pPool->recycled_command_buffers.back());
+                pPool->recycled_command_buffers.pop_back();
+            } else {
+                pCB.reset(new CMD_BUFFER_STATE{});
+            }
             pCB->createInfo = *pCreateInfo;
             pCB->device = device;
             // Add command buffer to map
@@ -6331,6 +6851,13 @@ bool CoreChecks::PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer)
     return skip;
 }
 
+void CoreChecks::PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    if (enabled.gpu_validation) {
+        // Fold the GPU-AV availability barrier into the command buffer itself
+        GpuPreCallRecordEndCommandBuffer(commandBuffer);
+    }
+}
+
 void ValidationStateTracker::PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     if (!cb_state) return;
@@ -6437,6 +6964,7 @@ void ValidationStateTracker::PreCallRecordCmdBindPipeline(VkCommandBuffer comman
         cb_state->status |= cb_state->static_status;
     }
     cb_state->lastBound[pipelineBindPoint].pipeline_state = pipe_state;
+    cb_state->DirtyDrawState(pipelineBindPoint, CBDIRTY_PIPELINE);
     SetPipelineState(pipe_state);
     AddCommandBufferBinding(&pipe_state->cb_bindings, VulkanTypedHandle(pipeline, kVulkanObjectTypePipeline), cb_state);
 }
@@ -6461,6 +6989,7 @@ void ValidationStateTracker::PreCallRecordCmdSetViewport(VkCommandBuffer command
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->viewportMask |= ((1u << viewportCount) - 1u) << firstViewport;
     cb_state->status |= CBSTATUS_VIEWPORT_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
@@ -6483,6 +7012,7 @@ void ValidationStateTracker ::PreCallRecordCmdSetScissor(VkCommandBuffer command
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->scissorMask |= ((1u << scissorCount) - 1u) << firstScissor;
     cb_state->status |= CBSTATUS_SCISSOR_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor,
@@ -6514,6 +7044,7 @@ void ValidationStateTracker::PreCallRecordCmdSetExclusiveScissorNV(VkCommandBuff
     // TODO: We don't have VUIDs for validating that all exclusive scissors have been set.
     // cb_state->exclusiveScissorMask |= ((1u << exclusiveScissorCount) - 1u) << firstExclusiveScissor;
     cb_state->status |= CBSTATUS_EXCLUSIVE_SCISSOR_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
@@ -6581,6 +7112,7 @@ bool CoreChecks::PreCallValidateCmdBindShadingRateImageNV(VkCommandBuffer comman
 void CoreChecks::PreCallRecordCmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView,
                                                         VkImageLayout imageLayout) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 
     if (imageView != VK_NULL_HANDLE) {
         auto view_state = GetImageViewState(imageView);
@@ -6632,6 +7164,7 @@ void ValidationStateTracker::PreCallRecordCmdSetViewportShadingRatePaletteNV(VkC
     // TODO: We don't have VUIDs for validating that all shading rate palettes have been set.
     // cb_state->shadingRatePaletteMask |= ((1u << viewportCount) - 1u) << firstViewport;
     cb_state->status |= CBSTATUS_SHADING_RATE_PALETTE_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 void CoreChecks::PostCallRecordCreateAccelerationStructureNV(VkDevice device,
@@ -7049,6 +7582,7 @@ bool CoreChecks::PreCallValidateCmdSetLineWidth(VkCommandBuffer commandBuffer, f
 void ValidationStateTracker::PreCallRecordCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_LINE_WIDTH_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp,
@@ -7076,6 +7610,7 @@ void ValidationStateTracker::PreCallRecordCmdSetDepthBias(VkCommandBuffer comman
                                                           float depthBiasClamp, float depthBiasSlopeFactor) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_BIAS_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
@@ -7095,6 +7630,7 @@ bool CoreChecks::PreCallValidateCmdSetBlendConstants(VkCommandBuffer commandBuff
 void ValidationStateTracker::PreCallRecordCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_BLEND_CONSTANTS_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
@@ -7115,6 +7651,7 @@ void ValidationStateTracker::PreCallRecordCmdSetDepthBounds(VkCommandBuffer comm
                                                             float maxDepthBounds) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_DEPTH_BOUNDS_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
@@ -7136,6 +7673,7 @@ void ValidationStateTracker::PreCallRecordCmdSetStencilCompareMask(VkCommandBuff
                                                                    uint32_t compareMask) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_READ_MASK_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
@@ -7157,6 +7695,7 @@ void ValidationStateTracker::PreCallRecordCmdSetStencilWriteMask(VkCommandBuffer
                                                                  uint32_t writeMask) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_WRITE_MASK_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 bool CoreChecks::PreCallValidateCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
@@ -7178,6 +7717,7 @@ void ValidationStateTracker::PreCallRecordCmdSetStencilReference(VkCommandBuffer
                                                                  uint32_t reference) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->status |= CBSTATUS_STENCIL_REFERENCE_SET;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_DYNAMIC_STATE);
 }
 
 // Update pipeline_layout bind points applying the "Pipeline Layout Compatibility" rules
@@ -7312,6 +7852,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorSets(VkCommandBuffer
         UpdateLastBoundDescriptorSets(cb_state, pipelineBindPoint, pipeline_layout, firstSet, setCount, descriptor_sets,
                                       dynamicOffsetCount, pDynamicOffsets);
         cb_state->lastBound[pipelineBindPoint].pipeline_layout = layout;
+        cb_state->DirtyDrawState(pipelineBindPoint, CBDIRTY_DESCRIPTOR_SETS);
     }
 }
 
@@ -7517,6 +8058,7 @@ void CoreChecks::RecordCmdPushDescriptorSetState(CMD_BUFFER_STATE *cb_state, VkP
 
     // Now that we have either the new or extant push_descriptor set ... do the write updates against it
     push_descriptor_set->PerformPushDescriptorsUpdate(descriptorWriteCount, pDescriptorWrites);
+    cb_state->DirtyDrawState(pipelineBindPoint, CBDIRTY_DESCRIPTOR_SETS);
 }
 
 void CoreChecks::PreCallRecordCmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
@@ -7570,6 +8112,7 @@ void CoreChecks::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer commandBuffer,
     auto cb_state = GetCBState(commandBuffer);
 
     cb_state->status |= CBSTATUS_INDEX_BUFFER_BOUND;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_VERTEX_INDEX);
     cb_state->index_buffer_binding.buffer = buffer;
     cb_state->index_buffer_binding.size = buffer_state->createInfo.size;
     cb_state->index_buffer_binding.offset = offset;
@@ -7606,6 +8149,7 @@ bool CoreChecks::PreCallValidateCmdBindVertexBuffers(VkCommandBuffer commandBuff
 void CoreChecks::PreCallRecordCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
                                                    const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) {
     auto cb_state = GetCBState(commandBuffer);
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_VERTEX_INDEX);
 
     uint32_t end = firstBinding + bindingCount;
     if (cb_state->current_vertex_buffer_binding_info.vertex_buffer_bindings.size() < end) {
@@ -7695,13 +8239,12 @@ void CoreChecks::PreCallRecordCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent
     auto event_state = GetEventState(event);
     if (event_state) {
         AddCommandBufferBinding(&event_state->cb_bindings, VulkanTypedHandle(event, kVulkanObjectTypeEvent), cb_state);
-        event_state->cb_bindings.insert(cb_state);
     }
     cb_state->events.push_back(event);
     if (!cb_state->waitedEvents.count(event)) {
         cb_state->writeEventsBeforeWait.push_back(event);
     }
-    cb_state->eventUpdates.emplace_back([=](VkQueue q) { return SetEventStageMask(q, commandBuffer, event, stageMask); });
+    cb_state->eventUpdates.push_back(SUBMIT_TIME_OP::SetEvent(commandBuffer, event, stageMask));
 }
 
 bool CoreChecks::PreCallValidateCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
@@ -7723,15 +8266,13 @@ void CoreChecks::PreCallRecordCmdResetEvent(VkCommandBuffer commandBuffer, VkEve
     auto event_state = GetEventState(event);
     if (event_state) {
         AddCommandBufferBinding(&event_state->cb_bindings, VulkanTypedHandle(event, kVulkanObjectTypeEvent), cb_state);
-        event_state->cb_bindings.insert(cb_state);
     }
     cb_state->events.push_back(event);
     if (!cb_state->waitedEvents.count(event)) {
         cb_state->writeEventsBeforeWait.push_back(event);
     }
     // TODO : Add check for "VUID-vkResetEvent-event-01148"
-    cb_state->eventUpdates.emplace_back(
-        [=](VkQueue q) { return SetEventStageMask(q, commandBuffer, event, VkPipelineStageFlags(0)); });
+    cb_state->eventUpdates.push_back(SUBMIT_TIME_OP::SetEvent(commandBuffer, event, VkPipelineStageFlags(0)));
 }
 
 // Return input pipeline stage flags, expanded for individual bits if VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT is set
@@ -7844,6 +8385,7 @@ bool CoreChecks::ValidateImageBarrierImage(const char *funcName, CMD_BUFFER_STAT
                                            const VulkanTypedHandle &rp_handle, uint32_t img_index,
                                            const VkImageMemoryBarrier &img_barrier) {
     bool skip = false;
+    ScopedCheckSample telemetry_sample(check_telemetry, CheckTelemetry::kValidateImageBarrierImage, skip);
     const auto &fb_state = GetFramebufferState(framebuffer);
     assert(fb_state);
     const auto img_bar_image = img_barrier.image;
@@ -8327,6 +8869,7 @@ class ValidatorState {
         };
     }
     const char *GetTypeString() const { return object_string[barrier_handle_.type]; }
+    const VulkanTypedHandle &BarrierHandle() const { return barrier_handle_; }
     VkSharingMode GetSharingMode() const { return sharing_mode_; }
 
    protected:
@@ -8386,14 +8929,60 @@ bool Validate(const CoreChecks *device_data, const char *func_name, CMD_BUFFER_S
         // TODO create a better named list, or rename the submit time lists to something that matches the broader usage...
         // Note: if we want to create a semantic that separates state lookup, validation, and state update this should go
         // to a local queue of update_state_actions or something.
-        cb_state->eventUpdates.emplace_back([device_data, src_queue_family, dst_queue_family, val](VkQueue queue) {
-            return ValidatorState::ValidateAtQueueSubmit(queue, device_data, src_queue_family, dst_queue_family, val);
-        });
+        cb_state->eventUpdates.push_back(SUBMIT_TIME_OP::BarrierQueueFamilies(cb_state->commandBuffer, val.BarrierHandle(),
+                                                                             val.GetSharingMode(), func_name, src_queue_family,
+                                                                             dst_queue_family));
     }
     return skip;
 }
 }  // namespace barrier_queue_families
 
+// Replay one submit-time record (see SUBMIT_TIME_OP).  These ops update queue/device event and
+// query state in addition to validating, exactly as the std::function closures they replaced did
+// (those captured a non-const this at record time), hence the contained const_cast.
+bool CoreChecks::RunSubmitTimeOp(VkQueue queue, const SUBMIT_TIME_OP &op) const {
+    auto *core = const_cast<CoreChecks *>(this);
+    switch (op.type) {
+        case SUBMIT_TIME_OP::kSetEventStageMask:
+            return core->SetEventStageMask(queue, op.command_buffer, op.set_event.event, op.set_event.stage_mask);
+        case SUBMIT_TIME_OP::kValidateEventStageMask:
+            return core->ValidateEventStageMask(queue, core->GetCBState(op.command_buffer), op.wait_events.event_count,
+                                                op.wait_events.first_event_index, op.wait_events.source_stage_mask);
+        case SUBMIT_TIME_OP::kValidateBarrierQueueFamilies: {
+            using barrier_queue_families::ValidatorState;
+            VulkanTypedHandle barrier_handle;
+            barrier_handle.handle = op.barrier_families.barrier_handle;
+            barrier_handle.type = op.barrier_families.barrier_type;
+            const auto *val_codes = (kVulkanObjectTypeImage == barrier_handle.type) ? barrier_queue_families::image_error_codes
+                                                                                   : barrier_queue_families::buffer_error_codes;
+            const ValidatorState val(this, op.barrier_families.func_name, GetCBState(op.command_buffer), barrier_handle,
+                                     op.barrier_families.sharing_mode, val_codes);
+            return ValidatorState::ValidateAtQueueSubmit(queue, this, op.barrier_families.src_family,
+                                                         op.barrier_families.dst_family, val);
+        }
+        case SUBMIT_TIME_OP::kBeginQuery: {
+            const QueryObject query_obj(op.query.pool, op.query.slot);
+            bool skip = core->VerifyQueryIsReset(queue, op.command_buffer, query_obj);
+            skip |= core->SetQueryState(queue, op.command_buffer, query_obj, QUERYSTATE_RUNNING);
+            return skip;
+        }
+        case SUBMIT_TIME_OP::kEndQuery:
+            return core->SetQueryState(queue, op.command_buffer, QueryObject(op.query.pool, op.query.slot), QUERYSTATE_AVAILABLE);
+        case SUBMIT_TIME_OP::kResetQuery:
+            return core->SetQueryState(queue, op.command_buffer, QueryObject(op.query.pool, op.query.slot), QUERYSTATE_RESET);
+        case SUBMIT_TIME_OP::kValidateQuery:
+            return core->ValidateQuery(queue, core->GetCBState(op.command_buffer), op.query_range.pool,
+                                       op.query_range.first_query, op.query_range.query_count, op.query_range.flags);
+        case SUBMIT_TIME_OP::kWriteTimestamp: {
+            const QueryObject query_obj(op.query.pool, op.query.slot);
+            bool skip = core->VerifyQueryIsReset(queue, op.command_buffer, query_obj);
+            skip |= core->SetQueryState(queue, op.command_buffer, query_obj, QUERYSTATE_AVAILABLE);
+            return skip;
+        }
+    }
+    return false;
+}
+
 // Type specific wrapper for image barriers
 bool CoreChecks::ValidateBarrierQueueFamilies(const char *func_name, CMD_BUFFER_STATE *cb_state,
                                               const VkImageMemoryBarrier *barrier, const IMAGE_STATE *state_data) {
@@ -8430,6 +9019,7 @@ bool CoreChecks::ValidateBarriers(const char *funcName, CMD_BUFFER_STATE *cb_sta
                                   const VkBufferMemoryBarrier *pBufferMemBarriers, uint32_t imageMemBarrierCount,
                                   const VkImageMemoryBarrier *pImageMemBarriers) {
     bool skip = false;
+    ScopedCheckSample telemetry_sample(check_telemetry, CheckTelemetry::kValidateBarriers, skip);
     for (uint32_t i = 0; i < memBarrierCount; ++i) {
         const auto &mem_barrier = pMemBarriers[i];
         if (!ValidateAccessMaskPipelineStage(device_extensions, mem_barrier.srcAccessMask, src_stage_mask)) {
@@ -8445,7 +9035,12 @@ bool CoreChecks::ValidateBarriers(const char *funcName, CMD_BUFFER_STATE *cb_sta
                             mem_barrier.dstAccessMask, dst_stage_mask);
         }
     }
-    for (uint32_t i = 0; i < imageMemBarrierCount; ++i) {
+    // Walk the image barriers grouped by image so the state lookup is done once per unique image --
+    // frame graphs commonly emit these in batches of dozens, many naming the same image.
+    const auto image_barrier_order = GetBarrierHandleSortOrder(imageMemBarrierCount, pImageMemBarriers, &VkImageMemoryBarrier::image);
+    IMAGE_STATE *image_data = nullptr;
+    for (uint32_t n = 0; n < imageMemBarrierCount; ++n) {
+        const uint32_t i = image_barrier_order[n];
         auto mem_barrier = &pImageMemBarriers[i];
         if (!ValidateAccessMaskPipelineStage(device_extensions, mem_barrier->srcAccessMask, src_stage_mask)) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
@@ -8460,7 +9055,9 @@ bool CoreChecks::ValidateBarriers(const char *funcName, CMD_BUFFER_STATE *cb_sta
                             mem_barrier->dstAccessMask, dst_stage_mask);
         }
 
-        auto image_data = GetImageState(mem_barrier->image);
+        if ((n == 0) || (mem_barrier->image != pImageMemBarriers[image_barrier_order[n - 1]].image)) {
+            image_data = GetImageState(mem_barrier->image);
+        }
         skip |= ValidateBarrierQueueFamilies(funcName, cb_state, mem_barrier, image_data);
 
         if (mem_barrier->newLayout == VK_IMAGE_LAYOUT_UNDEFINED || mem_barrier->newLayout == VK_IMAGE_LAYOUT_PREINITIALIZED) {
@@ -8484,7 +9081,11 @@ bool CoreChecks::ValidateBarriers(const char *funcName, CMD_BUFFER_STATE *cb_sta
         }
     }
 
-    for (uint32_t i = 0; i < bufferBarrierCount; ++i) {
+    // Same grouping for buffer barriers
+    const auto buffer_barrier_order = GetBarrierHandleSortOrder(bufferBarrierCount, pBufferMemBarriers, &VkBufferMemoryBarrier::buffer);
+    BUFFER_STATE *buffer_state = nullptr;
+    for (uint32_t n = 0; n < bufferBarrierCount; ++n) {
+        const uint32_t i = buffer_barrier_order[n];
         auto mem_barrier = &pBufferMemBarriers[i];
         if (!mem_barrier) continue;
 
@@ -8501,7 +9102,9 @@ bool CoreChecks::ValidateBarriers(const char *funcName, CMD_BUFFER_STATE *cb_sta
                             mem_barrier->dstAccessMask, dst_stage_mask);
         }
         // Validate buffer barrier queue family indices
-        auto buffer_state = GetBufferState(mem_barrier->buffer);
+        if ((n == 0) || (mem_barrier->buffer != pBufferMemBarriers[buffer_barrier_order[n - 1]].buffer)) {
+            buffer_state = GetBufferState(mem_barrier->buffer);
+        }
         skip |= ValidateBarrierQueueFamilies(funcName, cb_state, mem_barrier, buffer_state);
 
         if (buffer_state) {
@@ -8633,11 +9236,10 @@ bool AllTransferOp(const COMMAND_POOL_STATE *pool, OpCheck &op_check, uint32_t c
 }
 
 // Look at the barriers to see if we they are all release or all acquire, the result impacts queue properties validation
-BarrierOperationsType CoreChecks::ComputeBarrierOperationsType(CMD_BUFFER_STATE *cb_state, uint32_t buffer_barrier_count,
+BarrierOperationsType CoreChecks::ComputeBarrierOperationsType(const COMMAND_POOL_STATE *pool, uint32_t buffer_barrier_count,
                                                                const VkBufferMemoryBarrier *buffer_barriers,
                                                                uint32_t image_barrier_count,
                                                                const VkImageMemoryBarrier *image_barriers) {
-    auto pool = GetCommandPoolState(cb_state->createInfo.commandPool);
     BarrierOperationsType op_type = kGeneral;
 
     // Look at the barrier details only if they exist
@@ -8655,13 +9257,13 @@ BarrierOperationsType CoreChecks::ComputeBarrierOperationsType(CMD_BUFFER_STATE
     return op_type;
 }
 
-bool CoreChecks::ValidateStageMasksAgainstQueueCapabilities(CMD_BUFFER_STATE const *cb_state,
+bool CoreChecks::ValidateStageMasksAgainstQueueCapabilities(CMD_BUFFER_STATE const *cb_state, const COMMAND_POOL_STATE *pool,
                                                             VkPipelineStageFlags source_stage_mask,
                                                             VkPipelineStageFlags dest_stage_mask,
                                                             BarrierOperationsType barrier_op_type, const char *function,
                                                             const char *error_code) {
     bool skip = false;
-    uint32_t queue_family_index = commandPoolMap[cb_state->createInfo.commandPool].get()->queueFamilyIndex;
+    uint32_t queue_family_index = pool->queueFamilyIndex;
     auto physical_device_state = GetPhysicalDeviceState();
 
     // Any pipeline stage included in srcStageMask or dstStageMask must be supported by the capabilities of the queue family
@@ -8693,9 +9295,11 @@ bool CoreChecks::PreCallValidateCmdWaitEvents(VkCommandBuffer commandBuffer, uin
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
 
-    auto barrier_op_type = ComputeBarrierOperationsType(cb_state, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+    // Hoist the command pool lookup -- every barrier in the call shares it
+    const auto *cmd_pool = GetCommandPoolState(cb_state->createInfo.commandPool);
+    auto barrier_op_type = ComputeBarrierOperationsType(cmd_pool, bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                                         imageMemoryBarrierCount, pImageMemoryBarriers);
-    bool skip = ValidateStageMasksAgainstQueueCapabilities(cb_state, sourceStageMask, dstStageMask, barrier_op_type,
+    bool skip = ValidateStageMasksAgainstQueueCapabilities(cb_state, cmd_pool, sourceStageMask, dstStageMask, barrier_op_type,
                                                            "vkCmdWaitEvents", "VUID-vkCmdWaitEvents-srcStageMask-01164");
     skip |= ValidateStageMaskGsTsEnables(sourceStageMask, "vkCmdWaitEvents()", "VUID-vkCmdWaitEvents-srcStageMask-01159",
                                          "VUID-vkCmdWaitEvents-srcStageMask-01161", "VUID-vkCmdWaitEvents-srcStageMask-02111",
@@ -8723,13 +9327,12 @@ void CoreChecks::PreCallRecordCmdWaitEvents(VkCommandBuffer commandBuffer, uint3
         auto event_state = GetEventState(pEvents[i]);
         if (event_state) {
             AddCommandBufferBinding(&event_state->cb_bindings, VulkanTypedHandle(pEvents[i], kVulkanObjectTypeEvent), cb_state);
-            event_state->cb_bindings.insert(cb_state);
         }
         cb_state->waitedEvents.insert(pEvents[i]);
         cb_state->events.push_back(pEvents[i]);
     }
-    cb_state->eventUpdates.emplace_back(
-        [=](VkQueue q) { return ValidateEventStageMask(q, cb_state, eventCount, first_event_index, sourceStageMask); });
+    cb_state->eventUpdates.push_back(
+        SUBMIT_TIME_OP::WaitEvents(cb_state->commandBuffer, eventCount, first_event_index, sourceStageMask));
     TransitionImageLayouts(cb_state, imageMemoryBarrierCount, pImageMemoryBarriers);
     if (enabled.gpu_validation) {
         GpuPreCallValidateCmdWaitEvents(sourceStageMask);
@@ -8757,9 +9360,11 @@ bool CoreChecks::PreCallValidateCmdPipelineBarrier(VkCommandBuffer commandBuffer
     assert(cb_state);
 
     bool skip = false;
-    auto barrier_op_type = ComputeBarrierOperationsType(cb_state, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+    // Hoist the command pool lookup -- every barrier in the call shares it
+    const auto *cmd_pool = GetCommandPoolState(cb_state->createInfo.commandPool);
+    auto barrier_op_type = ComputeBarrierOperationsType(cmd_pool, bufferMemoryBarrierCount, pBufferMemoryBarriers,
                                                         imageMemoryBarrierCount, pImageMemoryBarriers);
-    skip |= ValidateStageMasksAgainstQueueCapabilities(cb_state, srcStageMask, dstStageMask, barrier_op_type,
+    skip |= ValidateStageMasksAgainstQueueCapabilities(cb_state, cmd_pool, srcStageMask, dstStageMask, barrier_op_type,
                                                        "vkCmdPipelineBarrier", "VUID-vkCmdPipelineBarrier-srcStageMask-01183");
     skip |= ValidateCmdQueueFlags(cb_state, "vkCmdPipelineBarrier()",
                                   VK_QUEUE_TRANSFER_BIT | VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
@@ -8855,20 +9460,17 @@ bool CoreChecks::ValidateBeginQuery(const CMD_BUFFER_STATE *cb_state, const Quer
 }
 
 void CoreChecks::RecordBeginQuery(CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj) {
+    if (!state_tracking.query_state) return;
     cb_state->activeQueries.insert(query_obj);
     cb_state->startedQueries.insert(query_obj);
-    cb_state->queryUpdates.emplace_back([this, cb_state, query_obj](VkQueue q) {
-        bool skip = false;
-        skip |= VerifyQueryIsReset(q, cb_state->commandBuffer, query_obj);
-        skip |= SetQueryState(q, cb_state->commandBuffer, query_obj, QUERYSTATE_RUNNING);
-        return skip;
-    });
+    cb_state->queryUpdates.push_back(
+        SUBMIT_TIME_OP::Query(SUBMIT_TIME_OP::kBeginQuery, cb_state->commandBuffer, query_obj.pool, query_obj.query));
     AddCommandBufferBinding(&GetQueryPoolState(query_obj.pool)->cb_bindings,
                             VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool), cb_state);
 }
 
 bool CoreChecks::PreCallValidateCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot, VkFlags flags) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
     QueryObject query_obj(queryPool, slot);
@@ -8919,7 +9521,7 @@ bool CoreChecks::ValidateCmdEndQuery(const CMD_BUFFER_STATE *cb_state, const Que
 }
 
 bool CoreChecks::PreCallValidateCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t slot) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     QueryObject query_obj = {queryPool, slot};
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
@@ -8928,10 +9530,10 @@ bool CoreChecks::PreCallValidateCmdEndQuery(VkCommandBuffer commandBuffer, VkQue
 }
 
 void CoreChecks::RecordCmdEndQuery(CMD_BUFFER_STATE *cb_state, const QueryObject &query_obj) {
+    if (!state_tracking.query_state) return;
     cb_state->activeQueries.erase(query_obj);
-    cb_state->queryUpdates.emplace_back([this, cb_state, query_obj](VkQueue q) {
-        return SetQueryState(q, cb_state->commandBuffer, query_obj, QUERYSTATE_AVAILABLE);
-    });
+    cb_state->queryUpdates.push_back(
+        SUBMIT_TIME_OP::Query(SUBMIT_TIME_OP::kEndQuery, cb_state->commandBuffer, query_obj.pool, query_obj.query));
     AddCommandBufferBinding(&GetQueryPoolState(query_obj.pool)->cb_bindings,
                             VulkanTypedHandle(query_obj.pool, kVulkanObjectTypeQueryPool), cb_state);
 }
@@ -8944,7 +9546,7 @@ void CoreChecks::PostCallRecordCmdEndQuery(VkCommandBuffer commandBuffer, VkQuer
 
 bool CoreChecks::PreCallValidateCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
                                                   uint32_t queryCount) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     bool skip = InsideRenderPass(cb_state, "vkCmdResetQueryPool()", "VUID-vkCmdResetQueryPool-renderpass");
@@ -8956,12 +9558,12 @@ bool CoreChecks::PreCallValidateCmdResetQueryPool(VkCommandBuffer commandBuffer,
 
 void CoreChecks::PostCallRecordCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
                                                  uint32_t queryCount) {
+    if (!state_tracking.query_state) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
 
     for (uint32_t i = 0; i < queryCount; i++) {
         QueryObject query = {queryPool, firstQuery + i};
-        cb_state->queryUpdates.emplace_back(
-            [this, commandBuffer, query](VkQueue q) { return SetQueryState(q, commandBuffer, query, QUERYSTATE_RESET); });
+        cb_state->queryUpdates.push_back(SUBMIT_TIME_OP::Query(SUBMIT_TIME_OP::kResetQuery, commandBuffer, query.pool, query.query));
     }
     AddCommandBufferBinding(&GetQueryPoolState(queryPool)->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool),
                             cb_state);
@@ -8970,15 +9572,11 @@ void CoreChecks::PostCallRecordCmdResetQueryPool(VkCommandBuffer commandBuffer,
 QueryState CoreChecks::GetQueryState(QUEUE_STATE *queue_data, VkQueryPool queryPool, uint32_t queryIndex) {
     QueryObject query = {queryPool, queryIndex};
 
-    const std::array<decltype(queryToStateMap) *, 2> map_list = {&queue_data->queryToStateMap, &queryToStateMap};
-
-    for (const auto map : map_list) {
-        auto query_data = map->find(query);
-        if (query_data != map->end()) {
-            return query_data->second;
-        }
+    auto query_data = queue_data->queryToStateMap.find(query);
+    if (query_data != queue_data->queryToStateMap.end()) {
+        return query_data->second;
     }
-    return QUERYSTATE_UNKNOWN;
+    return GetQueryPoolSlotState(queryPool, queryIndex);
 }
 
 QueryResultType CoreChecks::GetQueryResultType(QueryState state, VkQueryResultFlags flags) {
@@ -9027,7 +9625,7 @@ bool CoreChecks::ValidateQuery(VkQueue queue, CMD_BUFFER_STATE *pCB, VkQueryPool
 bool CoreChecks::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
                                                         uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                                         VkDeviceSize stride, VkQueryResultFlags flags) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     auto cb_state = GetCBState(commandBuffer);
     auto dst_buff_state = GetBufferState(dstBuffer);
     assert(cb_state);
@@ -9053,9 +9651,8 @@ void CoreChecks::PostCallRecordCmdCopyQueryPoolResults(VkCommandBuffer commandBu
     auto cb_state = GetCBState(commandBuffer);
     auto dst_buff_state = GetBufferState(dstBuffer);
     AddCommandBufferBindingBuffer(cb_state, dst_buff_state);
-    cb_state->queryUpdates.emplace_back([this, cb_state, queryPool, firstQuery, queryCount, flags](VkQueue q) {
-        return ValidateQuery(q, cb_state, queryPool, firstQuery, queryCount, flags);
-    });
+    if (!state_tracking.query_state) return;
+    cb_state->queryUpdates.push_back(SUBMIT_TIME_OP::QueryRange(cb_state->commandBuffer, queryPool, firstQuery, queryCount, flags));
     AddCommandBufferBinding(&GetQueryPoolState(queryPool)->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool),
                             cb_state);
 }
@@ -9115,7 +9712,7 @@ bool CoreChecks::PreCallValidateCmdPushConstants(VkCommandBuffer commandBuffer,
 
 bool CoreChecks::PreCallValidateCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                                   VkQueryPool queryPool, uint32_t slot) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
     bool skip = ValidateCmdQueueFlags(cb_state, "vkCmdWriteTimestamp()",
@@ -9127,14 +9724,10 @@ bool CoreChecks::PreCallValidateCmdWriteTimestamp(VkCommandBuffer commandBuffer,
 
 void CoreChecks::PostCallRecordCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage,
                                                  VkQueryPool queryPool, uint32_t slot) {
+    if (!state_tracking.query_state) return;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     QueryObject query = {queryPool, slot};
-    cb_state->queryUpdates.emplace_back([this, commandBuffer, query](VkQueue q) {
-        bool skip = false;
-        skip |= VerifyQueryIsReset(q, commandBuffer, query);
-        skip |= SetQueryState(q, commandBuffer, query, QUERYSTATE_AVAILABLE);
-        return skip;
-    });
+    cb_state->queryUpdates.push_back(SUBMIT_TIME_OP::Query(SUBMIT_TIME_OP::kWriteTimestamp, commandBuffer, query.pool, query.query));
     AddCommandBufferBinding(&GetQueryPoolState(queryPool)->cb_bindings, VulkanTypedHandle(queryPool, kVulkanObjectTypeQueryPool),
                             cb_state);
 }
@@ -9588,12 +10181,21 @@ void ValidationStateTracker::PostCallRecordCreateFramebuffer(VkDevice device, co
         new FRAMEBUFFER_STATE(*pFramebuffer, pCreateInfo, GetRenderPassStateSharedPtr(pCreateInfo->renderPass)));
 
     if ((pCreateInfo->flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR) == 0) {
+        // Resolve each attachment to a flat record so per-begin validation scans the table
+        // instead of repeating these lookups. Rows with a null view or image state force the
+        // lookup path at begin time, which reports the appropriate error.
+        fb_state->attachments.reserve(pCreateInfo->attachmentCount);
         for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
+            MT_FB_ATTACHMENT_INFO fb_info = {};
             VkImageView view = pCreateInfo->pAttachments[i];
             auto view_state = GetImageViewState(view);
-            if (!view_state) {
-                continue;
+            if (view_state) {
+                fb_info.view_state = view_state;
+                fb_info.image = view_state->create_info.image;
+                fb_info.subresource_range = view_state->normalized_subresource_range;
+                fb_info.image_state = GetImageState(fb_info.image);
             }
+            fb_state->attachments.push_back(fb_info);
         }
     }
     frameBufferMap[*pFramebuffer] = std::move(fb_state);
@@ -10378,7 +10980,8 @@ bool CoreChecks::ValidateCreateRenderPass(VkDevice device, RenderPassCreateVersi
 }
 
 bool CoreChecks::PreCallValidateCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
-                                                 const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) {
+                                                 const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                                 void *crp_state_data) {
     bool skip = false;
     // Handle extension structs from KHR_multiview and KHR_maintenance2 that can only be validated for RP1 (indices out of bounds)
     const VkRenderPassMultiviewCreateInfo *pMultiviewInfo = lvl_find_in_chain<VkRenderPassMultiviewCreateInfo>(pCreateInfo->pNext);
@@ -10418,8 +11021,11 @@ bool CoreChecks::PreCallValidateCreateRenderPass(VkDevice device, const VkRender
     }
 
     if (!skip) {
-        auto render_pass = std::unique_ptr<RENDER_PASS_STATE>(new RENDER_PASS_STATE(pCreateInfo));
-        skip |= ValidateCreateRenderPass(device, RENDER_PASS_VERSION_1, render_pass->createInfo.ptr(), render_pass.get());
+        // Build the state object (and its RenderPass2 conversion) once here; PostCallRecord shares it
+        create_render_pass_api_state *crp_state = reinterpret_cast<create_render_pass_api_state *>(crp_state_data);
+        crp_state->render_pass_state = std::shared_ptr<RENDER_PASS_STATE>(new RENDER_PASS_STATE(pCreateInfo));
+        skip |= ValidateCreateRenderPass(device, RENDER_PASS_VERSION_1, crp_state->render_pass_state->createInfo.ptr(),
+                                         crp_state->render_pass_state.get());
     }
 
     return skip;
@@ -10460,18 +11066,26 @@ void CoreChecks::RecordCreateRenderPassState(RenderPassCreateVersion rp_version,
 // construction or assignment.
 void CoreChecks::PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
-                                                VkResult result) {
+                                                VkResult result, void *crp_state_data) {
     if (VK_SUCCESS != result) return;
-    auto render_pass_state = std::make_shared<RENDER_PASS_STATE>(pCreateInfo);
-    RecordCreateRenderPassState(RENDER_PASS_VERSION_1, render_pass_state, pRenderPass);
+    create_render_pass_api_state *crp_state = reinterpret_cast<create_render_pass_api_state *>(crp_state_data);
+    if (!crp_state->render_pass_state) {
+        // Validation didn't get far enough to build the state object, so build it here
+        crp_state->render_pass_state = std::shared_ptr<RENDER_PASS_STATE>(new RENDER_PASS_STATE(pCreateInfo));
+    }
+    RecordCreateRenderPassState(RENDER_PASS_VERSION_1, crp_state->render_pass_state, pRenderPass);
 }
 
 void CoreChecks::PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR *pCreateInfo,
                                                     const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
-                                                    VkResult result) {
+                                                    VkResult result, void *crp_state_data) {
     if (VK_SUCCESS != result) return;
-    auto render_pass_state = std::make_shared<RENDER_PASS_STATE>(pCreateInfo);
-    RecordCreateRenderPassState(RENDER_PASS_VERSION_2, render_pass_state, pRenderPass);
+    create_render_pass_api_state *crp_state = reinterpret_cast<create_render_pass_api_state *>(crp_state_data);
+    if (!crp_state->render_pass_state) {
+        // Validation didn't get far enough to build the state object, so build it here
+        crp_state->render_pass_state = std::shared_ptr<RENDER_PASS_STATE>(new RENDER_PASS_STATE(pCreateInfo));
+    }
+    RecordCreateRenderPassState(RENDER_PASS_VERSION_2, crp_state->render_pass_state, pRenderPass);
 }
 
 static bool ValidateDepthStencilResolve(const debug_report_data *report_data,
@@ -10603,15 +11217,19 @@ static bool ValidateDepthStencilResolve(const debug_report_data *report_data,
 }
 
 bool CoreChecks::PreCallValidateCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR *pCreateInfo,
-                                                     const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) {
+                                                     const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass,
+                                                     void *crp_state_data) {
     bool skip = false;
 
     if (device_extensions.vk_khr_depth_stencil_resolve) {
         skip |= ValidateDepthStencilResolve(report_data, phys_dev_ext_props.depth_stencil_resolve_props, pCreateInfo);
     }
 
-    auto render_pass = std::make_shared<RENDER_PASS_STATE>(pCreateInfo);
-    skip |= ValidateCreateRenderPass(device, RENDER_PASS_VERSION_2, render_pass->createInfo.ptr(), render_pass.get());
+    // Build the state object once here; PostCallRecord shares it
+    create_render_pass_api_state *crp_state = reinterpret_cast<create_render_pass_api_state *>(crp_state_data);
+    crp_state->render_pass_state = std::shared_ptr<RENDER_PASS_STATE>(new RENDER_PASS_STATE(pCreateInfo));
+    skip |= ValidateCreateRenderPass(device, RENDER_PASS_VERSION_2, crp_state->render_pass_state->createInfo.ptr(),
+                                     crp_state->render_pass_state.get());
 
     return skip;
 }
@@ -10961,6 +11579,7 @@ void CoreChecks::RecordCmdBeginRenderPassState(VkCommandBuffer commandBuffer, co
     if (render_pass_state) {
         cb_state->activeFramebuffer = pRenderPassBegin->framebuffer;
         cb_state->activeRenderPass = render_pass_state;
+        cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_RENDER_PASS);
         // This is a shallow copy as that is all that is needed for now
         cb_state->activeRenderPassBeginInfo = *pRenderPassBegin;
         cb_state->activeSubpass = 0;
@@ -11033,6 +11652,7 @@ bool CoreChecks::PreCallValidateCmdNextSubpass2KHR(VkCommandBuffer commandBuffer
 void CoreChecks::RecordCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     cb_state->activeSubpass++;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_RENDER_PASS);
     cb_state->activeSubpassContents = contents;
     TransitionSubpassLayouts(cb_state, cb_state->activeRenderPass, cb_state->activeSubpass,
                              GetFramebufferState(cb_state->activeRenderPassBeginInfo.framebuffer));
@@ -11095,6 +11715,7 @@ void CoreChecks::RecordCmdEndRenderPassState(VkCommandBuffer commandBuffer) {
     cb_state->activeRenderPass = nullptr;
     cb_state->activeSubpass = 0;
     cb_state->activeFramebuffer = VK_NULL_HANDLE;
+    cb_state->DirtyDrawState(VK_PIPELINE_BIND_POINT_GRAPHICS, CBDIRTY_RENDER_PASS);
 }
 
 void CoreChecks::PostCallRecordCmdEndRenderPass(VkCommandBuffer commandBuffer) { RecordCmdEndRenderPassState(commandBuffer); }
@@ -11135,7 +11756,7 @@ bool CoreChecks::ValidateFramebuffer(VkCommandBuffer primaryBuffer, const CMD_BU
 bool CoreChecks::ValidateSecondaryCommandBufferState(CMD_BUFFER_STATE *pCB, CMD_BUFFER_STATE *pSubCB) {
     bool skip = false;
     unordered_set<int> activeTypes;
-    if (!disabled.query_validation) {
+    if (!disabled.IsDisabled(kDisableBitQueryValidation)) {
         for (auto queryObject : pCB->activeQueries) {
             auto query_pool_state = GetQueryPoolState(queryObject.pool);
             if (query_pool_state) {
@@ -11202,9 +11823,31 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
         } else if (VK_COMMAND_BUFFER_LEVEL_SECONDARY == sub_cb_state->createInfo.level) {
             if (sub_cb_state->beginInfo.pInheritanceInfo != nullptr) {
                 auto secondary_rp_state = GetRenderPassState(sub_cb_state->beginInfo.pInheritanceInfo->renderPass);
-                if (cb_state->activeRenderPass &&
-                    !(sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                // The linkage checks below depend only on this secondary's recorded inheritance
+                // state (cache cleared on reset) and the primary's render pass / framebuffer, so a
+                // clean result for this (compat id, framebuffer) pair is still clean on re-execution
+                const RenderPassCompatId primary_rp_compat =
+                    cb_state->activeRenderPass ? cb_state->activeRenderPass->compat_id : RenderPassCompatId();
+                const VkFramebuffer primary_fb = cb_state->activeFramebuffer;
+                bool linkage_cached = false;
+                {
+                    // The chassis locks only the primary for this call, but a SIMULTANEOUS_USE
+                    // secondary may be executed from two primaries on two threads -- its cache is
+                    // only ever touched under its own recording lock
+                    std::lock_guard<std::mutex> sub_lock(sub_cb_state->recording_lock);
+                    for (const auto &entry : sub_cb_state->validated_execute_linkage) {
+                        if (entry.rp_compat == primary_rp_compat && entry.framebuffer == primary_fb) {
+                            linkage_cached = true;
+                            break;
+                        }
+                    }
+                }
+                bool linkage_skip = false;
+                if (!linkage_cached) {
+                    if (cb_state->activeRenderPass &&
+                        !(sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+                        linkage_skip |=
+                            log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                     HandleToUint64(pCommandBuffers[i]), "VUID-vkCmdExecuteCommands-pCommandBuffers-00096",
                                     "vkCmdExecuteCommands(): Secondary %s is executed within a %s "
                                     "instance scope, but the Secondary Command Buffer does not have the "
@@ -11212,31 +11855,39 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
                                     "the vkBeginCommandBuffer() was called.",
                                     report_data->FormatHandle(pCommandBuffers[i]).c_str(),
                                     report_data->FormatHandle(cb_state->activeRenderPass->renderPass).c_str());
-                } else if (!cb_state->activeRenderPass &&
-                           (sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                    } else if (!cb_state->activeRenderPass &&
+                               (sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+                        linkage_skip |=
+                            log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                     HandleToUint64(pCommandBuffers[i]), "VUID-vkCmdExecuteCommands-pCommandBuffers-00100",
                                     "vkCmdExecuteCommands(): Secondary %s is executed outside a render pass "
                                     "instance scope, but the Secondary Command Buffer does have the "
                                     "VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT set in VkCommandBufferBeginInfo::flags when "
                                     "the vkBeginCommandBuffer() was called.",
                                     report_data->FormatHandle(pCommandBuffers[i]).c_str());
-                } else if (cb_state->activeRenderPass &&
-                           (sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
-                    // Make sure render pass is compatible with parent command buffer pass if has continue
-                    if (cb_state->activeRenderPass->renderPass != secondary_rp_state->renderPass) {
-                        skip |= ValidateRenderPassCompatibility(
-                            "primary command buffer", cb_state->activeRenderPass, "secondary command buffer", secondary_rp_state,
-                            "vkCmdExecuteCommands()", "VUID-vkCmdExecuteCommands-pInheritanceInfo-00098");
-                    }
-                    //  If framebuffer for secondary CB is not NULL, then it must match active FB from primaryCB
-                    skip |=
-                        ValidateFramebuffer(commandBuffer, cb_state, pCommandBuffers[i], sub_cb_state, "vkCmdExecuteCommands()");
-                    if (!sub_cb_state->cmd_execute_commands_functions.empty()) {
-                        //  Inherit primary's activeFramebuffer and while running validate functions
-                        for (auto &function : sub_cb_state->cmd_execute_commands_functions) {
-                            skip |= function(cb_state, cb_state->activeFramebuffer);
+                    } else if (cb_state->activeRenderPass &&
+                               (sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
+                        // Make sure render pass is compatible with parent command buffer pass if has continue
+                        if (cb_state->activeRenderPass->renderPass != secondary_rp_state->renderPass) {
+                            linkage_skip |= ValidateRenderPassCompatibility(
+                                "primary command buffer", cb_state->activeRenderPass, "secondary command buffer",
+                                secondary_rp_state, "vkCmdExecuteCommands()", "VUID-vkCmdExecuteCommands-pInheritanceInfo-00098");
                         }
+                        //  If framebuffer for secondary CB is not NULL, then it must match active FB from primaryCB
+                        linkage_skip |= ValidateFramebuffer(commandBuffer, cb_state, pCommandBuffers[i], sub_cb_state,
+                                                            "vkCmdExecuteCommands()");
+                    }
+                    // Clean results are cached by the record hook, which runs under the
+                    // exclusive lock; validate only probes
+                    skip |= linkage_skip;
+                }
+                // These depend on wider primary state than the cache key covers, so always run them
+                if (cb_state->activeRenderPass &&
+                    (sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT) &&
+                    !sub_cb_state->cmd_execute_commands_functions.empty()) {
+                    //  Inherit primary's activeFramebuffer and while running validate functions
+                    for (auto &function : sub_cb_state->cmd_execute_commands_functions) {
+                        skip |= function(cb_state, cb_state->activeFramebuffer);
                     }
                 }
             }
@@ -11325,11 +11976,32 @@ bool CoreChecks::PreCallValidateCmdExecuteCommands(VkCommandBuffer commandBuffer
 void CoreChecks::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBuffersCount,
                                                  const VkCommandBuffer *pCommandBuffers) {
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
+    // All state on the primary may be trampled by the executed secondaries
+    cb_state->DirtyDrawState(CBDIRTY_ALL);
 
     CMD_BUFFER_STATE *sub_cb_state = NULL;
     for (uint32_t i = 0; i < commandBuffersCount; i++) {
         sub_cb_state = GetCBState(pCommandBuffers[i]);
         assert(sub_cb_state);
+        // Validation passed (or we wouldn't be recording), so remember this linkage as clean for
+        // the secondary -- see the cache probe in PreCallValidateCmdExecuteCommands
+        if (sub_cb_state->beginInfo.pInheritanceInfo != nullptr) {
+            const RenderPassCompatId primary_rp_compat =
+                cb_state->activeRenderPass ? cb_state->activeRenderPass->compat_id : RenderPassCompatId();
+            // The chassis lock covers only the primary; serialize against other primaries
+            // executing this same secondary on the secondary's own recording lock
+            std::lock_guard<std::mutex> sub_lock(sub_cb_state->recording_lock);
+            bool linkage_cached = false;
+            for (const auto &entry : sub_cb_state->validated_execute_linkage) {
+                if (entry.rp_compat == primary_rp_compat && entry.framebuffer == cb_state->activeFramebuffer) {
+                    linkage_cached = true;
+                    break;
+                }
+            }
+            if (!linkage_cached) {
+                sub_cb_state->validated_execute_linkage.push_back({primary_rp_compat, cb_state->activeFramebuffer});
+            }
+        }
         if (!(sub_cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)) {
             if (cb_state->beginInfo.flags & VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT) {
                 // TODO: Because this is a state change, clearing the VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT needs to be moved
@@ -11345,7 +12017,7 @@ void CoreChecks::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer,
             if (!image_state) continue;  // Can't set layouts of a dead image
 
             auto *cb_subres_map = GetImageSubresourceLayoutMap(cb_state, *image_state);
-            const auto *sub_cb_subres_map = sub_layout_map_entry.second.get();
+            const auto *sub_cb_subres_map = sub_layout_map_entry.second;
             assert(cb_subres_map && sub_cb_subres_map);  // Non const get and map traversal should never be null
             cb_subres_map->UpdateFrom(*sub_cb_subres_map);
         }
@@ -11353,12 +12025,8 @@ void CoreChecks::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffer,
         sub_cb_state->primaryCommandBuffer = cb_state->commandBuffer;
         cb_state->linkedCommandBuffers.insert(sub_cb_state);
         sub_cb_state->linkedCommandBuffers.insert(cb_state);
-        for (auto &function : sub_cb_state->queryUpdates) {
-            cb_state->queryUpdates.push_back(function);
-        }
-        for (auto &function : sub_cb_state->queue_submit_functions) {
-            cb_state->queue_submit_functions.push_back(function);
-        }
+        cb_state->queryUpdates.insert(cb_state->queryUpdates.end(), sub_cb_state->queryUpdates.begin(),
+                                      sub_cb_state->queryUpdates.end());
     }
 }
 
@@ -12019,6 +12687,7 @@ void CoreChecks::PostCallRecordCreateSemaphore(VkDevice device, const VkSemaphor
     semaphore_state->signaler.second = 0;
     semaphore_state->signaled = false;
     semaphore_state->scope = kSyncScopeInternal;
+    if (wrap_handles) semaphore_slot_table.Insert(*pSemaphore, semaphore_state.get());
     semaphoreMap[*pSemaphore] = std::move(semaphore_state);
 }
 
@@ -12555,16 +13224,6 @@ void CoreChecks::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKH
     if (swapchain_data) {
         if (swapchain_data->images.size() > 0) {
             for (auto swapchain_image : swapchain_data->images) {
-                auto image_sub = imageSubresourceMap.find(swapchain_image);
-                if (image_sub != imageSubresourceMap.end()) {
-                    for (auto imgsubpair : image_sub->second) {
-                        auto image_item = imageLayoutMap.find(imgsubpair);
-                        if (image_item != imageLayoutMap.end()) {
-                            imageLayoutMap.erase(image_item);
-                        }
-                    }
-                    imageSubresourceMap.erase(image_sub);
-                }
                 ClearMemoryObjectBindings(VulkanTypedHandle(swapchain_image, kVulkanObjectTypeImage));
                 EraseQFOImageRelaseBarriers(swapchain_image);
                 imageMap.erase(swapchain_image);
@@ -12617,10 +13276,8 @@ void CoreChecks::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchai
         for (uint32_t i = 0; i < *pSwapchainImageCount; ++i) {
             if (swapchain_state->images[i] != VK_NULL_HANDLE) continue;  // Already retrieved this.
 
-            IMAGE_LAYOUT_STATE image_layout_node;
-            image_layout_node.layout = VK_IMAGE_LAYOUT_UNDEFINED;
-            image_layout_node.format = swapchain_state->createInfo.imageFormat;
-            // Add imageMap entries for each swapchain image
+            // Add imageMap entries for each swapchain image; the zero-initialized createInfo
+            // leaves the whole-image layout at VK_IMAGE_LAYOUT_UNDEFINED
             VkImageCreateInfo image_ci = {};
             image_ci.flags = 0;
             image_ci.imageType = VK_IMAGE_TYPE_2D;
@@ -12639,9 +13296,6 @@ void CoreChecks::PostCallRecordGetSwapchainImagesKHR(VkDevice device, VkSwapchai
             image_state->valid = false;
             image_state->binding.mem = MEMTRACKER_SWAP_CHAIN_IMAGE_KEY;
             swapchain_state->images[i] = pSwapchainImages[i];
-            ImageSubresourcePair subpair = {pSwapchainImages[i], false, VkImageSubresource()};
-            imageSubresourceMap[pSwapchainImages[i]].push_back(subpair);
-            imageLayoutMap[subpair] = image_layout_node;
         }
     }
 
@@ -12670,25 +13324,42 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
     for (uint32_t i = 0; i < pPresentInfo->swapchainCount; ++i) {
         auto swapchain_data = GetSwapchainState(pPresentInfo->pSwapchains[i]);
         if (swapchain_data) {
-            if (pPresentInfo->pImageIndices[i] >= swapchain_data->images.size()) {
-                skip |=
+            const uint32_t image_index = pPresentInfo->pImageIndices[i];
+
+            // Steady-state fast path: this (swapchain, image) pair validated cleanly for this queue
+            // family before, the image has been re-acquired, and its layout state is unchanged since
+            // that validation, so none of the checks below can fire.  The watermark is invalidated
+            // when new surface support data is recorded (see PostCallRecordGetPhysicalDeviceSurfaceSupportKHR).
+            if ((swapchain_data->present_clean_queue_family == queue_state->queueFamilyIndex) &&
+                (image_index < swapchain_data->present_clean_generations.size())) {
+                const auto *image_state = GetImageState(swapchain_data->images[image_index]);
+                if (image_state && image_state->acquired && !image_state->shared_presentable &&
+                    (swapchain_data->present_clean_generations[image_index] == image_state->layout_generation + 1)) {
+                    continue;
+                }
+            }
+
+            bool element_skip = false;
+            IMAGE_STATE *image_state = nullptr;
+            if (image_index >= swapchain_data->images.size()) {
+                element_skip |=
                     log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
                             HandleToUint64(pPresentInfo->pSwapchains[i]), kVUID_Core_DrawState_SwapchainInvalidImage,
                             "vkQueuePresentKHR: Swapchain image index too large (%u). There are only %u images in this swapchain.",
-                            pPresentInfo->pImageIndices[i], (uint32_t)swapchain_data->images.size());
+                            image_index, (uint32_t)swapchain_data->images.size());
             } else {
-                auto image = swapchain_data->images[pPresentInfo->pImageIndices[i]];
-                auto image_state = GetImageState(image);
+                auto image = swapchain_data->images[image_index];
+                image_state = GetImageState(image);
 
                 if (image_state->shared_presentable) {
                     image_state->layout_locked = true;
                 }
 
                 if (!image_state->acquired) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
+                    element_skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
                                     HandleToUint64(pPresentInfo->pSwapchains[i]), kVUID_Core_DrawState_SwapchainImageNotAcquired,
                                     "vkQueuePresentKHR: Swapchain image index %u has not been acquired.",
-                                    pPresentInfo->pImageIndices[i]);
+                                    image_index);
                 }
 
                 vector<VkImageLayout> layouts;
@@ -12696,7 +13367,7 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
                     for (auto layout : layouts) {
                         if ((layout != VK_IMAGE_LAYOUT_PRESENT_SRC_KHR) && (!device_extensions.vk_khr_shared_presentable_image ||
                                                                             (layout != VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR))) {
-                            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUEUE_EXT,
+                            element_skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUEUE_EXT,
                                             HandleToUint64(queue), "VUID-VkPresentInfoKHR-pImageIndices-01296",
                                             "Images passed to present must be in layout VK_IMAGE_LAYOUT_PRESENT_SRC_KHR or "
                                             "VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR but is in %s.",
@@ -12713,15 +13384,29 @@ bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentIn
                 auto support_it = surface_state->gpu_queue_support.find({physical_device, queue_state->queueFamilyIndex});
 
                 if (support_it == surface_state->gpu_queue_support.end()) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
+                    element_skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
                                     HandleToUint64(pPresentInfo->pSwapchains[i]), kVUID_Core_DrawState_SwapchainUnsupportedQueue,
                                     "vkQueuePresentKHR: Presenting image without calling vkGetPhysicalDeviceSurfaceSupportKHR");
                 } else if (!support_it->second) {
-                    skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
+                    element_skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
                                     HandleToUint64(pPresentInfo->pSwapchains[i]), "VUID-vkQueuePresentKHR-pSwapchains-01292",
                                     "vkQueuePresentKHR: Presenting image on queue that cannot present to this surface.");
                 }
             }
+
+            if (!element_skip && image_state && !image_state->shared_presentable) {
+                // Validated cleanly; record the watermark so steady-state repeats short-circuit
+                if (swapchain_data->present_clean_queue_family != queue_state->queueFamilyIndex) {
+                    // Watermarks recorded for another queue family don't cover this one's surface support
+                    swapchain_data->present_clean_generations.clear();
+                    swapchain_data->present_clean_queue_family = queue_state->queueFamilyIndex;
+                }
+                if (swapchain_data->present_clean_generations.size() < swapchain_data->images.size()) {
+                    swapchain_data->present_clean_generations.resize(swapchain_data->images.size(), 0);
+                }
+                swapchain_data->present_clean_generations[image_index] = image_state->layout_generation + 1;
+            }
+            skip |= element_skip;
         }
     }
     if (pPresentInfo && pPresentInfo->pNext) {
@@ -12799,8 +13484,9 @@ void CoreChecks::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInf
         if (swapchain_data && (swapchain_data->images.size() > pPresentInfo->pImageIndices[i])) {
             auto image = swapchain_data->images[pPresentInfo->pImageIndices[i]];
             auto image_state = GetImageState(image);
-            if (image_state) {
+            if (image_state && image_state->acquired) {
                 image_state->acquired = false;
+                swapchain_data->acquired_image_count--;
             }
         }
     }
@@ -12871,8 +13557,7 @@ bool CoreChecks::ValidateAcquireNextImage(VkDevice device, VkSwapchainKHR swapch
 
     auto physical_device_state = GetPhysicalDeviceState();
     if (physical_device_state->vkGetPhysicalDeviceSurfaceCapabilitiesKHRState != UNCALLED) {
-        uint64_t acquired_images = std::count_if(swapchain_data->images.begin(), swapchain_data->images.end(),
-                                                 [=](VkImage image) { return GetImageState(image)->acquired; });
+        const uint64_t acquired_images = swapchain_data->acquired_image_count;
         if (acquired_images > swapchain_data->images.size() - physical_device_state->surfaceCapabilities.minImageCount) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT,
                             HandleToUint64(swapchain), kVUID_Core_DrawState_SwapchainTooManyImages,
@@ -12933,6 +13618,7 @@ void ValidationStateTracker::RecordAcquireNextImageState(VkDevice device, VkSwap
         auto image = swapchain_data->images[*pImageIndex];
         auto image_state = GetImageState(image);
         if (image_state) {
+            if (!image_state->acquired) swapchain_data->acquired_image_count++;
             image_state->acquired = true;
             image_state->shared_presentable = swapchain_data->shared_presentable;
         }
@@ -13258,6 +13944,11 @@ void CoreChecks::PostCallRecordGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevi
     if (VK_SUCCESS != result) return;
     auto surface_state = GetSurfaceState(surface);
     surface_state->gpu_queue_support[{physicalDevice, queueFamilyIndex}] = (*pSupported == VK_TRUE);
+    // The present-loop fast path caches the surface support verdict; force a revalidation
+    if (surface_state->swapchain) {
+        surface_state->swapchain->present_clean_queue_family = VK_QUEUE_FAMILY_IGNORED;
+        surface_state->swapchain->present_clean_generations.clear();
+    }
 }
 
 void CoreChecks::PostCallRecordGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface,
@@ -13478,6 +14169,8 @@ void ValidationStateTracker::RecordCreateDescriptorUpdateTemplateState(const VkD
                                                                        VkDescriptorUpdateTemplateKHR *pDescriptorUpdateTemplate) {
     safe_VkDescriptorUpdateTemplateCreateInfo *local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfo(pCreateInfo);
     std::unique_ptr<TEMPLATE_STATE> template_state(new TEMPLATE_STATE(*pDescriptorUpdateTemplate, local_create_info));
+    // Templates are immutable, so the decode work shared by every update call is done once here
+    cvdescriptorset::BuildTemplateDecodePlan(this, template_state.get());
     desc_template_map[*pDescriptorUpdateTemplate] = std::move(template_state);
 }
 
@@ -13753,7 +14446,7 @@ bool CoreChecks::PreCallValidateCmdDebugMarkerEndEXT(VkCommandBuffer commandBuff
 
 bool CoreChecks::PreCallValidateCmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                                         VkQueryControlFlags flags, uint32_t index) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
     QueryObject query_obj(queryPool, query, index);
@@ -13794,7 +14487,7 @@ void CoreChecks::PostCallRecordCmdBeginQueryIndexedEXT(VkCommandBuffer commandBu
 
 bool CoreChecks::PreCallValidateCmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
                                                       uint32_t index) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
     QueryObject query_obj = {queryPool, query, index};
     CMD_BUFFER_STATE *cb_state = GetCBState(commandBuffer);
     assert(cb_state);
@@ -13941,7 +14634,7 @@ bool CoreChecks::ValidateQueryRange(VkDevice device, VkQueryPool queryPool, uint
 
 bool CoreChecks::PreCallValidateResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
                                                   uint32_t queryCount) {
-    if (disabled.query_validation) return false;
+    if (disabled.IsDisabled(kDisableBitQueryValidation)) return false;
 
     bool skip = false;
 
@@ -13967,13 +14660,12 @@ void CoreChecks::PostCallRecordResetQueryPoolEXT(VkDevice device, VkQueryPool qu
     auto query_pool_it = queryPoolMap.find(queryPool);
     if (query_pool_it == queryPoolMap.end()) return;
 
-    // Reset the state of existing entries.
-    QueryObject query_obj{queryPool, 0};
+    // Reset the state of existing entries. The range is clamped to the pool rather than trusting
+    // the app -- there is no validate-side bounds check gating this hook.
+    if (firstQuery >= query_pool_it->second->createInfo.queryCount) return;
     const uint32_t max_query_count = std::min(queryCount, query_pool_it->second->createInfo.queryCount - firstQuery);
     for (uint32_t i = 0; i < max_query_count; ++i) {
-        query_obj.query = firstQuery + i;
-        auto query_it = queryToStateMap.find(query_obj);
-        if (query_it != queryToStateMap.end()) query_it->second = QUERYSTATE_RESET;
+        query_pool_it->second->query_states[firstQuery + i] = QUERYSTATE_RESET;
     }
 }
 
@@ -14001,11 +14693,13 @@ VkResult CoreChecks::CoreLayerCreateValidationCacheEXT(VkDevice device, const Vk
 
 void CoreChecks::CoreLayerDestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache,
                                                     const VkAllocationCallbacks *pAllocator) {
+    JoinDeferredSpirvValidation();
     delete CastFromHandle<ValidationCache *>(validationCache);
 }
 
 VkResult CoreChecks::CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t *pDataSize,
                                                         void *pData) {
+    JoinDeferredSpirvValidation();
     size_t inSize = *pDataSize;
     CastFromHandle<ValidationCache *>(validationCache)->Write(pDataSize, pData);
     return (pData && *pDataSize != inSize) ? VK_INCOMPLETE : VK_SUCCESS;
@@ -14013,6 +14707,7 @@ VkResult CoreChecks::CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValid
 
 VkResult CoreChecks::CoreLayerMergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount,
                                                        const VkValidationCacheEXT *pSrcCaches) {
+    JoinDeferredSpirvValidation();
     bool skip = false;
     auto dst = CastFromHandle<ValidationCache *>(dstCache);
     VkResult result = VK_SUCCESS;
@@ -14101,6 +14796,8 @@ bool CoreChecks::ValidateCmdDrawStrideWithBuffer(VkCommandBuffer commandBuffer,
 void PIPELINE_STATE::initGraphicsPipeline(ValidationStateTracker *state_data, const VkGraphicsPipelineCreateInfo *pCreateInfo,
                                           std::shared_ptr<RENDER_PASS_STATE> &&rpstate) {
     reset();
+    // Deep-copy the create-info chain out of the pipeline's arena rather than one heap allocation per member
+    safe_struct_arena_scope arena_scope(&create_info_arena);
     bool uses_color_attachment = false;
     bool uses_depthstencil_attachment = false;
     if (pCreateInfo->subpass < rpstate->createInfo.subpassCount) {
@@ -14157,6 +14854,7 @@ void PIPELINE_STATE::initGraphicsPipeline(ValidationStateTracker *state_data, co
 
 void PIPELINE_STATE::initComputePipeline(ValidationStateTracker *state_data, const VkComputePipelineCreateInfo *pCreateInfo) {
     reset();
+    safe_struct_arena_scope arena_scope(&create_info_arena);
     computePipelineCI.initialize(pCreateInfo);
     switch (computePipelineCI.stage.stage) {
         case VK_SHADER_STAGE_COMPUTE_BIT:
@@ -14173,6 +14871,7 @@ void PIPELINE_STATE::initComputePipeline(ValidationStateTracker *state_data, con
 void PIPELINE_STATE::initRayTracingPipelineNV(ValidationStateTracker *state_data,
                                               const VkRayTracingPipelineCreateInfoNV *pCreateInfo) {
     reset();
+    safe_struct_arena_scope arena_scope(&create_info_arena);
     raytracingPipelineCI.initialize(pCreateInfo);
 
     stage_state.resize(pCreateInfo->stageCount);
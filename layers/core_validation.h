@@ -33,7 +33,9 @@
 #include "vk_typemap_helper.h"
 #include "vk_layer_data.h"
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
@@ -80,7 +82,9 @@ class QUEUE_STATE {
     VkQueue queue;
     uint32_t queueFamilyIndex;
     std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
-    std::map<QueryObject, QueryState> queryToStateMap;
+    // Pending query state from submissions that have not yet retired, consulted ahead of the
+    // per-pool state the retired submissions have been folded into
+    std::unordered_map<QueryObject, QueryState> queryToStateMap;
 
     uint64_t seq;
     std::deque<CB_SUBMISSION> submissions;
@@ -89,6 +93,8 @@ class QUEUE_STATE {
 class QUERY_POOL_STATE : public BASE_NODE {
    public:
     VkQueryPoolCreateInfo createInfo;
+    // Retired query state, one entry per slot in the pool
+    std::vector<QueryState> query_states;
 };
 
 struct PHYSICAL_DEVICE_STATE {
@@ -132,6 +138,12 @@ struct create_ray_tracing_pipeline_api_state {
     const VkRayTracingPipelineCreateInfoNV* pCreateInfos;
 };
 
+// This structure is used to save the render pass state object (and its RenderPass2 conversion) across the
+// CreateRenderPass/CreateRenderPass2KHR down-chain API call, so it is built once and shared by reference
+struct create_render_pass_api_state {
+    std::shared_ptr<RENDER_PASS_STATE> render_pass_state;
+};
+
 // This structure is used modify parameters for the CreatePipelineLayout down-chain API call
 struct create_pipeline_layout_api_state {
     std::vector<VkDescriptorSetLayout> new_layouts;
@@ -180,6 +192,44 @@ struct SURFACE_STATE {
 using std::unordered_map;
 struct GpuValidationState;
 
+// Slot-indexed fast path for state lookups hot enough that even a flat-map binary search shows
+// up -- currently semaphores and fences, which QueueSubmit probes for every wait/signal entry
+// across both its validate and record passes.  Because the handle-wrapping layer invents the
+// handle values, the low bits of a wrapped handle name the slot it occupies in the wrapping slot
+// map (vl_slot_map), so state can live in a dense table indexed directly by that slot.  Each
+// entry stores the full handle: a stale or recycled id fails the compare (its generation bits
+// differ) and falls back to the ordinary map lookup, as does everything when handle wrapping is
+// disabled and the table is never populated.  The slot space is shared across all handle types,
+// so the table is sized by the total number of live wrapped handles, not just the tracked type.
+// Mutation happens on create/destroy under the exclusive device lock, like the maps this fronts;
+// lookups run under at least the shared lock.
+template <typename HandleType, typename StateType>
+class VlSlotIndexedTable {
+  public:
+    void Insert(HandleType handle, StateType *state) {
+        const uint32_t slot = vl_slot_map::SlotOfId(HandleToUint64(handle));
+        if (slot >= entries_.size()) entries_.resize(slot + 1);
+        entries_[slot].handle = handle;
+        entries_[slot].state = state;
+    }
+    void Erase(HandleType handle) {
+        const uint32_t slot = vl_slot_map::SlotOfId(HandleToUint64(handle));
+        if ((slot < entries_.size()) && (entries_[slot].handle == handle)) entries_[slot] = Entry();
+    }
+    StateType *Find(HandleType handle) const {
+        const uint32_t slot = vl_slot_map::SlotOfId(HandleToUint64(handle));
+        if ((slot < entries_.size()) && (entries_[slot].handle == handle)) return entries_[slot].state;
+        return nullptr;
+    }
+
+  private:
+    struct Entry {
+        HandleType handle{};
+        StateType *state = nullptr;
+    };
+    std::vector<Entry> entries_;
+};
+
 #define VALSTATETRACK_MAP_AND_TRAITS_IMPL(handle_type, state_type, map_member, instance_scope)        \
     template <typename Dummy>                                                                         \
     struct AccessorStateHandle<state_type, Dummy> {                                                   \
@@ -200,16 +250,45 @@ struct GpuValidationState;
 
 class ValidationStateTracker : public ValidationObject {
    public:
+    // Record-phase calls on a command buffer hold the device lock shared and serialize on the target
+    // command buffer, so recording threads scale across command buffers.  The exclusive device lock
+    // remains reserved for handle create/destroy and other device-scope state updates.
+    CommandBufferWriteLock cb_write_lock(VkCommandBuffer commandBuffer) {
+        CommandBufferWriteLock lock;
+        lock.shared_lock = read_lock();
+        CMD_BUFFER_STATE* cb_state = GetCBState(commandBuffer);
+        if (cb_state) {
+            lock.cb_lock = std::unique_lock<std::mutex>(cb_state->recording_lock);
+        } else {
+            // Unknown command buffer -- fall back to the exclusive device lock
+            lock.shared_lock.unlock();
+            lock.exclusive_lock = write_lock();
+        }
+        return lock;
+    }
+
+    // Selective state tracking.  The record hooks unconditionally build state that only some check
+    // families read; each flag here answers "does any enabled check family read this state?" and is
+    // computed once at device creation from the check disables (ConfigureStateTrackingProfile), so
+    // the hot record paths can skip both the CPU and the memory for state nothing will consume.
+    struct StateTrackingProfile {
+        // Query pool state and the per-command-buffer/per-queue query bookkeeping
+        bool query_state = true;
+        // The cb_bindings/object_bindings cross references between command buffers and bound objects
+        bool command_buffer_bindings = true;
+    };
+    StateTrackingProfile state_tracking;
+    void ConfigureStateTrackingProfile();
+
     //  TODO -- move to private
     //  TODO -- make consistent with traits approach below.
     unordered_map<VkQueue, QUEUE_STATE> queueMap;
     unordered_map<VkEvent, EVENT_STATE> eventMap;
 
-    unordered_map<VkRenderPass, std::shared_ptr<RENDER_PASS_STATE>> renderPassMap;
-    unordered_map<VkDescriptorSetLayout, std::shared_ptr<cvdescriptorset::DescriptorSetLayout>> descriptorSetLayoutMap;
+    vl_flat_map<VkRenderPass, std::shared_ptr<RENDER_PASS_STATE>> renderPassMap;
+    vl_flat_map<VkDescriptorSetLayout, std::shared_ptr<cvdescriptorset::DescriptorSetLayout>> descriptorSetLayoutMap;
 
     std::unordered_set<VkQueue> queues;  // All queues under given device
-    std::map<QueryObject, QueryState> queryToStateMap;
     unordered_map<VkSamplerYcbcrConversion, uint64_t> ycbcr_conversion_ahb_fmt_map;
 
     // Traits for State function resolution.  Specializations defined in the macro.
@@ -226,7 +305,7 @@ class ValidationStateTracker : public ValidationObject {
         using HandleType = typename AccessorStateHandle<StateType>::HandleType;
         using ReturnType = StateType*;
         using MappedType = std::unique_ptr<StateType>;
-        using MapType = unordered_map<HandleType, MappedType>;
+        using MapType = vl_flat_map<HandleType, MappedType>;
     };
 
     VALSTATETRACK_MAP_AND_TRAITS(VkSampler, SAMPLER_STATE, samplerMap)
@@ -251,6 +330,11 @@ class ValidationStateTracker : public ValidationObject {
     VALSTATETRACK_MAP_AND_TRAITS(VkAccelerationStructureNV, ACCELERATION_STRUCTURE_STATE, accelerationStructureMap)
     VALSTATETRACK_MAP_AND_TRAITS_INSTANCE_SCOPE(VkSurfaceKHR, SURFACE_STATE, surface_map)
 
+    // Slot-indexed front for the semaphore and fence maps (see VlSlotIndexedTable); populated at
+    // create time when handle wrapping is active
+    VlSlotIndexedTable<VkSemaphore, SEMAPHORE_STATE> semaphore_slot_table;
+    VlSlotIndexedTable<VkFence, FENCE_STATE> fence_slot_table;
+
    public:
     template <typename State>
     typename AccessorTraits<State>::ReturnType Get(typename AccessorTraits<State>::Handle handle) {
@@ -321,12 +405,33 @@ class ValidationStateTracker : public ValidationObject {
         return Get<PIPELINE_LAYOUT_STATE>(pipeLayout);
     }
     PIPELINE_LAYOUT_STATE* GetPipelineLayout(VkPipelineLayout pipeLayout) { return Get<PIPELINE_LAYOUT_STATE>(pipeLayout); }
-    const FENCE_STATE* GetFenceState(VkFence fence) const { return Get<FENCE_STATE>(fence); }
-    FENCE_STATE* GetFenceState(VkFence fence) { return Get<FENCE_STATE>(fence); }
+    const FENCE_STATE* GetFenceState(VkFence fence) const {
+        FENCE_STATE* fast = fence_slot_table.Find(fence);
+        return fast ? fast : Get<FENCE_STATE>(fence);
+    }
+    FENCE_STATE* GetFenceState(VkFence fence) {
+        FENCE_STATE* fast = fence_slot_table.Find(fence);
+        return fast ? fast : Get<FENCE_STATE>(fence);
+    }
     const QUERY_POOL_STATE* GetQueryPoolState(VkQueryPool query_pool) const { return Get<QUERY_POOL_STATE>(query_pool); }
     QUERY_POOL_STATE* GetQueryPoolState(VkQueryPool query_pool) { return Get<QUERY_POOL_STATE>(query_pool); }
-    const SEMAPHORE_STATE* GetSemaphoreState(VkSemaphore semaphore) const { return Get<SEMAPHORE_STATE>(semaphore); }
-    SEMAPHORE_STATE* GetSemaphoreState(VkSemaphore semaphore) { return Get<SEMAPHORE_STATE>(semaphore); }
+    QueryState GetQueryPoolSlotState(VkQueryPool query_pool, uint32_t slot) const {
+        const auto* pool_state = GetQueryPoolState(query_pool);
+        if (pool_state && slot < pool_state->query_states.size()) return pool_state->query_states[slot];
+        return QUERYSTATE_UNKNOWN;
+    }
+    void SetQueryPoolSlotState(const QueryObject& query, QueryState state) {
+        auto* pool_state = GetQueryPoolState(query.pool);
+        if (pool_state && query.query < pool_state->query_states.size()) pool_state->query_states[query.query] = state;
+    }
+    const SEMAPHORE_STATE* GetSemaphoreState(VkSemaphore semaphore) const {
+        SEMAPHORE_STATE* fast = semaphore_slot_table.Find(semaphore);
+        return fast ? fast : Get<SEMAPHORE_STATE>(semaphore);
+    }
+    SEMAPHORE_STATE* GetSemaphoreState(VkSemaphore semaphore) {
+        SEMAPHORE_STATE* fast = semaphore_slot_table.Find(semaphore);
+        return fast ? fast : Get<SEMAPHORE_STATE>(semaphore);
+    }
     const ACCELERATION_STRUCTURE_STATE* GetAccelerationStructureState(VkAccelerationStructureNV as) const {
         return Get<ACCELERATION_STRUCTURE_STATE>(as);
     }
@@ -601,6 +706,7 @@ class ValidationStateTracker : public ValidationObject {
     void AddCommandBufferBindingBufferView(CMD_BUFFER_STATE*, BUFFER_VIEW_STATE*);
     void AddCommandBufferBindingImage(CMD_BUFFER_STATE*, IMAGE_STATE*);
     void AddCommandBufferBindingImageView(CMD_BUFFER_STATE*, IMAGE_VIEW_STATE*);
+    void AddCommandBufferBinding(BoundCommandBufferList* cb_bindings, const VulkanTypedHandle& obj, CMD_BUFFER_STATE* cb_node);
     void AddCommandBufferBindingSampler(CMD_BUFFER_STATE*, SAMPLER_STATE*);
     void AddMemObjInfo(void* object, const VkDeviceMemory mem, const VkMemoryAllocateInfo* pAllocateInfo);
     void AddFramebufferBinding(CMD_BUFFER_STATE* cb_state, FRAMEBUFFER_STATE* fb_state);
@@ -623,7 +729,9 @@ class ValidationStateTracker : public ValidationObject {
                                 VkMemoryRequirements mem_reqs, bool is_linear);
     void InsertMemoryRange(const VulkanTypedHandle& typed_handle, DEVICE_MEMORY_STATE* mem_info, VkDeviceSize memoryOffset,
                            VkMemoryRequirements memRequirements, bool is_linear);
+    void InvalidateCommandBuffer(CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& obj);
     void InvalidateCommandBuffers(std::unordered_set<CMD_BUFFER_STATE*> const& cb_nodes, const VulkanTypedHandle& obj);
+    void InvalidateCommandBuffers(const BoundCommandBufferList& cb_bindings, const VulkanTypedHandle& obj);
     void PerformAllocateDescriptorSets(const VkDescriptorSetAllocateInfo*, const VkDescriptorSet*,
                                        const cvdescriptorset::AllocateDescriptorSetsData*);
     void PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet, const TEMPLATE_STATE* template_state,
@@ -642,7 +750,6 @@ class ValidationStateTracker : public ValidationObject {
                                    PIPELINE_STATE::StageState* stage_state);
     void RecordVulkanSurface(VkSurfaceKHR* pSurface);
     void RemoveAccelerationStructureMemoryRange(uint64_t handle, DEVICE_MEMORY_STATE* mem_info);
-    void RemoveCommandBufferBinding(const VulkanTypedHandle& object, CMD_BUFFER_STATE* cb_node);
     void RemoveBufferMemoryRange(uint64_t handle, DEVICE_MEMORY_STATE* mem_info);
     void RemoveImageMemoryRange(uint64_t handle, DEVICE_MEMORY_STATE* mem_info);
     void ResetCommandBufferState(const VkCommandBuffer cb);
@@ -655,11 +762,15 @@ class ValidationStateTracker : public ValidationObject {
                                        const PIPELINE_LAYOUT_STATE* pipeline_layout, uint32_t first_set, uint32_t set_count,
                                        const std::vector<cvdescriptorset::DescriptorSet*> descriptor_sets,
                                        uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets);
-    void UpdateStateCmdDrawDispatchType(CMD_BUFFER_STATE* cb_state, VkPipelineBindPoint bind_point);
-    void UpdateStateCmdDrawType(CMD_BUFFER_STATE* cb_state, VkPipelineBindPoint bind_point);
-    void UpdateDrawState(CMD_BUFFER_STATE* cb_state, const VkPipelineBindPoint bind_point);
+    void UpdateStateCmdDrawDispatchType(CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, VkPipelineBindPoint bind_point);
+    void UpdateStateCmdDrawType(CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, VkPipelineBindPoint bind_point);
+    void UpdateDrawState(CMD_BUFFER_STATE* cb_state, CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point);
 
     DeviceFeatures enabled_features = {};
+    // Monotonic count of object invalidation events (object destruction, non-after-bind descriptor
+    // set updates, ...), bumped by InvalidateCommandBuffers().  Caches holding object pointers or
+    // handles across calls compare against it to detect that a referenced object may be gone.
+    uint64_t object_invalidate_count = 1;
     // Device specific data
     VkPhysicalDeviceMemoryProperties phys_dev_mem_props = {};
     VkPhysicalDeviceProperties phys_dev_props = {};
@@ -700,18 +811,141 @@ class ValidationStateTracker : public ValidationObject {
     bool external_sync_warning = false;
 };
 
+// Optional per-check telemetry (the khronos_validation.check_telemetry setting).  Instrumented
+// hot check sites count invocations and failures and sample their wall-clock cost, and log_msg
+// tallies every fired VUID (debug_report_data::vuid_hit_counts); DumpCheckTelemetry emits both as
+// a ranked report at vkDestroyDevice so hot checks can be identified without a profiler attached.
+struct CheckTelemetry {
+    bool enabled = false;
+    // Cost is only sampled on every kSampleInterval-th invocation of a site, keeping the clock
+    // reads out of the steady-state path
+    static const uint32_t kSampleInterval = 64;
+    enum CheckSite {
+        kValidateCmdBufDrawState = 0,
+        kValidateImageBarrierImage,
+        kValidateBarriers,
+        kCheckSiteCount,
+    };
+    struct SiteStats {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> fails{0};
+        std::atomic<uint64_t> sampled_ns{0};
+        std::atomic<uint64_t> samples{0};
+    };
+    SiteStats sites[kCheckSiteCount];
+    static const char *SiteName(uint32_t site);
+};
+
+// RAII sampler for one invocation of an instrumented check site.  Construct it at the top of the
+// check with a reference to the function's skip/result local; the destructor records whether the
+// check fired and, on sampled invocations, how long it ran.
+class ScopedCheckSample {
+   public:
+    ScopedCheckSample(CheckTelemetry &telemetry, CheckTelemetry::CheckSite site, const bool &fired)
+        : stats_(nullptr), fired_(fired), sampling_(false) {
+        if (!telemetry.enabled) return;
+        stats_ = &telemetry.sites[site];
+        if ((stats_->calls.fetch_add(1, std::memory_order_relaxed) % CheckTelemetry::kSampleInterval) == 0) {
+            sampling_ = true;
+            start_ = std::chrono::high_resolution_clock::now();
+        }
+    }
+    ~ScopedCheckSample() {
+        if (!stats_) return;
+        if (fired_) stats_->fails.fetch_add(1, std::memory_order_relaxed);
+        if (sampling_) {
+            const auto ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start_).count();
+            stats_->sampled_ns.fetch_add(static_cast<uint64_t>(ns), std::memory_order_relaxed);
+            stats_->samples.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+   private:
+    CheckTelemetry::SiteStats *stats_;
+    const bool &fired_;
+    bool sampling_;
+    std::chrono::high_resolution_clock::time_point start_;
+};
+
 class CoreChecks : public ValidationStateTracker {
    public:
     using StateTracker = ValidationStateTracker;
     std::unordered_set<uint64_t> ahb_ext_formats_set;
     GlobalQFOTransferBarrierMap<VkImageMemoryBarrier> qfo_release_image_barrier_map;
     GlobalQFOTransferBarrierMap<VkBufferMemoryBarrier> qfo_release_buffer_barrier_map;
-    unordered_map<VkImage, std::vector<ImageSubresourcePair>> imageSubresourceMap;
+    // Scratch map type for per-submit layout overlays; the authoritative layouts live densely
+    // on each IMAGE_STATE (global_layouts / whole_image_layout)
     using ImageSubresPairLayoutMap = std::unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_STATE>;
-    ImageSubresPairLayoutMap imageLayoutMap;
 
     std::unique_ptr<GpuValidationState> gpu_validation_state;
 
+    // Lazily populated cache of vkGetPhysicalDeviceFormatProperties results.  Format properties
+    // are immutable for a physical device, so the first query of each core (dense-range) format
+    // pays the ICD round-trip and every later one is a local array read.  Extension format
+    // values are sparse and rare in these paths; they query the ICD directly.
+    mutable std::array<VkFormatProperties, VK_FORMAT_RANGE_SIZE> format_properties_cache{};
+    mutable std::array<std::atomic<uint32_t>, VK_FORMAT_RANGE_SIZE> format_properties_cached{};
+    mutable std::mutex format_properties_cache_lock;
+
+    // Pairs of distinct render pass compatibility signatures that a full structural walk has
+    // already proven compatible (i.e. only normalization differed).  Keyed by the canonical
+    // compat def addresses, which are stable for the process lifetime (the dictionary is
+    // insert-only).  Incompatible pairs are never cached: their diagnostics carry per-call
+    // handles and caller names, so they must re-report on every use.
+    using RenderPassCompatPair = std::pair<uintptr_t, uintptr_t>;
+    struct RenderPassCompatPairHash {
+        size_t operator()(const RenderPassCompatPair& pair) const {
+            hash_util::HashCombiner hc;
+            hc << pair.first << pair.second;
+            return hc.Value();
+        }
+    };
+    mutable std::unordered_set<RenderPassCompatPair, RenderPassCompatPairHash> render_pass_compat_cache;
+    mutable std::mutex render_pass_compat_cache_lock;
+
+    // Clean whole-pipeline validation verdicts, keyed by a hash of the canonicalized graphics
+    // create info -- an analog of VkPipelineCache for validation results.  Per device, because
+    // which checks fire depends on this device's enabled features, extensions and format
+    // properties: a verdict earned on a capable device must not suppress errors on a less
+    // capable one in the same process.  The canonical ids folded into the key are process-local,
+    // so the cache is in-memory only; it cannot be persisted to disk the way the shader
+    // validation cache is.
+    mutable std::unordered_set<uint64_t> pipeline_validation_verdicts;
+    mutable std::mutex pipeline_validation_verdict_lock;
+
+    // Result of a spirv-val run offloaded to the worker queue (enabled.deferred_shader_validation).
+    // Outstanding results are joined -- and their diagnostics reported -- before they can become
+    // observable: pipeline creation, validation cache teardown/serialization, and device destruction.
+    struct DeferredSpirvValResult {
+        bool failed = false;
+        bool warning = false;
+        std::string error;
+        uint32_t hash = 0;               // ValidationCache entry to insert on success, when a cache was supplied
+        ValidationCache* cache = nullptr;
+        ValidationCache* disk_cache = nullptr;
+    };
+    std::mutex deferred_spirv_val_lock;
+    std::vector<std::future<DeferredSpirvValResult>> deferred_spirv_val_results;
+    // Held across a join drain so a concurrent joiner cannot return while results swapped out
+    // by another thread are still being collected -- see JoinDeferredSpirvValidation()
+    std::mutex deferred_spirv_val_join_lock;
+
+    // Disk-backed shader validation cache (khronos_validation.shader_validation_cache_path).  The
+    // on-disk file wraps a ValidationCache blob -- already keyed to the spirv-tools version -- in a
+    // small header that additionally keys it to the validator layout options in effect for this
+    // device, so warm launches skip spirv-val for modules that validated cleanly on a previous run.
+    // Probed and populated by every vkCreateShaderModule under the shared chassis lock;
+    // ValidationCache's internal mutex provides the exclusion.
+    ValidationCache* disk_shader_cache = nullptr;
+    std::string disk_shader_cache_path;
+
+    // Mutable because the instrumented check sites are const methods
+    mutable CheckTelemetry check_telemetry;
+    void InitCheckTelemetry();
+    void DumpCheckTelemetry();
+    void DumpMemoryAccounting();
+
     bool VerifyQueueStateToSeq(QUEUE_STATE* initial_queue, uint64_t initial_seq);
     bool ValidateSetMemBinding(VkDeviceMemory mem, const VulkanTypedHandle& typed_handle, const char* apiName) const;
     bool SetSparseMemBinding(MEM_BINDING binding, const VulkanTypedHandle& typed_handle);
@@ -730,6 +964,7 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateIdleDescriptorSet(VkDescriptorSet set, const char* func_str);
     void InitializeAndTrackMemory(VkDeviceMemory mem, VkDeviceSize offset, VkDeviceSize size, void** ppData);
     bool ValidatePipelineLocked(std::vector<std::unique_ptr<PIPELINE_STATE>> const& pPipelines, int pipelineIndex) const;
+    uint64_t HashGraphicsPipelineCI(const PIPELINE_STATE* pipeline) const;
     bool ValidatePipelineUnlocked(const PIPELINE_STATE* pPipeline, uint32_t pipelineIndex) const;
     bool ValidImageBufferQueue(const CMD_BUFFER_STATE* cb_node, const VulkanTypedHandle& object, VkQueue queue, uint32_t count,
                                const uint32_t* indices) const;
@@ -739,8 +974,13 @@ class CoreChecks : public ValidationStateTracker {
                                      std::unordered_set<VkSemaphore>* signaled_sema_arg,
                                      std::unordered_set<VkSemaphore>* internal_sema_arg) const;
     bool ValidateCommandBuffersForSubmit(VkQueue queue, const VkSubmitInfo* submit,
-                                         ImageSubresPairLayoutMap* localImageLayoutMap_arg,
-                                         std::vector<VkCommandBuffer>* current_cmds_arg) const;
+                                         ImageSubresPairLayoutMap* localImageLayoutMap_arg) const;
+    bool ValidateCommandBufferForSubmit(VkQueue queue, const CMD_BUFFER_STATE* pCB, int current_submit_count) const;
+    bool RunDeferredDrawChecks(const CMD_BUFFER_STATE* pCB) const;
+    bool ValidateQueuedQFOTransfersForSubmit(const CMD_BUFFER_STATE* pCB,
+                                             QFOTransferCBScoreboards<VkImageMemoryBarrier>* qfo_image_scoreboards,
+                                             QFOTransferCBScoreboards<VkBufferMemoryBarrier>* qfo_buffer_scoreboards) const;
+    bool RunSubmitTimeOp(VkQueue queue, const SUBMIT_TIME_OP& op) const;
     bool ValidateStatus(const CMD_BUFFER_STATE* pNode, CBStatusFlags status_mask, VkFlags msg_flags, const char* fail_msg,
                         const char* msg_code) const;
     bool ValidateDrawStateFlags(const CMD_BUFFER_STATE* pCB, const PIPELINE_STATE* pPipe, bool indexed, const char* msg_code) const;
@@ -761,8 +1001,14 @@ class CoreChecks : public ValidationStateTracker {
                                       const char* error_code) const;
     bool ValidateRenderPassCompatibility(const char* type1_string, const RENDER_PASS_STATE* rp1_state, const char* type2_string,
                                          const RENDER_PASS_STATE* rp2_state, const char* caller, const char* error_code) const;
-    bool ReportInvalidCommandBuffer(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
+    VL_COLD_ERROR_PATH bool ReportInvalidCommandBuffer(const CMD_BUFFER_STATE* cb_state, const char* call_source) const;
     void InitGpuValidation();
+    void InitDeferredShaderValidation();
+    void InitDeferredCbValidation();
+    void JoinDeferredSpirvValidation();
+    uint32_t DiskShaderCacheConfig() const;
+    void InitDiskShaderValidationCache();
+    void WriteDiskShaderValidationCache();
     bool ValidateQueueFamilyIndex(const PHYSICAL_DEVICE_STATE* pd_state, uint32_t requested_queue_family, const char* err_code,
                                   const char* cmd_name, const char* queue_family_var_name);
     bool ValidateDeviceQueueCreateInfos(const PHYSICAL_DEVICE_STATE* pd_state, uint32_t info_count,
@@ -798,12 +1044,13 @@ class CoreChecks : public ValidationStateTracker {
     void CopyNoncoherentMemoryFromDriver(uint32_t mem_range_count, const VkMappedMemoryRange* mem_ranges);
     bool ValidateMappedMemoryRangeDeviceLimits(const char* func_name, uint32_t mem_range_count,
                                                const VkMappedMemoryRange* mem_ranges);
-    BarrierOperationsType ComputeBarrierOperationsType(CMD_BUFFER_STATE* cb_state, uint32_t buffer_barrier_count,
+    BarrierOperationsType ComputeBarrierOperationsType(const COMMAND_POOL_STATE* pool, uint32_t buffer_barrier_count,
                                                        const VkBufferMemoryBarrier* buffer_barriers, uint32_t image_barrier_count,
                                                        const VkImageMemoryBarrier* image_barriers);
-    bool ValidateStageMasksAgainstQueueCapabilities(CMD_BUFFER_STATE const* cb_state, VkPipelineStageFlags source_stage_mask,
-                                                    VkPipelineStageFlags dest_stage_mask, BarrierOperationsType barrier_op_type,
-                                                    const char* function, const char* error_code);
+    bool ValidateStageMasksAgainstQueueCapabilities(CMD_BUFFER_STATE const* cb_state, const COMMAND_POOL_STATE* pool,
+                                                    VkPipelineStageFlags source_stage_mask, VkPipelineStageFlags dest_stage_mask,
+                                                    BarrierOperationsType barrier_op_type, const char* function,
+                                                    const char* error_code);
     bool SetEventStageMask(VkQueue queue, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask);
     bool ValidateRenderPassImageBarriers(const char* funcName, CMD_BUFFER_STATE* cb_state, uint32_t active_subpass,
                                          const safe_VkSubpassDescription2KHR& sub_desc, const VulkanTypedHandle& rp_handle,
@@ -909,6 +1156,8 @@ class CoreChecks : public ValidationStateTracker {
                                 const char* error_code) const;
     bool ValidateCmdQueueFlags(const CMD_BUFFER_STATE* cb_node, const char* caller_name, VkQueueFlags flags,
                                const char* error_code) const;
+    VL_COLD_ERROR_PATH bool ReportInvalidCmdQueueFlags(const CMD_BUFFER_STATE* cb_node, const char* caller_name,
+                                                       VkQueueFlags required_flags, const char* error_code) const;
     bool InsideRenderPass(const CMD_BUFFER_STATE* pCB, const char* apiName, const char* msgCode) const;
     bool OutsideRenderPass(const CMD_BUFFER_STATE* pCB, const char* apiName, const char* msgCode) const;
 
@@ -965,9 +1214,6 @@ class CoreChecks : public ValidationStateTracker {
     bool ValidateBarriersQFOTransferUniqueness(const char* func_name, CMD_BUFFER_STATE* cb_state, uint32_t bufferBarrierCount,
                                                const VkBufferMemoryBarrier* pBufferMemBarriers, uint32_t imageMemBarrierCount,
                                                const VkImageMemoryBarrier* pImageMemBarriers);
-    bool ValidatePrimaryCommandBufferState(const CMD_BUFFER_STATE* pCB, int current_submit_count,
-                                           QFOTransferCBScoreboards<VkImageMemoryBarrier>* qfo_image_scoreboards,
-                                           QFOTransferCBScoreboards<VkBufferMemoryBarrier>* qfo_buffer_scoreboards) const;
     bool ValidatePipelineDrawtimeState(const LAST_BOUND_STATE& state, const CMD_BUFFER_STATE* pCB, CMD_TYPE cmd_type,
                                        const PIPELINE_STATE* pPipeline, const char* caller) const;
     bool ValidateCmdBufDrawState(const CMD_BUFFER_STATE* cb_node, CMD_TYPE cmd_type, const bool indexed,
@@ -985,7 +1231,7 @@ class CoreChecks : public ValidationStateTracker {
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData);
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
-    bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const std::map<uint32_t, descriptor_req>& bindings,
+    bool ValidateDrawState(const cvdescriptorset::DescriptorSet* descriptor_set, const cvdescriptorset::BindingReqMap& bindings,
                            const std::vector<uint32_t>& dynamic_offsets, const CMD_BUFFER_STATE* cb_node, const char* caller,
                            std::string* error) const;
     // Validate contents of a CopyUpdate
@@ -1065,11 +1311,14 @@ class CoreChecks : public ValidationStateTracker {
     void GpuAllocateValidationResources(const VkCommandBuffer cmd_buffer, VkPipelineBindPoint bind_point);
     void AnalyzeAndReportError(CMD_BUFFER_STATE* cb_node, VkQueue queue, VkPipelineBindPoint bind_point, uint32_t operation_index,
                                uint32_t* const debug_output_buffer);
-    void ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE* cb_node);
     void UpdateInstrumentationBuffer(CMD_BUFFER_STATE* cb_node);
-    void SubmitBarrier(VkQueue queue);
+    void GpuPreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer);
     bool GpuInstrumentShader(const VkShaderModuleCreateInfo* pCreateInfo, std::vector<unsigned int>& new_pgm,
                              uint32_t* unique_shader_id);
+    bool GpuAcquireOutputBlock(GpuDeviceMemoryBlock* block);
+    void GpuReleaseOutputBlock(const GpuDeviceMemoryBlock& block);
+    void GpuGatherReadbackBlocks(CMD_BUFFER_STATE* cb_node, std::vector<GpuReadbackBlock>* blocks);
+    void GpuJoinPendingReadbacks();
     template <typename CreateInfo, typename SafeCreateInfo>
     void GpuPreCallRecordPipelineCreations(uint32_t count, const CreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator,
                                            VkPipeline* pPipelines, std::vector<std::unique_ptr<PIPELINE_STATE>>& pipe_state,
@@ -1125,6 +1374,10 @@ class CoreChecks : public ValidationStateTracker {
                                                               VkImage image, VkImageView image_view, VkFramebuffer framebuffer,
                                                               VkRenderPass renderpass, uint32_t attachment_index,
                                                               const char* variable_name);
+    bool ValidateRenderPassLayoutAgainstFramebufferImageUsage(RenderPassCreateVersion rp_version, VkImageLayout layout,
+                                                              const IMAGE_STATE* image_state, VkImageView image_view,
+                                                              VkFramebuffer framebuffer, VkRenderPass renderpass,
+                                                              uint32_t attachment_index, const char* variable_name);
     bool ValidateBufferImageCopyData(uint32_t regionCount, const VkBufferImageCopy* pRegions, IMAGE_STATE* image_state,
                                      const char* function);
     bool ValidateBufferViewRange(const BUFFER_STATE* buffer_state, const VkBufferViewCreateInfo* pCreateInfo,
@@ -1199,18 +1452,17 @@ class CoreChecks : public ValidationStateTracker {
                                                 const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount,
                                                 const VkImageSubresourceRange* pRanges);
 
-    bool FindLayoutVerifyLayout(ImageSubresourcePair imgpair, VkImageLayout& layout, const VkImageAspectFlags aspectMask);
 
-    bool FindGlobalLayout(ImageSubresourcePair imgpair, VkImageLayout& layout);
+    bool FindGlobalLayout(ImageSubresourcePair imgpair, VkImageLayout& layout) const;
 
-    bool FindLayouts(VkImage image, std::vector<VkImageLayout>& layouts);
+    bool FindLayouts(VkImage image, std::vector<VkImageLayout>& layouts) const;
 
     bool FindLayout(const ImageSubresPairLayoutMap& imageLayoutMap, ImageSubresourcePair imgpair, VkImageLayout& layout) const;
 
     static bool FindLayout(const ImageSubresPairLayoutMap& imageLayoutMap, ImageSubresourcePair imgpair, VkImageLayout& layout,
                            const VkImageAspectFlags aspectMask);
 
-    void SetGlobalLayout(ImageSubresourcePair imgpair, const VkImageLayout& layout);
+    bool SetGlobalLayout(ImageSubresourcePair imgpair, const VkImageLayout& layout);
 
     void SetImageViewLayout(CMD_BUFFER_STATE* cb_node, const IMAGE_VIEW_STATE& view_state, VkImageLayout layout);
     void SetImageViewInitialLayout(CMD_BUFFER_STATE* cb_node, const IMAGE_VIEW_STATE& view_state, VkImageLayout layout);
@@ -1266,8 +1518,8 @@ class CoreChecks : public ValidationStateTracker {
                                    VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions,
                                    VkFilter filter);
 
-    bool ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, const ImageSubresPairLayoutMap& globalImageLayoutMap,
-                                    ImageSubresPairLayoutMap* overlayLayoutMap_arg) const;
+    bool ValidateCmdBufImageLayouts(const CMD_BUFFER_STATE* pCB, ImageSubresPairLayoutMap* overlayLayoutMap_arg,
+                                    std::unordered_set<VkImage>* overlay_images_arg) const;
 
     void UpdateCmdBufImageLayouts(CMD_BUFFER_STATE* pCB);
 
@@ -1543,6 +1795,7 @@ class CoreChecks : public ValidationStateTracker {
                                              const VkCopyDescriptorSet* pDescriptorCopies);
     bool PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo);
     bool PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer);
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer);
     bool PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags);
     bool PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline);
     bool PreCallValidateCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
@@ -1681,14 +1934,18 @@ class CoreChecks : public ValidationStateTracker {
     bool PreCallValidateCreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                           const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer);
     bool PreCallValidateCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
-                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass);
+                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass,
+                                         void* crp_state_data);
     void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
-                                        const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result);
+                                        const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result,
+                                        void* crp_state_data);
     bool PreCallValidateGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory mem, VkDeviceSize* pCommittedMem);
     bool PreCallValidateCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo,
-                                             const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass);
+                                             const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass,
+                                             void* crp_state_data);
     void PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo,
-                                            const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result);
+                                            const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result,
+                                            void* crp_state_data);
     bool PreCallValidateCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
                                            VkSubpassContents contents);
     void PreCallRecordCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
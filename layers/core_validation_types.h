@@ -29,6 +29,8 @@
 #include "hash_vk_types.h"
 #include "sparse_containers.h"
 #include "vk_safe_struct.h"
+#include "vk_safe_struct_arena.h"
+#include "vk_layer_mem_accounting.h"
 #include "vulkan/vulkan.h"
 #include "vk_layer_logging.h"
 #include "vk_object_types.h"
@@ -36,13 +38,16 @@
 #include "vk_typemap_helper.h"
 #include "convert_to_renderpass2.h"
 #include "layer_chassis_dispatch.h"
+#include "shader_validation.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string.h>
 #include <unordered_map>
@@ -72,6 +77,99 @@ enum CALL_STATE {
     QUERY_DETAILS,  // Function called w/ a count to query details
 };
 
+// Serializes all manipulation of the cb_bindings lists below, which are reached concurrently from
+// multiple recording threads under per-command-buffer locking
+std::mutex &GetCommandBufferBindingLock();
+
+// Intrusive link tying one command buffer to one state object it references during recording.
+// Nodes are owned by the referencing command buffer's CbBindingPool and spliced into the bound
+// object's cb_bindings list, so creating a binding is a couple of pointer stores and resetting a
+// command buffer unlinks each of its nodes in O(1) with no hashing.  Callers must hold
+// GetCommandBufferBindingLock() around all link manipulation.
+struct CbBindingNode {
+    CMD_BUFFER_STATE *cb = nullptr;
+    CbBindingNode *next = nullptr;
+    CbBindingNode **pprev = nullptr;  // address of the link pointing at this node; null when unlinked
+    bool mem_binding = false;         // links the cb to a DEVICE_MEMORY_STATE (see ClearCmdBufAndMemReferences)
+};
+
+class BoundCommandBufferList {
+   public:
+    BoundCommandBufferList() = default;
+    // Copying would leave two lists claiming the same nodes
+    BoundCommandBufferList(const BoundCommandBufferList &) = delete;
+    BoundCommandBufferList &operator=(const BoundCommandBufferList &) = delete;
+
+    void Insert(CbBindingNode *node) {
+        node->next = head_;
+        node->pprev = &head_;
+        if (head_) head_->pprev = &node->next;
+        head_ = node;
+    }
+    static void Unlink(CbBindingNode *node) {
+        if (!node->pprev) return;  // already unlinked, e.g. because the bound object was destroyed first
+        *node->pprev = node->next;
+        if (node->next) node->next->pprev = node->pprev;
+        node->next = nullptr;
+        node->pprev = nullptr;
+    }
+    // Unlink every node belonging to the given command buffer
+    void Remove(CMD_BUFFER_STATE *cb) {
+        CbBindingNode *node = head_;
+        while (node) {
+            CbBindingNode *next = node->next;
+            if (node->cb == cb) Unlink(node);
+            node = next;
+        }
+    }
+    // Detach all nodes, e.g. when the object owning this list is destroyed.  The nodes remain in
+    // their command buffers' pools and are skipped when those command buffers are reset.
+    void BreakLinks() {
+        while (head_) Unlink(head_);
+    }
+    bool empty() const { return head_ == nullptr; }
+    CbBindingNode *head() const { return head_; }
+
+   private:
+    CbBindingNode *head_ = nullptr;
+};
+
+// Slab pool of binding link nodes owned by a single command buffer.  Nodes are handed back wholesale
+// when the command buffer is reset, so the slabs are reused across recordings instead of being
+// allocated and freed binding by binding.
+class CbBindingPool {
+   public:
+    CbBindingNode *Alloc(CMD_BUFFER_STATE *cb, bool mem_binding = false) {
+        if (used_ == slabs_.size() * kSlabSize) {
+            slabs_.emplace_back(new CbBindingNode[kSlabSize]);
+        }
+        CbBindingNode *node = &slabs_[used_ / kSlabSize][used_ % kSlabSize];
+        used_++;
+        node->cb = cb;
+        node->mem_binding = mem_binding;
+        return node;
+    }
+    // Unlink every node and return all of them to the pool; caller holds GetCommandBufferBindingLock()
+    void ReleaseAll() {
+        for (size_t i = 0; i < used_; i++) {
+            BoundCommandBufferList::Unlink(&slabs_[i / kSlabSize][i % kSlabSize]);
+        }
+        used_ = 0;
+    }
+    // Unlink just the memory-object links; the nodes stay allocated until the next full release
+    void ReleaseMemBindings() {
+        for (size_t i = 0; i < used_; i++) {
+            CbBindingNode *node = &slabs_[i / kSlabSize][i % kSlabSize];
+            if (node->mem_binding) BoundCommandBufferList::Unlink(node);
+        }
+    }
+
+   private:
+    static const size_t kSlabSize = 64;
+    std::vector<std::unique_ptr<CbBindingNode[]>> slabs_;
+    size_t used_ = 0;
+};
+
 class BASE_NODE {
    public:
     // Track when object is being used by an in-flight command buffer
@@ -80,9 +178,14 @@ class BASE_NODE {
     //  binding initialized when cmd referencing object is bound to command buffer
     //  binding removed when command buffer is reset or destroyed
     // When an object is destroyed, any bound cbs are set to INVALID
-    std::unordered_set<CMD_BUFFER_STATE *> cb_bindings;
+    BoundCommandBufferList cb_bindings;
 
     BASE_NODE() { in_use.store(0); };
+    ~BASE_NODE() {
+        // Detach any still-bound command buffers so their reset does not walk into freed memory
+        std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+        cb_bindings.BreakLinks();
+    }
 };
 
 // Track command pools and their command buffers
@@ -91,6 +194,11 @@ struct COMMAND_POOL_STATE : public BASE_NODE {
     uint32_t queueFamilyIndex;
     // Cmd buffers allocated from this pool
     std::unordered_set<VkCommandBuffer> commandBuffers;
+    // CMD_BUFFER_STATEs retired by vkFreeCommandBuffers, kept for reuse by the next allocation
+    // from this pool so their containers retain capacity instead of being torn down and
+    // reallocated every free/allocate cycle.  Bounded by the pool's peak command buffer count
+    // and released when the pool is destroyed.
+    std::vector<std::unique_ptr<CMD_BUFFER_STATE>> recycled_command_buffers;
 };
 
 // Utilities for barriers and the commmand pool
@@ -146,6 +254,47 @@ enum descriptor_req {
     DESCRIPTOR_REQ_COMPONENT_TYPE_UINT = DESCRIPTOR_REQ_COMPONENT_TYPE_SINT << 1,
 };
 
+// One descriptor set's shader-visible bindings and their requirements.  Stored as contiguous
+// (binding, requirements) records sorted by binding: the records are built once at pipeline
+// creation and only ever walked in order afterwards, so a flat sorted array keeps the per-draw
+// filtering cache-resident instead of chasing map nodes.
+typedef std::pair<uint32_t, descriptor_req> BindingReqPair;
+typedef std::vector<BindingReqPair> BindingReqVector;
+
+// Descriptor types are a tiny dense enum plus a couple of out-of-range extension values; fold them
+// onto a compact index so per-type descriptor accounting can be plain array arithmetic on the
+// vkAllocateDescriptorSets hot path instead of ordered-map probes.  The last slot absorbs any
+// other value: the type reaches here straight from app-supplied create infos, so an unknown enum
+// must land in a dedicated bucket rather than index past the per-type count arrays.
+static const uint32_t kNumDescriptorTypeIndices = VK_DESCRIPTOR_TYPE_RANGE_SIZE + 3;
+
+static inline uint32_t DescriptorTypeIndex(VkDescriptorType type) {
+    switch (type) {
+        case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+            return VK_DESCRIPTOR_TYPE_RANGE_SIZE;
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+            return VK_DESCRIPTOR_TYPE_RANGE_SIZE + 1;
+        default:
+            if (static_cast<uint32_t>(type) < VK_DESCRIPTOR_TYPE_RANGE_SIZE) {
+                return static_cast<uint32_t>(type);
+            }
+            return VK_DESCRIPTOR_TYPE_RANGE_SIZE + 2;
+    }
+}
+
+static inline VkDescriptorType DescriptorTypeFromIndex(uint32_t index) {
+    switch (index) {
+        case VK_DESCRIPTOR_TYPE_RANGE_SIZE:
+            return VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT;
+        case VK_DESCRIPTOR_TYPE_RANGE_SIZE + 1:
+            return VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV;
+        case VK_DESCRIPTOR_TYPE_RANGE_SIZE + 2:
+            return VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        default:
+            return static_cast<VkDescriptorType>(index);
+    }
+}
+
 struct DESCRIPTOR_POOL_STATE : BASE_NODE {
     VkDescriptorPool pool;
     uint32_t maxSets;        // Max descriptor sets allowed in this pool
@@ -153,19 +302,20 @@ struct DESCRIPTOR_POOL_STATE : BASE_NODE {
 
     safe_VkDescriptorPoolCreateInfo createInfo;
     std::unordered_set<cvdescriptorset::DescriptorSet *> sets;  // Collection of all sets in this pool
-    std::map<uint32_t, uint32_t> maxDescriptorTypeCount;        // Max # of descriptors of each type in this pool
-    std::map<uint32_t, uint32_t> availableDescriptorTypeCount;  // Available # of descriptors of each type in this pool
+    // Per-descriptor-type counts, indexed by DescriptorTypeIndex()
+    std::array<uint32_t, kNumDescriptorTypeIndices> maxDescriptorTypeCount;        // Max # of descriptors of each type in this pool
+    std::array<uint32_t, kNumDescriptorTypeIndices> availableDescriptorTypeCount;  // Available # of each type in this pool
 
     DESCRIPTOR_POOL_STATE(const VkDescriptorPool pool, const VkDescriptorPoolCreateInfo *pCreateInfo)
         : pool(pool),
           maxSets(pCreateInfo->maxSets),
           availableSets(pCreateInfo->maxSets),
           createInfo(pCreateInfo),
-          maxDescriptorTypeCount(),
-          availableDescriptorTypeCount() {
+          maxDescriptorTypeCount{},
+          availableDescriptorTypeCount{} {
         // Collect maximums per descriptor type.
         for (uint32_t i = 0; i < createInfo.poolSizeCount; ++i) {
-            uint32_t typeIndex = static_cast<uint32_t>(createInfo.pPoolSizes[i].type);
+            uint32_t typeIndex = DescriptorTypeIndex(createInfo.pPoolSizes[i].type);
             // Same descriptor types can appear several times
             maxDescriptorTypeCount[typeIndex] += createInfo.pPoolSizes[i].descriptorCount;
             availableDescriptorTypeCount[typeIndex] = maxDescriptorTypeCount[typeIndex];
@@ -276,14 +426,66 @@ class BUFFER_VIEW_STATE : public BASE_NODE {
     BUFFER_VIEW_STATE(const BUFFER_VIEW_STATE &rh_obj) = delete;
 };
 
+// Canonical sampler definition, following the DescriptorSetLayoutDef pattern.  Applications
+// commonly create thousands of structurally identical samplers; the create info (plus the chained
+// state that contributes to sampler identity) is interned once and shared by every SAMPLER_STATE
+// built from it, and equal canonical ids mean "created with identical parameters" in the sense
+// the spec uses for immutable sampler compatibility.
+class SamplerDef {
+   public:
+    SamplerDef(const VkSamplerCreateInfo *pci)
+        : createInfo(*pci), conversion(VK_NULL_HANDLE), reduction_mode(VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE_EXT) {
+        // The chain's contribution to identity is captured in the members below
+        createInfo.pNext = nullptr;
+        auto *conversion_info = lvl_find_in_chain<VkSamplerYcbcrConversionInfo>(pci->pNext);
+        if (conversion_info) conversion = conversion_info->conversion;
+        auto *reduction_info = lvl_find_in_chain<VkSamplerReductionModeCreateInfoEXT>(pci->pNext);
+        if (reduction_info) reduction_mode = reduction_info->reductionMode;
+        hash_util::HashCombiner hc;
+        hc << createInfo.flags << createInfo.magFilter << createInfo.minFilter << createInfo.mipmapMode
+           << createInfo.addressModeU << createInfo.addressModeV << createInfo.addressModeW << createInfo.mipLodBias
+           << createInfo.anisotropyEnable << createInfo.maxAnisotropy << createInfo.compareEnable << createInfo.compareOp
+           << createInfo.minLod << createInfo.maxLod << createInfo.borderColor << createInfo.unnormalizedCoordinates
+           << conversion << reduction_mode;
+        hash_ = hc.Value();
+    }
+    size_t hash() const { return hash_; }
+
+    VkSamplerCreateInfo createInfo;
+    VkSamplerYcbcrConversion conversion;
+    VkSamplerReductionModeEXT reduction_mode;
+
+   private:
+    size_t hash_;
+};
+
+static inline bool operator==(const SamplerDef &lhs, const SamplerDef &rhs) {
+    const VkSamplerCreateInfo &l = lhs.createInfo;
+    const VkSamplerCreateInfo &r = rhs.createInfo;
+    return (l.flags == r.flags) && (l.magFilter == r.magFilter) && (l.minFilter == r.minFilter) &&
+           (l.mipmapMode == r.mipmapMode) && (l.addressModeU == r.addressModeU) && (l.addressModeV == r.addressModeV) &&
+           (l.addressModeW == r.addressModeW) && (l.mipLodBias == r.mipLodBias) && (l.anisotropyEnable == r.anisotropyEnable) &&
+           (l.maxAnisotropy == r.maxAnisotropy) && (l.compareEnable == r.compareEnable) && (l.compareOp == r.compareOp) &&
+           (l.minLod == r.minLod) && (l.maxLod == r.maxLod) && (l.borderColor == r.borderColor) &&
+           (l.unnormalizedCoordinates == r.unnormalizedCoordinates) && (lhs.conversion == rhs.conversion) &&
+           (lhs.reduction_mode == rhs.reduction_mode);
+}
+
+using SamplerDict = hash_util::Dictionary<SamplerDef, hash_util::HasHashMember<SamplerDef>>;
+using SamplerDefId = SamplerDict::Id;
+SamplerDefId GetCanonicalSamplerId(const VkSamplerCreateInfo *pci);
+
 struct SAMPLER_STATE : public BASE_NODE {
     VkSampler sampler;
-    VkSamplerCreateInfo createInfo;
+    // Canonical definition shared by all samplers created with identical parameters; createInfo
+    // references its interned copy rather than storing one per handle
+    SamplerDefId sampler_def_id;
+    const VkSamplerCreateInfo &createInfo;
     VkSamplerYcbcrConversion samplerConversion = VK_NULL_HANDLE;
 
-    SAMPLER_STATE(const VkSampler *ps, const VkSamplerCreateInfo *pci) : sampler(*ps), createInfo(*pci) {
-        auto *conversionInfo = lvl_find_in_chain<VkSamplerYcbcrConversionInfo>(pci->pNext);
-        if (conversionInfo) samplerConversion = conversionInfo->conversion;
+    SAMPLER_STATE(const VkSampler *ps, const VkSamplerCreateInfo *pci)
+        : sampler(*ps), sampler_def_id(GetCanonicalSamplerId(pci)), createInfo(sampler_def_id->createInfo) {
+        samplerConversion = sampler_def_id->conversion;
     }
 };
 
@@ -302,6 +504,16 @@ class IMAGE_STATE : public BINDABLE {
     bool has_ahb_format;                 // True if image was created with an external Android format
     uint64_t ahb_format;                 // External Android format, if provided
     VkImageSubresourceRange full_range;  // The normalized ISR for all levels, layers (slices), and aspects
+    // Authoritative (submit-retired) per-subresource layouts, indexed densely in (aspect, mip
+    // level, array layer) order with aspects ordered by ascending bit position within
+    // full_range.aspectMask.  VK_IMAGE_LAYOUT_MAX_ENUM marks subresources that have never been
+    // individually transitioned; those hold whole_image_layout, which starts as the createInfo
+    // initialLayout.
+    std::vector<VkImageLayout> global_layouts;
+    VkImageLayout whole_image_layout;
+    // Bumped whenever a global layout value actually changes; lets submit-time validation
+    // watermark (command buffer, image) pairs whose reconciliation cannot have changed
+    uint64_t layout_generation = 0;
     VkSwapchainKHR create_from_swapchain;
     VkSwapchainKHR bind_swapchain;
     uint32_t bind_swapchain_imageIndex;
@@ -390,6 +602,12 @@ struct DEVICE_MEMORY_STATE : public BASE_NODE {
     VkExternalMemoryHandleTypeFlags export_handle_type_flags;
     std::unordered_set<VulkanTypedHandle> obj_bindings;       // objects bound to this memory
     std::unordered_map<uint64_t, MEMORY_RANGE> bound_ranges;  // Map of object to its binding range
+    // Bound ranges ordered by start offset, so overlap queries can visit just the window of
+    // candidate ranges instead of every binding in the allocation
+    std::multimap<VkDeviceSize, MEMORY_RANGE *> bound_range_starts;
+    // Size of the widest range ever bound here; bounds how far below a query window a candidate
+    // range can start.  Monotonic -- not shrunk on unbind, which only widens the window scanned.
+    VkDeviceSize widest_bound_range = 0;
     // Convenience vectors of handles to speed up iterating over objects independently
     std::unordered_set<uint64_t> bound_images;
     std::unordered_set<uint64_t> bound_buffers;
@@ -427,6 +645,16 @@ class SWAPCHAIN_NODE {
     bool shared_presentable = false;
     CALL_STATE vkGetSwapchainImagesKHRState = UNCALLED;
     uint32_t get_swapchain_image_count = 0;
+    // Number of images currently acquired by the app, maintained incrementally so
+    // vkAcquireNextImageKHR validation doesn't rescan every image state each frame
+    uint32_t acquired_image_count = 0;
+    // Present-loop fast path: the queue family the images below last validated cleanly for
+    // present on, and per image index the IMAGE_STATE::layout_generation of that clean
+    // validation (stored as generation + 1 so zero-initialized entries never match).  While
+    // the generation is unchanged and the image has been re-acquired, a repeat present of the
+    // same (swapchain, image) pair cannot produce different diagnostics.
+    uint32_t present_clean_queue_family = VK_QUEUE_FAMILY_IGNORED;
+    std::vector<uint64_t> present_clean_generations;
     SWAPCHAIN_NODE(const VkSwapchainCreateInfoKHR *pCreateInfo, VkSwapchainKHR swapchain)
         : createInfo(pCreateInfo), swapchain(swapchain) {}
 };
@@ -582,6 +810,7 @@ class ImageSubresourceLayoutMap {
     virtual const InitialLayoutState *GetSubresourceInitialLayoutState(const VkImageSubresource subresource) const = 0;
     virtual bool UpdateFrom(const ImageSubresourceLayoutMap &from) = 0;
     virtual uintptr_t CompatibilityKey() const = 0;
+    virtual uint64_t Version() const = 0;
     ImageSubresourceLayoutMap() {}
     virtual ~ImageSubresourceLayoutMap() {}
 };
@@ -592,8 +821,8 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
     typedef ImageSubresourceLayoutMap Base;
     typedef AspectTraits_ AspectTraits;
     typedef Base::SubresourceLayout SubresourceLayout;
-    typedef sparse_container::SparseVector<size_t, VkImageLayout, true, kInvalidLayout, kSparseThreshold> LayoutMap;
-    typedef sparse_container::SparseVector<size_t, VkImageLayout, false, kInvalidLayout, kSparseThreshold> InitialLayoutMap;
+    typedef sparse_container::RangeEncodedVector<size_t, VkImageLayout, true, kInvalidLayout> LayoutMap;
+    typedef sparse_container::RangeEncodedVector<size_t, VkImageLayout, false, kInvalidLayout> InitialLayoutMap;
 
     struct Layouts {
         LayoutMap current;
@@ -655,13 +884,19 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
 
         InitialLayoutState *initial_state = nullptr;
         const uint32_t end_mip = range.baseMipLevel + range.levelCount;
+        // When the range spans whole mip rows the encoded indices of consecutive mips are
+        // contiguous, so the per-aspect span collapses to a single run update
+        const bool whole_mip_rows = (0 == range.baseArrayLayer) && (range.layerCount == mip_size_);
         const auto &aspects = AspectTraits::AspectBits();
         for (uint32_t aspect_index = 0; aspect_index < AspectTraits::kAspectCount; aspect_index++) {
             if (0 == (range.aspectMask & aspects[aspect_index])) continue;
             size_t array_offset = Encode(aspect_index, range.baseMipLevel);
-            for (uint32_t mip_level = range.baseMipLevel; mip_level < end_mip; ++mip_level, array_offset += mip_size_) {
+            const size_t row_span = whole_mip_rows ? (end_mip - range.baseMipLevel) * mip_size_ : range.layerCount;
+            const size_t row_stride = whole_mip_rows ? row_span : mip_size_;
+            const uint32_t row_count = whole_mip_rows ? 1 : (end_mip - range.baseMipLevel);
+            for (uint32_t row = 0; row < row_count; ++row, array_offset += row_stride) {
                 size_t start = array_offset + range.baseArrayLayer;
-                size_t end = start + range.layerCount;
+                size_t end = start + row_span;
                 bool updated_level = layouts_.current.SetRange(start, end, layout);
                 if (updated_level) {
                     // We only need to try setting the initial layout, if we changed any of the layout values above
@@ -684,13 +919,17 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
 
         InitialLayoutState *initial_state = nullptr;
         const uint32_t end_mip = range.baseMipLevel + range.levelCount;
+        const bool whole_mip_rows = (0 == range.baseArrayLayer) && (range.layerCount == mip_size_);
         const auto &aspects = AspectTraits::AspectBits();
         for (uint32_t aspect_index = 0; aspect_index < AspectTraits::kAspectCount; aspect_index++) {
             if (0 == (range.aspectMask & aspects[aspect_index])) continue;
             size_t array_offset = Encode(aspect_index, range.baseMipLevel);
-            for (uint32_t mip_level = range.baseMipLevel; mip_level < end_mip; ++mip_level, array_offset += mip_size_) {
+            const size_t row_span = whole_mip_rows ? (end_mip - range.baseMipLevel) * mip_size_ : range.layerCount;
+            const size_t row_stride = whole_mip_rows ? row_span : mip_size_;
+            const uint32_t row_count = whole_mip_rows ? 1 : (end_mip - range.baseMipLevel);
+            for (uint32_t row = 0; row < row_count; ++row, array_offset += row_stride) {
                 size_t start = array_offset + range.baseArrayLayer;
-                size_t end = start + range.layerCount;
+                size_t end = start + row_span;
                 bool updated_level = layouts_.initial.SetRange(start, end, layout);
                 if (updated_level) {
                     updated = true;
@@ -723,18 +962,28 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
             aspect = aspects[aspect_index];  // noting that this and the following loop indices are references
             size_t array_offset = Encode(aspect_index, range.baseMipLevel);
             for (level = range.baseMipLevel; level < end_mip; ++level, array_offset += mip_size_) {
-                for (layer = range.baseArrayLayer; layer < end_layer; layer++) {
-                    // TODO -- would an interator with range check be faster?
-                    size_t index = array_offset + layer;
-                    VkImageLayout layout = layouts_.current.Get(index);
+                // Walk the row one run at a time; the layout values only need to be looked up at
+                // run boundaries, and fully invalid runs are skipped wholesale
+                size_t index = array_offset + range.baseArrayLayer;
+                const size_t row_end = array_offset + end_layer;
+                while (index < row_end) {
+                    const auto current_run = layouts_.current.GetRun(index);
+                    const VkImageLayout layout = current_run.value;
                     VkImageLayout initial_layout = kInvalidLayout;
+                    size_t run_end = std::min(current_run.end, row_end);
                     if (always_get_initial || (layout == kInvalidLayout)) {
-                        initial_layout = layouts_.initial.Get(index);
+                        const auto initial_run = layouts_.initial.GetRun(index);
+                        initial_layout = initial_run.value;
+                        run_end = std::min(run_end, initial_run.end);
                     }
-
                     if (!skip_invalid || (layout != kInvalidLayout) || (initial_layout != kInvalidLayout)) {
-                        keep_on = callback(subres, layout, initial_layout);
-                        if (!keep_on) return keep_on;  // False value from the callback aborts the range traversal
+                        for (; index < run_end; ++index) {
+                            layer = static_cast<uint32_t>(index - array_offset);
+                            keep_on = callback(subres, layout, initial_layout);
+                            if (!keep_on) return keep_on;  // False value from the callback aborts the range traversal
+                        }
+                    } else {
+                        index = run_end;
                     }
                 }
             }
@@ -762,6 +1011,8 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
         return layouts_.current.Get(index);
     }
 
+    uint64_t Version() const override { return version_; }
+
     // TODO: make sure this paranoia check is sufficient and not too much.
     uintptr_t CompatibilityKey() const override {
         return (reinterpret_cast<const uintptr_t>(&image_state_) ^ AspectTraits::AspectMask() ^ kSparseThreshold);
@@ -871,7 +1122,7 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
 
     typedef std::vector<std::unique_ptr<InitialLayoutState>> InitialLayoutStates;
     // This map *also* needs "write once" semantics
-    typedef sparse_container::SparseVector<size_t, InitialLayoutState *, false, nullptr, kSparseThreshold> InitialLayoutStateMap;
+    typedef sparse_container::RangeEncodedVector<size_t, InitialLayoutState *, false, nullptr> InitialLayoutStateMap;
 
     const IMAGE_STATE &image_state_;
     const size_t mip_size_;
@@ -883,6 +1134,58 @@ class ImageSubresourceLayoutMapImpl : public ImageSubresourceLayoutMap {
     std::array<size_t, AspectTraits::kAspectCount> aspect_offsets_;
 };
 
+// Per-command-buffer collection of per-image layout maps.  A recording typically touches a small
+// number of images, so the entries live in a flat array ordered by image handle -- lookups during
+// a render pass walk a couple of cache lines instead of probing an unordered_map -- and the map
+// objects themselves are carved from an arena whose blocks are rewound, not freed, when the
+// command buffer is reset, so re-recording allocates nothing for the collection at steady state.
+class ImageLayoutMapCollection {
+   public:
+    using value_type = std::pair<VkImage, ImageSubresourceLayoutMap *>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    ImageLayoutMapCollection() : arena_(kArenaBlockSize, kVlMemCommandBufferState) {}
+    ~ImageLayoutMapCollection() { clear(); }
+    ImageLayoutMapCollection(const ImageLayoutMapCollection &) = delete;
+    ImageLayoutMapCollection &operator=(const ImageLayoutMapCollection &) = delete;
+
+    const_iterator begin() const { return entries_.begin(); }
+    const_iterator end() const { return entries_.end(); }
+    bool empty() const { return entries_.empty(); }
+    size_t size() const { return entries_.size(); }
+
+    ImageSubresourceLayoutMap *Find(VkImage image) const {
+        auto it = LowerBound(image);
+        return ((it != entries_.end()) && (it->first == image)) ? it->second : nullptr;
+    }
+
+    // Raw storage for a map object about to be Insert()ed; released wholesale on clear()
+    void *AllocFromArena(size_t size) { return arena_.Alloc(size); }
+    void Insert(VkImage image, ImageSubresourceLayoutMap *map) {
+        entries_.insert(LowerBound(image), value_type(image, map));
+    }
+
+    // Destroy the maps and rewind the arena; the blocks and the entry array's capacity are
+    // retained for the next recording
+    void clear() {
+        for (auto &entry : entries_) {
+            entry.second->~ImageSubresourceLayoutMap();
+        }
+        entries_.clear();
+        arena_.Rewind();
+    }
+
+   private:
+    std::vector<value_type>::const_iterator LowerBound(VkImage image) const {
+        return std::lower_bound(entries_.begin(), entries_.end(), image, [](const value_type &entry, VkImage value) {
+            return HandleToUint64(entry.first) < HandleToUint64(value);
+        });
+    }
+    enum : size_t { kArenaBlockSize = 4096 };
+    std::vector<value_type> entries_;
+    safe_struct_arena arena_;
+};
+
 static VkImageLayout NormalizeImageLayout(VkImageLayout layout, VkImageLayout non_normal, VkImageLayout normal) {
     return (layout == non_normal) ? normal : layout;
 }
@@ -948,15 +1251,118 @@ struct DAGNode {
     std::vector<uint32_t> next;
 };
 
+// Canonical "compatibility signature" for a render pass, in the spirit of the canonical
+// descriptor set layouts (cvdescriptorset::DescriptorSetLayoutDef).  It captures exactly the
+// state ValidateRenderPassCompatibility compares -- the referenced attachment indices of each
+// subpass, normalized the way the structural walk normalizes them, plus the flags, format, and
+// sample count of each attachment description.  Render passes are interned into a dictionary at
+// creation time, so two passes with the same canonical id are compatible by construction and
+// most compatibility checks reduce to a single id compare.
+class RenderPassCompatDef {
+   public:
+    RenderPassCompatDef(const VkRenderPassCreateInfo2KHR *ci) {
+        attachments_.resize(ci->attachmentCount);
+        for (uint32_t i = 0; i < ci->attachmentCount; i++) {
+            attachments_[i].flags = ci->pAttachments[i].flags;
+            attachments_[i].format = ci->pAttachments[i].format;
+            attachments_[i].samples = ci->pAttachments[i].samples;
+        }
+        subpasses_.resize(ci->subpassCount);
+        for (uint32_t i = 0; i < ci->subpassCount; i++) {
+            const VkSubpassDescription2KHR &subpass = ci->pSubpasses[i];
+            SubpassCompat &compat = subpasses_[i];
+            compat.input_attachments =
+                NormalizedReferences(subpass.pInputAttachments, subpass.inputAttachmentCount, ci->attachmentCount);
+            compat.color_attachments =
+                NormalizedReferences(subpass.pColorAttachments, subpass.colorAttachmentCount, ci->attachmentCount);
+            compat.resolve_attachments = NormalizedReferences(
+                subpass.pResolveAttachments, subpass.pResolveAttachments ? subpass.colorAttachmentCount : 0, ci->attachmentCount);
+            compat.depth_stencil_attachment =
+                subpass.pDepthStencilAttachment ? Normalize(subpass.pDepthStencilAttachment->attachment, ci->attachmentCount)
+                                                : VK_ATTACHMENT_UNUSED;
+        }
+        hash_util::HashCombiner hc;
+        for (const auto &attachment : attachments_) {
+            hc << attachment.flags << attachment.format << attachment.samples;
+        }
+        for (const auto &subpass : subpasses_) {
+            hc.Combine(subpass.input_attachments);
+            hc.Combine(subpass.color_attachments);
+            hc.Combine(subpass.resolve_attachments);
+            hc << subpass.depth_stencil_attachment;
+        }
+        hash_ = hc.Value();
+    }
+    size_t hash() const { return hash_; }
+    bool operator==(const RenderPassCompatDef &rhs) const {
+        return (hash_ == rhs.hash_) && (attachments_ == rhs.attachments_) && (subpasses_ == rhs.subpasses_);
+    }
+
+   private:
+    struct AttachmentCompat {
+        VkAttachmentDescriptionFlags flags;
+        VkFormat format;
+        VkSampleCountFlagBits samples;
+        bool operator==(const AttachmentCompat &rhs) const {
+            return (flags == rhs.flags) && (format == rhs.format) && (samples == rhs.samples);
+        }
+    };
+    struct SubpassCompat {
+        std::vector<uint32_t> input_attachments;
+        std::vector<uint32_t> color_attachments;
+        std::vector<uint32_t> resolve_attachments;
+        uint32_t depth_stencil_attachment;
+        bool operator==(const SubpassCompat &rhs) const {
+            return (input_attachments == rhs.input_attachments) && (color_attachments == rhs.color_attachments) &&
+                   (resolve_attachments == rhs.resolve_attachments) &&
+                   (depth_stencil_attachment == rhs.depth_stencil_attachment);
+        }
+    };
+
+    // Out-of-range indices compare as VK_ATTACHMENT_UNUSED in the structural walk, and trailing
+    // unused references are padded on the shorter side, so both normalizations preserve the
+    // "equal signature implies no diagnostics" property while improving deduplication.
+    static uint32_t Normalize(uint32_t attach, uint32_t attachment_count) {
+        return (attach < attachment_count) ? attach : VK_ATTACHMENT_UNUSED;
+    }
+    static std::vector<uint32_t> NormalizedReferences(const VkAttachmentReference2KHR *refs, uint32_t count,
+                                                      uint32_t attachment_count) {
+        std::vector<uint32_t> normalized;
+        normalized.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            normalized.push_back(Normalize(refs[i].attachment, attachment_count));
+        }
+        while (!normalized.empty() && (VK_ATTACHMENT_UNUSED == normalized.back())) {
+            normalized.pop_back();
+        }
+        return normalized;
+    }
+
+    std::vector<AttachmentCompat> attachments_;
+    std::vector<SubpassCompat> subpasses_;
+    size_t hash_ = 0;
+};
+
+using RenderPassCompatDict = hash_util::Dictionary<RenderPassCompatDef, hash_util::HasHashMember<RenderPassCompatDef>>;
+using RenderPassCompatId = RenderPassCompatDict::Id;
+RenderPassCompatId GetRenderPassCompatId(const VkRenderPassCreateInfo2KHR *ci);
+
 struct RENDER_PASS_STATE : public BASE_NODE {
+    VL_MEM_ACCOUNT_CLASS(kVlMemSafeStructs)
     VkRenderPass renderPass;
     safe_VkRenderPassCreateInfo2KHR createInfo;
+    RenderPassCompatId compat_id;
     std::vector<std::vector<uint32_t>> self_dependencies;
     std::vector<DAGNode> subpassToNode;
     std::unordered_map<uint32_t, bool> attachment_first_read;
 
-    RENDER_PASS_STATE(VkRenderPassCreateInfo2KHR const *pCreateInfo) : createInfo(pCreateInfo) {}
-    RENDER_PASS_STATE(VkRenderPassCreateInfo const *pCreateInfo) { ConvertVkRenderPassCreateInfoToV2KHR(pCreateInfo, &createInfo); }
+    RENDER_PASS_STATE(VkRenderPassCreateInfo2KHR const *pCreateInfo) : createInfo(pCreateInfo) {
+        compat_id = GetRenderPassCompatId(createInfo.ptr());
+    }
+    RENDER_PASS_STATE(VkRenderPassCreateInfo const *pCreateInfo) {
+        ConvertVkRenderPassCreateInfoToV2KHR(pCreateInfo, &createInfo);
+        compat_id = GetRenderPassCompatId(createInfo.ptr());
+    }
 };
 
 // Autogenerated as part of the vk_validation_error_message.h codegen
@@ -991,6 +1397,22 @@ enum CBStatusFlagBits {
     // clang-format on
 };
 
+// Draw Dirty -- categories of command buffer state revalidated at draw/dispatch time.  The record
+// hooks mark a category dirty when a command changes state in that category, and draw-time
+// validation skips categories unchanged since the last validated draw at the same bind point.
+typedef VkFlags CBDrawDirtyFlags;
+enum CBDrawDirtyFlagBits {
+    // clang-format off
+    CBDIRTY_NONE             = 0x00000000,
+    CBDIRTY_PIPELINE         = 0x00000001,   // Pipeline bound at this bind point has changed
+    CBDIRTY_DESCRIPTOR_SETS  = 0x00000002,   // Descriptor sets (re)bound, pushed, or updated after bind
+    CBDIRTY_DYNAMIC_STATE    = 0x00000004,   // Dynamic state has been set
+    CBDIRTY_VERTEX_INDEX     = 0x00000008,   // Vertex or index buffer bindings have changed
+    CBDIRTY_RENDER_PASS      = 0x00000010,   // Render pass instance begun, advanced or ended
+    CBDIRTY_ALL              = 0x0000001F,
+    // clang-format on
+};
+
 struct QueryObject {
     VkQueryPool pool;
     uint32_t query;
@@ -1141,20 +1563,12 @@ static inline bool CompatForSet(uint32_t set, const PIPELINE_LAYOUT_STATE *a, co
     return result;
 }
 
-// Shader typedefs needed to store StageStage below
-struct interface_var {
-    uint32_t id;
-    uint32_t type_id;
-    uint32_t offset;
-    bool is_patch;
-    bool is_block_member;
-    bool is_relaxed_precision;
-    // TODO: collect the name, too? Isn't required to be present.
-};
-typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+// interface_var and descriptor_slot_t needed by StageState below live in shader_validation.h,
+// alongside the module reflection tables built from them.
 
 class PIPELINE_STATE : public BASE_NODE {
    public:
+    VL_MEM_ACCOUNT_CLASS(kVlMemSafeStructs)
     struct StageState {
         std::unordered_set<uint32_t> accessible_ids;
         std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
@@ -1162,6 +1576,8 @@ class PIPELINE_STATE : public BASE_NODE {
     };
 
     VkPipeline pipeline;
+    // Backs the create-info deep copies below; declared before them so it outlives them on destruction
+    safe_struct_arena create_info_arena;
     safe_VkGraphicsPipelineCreateInfo graphicsPipelineCI;
     safe_VkComputePipelineCreateInfo computePipelineCI;
     safe_VkRayTracingPipelineCreateInfoNV raytracingPipelineCI;
@@ -1170,8 +1586,16 @@ class PIPELINE_STATE : public BASE_NODE {
     // Flag of which shader stages are active for this pipeline
     uint32_t active_shaders;
     uint32_t duplicate_shaders;
-    // Capture which slots (set#->bindings) are actually used by the shaders of this pipeline
-    std::unordered_map<uint32_t, std::map<uint32_t, descriptor_req>> active_slots;
+    // Capture which slots (set#->bindings) are actually used by the shaders of this pipeline,
+    // flattened into per-set records sorted by set index with each set's bindings in a sorted
+    // contiguous array; per-draw intersection with the bound sets is a linear merge over these
+    std::vector<std::pair<uint32_t, BindingReqVector>> active_slots;
+    bool UsesDescriptorSet(uint32_t set) const {
+        for (const auto &slot : active_slots) {
+            if (slot.first == set) return true;
+        }
+        return false;
+    }
     // Additional metadata needed by pipeline_state initialization and validation
     std::vector<StageState> stage_state;
     // Vtx input info (if any)
@@ -1186,6 +1610,7 @@ class PIPELINE_STATE : public BASE_NODE {
     // Default constructor
     PIPELINE_STATE()
         : pipeline{},
+          create_info_arena(),
           graphicsPipelineCI{},
           computePipelineCI{},
           raytracingPipelineCI{},
@@ -1319,6 +1744,21 @@ struct QFOTransferBarrier<VkImageMemoryBarrier> : public QFOTransferBarrierBase<
         // Ignoring layout w.r.t. equality. See comment in hash above.
         return (static_cast<BaseType>(*this) == static_cast<BaseType>(rhs)) && (subresourceRange == rhs.subresourceRange);
     }
+    bool operator<(const QFOTransferBarrier<BarrierType> &rhs) const {
+        // Layouts are excluded from the ordering, consistent with hash() and operator== above
+        if (handle != rhs.handle) return HandleToUint64(handle) < HandleToUint64(rhs.handle);
+        if (srcQueueFamilyIndex != rhs.srcQueueFamilyIndex) return srcQueueFamilyIndex < rhs.srcQueueFamilyIndex;
+        if (dstQueueFamilyIndex != rhs.dstQueueFamilyIndex) return dstQueueFamilyIndex < rhs.dstQueueFamilyIndex;
+        if (subresourceRange.aspectMask != rhs.subresourceRange.aspectMask)
+            return subresourceRange.aspectMask < rhs.subresourceRange.aspectMask;
+        if (subresourceRange.baseMipLevel != rhs.subresourceRange.baseMipLevel)
+            return subresourceRange.baseMipLevel < rhs.subresourceRange.baseMipLevel;
+        if (subresourceRange.levelCount != rhs.subresourceRange.levelCount)
+            return subresourceRange.levelCount < rhs.subresourceRange.levelCount;
+        if (subresourceRange.baseArrayLayer != rhs.subresourceRange.baseArrayLayer)
+            return subresourceRange.baseArrayLayer < rhs.subresourceRange.baseArrayLayer;
+        return subresourceRange.layerCount < rhs.subresourceRange.layerCount;
+    }
     // TODO: codegen a comprehensive complie time type -> string (and or other traits) template family
     static const char *BarrierName() { return "VkImageMemoryBarrier"; }
     static const char *HandleName() { return "VkImage"; }
@@ -1347,6 +1787,13 @@ struct QFOTransferBarrier<VkBufferMemoryBarrier> : public QFOTransferBarrierBase
     bool operator==(const QFOTransferBarrier<BarrierType> &rhs) const {
         return (static_cast<BaseType>(*this) == static_cast<BaseType>(rhs)) && (offset == rhs.offset) && (size == rhs.size);
     }
+    bool operator<(const QFOTransferBarrier<BarrierType> &rhs) const {
+        if (handle != rhs.handle) return HandleToUint64(handle) < HandleToUint64(rhs.handle);
+        if (srcQueueFamilyIndex != rhs.srcQueueFamilyIndex) return srcQueueFamilyIndex < rhs.srcQueueFamilyIndex;
+        if (dstQueueFamilyIndex != rhs.dstQueueFamilyIndex) return dstQueueFamilyIndex < rhs.dstQueueFamilyIndex;
+        if (offset != rhs.offset) return offset < rhs.offset;
+        return size < rhs.size;
+    }
     static const char *BarrierName() { return "VkBufferMemoryBarrier"; }
     static const char *HandleName() { return "VkBuffer"; }
     // UNASSIGNED-VkImageMemoryBarrier-buffer-00001 QFO transfer buffer barrier must not duplicate QFO recorded in command buffer
@@ -1362,9 +1809,38 @@ struct QFOTransferBarrier<VkBufferMemoryBarrier> : public QFOTransferBarrierBase
 template <typename Barrier>
 using QFOTransferBarrierHash = hash_util::HasHashMember<QFOTransferBarrier<Barrier>>;
 
-// Command buffers store the set of barriers recorded
+// Command buffers accumulate the barriers recorded into flat vectors kept sorted (see operator<
+// above), so the record-time duplicate check is a binary search over a contiguous span and
+// submit-time validation merges against the equally sorted pending-release spans instead of
+// doing a hash-set probe per barrier.
 template <typename Barrier>
-using QFOTransferBarrierSet = std::unordered_set<QFOTransferBarrier<Barrier>, QFOTransferBarrierHash<Barrier>>;
+using QFOTransferBarrierSet = std::vector<QFOTransferBarrier<Barrier>>;
+
+// Find an equal barrier in a sorted barrier span, or return null.
+template <typename Barrier>
+const QFOTransferBarrier<Barrier> *QFOBarrierFind(const QFOTransferBarrierSet<Barrier> &barriers,
+                                                  const QFOTransferBarrier<Barrier> &barrier) {
+    const auto pos = std::lower_bound(barriers.cbegin(), barriers.cend(), barrier);
+    return ((pos != barriers.cend()) && (*pos == barrier)) ? &(*pos) : nullptr;
+}
+
+// Insert a barrier into a sorted barrier span, preserving the order and the set semantics of the
+// storage.  Returns false if an equal barrier was already present.
+template <typename Barrier>
+bool QFOBarrierInsert(QFOTransferBarrierSet<Barrier> &barriers, const QFOTransferBarrier<Barrier> &barrier) {
+    const auto pos = std::lower_bound(barriers.begin(), barriers.end(), barrier);
+    if ((pos != barriers.end()) && (*pos == barrier)) return false;
+    barriers.insert(pos, barrier);
+    return true;
+}
+
+// Erase an equal barrier from a sorted barrier span, if present.
+template <typename Barrier>
+void QFOBarrierErase(QFOTransferBarrierSet<Barrier> &barriers, const QFOTransferBarrier<Barrier> &barrier) {
+    const auto pos = std::lower_bound(barriers.begin(), barriers.end(), barrier);
+    if ((pos != barriers.end()) && (*pos == barrier)) barriers.erase(pos);
+}
+
 template <typename Barrier>
 struct QFOTransferBarrierSets {
     QFOTransferBarrierSet<Barrier> release;
@@ -1375,7 +1851,7 @@ struct QFOTransferBarrierSets {
     }
 };
 
-// The layer_data stores the map of pending release barriers
+// The layer_data stores the pending release barriers per resource handle, as the same sorted spans
 template <typename Barrier>
 using GlobalQFOTransferBarrierMap =
     std::unordered_map<typename QFOTransferBarrier<Barrier>::HandleType, QFOTransferBarrierSet<Barrier>>;
@@ -1390,9 +1866,128 @@ struct QFOTransferCBScoreboards {
     QFOTransferCBScoreboard<Barrier> release;
 };
 
+// Submit-time replay record.  Recorded commands that need validation or state updates when their
+// command buffer is submitted used to enqueue one heap-allocated std::function closure each;
+// they now append one of these tagged PODs to the flat per-CB lists below, and
+// CoreChecks::RunSubmitTimeOp() switches on the tag at vkQueueSubmit time.
+struct SUBMIT_TIME_OP {
+    enum Type {
+        kSetEventStageMask,           // vkCmdSetEvent / vkCmdResetEvent
+        kValidateEventStageMask,      // vkCmdWaitEvents
+        kValidateBarrierQueueFamilies,// Barrier submit-queue-family check
+        kBeginQuery,                  // vkCmdBeginQuery: verify reset, mark RUNNING
+        kEndQuery,                    // vkCmdEndQuery: mark AVAILABLE
+        kResetQuery,                  // vkCmdResetQueryPool: mark RESET
+        kValidateQuery,               // vkCmdCopyQueryPoolResults
+        kWriteTimestamp,              // vkCmdWriteTimestamp: verify reset, mark AVAILABLE
+    };
+    Type type;
+    // The recording command buffer; kept per record because vkCmdExecuteCommands copies a
+    // secondary's query records into the primary's list
+    VkCommandBuffer command_buffer;
+    union {
+        struct {
+            VkEvent event;
+            VkPipelineStageFlags stage_mask;
+        } set_event;
+        struct {
+            uint32_t event_count;
+            size_t first_event_index;
+            VkPipelineStageFlags source_stage_mask;
+        } wait_events;
+        struct {
+            uint64_t barrier_handle;        // image or buffer; the type selects the VUID table
+            VulkanObjectType barrier_type;
+            VkSharingMode sharing_mode;
+            const char *func_name;          // string literal naming the recording command
+            uint32_t src_family;
+            uint32_t dst_family;
+        } barrier_families;
+        struct {
+            VkQueryPool pool;
+            uint32_t slot;
+        } query;
+        struct {
+            VkQueryPool pool;
+            uint32_t first_query;
+            uint32_t query_count;
+            VkQueryResultFlags flags;
+        } query_range;
+    };
+
+    static SUBMIT_TIME_OP SetEvent(VkCommandBuffer cb, VkEvent event, VkPipelineStageFlags stage_mask) {
+        SUBMIT_TIME_OP op = {};
+        op.type = kSetEventStageMask;
+        op.command_buffer = cb;
+        op.set_event.event = event;
+        op.set_event.stage_mask = stage_mask;
+        return op;
+    }
+    static SUBMIT_TIME_OP WaitEvents(VkCommandBuffer cb, uint32_t event_count, size_t first_event_index,
+                                     VkPipelineStageFlags source_stage_mask) {
+        SUBMIT_TIME_OP op = {};
+        op.type = kValidateEventStageMask;
+        op.command_buffer = cb;
+        op.wait_events.event_count = event_count;
+        op.wait_events.first_event_index = first_event_index;
+        op.wait_events.source_stage_mask = source_stage_mask;
+        return op;
+    }
+    static SUBMIT_TIME_OP BarrierQueueFamilies(VkCommandBuffer cb, const VulkanTypedHandle &barrier_handle,
+                                               VkSharingMode sharing_mode, const char *func_name, uint32_t src_family,
+                                               uint32_t dst_family) {
+        SUBMIT_TIME_OP op = {};
+        op.type = kValidateBarrierQueueFamilies;
+        op.command_buffer = cb;
+        op.barrier_families.barrier_handle = barrier_handle.handle;
+        op.barrier_families.barrier_type = barrier_handle.type;
+        op.barrier_families.sharing_mode = sharing_mode;
+        op.barrier_families.func_name = func_name;
+        op.barrier_families.src_family = src_family;
+        op.barrier_families.dst_family = dst_family;
+        return op;
+    }
+    static SUBMIT_TIME_OP Query(Type type, VkCommandBuffer cb, VkQueryPool pool, uint32_t slot) {
+        SUBMIT_TIME_OP op = {};
+        op.type = type;
+        op.command_buffer = cb;
+        op.query.pool = pool;
+        op.query.slot = slot;
+        return op;
+    }
+    static SUBMIT_TIME_OP QueryRange(VkCommandBuffer cb, VkQueryPool pool, uint32_t first_query, uint32_t query_count,
+                                     VkQueryResultFlags flags) {
+        SUBMIT_TIME_OP op = {};
+        op.type = kValidateQuery;
+        op.command_buffer = cb;
+        op.query_range.pool = pool;
+        op.query_range.first_query = first_query;
+        op.query_range.query_count = query_count;
+        op.query_range.flags = flags;
+        return op;
+    }
+};
+
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
+// One descriptor-set draw-state check captured at vkCmd* record time when
+// khronos_validation.deferred_cb_validation is set.  The capture is a few pointers into
+// already-tracked state plus the filtered binding requirements; the expensive descriptor walk
+// itself runs on the worker pool during vkQueueSubmit validation of the command buffer -- see
+// CoreChecks::RunDeferredDrawChecks().
+struct DeferredDrawCheck {
+    const cvdescriptorset::DescriptorSet *descriptor_set;
+    BindingReqVector binding_reqs;  // Filtered requirements at the captured draw
+    std::vector<uint32_t> dynamic_offsets;
+    uint32_t set_index;
+    const char *function;  // Entry point name (string literal)
+};
+
 struct CMD_BUFFER_STATE : public BASE_NODE {
+    VL_MEM_ACCOUNT_CLASS(kVlMemCommandBufferState)
     VkCommandBuffer commandBuffer;
+    // Serializes state recording into this command buffer when the chassis takes per-command-buffer
+    // locks -- see ValidationStateTracker::cb_write_lock()
+    std::mutex recording_lock;
     VkCommandBufferAllocateInfo createInfo = {};
     VkCommandBufferBeginInfo beginInfo;
     VkCommandBufferInheritanceInfo inheritanceInfo;
@@ -1402,6 +1997,8 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     bool hasDispatchCmd;
     CB_STATE state;        // Track cmd buffer update state
     uint64_t submitCount;  // Number of times CB has been submitted
+    uint64_t reset_count = 1;  // Incremented on every reset/implicit reset; guards caches that key
+                               // on this CMD_BUFFER_STATE across recordings
     typedef uint64_t ImageLayoutUpdateCount;
     ImageLayoutUpdateCount image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
     CBStatusFlags status;                              // Track status of various bindings on cmd buffer
@@ -1413,6 +2010,27 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     // Store last bound state for Gfx & Compute pipeline bind points
     std::map<uint32_t, LAST_BOUND_STATE> lastBound;
 
+    // Per-bind-point record of which state categories changed since the last validated draw, used
+    // by draw-time validation to skip rechecking unchanged state (see CBDrawDirtyFlagBits).  A bind
+    // point with no entry has not had a draw validated yet and is treated as all-dirty.
+    struct DrawDirtyState {
+        CBDrawDirtyFlags dirty_flags;
+        CMD_TYPE last_cmd_type;       // Draw command type validated last -- different commands make
+                                      // different checks, so a change forces full revalidation
+        uint64_t validated_layout_count;  // image_layout_change_count at the last validated draw
+    };
+    std::map<uint32_t, DrawDirtyState> draw_dirty;
+
+    // Mark draw-time validation categories dirty for one bind point, or for all bind points.  Bind
+    // points without a draw_dirty entry are implicitly all-dirty, so only existing entries change.
+    void DirtyDrawState(uint32_t bind_point, CBDrawDirtyFlags flags) {
+        auto it = draw_dirty.find(bind_point);
+        if (it != draw_dirty.end()) it->second.dirty_flags |= flags;
+    }
+    void DirtyDrawState(CBDrawDirtyFlags flags) {
+        for (auto &entry : draw_dirty) entry.second.dirty_flags |= flags;
+    }
+
     uint32_t viewportMask;
     uint32_t scissorMask;
     uint32_t initial_device_mask;
@@ -1428,6 +2046,8 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
     std::unordered_set<VulkanTypedHandle> object_bindings;
     std::vector<VulkanTypedHandle> broken_bindings;
+    // Owns the link nodes spliced into the cb_bindings lists of the objects above
+    CbBindingPool cb_binding_pool;
 
     QFOTransferBarrierSets<VkBufferMemoryBarrier> qfo_transfer_buffer_barriers;
     QFOTransferBarrierSets<VkImageMemoryBarrier> qfo_transfer_image_barriers;
@@ -1435,11 +2055,21 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     std::unordered_set<VkEvent> waitedEvents;
     std::vector<VkEvent> writeEventsBeforeWait;
     std::vector<VkEvent> events;
-    std::map<QueryObject, QueryState> queryToStateMap;
+    // Dirty view of query state touched by this command buffer; folded into the owning pools'
+    // per-slot state when the submission retires
+    std::unordered_map<QueryObject, QueryState> queryToStateMap;
     std::unordered_set<QueryObject> activeQueries;
     std::unordered_set<QueryObject> startedQueries;
-    typedef std::unordered_map<VkImage, std::unique_ptr<ImageSubresourceLayoutMap>> ImageLayoutMap;
-    ImageLayoutMap image_layout_map;
+    ImageLayoutMapCollection image_layout_map;
+    // Versions under which this command buffer's use of an image last passed submit-time layout
+    // validation *and* left the image's global layouts unchanged.  While both still match (and
+    // no earlier command buffer in the same submit touched the image), reconciliation of that
+    // image is a no-op and is skipped.
+    struct ImageLayoutValidatedVersions {
+        uint64_t map_version;        // ImageSubresourceLayoutMap::Version()
+        uint64_t global_generation;  // IMAGE_STATE::layout_generation
+    };
+    std::unordered_map<VkImage, ImageLayoutValidatedVersions> validated_image_layouts;
     std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
     std::vector<CBVertexBufferBindingInfo> cb_vertex_buffer_binding_info;
     CBVertexBufferBindingInfo current_vertex_buffer_binding_info;
@@ -1451,13 +2081,30 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     // If primary, the secondary command buffers we will call.
     // If secondary, the primary command buffers we will be called by.
     std::unordered_set<CMD_BUFFER_STATE *> linkedCommandBuffers;
-    // Validation functions run at primary CB queue submit time
-    std::vector<std::function<bool()>> queue_submit_functions;
     // Validation functions run when secondary CB is executed in primary
     std::vector<std::function<bool(CMD_BUFFER_STATE *, VkFramebuffer)>> cmd_execute_commands_functions;
+    // Clean vkCmdExecuteCommands linkage-validation results for this secondary, keyed by the
+    // primary's render pass compat id (null when executed outside a render pass instance) and
+    // active framebuffer.  Only clean results are cached -- errors must re-report each call -- and
+    // the cache is cleared on reset since it reflects this secondary's recorded inheritance state.
+    // Compat ids are canonical and never deleted, so cached keys cannot dangle.  Accessed under
+    // this secondary's recording_lock -- the chassis only locks the dispatched primary, and a
+    // SIMULTANEOUS_USE secondary may be executed from multiple primaries concurrently.
+    struct ExecuteLinkageKey {
+        RenderPassCompatId rp_compat;
+        VkFramebuffer framebuffer;
+    };
+    std::vector<ExecuteLinkageKey> validated_execute_linkage;
     std::unordered_set<VkDeviceMemory> memObjs;
-    std::vector<std::function<bool(VkQueue)>> eventUpdates;
-    std::vector<std::function<bool(VkQueue)>> queryUpdates;
+    // Submit-time replay records (flat PODs, see SUBMIT_TIME_OP above); reset with the CB
+    std::vector<SUBMIT_TIME_OP> eventUpdates;
+    std::vector<SUBMIT_TIME_OP> queryUpdates;
+    // Draw-state checks captured off the recording path (enabled.deferred_cb_validation), drained
+    // by the parallel per-CB submit pass and dropped when the buffer is invalidated or reset.
+    // Mutable because both the capture (validate phase -- recording into one CB is serialized, see
+    // recording_lock) and the drain (submission, which requires external sync on the CB) happen
+    // through const command buffer state.
+    mutable std::vector<DeferredDrawCheck> deferred_draw_checks;
     std::unordered_set<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
     // Contents valid only after an index buffer is bound (CBSTATUS_INDEX_BUFFER_BOUND set)
     IndexBufferBinding index_buffer_binding;
@@ -1511,9 +2158,14 @@ struct IMAGE_LAYOUT_STATE {
     VkFormat format;
 };
 
+// One framebuffer attachment resolved at vkCreateFramebuffer time. The framebuffer/render pass
+// pairing is fixed at creation, so per-begin layout validation can do a linear scan over these
+// rows instead of repeating the view and image state-map lookups on every vkCmdBeginRenderPass.
 struct MT_FB_ATTACHMENT_INFO {
     IMAGE_VIEW_STATE *view_state;
     VkImage image;
+    IMAGE_STATE *image_state;
+    VkImageSubresourceRange subresource_range;  // The view's normalized range
 };
 
 class FRAMEBUFFER_STATE : public BASE_NODE {
@@ -1521,6 +2173,9 @@ class FRAMEBUFFER_STATE : public BASE_NODE {
     VkFramebuffer framebuffer;
     safe_VkFramebufferCreateInfo createInfo;
     std::shared_ptr<RENDER_PASS_STATE> rp_state;
+    // Flattened attachment table, one row per createInfo attachment. Empty for imageless
+    // framebuffers, whose attachments are only known at vkCmdBeginRenderPass time.
+    std::vector<MT_FB_ATTACHMENT_INFO> attachments;
     FRAMEBUFFER_STATE(VkFramebuffer fb, const VkFramebufferCreateInfo *pCreateInfo, std::shared_ptr<RENDER_PASS_STATE> &&rpstate)
         : framebuffer(fb), createInfo(pCreateInfo), rp_state(rpstate){};
 };
@@ -1559,7 +2214,11 @@ enum RenderPassCreateVersion { RENDER_PASS_VERSION_1 = 0, RENDER_PASS_VERSION_2
 struct ShaderTracker {
     VkPipeline pipeline;
     VkShaderModule shader_module;
-    std::vector<unsigned int> pgm;
+    // Location of this module's debug SPIR-V in the GPU-AV debug sidecar file (see
+    // GpuShaderDebugSidecar); word count of zero means nothing was spilled there
+    uint64_t sidecar_offset;
+    uint32_t sidecar_word_count;
+    std::vector<unsigned int> pgm;  // resident fallback, used only if the sidecar is unavailable
 };
 
 enum BarrierOperationsType {
@@ -84,15 +84,14 @@ cvdescriptorset::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescript
 
     // Store the create info in the sorted order from above
     std::map<uint32_t, uint32_t> binding_to_dyn_count;
-    uint32_t index = 0;
     binding_count_ = static_cast<uint32_t>(sorted_bindings.size());
     bindings_.reserve(binding_count_);
     binding_flags_.reserve(binding_count_);
-    binding_to_index_map_.reserve(binding_count_);
+    sorted_binding_numbers_.reserve(binding_count_);
     for (auto input_binding : sorted_bindings) {
         // Add to binding and map, s.t. it is robust to invalid duplication of binding_num
         const auto binding_num = input_binding.layout_binding->binding;
-        binding_to_index_map_[binding_num] = index++;
+        sorted_binding_numbers_.emplace_back(binding_num);
         bindings_.emplace_back(input_binding.layout_binding);
         auto &binding_info = bindings_.back();
         binding_flags_.emplace_back(input_binding.binding_flags);
@@ -116,6 +115,19 @@ cvdescriptorset::DescriptorSetLayoutDef::DescriptorSetLayoutDef(const VkDescript
     }
     assert(bindings_.size() == binding_count_);
     assert(binding_flags_.size() == binding_count_);
+
+    // Build the direct binding# -> index table when the binding numbers are dense enough that it
+    // stays small; sparse layouts fall back to binary search over sorted_binding_numbers_
+    if (binding_count_ > 0) {
+        const uint32_t max_binding = sorted_binding_numbers_.back();
+        if (max_binding < (2 * binding_count_ + 32)) {
+            binding_to_index_lut_.assign(max_binding + 1, binding_count_);  // Holes resolve to "end"
+            for (uint32_t i = 0; i < binding_count_; ++i) {
+                binding_to_index_lut_[sorted_binding_numbers_[i]] = i;
+            }
+        }
+    }
+
     uint32_t global_index = 0;
     global_index_range_.reserve(binding_count_);
     // Vector order is finalized so build vectors of descriptors and dynamic offsets by binding index
@@ -147,8 +159,19 @@ size_t cvdescriptorset::DescriptorSetLayoutDef::hash() const {
 // The asserts in "Get" are reduced to the set where no valid answer(like null or 0) could be given
 // Common code for all binding lookups.
 uint32_t cvdescriptorset::DescriptorSetLayoutDef::GetIndexFromBinding(uint32_t binding) const {
-    const auto &bi_itr = binding_to_index_map_.find(binding);
-    if (bi_itr != binding_to_index_map_.cend()) return bi_itr->second;
+    if (!binding_to_index_lut_.empty()) {
+        return (binding < binding_to_index_lut_.size()) ? binding_to_index_lut_[binding] : GetBindingCount();
+    }
+    if (binding_count_ == 0) return GetBindingCount();
+    // Branchless binary search for the last binding number <= binding
+    uint32_t pos = 0;
+    uint32_t count = binding_count_;
+    while (count > 1) {
+        const uint32_t half = count / 2;
+        pos = (sorted_binding_numbers_[pos + half] <= binding) ? (pos + half) : pos;
+        count -= half;
+    }
+    if (sorted_binding_numbers_[pos] == binding) return pos;
     return GetBindingCount();
 }
 VkDescriptorSetLayoutBinding const *cvdescriptorset::DescriptorSetLayoutDef::GetDescriptorSetLayoutBindingPtrFromIndex(
@@ -196,9 +219,9 @@ const cvdescriptorset::IndexRange &cvdescriptorset::DescriptorSetLayoutDef::GetG
 
 // For given binding, return ptr to ImmutableSampler array
 VkSampler const *cvdescriptorset::DescriptorSetLayoutDef::GetImmutableSamplerPtrFromBinding(const uint32_t binding) const {
-    const auto &bi_itr = binding_to_index_map_.find(binding);
-    if (bi_itr != binding_to_index_map_.end()) {
-        return bindings_[bi_itr->second].pImmutableSamplers;
+    const uint32_t index = GetIndexFromBinding(binding);
+    if (index < binding_count_) {
+        return bindings_[index].pImmutableSamplers;
     }
     return nullptr;
 }
@@ -285,23 +308,18 @@ bool cvdescriptorset::VerifySetLayoutCompatibility(DescriptorSetLayout const *lh
 }
 
 bool cvdescriptorset::DescriptorSetLayoutDef::IsNextBindingConsistent(const uint32_t binding) const {
-    if (!binding_to_index_map_.count(binding + 1)) return false;
-    auto const &bi_itr = binding_to_index_map_.find(binding);
-    if (bi_itr != binding_to_index_map_.end()) {
-        const auto &next_bi_itr = binding_to_index_map_.find(binding + 1);
-        if (next_bi_itr != binding_to_index_map_.end()) {
-            auto type = bindings_[bi_itr->second].descriptorType;
-            auto stage_flags = bindings_[bi_itr->second].stageFlags;
-            auto immut_samp = bindings_[bi_itr->second].pImmutableSamplers ? true : false;
-            auto flags = binding_flags_[bi_itr->second];
-            if ((type != bindings_[next_bi_itr->second].descriptorType) ||
-                (stage_flags != bindings_[next_bi_itr->second].stageFlags) ||
-                (immut_samp != (bindings_[next_bi_itr->second].pImmutableSamplers ? true : false)) ||
-                (flags != binding_flags_[next_bi_itr->second])) {
-                return false;
-            }
-            return true;
+    const uint32_t bi = GetIndexFromBinding(binding);
+    const uint32_t next_bi = GetIndexFromBinding(binding + 1);
+    if ((bi < binding_count_) && (next_bi < binding_count_)) {
+        auto type = bindings_[bi].descriptorType;
+        auto stage_flags = bindings_[bi].stageFlags;
+        auto immut_samp = bindings_[bi].pImmutableSamplers ? true : false;
+        auto flags = binding_flags_[bi];
+        if ((type != bindings_[next_bi].descriptorType) || (stage_flags != bindings_[next_bi].stageFlags) ||
+            (immut_samp != (bindings_[next_bi].pImmutableSamplers ? true : false)) || (flags != binding_flags_[next_bi])) {
+            return false;
         }
+        return true;
     }
     return false;
 }
@@ -544,10 +562,12 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
       pool_state_(nullptr),
       p_layout_(layout),
       state_data_(state_data),
-      variable_count_(variable_count) {
+      variable_count_(variable_count),
+      version_(1),
+      has_image_descriptors_(false) {
     pool_state_ = state_data->GetDescriptorPoolState(pool);
     // Foreach binding, create default descriptors of given type
-    descriptors_.reserve(p_layout_->GetTotalDescriptorCount());
+    descriptors_.Allocate(p_layout_->GetTotalDescriptorCount());
     for (uint32_t i = 0; i < p_layout_->GetBindingCount(); ++i) {
         auto type = p_layout_->GetTypeFromIndex(i);
         switch (type) {
@@ -555,21 +575,22 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
                 auto immut_sampler = p_layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut_sampler) {
-                        descriptors_.emplace_back(new SamplerDescriptor(immut_sampler + di));
+                        descriptors_.EmplaceBack<SamplerDescriptor>(immut_sampler + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else
-                        descriptors_.emplace_back(new SamplerDescriptor(nullptr));
+                        descriptors_.EmplaceBack<SamplerDescriptor>(nullptr);
                 }
                 break;
             }
             case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER: {
+                has_image_descriptors_ = true;
                 auto immut = p_layout_->GetImmutableSamplerPtrFromIndex(i);
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di) {
                     if (immut) {
-                        descriptors_.emplace_back(new ImageSamplerDescriptor(immut + di));
+                        descriptors_.EmplaceBack<ImageSamplerDescriptor>(immut + di);
                         some_update_ = true;  // Immutable samplers are updated at creation
                     } else
-                        descriptors_.emplace_back(new ImageSamplerDescriptor(nullptr));
+                        descriptors_.EmplaceBack<ImageSamplerDescriptor>(nullptr);
                 }
                 break;
             }
@@ -577,28 +598,29 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, const V
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                has_image_descriptors_ = true;
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new ImageDescriptor(type));
+                    descriptors_.EmplaceBack<ImageDescriptor>(type);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new TexelDescriptor(type));
+                    descriptors_.EmplaceBack<TexelDescriptor>(type);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new BufferDescriptor(type));
+                    descriptors_.EmplaceBack<BufferDescriptor>(type);
                 break;
             case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new InlineUniformDescriptor(type));
+                    descriptors_.EmplaceBack<InlineUniformDescriptor>(type);
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
                 for (uint32_t di = 0; di < p_layout_->GetDescriptorCountFromIndex(i); ++di)
-                    descriptors_.emplace_back(new AccelerationStructureDescriptor(type));
+                    descriptors_.EmplaceBack<AccelerationStructureDescriptor>(type);
                 break;
             default:
                 assert(0);  // Bad descriptor type specified
@@ -643,7 +665,7 @@ static unsigned DescriptorRequirementsBitsFromFormat(VkFormat fmt) {
 //  This includes validating that all descriptors in the given bindings are updated,
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
-bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const std::map<uint32_t, descriptor_req> &bindings,
+bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const BindingReqMap &bindings,
                                    const std::vector<uint32_t> &dynamic_offsets, const CMD_BUFFER_STATE *cb_node,
                                    const char *caller, std::string *error) const {
     using DescriptorClass = cvdescriptorset::DescriptorClass;
@@ -880,7 +902,7 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet *descriptor_set, const st
 }
 
 // For given bindings, place any update buffers or images into the passed-in unordered_sets
-uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32_t, descriptor_req> &bindings,
+uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const BindingReqMap &bindings,
                                                            std::unordered_set<VkBuffer> *buffer_set,
                                                            std::unordered_set<VkImageView> *image_set) const {
     auto num_updates = 0;
@@ -895,14 +917,14 @@ uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32
             if (Image == descriptors_[start_idx]->descriptor_class) {
                 for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
                     if (descriptors_[start_idx + i]->updated) {
-                        image_set->insert(static_cast<ImageDescriptor *>(descriptors_[start_idx + i].get())->GetImageView());
+                        image_set->insert(static_cast<const ImageDescriptor *>(descriptors_[start_idx + i])->GetImageView());
                         num_updates++;
                     }
                 }
             } else if (TexelBuffer == descriptors_[start_idx]->descriptor_class) {
                 for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
                     if (descriptors_[start_idx + i]->updated) {
-                        auto bufferview = static_cast<TexelDescriptor *>(descriptors_[start_idx + i].get())->GetBufferView();
+                        auto bufferview = static_cast<const TexelDescriptor *>(descriptors_[start_idx + i])->GetBufferView();
                         auto bv_state = state_data_->GetBufferViewState(bufferview);
                         if (bv_state) {
                             buffer_set->insert(bv_state->create_info.buffer);
@@ -913,7 +935,7 @@ uint32_t cvdescriptorset::DescriptorSet::GetStorageUpdates(const std::map<uint32
             } else if (GeneralBuffer == descriptors_[start_idx]->descriptor_class) {
                 for (uint32_t i = 0; i < p_layout_->GetDescriptorCountFromBinding(binding); ++i) {
                     if (descriptors_[start_idx + i]->updated) {
-                        buffer_set->insert(static_cast<BufferDescriptor *>(descriptors_[start_idx + i].get())->GetBuffer());
+                        buffer_set->insert(static_cast<const BufferDescriptor *>(descriptors_[start_idx + i])->GetBuffer());
                         num_updates++;
                     }
                 }
@@ -927,6 +949,39 @@ void cvdescriptorset::DescriptorSet::InvalidateBoundCmdBuffers() {
     state_data_->InvalidateCommandBuffers(cb_bindings, VulkanTypedHandle(set_, kVulkanObjectTypeDescriptorSet));
 }
 
+bool cvdescriptorset::DescriptorSet::CanSkipDrawStateValidation(const CMD_BUFFER_STATE *cb_state,
+                                                                const PIPELINE_STATE *pipeline,
+                                                                const std::vector<uint32_t> &dynamic_offsets) const {
+    const auto &passed = passed_validation_;
+    // The set's contents must be untouched since the recorded validation passed
+    if ((passed.version == 0) || (passed.version != version_)) return false;
+    // Any object invalidation since then (destroyed buffer/image/sampler/pipeline, ...) could have
+    // broken a resource the recorded validation saw as valid
+    if (passed.invalidate_count != state_data_->object_invalidate_count) return false;
+    // The binding requirements validated are those of the bound pipeline
+    if (passed.pipeline != pipeline) return false;
+    if (passed.dynamic_offsets != dynamic_offsets) return false;
+    // Image descriptors were checked against the validating command buffer's image layouts, which
+    // only cover this draw if it is in the same recording with no layout changes in between
+    if (has_image_descriptors_ &&
+        ((passed.cb != cb_state) || (passed.cb_reset_count != cb_state->reset_count) ||
+         (passed.image_layout_count != cb_state->image_layout_change_count)))
+        return false;
+    return true;
+}
+
+void cvdescriptorset::DescriptorSet::RecordPassedDrawStateValidation(const CMD_BUFFER_STATE *cb_state,
+                                                                     const PIPELINE_STATE *pipeline,
+                                                                     const std::vector<uint32_t> &dynamic_offsets) {
+    passed_validation_.version = version_;
+    passed_validation_.invalidate_count = state_data_->object_invalidate_count;
+    passed_validation_.pipeline = pipeline;
+    passed_validation_.cb = cb_state;
+    passed_validation_.cb_reset_count = cb_state->reset_count;
+    passed_validation_.image_layout_count = cb_state->image_layout_change_count;
+    passed_validation_.dynamic_offsets = dynamic_offsets;
+}
+
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *p_wds) {
     assert(IsPushDescriptor());
@@ -935,6 +990,35 @@ void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write
     }
 }
 
+// Devirtualized bulk-update helpers. All descriptors touched by a single VkWriteDescriptorSet or
+// VkCopyDescriptorSet share one descriptor type (the update consistency checks enforce this even
+// when a run rolls over into consecutive bindings), so the class dispatch is hoisted out of the
+// per-element loop and the update calls bind statically for the whole run.
+template <typename DescriptorT>
+static void WriteUpdateRun(cvdescriptorset::DescriptorBackingStore &descriptors, uint32_t global_idx, uint32_t update_count,
+                           const VkWriteDescriptorSet *update, uint32_t &update_index) {
+    for (uint32_t di = 0; di < update_count; ++di, ++update_index) {
+        static_cast<DescriptorT *>(descriptors[global_idx + di])->DescriptorT::WriteUpdate(update, update_index);
+    }
+}
+
+template <typename DescriptorT>
+static bool CopyUpdateRun(cvdescriptorset::DescriptorBackingStore &dst_descriptors, uint32_t dst_start_idx,
+                          const cvdescriptorset::DescriptorBackingStore &src_descriptors, uint32_t src_start_idx, uint32_t count) {
+    bool any_updated = false;
+    for (uint32_t di = 0; di < count; ++di) {
+        auto src = src_descriptors[src_start_idx + di];
+        auto dst = static_cast<DescriptorT *>(dst_descriptors[dst_start_idx + di]);
+        if (src->updated) {
+            dst->DescriptorT::CopyUpdate(src);
+            any_updated = true;
+        } else {
+            dst->updated = false;
+        }
+    }
+    return any_updated;
+}
+
 // Perform write update in given update struct
 void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet *update) {
     // Perform update on a per-binding basis as consecutive updates roll over to next binding
@@ -945,16 +1029,39 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorS
     while (descriptors_remaining) {
         uint32_t update_count = std::min(descriptors_remaining, GetDescriptorCountFromBinding(binding_being_updated));
         auto global_idx = p_layout_->GetGlobalIndexRangeFromBinding(binding_being_updated).start + offset;
-        // Loop over the updates for a single binding at a time
-        for (uint32_t di = 0; di < update_count; ++di, ++update_index) {
-            descriptors_[global_idx + di]->WriteUpdate(update, update_index);
+        // Loop over the updates for a single binding at a time, dispatching on class once per run
+        switch (descriptors_[global_idx]->descriptor_class) {
+            case PlainSampler:
+                WriteUpdateRun<SamplerDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
+            case ImageSampler:
+                WriteUpdateRun<ImageSamplerDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
+            case Image:
+                WriteUpdateRun<ImageDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
+            case TexelBuffer:
+                WriteUpdateRun<TexelDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
+            case GeneralBuffer:
+                WriteUpdateRun<BufferDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
+            case InlineUniform:
+                WriteUpdateRun<InlineUniformDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
+            case AccelerationStructure:
+                WriteUpdateRun<AccelerationStructureDescriptor>(descriptors_, global_idx, update_count, update, update_index);
+                break;
         }
         // Roll over to next binding in case of consecutive update
         descriptors_remaining -= update_count;
         offset = 0;
         binding_being_updated++;
     }
-    if (update->descriptorCount) some_update_ = true;
+    if (update->descriptorCount) {
+        some_update_ = true;
+        version_++;
+    }
 
     if (!(p_layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
           (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT))) {
@@ -1165,16 +1272,38 @@ bool CoreChecks::ValidateCopyUpdate(const VkCopyDescriptorSet *update, const Des
 void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet *update, const DescriptorSet *src_set) {
     auto src_start_idx = src_set->GetGlobalIndexRangeFromBinding(update->srcBinding).start + update->srcArrayElement;
     auto dst_start_idx = p_layout_->GetGlobalIndexRangeFromBinding(update->dstBinding).start + update->dstArrayElement;
-    // Update parameters all look good so perform update
-    for (uint32_t di = 0; di < update->descriptorCount; ++di) {
-        auto src = src_set->descriptors_[src_start_idx + di].get();
-        auto dst = descriptors_[dst_start_idx + di].get();
-        if (src->updated) {
-            dst->CopyUpdate(src);
-            some_update_ = true;
-        } else {
-            dst->updated = false;
+    // Update parameters all look good so perform update, dispatching on class once for the run
+    if (update->descriptorCount) {
+        bool any_updated = false;
+        const auto count = update->descriptorCount;
+        switch (descriptors_[dst_start_idx]->descriptor_class) {
+            case PlainSampler:
+                any_updated = CopyUpdateRun<SamplerDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_, src_start_idx, count);
+                break;
+            case ImageSampler:
+                any_updated =
+                    CopyUpdateRun<ImageSamplerDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_, src_start_idx, count);
+                break;
+            case Image:
+                any_updated = CopyUpdateRun<ImageDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_, src_start_idx, count);
+                break;
+            case TexelBuffer:
+                any_updated = CopyUpdateRun<TexelDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_, src_start_idx, count);
+                break;
+            case GeneralBuffer:
+                any_updated = CopyUpdateRun<BufferDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_, src_start_idx, count);
+                break;
+            case InlineUniform:
+                any_updated =
+                    CopyUpdateRun<InlineUniformDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_, src_start_idx, count);
+                break;
+            case AccelerationStructure:
+                any_updated = CopyUpdateRun<AccelerationStructureDescriptor>(descriptors_, dst_start_idx, src_set->descriptors_,
+                                                                             src_start_idx, count);
+                break;
         }
+        if (any_updated) some_update_ = true;
+        version_++;
     }
 
     if (!(p_layout_->GetDescriptorBindingFlagsFromBinding(update->dstBinding) &
@@ -1191,13 +1320,19 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
 // Prereq: This should be called for a set that has been confirmed to be active for the given cb_node, meaning it's going
 //   to be used in a draw by the given cb_node
 void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *device_data, CMD_BUFFER_STATE *cb_node,
-                                                     const std::map<uint32_t, descriptor_req> &binding_req_map) {
-    // bind cb to this descriptor set
-    cb_bindings.insert(cb_node);
-    // Add bindings for descriptor set, the set's pool, and individual objects in the set
-    cb_node->object_bindings.emplace(set_, kVulkanObjectTypeDescriptorSet);
-    pool_state_->cb_bindings.insert(cb_node);
-    cb_node->object_bindings.emplace(pool_state_->pool, kVulkanObjectTypeDescriptorPool);
+                                                     const BindingReqMap &binding_req_map) {
+    // Add bindings for descriptor set, the set's pool, and individual objects in the set.
+    // The set and pool cb_bindings are shared across command buffers; serialize with other recording threads
+    auto set_inserted = cb_node->object_bindings.emplace(set_, kVulkanObjectTypeDescriptorSet);
+    if (set_inserted.second) {
+        std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+        cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+    }
+    auto pool_inserted = cb_node->object_bindings.emplace(pool_state_->pool, kVulkanObjectTypeDescriptorPool);
+    if (pool_inserted.second) {
+        std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+        pool_state_->cb_bindings.Insert(cb_node->cb_binding_pool.Alloc(cb_node));
+    }
     // For the active slots, use set# to look up descriptorSet from boundDescriptorSets, and bind all of that descriptor set's
     // resources
     for (auto binding_req_pair : binding_req_map) {
@@ -1218,7 +1353,7 @@ void cvdescriptorset::DescriptorSet::FilterOneBindingReq(const BindingReqMap::va
                                                          const TrackedBindings &bindings, uint32_t limit) {
     if (bindings.size() < limit) {
         const auto it = bindings.find(binding_req_pair.first);
-        if (it == bindings.cend()) out_req->emplace(binding_req_pair);
+        if (it == bindings.cend()) out_req->emplace_back(binding_req_pair);
     }
 }
 
@@ -1229,7 +1364,7 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
     if (validated_it == cached_validation_.cend()) {
         // We have nothing validated, copy in to out
         for (const auto &binding_req_pair : in_req) {
-            out_req->emplace(binding_req_pair);
+            out_req->emplace_back(binding_req_pair);
         }
         return;
     }
@@ -1268,7 +1403,7 @@ void cvdescriptorset::DescriptorSet::FilterBindingReqs(const CMD_BUFFER_STATE &c
                 }
             }
             if (stale) {
-                out_req->emplace(binding_req_pair);
+                out_req->emplace_back(binding_req_pair);
             }
         }
     }
@@ -1767,10 +1902,106 @@ void cvdescriptorset::PerformUpdateDescriptorSets(ValidationStateTracker *dev_da
     }
 }
 
+// Templates are immutable once created, so everything about decoding one -- including binding
+// rollover, which needs the set layout -- can be computed up front and replayed on each update
+// call with only the per-call pData pointer arithmetic left.  Push descriptor templates are left
+// without a plan since their effective set layout is a command parameter at record time.
+void cvdescriptorset::BuildTemplateDecodePlan(const ValidationStateTracker *device_data, TEMPLATE_STATE *template_state) {
+    auto const &create_info = template_state->create_info;
+    if (create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) return;
+    auto layout_obj = GetDescriptorSetLayout(device_data, create_info.descriptorSetLayout);
+    if (!layout_obj) return;
+
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        auto binding_count = layout_obj->GetDescriptorCountFromBinding(create_info.pDescriptorUpdateEntries[i].dstBinding);
+        auto binding_being_updated = create_info.pDescriptorUpdateEntries[i].dstBinding;
+        auto dst_array_element = create_info.pDescriptorUpdateEntries[i].dstArrayElement;
+
+        template_state->decode_plan.reserve(template_state->decode_plan.size() +
+                                            create_info.pDescriptorUpdateEntries[i].descriptorCount);
+        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
+            if (dst_array_element >= binding_count) {
+                dst_array_element = 0;
+                binding_being_updated = layout_obj->GetNextValidBinding(binding_being_updated);
+            }
+
+            TEMPLATE_DECODE_ENTRY entry;
+            entry.descriptor_type = create_info.pDescriptorUpdateEntries[i].descriptorType;
+            entry.dst_binding = binding_being_updated;
+            entry.dst_array_element = dst_array_element;
+            entry.descriptor_count = 1;
+            entry.data_offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
+            if (VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT == entry.descriptor_type) {
+                // descriptorCount is the byte size of the inline update and the rest of the array
+                // just represents bytes, so a single plan entry consumes the whole run
+                entry.descriptor_count = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+                template_state->decode_plan_inline_count++;
+                j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
+            }
+            template_state->decode_plan.push_back(entry);
+            dst_array_element++;
+        }
+    }
+}
+
 cvdescriptorset::DecodedTemplateUpdate::DecodedTemplateUpdate(const ValidationStateTracker *device_data,
                                                               VkDescriptorSet descriptorSet, const TEMPLATE_STATE *template_state,
                                                               const void *pData, VkDescriptorSetLayout push_layout) {
     auto const &create_info = template_state->create_info;
+    if (!template_state->decode_plan.empty()) {
+        // Replay the plan computed at template creation; only the pData arithmetic is per-call
+        inline_infos.resize(template_state->decode_plan_inline_count);
+        desc_writes.reserve(template_state->decode_plan.size());
+        uint32_t inline_index = 0;
+        for (const auto &plan_entry : template_state->decode_plan) {
+            desc_writes.emplace_back();
+            auto &write_entry = desc_writes.back();
+            char *update_entry = (char *)(pData) + plan_entry.data_offset;
+
+            write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            write_entry.pNext = NULL;
+            write_entry.dstSet = descriptorSet;
+            write_entry.dstBinding = plan_entry.dst_binding;
+            write_entry.dstArrayElement = plan_entry.dst_array_element;
+            write_entry.descriptorCount = plan_entry.descriptor_count;
+            write_entry.descriptorType = plan_entry.descriptor_type;
+
+            switch (plan_entry.descriptor_type) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    write_entry.pImageInfo = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
+                    break;
+
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    write_entry.pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
+                    break;
+
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
+                    break;
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
+                    VkWriteDescriptorSetInlineUniformBlockEXT *inline_info = &inline_infos[inline_index++];
+                    inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
+                    inline_info->pNext = nullptr;
+                    inline_info->dataSize = plan_entry.descriptor_count;
+                    inline_info->pData = update_entry;
+                    write_entry.pNext = inline_info;
+                    break;
+                }
+                default:
+                    assert(0);
+                    break;
+            }
+        }
+        return;
+    }
     inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
     desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
     VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
@@ -2170,7 +2401,7 @@ void CoreChecks::UpdateAllocateDescriptorSetsData(const VkDescriptorSetAllocateI
             // Count total descriptors required per type
             for (uint32_t j = 0; j < layout->GetBindingCount(); ++j) {
                 const auto &binding_layout = layout->GetDescriptorSetLayoutBindingPtrFromIndex(j);
-                uint32_t typeIndex = static_cast<uint32_t>(binding_layout->descriptorType);
+                uint32_t typeIndex = DescriptorTypeIndex(binding_layout->descriptorType);
                 ds_data->required_descriptors_by_type[typeIndex] += binding_layout->descriptorCount;
             }
         }
@@ -2213,15 +2444,16 @@ bool CoreChecks::ValidateAllocateDescriptorSets(const VkDescriptorSetAllocateInf
                             pool_state->availableSets);
         }
         // Determine whether descriptor counts are satisfiable
-        for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
-            if (ds_data->required_descriptors_by_type.at(it->first) > pool_state->availableDescriptorTypeCount[it->first]) {
-                skip |= log_msg(
-                    report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT,
-                    HandleToUint64(pool_state->pool), "VUID-VkDescriptorSetAllocateInfo-descriptorPool-00307",
-                    "Unable to allocate %u descriptors of type %s from %s"
-                    ". This pool only has %d descriptors of this type remaining.",
-                    ds_data->required_descriptors_by_type.at(it->first), string_VkDescriptorType(VkDescriptorType(it->first)),
-                    report_data->FormatHandle(pool_state->pool).c_str(), pool_state->availableDescriptorTypeCount[it->first]);
+        for (uint32_t type_index = 0; type_index < kNumDescriptorTypeIndices; ++type_index) {
+            if (ds_data->required_descriptors_by_type[type_index] > pool_state->availableDescriptorTypeCount[type_index]) {
+                skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT,
+                                HandleToUint64(pool_state->pool), "VUID-VkDescriptorSetAllocateInfo-descriptorPool-00307",
+                                "Unable to allocate %u descriptors of type %s from %s"
+                                ". This pool only has %d descriptors of this type remaining.",
+                                ds_data->required_descriptors_by_type[type_index],
+                                string_VkDescriptorType(DescriptorTypeFromIndex(type_index)),
+                                report_data->FormatHandle(pool_state->pool).c_str(),
+                                pool_state->availableDescriptorTypeCount[type_index]);
             }
         }
     }
@@ -2260,8 +2492,8 @@ void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSet
     auto pool_state = descriptorPoolMap[p_alloc_info->descriptorPool].get();
     // Account for sets and individual descriptors allocated from pool
     pool_state->availableSets -= p_alloc_info->descriptorSetCount;
-    for (auto it = ds_data->required_descriptors_by_type.begin(); it != ds_data->required_descriptors_by_type.end(); ++it) {
-        pool_state->availableDescriptorTypeCount[it->first] -= ds_data->required_descriptors_by_type.at(it->first);
+    for (uint32_t type_index = 0; type_index < kNumDescriptorTypeIndices; ++type_index) {
+        pool_state->availableDescriptorTypeCount[type_index] -= ds_data->required_descriptors_by_type[type_index];
     }
 
     const auto *variable_count_info = lvl_find_in_chain<VkDescriptorSetVariableDescriptorCountAllocateInfoEXT>(p_alloc_info->pNext);
@@ -2282,7 +2514,7 @@ void ValidationStateTracker::PerformAllocateDescriptorSets(const VkDescriptorSet
 const cvdescriptorset::BindingReqMap &cvdescriptorset::PrefilterBindRequestMap::FilteredMap(const CMD_BUFFER_STATE &cb_state,
                                                                                             const PIPELINE_STATE &pipeline) {
     if (IsManyDescriptors()) {
-        filtered_map_.reset(new std::map<uint32_t, descriptor_req>());
+        filtered_map_.reset(new BindingReqMap());
         descriptor_set_.FilterBindingReqs(cb_state, pipeline, orig_map_, filtered_map_.get());
         return *filtered_map_;
     }
@@ -23,13 +23,17 @@
 
 #include "hash_vk_types.h"
 #include "vk_layer_logging.h"
+#include "vk_layer_mem_accounting.h"
 #include "vk_layer_utils.h"
 #include "vk_safe_struct.h"
 #include "vulkan/vk_layer.h"
 #include "vk_object_types.h"
+#include <array>
 #include <map>
 #include <memory>
+#include <new>
 #include <set>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -48,7 +52,7 @@ struct IndexRange {
     uint32_t start;
     uint32_t end;
 };
-typedef std::map<uint32_t, descriptor_req> BindingReqMap;
+typedef BindingReqVector BindingReqMap;
 
 /*
  * DescriptorSetLayoutDef/DescriptorSetLayout classes
@@ -100,7 +104,7 @@ class DescriptorSetLayoutDef {
     // Non-empty binding numbers in order
     const std::set<uint32_t> &GetSortedBindingSet() const { return non_empty_bindings_; }
     // Return true if given binding is present in this layout
-    bool HasBinding(const uint32_t binding) const { return binding_to_index_map_.count(binding) > 0; };
+    bool HasBinding(const uint32_t binding) const { return GetIndexFromBinding(binding) < binding_count_; };
     // Return true if binding 1 beyond given exists and has same type, stageFlags & immutable sampler use
     bool IsNextBindingConsistent(const uint32_t) const;
     uint32_t GetIndexFromBinding(uint32_t binding) const;
@@ -163,7 +167,11 @@ class DescriptorSetLayoutDef {
 
     // Convenience data structures for rapid lookup of various descriptor set layout properties
     std::set<uint32_t> non_empty_bindings_;  // Containing non-emtpy bindings in numerical order
-    std::unordered_map<uint32_t, uint32_t> binding_to_index_map_;
+    // Flat binding# -> index lookup.  Binding numbers are small and frozen at layout creation, so
+    // the lookup is a direct table index when the numbers are dense, and a branchless binary search
+    // over the sorted binding numbers otherwise -- no hash probes on the draw-time walks.
+    std::vector<uint32_t> binding_to_index_lut_;    // Direct table; left empty for sparse layouts
+    std::vector<uint32_t> sorted_binding_numbers_;  // Binding numbers in index order
     // The following map allows an non-iterative lookup of a binding from a global index...
     std::vector<IndexRange> global_index_range_;  // range is exclusive of .end
     // For a given binding map to associated index in the dynamic offset array
@@ -486,9 +494,44 @@ class AccelerationStructureDescriptor : public Descriptor {
     void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *) override {}
 };
 
+// Backing store for all of a set's descriptors: a single contiguous allocation holding the
+// concrete Descriptor objects in global-index order, constructed in place.  This replaces one
+// heap allocation (plus pointer indirection on every access) per descriptor, which dominated
+// layer memory use for large bindless-style sets and made per-draw binding walks cache-hostile.
+class DescriptorBackingStore {
+   public:
+    DescriptorBackingStore() : count_(0), capacity_(0) {}
+    ~DescriptorBackingStore() {
+        for (uint32_t i = 0; i < count_; ++i) (*this)[i]->~Descriptor();
+        if (capacity_) VlMemRelease(kVlMemDescriptorSets, static_cast<int64_t>(capacity_ * sizeof(DescriptorSlot)));
+    }
+    // Size the store from the layout's total descriptor count; must be called before EmplaceBack
+    void Allocate(uint32_t count) {
+        slots_.reset(new DescriptorSlot[count]);
+        capacity_ = count;
+        VlMemAccount(kVlMemDescriptorSets, static_cast<int64_t>(capacity_ * sizeof(DescriptorSlot)));
+    }
+    // Construct the next descriptor in place; descriptors must be added in global-index order
+    template <typename T, typename... Args>
+    T *EmplaceBack(Args &&... args) {
+        return new (&slots_[count_++]) T(std::forward<Args>(args)...);
+    }
+    Descriptor *operator[](uint32_t index) { return reinterpret_cast<Descriptor *>(&slots_[index]); }
+    const Descriptor *operator[](uint32_t index) const { return reinterpret_cast<const Descriptor *>(&slots_[index]); }
+
+   private:
+    // Each slot is sized and aligned for the largest concrete descriptor type
+    typedef std::aligned_union<1, SamplerDescriptor, ImageSamplerDescriptor, ImageDescriptor, TexelDescriptor, BufferDescriptor,
+                               InlineUniformDescriptor, AccelerationStructureDescriptor>::type DescriptorSlot;
+    std::unique_ptr<DescriptorSlot[]> slots_;
+    uint32_t count_;
+    uint32_t capacity_;
+};
+
 // Structs to contain common elements that need to be shared between Validate* and Perform* calls below
 struct AllocateDescriptorSetsData {
-    std::map<uint32_t, uint32_t> required_descriptors_by_type;
+    // Total descriptors required per type, indexed by DescriptorTypeIndex()
+    std::array<uint32_t, kNumDescriptorTypeIndices> required_descriptors_by_type;
     std::vector<std::shared_ptr<DescriptorSetLayout const>> layout_nodes;
     AllocateDescriptorSetsData(uint32_t);
 };
@@ -510,6 +553,10 @@ bool VerifyUpdateConsistency(DescriptorSetLayout::ConstBindingIterator current_b
 // Validate buffer descriptor update info
 bool ValidateBufferUsage(BUFFER_STATE const *buffer_node, VkDescriptorType type, std::string *error_code, std::string *error_msg);
 
+// Build TEMPLATE_STATE::decode_plan for a descriptor-set-type update template; called once at
+// template creation so per-update decoding reduces to pData pointer arithmetic
+void BuildTemplateDecodePlan(const ValidationStateTracker *device_data, TEMPLATE_STATE *template_state);
+
 // Helper class to encapsulate the descriptor update template decoding logic
 struct DecodedTemplateUpdate {
     std::vector<VkWriteDescriptorSet> desc_writes;
@@ -529,8 +576,8 @@ struct DecodedTemplateUpdate {
  *   Please refer to the DescriptorSetLayout comment above for a description of
  *   index, binding, and global index.
  *
- * At construction a vector of Descriptor* is created with types corresponding to the
- *   layout. The primary operation performed on the descriptors is to update them
+ * At construction a contiguous block of Descriptors is created with types corresponding
+ *   to the layout. The primary operation performed on the descriptors is to update them
  *   via write or copy updates, and validate that the update contents are correct.
  *   In order to validate update contents, the DescriptorSet stores a bunch of ptrs
  *   to data maps where various Vulkan objects can be looked up. The management of
@@ -539,6 +586,7 @@ struct DecodedTemplateUpdate {
  */
 class DescriptorSet : public BASE_NODE {
    public:
+    VL_MEM_ACCOUNT_CLASS(kVlMemDescriptorSets)
     using StateTracker = ValidationStateTracker;
     DescriptorSet(const VkDescriptorSet, const VkDescriptorPool, const std::shared_ptr<DescriptorSetLayout const> &,
                   uint32_t variable_count, StateTracker *);
@@ -561,7 +609,7 @@ class DescriptorSet : public BASE_NODE {
     bool HasBinding(const uint32_t binding) const { return p_layout_->HasBinding(binding); };
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
-    uint32_t GetStorageUpdates(const std::map<uint32_t, descriptor_req> &, std::unordered_set<VkBuffer> *,
+    uint32_t GetStorageUpdates(const BindingReqMap &, std::unordered_set<VkBuffer> *,
                                std::unordered_set<VkImageView> *) const;
 
     std::string StringifySetAndLayout() const;
@@ -576,11 +624,17 @@ class DescriptorSet : public BASE_NODE {
     const std::shared_ptr<DescriptorSetLayout const> GetLayout() const { return p_layout_; };
     VkDescriptorSetLayout GetDescriptorSetLayout() const { return p_layout_->GetDescriptorSetLayout(); }
     VkDescriptorSet GetSet() const { return set_; };
-    // Return unordered_set of all command buffers that this set is bound to
-    std::unordered_set<CMD_BUFFER_STATE *> GetBoundCmdBuffers() const { return cb_bindings; }
+    // Return a snapshot of all command buffers that this set is bound to
+    std::vector<CMD_BUFFER_STATE *> GetBoundCmdBuffers() const {
+        std::vector<CMD_BUFFER_STATE *> bound_cbs;
+        for (const CbBindingNode *node = cb_bindings.head(); node; node = node->next) {
+            bound_cbs.push_back(node->cb);
+        }
+        return bound_cbs;
+    }
     // Bind given cmd_buffer to this descriptor set and
     // update CB image layout map with image/imagesampler descriptor image layouts
-    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, const std::map<uint32_t, descriptor_req> &);
+    void UpdateDrawState(ValidationStateTracker *, CMD_BUFFER_STATE *, const BindingReqMap &);
 
     // Track work that has been bound or validated to avoid duplicate work, important when large descriptor arrays
     // are present
@@ -595,9 +649,12 @@ class DescriptorSet : public BASE_NODE {
         cached_validation_[cb_state].dynamic_buffers.clear();
     }
     void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) { cached_validation_.erase(cb_state); }
-    // If given cmd_buffer is in the cb_bindings set, remove it
+    // If given cmd_buffer is in the cb_bindings list, remove it
     void RemoveBoundCommandBuffer(CMD_BUFFER_STATE *cb_node) {
-        cb_bindings.erase(cb_node);
+        {
+            std::lock_guard<std::mutex> lock(GetCommandBufferBindingLock());
+            cb_bindings.Remove(cb_node);
+        }
         ClearCachedValidation(cb_node);
     }
     VkSampler const *GetImmutableSamplerPtrFromBinding(const uint32_t index) const {
@@ -622,7 +679,18 @@ class DescriptorSet : public BASE_NODE {
     }
     uint32_t GetVariableDescriptorCount() const { return variable_count_; }
     DESCRIPTOR_POOL_STATE *GetPoolState() const { return pool_state_; }
-    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index].get(); }
+    const Descriptor *GetDescriptorFromGlobalIndex(const uint32_t index) const { return descriptors_[index]; }
+    // Monotonic version of the set's contents, bumped by every write, copy or push update
+    uint64_t GetVersion() const { return version_; }
+    // Returns true if the most recent passing draw-time validation of this set still covers a draw
+    // with the given command buffer, pipeline and dynamic offsets, making a full ValidateDrawState
+    // walk redundant (everything the walk would check is compared via version/sequence counters)
+    bool CanSkipDrawStateValidation(const CMD_BUFFER_STATE *cb_state, const PIPELINE_STATE *pipeline,
+                                    const std::vector<uint32_t> &dynamic_offsets) const;
+    // Record a passing draw-time validation; called from the record phase, which a draw only
+    // reaches after its validation succeeded
+    void RecordPassedDrawStateValidation(const CMD_BUFFER_STATE *cb_state, const PIPELINE_STATE *pipeline,
+                                         const std::vector<uint32_t> &dynamic_offsets);
 
    private:
     // Private helper to set all bound cmd buffers to INVALID state
@@ -631,9 +699,25 @@ class DescriptorSet : public BASE_NODE {
     VkDescriptorSet set_;
     DESCRIPTOR_POOL_STATE *pool_state_;
     const std::shared_ptr<DescriptorSetLayout const> p_layout_;
-    std::vector<std::unique_ptr<Descriptor>> descriptors_;
+    DescriptorBackingStore descriptors_;
     StateTracker *state_data_;
     uint32_t variable_count_;
+    uint64_t version_;             // Bumped on every write/copy/push update to the set's contents
+    bool has_image_descriptors_;   // Draw-time validation of this set depends on image layouts
+
+    // The most recent draw-time validation of this set that passed, reusable while nothing it
+    // depended on can have changed -- see CanSkipDrawStateValidation().  Unlike cached_validation_
+    // below this survives across draws, command buffers and frames.
+    struct PassedDrawStateValidation {
+        uint64_t version = 0;            // Set version when validation passed; 0 = none recorded
+        uint64_t invalidate_count = 0;   // StateTracker object_invalidate_count at that time
+        const PIPELINE_STATE *pipeline = nullptr;  // Source of the validated binding requirements
+        const CMD_BUFFER_STATE *cb = nullptr;      // Image layouts were checked against this CB...
+        uint64_t cb_reset_count = 0;               // ... during this recording ...
+        uint64_t image_layout_count = 0;           // ... at this layout change sequence number
+        std::vector<uint32_t> dynamic_offsets;
+    };
+    PassedDrawStateValidation passed_validation_;
 
     // Cached binding and validation support:
     //
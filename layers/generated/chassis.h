@@ -25,7 +25,9 @@
 
 
 #define NOMINMAX
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <cinttypes>
 #include <stdio.h>
 #include <stdlib.h>
@@ -52,8 +54,6 @@
 #include "vk_typemap_helper.h"
 
 
-extern uint64_t global_unique_id;
-extern std::unordered_map<uint64_t, uint64_t> unique_id_mapping;
 
 
 
@@ -2332,9 +2332,24 @@ enum LayerObjectTypeId {
     LayerObjectTypeCoreValidation,              // Instance or device core validation layer object
 };
 
+// Precomputed decode plan entry for a descriptor update template: everything about one decoded
+// VkWriteDescriptorSet except the per-call pData pointer arithmetic
+struct TEMPLATE_DECODE_ENTRY {
+    VkDescriptorType descriptor_type;
+    uint32_t dst_binding;
+    uint32_t dst_array_element;
+    uint32_t descriptor_count;
+    size_t data_offset;
+};
+
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
+    // Flattened write list (binding rollover resolved) computed once at creation, since templates
+    // are immutable.  Empty for push descriptor templates, whose effective set layout is only
+    // known at record time, and updates then fall back to a full decode.
+    std::vector<TEMPLATE_DECODE_ENTRY> decode_plan;
+    uint32_t decode_plan_inline_count = 0;
 
     TEMPLATE_STATE(VkDescriptorUpdateTemplateKHR update_template, safe_VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
         : desc_update_template(update_template), create_info(*pCreateInfo) {}
@@ -2355,6 +2370,22 @@ typedef enum ValidationCheckDisables {
 } ValidationCheckDisables;
 
 
+// Dense bit index per CHECK_DISABLED field, for the packed mirror below
+typedef enum DisableCheckBits {
+    kDisableBitCommandBufferState = 0,
+    kDisableBitObjectInUse,
+    kDisableBitIdleDescriptorSet,
+    kDisableBitPushConstantRange,
+    kDisableBitQueryValidation,
+    kDisableBitObjectTracking,
+    kDisableBitCoreChecks,
+    kDisableBitThreadSafety,
+    kDisableBitStatelessChecks,
+    kDisableBitHandleWrapping,
+    kDisableBitShaderValidation,
+    kDisableBitCount
+} DisableCheckBits;
+
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // These bools are all "false" by default meaning that all checks are enabled. Enum values can be specified
 // via the vk_layer_setting.txt config file or at CreateInstance time via the VK_EXT_validation_features extension
@@ -2372,14 +2403,37 @@ struct CHECK_DISABLED {
     bool handle_wrapping;                           // Disable unique handles/handle wrapping
     bool shader_validation;                         // Skip validation for shaders
 
+    // Dense mirror of the bools above, indexed by DisableCheckBits and packed by Finalize() once
+    // settings processing is done at instance creation.  Hot check sites test one bit of this
+    // cached word (IsDisabled) instead of loading a scattered bool per check.
+    uint32_t bits;
+
     void SetAll(bool value) { std::fill(&command_buffer_state, &shader_validation + 1, value); }
+
+    void Finalize() {
+        static_assert(kDisableBitCount <= 32, "DisableCheckBits must fit the packed word");
+        bits = (uint32_t(command_buffer_state) << kDisableBitCommandBufferState) |
+               (uint32_t(object_in_use) << kDisableBitObjectInUse) |
+               (uint32_t(idle_descriptor_set) << kDisableBitIdleDescriptorSet) |
+               (uint32_t(push_constant_range) << kDisableBitPushConstantRange) |
+               (uint32_t(query_validation) << kDisableBitQueryValidation) |
+               (uint32_t(object_tracking) << kDisableBitObjectTracking) |
+               (uint32_t(core_checks) << kDisableBitCoreChecks) |
+               (uint32_t(thread_safety) << kDisableBitThreadSafety) |
+               (uint32_t(stateless_checks) << kDisableBitStatelessChecks) |
+               (uint32_t(handle_wrapping) << kDisableBitHandleWrapping) |
+               (uint32_t(shader_validation) << kDisableBitShaderValidation);
+    }
+    bool IsDisabled(DisableCheckBits bit) const { return (bits >> bit) & 1u; }
 };
 
 struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
+    bool deferred_shader_validation;                // Offload spirv-val to worker threads, joined before first use
+    bool deferred_cb_validation;                    // Capture draw-time checks at record, run them at submit on the worker pool
 
-    void SetAll(bool value) { std::fill(&gpu_validation, &gpu_validation_reserve_binding_slot + 1, value); }
+    void SetAll(bool value) { std::fill(&gpu_validation, &deferred_cb_validation + 1, value); }
 };
 
 // Layer chassis validation object base class definition
@@ -2406,6 +2460,17 @@ class ValidationObject {
         std::vector<ValidationObject*> object_dispatch;
         LayerObjectTypeId container_type;
 
+        // Per-entry-point dispatch vectors, indexed by InterceptId.  Built once the final object_dispatch
+        // contents are known -- see InitObjectDispatchVectors() in chassis.cpp.
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
+        void InitObjectDispatchVectors();
+
+        // Devirtualized fast path: when exactly one validation object is enabled,
+        // InitObjectDispatchVectors() caches it here and the generated entry points call into the
+        // concrete class directly -- see the VVL_FUSED_* macros in chassis.cpp.
+        ValidationObject* fused_object = nullptr;
+        LayerObjectTypeId fused_object_type = LayerObjectTypeInstance;
+
         std::string layer_name = "CHASSIS";
 
         // Constructor
@@ -2413,9 +2478,31 @@ class ValidationObject {
         // Destructor
         virtual ~ValidationObject() {};
 
-        std::mutex validation_object_mutex;
-        virtual std::unique_lock<std::mutex> write_lock() {
-            return std::unique_lock<std::mutex>(validation_object_mutex);
+        // Reader/writer lock for validation object state.  PreCallValidate* hooks are read-only by design
+        // and take the shared lock, so multiple threads can validate concurrently; the record-phase hooks
+        // that mutate layer state take the exclusive lock.
+        std::shared_timed_mutex validation_object_mutex;
+        virtual std::unique_lock<std::shared_timed_mutex> write_lock() {
+            return std::unique_lock<std::shared_timed_mutex>(validation_object_mutex);
+        }
+        virtual std::shared_lock<std::shared_timed_mutex> read_lock() {
+            return std::shared_lock<std::shared_timed_mutex>(validation_object_mutex);
+        }
+
+        // RAII lock bundle for the record phase of commands dispatched on a VkCommandBuffer.  The default
+        // implementation falls back to the exclusive validation object lock.  Layers that keep
+        // command-buffer-scoped state override this to hold the device lock shared (so handle
+        // create/destroy still excludes recording) and serialize on the individual command buffer instead,
+        // letting different threads record into different command buffers in parallel.
+        struct CommandBufferWriteLock {
+            std::unique_lock<std::shared_timed_mutex> exclusive_lock;
+            std::shared_lock<std::shared_timed_mutex> shared_lock;
+            std::unique_lock<std::mutex> cb_lock;
+        };
+        virtual CommandBufferWriteLock cb_write_lock(VkCommandBuffer commandBuffer) {
+            CommandBufferWriteLock lock;
+            lock.exclusive_lock = write_lock();
+            return lock;
         }
 
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
@@ -2444,26 +2531,93 @@ class ValidationObject {
         // Map of wrapped descriptor pools to set of wrapped descriptor sets allocated from each pool
         std::unordered_map<VkDescriptorPool, std::unordered_set<VkDescriptorSet>> pool_descriptor_sets_map;
 
+        // Slot map of wrapped unique IDs to the driver handles they stand for.  Ids encode their
+        // own slot index and generation, so unwrapping is an array index plus a generation compare
+        // with no hashing, no lock, and reliable detection of destroyed ids.  Each dispatch object
+        // owns the map for the handles created from it, so recording threads on one device never
+        // touch another device's map.  Instance-scoped handle types (surfaces, displays, debug
+        // callbacks) always resolve through the instance's map -- see UnwrapInstanceScoped().
+        vl_slot_map unique_id_mapping;
+        // Instance-level dispatch object owning the map for instance-scoped handles; null on the
+        // instance object itself.  Set when the device-level chassis is created.
+        ValidationObject* instance_wrap_state = nullptr;
+
+        vl_slot_map &InstanceWrapMap() {
+            return instance_wrap_state ? instance_wrap_state->unique_id_mapping : unique_id_mapping;
+        }
 
-        // Unwrap a handle.  Must hold lock.
+        // Unwrap a handle.
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
-            // TODO: don't use operator[] here.
-            return (HandleType)unique_id_mapping[reinterpret_cast<uint64_t const &>(wrappedHandle)];
+            auto iter = unique_id_mapping.find(reinterpret_cast<uint64_t const &>(wrappedHandle));
+            if (iter == unique_id_mapping.end()) return (HandleType)0;
+            return (HandleType)iter->second;
+        }
+
+        // Unwrap a handle whose type is created at instance scope.  Such handles can legally be
+        // referenced by device-level calls (a surface in vkCreateSwapchainKHR, a display in
+        // vkDisplayPowerControlEXT), so they always resolve through the instance's map.
+        template <typename HandleType>
+        HandleType UnwrapInstanceScoped(HandleType wrappedHandle) {
+            vl_slot_map &wrap_map = InstanceWrapMap();
+            auto iter = wrap_map.find(reinterpret_cast<uint64_t const &>(wrappedHandle));
+            if (iter == wrap_map.end()) return (HandleType)0;
+            return (HandleType)iter->second;
+        }
+
+        // Instance-scoped handle types resolve exclusively through the instance's map, everything
+        // else through this object's.  Fresh slot maps mint identical id sequences, so probing the
+        // wrong map first can resolve a handle to an unrelated object of another scope.
+        static bool HandleTypeIsInstanceScoped(VkObjectType object_type) {
+            switch (object_type) {
+                case VK_OBJECT_TYPE_SURFACE_KHR:
+                case VK_OBJECT_TYPE_DISPLAY_KHR:
+                case VK_OBJECT_TYPE_DISPLAY_MODE_KHR:
+                case VK_OBJECT_TYPE_DEBUG_UTILS_MESSENGER_EXT:
+                case VK_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+        static bool HandleTypeIsInstanceScoped(VkDebugReportObjectTypeEXT object_type) {
+            switch (object_type) {
+                case VK_DEBUG_REPORT_OBJECT_TYPE_SURFACE_KHR_EXT:
+                case VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_KHR_EXT:
+                case VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_MODE_KHR_EXT:
+                case VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT_EXT:
+                    return true;
+                default:
+                    return false;
+            }
         }
 
-        // Wrap a newly created handle with a new unique ID, and return the new ID -- must hold lock.
+        // Look up a wrapped handle on behalf of the debug-utils naming entry points, routed to
+        // the one map its object type can live in.
+        bool FindWrappedHandleScoped(uint64_t wrapped_handle, bool instance_scoped, uint64_t *unwrapped) {
+            vl_slot_map &wrap_map = instance_scoped ? InstanceWrapMap() : unique_id_mapping;
+            auto iter = wrap_map.find(wrapped_handle);
+            if (iter == wrap_map.end()) return false;
+            *unwrapped = iter->second;
+            return true;
+        }
+        bool FindWrappedHandle(uint64_t wrapped_handle, VkObjectType object_type, uint64_t *unwrapped) {
+            return FindWrappedHandleScoped(wrapped_handle, HandleTypeIsInstanceScoped(object_type), unwrapped);
+        }
+        bool FindWrappedHandle(uint64_t wrapped_handle, VkDebugReportObjectTypeEXT object_type, uint64_t *unwrapped) {
+            return FindWrappedHandleScoped(wrapped_handle, HandleTypeIsInstanceScoped(object_type), unwrapped);
+        }
+
+        // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
+            auto unique_id = unique_id_mapping.add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup. Must hold lock.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
+            auto unique_id = InstanceWrapMap().add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping[newlyCreatedHandle] = unique_id;
             return (VkDisplayKHR)unique_id;
         }
@@ -3676,6 +3830,22 @@ class ValidationObject {
             PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result);
         };
 
+        // Allow additional state parameter for CreateRenderPass
+        virtual bool PreCallValidateCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, void* crp_state)  {
+            return PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+        };
+        virtual void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result, void* crp_state) {
+            PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
+        };
+
+        // Allow additional state parameter for CreateRenderPass2KHR
+        virtual bool PreCallValidateCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, void* crp_state)  {
+            return PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+        };
+        virtual void PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result, void* crp_state) {
+            PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
+        };
+
         // Modify a parameter to CreateDevice
         virtual void PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, std::unique_ptr<safe_VkDeviceCreateInfo> &modified_create_info) {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
@@ -3683,3 +3853,1077 @@ class ValidationObject {
 };
 
 extern std::unordered_map<void*, ValidationObject*> layer_data_map;
+
+
+// Identifies the Pre/Post hook a generated entry point is dispatching; used to index
+// ValidationObject::intercept_vectors.
+typedef enum InterceptId {
+    InterceptIdPreCallValidateDestroyInstance,
+    InterceptIdPreCallRecordDestroyInstance,
+    InterceptIdPostCallRecordDestroyInstance,
+    InterceptIdPreCallValidateDestroyDevice,
+    InterceptIdPreCallRecordDestroyDevice,
+    InterceptIdPostCallRecordDestroyDevice,
+    InterceptIdPreCallValidateCreatePipelineLayout,
+    InterceptIdPostCallRecordCreatePipelineLayout,
+    InterceptIdPreCallRecordAllocateDescriptorSets,
+    InterceptIdPreCallValidateEnumeratePhysicalDevices,
+    InterceptIdPreCallRecordEnumeratePhysicalDevices,
+    InterceptIdPostCallRecordEnumeratePhysicalDevices,
+    InterceptIdPreCallValidateGetPhysicalDeviceFeatures,
+    InterceptIdPreCallRecordGetPhysicalDeviceFeatures,
+    InterceptIdPostCallRecordGetPhysicalDeviceFeatures,
+    InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties,
+    InterceptIdPreCallValidateGetDeviceQueue,
+    InterceptIdPreCallRecordGetDeviceQueue,
+    InterceptIdPostCallRecordGetDeviceQueue,
+    InterceptIdPreCallValidateQueueSubmit,
+    InterceptIdPreCallRecordQueueSubmit,
+    InterceptIdPostCallRecordQueueSubmit,
+    InterceptIdPreCallValidateQueueWaitIdle,
+    InterceptIdPreCallRecordQueueWaitIdle,
+    InterceptIdPostCallRecordQueueWaitIdle,
+    InterceptIdPreCallValidateDeviceWaitIdle,
+    InterceptIdPreCallRecordDeviceWaitIdle,
+    InterceptIdPostCallRecordDeviceWaitIdle,
+    InterceptIdPreCallValidateAllocateMemory,
+    InterceptIdPreCallRecordAllocateMemory,
+    InterceptIdPostCallRecordAllocateMemory,
+    InterceptIdPreCallValidateFreeMemory,
+    InterceptIdPreCallRecordFreeMemory,
+    InterceptIdPostCallRecordFreeMemory,
+    InterceptIdPreCallValidateMapMemory,
+    InterceptIdPreCallRecordMapMemory,
+    InterceptIdPostCallRecordMapMemory,
+    InterceptIdPreCallValidateUnmapMemory,
+    InterceptIdPreCallRecordUnmapMemory,
+    InterceptIdPostCallRecordUnmapMemory,
+    InterceptIdPreCallValidateFlushMappedMemoryRanges,
+    InterceptIdPreCallRecordFlushMappedMemoryRanges,
+    InterceptIdPostCallRecordFlushMappedMemoryRanges,
+    InterceptIdPreCallValidateInvalidateMappedMemoryRanges,
+    InterceptIdPreCallRecordInvalidateMappedMemoryRanges,
+    InterceptIdPostCallRecordInvalidateMappedMemoryRanges,
+    InterceptIdPreCallValidateGetDeviceMemoryCommitment,
+    InterceptIdPreCallRecordGetDeviceMemoryCommitment,
+    InterceptIdPostCallRecordGetDeviceMemoryCommitment,
+    InterceptIdPreCallValidateBindBufferMemory,
+    InterceptIdPreCallRecordBindBufferMemory,
+    InterceptIdPostCallRecordBindBufferMemory,
+    InterceptIdPreCallValidateBindImageMemory,
+    InterceptIdPreCallRecordBindImageMemory,
+    InterceptIdPostCallRecordBindImageMemory,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements,
+    InterceptIdPreCallValidateGetImageMemoryRequirements,
+    InterceptIdPreCallRecordGetImageMemoryRequirements,
+    InterceptIdPostCallRecordGetImageMemoryRequirements,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements,
+    InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties,
+    InterceptIdPreCallValidateQueueBindSparse,
+    InterceptIdPreCallRecordQueueBindSparse,
+    InterceptIdPostCallRecordQueueBindSparse,
+    InterceptIdPreCallValidateCreateFence,
+    InterceptIdPreCallRecordCreateFence,
+    InterceptIdPostCallRecordCreateFence,
+    InterceptIdPreCallValidateDestroyFence,
+    InterceptIdPreCallRecordDestroyFence,
+    InterceptIdPostCallRecordDestroyFence,
+    InterceptIdPreCallValidateResetFences,
+    InterceptIdPreCallRecordResetFences,
+    InterceptIdPostCallRecordResetFences,
+    InterceptIdPreCallValidateGetFenceStatus,
+    InterceptIdPreCallRecordGetFenceStatus,
+    InterceptIdPostCallRecordGetFenceStatus,
+    InterceptIdPreCallValidateWaitForFences,
+    InterceptIdPreCallRecordWaitForFences,
+    InterceptIdPostCallRecordWaitForFences,
+    InterceptIdPreCallValidateCreateSemaphore,
+    InterceptIdPreCallRecordCreateSemaphore,
+    InterceptIdPostCallRecordCreateSemaphore,
+    InterceptIdPreCallValidateDestroySemaphore,
+    InterceptIdPreCallRecordDestroySemaphore,
+    InterceptIdPostCallRecordDestroySemaphore,
+    InterceptIdPreCallValidateCreateEvent,
+    InterceptIdPreCallRecordCreateEvent,
+    InterceptIdPostCallRecordCreateEvent,
+    InterceptIdPreCallValidateDestroyEvent,
+    InterceptIdPreCallRecordDestroyEvent,
+    InterceptIdPostCallRecordDestroyEvent,
+    InterceptIdPreCallValidateGetEventStatus,
+    InterceptIdPreCallRecordGetEventStatus,
+    InterceptIdPostCallRecordGetEventStatus,
+    InterceptIdPreCallValidateSetEvent,
+    InterceptIdPreCallRecordSetEvent,
+    InterceptIdPostCallRecordSetEvent,
+    InterceptIdPreCallValidateResetEvent,
+    InterceptIdPreCallRecordResetEvent,
+    InterceptIdPostCallRecordResetEvent,
+    InterceptIdPreCallValidateCreateQueryPool,
+    InterceptIdPreCallRecordCreateQueryPool,
+    InterceptIdPostCallRecordCreateQueryPool,
+    InterceptIdPreCallValidateDestroyQueryPool,
+    InterceptIdPreCallRecordDestroyQueryPool,
+    InterceptIdPostCallRecordDestroyQueryPool,
+    InterceptIdPreCallValidateGetQueryPoolResults,
+    InterceptIdPreCallRecordGetQueryPoolResults,
+    InterceptIdPostCallRecordGetQueryPoolResults,
+    InterceptIdPreCallValidateCreateBuffer,
+    InterceptIdPreCallRecordCreateBuffer,
+    InterceptIdPostCallRecordCreateBuffer,
+    InterceptIdPreCallValidateDestroyBuffer,
+    InterceptIdPreCallRecordDestroyBuffer,
+    InterceptIdPostCallRecordDestroyBuffer,
+    InterceptIdPreCallValidateCreateBufferView,
+    InterceptIdPreCallRecordCreateBufferView,
+    InterceptIdPostCallRecordCreateBufferView,
+    InterceptIdPreCallValidateDestroyBufferView,
+    InterceptIdPreCallRecordDestroyBufferView,
+    InterceptIdPostCallRecordDestroyBufferView,
+    InterceptIdPreCallValidateCreateImage,
+    InterceptIdPreCallRecordCreateImage,
+    InterceptIdPostCallRecordCreateImage,
+    InterceptIdPreCallValidateDestroyImage,
+    InterceptIdPreCallRecordDestroyImage,
+    InterceptIdPostCallRecordDestroyImage,
+    InterceptIdPreCallValidateGetImageSubresourceLayout,
+    InterceptIdPreCallRecordGetImageSubresourceLayout,
+    InterceptIdPostCallRecordGetImageSubresourceLayout,
+    InterceptIdPreCallValidateCreateImageView,
+    InterceptIdPreCallRecordCreateImageView,
+    InterceptIdPostCallRecordCreateImageView,
+    InterceptIdPreCallValidateDestroyImageView,
+    InterceptIdPreCallRecordDestroyImageView,
+    InterceptIdPostCallRecordDestroyImageView,
+    InterceptIdPreCallValidateDestroyShaderModule,
+    InterceptIdPreCallRecordDestroyShaderModule,
+    InterceptIdPostCallRecordDestroyShaderModule,
+    InterceptIdPreCallValidateCreatePipelineCache,
+    InterceptIdPreCallRecordCreatePipelineCache,
+    InterceptIdPostCallRecordCreatePipelineCache,
+    InterceptIdPreCallValidateDestroyPipelineCache,
+    InterceptIdPreCallRecordDestroyPipelineCache,
+    InterceptIdPostCallRecordDestroyPipelineCache,
+    InterceptIdPreCallValidateGetPipelineCacheData,
+    InterceptIdPreCallRecordGetPipelineCacheData,
+    InterceptIdPostCallRecordGetPipelineCacheData,
+    InterceptIdPreCallValidateMergePipelineCaches,
+    InterceptIdPreCallRecordMergePipelineCaches,
+    InterceptIdPostCallRecordMergePipelineCaches,
+    InterceptIdPreCallValidateDestroyPipeline,
+    InterceptIdPreCallRecordDestroyPipeline,
+    InterceptIdPostCallRecordDestroyPipeline,
+    InterceptIdPreCallValidateDestroyPipelineLayout,
+    InterceptIdPreCallRecordDestroyPipelineLayout,
+    InterceptIdPostCallRecordDestroyPipelineLayout,
+    InterceptIdPreCallValidateCreateSampler,
+    InterceptIdPreCallRecordCreateSampler,
+    InterceptIdPostCallRecordCreateSampler,
+    InterceptIdPreCallValidateDestroySampler,
+    InterceptIdPreCallRecordDestroySampler,
+    InterceptIdPostCallRecordDestroySampler,
+    InterceptIdPreCallValidateCreateDescriptorSetLayout,
+    InterceptIdPreCallRecordCreateDescriptorSetLayout,
+    InterceptIdPostCallRecordCreateDescriptorSetLayout,
+    InterceptIdPreCallValidateDestroyDescriptorSetLayout,
+    InterceptIdPreCallRecordDestroyDescriptorSetLayout,
+    InterceptIdPostCallRecordDestroyDescriptorSetLayout,
+    InterceptIdPreCallValidateCreateDescriptorPool,
+    InterceptIdPreCallRecordCreateDescriptorPool,
+    InterceptIdPostCallRecordCreateDescriptorPool,
+    InterceptIdPreCallValidateDestroyDescriptorPool,
+    InterceptIdPreCallRecordDestroyDescriptorPool,
+    InterceptIdPostCallRecordDestroyDescriptorPool,
+    InterceptIdPreCallValidateResetDescriptorPool,
+    InterceptIdPreCallRecordResetDescriptorPool,
+    InterceptIdPostCallRecordResetDescriptorPool,
+    InterceptIdPreCallValidateFreeDescriptorSets,
+    InterceptIdPreCallRecordFreeDescriptorSets,
+    InterceptIdPostCallRecordFreeDescriptorSets,
+    InterceptIdPreCallValidateUpdateDescriptorSets,
+    InterceptIdPreCallRecordUpdateDescriptorSets,
+    InterceptIdPostCallRecordUpdateDescriptorSets,
+    InterceptIdPreCallValidateCreateFramebuffer,
+    InterceptIdPreCallRecordCreateFramebuffer,
+    InterceptIdPostCallRecordCreateFramebuffer,
+    InterceptIdPreCallValidateDestroyFramebuffer,
+    InterceptIdPreCallRecordDestroyFramebuffer,
+    InterceptIdPostCallRecordDestroyFramebuffer,
+    InterceptIdPreCallRecordCreateRenderPass,
+    InterceptIdPreCallValidateDestroyRenderPass,
+    InterceptIdPreCallRecordDestroyRenderPass,
+    InterceptIdPostCallRecordDestroyRenderPass,
+    InterceptIdPreCallValidateGetRenderAreaGranularity,
+    InterceptIdPreCallRecordGetRenderAreaGranularity,
+    InterceptIdPostCallRecordGetRenderAreaGranularity,
+    InterceptIdPreCallValidateCreateCommandPool,
+    InterceptIdPreCallRecordCreateCommandPool,
+    InterceptIdPostCallRecordCreateCommandPool,
+    InterceptIdPreCallValidateDestroyCommandPool,
+    InterceptIdPreCallRecordDestroyCommandPool,
+    InterceptIdPostCallRecordDestroyCommandPool,
+    InterceptIdPreCallValidateResetCommandPool,
+    InterceptIdPreCallRecordResetCommandPool,
+    InterceptIdPostCallRecordResetCommandPool,
+    InterceptIdPreCallValidateAllocateCommandBuffers,
+    InterceptIdPreCallRecordAllocateCommandBuffers,
+    InterceptIdPostCallRecordAllocateCommandBuffers,
+    InterceptIdPreCallValidateFreeCommandBuffers,
+    InterceptIdPreCallRecordFreeCommandBuffers,
+    InterceptIdPostCallRecordFreeCommandBuffers,
+    InterceptIdPreCallValidateBeginCommandBuffer,
+    InterceptIdPreCallRecordBeginCommandBuffer,
+    InterceptIdPostCallRecordBeginCommandBuffer,
+    InterceptIdPreCallValidateEndCommandBuffer,
+    InterceptIdPreCallRecordEndCommandBuffer,
+    InterceptIdPostCallRecordEndCommandBuffer,
+    InterceptIdPreCallValidateResetCommandBuffer,
+    InterceptIdPreCallRecordResetCommandBuffer,
+    InterceptIdPostCallRecordResetCommandBuffer,
+    InterceptIdPreCallValidateCmdBindPipeline,
+    InterceptIdPreCallRecordCmdBindPipeline,
+    InterceptIdPostCallRecordCmdBindPipeline,
+    InterceptIdPreCallValidateCmdSetViewport,
+    InterceptIdPreCallRecordCmdSetViewport,
+    InterceptIdPostCallRecordCmdSetViewport,
+    InterceptIdPreCallValidateCmdSetScissor,
+    InterceptIdPreCallRecordCmdSetScissor,
+    InterceptIdPostCallRecordCmdSetScissor,
+    InterceptIdPreCallValidateCmdSetLineWidth,
+    InterceptIdPreCallRecordCmdSetLineWidth,
+    InterceptIdPostCallRecordCmdSetLineWidth,
+    InterceptIdPreCallValidateCmdSetDepthBias,
+    InterceptIdPreCallRecordCmdSetDepthBias,
+    InterceptIdPostCallRecordCmdSetDepthBias,
+    InterceptIdPreCallValidateCmdSetBlendConstants,
+    InterceptIdPreCallRecordCmdSetBlendConstants,
+    InterceptIdPostCallRecordCmdSetBlendConstants,
+    InterceptIdPreCallValidateCmdSetDepthBounds,
+    InterceptIdPreCallRecordCmdSetDepthBounds,
+    InterceptIdPostCallRecordCmdSetDepthBounds,
+    InterceptIdPreCallValidateCmdSetStencilCompareMask,
+    InterceptIdPreCallRecordCmdSetStencilCompareMask,
+    InterceptIdPostCallRecordCmdSetStencilCompareMask,
+    InterceptIdPreCallValidateCmdSetStencilWriteMask,
+    InterceptIdPreCallRecordCmdSetStencilWriteMask,
+    InterceptIdPostCallRecordCmdSetStencilWriteMask,
+    InterceptIdPreCallValidateCmdSetStencilReference,
+    InterceptIdPreCallRecordCmdSetStencilReference,
+    InterceptIdPostCallRecordCmdSetStencilReference,
+    InterceptIdPreCallValidateCmdBindDescriptorSets,
+    InterceptIdPreCallRecordCmdBindDescriptorSets,
+    InterceptIdPostCallRecordCmdBindDescriptorSets,
+    InterceptIdPreCallValidateCmdBindIndexBuffer,
+    InterceptIdPreCallRecordCmdBindIndexBuffer,
+    InterceptIdPostCallRecordCmdBindIndexBuffer,
+    InterceptIdPreCallValidateCmdBindVertexBuffers,
+    InterceptIdPreCallRecordCmdBindVertexBuffers,
+    InterceptIdPostCallRecordCmdBindVertexBuffers,
+    InterceptIdPreCallValidateCmdDraw,
+    InterceptIdPreCallRecordCmdDraw,
+    InterceptIdPostCallRecordCmdDraw,
+    InterceptIdPreCallValidateCmdDrawIndexed,
+    InterceptIdPreCallRecordCmdDrawIndexed,
+    InterceptIdPostCallRecordCmdDrawIndexed,
+    InterceptIdPreCallValidateCmdDrawIndirect,
+    InterceptIdPreCallRecordCmdDrawIndirect,
+    InterceptIdPostCallRecordCmdDrawIndirect,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirect,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirect,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirect,
+    InterceptIdPreCallValidateCmdDispatch,
+    InterceptIdPreCallRecordCmdDispatch,
+    InterceptIdPostCallRecordCmdDispatch,
+    InterceptIdPreCallValidateCmdDispatchIndirect,
+    InterceptIdPreCallRecordCmdDispatchIndirect,
+    InterceptIdPostCallRecordCmdDispatchIndirect,
+    InterceptIdPreCallValidateCmdCopyBuffer,
+    InterceptIdPreCallRecordCmdCopyBuffer,
+    InterceptIdPostCallRecordCmdCopyBuffer,
+    InterceptIdPreCallValidateCmdCopyImage,
+    InterceptIdPreCallRecordCmdCopyImage,
+    InterceptIdPostCallRecordCmdCopyImage,
+    InterceptIdPreCallValidateCmdBlitImage,
+    InterceptIdPreCallRecordCmdBlitImage,
+    InterceptIdPostCallRecordCmdBlitImage,
+    InterceptIdPreCallValidateCmdCopyBufferToImage,
+    InterceptIdPreCallRecordCmdCopyBufferToImage,
+    InterceptIdPostCallRecordCmdCopyBufferToImage,
+    InterceptIdPreCallValidateCmdCopyImageToBuffer,
+    InterceptIdPreCallRecordCmdCopyImageToBuffer,
+    InterceptIdPostCallRecordCmdCopyImageToBuffer,
+    InterceptIdPreCallValidateCmdUpdateBuffer,
+    InterceptIdPreCallRecordCmdUpdateBuffer,
+    InterceptIdPostCallRecordCmdUpdateBuffer,
+    InterceptIdPreCallValidateCmdFillBuffer,
+    InterceptIdPreCallRecordCmdFillBuffer,
+    InterceptIdPostCallRecordCmdFillBuffer,
+    InterceptIdPreCallValidateCmdClearColorImage,
+    InterceptIdPreCallRecordCmdClearColorImage,
+    InterceptIdPostCallRecordCmdClearColorImage,
+    InterceptIdPreCallValidateCmdClearDepthStencilImage,
+    InterceptIdPreCallRecordCmdClearDepthStencilImage,
+    InterceptIdPostCallRecordCmdClearDepthStencilImage,
+    InterceptIdPreCallValidateCmdClearAttachments,
+    InterceptIdPreCallRecordCmdClearAttachments,
+    InterceptIdPostCallRecordCmdClearAttachments,
+    InterceptIdPreCallValidateCmdResolveImage,
+    InterceptIdPreCallRecordCmdResolveImage,
+    InterceptIdPostCallRecordCmdResolveImage,
+    InterceptIdPreCallValidateCmdSetEvent,
+    InterceptIdPreCallRecordCmdSetEvent,
+    InterceptIdPostCallRecordCmdSetEvent,
+    InterceptIdPreCallValidateCmdResetEvent,
+    InterceptIdPreCallRecordCmdResetEvent,
+    InterceptIdPostCallRecordCmdResetEvent,
+    InterceptIdPreCallValidateCmdWaitEvents,
+    InterceptIdPreCallRecordCmdWaitEvents,
+    InterceptIdPostCallRecordCmdWaitEvents,
+    InterceptIdPreCallValidateCmdPipelineBarrier,
+    InterceptIdPreCallRecordCmdPipelineBarrier,
+    InterceptIdPostCallRecordCmdPipelineBarrier,
+    InterceptIdPreCallValidateCmdBeginQuery,
+    InterceptIdPreCallRecordCmdBeginQuery,
+    InterceptIdPostCallRecordCmdBeginQuery,
+    InterceptIdPreCallValidateCmdEndQuery,
+    InterceptIdPreCallRecordCmdEndQuery,
+    InterceptIdPostCallRecordCmdEndQuery,
+    InterceptIdPreCallValidateCmdResetQueryPool,
+    InterceptIdPreCallRecordCmdResetQueryPool,
+    InterceptIdPostCallRecordCmdResetQueryPool,
+    InterceptIdPreCallValidateCmdWriteTimestamp,
+    InterceptIdPreCallRecordCmdWriteTimestamp,
+    InterceptIdPostCallRecordCmdWriteTimestamp,
+    InterceptIdPreCallValidateCmdCopyQueryPoolResults,
+    InterceptIdPreCallRecordCmdCopyQueryPoolResults,
+    InterceptIdPostCallRecordCmdCopyQueryPoolResults,
+    InterceptIdPreCallValidateCmdPushConstants,
+    InterceptIdPreCallRecordCmdPushConstants,
+    InterceptIdPostCallRecordCmdPushConstants,
+    InterceptIdPreCallValidateCmdBeginRenderPass,
+    InterceptIdPreCallRecordCmdBeginRenderPass,
+    InterceptIdPostCallRecordCmdBeginRenderPass,
+    InterceptIdPreCallValidateCmdNextSubpass,
+    InterceptIdPreCallRecordCmdNextSubpass,
+    InterceptIdPostCallRecordCmdNextSubpass,
+    InterceptIdPreCallValidateCmdEndRenderPass,
+    InterceptIdPreCallRecordCmdEndRenderPass,
+    InterceptIdPostCallRecordCmdEndRenderPass,
+    InterceptIdPreCallValidateCmdExecuteCommands,
+    InterceptIdPreCallRecordCmdExecuteCommands,
+    InterceptIdPostCallRecordCmdExecuteCommands,
+    InterceptIdPreCallValidateBindBufferMemory2,
+    InterceptIdPreCallRecordBindBufferMemory2,
+    InterceptIdPostCallRecordBindBufferMemory2,
+    InterceptIdPreCallValidateBindImageMemory2,
+    InterceptIdPreCallRecordBindImageMemory2,
+    InterceptIdPostCallRecordBindImageMemory2,
+    InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeatures,
+    InterceptIdPreCallValidateCmdSetDeviceMask,
+    InterceptIdPreCallRecordCmdSetDeviceMask,
+    InterceptIdPostCallRecordCmdSetDeviceMask,
+    InterceptIdPreCallValidateCmdDispatchBase,
+    InterceptIdPreCallRecordCmdDispatchBase,
+    InterceptIdPostCallRecordCmdDispatchBase,
+    InterceptIdPreCallValidateEnumeratePhysicalDeviceGroups,
+    InterceptIdPreCallRecordEnumeratePhysicalDeviceGroups,
+    InterceptIdPostCallRecordEnumeratePhysicalDeviceGroups,
+    InterceptIdPreCallValidateGetImageMemoryRequirements2,
+    InterceptIdPreCallRecordGetImageMemoryRequirements2,
+    InterceptIdPostCallRecordGetImageMemoryRequirements2,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements2,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements2,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements2,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements2,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements2,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements2,
+    InterceptIdPreCallValidateGetPhysicalDeviceFeatures2,
+    InterceptIdPreCallRecordGetPhysicalDeviceFeatures2,
+    InterceptIdPostCallRecordGetPhysicalDeviceFeatures2,
+    InterceptIdPreCallValidateGetPhysicalDeviceProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties2,
+    InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties2,
+    InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties2,
+    InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties2,
+    InterceptIdPreCallValidateTrimCommandPool,
+    InterceptIdPreCallRecordTrimCommandPool,
+    InterceptIdPostCallRecordTrimCommandPool,
+    InterceptIdPreCallValidateGetDeviceQueue2,
+    InterceptIdPreCallRecordGetDeviceQueue2,
+    InterceptIdPostCallRecordGetDeviceQueue2,
+    InterceptIdPreCallValidateCreateSamplerYcbcrConversion,
+    InterceptIdPreCallRecordCreateSamplerYcbcrConversion,
+    InterceptIdPostCallRecordCreateSamplerYcbcrConversion,
+    InterceptIdPreCallValidateDestroySamplerYcbcrConversion,
+    InterceptIdPreCallRecordDestroySamplerYcbcrConversion,
+    InterceptIdPostCallRecordDestroySamplerYcbcrConversion,
+    InterceptIdPreCallValidateCreateDescriptorUpdateTemplate,
+    InterceptIdPreCallRecordCreateDescriptorUpdateTemplate,
+    InterceptIdPostCallRecordCreateDescriptorUpdateTemplate,
+    InterceptIdPreCallValidateDestroyDescriptorUpdateTemplate,
+    InterceptIdPreCallRecordDestroyDescriptorUpdateTemplate,
+    InterceptIdPostCallRecordDestroyDescriptorUpdateTemplate,
+    InterceptIdPreCallValidateUpdateDescriptorSetWithTemplate,
+    InterceptIdPreCallRecordUpdateDescriptorSetWithTemplate,
+    InterceptIdPostCallRecordUpdateDescriptorSetWithTemplate,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalBufferProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalBufferProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalBufferProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalFenceProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalFenceProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalFenceProperties,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalSemaphoreProperties,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalSemaphoreProperties,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalSemaphoreProperties,
+    InterceptIdPreCallValidateGetDescriptorSetLayoutSupport,
+    InterceptIdPreCallRecordGetDescriptorSetLayoutSupport,
+    InterceptIdPostCallRecordGetDescriptorSetLayoutSupport,
+    InterceptIdPreCallValidateDestroySurfaceKHR,
+    InterceptIdPreCallRecordDestroySurfaceKHR,
+    InterceptIdPostCallRecordDestroySurfaceKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceSupportKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilitiesKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceFormatsKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceFormatsKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceFormatsKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfacePresentModesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfacePresentModesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfacePresentModesKHR,
+    InterceptIdPreCallValidateCreateSwapchainKHR,
+    InterceptIdPreCallRecordCreateSwapchainKHR,
+    InterceptIdPostCallRecordCreateSwapchainKHR,
+    InterceptIdPreCallValidateDestroySwapchainKHR,
+    InterceptIdPreCallRecordDestroySwapchainKHR,
+    InterceptIdPostCallRecordDestroySwapchainKHR,
+    InterceptIdPreCallValidateGetSwapchainImagesKHR,
+    InterceptIdPreCallRecordGetSwapchainImagesKHR,
+    InterceptIdPostCallRecordGetSwapchainImagesKHR,
+    InterceptIdPreCallValidateAcquireNextImageKHR,
+    InterceptIdPreCallRecordAcquireNextImageKHR,
+    InterceptIdPostCallRecordAcquireNextImageKHR,
+    InterceptIdPreCallValidateQueuePresentKHR,
+    InterceptIdPreCallRecordQueuePresentKHR,
+    InterceptIdPostCallRecordQueuePresentKHR,
+    InterceptIdPreCallValidateGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupPresentCapabilitiesKHR,
+    InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModesKHR,
+    InterceptIdPreCallValidateGetPhysicalDevicePresentRectanglesKHR,
+    InterceptIdPreCallRecordGetPhysicalDevicePresentRectanglesKHR,
+    InterceptIdPostCallRecordGetPhysicalDevicePresentRectanglesKHR,
+    InterceptIdPreCallValidateAcquireNextImage2KHR,
+    InterceptIdPreCallRecordAcquireNextImage2KHR,
+    InterceptIdPostCallRecordAcquireNextImage2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayPropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayPropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayPropertiesKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayPlanePropertiesKHR,
+    InterceptIdPreCallValidateGetDisplayPlaneSupportedDisplaysKHR,
+    InterceptIdPreCallRecordGetDisplayPlaneSupportedDisplaysKHR,
+    InterceptIdPostCallRecordGetDisplayPlaneSupportedDisplaysKHR,
+    InterceptIdPreCallValidateGetDisplayModePropertiesKHR,
+    InterceptIdPreCallRecordGetDisplayModePropertiesKHR,
+    InterceptIdPostCallRecordGetDisplayModePropertiesKHR,
+    InterceptIdPreCallValidateCreateDisplayModeKHR,
+    InterceptIdPreCallRecordCreateDisplayModeKHR,
+    InterceptIdPostCallRecordCreateDisplayModeKHR,
+    InterceptIdPreCallValidateGetDisplayPlaneCapabilitiesKHR,
+    InterceptIdPreCallRecordGetDisplayPlaneCapabilitiesKHR,
+    InterceptIdPostCallRecordGetDisplayPlaneCapabilitiesKHR,
+    InterceptIdPreCallValidateCreateDisplayPlaneSurfaceKHR,
+    InterceptIdPreCallRecordCreateDisplayPlaneSurfaceKHR,
+    InterceptIdPostCallRecordCreateDisplayPlaneSurfaceKHR,
+    InterceptIdPreCallValidateCreateSharedSwapchainsKHR,
+    InterceptIdPreCallRecordCreateSharedSwapchainsKHR,
+    InterceptIdPostCallRecordCreateSharedSwapchainsKHR,
+    InterceptIdPreCallValidateCreateXlibSurfaceKHR,
+    InterceptIdPreCallRecordCreateXlibSurfaceKHR,
+    InterceptIdPostCallRecordCreateXlibSurfaceKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceXlibPresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceXlibPresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceXlibPresentationSupportKHR,
+    InterceptIdPreCallValidateCreateXcbSurfaceKHR,
+    InterceptIdPreCallRecordCreateXcbSurfaceKHR,
+    InterceptIdPostCallRecordCreateXcbSurfaceKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceXcbPresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceXcbPresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceXcbPresentationSupportKHR,
+    InterceptIdPreCallValidateCreateWaylandSurfaceKHR,
+    InterceptIdPreCallRecordCreateWaylandSurfaceKHR,
+    InterceptIdPostCallRecordCreateWaylandSurfaceKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceWaylandPresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceWaylandPresentationSupportKHR,
+    InterceptIdPreCallValidateCreateAndroidSurfaceKHR,
+    InterceptIdPreCallRecordCreateAndroidSurfaceKHR,
+    InterceptIdPostCallRecordCreateAndroidSurfaceKHR,
+    InterceptIdPreCallValidateCreateWin32SurfaceKHR,
+    InterceptIdPreCallRecordCreateWin32SurfaceKHR,
+    InterceptIdPostCallRecordCreateWin32SurfaceKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceWin32PresentationSupportKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceWin32PresentationSupportKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceWin32PresentationSupportKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceFeatures2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceFeatures2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceFeatures2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceFormatProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceFormatProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceFormatProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceImageFormatProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceImageFormatProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceImageFormatProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceQueueFamilyProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceQueueFamilyProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceMemoryProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceMemoryProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceMemoryProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSparseImageFormatProperties2KHR,
+    InterceptIdPreCallValidateGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPreCallRecordGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPostCallRecordGetDeviceGroupPeerMemoryFeaturesKHR,
+    InterceptIdPreCallValidateCmdSetDeviceMaskKHR,
+    InterceptIdPreCallRecordCmdSetDeviceMaskKHR,
+    InterceptIdPostCallRecordCmdSetDeviceMaskKHR,
+    InterceptIdPreCallValidateCmdDispatchBaseKHR,
+    InterceptIdPreCallRecordCmdDispatchBaseKHR,
+    InterceptIdPostCallRecordCmdDispatchBaseKHR,
+    InterceptIdPreCallValidateTrimCommandPoolKHR,
+    InterceptIdPreCallRecordTrimCommandPoolKHR,
+    InterceptIdPostCallRecordTrimCommandPoolKHR,
+    InterceptIdPreCallValidateEnumeratePhysicalDeviceGroupsKHR,
+    InterceptIdPreCallRecordEnumeratePhysicalDeviceGroupsKHR,
+    InterceptIdPostCallRecordEnumeratePhysicalDeviceGroupsKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalBufferPropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalBufferPropertiesKHR,
+    InterceptIdPreCallValidateGetMemoryWin32HandleKHR,
+    InterceptIdPreCallRecordGetMemoryWin32HandleKHR,
+    InterceptIdPostCallRecordGetMemoryWin32HandleKHR,
+    InterceptIdPreCallValidateGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPreCallRecordGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPostCallRecordGetMemoryWin32HandlePropertiesKHR,
+    InterceptIdPreCallValidateGetMemoryFdKHR,
+    InterceptIdPreCallRecordGetMemoryFdKHR,
+    InterceptIdPostCallRecordGetMemoryFdKHR,
+    InterceptIdPreCallValidateGetMemoryFdPropertiesKHR,
+    InterceptIdPreCallRecordGetMemoryFdPropertiesKHR,
+    InterceptIdPostCallRecordGetMemoryFdPropertiesKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalSemaphorePropertiesKHR,
+    InterceptIdPreCallValidateImportSemaphoreWin32HandleKHR,
+    InterceptIdPreCallRecordImportSemaphoreWin32HandleKHR,
+    InterceptIdPostCallRecordImportSemaphoreWin32HandleKHR,
+    InterceptIdPreCallValidateGetSemaphoreWin32HandleKHR,
+    InterceptIdPreCallRecordGetSemaphoreWin32HandleKHR,
+    InterceptIdPostCallRecordGetSemaphoreWin32HandleKHR,
+    InterceptIdPreCallValidateImportSemaphoreFdKHR,
+    InterceptIdPreCallRecordImportSemaphoreFdKHR,
+    InterceptIdPostCallRecordImportSemaphoreFdKHR,
+    InterceptIdPreCallValidateGetSemaphoreFdKHR,
+    InterceptIdPreCallRecordGetSemaphoreFdKHR,
+    InterceptIdPostCallRecordGetSemaphoreFdKHR,
+    InterceptIdPreCallValidateCmdPushDescriptorSetKHR,
+    InterceptIdPreCallRecordCmdPushDescriptorSetKHR,
+    InterceptIdPostCallRecordCmdPushDescriptorSetKHR,
+    InterceptIdPreCallValidateCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPostCallRecordCmdPushDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallValidateCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallRecordCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPostCallRecordCreateDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallValidateDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallRecordDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPostCallRecordDestroyDescriptorUpdateTemplateKHR,
+    InterceptIdPreCallValidateUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPostCallRecordUpdateDescriptorSetWithTemplateKHR,
+    InterceptIdPreCallRecordCreateRenderPass2KHR,
+    InterceptIdPreCallValidateCmdBeginRenderPass2KHR,
+    InterceptIdPreCallRecordCmdBeginRenderPass2KHR,
+    InterceptIdPostCallRecordCmdBeginRenderPass2KHR,
+    InterceptIdPreCallValidateCmdNextSubpass2KHR,
+    InterceptIdPreCallRecordCmdNextSubpass2KHR,
+    InterceptIdPostCallRecordCmdNextSubpass2KHR,
+    InterceptIdPreCallValidateCmdEndRenderPass2KHR,
+    InterceptIdPreCallRecordCmdEndRenderPass2KHR,
+    InterceptIdPostCallRecordCmdEndRenderPass2KHR,
+    InterceptIdPreCallValidateGetSwapchainStatusKHR,
+    InterceptIdPreCallRecordGetSwapchainStatusKHR,
+    InterceptIdPostCallRecordGetSwapchainStatusKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalFencePropertiesKHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalFencePropertiesKHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalFencePropertiesKHR,
+    InterceptIdPreCallValidateImportFenceWin32HandleKHR,
+    InterceptIdPreCallRecordImportFenceWin32HandleKHR,
+    InterceptIdPostCallRecordImportFenceWin32HandleKHR,
+    InterceptIdPreCallValidateGetFenceWin32HandleKHR,
+    InterceptIdPreCallRecordGetFenceWin32HandleKHR,
+    InterceptIdPostCallRecordGetFenceWin32HandleKHR,
+    InterceptIdPreCallValidateImportFenceFdKHR,
+    InterceptIdPreCallRecordImportFenceFdKHR,
+    InterceptIdPostCallRecordImportFenceFdKHR,
+    InterceptIdPreCallValidateGetFenceFdKHR,
+    InterceptIdPreCallRecordGetFenceFdKHR,
+    InterceptIdPostCallRecordGetFenceFdKHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilities2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilities2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceFormats2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceFormats2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceFormats2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayProperties2KHR,
+    InterceptIdPreCallValidateGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    InterceptIdPreCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    InterceptIdPostCallRecordGetPhysicalDeviceDisplayPlaneProperties2KHR,
+    InterceptIdPreCallValidateGetDisplayModeProperties2KHR,
+    InterceptIdPreCallRecordGetDisplayModeProperties2KHR,
+    InterceptIdPostCallRecordGetDisplayModeProperties2KHR,
+    InterceptIdPreCallValidateGetDisplayPlaneCapabilities2KHR,
+    InterceptIdPreCallRecordGetDisplayPlaneCapabilities2KHR,
+    InterceptIdPostCallRecordGetDisplayPlaneCapabilities2KHR,
+    InterceptIdPreCallValidateGetImageMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetImageMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetImageMemoryRequirements2KHR,
+    InterceptIdPreCallValidateGetBufferMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetBufferMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetBufferMemoryRequirements2KHR,
+    InterceptIdPreCallValidateGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPreCallRecordGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPostCallRecordGetImageSparseMemoryRequirements2KHR,
+    InterceptIdPreCallValidateCreateSamplerYcbcrConversionKHR,
+    InterceptIdPreCallRecordCreateSamplerYcbcrConversionKHR,
+    InterceptIdPostCallRecordCreateSamplerYcbcrConversionKHR,
+    InterceptIdPreCallValidateDestroySamplerYcbcrConversionKHR,
+    InterceptIdPreCallRecordDestroySamplerYcbcrConversionKHR,
+    InterceptIdPostCallRecordDestroySamplerYcbcrConversionKHR,
+    InterceptIdPreCallValidateBindBufferMemory2KHR,
+    InterceptIdPreCallRecordBindBufferMemory2KHR,
+    InterceptIdPostCallRecordBindBufferMemory2KHR,
+    InterceptIdPreCallValidateBindImageMemory2KHR,
+    InterceptIdPreCallRecordBindImageMemory2KHR,
+    InterceptIdPostCallRecordBindImageMemory2KHR,
+    InterceptIdPreCallValidateGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPreCallRecordGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPostCallRecordGetDescriptorSetLayoutSupportKHR,
+    InterceptIdPreCallValidateCmdDrawIndirectCountKHR,
+    InterceptIdPreCallRecordCmdDrawIndirectCountKHR,
+    InterceptIdPostCallRecordCmdDrawIndirectCountKHR,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCountKHR,
+    InterceptIdPreCallValidateCreateDebugReportCallbackEXT,
+    InterceptIdPreCallRecordCreateDebugReportCallbackEXT,
+    InterceptIdPostCallRecordCreateDebugReportCallbackEXT,
+    InterceptIdPreCallValidateDestroyDebugReportCallbackEXT,
+    InterceptIdPreCallRecordDestroyDebugReportCallbackEXT,
+    InterceptIdPostCallRecordDestroyDebugReportCallbackEXT,
+    InterceptIdPreCallValidateDebugReportMessageEXT,
+    InterceptIdPreCallRecordDebugReportMessageEXT,
+    InterceptIdPostCallRecordDebugReportMessageEXT,
+    InterceptIdPreCallValidateDebugMarkerSetObjectTagEXT,
+    InterceptIdPreCallRecordDebugMarkerSetObjectTagEXT,
+    InterceptIdPostCallRecordDebugMarkerSetObjectTagEXT,
+    InterceptIdPreCallValidateDebugMarkerSetObjectNameEXT,
+    InterceptIdPreCallRecordDebugMarkerSetObjectNameEXT,
+    InterceptIdPostCallRecordDebugMarkerSetObjectNameEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerBeginEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerBeginEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerBeginEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerEndEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerEndEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerEndEXT,
+    InterceptIdPreCallValidateCmdDebugMarkerInsertEXT,
+    InterceptIdPreCallRecordCmdDebugMarkerInsertEXT,
+    InterceptIdPostCallRecordCmdDebugMarkerInsertEXT,
+    InterceptIdPreCallValidateCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPreCallRecordCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPostCallRecordCmdBindTransformFeedbackBuffersEXT,
+    InterceptIdPreCallValidateCmdBeginTransformFeedbackEXT,
+    InterceptIdPreCallRecordCmdBeginTransformFeedbackEXT,
+    InterceptIdPostCallRecordCmdBeginTransformFeedbackEXT,
+    InterceptIdPreCallValidateCmdEndTransformFeedbackEXT,
+    InterceptIdPreCallRecordCmdEndTransformFeedbackEXT,
+    InterceptIdPostCallRecordCmdEndTransformFeedbackEXT,
+    InterceptIdPreCallValidateCmdBeginQueryIndexedEXT,
+    InterceptIdPreCallRecordCmdBeginQueryIndexedEXT,
+    InterceptIdPostCallRecordCmdBeginQueryIndexedEXT,
+    InterceptIdPreCallValidateCmdEndQueryIndexedEXT,
+    InterceptIdPreCallRecordCmdEndQueryIndexedEXT,
+    InterceptIdPostCallRecordCmdEndQueryIndexedEXT,
+    InterceptIdPreCallValidateCmdDrawIndirectByteCountEXT,
+    InterceptIdPreCallRecordCmdDrawIndirectByteCountEXT,
+    InterceptIdPostCallRecordCmdDrawIndirectByteCountEXT,
+    InterceptIdPreCallValidateGetImageViewHandleNVX,
+    InterceptIdPreCallRecordGetImageViewHandleNVX,
+    InterceptIdPostCallRecordGetImageViewHandleNVX,
+    InterceptIdPreCallValidateCmdDrawIndirectCountAMD,
+    InterceptIdPreCallRecordCmdDrawIndirectCountAMD,
+    InterceptIdPostCallRecordCmdDrawIndirectCountAMD,
+    InterceptIdPreCallValidateCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPreCallRecordCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPostCallRecordCmdDrawIndexedIndirectCountAMD,
+    InterceptIdPreCallValidateGetShaderInfoAMD,
+    InterceptIdPreCallRecordGetShaderInfoAMD,
+    InterceptIdPostCallRecordGetShaderInfoAMD,
+    InterceptIdPreCallValidateCreateStreamDescriptorSurfaceGGP,
+    InterceptIdPreCallRecordCreateStreamDescriptorSurfaceGGP,
+    InterceptIdPostCallRecordCreateStreamDescriptorSurfaceGGP,
+    InterceptIdPreCallValidateGetPhysicalDeviceExternalImageFormatPropertiesNV,
+    InterceptIdPreCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV,
+    InterceptIdPostCallRecordGetPhysicalDeviceExternalImageFormatPropertiesNV,
+    InterceptIdPreCallValidateGetMemoryWin32HandleNV,
+    InterceptIdPreCallRecordGetMemoryWin32HandleNV,
+    InterceptIdPostCallRecordGetMemoryWin32HandleNV,
+    InterceptIdPreCallValidateCreateViSurfaceNN,
+    InterceptIdPreCallRecordCreateViSurfaceNN,
+    InterceptIdPostCallRecordCreateViSurfaceNN,
+    InterceptIdPreCallValidateCmdBeginConditionalRenderingEXT,
+    InterceptIdPreCallRecordCmdBeginConditionalRenderingEXT,
+    InterceptIdPostCallRecordCmdBeginConditionalRenderingEXT,
+    InterceptIdPreCallValidateCmdEndConditionalRenderingEXT,
+    InterceptIdPreCallRecordCmdEndConditionalRenderingEXT,
+    InterceptIdPostCallRecordCmdEndConditionalRenderingEXT,
+    InterceptIdPreCallValidateCmdProcessCommandsNVX,
+    InterceptIdPreCallRecordCmdProcessCommandsNVX,
+    InterceptIdPostCallRecordCmdProcessCommandsNVX,
+    InterceptIdPreCallValidateCmdReserveSpaceForCommandsNVX,
+    InterceptIdPreCallRecordCmdReserveSpaceForCommandsNVX,
+    InterceptIdPostCallRecordCmdReserveSpaceForCommandsNVX,
+    InterceptIdPreCallValidateCreateIndirectCommandsLayoutNVX,
+    InterceptIdPreCallRecordCreateIndirectCommandsLayoutNVX,
+    InterceptIdPostCallRecordCreateIndirectCommandsLayoutNVX,
+    InterceptIdPreCallValidateDestroyIndirectCommandsLayoutNVX,
+    InterceptIdPreCallRecordDestroyIndirectCommandsLayoutNVX,
+    InterceptIdPostCallRecordDestroyIndirectCommandsLayoutNVX,
+    InterceptIdPreCallValidateCreateObjectTableNVX,
+    InterceptIdPreCallRecordCreateObjectTableNVX,
+    InterceptIdPostCallRecordCreateObjectTableNVX,
+    InterceptIdPreCallValidateDestroyObjectTableNVX,
+    InterceptIdPreCallRecordDestroyObjectTableNVX,
+    InterceptIdPostCallRecordDestroyObjectTableNVX,
+    InterceptIdPreCallValidateRegisterObjectsNVX,
+    InterceptIdPreCallRecordRegisterObjectsNVX,
+    InterceptIdPostCallRecordRegisterObjectsNVX,
+    InterceptIdPreCallValidateUnregisterObjectsNVX,
+    InterceptIdPreCallRecordUnregisterObjectsNVX,
+    InterceptIdPostCallRecordUnregisterObjectsNVX,
+    InterceptIdPreCallValidateGetPhysicalDeviceGeneratedCommandsPropertiesNVX,
+    InterceptIdPreCallRecordGetPhysicalDeviceGeneratedCommandsPropertiesNVX,
+    InterceptIdPostCallRecordGetPhysicalDeviceGeneratedCommandsPropertiesNVX,
+    InterceptIdPreCallValidateCmdSetViewportWScalingNV,
+    InterceptIdPreCallRecordCmdSetViewportWScalingNV,
+    InterceptIdPostCallRecordCmdSetViewportWScalingNV,
+    InterceptIdPreCallValidateReleaseDisplayEXT,
+    InterceptIdPreCallRecordReleaseDisplayEXT,
+    InterceptIdPostCallRecordReleaseDisplayEXT,
+    InterceptIdPreCallValidateAcquireXlibDisplayEXT,
+    InterceptIdPreCallRecordAcquireXlibDisplayEXT,
+    InterceptIdPostCallRecordAcquireXlibDisplayEXT,
+    InterceptIdPreCallValidateGetRandROutputDisplayEXT,
+    InterceptIdPreCallRecordGetRandROutputDisplayEXT,
+    InterceptIdPostCallRecordGetRandROutputDisplayEXT,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfaceCapabilities2EXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfaceCapabilities2EXT,
+    InterceptIdPreCallValidateDisplayPowerControlEXT,
+    InterceptIdPreCallRecordDisplayPowerControlEXT,
+    InterceptIdPostCallRecordDisplayPowerControlEXT,
+    InterceptIdPreCallValidateRegisterDeviceEventEXT,
+    InterceptIdPreCallRecordRegisterDeviceEventEXT,
+    InterceptIdPostCallRecordRegisterDeviceEventEXT,
+    InterceptIdPreCallValidateRegisterDisplayEventEXT,
+    InterceptIdPreCallRecordRegisterDisplayEventEXT,
+    InterceptIdPostCallRecordRegisterDisplayEventEXT,
+    InterceptIdPreCallValidateGetSwapchainCounterEXT,
+    InterceptIdPreCallRecordGetSwapchainCounterEXT,
+    InterceptIdPostCallRecordGetSwapchainCounterEXT,
+    InterceptIdPreCallValidateGetRefreshCycleDurationGOOGLE,
+    InterceptIdPreCallRecordGetRefreshCycleDurationGOOGLE,
+    InterceptIdPostCallRecordGetRefreshCycleDurationGOOGLE,
+    InterceptIdPreCallValidateGetPastPresentationTimingGOOGLE,
+    InterceptIdPreCallRecordGetPastPresentationTimingGOOGLE,
+    InterceptIdPostCallRecordGetPastPresentationTimingGOOGLE,
+    InterceptIdPreCallValidateCmdSetDiscardRectangleEXT,
+    InterceptIdPreCallRecordCmdSetDiscardRectangleEXT,
+    InterceptIdPostCallRecordCmdSetDiscardRectangleEXT,
+    InterceptIdPreCallValidateSetHdrMetadataEXT,
+    InterceptIdPreCallRecordSetHdrMetadataEXT,
+    InterceptIdPostCallRecordSetHdrMetadataEXT,
+    InterceptIdPreCallValidateCreateIOSSurfaceMVK,
+    InterceptIdPreCallRecordCreateIOSSurfaceMVK,
+    InterceptIdPostCallRecordCreateIOSSurfaceMVK,
+    InterceptIdPreCallValidateCreateMacOSSurfaceMVK,
+    InterceptIdPreCallRecordCreateMacOSSurfaceMVK,
+    InterceptIdPostCallRecordCreateMacOSSurfaceMVK,
+    InterceptIdPreCallValidateSetDebugUtilsObjectNameEXT,
+    InterceptIdPreCallRecordSetDebugUtilsObjectNameEXT,
+    InterceptIdPostCallRecordSetDebugUtilsObjectNameEXT,
+    InterceptIdPreCallValidateSetDebugUtilsObjectTagEXT,
+    InterceptIdPreCallRecordSetDebugUtilsObjectTagEXT,
+    InterceptIdPostCallRecordSetDebugUtilsObjectTagEXT,
+    InterceptIdPreCallValidateQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateQueueEndDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueEndDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueEndDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordQueueInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdBeginDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdEndDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdEndDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdEndDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallRecordCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPostCallRecordCmdInsertDebugUtilsLabelEXT,
+    InterceptIdPreCallValidateCreateDebugUtilsMessengerEXT,
+    InterceptIdPreCallRecordCreateDebugUtilsMessengerEXT,
+    InterceptIdPostCallRecordCreateDebugUtilsMessengerEXT,
+    InterceptIdPreCallValidateDestroyDebugUtilsMessengerEXT,
+    InterceptIdPreCallRecordDestroyDebugUtilsMessengerEXT,
+    InterceptIdPostCallRecordDestroyDebugUtilsMessengerEXT,
+    InterceptIdPreCallValidateSubmitDebugUtilsMessageEXT,
+    InterceptIdPreCallRecordSubmitDebugUtilsMessageEXT,
+    InterceptIdPostCallRecordSubmitDebugUtilsMessageEXT,
+    InterceptIdPreCallValidateGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPreCallRecordGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPostCallRecordGetAndroidHardwareBufferPropertiesANDROID,
+    InterceptIdPreCallValidateGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPreCallRecordGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPostCallRecordGetMemoryAndroidHardwareBufferANDROID,
+    InterceptIdPreCallValidateCmdSetSampleLocationsEXT,
+    InterceptIdPreCallRecordCmdSetSampleLocationsEXT,
+    InterceptIdPostCallRecordCmdSetSampleLocationsEXT,
+    InterceptIdPreCallValidateGetPhysicalDeviceMultisamplePropertiesEXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceMultisamplePropertiesEXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceMultisamplePropertiesEXT,
+    InterceptIdPreCallValidateGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPreCallRecordGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPostCallRecordGetImageDrmFormatModifierPropertiesEXT,
+    InterceptIdPreCallValidateCmdBindShadingRateImageNV,
+    InterceptIdPreCallRecordCmdBindShadingRateImageNV,
+    InterceptIdPostCallRecordCmdBindShadingRateImageNV,
+    InterceptIdPreCallValidateCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPreCallRecordCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPostCallRecordCmdSetViewportShadingRatePaletteNV,
+    InterceptIdPreCallValidateCmdSetCoarseSampleOrderNV,
+    InterceptIdPreCallRecordCmdSetCoarseSampleOrderNV,
+    InterceptIdPostCallRecordCmdSetCoarseSampleOrderNV,
+    InterceptIdPreCallValidateCreateAccelerationStructureNV,
+    InterceptIdPreCallRecordCreateAccelerationStructureNV,
+    InterceptIdPostCallRecordCreateAccelerationStructureNV,
+    InterceptIdPreCallValidateDestroyAccelerationStructureNV,
+    InterceptIdPreCallRecordDestroyAccelerationStructureNV,
+    InterceptIdPostCallRecordDestroyAccelerationStructureNV,
+    InterceptIdPreCallValidateGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPreCallRecordGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPostCallRecordGetAccelerationStructureMemoryRequirementsNV,
+    InterceptIdPreCallValidateBindAccelerationStructureMemoryNV,
+    InterceptIdPreCallRecordBindAccelerationStructureMemoryNV,
+    InterceptIdPostCallRecordBindAccelerationStructureMemoryNV,
+    InterceptIdPreCallValidateCmdBuildAccelerationStructureNV,
+    InterceptIdPreCallRecordCmdBuildAccelerationStructureNV,
+    InterceptIdPostCallRecordCmdBuildAccelerationStructureNV,
+    InterceptIdPreCallValidateCmdCopyAccelerationStructureNV,
+    InterceptIdPreCallRecordCmdCopyAccelerationStructureNV,
+    InterceptIdPostCallRecordCmdCopyAccelerationStructureNV,
+    InterceptIdPreCallValidateCmdTraceRaysNV,
+    InterceptIdPreCallRecordCmdTraceRaysNV,
+    InterceptIdPostCallRecordCmdTraceRaysNV,
+    InterceptIdPreCallValidateGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPreCallRecordGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPostCallRecordGetRayTracingShaderGroupHandlesNV,
+    InterceptIdPreCallValidateGetAccelerationStructureHandleNV,
+    InterceptIdPreCallRecordGetAccelerationStructureHandleNV,
+    InterceptIdPostCallRecordGetAccelerationStructureHandleNV,
+    InterceptIdPreCallValidateCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPreCallRecordCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPostCallRecordCmdWriteAccelerationStructuresPropertiesNV,
+    InterceptIdPreCallValidateCompileDeferredNV,
+    InterceptIdPreCallRecordCompileDeferredNV,
+    InterceptIdPostCallRecordCompileDeferredNV,
+    InterceptIdPreCallValidateGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPreCallRecordGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPostCallRecordGetMemoryHostPointerPropertiesEXT,
+    InterceptIdPreCallValidateCmdWriteBufferMarkerAMD,
+    InterceptIdPreCallRecordCmdWriteBufferMarkerAMD,
+    InterceptIdPostCallRecordCmdWriteBufferMarkerAMD,
+    InterceptIdPreCallValidateGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceCalibrateableTimeDomainsEXT,
+    InterceptIdPreCallValidateGetCalibratedTimestampsEXT,
+    InterceptIdPreCallRecordGetCalibratedTimestampsEXT,
+    InterceptIdPostCallRecordGetCalibratedTimestampsEXT,
+    InterceptIdPreCallValidateCmdDrawMeshTasksNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksNV,
+    InterceptIdPreCallValidateCmdDrawMeshTasksIndirectNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksIndirectNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksIndirectNV,
+    InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPreCallRecordCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPostCallRecordCmdDrawMeshTasksIndirectCountNV,
+    InterceptIdPreCallValidateCmdSetExclusiveScissorNV,
+    InterceptIdPreCallRecordCmdSetExclusiveScissorNV,
+    InterceptIdPostCallRecordCmdSetExclusiveScissorNV,
+    InterceptIdPreCallValidateCmdSetCheckpointNV,
+    InterceptIdPreCallRecordCmdSetCheckpointNV,
+    InterceptIdPostCallRecordCmdSetCheckpointNV,
+    InterceptIdPreCallValidateGetQueueCheckpointDataNV,
+    InterceptIdPreCallRecordGetQueueCheckpointDataNV,
+    InterceptIdPostCallRecordGetQueueCheckpointDataNV,
+    InterceptIdPreCallValidateInitializePerformanceApiINTEL,
+    InterceptIdPreCallRecordInitializePerformanceApiINTEL,
+    InterceptIdPostCallRecordInitializePerformanceApiINTEL,
+    InterceptIdPreCallValidateUninitializePerformanceApiINTEL,
+    InterceptIdPreCallRecordUninitializePerformanceApiINTEL,
+    InterceptIdPostCallRecordUninitializePerformanceApiINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceMarkerINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceMarkerINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceMarkerINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceStreamMarkerINTEL,
+    InterceptIdPreCallValidateCmdSetPerformanceOverrideINTEL,
+    InterceptIdPreCallRecordCmdSetPerformanceOverrideINTEL,
+    InterceptIdPostCallRecordCmdSetPerformanceOverrideINTEL,
+    InterceptIdPreCallValidateAcquirePerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordAcquirePerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordAcquirePerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateReleasePerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordReleasePerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordReleasePerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPreCallRecordQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPostCallRecordQueueSetPerformanceConfigurationINTEL,
+    InterceptIdPreCallValidateGetPerformanceParameterINTEL,
+    InterceptIdPreCallRecordGetPerformanceParameterINTEL,
+    InterceptIdPostCallRecordGetPerformanceParameterINTEL,
+    InterceptIdPreCallValidateSetLocalDimmingAMD,
+    InterceptIdPreCallRecordSetLocalDimmingAMD,
+    InterceptIdPostCallRecordSetLocalDimmingAMD,
+    InterceptIdPreCallValidateCreateImagePipeSurfaceFUCHSIA,
+    InterceptIdPreCallRecordCreateImagePipeSurfaceFUCHSIA,
+    InterceptIdPostCallRecordCreateImagePipeSurfaceFUCHSIA,
+    InterceptIdPreCallValidateCreateMetalSurfaceEXT,
+    InterceptIdPreCallRecordCreateMetalSurfaceEXT,
+    InterceptIdPostCallRecordCreateMetalSurfaceEXT,
+    InterceptIdPreCallValidateGetBufferDeviceAddressEXT,
+    InterceptIdPreCallRecordGetBufferDeviceAddressEXT,
+    InterceptIdPostCallRecordGetBufferDeviceAddressEXT,
+    InterceptIdPreCallValidateGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    InterceptIdPreCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    InterceptIdPostCallRecordGetPhysicalDeviceCooperativeMatrixPropertiesNV,
+    InterceptIdPreCallValidateGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    InterceptIdPreCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    InterceptIdPostCallRecordGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV,
+    InterceptIdPreCallValidateGetPhysicalDeviceSurfacePresentModes2EXT,
+    InterceptIdPreCallRecordGetPhysicalDeviceSurfacePresentModes2EXT,
+    InterceptIdPostCallRecordGetPhysicalDeviceSurfacePresentModes2EXT,
+    InterceptIdPreCallValidateAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPreCallRecordAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPostCallRecordAcquireFullScreenExclusiveModeEXT,
+    InterceptIdPreCallValidateReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPreCallRecordReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPostCallRecordReleaseFullScreenExclusiveModeEXT,
+    InterceptIdPreCallValidateGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPreCallRecordGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPostCallRecordGetDeviceGroupSurfacePresentModes2EXT,
+    InterceptIdPreCallValidateCreateHeadlessSurfaceEXT,
+    InterceptIdPreCallRecordCreateHeadlessSurfaceEXT,
+    InterceptIdPostCallRecordCreateHeadlessSurfaceEXT,
+    InterceptIdPreCallValidateResetQueryPoolEXT,
+    InterceptIdPreCallRecordResetQueryPoolEXT,
+    InterceptIdPostCallRecordResetQueryPoolEXT,
+    InterceptIdCount,
+} InterceptId;
+
+// Optional per-entry-point phase timing, enabled by building with -DVALIDATION_PHASE_TIMING.  Each
+// intercepted phase (PreCallValidate / PreCallRecord / PostCallRecord, keyed by InterceptId)
+// accumulates its call count plus total and max elapsed cycles into per-thread buffers, merged and
+// dumped as CSV when the last instance is destroyed.
+#if defined(VALIDATION_PHASE_TIMING)
+
+struct PhaseTimingRecord {
+    uint64_t count;
+    uint64_t total_cycles;
+    uint64_t max_cycles;
+};
+
+class PhaseTimingBuffer {
+  public:
+    PhaseTimingBuffer();
+    ~PhaseTimingBuffer();
+    static PhaseTimingBuffer &Get();
+    PhaseTimingRecord records[InterceptIdCount];
+};
+
+uint64_t PhaseTimingNow();
+void PhaseTimingAccumulate(InterceptId id, uint64_t cycles);
+// Write "entry_point_phase,count,total_cycles,max_cycles" CSV to the file named by the
+// VK_LAYER_PHASE_TIMING_FILE environment variable, or to stderr if it is unset
+void PhaseTimingDump();
+
+#define VVL_PHASE_BEGIN(id) uint64_t vvl_phase_start_##id = PhaseTimingNow()
+#define VVL_PHASE_END(id) PhaseTimingAccumulate(id, PhaseTimingNow() - vvl_phase_start_##id)
+
+#else
+
+#define VVL_PHASE_BEGIN(id)
+#define VVL_PHASE_END(id)
+
+#endif  // VALIDATION_PHASE_TIMING
@@ -30,6 +30,9 @@
 // This intentionally includes a cpp file
 #include "vk_safe_struct.cpp"
 
+// Guards the auxiliary handle-wrapping maps kept on ValidationObject (render pass subpass usage,
+// swapchain image lists, per-pool descriptor sets, descriptor template create infos).  The
+// unique_id_mapping itself is internally synchronized and no longer needs this lock.
 std::mutex dispatch_lock;
 
 // Unique Objects pNext extension handling function
@@ -2087,6 +2090,7 @@ VkResult DispatchCreateComputePipelines(VkDevice device, VkPipelineCache pipelin
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateComputePipelines(device, pipelineCache, createInfoCount,
                                                                                           pCreateInfos, pAllocator, pPipelines);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
         std::lock_guard<std::mutex> lock(dispatch_lock);
@@ -2129,6 +2133,7 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount,
                                                                                            pCreateInfos, pAllocator, pPipelines);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkGraphicsPipelineCreateInfo *local_pCreateInfos = nullptr;
     if (pCreateInfos) {
         local_pCreateInfos = new safe_VkGraphicsPipelineCreateInfo[createInfoCount];
@@ -2236,8 +2241,12 @@ void DispatchDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const V
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyRenderPass(device, renderPass, pAllocator);
     std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t renderPass_id = reinterpret_cast<uint64_t &>(renderPass);
-    renderPass = (VkRenderPass)unique_id_mapping[renderPass_id];
-    unique_id_mapping.erase(renderPass_id);
+    auto iter = layer_data->unique_id_mapping.pop(renderPass_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        renderPass = (VkRenderPass)iter->second;
+    } else {
+        renderPass = (VkRenderPass)0;
+    }
     lock.unlock();
     layer_data->device_dispatch_table.DestroyRenderPass(device, renderPass, pAllocator);
 
@@ -2249,13 +2258,14 @@ VkResult DispatchCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfo
                                     const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
     if (pCreateInfo) {
         std::lock_guard<std::mutex> lock(dispatch_lock);
         local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
         local_pCreateInfo->oldSwapchain = layer_data->Unwrap(pCreateInfo->oldSwapchain);
         // Surface is instance-level object
-        local_pCreateInfo->surface = layer_data->Unwrap(pCreateInfo->surface);
+        local_pCreateInfo->surface = layer_data->UnwrapInstanceScoped(pCreateInfo->surface);
     }
 
     VkResult result = layer_data->device_dispatch_table.CreateSwapchainKHR(device, local_pCreateInfo->ptr(), pAllocator, pSwapchain);
@@ -2274,6 +2284,7 @@ VkResult DispatchCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
     if (!wrap_handles)
         return layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator,
                                                                            pSwapchains);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSwapchainCreateInfoKHR *local_pCreateInfos = NULL;
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
@@ -2283,7 +2294,7 @@ VkResult DispatchCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
                 local_pCreateInfos[i].initialize(&pCreateInfos[i]);
                 if (pCreateInfos[i].surface) {
                     // Surface is instance-level object
-                    local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
+                    local_pCreateInfos[i].surface = layer_data->UnwrapInstanceScoped(pCreateInfos[i].surface);
                 }
                 if (pCreateInfos[i].oldSwapchain) {
                     local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
@@ -2337,13 +2348,17 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 
     auto &image_array = layer_data->swapchain_wrapped_image_handle_map[swapchain];
     for (auto &image_handle : image_array) {
-        unique_id_mapping.erase(HandleToUint64(image_handle));
+        layer_data->unique_id_mapping.erase(HandleToUint64(image_handle));
     }
     layer_data->swapchain_wrapped_image_handle_map.erase(swapchain);
 
     uint64_t swapchain_id = HandleToUint64(swapchain);
-    swapchain = (VkSwapchainKHR)unique_id_mapping[swapchain_id];
-    unique_id_mapping.erase(swapchain_id);
+    auto iter = layer_data->unique_id_mapping.pop(swapchain_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        swapchain = (VkSwapchainKHR)iter->second;
+    } else {
+        swapchain = (VkSwapchainKHR)0;
+    }
     lock.unlock();
     layer_data->device_dispatch_table.DestroySwapchainKHR(device, swapchain, pAllocator);
 }
@@ -2351,6 +2366,7 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 VkResult DispatchQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueuePresentKHR(queue, pPresentInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPresentInfoKHR *local_pPresentInfo = NULL;
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
@@ -2388,13 +2404,17 @@ void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorP
 
     // remove references to implicitly freed descriptor sets
     for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-        unique_id_mapping.erase(reinterpret_cast<uint64_t &>(descriptor_set));
+        layer_data->unique_id_mapping.erase(reinterpret_cast<uint64_t &>(descriptor_set));
     }
     layer_data->pool_descriptor_sets_map.erase(descriptorPool);
 
     uint64_t descriptorPool_id = reinterpret_cast<uint64_t &>(descriptorPool);
-    descriptorPool = (VkDescriptorPool)unique_id_mapping[descriptorPool_id];
-    unique_id_mapping.erase(descriptorPool_id);
+    auto iter = layer_data->unique_id_mapping.pop(descriptorPool_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        descriptorPool = (VkDescriptorPool)iter->second;
+    } else {
+        descriptorPool = (VkDescriptorPool)0;
+    }
     lock.unlock();
     layer_data->device_dispatch_table.DestroyDescriptorPool(device, descriptorPool, pAllocator);
 }
@@ -2412,7 +2432,7 @@ VkResult DispatchResetDescriptorPool(VkDevice device, VkDescriptorPool descripto
         std::lock_guard<std::mutex> lock(dispatch_lock);
         // remove references to implicitly freed descriptor sets
         for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-            unique_id_mapping.erase(reinterpret_cast<uint64_t &>(descriptor_set));
+            layer_data->unique_id_mapping.erase(reinterpret_cast<uint64_t &>(descriptor_set));
         }
         layer_data->pool_descriptor_sets_map[descriptorPool].clear();
     }
@@ -2424,6 +2444,7 @@ VkResult DispatchAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
                                         VkDescriptorSet *pDescriptorSets) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkDescriptorSetAllocateInfo *local_pAllocateInfo = NULL;
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
@@ -2482,7 +2503,7 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
             VkDescriptorSet handle = pDescriptorSets[index0];
             pool_descriptor_sets.erase(handle);
             uint64_t unique_id = reinterpret_cast<uint64_t &>(handle);
-            unique_id_mapping.erase(unique_id);
+            layer_data->unique_id_mapping.erase(unique_id);
         }
     }
     return result;
@@ -2565,8 +2586,12 @@ void DispatchDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdate
     std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t descriptor_update_template_id = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
     layer_data->desc_template_createinfo_map.erase(descriptor_update_template_id);
-    descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[descriptor_update_template_id];
-    unique_id_mapping.erase(descriptor_update_template_id);
+    auto iter = layer_data->unique_id_mapping.pop(descriptor_update_template_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)iter->second;
+    } else {
+        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)0;
+    }
     lock.unlock();
     layer_data->device_dispatch_table.DestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
 }
@@ -2580,8 +2605,12 @@ void DispatchDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpd
     std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t descriptor_update_template_id = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
     layer_data->desc_template_createinfo_map.erase(descriptor_update_template_id);
-    descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[descriptor_update_template_id];
-    unique_id_mapping.erase(descriptor_update_template_id);
+    auto iter = layer_data->unique_id_mapping.pop(descriptor_update_template_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)iter->second;
+    } else {
+        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)0;
+    }
     lock.unlock();
     layer_data->device_dispatch_table.DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
 }
@@ -2695,7 +2724,7 @@ void DispatchUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet de
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
         descriptorSet = layer_data->Unwrap(descriptorSet);
-        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[template_handle];
+        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)layer_data->unique_id_mapping.find(template_handle)->second;
     }
     void *unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, unwrapped_buffer);
@@ -2713,7 +2742,7 @@ void DispatchUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
         descriptorSet = layer_data->Unwrap(descriptorSet);
-        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[template_handle];
+        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)layer_data->unique_id_mapping.find(template_handle)->second;
         unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     }
     layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, unwrapped_buffer);
@@ -2826,7 +2855,7 @@ VkResult DispatchGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, Vk
                                                                                pProperties);
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
 
     VkResult result = layer_data->instance_dispatch_table.GetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
@@ -2847,7 +2876,7 @@ VkResult DispatchGetDisplayModeProperties2KHR(VkPhysicalDevice physicalDevice, V
                                                                                 pProperties);
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
 
     VkResult result =
@@ -2867,9 +2896,9 @@ VkResult DispatchDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarker
     safe_VkDebugMarkerObjectTagInfoEXT local_tag_info(pTagInfo);
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_tag_info.object));
-        if (it != unique_id_mapping.end()) {
-            local_tag_info.object = it->second;
+        uint64_t unwrapped_object;
+        if (layer_data->FindWrappedHandle(reinterpret_cast<uint64_t &>(local_tag_info.object), local_tag_info.objectType, &unwrapped_object)) {
+            local_tag_info.object = unwrapped_object;
         }
     }
     VkResult result = layer_data->device_dispatch_table.DebugMarkerSetObjectTagEXT(device, 
@@ -2883,9 +2912,9 @@ VkResult DispatchDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarke
     safe_VkDebugMarkerObjectNameInfoEXT local_name_info(pNameInfo);
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_name_info.object));
-        if (it != unique_id_mapping.end()) {
-            local_name_info.object = it->second;
+        uint64_t unwrapped_object;
+        if (layer_data->FindWrappedHandle(reinterpret_cast<uint64_t &>(local_name_info.object), local_name_info.objectType, &unwrapped_object)) {
+            local_name_info.object = unwrapped_object;
         }
     }
     VkResult result = layer_data->device_dispatch_table.DebugMarkerSetObjectNameEXT(
@@ -2900,9 +2929,9 @@ VkResult DispatchSetDebugUtilsObjectTagEXT(VkDevice device, const VkDebugUtilsOb
     safe_VkDebugUtilsObjectTagInfoEXT local_tag_info(pTagInfo);
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_tag_info.objectHandle));
-        if (it != unique_id_mapping.end()) {
-            local_tag_info.objectHandle = it->second;
+        uint64_t unwrapped_object;
+        if (layer_data->FindWrappedHandle(reinterpret_cast<uint64_t &>(local_tag_info.objectHandle), local_tag_info.objectType, &unwrapped_object)) {
+            local_tag_info.objectHandle = unwrapped_object;
         }
     }
     VkResult result = layer_data->device_dispatch_table.SetDebugUtilsObjectTagEXT(
@@ -2916,9 +2945,9 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
     safe_VkDebugUtilsObjectNameInfoEXT local_name_info(pNameInfo);
     {
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_name_info.objectHandle));
-        if (it != unique_id_mapping.end()) {
-            local_name_info.objectHandle = it->second;
+        uint64_t unwrapped_object;
+        if (layer_data->FindWrappedHandle(reinterpret_cast<uint64_t &>(local_name_info.objectHandle), local_name_info.objectType, &unwrapped_object)) {
+            local_name_info.objectHandle = unwrapped_object;
         }
     }
     VkResult result = layer_data->device_dispatch_table.SetDebugUtilsObjectNameEXT(
@@ -3057,11 +3086,12 @@ VkResult DispatchQueueSubmit(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSubmit(queue, submitCount, pSubmits, fence);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkSubmitInfo> local_pSubmits_storage;
     safe_VkSubmitInfo *local_pSubmits = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pSubmits) {
-            local_pSubmits = new safe_VkSubmitInfo[submitCount];
+            local_pSubmits = local_pSubmits_storage.alloc(submitCount);
             for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
                 local_pSubmits[index0].initialize(&pSubmits[index0]);
                 local_pSubmits[index0].pNext = CreateUnwrappedExtensionStructs(layer_data, local_pSubmits[index0].pNext);
@@ -3084,7 +3114,6 @@ VkResult DispatchQueueSubmit(
         for (uint32_t index0 = 0; index0 < submitCount; ++index0) {
             FreeUnwrappedExtensionStructs(const_cast<void *>(local_pSubmits[index0].pNext));
         }
-        delete[] local_pSubmits;
     }
     return result;
 }
@@ -3115,9 +3144,9 @@ VkResult DispatchAllocateMemory(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkMemoryAllocateInfo *local_pAllocateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pAllocateInfo) {
             local_pAllocateInfo = new safe_VkMemoryAllocateInfo(pAllocateInfo);
             local_pAllocateInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pAllocateInfo->pNext);
@@ -3129,7 +3158,6 @@ VkResult DispatchAllocateMemory(
         delete local_pAllocateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pMemory = layer_data->WrapNew(*pMemory);
     }
     return result;
@@ -3142,11 +3170,13 @@ void DispatchFreeMemory(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FreeMemory(device, memory, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t memory_id = reinterpret_cast<uint64_t &>(memory);
-    memory = (VkDeviceMemory)unique_id_mapping[memory_id];
-    unique_id_mapping.erase(memory_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(memory_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        memory = (VkDeviceMemory)iter->second;
+    } else {
+        memory = (VkDeviceMemory)0;
+    }
     layer_data->device_dispatch_table.FreeMemory(device, memory, pAllocator);
 
 }
@@ -3162,7 +3192,6 @@ VkResult DispatchMapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MapMemory(device, memory, offset, size, flags, ppData);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         memory = layer_data->Unwrap(memory);
     }
     VkResult result = layer_data->device_dispatch_table.MapMemory(device, memory, offset, size, flags, ppData);
@@ -3177,7 +3206,6 @@ void DispatchUnmapMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.UnmapMemory(device, memory);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         memory = layer_data->Unwrap(memory);
     }
     layer_data->device_dispatch_table.UnmapMemory(device, memory);
@@ -3191,11 +3219,12 @@ VkResult DispatchFlushMappedMemoryRanges(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkMappedMemoryRange> local_pMemoryRanges_storage;
     safe_VkMappedMemoryRange *local_pMemoryRanges = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = local_pMemoryRanges_storage.alloc(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
                 local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
                 if (pMemoryRanges[index0].memory) {
@@ -3205,9 +3234,6 @@ VkResult DispatchFlushMappedMemoryRanges(
         }
     }
     VkResult result = layer_data->device_dispatch_table.FlushMappedMemoryRanges(device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
-    if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
-    }
     return result;
 }
 
@@ -3218,11 +3244,12 @@ VkResult DispatchInvalidateMappedMemoryRanges(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkMappedMemoryRange> local_pMemoryRanges_storage;
     safe_VkMappedMemoryRange *local_pMemoryRanges = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pMemoryRanges) {
-            local_pMemoryRanges = new safe_VkMappedMemoryRange[memoryRangeCount];
+            local_pMemoryRanges = local_pMemoryRanges_storage.alloc(memoryRangeCount);
             for (uint32_t index0 = 0; index0 < memoryRangeCount; ++index0) {
                 local_pMemoryRanges[index0].initialize(&pMemoryRanges[index0]);
                 if (pMemoryRanges[index0].memory) {
@@ -3232,9 +3259,6 @@ VkResult DispatchInvalidateMappedMemoryRanges(
         }
     }
     VkResult result = layer_data->device_dispatch_table.InvalidateMappedMemoryRanges(device, memoryRangeCount, (const VkMappedMemoryRange*)local_pMemoryRanges);
-    if (local_pMemoryRanges) {
-        delete[] local_pMemoryRanges;
-    }
     return result;
 }
 
@@ -3246,7 +3270,6 @@ void DispatchGetDeviceMemoryCommitment(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         memory = layer_data->Unwrap(memory);
     }
     layer_data->device_dispatch_table.GetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
@@ -3262,7 +3285,6 @@ VkResult DispatchBindBufferMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory(device, buffer, memory, memoryOffset);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
         memory = layer_data->Unwrap(memory);
     }
@@ -3280,7 +3302,6 @@ VkResult DispatchBindImageMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory(device, image, memory, memoryOffset);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
         memory = layer_data->Unwrap(memory);
     }
@@ -3297,7 +3318,6 @@ void DispatchGetBufferMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
     }
     layer_data->device_dispatch_table.GetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
@@ -3312,7 +3332,6 @@ void DispatchGetImageMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageMemoryRequirements(device, image, pMemoryRequirements);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
     }
     layer_data->device_dispatch_table.GetImageMemoryRequirements(device, image, pMemoryRequirements);
@@ -3328,7 +3347,6 @@ void DispatchGetImageSparseMemoryRequirements(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
     }
     layer_data->device_dispatch_table.GetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
@@ -3358,11 +3376,12 @@ VkResult DispatchQueueBindSparse(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBindSparseInfo> local_pBindInfo_storage;
     safe_VkBindSparseInfo *local_pBindInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBindInfo) {
-            local_pBindInfo = new safe_VkBindSparseInfo[bindInfoCount];
+            local_pBindInfo = local_pBindInfo_storage.alloc(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfo[index0].initialize(&pBindInfo[index0]);
                 if (local_pBindInfo[index0].pWaitSemaphores) {
@@ -3422,9 +3441,6 @@ VkResult DispatchQueueBindSparse(
         fence = layer_data->Unwrap(fence);
     }
     VkResult result = layer_data->device_dispatch_table.QueueBindSparse(queue, bindInfoCount, (const VkBindSparseInfo*)local_pBindInfo, fence);
-    if (local_pBindInfo) {
-        delete[] local_pBindInfo;
-    }
     return result;
 }
 
@@ -3438,7 +3454,6 @@ VkResult DispatchCreateFence(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateFence(device, pCreateInfo, pAllocator, pFence);
     VkResult result = layer_data->device_dispatch_table.CreateFence(device, pCreateInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pFence = layer_data->WrapNew(*pFence);
     }
     return result;
@@ -3451,11 +3466,13 @@ void DispatchDestroyFence(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyFence(device, fence, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t fence_id = reinterpret_cast<uint64_t &>(fence);
-    fence = (VkFence)unique_id_mapping[fence_id];
-    unique_id_mapping.erase(fence_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(fence_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        fence = (VkFence)iter->second;
+    } else {
+        fence = (VkFence)0;
+    }
     layer_data->device_dispatch_table.DestroyFence(device, fence, pAllocator);
 
 }
@@ -3467,19 +3484,17 @@ VkResult DispatchResetFences(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetFences(device, fenceCount, pFences);
+    vl_transient_array<VkFence> local_pFences_storage;
     VkFence *local_pFences = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pFences) {
-            local_pFences = new VkFence[fenceCount];
+            local_pFences = local_pFences_storage.alloc(fenceCount);
             for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
                 local_pFences[index0] = layer_data->Unwrap(pFences[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.ResetFences(device, fenceCount, (const VkFence*)local_pFences);
-    if (local_pFences)
-        delete[] local_pFences;
     return result;
 }
 
@@ -3490,7 +3505,6 @@ VkResult DispatchGetFenceStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetFenceStatus(device, fence);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         fence = layer_data->Unwrap(fence);
     }
     VkResult result = layer_data->device_dispatch_table.GetFenceStatus(device, fence);
@@ -3507,19 +3521,17 @@ VkResult DispatchWaitForFences(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.WaitForFences(device, fenceCount, pFences, waitAll, timeout);
+    vl_transient_array<VkFence> local_pFences_storage;
     VkFence *local_pFences = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pFences) {
-            local_pFences = new VkFence[fenceCount];
+            local_pFences = local_pFences_storage.alloc(fenceCount);
             for (uint32_t index0 = 0; index0 < fenceCount; ++index0) {
                 local_pFences[index0] = layer_data->Unwrap(pFences[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.WaitForFences(device, fenceCount, (const VkFence*)local_pFences, waitAll, timeout);
-    if (local_pFences)
-        delete[] local_pFences;
     return result;
 }
 
@@ -3533,7 +3545,6 @@ VkResult DispatchCreateSemaphore(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     VkResult result = layer_data->device_dispatch_table.CreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSemaphore = layer_data->WrapNew(*pSemaphore);
     }
     return result;
@@ -3546,11 +3557,13 @@ void DispatchDestroySemaphore(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySemaphore(device, semaphore, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t semaphore_id = reinterpret_cast<uint64_t &>(semaphore);
-    semaphore = (VkSemaphore)unique_id_mapping[semaphore_id];
-    unique_id_mapping.erase(semaphore_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(semaphore_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        semaphore = (VkSemaphore)iter->second;
+    } else {
+        semaphore = (VkSemaphore)0;
+    }
     layer_data->device_dispatch_table.DestroySemaphore(device, semaphore, pAllocator);
 
 }
@@ -3565,7 +3578,6 @@ VkResult DispatchCreateEvent(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
     VkResult result = layer_data->device_dispatch_table.CreateEvent(device, pCreateInfo, pAllocator, pEvent);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pEvent = layer_data->WrapNew(*pEvent);
     }
     return result;
@@ -3578,11 +3590,13 @@ void DispatchDestroyEvent(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyEvent(device, event, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t event_id = reinterpret_cast<uint64_t &>(event);
-    event = (VkEvent)unique_id_mapping[event_id];
-    unique_id_mapping.erase(event_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(event_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        event = (VkEvent)iter->second;
+    } else {
+        event = (VkEvent)0;
+    }
     layer_data->device_dispatch_table.DestroyEvent(device, event, pAllocator);
 
 }
@@ -3594,7 +3608,6 @@ VkResult DispatchGetEventStatus(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetEventStatus(device, event);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         event = layer_data->Unwrap(event);
     }
     VkResult result = layer_data->device_dispatch_table.GetEventStatus(device, event);
@@ -3609,7 +3622,6 @@ VkResult DispatchSetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetEvent(device, event);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         event = layer_data->Unwrap(event);
     }
     VkResult result = layer_data->device_dispatch_table.SetEvent(device, event);
@@ -3624,7 +3636,6 @@ VkResult DispatchResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetEvent(device, event);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         event = layer_data->Unwrap(event);
     }
     VkResult result = layer_data->device_dispatch_table.ResetEvent(device, event);
@@ -3642,7 +3653,6 @@ VkResult DispatchCreateQueryPool(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     VkResult result = layer_data->device_dispatch_table.CreateQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pQueryPool = layer_data->WrapNew(*pQueryPool);
     }
     return result;
@@ -3655,11 +3665,13 @@ void DispatchDestroyQueryPool(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyQueryPool(device, queryPool, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t queryPool_id = reinterpret_cast<uint64_t &>(queryPool);
-    queryPool = (VkQueryPool)unique_id_mapping[queryPool_id];
-    unique_id_mapping.erase(queryPool_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(queryPool_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        queryPool = (VkQueryPool)iter->second;
+    } else {
+        queryPool = (VkQueryPool)0;
+    }
     layer_data->device_dispatch_table.DestroyQueryPool(device, queryPool, pAllocator);
 
 }
@@ -3677,7 +3689,6 @@ VkResult DispatchGetQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     VkResult result = layer_data->device_dispatch_table.GetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
@@ -3695,7 +3706,6 @@ VkResult DispatchCreateBuffer(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
     VkResult result = layer_data->device_dispatch_table.CreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pBuffer = layer_data->WrapNew(*pBuffer);
     }
     return result;
@@ -3708,11 +3718,13 @@ void DispatchDestroyBuffer(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyBuffer(device, buffer, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t buffer_id = reinterpret_cast<uint64_t &>(buffer);
-    buffer = (VkBuffer)unique_id_mapping[buffer_id];
-    unique_id_mapping.erase(buffer_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(buffer_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        buffer = (VkBuffer)iter->second;
+    } else {
+        buffer = (VkBuffer)0;
+    }
     layer_data->device_dispatch_table.DestroyBuffer(device, buffer, pAllocator);
 
 }
@@ -3725,9 +3737,9 @@ VkResult DispatchCreateBufferView(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateBufferView(device, pCreateInfo, pAllocator, pView);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkBufferViewCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkBufferViewCreateInfo(pCreateInfo);
             if (pCreateInfo->buffer) {
@@ -3740,7 +3752,6 @@ VkResult DispatchCreateBufferView(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pView = layer_data->WrapNew(*pView);
     }
     return result;
@@ -3753,11 +3764,13 @@ void DispatchDestroyBufferView(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyBufferView(device, bufferView, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t bufferView_id = reinterpret_cast<uint64_t &>(bufferView);
-    bufferView = (VkBufferView)unique_id_mapping[bufferView_id];
-    unique_id_mapping.erase(bufferView_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(bufferView_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        bufferView = (VkBufferView)iter->second;
+    } else {
+        bufferView = (VkBufferView)0;
+    }
     layer_data->device_dispatch_table.DestroyBufferView(device, bufferView, pAllocator);
 
 }
@@ -3770,9 +3783,9 @@ VkResult DispatchCreateImage(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateImage(device, pCreateInfo, pAllocator, pImage);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkImageCreateInfo(pCreateInfo);
             local_pCreateInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pCreateInfo->pNext);
@@ -3784,7 +3797,6 @@ VkResult DispatchCreateImage(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pImage = layer_data->WrapNew(*pImage);
     }
     return result;
@@ -3797,11 +3809,13 @@ void DispatchDestroyImage(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyImage(device, image, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t image_id = reinterpret_cast<uint64_t &>(image);
-    image = (VkImage)unique_id_mapping[image_id];
-    unique_id_mapping.erase(image_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(image_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        image = (VkImage)iter->second;
+    } else {
+        image = (VkImage)0;
+    }
     layer_data->device_dispatch_table.DestroyImage(device, image, pAllocator);
 
 }
@@ -3815,7 +3829,6 @@ void DispatchGetImageSubresourceLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageSubresourceLayout(device, image, pSubresource, pLayout);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
     }
     layer_data->device_dispatch_table.GetImageSubresourceLayout(device, image, pSubresource, pLayout);
@@ -3830,9 +3843,9 @@ VkResult DispatchCreateImageView(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateImageView(device, pCreateInfo, pAllocator, pView);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageViewCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkImageViewCreateInfo(pCreateInfo);
             if (pCreateInfo->image) {
@@ -3847,7 +3860,6 @@ VkResult DispatchCreateImageView(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pView = layer_data->WrapNew(*pView);
     }
     return result;
@@ -3860,11 +3872,13 @@ void DispatchDestroyImageView(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyImageView(device, imageView, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t imageView_id = reinterpret_cast<uint64_t &>(imageView);
-    imageView = (VkImageView)unique_id_mapping[imageView_id];
-    unique_id_mapping.erase(imageView_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(imageView_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        imageView = (VkImageView)iter->second;
+    } else {
+        imageView = (VkImageView)0;
+    }
     layer_data->device_dispatch_table.DestroyImageView(device, imageView, pAllocator);
 
 }
@@ -3877,9 +3891,9 @@ VkResult DispatchCreateShaderModule(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkShaderModuleCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkShaderModuleCreateInfo(pCreateInfo);
             local_pCreateInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pCreateInfo->pNext);
@@ -3891,7 +3905,6 @@ VkResult DispatchCreateShaderModule(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pShaderModule = layer_data->WrapNew(*pShaderModule);
     }
     return result;
@@ -3904,11 +3917,13 @@ void DispatchDestroyShaderModule(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyShaderModule(device, shaderModule, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t shaderModule_id = reinterpret_cast<uint64_t &>(shaderModule);
-    shaderModule = (VkShaderModule)unique_id_mapping[shaderModule_id];
-    unique_id_mapping.erase(shaderModule_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(shaderModule_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        shaderModule = (VkShaderModule)iter->second;
+    } else {
+        shaderModule = (VkShaderModule)0;
+    }
     layer_data->device_dispatch_table.DestroyShaderModule(device, shaderModule, pAllocator);
 
 }
@@ -3923,7 +3938,6 @@ VkResult DispatchCreatePipelineCache(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     VkResult result = layer_data->device_dispatch_table.CreatePipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pPipelineCache = layer_data->WrapNew(*pPipelineCache);
     }
     return result;
@@ -3936,11 +3950,13 @@ void DispatchDestroyPipelineCache(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPipelineCache(device, pipelineCache, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t pipelineCache_id = reinterpret_cast<uint64_t &>(pipelineCache);
-    pipelineCache = (VkPipelineCache)unique_id_mapping[pipelineCache_id];
-    unique_id_mapping.erase(pipelineCache_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(pipelineCache_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        pipelineCache = (VkPipelineCache)iter->second;
+    } else {
+        pipelineCache = (VkPipelineCache)0;
+    }
     layer_data->device_dispatch_table.DestroyPipelineCache(device, pipelineCache, pAllocator);
 
 }
@@ -3954,7 +3970,6 @@ VkResult DispatchGetPipelineCacheData(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipelineCache = layer_data->Unwrap(pipelineCache);
     }
     VkResult result = layer_data->device_dispatch_table.GetPipelineCacheData(device, pipelineCache, pDataSize, pData);
@@ -3970,20 +3985,18 @@ VkResult DispatchMergePipelineCaches(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+    vl_transient_array<VkPipelineCache> local_pSrcCaches_storage;
     VkPipelineCache *local_pSrcCaches = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         dstCache = layer_data->Unwrap(dstCache);
         if (pSrcCaches) {
-            local_pSrcCaches = new VkPipelineCache[srcCacheCount];
+            local_pSrcCaches = local_pSrcCaches_storage.alloc(srcCacheCount);
             for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
                 local_pSrcCaches[index0] = layer_data->Unwrap(pSrcCaches[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.MergePipelineCaches(device, dstCache, srcCacheCount, (const VkPipelineCache*)local_pSrcCaches);
-    if (local_pSrcCaches)
-        delete[] local_pSrcCaches;
     return result;
 }
 
@@ -3998,11 +4011,13 @@ void DispatchDestroyPipeline(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPipeline(device, pipeline, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t pipeline_id = reinterpret_cast<uint64_t &>(pipeline);
-    pipeline = (VkPipeline)unique_id_mapping[pipeline_id];
-    unique_id_mapping.erase(pipeline_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(pipeline_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        pipeline = (VkPipeline)iter->second;
+    } else {
+        pipeline = (VkPipeline)0;
+    }
     layer_data->device_dispatch_table.DestroyPipeline(device, pipeline, pAllocator);
 
 }
@@ -4015,9 +4030,9 @@ VkResult DispatchCreatePipelineLayout(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPipelineLayoutCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkPipelineLayoutCreateInfo(pCreateInfo);
             if (local_pCreateInfo->pSetLayouts) {
@@ -4032,7 +4047,6 @@ VkResult DispatchCreatePipelineLayout(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pPipelineLayout = layer_data->WrapNew(*pPipelineLayout);
     }
     return result;
@@ -4045,11 +4059,13 @@ void DispatchDestroyPipelineLayout(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t pipelineLayout_id = reinterpret_cast<uint64_t &>(pipelineLayout);
-    pipelineLayout = (VkPipelineLayout)unique_id_mapping[pipelineLayout_id];
-    unique_id_mapping.erase(pipelineLayout_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(pipelineLayout_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        pipelineLayout = (VkPipelineLayout)iter->second;
+    } else {
+        pipelineLayout = (VkPipelineLayout)0;
+    }
     layer_data->device_dispatch_table.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
 
 }
@@ -4062,9 +4078,9 @@ VkResult DispatchCreateSampler(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSampler(device, pCreateInfo, pAllocator, pSampler);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSamplerCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkSamplerCreateInfo(pCreateInfo);
             local_pCreateInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pCreateInfo->pNext);
@@ -4076,7 +4092,6 @@ VkResult DispatchCreateSampler(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSampler = layer_data->WrapNew(*pSampler);
     }
     return result;
@@ -4089,11 +4104,13 @@ void DispatchDestroySampler(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySampler(device, sampler, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t sampler_id = reinterpret_cast<uint64_t &>(sampler);
-    sampler = (VkSampler)unique_id_mapping[sampler_id];
-    unique_id_mapping.erase(sampler_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(sampler_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        sampler = (VkSampler)iter->second;
+    } else {
+        sampler = (VkSampler)0;
+    }
     layer_data->device_dispatch_table.DestroySampler(device, sampler, pAllocator);
 
 }
@@ -4106,9 +4123,9 @@ VkResult DispatchCreateDescriptorSetLayout(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkDescriptorSetLayoutCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkDescriptorSetLayoutCreateInfo(pCreateInfo);
             if (local_pCreateInfo->pBindings) {
@@ -4127,7 +4144,6 @@ VkResult DispatchCreateDescriptorSetLayout(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSetLayout = layer_data->WrapNew(*pSetLayout);
     }
     return result;
@@ -4140,11 +4156,13 @@ void DispatchDestroyDescriptorSetLayout(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t descriptorSetLayout_id = reinterpret_cast<uint64_t &>(descriptorSetLayout);
-    descriptorSetLayout = (VkDescriptorSetLayout)unique_id_mapping[descriptorSetLayout_id];
-    unique_id_mapping.erase(descriptorSetLayout_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(descriptorSetLayout_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        descriptorSetLayout = (VkDescriptorSetLayout)iter->second;
+    } else {
+        descriptorSetLayout = (VkDescriptorSetLayout)0;
+    }
     layer_data->device_dispatch_table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
 
 }
@@ -4159,7 +4177,6 @@ VkResult DispatchCreateDescriptorPool(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     VkResult result = layer_data->device_dispatch_table.CreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pDescriptorPool = layer_data->WrapNew(*pDescriptorPool);
     }
     return result;
@@ -4182,12 +4199,14 @@ void DispatchUpdateDescriptorSets(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkWriteDescriptorSet> local_pDescriptorWrites_storage;
     safe_VkWriteDescriptorSet *local_pDescriptorWrites = NULL;
+    vl_transient_array<safe_VkCopyDescriptorSet> local_pDescriptorCopies_storage;
     safe_VkCopyDescriptorSet *local_pDescriptorCopies = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+            local_pDescriptorWrites = local_pDescriptorWrites_storage.alloc(descriptorWriteCount);
             for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
                 local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
                 local_pDescriptorWrites[index0].pNext = CreateUnwrappedExtensionStructs(layer_data, local_pDescriptorWrites[index0].pNext);
@@ -4219,7 +4238,7 @@ void DispatchUpdateDescriptorSets(
             }
         }
         if (pDescriptorCopies) {
-            local_pDescriptorCopies = new safe_VkCopyDescriptorSet[descriptorCopyCount];
+            local_pDescriptorCopies = local_pDescriptorCopies_storage.alloc(descriptorCopyCount);
             for (uint32_t index0 = 0; index0 < descriptorCopyCount; ++index0) {
                 local_pDescriptorCopies[index0].initialize(&pDescriptorCopies[index0]);
                 if (pDescriptorCopies[index0].srcSet) {
@@ -4236,10 +4255,6 @@ void DispatchUpdateDescriptorSets(
         for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
             FreeUnwrappedExtensionStructs(const_cast<void *>(local_pDescriptorWrites[index0].pNext));
         }
-        delete[] local_pDescriptorWrites;
-    }
-    if (local_pDescriptorCopies) {
-        delete[] local_pDescriptorCopies;
     }
 }
 
@@ -4251,9 +4266,9 @@ VkResult DispatchCreateFramebuffer(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkFramebufferCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkFramebufferCreateInfo(pCreateInfo);
             if (pCreateInfo->renderPass) {
@@ -4271,7 +4286,6 @@ VkResult DispatchCreateFramebuffer(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pFramebuffer = layer_data->WrapNew(*pFramebuffer);
     }
     return result;
@@ -4284,11 +4298,13 @@ void DispatchDestroyFramebuffer(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyFramebuffer(device, framebuffer, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t framebuffer_id = reinterpret_cast<uint64_t &>(framebuffer);
-    framebuffer = (VkFramebuffer)unique_id_mapping[framebuffer_id];
-    unique_id_mapping.erase(framebuffer_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(framebuffer_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        framebuffer = (VkFramebuffer)iter->second;
+    } else {
+        framebuffer = (VkFramebuffer)0;
+    }
     layer_data->device_dispatch_table.DestroyFramebuffer(device, framebuffer, pAllocator);
 
 }
@@ -4305,7 +4321,6 @@ void DispatchGetRenderAreaGranularity(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetRenderAreaGranularity(device, renderPass, pGranularity);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         renderPass = layer_data->Unwrap(renderPass);
     }
     layer_data->device_dispatch_table.GetRenderAreaGranularity(device, renderPass, pGranularity);
@@ -4322,7 +4337,6 @@ VkResult DispatchCreateCommandPool(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     VkResult result = layer_data->device_dispatch_table.CreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pCommandPool = layer_data->WrapNew(*pCommandPool);
     }
     return result;
@@ -4335,11 +4349,13 @@ void DispatchDestroyCommandPool(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyCommandPool(device, commandPool, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t commandPool_id = reinterpret_cast<uint64_t &>(commandPool);
-    commandPool = (VkCommandPool)unique_id_mapping[commandPool_id];
-    unique_id_mapping.erase(commandPool_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(commandPool_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        commandPool = (VkCommandPool)iter->second;
+    } else {
+        commandPool = (VkCommandPool)0;
+    }
     layer_data->device_dispatch_table.DestroyCommandPool(device, commandPool, pAllocator);
 
 }
@@ -4352,7 +4368,6 @@ VkResult DispatchResetCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetCommandPool(device, commandPool, flags);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         commandPool = layer_data->Unwrap(commandPool);
     }
     VkResult result = layer_data->device_dispatch_table.ResetCommandPool(device, commandPool, flags);
@@ -4367,9 +4382,9 @@ VkResult DispatchAllocateCommandBuffers(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkCommandBufferAllocateInfo *local_pAllocateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pAllocateInfo) {
             local_pAllocateInfo = new safe_VkCommandBufferAllocateInfo(pAllocateInfo);
             if (pAllocateInfo->commandPool) {
@@ -4393,7 +4408,6 @@ void DispatchFreeCommandBuffers(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         commandPool = layer_data->Unwrap(commandPool);
     }
     layer_data->device_dispatch_table.FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
@@ -4406,9 +4420,9 @@ VkResult DispatchBeginCommandBuffer(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BeginCommandBuffer(commandBuffer, pBeginInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkCommandBufferBeginInfo *local_pBeginInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBeginInfo) {
             local_pBeginInfo = new safe_VkCommandBufferBeginInfo(pBeginInfo);
             if (local_pBeginInfo->pInheritanceInfo) {
@@ -4455,7 +4469,6 @@ void DispatchCmdBindPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipeline = layer_data->Unwrap(pipeline);
     }
     layer_data->device_dispatch_table.CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
@@ -4565,20 +4578,18 @@ void DispatchCmdBindDescriptorSets(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    vl_transient_array<VkDescriptorSet> local_pDescriptorSets_storage;
     VkDescriptorSet *local_pDescriptorSets = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         layout = layer_data->Unwrap(layout);
         if (pDescriptorSets) {
-            local_pDescriptorSets = new VkDescriptorSet[descriptorSetCount];
+            local_pDescriptorSets = local_pDescriptorSets_storage.alloc(descriptorSetCount);
             for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
                 local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, (const VkDescriptorSet*)local_pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
-    if (local_pDescriptorSets)
-        delete[] local_pDescriptorSets;
 }
 
 void DispatchCmdBindIndexBuffer(
@@ -4590,7 +4601,6 @@ void DispatchCmdBindIndexBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
     }
     layer_data->device_dispatch_table.CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
@@ -4606,19 +4616,17 @@ void DispatchCmdBindVertexBuffers(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    vl_transient_array<VkBuffer> local_pBuffers_storage;
     VkBuffer *local_pBuffers = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBuffers) {
-            local_pBuffers = new VkBuffer[bindingCount];
+            local_pBuffers = local_pBuffers_storage.alloc(bindingCount);
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets);
-    if (local_pBuffers)
-        delete[] local_pBuffers;
 }
 
 void DispatchCmdDraw(
@@ -4656,7 +4664,6 @@ void DispatchCmdDrawIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
     }
     layer_data->device_dispatch_table.CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
@@ -4673,7 +4680,6 @@ void DispatchCmdDrawIndexedIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
     }
     layer_data->device_dispatch_table.CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
@@ -4699,7 +4705,6 @@ void DispatchCmdDispatchIndirect(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDispatchIndirect(commandBuffer, buffer, offset);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
     }
     layer_data->device_dispatch_table.CmdDispatchIndirect(commandBuffer, buffer, offset);
@@ -4716,7 +4721,6 @@ void DispatchCmdCopyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         srcBuffer = layer_data->Unwrap(srcBuffer);
         dstBuffer = layer_data->Unwrap(dstBuffer);
     }
@@ -4736,7 +4740,6 @@ void DispatchCmdCopyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         srcImage = layer_data->Unwrap(srcImage);
         dstImage = layer_data->Unwrap(dstImage);
     }
@@ -4757,7 +4760,6 @@ void DispatchCmdBlitImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         srcImage = layer_data->Unwrap(srcImage);
         dstImage = layer_data->Unwrap(dstImage);
     }
@@ -4776,7 +4778,6 @@ void DispatchCmdCopyBufferToImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         srcBuffer = layer_data->Unwrap(srcBuffer);
         dstImage = layer_data->Unwrap(dstImage);
     }
@@ -4795,7 +4796,6 @@ void DispatchCmdCopyImageToBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         srcImage = layer_data->Unwrap(srcImage);
         dstBuffer = layer_data->Unwrap(dstBuffer);
     }
@@ -4813,7 +4813,6 @@ void DispatchCmdUpdateBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         dstBuffer = layer_data->Unwrap(dstBuffer);
     }
     layer_data->device_dispatch_table.CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
@@ -4830,7 +4829,6 @@ void DispatchCmdFillBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         dstBuffer = layer_data->Unwrap(dstBuffer);
     }
     layer_data->device_dispatch_table.CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
@@ -4848,7 +4846,6 @@ void DispatchCmdClearColorImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
     }
     layer_data->device_dispatch_table.CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
@@ -4866,7 +4863,6 @@ void DispatchCmdClearDepthStencilImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
     }
     layer_data->device_dispatch_table.CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
@@ -4897,7 +4893,6 @@ void DispatchCmdResolveImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         srcImage = layer_data->Unwrap(srcImage);
         dstImage = layer_data->Unwrap(dstImage);
     }
@@ -4913,7 +4908,6 @@ void DispatchCmdSetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdSetEvent(commandBuffer, event, stageMask);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         event = layer_data->Unwrap(event);
     }
     layer_data->device_dispatch_table.CmdSetEvent(commandBuffer, event, stageMask);
@@ -4928,7 +4922,6 @@ void DispatchCmdResetEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdResetEvent(commandBuffer, event, stageMask);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         event = layer_data->Unwrap(event);
     }
     layer_data->device_dispatch_table.CmdResetEvent(commandBuffer, event, stageMask);
@@ -4950,19 +4943,22 @@ void DispatchCmdWaitEvents(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<VkEvent> local_pEvents_storage;
     VkEvent *local_pEvents = NULL;
+    vl_transient_array<safe_VkBufferMemoryBarrier> local_pBufferMemoryBarriers_storage;
     safe_VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
+    vl_transient_array<safe_VkImageMemoryBarrier> local_pImageMemoryBarriers_storage;
     safe_VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pEvents) {
-            local_pEvents = new VkEvent[eventCount];
+            local_pEvents = local_pEvents_storage.alloc(eventCount);
             for (uint32_t index0 = 0; index0 < eventCount; ++index0) {
                 local_pEvents[index0] = layer_data->Unwrap(pEvents[index0]);
             }
         }
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = local_pBufferMemoryBarriers_storage.alloc(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
                 local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
                 if (pBufferMemoryBarriers[index0].buffer) {
@@ -4971,7 +4967,7 @@ void DispatchCmdWaitEvents(
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = local_pImageMemoryBarriers_storage.alloc(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
                 local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
                 if (pImageMemoryBarriers[index0].image) {
@@ -4981,14 +4977,6 @@ void DispatchCmdWaitEvents(
         }
     }
     layer_data->device_dispatch_table.CmdWaitEvents(commandBuffer, eventCount, (const VkEvent*)local_pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount, (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
-    if (local_pEvents)
-        delete[] local_pEvents;
-    if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
-    }
-    if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
-    }
 }
 
 void DispatchCmdPipelineBarrier(
@@ -5005,12 +4993,14 @@ void DispatchCmdPipelineBarrier(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBufferMemoryBarrier> local_pBufferMemoryBarriers_storage;
     safe_VkBufferMemoryBarrier *local_pBufferMemoryBarriers = NULL;
+    vl_transient_array<safe_VkImageMemoryBarrier> local_pImageMemoryBarriers_storage;
     safe_VkImageMemoryBarrier *local_pImageMemoryBarriers = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBufferMemoryBarriers) {
-            local_pBufferMemoryBarriers = new safe_VkBufferMemoryBarrier[bufferMemoryBarrierCount];
+            local_pBufferMemoryBarriers = local_pBufferMemoryBarriers_storage.alloc(bufferMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < bufferMemoryBarrierCount; ++index0) {
                 local_pBufferMemoryBarriers[index0].initialize(&pBufferMemoryBarriers[index0]);
                 if (pBufferMemoryBarriers[index0].buffer) {
@@ -5019,7 +5009,7 @@ void DispatchCmdPipelineBarrier(
             }
         }
         if (pImageMemoryBarriers) {
-            local_pImageMemoryBarriers = new safe_VkImageMemoryBarrier[imageMemoryBarrierCount];
+            local_pImageMemoryBarriers = local_pImageMemoryBarriers_storage.alloc(imageMemoryBarrierCount);
             for (uint32_t index0 = 0; index0 < imageMemoryBarrierCount; ++index0) {
                 local_pImageMemoryBarriers[index0].initialize(&pImageMemoryBarriers[index0]);
                 if (pImageMemoryBarriers[index0].image) {
@@ -5029,12 +5019,6 @@ void DispatchCmdPipelineBarrier(
         }
     }
     layer_data->device_dispatch_table.CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, (const VkBufferMemoryBarrier*)local_pBufferMemoryBarriers, imageMemoryBarrierCount, (const VkImageMemoryBarrier*)local_pImageMemoryBarriers);
-    if (local_pBufferMemoryBarriers) {
-        delete[] local_pBufferMemoryBarriers;
-    }
-    if (local_pImageMemoryBarriers) {
-        delete[] local_pImageMemoryBarriers;
-    }
 }
 
 void DispatchCmdBeginQuery(
@@ -5046,7 +5030,6 @@ void DispatchCmdBeginQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginQuery(commandBuffer, queryPool, query, flags);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdBeginQuery(commandBuffer, queryPool, query, flags);
@@ -5061,7 +5044,6 @@ void DispatchCmdEndQuery(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdEndQuery(commandBuffer, queryPool, query);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdEndQuery(commandBuffer, queryPool, query);
@@ -5077,7 +5059,6 @@ void DispatchCmdResetQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
@@ -5093,7 +5074,6 @@ void DispatchCmdWriteTimestamp(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
@@ -5113,7 +5093,6 @@ void DispatchCmdCopyQueryPoolResults(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
         dstBuffer = layer_data->Unwrap(dstBuffer);
     }
@@ -5132,7 +5111,6 @@ void DispatchCmdPushConstants(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         layout = layer_data->Unwrap(layout);
     }
     layer_data->device_dispatch_table.CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
@@ -5146,9 +5124,9 @@ void DispatchCmdBeginRenderPass(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkRenderPassBeginInfo *local_pRenderPassBegin = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pRenderPassBegin) {
             local_pRenderPassBegin = new safe_VkRenderPassBeginInfo(pRenderPassBegin);
             if (pRenderPassBegin->renderPass) {
@@ -5203,11 +5181,12 @@ VkResult DispatchBindBufferMemory2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, pBindInfos);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBindBufferMemoryInfo> local_pBindInfos_storage;
     safe_VkBindBufferMemoryInfo *local_pBindInfos = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = local_pBindInfos_storage.alloc(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].buffer) {
@@ -5220,9 +5199,6 @@ VkResult DispatchBindBufferMemory2(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
     return result;
 }
 
@@ -5233,11 +5209,12 @@ VkResult DispatchBindImageMemory2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory2(device, bindInfoCount, pBindInfos);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBindImageMemoryInfo> local_pBindInfos_storage;
     safe_VkBindImageMemoryInfo *local_pBindInfos = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindImageMemoryInfo[bindInfoCount];
+            local_pBindInfos = local_pBindInfos_storage.alloc(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 local_pBindInfos[index0].pNext = CreateUnwrappedExtensionStructs(layer_data, local_pBindInfos[index0].pNext);
@@ -5255,7 +5232,6 @@ VkResult DispatchBindImageMemory2(
         for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
             FreeUnwrappedExtensionStructs(const_cast<void *>(local_pBindInfos[index0].pNext));
         }
-        delete[] local_pBindInfos;
     }
     return result;
 }
@@ -5313,9 +5289,9 @@ void DispatchGetImageMemoryRequirements2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageMemoryRequirementsInfo2 *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkImageMemoryRequirementsInfo2(pInfo);
             if (pInfo->image) {
@@ -5336,9 +5312,9 @@ void DispatchGetBufferMemoryRequirements2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkBufferMemoryRequirementsInfo2 *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkBufferMemoryRequirementsInfo2(pInfo);
             if (pInfo->buffer) {
@@ -5360,9 +5336,9 @@ void DispatchGetImageSparseMemoryRequirements2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageSparseMemoryRequirementsInfo2 *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkImageSparseMemoryRequirementsInfo2(pInfo);
             if (pInfo->image) {
@@ -5411,9 +5387,9 @@ VkResult DispatchGetPhysicalDeviceImageFormatProperties2(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPhysicalDeviceImageFormatInfo2 *local_pImageFormatInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pImageFormatInfo) {
             local_pImageFormatInfo = new safe_VkPhysicalDeviceImageFormatInfo2(pImageFormatInfo);
             local_pImageFormatInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pImageFormatInfo->pNext);
@@ -5465,7 +5441,6 @@ void DispatchTrimCommandPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.TrimCommandPool(device, commandPool, flags);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         commandPool = layer_data->Unwrap(commandPool);
     }
     layer_data->device_dispatch_table.TrimCommandPool(device, commandPool, flags);
@@ -5490,9 +5465,9 @@ VkResult DispatchCreateSamplerYcbcrConversion(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSamplerYcbcrConversion(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSamplerYcbcrConversionCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkSamplerYcbcrConversionCreateInfo(pCreateInfo);
             local_pCreateInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pCreateInfo->pNext);
@@ -5504,7 +5479,6 @@ VkResult DispatchCreateSamplerYcbcrConversion(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pYcbcrConversion = layer_data->WrapNew(*pYcbcrConversion);
     }
     return result;
@@ -5517,11 +5491,13 @@ void DispatchDestroySamplerYcbcrConversion(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t ycbcrConversion_id = reinterpret_cast<uint64_t &>(ycbcrConversion);
-    ycbcrConversion = (VkSamplerYcbcrConversion)unique_id_mapping[ycbcrConversion_id];
-    unique_id_mapping.erase(ycbcrConversion_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(ycbcrConversion_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        ycbcrConversion = (VkSamplerYcbcrConversion)iter->second;
+    } else {
+        ycbcrConversion = (VkSamplerYcbcrConversion)0;
+    }
     layer_data->device_dispatch_table.DestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
 
 }
@@ -5569,9 +5545,9 @@ void DispatchGetDescriptorSetLayoutSupport(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkDescriptorSetLayoutCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkDescriptorSetLayoutCreateInfo(pCreateInfo);
             if (local_pCreateInfo->pBindings) {
@@ -5598,11 +5574,13 @@ void DispatchDestroySurfaceKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.DestroySurfaceKHR(instance, surface, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t surface_id = reinterpret_cast<uint64_t &>(surface);
-    surface = (VkSurfaceKHR)unique_id_mapping[surface_id];
-    unique_id_mapping.erase(surface_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(surface_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        surface = (VkSurfaceKHR)iter->second;
+    } else {
+        surface = (VkSurfaceKHR)0;
+    }
     layer_data->instance_dispatch_table.DestroySurfaceKHR(instance, surface, pAllocator);
 
 }
@@ -5616,8 +5594,7 @@ VkResult DispatchGetPhysicalDeviceSurfaceSupportKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
 
@@ -5632,8 +5609,7 @@ VkResult DispatchGetPhysicalDeviceSurfaceCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
 
@@ -5649,8 +5625,7 @@ VkResult DispatchGetPhysicalDeviceSurfaceFormatsKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
 
@@ -5666,8 +5641,7 @@ VkResult DispatchGetPhysicalDeviceSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->instance_dispatch_table.GetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
 
@@ -5691,7 +5665,6 @@ VkResult DispatchAcquireNextImageKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
         semaphore = layer_data->Unwrap(semaphore);
         fence = layer_data->Unwrap(fence);
@@ -5721,8 +5694,7 @@ VkResult DispatchGetDeviceGroupSurfacePresentModesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->device_dispatch_table.GetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
 
@@ -5738,8 +5710,7 @@ VkResult DispatchGetPhysicalDevicePresentRectanglesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->instance_dispatch_table.GetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
 
@@ -5753,9 +5724,9 @@ VkResult DispatchAcquireNextImage2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkAcquireNextImageInfoKHR *local_pAcquireInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pAcquireInfo) {
             local_pAcquireInfo = new safe_VkAcquireNextImageInfoKHR(pAcquireInfo);
             if (pAcquireInfo->swapchain) {
@@ -5794,12 +5765,10 @@ VkResult DispatchCreateDisplayModeKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
     VkResult result = layer_data->instance_dispatch_table.CreateDisplayModeKHR(physicalDevice, display, pCreateInfo, pAllocator, pMode);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pMode = layer_data->WrapNew(*pMode);
     }
     return result;
@@ -5814,8 +5783,7 @@ VkResult DispatchGetDisplayPlaneCapabilitiesKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        mode = layer_data->Unwrap(mode);
+        mode = layer_data->UnwrapInstanceScoped(mode);
     }
     VkResult result = layer_data->instance_dispatch_table.GetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
 
@@ -5830,13 +5798,13 @@ VkResult DispatchCreateDisplayPlaneSurfaceKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkDisplaySurfaceCreateInfoKHR *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkDisplaySurfaceCreateInfoKHR(pCreateInfo);
             if (pCreateInfo->displayMode) {
-                local_pCreateInfo->displayMode = layer_data->Unwrap(pCreateInfo->displayMode);
+                local_pCreateInfo->displayMode = layer_data->UnwrapInstanceScoped(pCreateInfo->displayMode);
             }
         }
     }
@@ -5845,7 +5813,6 @@ VkResult DispatchCreateDisplayPlaneSurfaceKHR(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -5865,7 +5832,6 @@ VkResult DispatchCreateXlibSurfaceKHR(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -5899,7 +5865,6 @@ VkResult DispatchCreateXcbSurfaceKHR(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateXcbSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -5933,7 +5898,6 @@ VkResult DispatchCreateWaylandSurfaceKHR(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateWaylandSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -5966,7 +5930,6 @@ VkResult DispatchCreateAndroidSurfaceKHR(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateAndroidSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -5985,7 +5948,6 @@ VkResult DispatchCreateWin32SurfaceKHR(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateWin32SurfaceKHR(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -6040,9 +6002,9 @@ VkResult DispatchGetPhysicalDeviceImageFormatProperties2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPhysicalDeviceImageFormatInfo2 *local_pImageFormatInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pImageFormatInfo) {
             local_pImageFormatInfo = new safe_VkPhysicalDeviceImageFormatInfo2(pImageFormatInfo);
             local_pImageFormatInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pImageFormatInfo->pNext);
@@ -6129,7 +6091,6 @@ void DispatchTrimCommandPoolKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.TrimCommandPoolKHR(device, commandPool, flags);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         commandPool = layer_data->Unwrap(commandPool);
     }
     layer_data->device_dispatch_table.TrimCommandPoolKHR(device, commandPool, flags);
@@ -6166,9 +6127,9 @@ VkResult DispatchGetMemoryWin32HandleKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetMemoryWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkMemoryGetWin32HandleInfoKHR *local_pGetWin32HandleInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pGetWin32HandleInfo) {
             local_pGetWin32HandleInfo = new safe_VkMemoryGetWin32HandleInfoKHR(pGetWin32HandleInfo);
             if (pGetWin32HandleInfo->memory) {
@@ -6206,9 +6167,9 @@ VkResult DispatchGetMemoryFdKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetMemoryFdKHR(device, pGetFdInfo, pFd);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkMemoryGetFdInfoKHR *local_pGetFdInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pGetFdInfo) {
             local_pGetFdInfo = new safe_VkMemoryGetFdInfoKHR(pGetFdInfo);
             if (pGetFdInfo->memory) {
@@ -6253,9 +6214,9 @@ VkResult DispatchImportSemaphoreWin32HandleKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ImportSemaphoreWin32HandleKHR(device, pImportSemaphoreWin32HandleInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImportSemaphoreWin32HandleInfoKHR *local_pImportSemaphoreWin32HandleInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pImportSemaphoreWin32HandleInfo) {
             local_pImportSemaphoreWin32HandleInfo = new safe_VkImportSemaphoreWin32HandleInfoKHR(pImportSemaphoreWin32HandleInfo);
             if (pImportSemaphoreWin32HandleInfo->semaphore) {
@@ -6280,9 +6241,9 @@ VkResult DispatchGetSemaphoreWin32HandleKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetSemaphoreWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSemaphoreGetWin32HandleInfoKHR *local_pGetWin32HandleInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pGetWin32HandleInfo) {
             local_pGetWin32HandleInfo = new safe_VkSemaphoreGetWin32HandleInfoKHR(pGetWin32HandleInfo);
             if (pGetWin32HandleInfo->semaphore) {
@@ -6304,9 +6265,9 @@ VkResult DispatchImportSemaphoreFdKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImportSemaphoreFdInfoKHR *local_pImportSemaphoreFdInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pImportSemaphoreFdInfo) {
             local_pImportSemaphoreFdInfo = new safe_VkImportSemaphoreFdInfoKHR(pImportSemaphoreFdInfo);
             if (pImportSemaphoreFdInfo->semaphore) {
@@ -6328,9 +6289,9 @@ VkResult DispatchGetSemaphoreFdKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSemaphoreGetFdInfoKHR *local_pGetFdInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pGetFdInfo) {
             local_pGetFdInfo = new safe_VkSemaphoreGetFdInfoKHR(pGetFdInfo);
             if (pGetFdInfo->semaphore) {
@@ -6355,12 +6316,13 @@ void DispatchCmdPushDescriptorSetKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkWriteDescriptorSet> local_pDescriptorWrites_storage;
     safe_VkWriteDescriptorSet *local_pDescriptorWrites = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         layout = layer_data->Unwrap(layout);
         if (pDescriptorWrites) {
-            local_pDescriptorWrites = new safe_VkWriteDescriptorSet[descriptorWriteCount];
+            local_pDescriptorWrites = local_pDescriptorWrites_storage.alloc(descriptorWriteCount);
             for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
                 local_pDescriptorWrites[index0].initialize(&pDescriptorWrites[index0]);
                 local_pDescriptorWrites[index0].pNext = CreateUnwrappedExtensionStructs(layer_data, local_pDescriptorWrites[index0].pNext);
@@ -6397,7 +6359,6 @@ void DispatchCmdPushDescriptorSetKHR(
         for (uint32_t index0 = 0; index0 < descriptorWriteCount; ++index0) {
             FreeUnwrappedExtensionStructs(const_cast<void *>(local_pDescriptorWrites[index0].pNext));
         }
-        delete[] local_pDescriptorWrites;
     }
 }
 
@@ -6418,9 +6379,9 @@ void DispatchCmdBeginRenderPass2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkRenderPassBeginInfo *local_pRenderPassBegin = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pRenderPassBegin) {
             local_pRenderPassBegin = new safe_VkRenderPassBeginInfo(pRenderPassBegin);
             if (pRenderPassBegin->renderPass) {
@@ -6465,7 +6426,6 @@ VkResult DispatchGetSwapchainStatusKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetSwapchainStatusKHR(device, swapchain);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result = layer_data->device_dispatch_table.GetSwapchainStatusKHR(device, swapchain);
@@ -6491,9 +6451,9 @@ VkResult DispatchImportFenceWin32HandleKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ImportFenceWin32HandleKHR(device, pImportFenceWin32HandleInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImportFenceWin32HandleInfoKHR *local_pImportFenceWin32HandleInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pImportFenceWin32HandleInfo) {
             local_pImportFenceWin32HandleInfo = new safe_VkImportFenceWin32HandleInfoKHR(pImportFenceWin32HandleInfo);
             if (pImportFenceWin32HandleInfo->fence) {
@@ -6518,9 +6478,9 @@ VkResult DispatchGetFenceWin32HandleKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetFenceWin32HandleKHR(device, pGetWin32HandleInfo, pHandle);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkFenceGetWin32HandleInfoKHR *local_pGetWin32HandleInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pGetWin32HandleInfo) {
             local_pGetWin32HandleInfo = new safe_VkFenceGetWin32HandleInfoKHR(pGetWin32HandleInfo);
             if (pGetWin32HandleInfo->fence) {
@@ -6542,9 +6502,9 @@ VkResult DispatchImportFenceFdKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ImportFenceFdKHR(device, pImportFenceFdInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImportFenceFdInfoKHR *local_pImportFenceFdInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pImportFenceFdInfo) {
             local_pImportFenceFdInfo = new safe_VkImportFenceFdInfoKHR(pImportFenceFdInfo);
             if (pImportFenceFdInfo->fence) {
@@ -6566,9 +6526,9 @@ VkResult DispatchGetFenceFdKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetFenceFdKHR(device, pGetFdInfo, pFd);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkFenceGetFdInfoKHR *local_pGetFdInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pGetFdInfo) {
             local_pGetFdInfo = new safe_VkFenceGetFdInfoKHR(pGetFdInfo);
             if (pGetFdInfo->fence) {
@@ -6590,13 +6550,13 @@ VkResult DispatchGetPhysicalDeviceSurfaceCapabilities2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPhysicalDeviceSurfaceInfo2KHR *local_pSurfaceInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pSurfaceInfo) {
             local_pSurfaceInfo = new safe_VkPhysicalDeviceSurfaceInfo2KHR(pSurfaceInfo);
             if (pSurfaceInfo->surface) {
-                local_pSurfaceInfo->surface = layer_data->Unwrap(pSurfaceInfo->surface);
+                local_pSurfaceInfo->surface = layer_data->UnwrapInstanceScoped(pSurfaceInfo->surface);
             }
         }
     }
@@ -6615,13 +6575,13 @@ VkResult DispatchGetPhysicalDeviceSurfaceFormats2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPhysicalDeviceSurfaceInfo2KHR *local_pSurfaceInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pSurfaceInfo) {
             local_pSurfaceInfo = new safe_VkPhysicalDeviceSurfaceInfo2KHR(pSurfaceInfo);
             if (pSurfaceInfo->surface) {
-                local_pSurfaceInfo->surface = layer_data->Unwrap(pSurfaceInfo->surface);
+                local_pSurfaceInfo->surface = layer_data->UnwrapInstanceScoped(pSurfaceInfo->surface);
             }
         }
     }
@@ -6645,13 +6605,13 @@ VkResult DispatchGetDisplayPlaneCapabilities2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkDisplayPlaneInfo2KHR *local_pDisplayPlaneInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pDisplayPlaneInfo) {
             local_pDisplayPlaneInfo = new safe_VkDisplayPlaneInfo2KHR(pDisplayPlaneInfo);
             if (pDisplayPlaneInfo->mode) {
-                local_pDisplayPlaneInfo->mode = layer_data->Unwrap(pDisplayPlaneInfo->mode);
+                local_pDisplayPlaneInfo->mode = layer_data->UnwrapInstanceScoped(pDisplayPlaneInfo->mode);
             }
         }
     }
@@ -6669,9 +6629,9 @@ void DispatchGetImageMemoryRequirements2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageMemoryRequirementsInfo2 *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkImageMemoryRequirementsInfo2(pInfo);
             if (pInfo->image) {
@@ -6692,9 +6652,9 @@ void DispatchGetBufferMemoryRequirements2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkBufferMemoryRequirementsInfo2 *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkBufferMemoryRequirementsInfo2(pInfo);
             if (pInfo->buffer) {
@@ -6716,9 +6676,9 @@ void DispatchGetImageSparseMemoryRequirements2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageSparseMemoryRequirementsInfo2 *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkImageSparseMemoryRequirementsInfo2(pInfo);
             if (pInfo->image) {
@@ -6740,9 +6700,9 @@ VkResult DispatchCreateSamplerYcbcrConversionKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSamplerYcbcrConversionKHR(device, pCreateInfo, pAllocator, pYcbcrConversion);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkSamplerYcbcrConversionCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkSamplerYcbcrConversionCreateInfo(pCreateInfo);
             local_pCreateInfo->pNext = CreateUnwrappedExtensionStructs(layer_data, local_pCreateInfo->pNext);
@@ -6754,7 +6714,6 @@ VkResult DispatchCreateSamplerYcbcrConversionKHR(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pYcbcrConversion = layer_data->WrapNew(*pYcbcrConversion);
     }
     return result;
@@ -6767,11 +6726,13 @@ void DispatchDestroySamplerYcbcrConversionKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t ycbcrConversion_id = reinterpret_cast<uint64_t &>(ycbcrConversion);
-    ycbcrConversion = (VkSamplerYcbcrConversion)unique_id_mapping[ycbcrConversion_id];
-    unique_id_mapping.erase(ycbcrConversion_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(ycbcrConversion_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        ycbcrConversion = (VkSamplerYcbcrConversion)iter->second;
+    } else {
+        ycbcrConversion = (VkSamplerYcbcrConversion)0;
+    }
     layer_data->device_dispatch_table.DestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
 
 }
@@ -6783,11 +6744,12 @@ VkResult DispatchBindBufferMemory2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBindBufferMemoryInfo> local_pBindInfos_storage;
     safe_VkBindBufferMemoryInfo *local_pBindInfos = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindBufferMemoryInfo[bindInfoCount];
+            local_pBindInfos = local_pBindInfos_storage.alloc(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].buffer) {
@@ -6800,9 +6762,6 @@ VkResult DispatchBindBufferMemory2KHR(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindBufferMemory2KHR(device, bindInfoCount, (const VkBindBufferMemoryInfo*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
     return result;
 }
 
@@ -6813,11 +6772,12 @@ VkResult DispatchBindImageMemory2KHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBindImageMemoryInfo> local_pBindInfos_storage;
     safe_VkBindImageMemoryInfo *local_pBindInfos = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindImageMemoryInfo[bindInfoCount];
+            local_pBindInfos = local_pBindInfos_storage.alloc(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 local_pBindInfos[index0].pNext = CreateUnwrappedExtensionStructs(layer_data, local_pBindInfos[index0].pNext);
@@ -6835,7 +6795,6 @@ VkResult DispatchBindImageMemory2KHR(
         for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
             FreeUnwrappedExtensionStructs(const_cast<void *>(local_pBindInfos[index0].pNext));
         }
-        delete[] local_pBindInfos;
     }
     return result;
 }
@@ -6847,9 +6806,9 @@ void DispatchGetDescriptorSetLayoutSupportKHR(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkDescriptorSetLayoutCreateInfo *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkDescriptorSetLayoutCreateInfo(pCreateInfo);
             if (local_pCreateInfo->pBindings) {
@@ -6881,7 +6840,6 @@ void DispatchCmdDrawIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
         countBuffer = layer_data->Unwrap(countBuffer);
     }
@@ -6901,7 +6859,6 @@ void DispatchCmdDrawIndexedIndirectCountKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
         countBuffer = layer_data->Unwrap(countBuffer);
     }
@@ -6919,7 +6876,6 @@ VkResult DispatchCreateDebugReportCallbackEXT(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     VkResult result = layer_data->instance_dispatch_table.CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pCallback);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pCallback = layer_data->WrapNew(*pCallback);
     }
     return result;
@@ -6932,11 +6888,13 @@ void DispatchDestroyDebugReportCallbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.DestroyDebugReportCallbackEXT(instance, callback, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t callback_id = reinterpret_cast<uint64_t &>(callback);
-    callback = (VkDebugReportCallbackEXT)unique_id_mapping[callback_id];
-    unique_id_mapping.erase(callback_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(callback_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        callback = (VkDebugReportCallbackEXT)iter->second;
+    } else {
+        callback = (VkDebugReportCallbackEXT)0;
+    }
     layer_data->instance_dispatch_table.DestroyDebugReportCallbackEXT(instance, callback, pAllocator);
 
 }
@@ -6996,19 +6954,17 @@ void DispatchCmdBindTransformFeedbackBuffersEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+    vl_transient_array<VkBuffer> local_pBuffers_storage;
     VkBuffer *local_pBuffers = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBuffers) {
-            local_pBuffers = new VkBuffer[bindingCount];
+            local_pBuffers = local_pBuffers_storage.alloc(bindingCount);
             for (uint32_t index0 = 0; index0 < bindingCount; ++index0) {
                 local_pBuffers[index0] = layer_data->Unwrap(pBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, (const VkBuffer*)local_pBuffers, pOffsets, pSizes);
-    if (local_pBuffers)
-        delete[] local_pBuffers;
 }
 
 void DispatchCmdBeginTransformFeedbackEXT(
@@ -7020,19 +6976,17 @@ void DispatchCmdBeginTransformFeedbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    vl_transient_array<VkBuffer> local_pCounterBuffers_storage;
     VkBuffer *local_pCounterBuffers = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCounterBuffers) {
-            local_pCounterBuffers = new VkBuffer[counterBufferCount];
+            local_pCounterBuffers = local_pCounterBuffers_storage.alloc(counterBufferCount);
             for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
                 local_pCounterBuffers[index0] = layer_data->Unwrap(pCounterBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, (const VkBuffer*)local_pCounterBuffers, pCounterBufferOffsets);
-    if (local_pCounterBuffers)
-        delete[] local_pCounterBuffers;
 }
 
 void DispatchCmdEndTransformFeedbackEXT(
@@ -7044,19 +6998,17 @@ void DispatchCmdEndTransformFeedbackEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    vl_transient_array<VkBuffer> local_pCounterBuffers_storage;
     VkBuffer *local_pCounterBuffers = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCounterBuffers) {
-            local_pCounterBuffers = new VkBuffer[counterBufferCount];
+            local_pCounterBuffers = local_pCounterBuffers_storage.alloc(counterBufferCount);
             for (uint32_t index0 = 0; index0 < counterBufferCount; ++index0) {
                 local_pCounterBuffers[index0] = layer_data->Unwrap(pCounterBuffers[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, (const VkBuffer*)local_pCounterBuffers, pCounterBufferOffsets);
-    if (local_pCounterBuffers)
-        delete[] local_pCounterBuffers;
 }
 
 void DispatchCmdBeginQueryIndexedEXT(
@@ -7069,7 +7021,6 @@ void DispatchCmdBeginQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
@@ -7085,7 +7036,6 @@ void DispatchCmdEndQueryIndexedEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
@@ -7104,7 +7054,6 @@ void DispatchCmdDrawIndirectByteCountEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         counterBuffer = layer_data->Unwrap(counterBuffer);
     }
     layer_data->device_dispatch_table.CmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
@@ -7117,9 +7066,9 @@ uint32_t DispatchGetImageViewHandleNVX(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageViewHandleNVX(device, pInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkImageViewHandleInfoNVX *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkImageViewHandleInfoNVX(pInfo);
             if (pInfo->imageView) {
@@ -7149,7 +7098,6 @@ void DispatchCmdDrawIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
         countBuffer = layer_data->Unwrap(countBuffer);
     }
@@ -7169,7 +7117,6 @@ void DispatchCmdDrawIndexedIndirectCountAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
         countBuffer = layer_data->Unwrap(countBuffer);
     }
@@ -7188,7 +7135,6 @@ VkResult DispatchGetShaderInfoAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipeline = layer_data->Unwrap(pipeline);
     }
     VkResult result = layer_data->device_dispatch_table.GetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
@@ -7208,7 +7154,6 @@ VkResult DispatchCreateStreamDescriptorSurfaceGGP(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateStreamDescriptorSurfaceGGP(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -7242,7 +7187,6 @@ VkResult DispatchGetMemoryWin32HandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetMemoryWin32HandleNV(device, memory, handleType, pHandle);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         memory = layer_data->Unwrap(memory);
     }
     VkResult result = layer_data->device_dispatch_table.GetMemoryWin32HandleNV(device, memory, handleType, pHandle);
@@ -7263,7 +7207,6 @@ VkResult DispatchCreateViSurfaceNN(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateViSurfaceNN(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -7276,9 +7219,9 @@ void DispatchCmdBeginConditionalRenderingEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkConditionalRenderingBeginInfoEXT *local_pConditionalRenderingBegin = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pConditionalRenderingBegin) {
             local_pConditionalRenderingBegin = new safe_VkConditionalRenderingBeginInfoEXT(pConditionalRenderingBegin);
             if (pConditionalRenderingBegin->buffer) {
@@ -7306,9 +7249,9 @@ void DispatchCmdProcessCommandsNVX(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkCmdProcessCommandsInfoNVX *local_pProcessCommandsInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pProcessCommandsInfo) {
             local_pProcessCommandsInfo = new safe_VkCmdProcessCommandsInfoNVX(pProcessCommandsInfo);
             if (pProcessCommandsInfo->objectTable) {
@@ -7344,9 +7287,9 @@ void DispatchCmdReserveSpaceForCommandsNVX(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkCmdReserveSpaceForCommandsInfoNVX *local_pReserveSpaceInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pReserveSpaceInfo) {
             local_pReserveSpaceInfo = new safe_VkCmdReserveSpaceForCommandsInfoNVX(pReserveSpaceInfo);
             if (pReserveSpaceInfo->objectTable) {
@@ -7373,7 +7316,6 @@ VkResult DispatchCreateIndirectCommandsLayoutNVX(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     VkResult result = layer_data->device_dispatch_table.CreateIndirectCommandsLayoutNVX(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pIndirectCommandsLayout = layer_data->WrapNew(*pIndirectCommandsLayout);
     }
     return result;
@@ -7386,11 +7328,13 @@ void DispatchDestroyIndirectCommandsLayoutNVX(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t indirectCommandsLayout_id = reinterpret_cast<uint64_t &>(indirectCommandsLayout);
-    indirectCommandsLayout = (VkIndirectCommandsLayoutNVX)unique_id_mapping[indirectCommandsLayout_id];
-    unique_id_mapping.erase(indirectCommandsLayout_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(indirectCommandsLayout_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        indirectCommandsLayout = (VkIndirectCommandsLayoutNVX)iter->second;
+    } else {
+        indirectCommandsLayout = (VkIndirectCommandsLayoutNVX)0;
+    }
     layer_data->device_dispatch_table.DestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, pAllocator);
 
 }
@@ -7405,7 +7349,6 @@ VkResult DispatchCreateObjectTableNVX(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
     VkResult result = layer_data->device_dispatch_table.CreateObjectTableNVX(device, pCreateInfo, pAllocator, pObjectTable);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pObjectTable = layer_data->WrapNew(*pObjectTable);
     }
     return result;
@@ -7418,11 +7361,13 @@ void DispatchDestroyObjectTableNVX(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyObjectTableNVX(device, objectTable, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t objectTable_id = reinterpret_cast<uint64_t &>(objectTable);
-    objectTable = (VkObjectTableNVX)unique_id_mapping[objectTable_id];
-    unique_id_mapping.erase(objectTable_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(objectTable_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        objectTable = (VkObjectTableNVX)iter->second;
+    } else {
+        objectTable = (VkObjectTableNVX)0;
+    }
     layer_data->device_dispatch_table.DestroyObjectTableNVX(device, objectTable, pAllocator);
 
 }
@@ -7437,7 +7382,6 @@ VkResult DispatchRegisterObjectsNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.RegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         objectTable = layer_data->Unwrap(objectTable);
     }
     VkResult result = layer_data->device_dispatch_table.RegisterObjectsNVX(device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
@@ -7455,7 +7399,6 @@ VkResult DispatchUnregisterObjectsNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.UnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         objectTable = layer_data->Unwrap(objectTable);
     }
     VkResult result = layer_data->device_dispatch_table.UnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
@@ -7491,8 +7434,7 @@ VkResult DispatchReleaseDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.ReleaseDisplayEXT(physicalDevice, display);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
     VkResult result = layer_data->instance_dispatch_table.ReleaseDisplayEXT(physicalDevice, display);
 
@@ -7509,8 +7451,7 @@ VkResult DispatchAcquireXlibDisplayEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.AcquireXlibDisplayEXT(physicalDevice, dpy, display);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
     VkResult result = layer_data->instance_dispatch_table.AcquireXlibDisplayEXT(physicalDevice, dpy, display);
 
@@ -7530,7 +7471,6 @@ VkResult DispatchGetRandROutputDisplayEXT(
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     VkResult result = layer_data->instance_dispatch_table.GetRandROutputDisplayEXT(physicalDevice, dpy, rrOutput, pDisplay);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pDisplay = layer_data->WrapNew(*pDisplay);
     }
     return result;
@@ -7545,8 +7485,7 @@ VkResult DispatchGetPhysicalDeviceSurfaceCapabilities2EXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        surface = layer_data->Unwrap(surface);
+        surface = layer_data->UnwrapInstanceScoped(surface);
     }
     VkResult result = layer_data->instance_dispatch_table.GetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
 
@@ -7561,8 +7500,7 @@ VkResult DispatchDisplayPowerControlEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DisplayPowerControlEXT(device, display, pDisplayPowerInfo);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
     VkResult result = layer_data->device_dispatch_table.DisplayPowerControlEXT(device, display, pDisplayPowerInfo);
 
@@ -7579,7 +7517,6 @@ VkResult DispatchRegisterDeviceEventEXT(
     if (!wrap_handles) return layer_data->device_dispatch_table.RegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     VkResult result = layer_data->device_dispatch_table.RegisterDeviceEventEXT(device, pDeviceEventInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pFence = layer_data->WrapNew(*pFence);
     }
     return result;
@@ -7595,12 +7532,10 @@ VkResult DispatchRegisterDisplayEventEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.RegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
+        display = layer_data->UnwrapInstanceScoped(display);
     }
     VkResult result = layer_data->device_dispatch_table.RegisterDisplayEventEXT(device, display, pDisplayEventInfo, pAllocator, pFence);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pFence = layer_data->WrapNew(*pFence);
     }
     return result;
@@ -7615,7 +7550,6 @@ VkResult DispatchGetSwapchainCounterEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result = layer_data->device_dispatch_table.GetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
@@ -7631,7 +7565,6 @@ VkResult DispatchGetRefreshCycleDurationGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result = layer_data->device_dispatch_table.GetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
@@ -7648,7 +7581,6 @@ VkResult DispatchGetPastPresentationTimingGOOGLE(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result = layer_data->device_dispatch_table.GetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
@@ -7675,19 +7607,17 @@ void DispatchSetHdrMetadataEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+    vl_transient_array<VkSwapchainKHR> local_pSwapchains_storage;
     VkSwapchainKHR *local_pSwapchains = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pSwapchains) {
-            local_pSwapchains = new VkSwapchainKHR[swapchainCount];
+            local_pSwapchains = local_pSwapchains_storage.alloc(swapchainCount);
             for (uint32_t index0 = 0; index0 < swapchainCount; ++index0) {
                 local_pSwapchains[index0] = layer_data->Unwrap(pSwapchains[index0]);
             }
         }
     }
     layer_data->device_dispatch_table.SetHdrMetadataEXT(device, swapchainCount, (const VkSwapchainKHR*)local_pSwapchains, pMetadata);
-    if (local_pSwapchains)
-        delete[] local_pSwapchains;
 }
 
 #ifdef VK_USE_PLATFORM_IOS_MVK
@@ -7702,7 +7632,6 @@ VkResult DispatchCreateIOSSurfaceMVK(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateIOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -7721,7 +7650,6 @@ VkResult DispatchCreateMacOSSurfaceMVK(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateMacOSSurfaceMVK(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -7794,7 +7722,6 @@ VkResult DispatchCreateDebugUtilsMessengerEXT(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     VkResult result = layer_data->instance_dispatch_table.CreateDebugUtilsMessengerEXT(instance, pCreateInfo, pAllocator, pMessenger);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pMessenger = layer_data->WrapNew(*pMessenger);
     }
     return result;
@@ -7807,11 +7734,13 @@ void DispatchDestroyDebugUtilsMessengerEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.DestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t messenger_id = reinterpret_cast<uint64_t &>(messenger);
-    messenger = (VkDebugUtilsMessengerEXT)unique_id_mapping[messenger_id];
-    unique_id_mapping.erase(messenger_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(messenger_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        messenger = (VkDebugUtilsMessengerEXT)iter->second;
+    } else {
+        messenger = (VkDebugUtilsMessengerEXT)0;
+    }
     layer_data->instance_dispatch_table.DestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
 
 }
@@ -7850,9 +7779,9 @@ VkResult DispatchGetMemoryAndroidHardwareBufferANDROID(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetMemoryAndroidHardwareBufferANDROID(device, pInfo, pBuffer);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(pInfo);
             if (pInfo->memory) {
@@ -7895,7 +7824,6 @@ VkResult DispatchGetImageDrmFormatModifierPropertiesEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         image = layer_data->Unwrap(image);
     }
     VkResult result = layer_data->device_dispatch_table.GetImageDrmFormatModifierPropertiesEXT(device, image, pProperties);
@@ -7913,7 +7841,6 @@ VkResult DispatchCreateValidationCacheEXT(
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
     VkResult result = layer_data->device_dispatch_table.CreateValidationCacheEXT(device, pCreateInfo, pAllocator, pValidationCache);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pValidationCache = layer_data->WrapNew(*pValidationCache);
     }
     return result;
@@ -7926,11 +7853,13 @@ void DispatchDestroyValidationCacheEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyValidationCacheEXT(device, validationCache, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t validationCache_id = reinterpret_cast<uint64_t &>(validationCache);
-    validationCache = (VkValidationCacheEXT)unique_id_mapping[validationCache_id];
-    unique_id_mapping.erase(validationCache_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(validationCache_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        validationCache = (VkValidationCacheEXT)iter->second;
+    } else {
+        validationCache = (VkValidationCacheEXT)0;
+    }
     layer_data->device_dispatch_table.DestroyValidationCacheEXT(device, validationCache, pAllocator);
 
 }
@@ -7943,20 +7872,18 @@ VkResult DispatchMergeValidationCachesEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+    vl_transient_array<VkValidationCacheEXT> local_pSrcCaches_storage;
     VkValidationCacheEXT *local_pSrcCaches = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         dstCache = layer_data->Unwrap(dstCache);
         if (pSrcCaches) {
-            local_pSrcCaches = new VkValidationCacheEXT[srcCacheCount];
+            local_pSrcCaches = local_pSrcCaches_storage.alloc(srcCacheCount);
             for (uint32_t index0 = 0; index0 < srcCacheCount; ++index0) {
                 local_pSrcCaches[index0] = layer_data->Unwrap(pSrcCaches[index0]);
             }
         }
     }
     VkResult result = layer_data->device_dispatch_table.MergeValidationCachesEXT(device, dstCache, srcCacheCount, (const VkValidationCacheEXT*)local_pSrcCaches);
-    if (local_pSrcCaches)
-        delete[] local_pSrcCaches;
     return result;
 }
 
@@ -7969,7 +7896,6 @@ VkResult DispatchGetValidationCacheDataEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         validationCache = layer_data->Unwrap(validationCache);
     }
     VkResult result = layer_data->device_dispatch_table.GetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
@@ -7985,7 +7911,6 @@ void DispatchCmdBindShadingRateImageNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         imageView = layer_data->Unwrap(imageView);
     }
     layer_data->device_dispatch_table.CmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
@@ -8022,9 +7947,9 @@ VkResult DispatchCreateAccelerationStructureNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateAccelerationStructureNV(device, pCreateInfo, pAllocator, pAccelerationStructure);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkAccelerationStructureCreateInfoNV *local_pCreateInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pCreateInfo) {
             local_pCreateInfo = new safe_VkAccelerationStructureCreateInfoNV(pCreateInfo);
             if (local_pCreateInfo->info.pGeometries) {
@@ -8050,7 +7975,6 @@ VkResult DispatchCreateAccelerationStructureNV(
         delete local_pCreateInfo;
     }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pAccelerationStructure = layer_data->WrapNew(*pAccelerationStructure);
     }
     return result;
@@ -8063,11 +7987,13 @@ void DispatchDestroyAccelerationStructureNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t accelerationStructure_id = reinterpret_cast<uint64_t &>(accelerationStructure);
-    accelerationStructure = (VkAccelerationStructureNV)unique_id_mapping[accelerationStructure_id];
-    unique_id_mapping.erase(accelerationStructure_id);
-    lock.unlock();
+    auto iter = layer_data->unique_id_mapping.pop(accelerationStructure_id);
+    if (iter != layer_data->unique_id_mapping.end()) {
+        accelerationStructure = (VkAccelerationStructureNV)iter->second;
+    } else {
+        accelerationStructure = (VkAccelerationStructureNV)0;
+    }
     layer_data->device_dispatch_table.DestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
 
 }
@@ -8079,9 +8005,9 @@ void DispatchGetAccelerationStructureMemoryRequirementsNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetAccelerationStructureMemoryRequirementsNV(device, pInfo, pMemoryRequirements);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkAccelerationStructureMemoryRequirementsInfoNV *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkAccelerationStructureMemoryRequirementsInfoNV(pInfo);
             if (pInfo->accelerationStructure) {
@@ -8102,11 +8028,12 @@ VkResult DispatchBindAccelerationStructureMemoryNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.BindAccelerationStructureMemoryNV(device, bindInfoCount, pBindInfos);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkBindAccelerationStructureMemoryInfoNV> local_pBindInfos_storage;
     safe_VkBindAccelerationStructureMemoryInfoNV *local_pBindInfos = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pBindInfos) {
-            local_pBindInfos = new safe_VkBindAccelerationStructureMemoryInfoNV[bindInfoCount];
+            local_pBindInfos = local_pBindInfos_storage.alloc(bindInfoCount);
             for (uint32_t index0 = 0; index0 < bindInfoCount; ++index0) {
                 local_pBindInfos[index0].initialize(&pBindInfos[index0]);
                 if (pBindInfos[index0].accelerationStructure) {
@@ -8119,9 +8046,6 @@ VkResult DispatchBindAccelerationStructureMemoryNV(
         }
     }
     VkResult result = layer_data->device_dispatch_table.BindAccelerationStructureMemoryNV(device, bindInfoCount, (const VkBindAccelerationStructureMemoryInfoNV*)local_pBindInfos);
-    if (local_pBindInfos) {
-        delete[] local_pBindInfos;
-    }
     return result;
 }
 
@@ -8138,9 +8062,9 @@ void DispatchCmdBuildAccelerationStructureNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkAccelerationStructureInfoNV *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkAccelerationStructureInfoNV(pInfo);
             if (local_pInfo->pGeometries) {
@@ -8180,7 +8104,6 @@ void DispatchCmdCopyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         dst = layer_data->Unwrap(dst);
         src = layer_data->Unwrap(src);
     }
@@ -8208,7 +8131,6 @@ void DispatchCmdTraceRaysNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         raygenShaderBindingTableBuffer = layer_data->Unwrap(raygenShaderBindingTableBuffer);
         missShaderBindingTableBuffer = layer_data->Unwrap(missShaderBindingTableBuffer);
         hitShaderBindingTableBuffer = layer_data->Unwrap(hitShaderBindingTableBuffer);
@@ -8228,12 +8150,13 @@ VkResult DispatchCreateRayTracingPipelinesNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    safe_struct_transient_arena_scope transient_arena;
+    vl_transient_array<safe_VkRayTracingPipelineCreateInfoNV> local_pCreateInfos_storage;
     safe_VkRayTracingPipelineCreateInfoNV *local_pCreateInfos = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipelineCache = layer_data->Unwrap(pipelineCache);
         if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkRayTracingPipelineCreateInfoNV[createInfoCount];
+            local_pCreateInfos = local_pCreateInfos_storage.alloc(createInfoCount);
             for (uint32_t index0 = 0; index0 < createInfoCount; ++index0) {
                 local_pCreateInfos[index0].initialize(&pCreateInfos[index0]);
                 if (local_pCreateInfos[index0].pStages) {
@@ -8253,11 +8176,7 @@ VkResult DispatchCreateRayTracingPipelinesNV(
         }
     }
     VkResult result = layer_data->device_dispatch_table.CreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, (const VkRayTracingPipelineCreateInfoNV*)local_pCreateInfos, pAllocator, pPipelines);
-    if (local_pCreateInfos) {
-        delete[] local_pCreateInfos;
-    }
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         for (uint32_t index0 = 0; index0 < createInfoCount; index0++) {
             pPipelines[index0] = layer_data->WrapNew(pPipelines[index0]);
         }
@@ -8276,7 +8195,6 @@ VkResult DispatchGetRayTracingShaderGroupHandlesNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipeline = layer_data->Unwrap(pipeline);
     }
     VkResult result = layer_data->device_dispatch_table.GetRayTracingShaderGroupHandlesNV(device, pipeline, firstGroup, groupCount, dataSize, pData);
@@ -8293,7 +8211,6 @@ VkResult DispatchGetAccelerationStructureHandleNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         accelerationStructure = layer_data->Unwrap(accelerationStructure);
     }
     VkResult result = layer_data->device_dispatch_table.GetAccelerationStructureHandleNV(device, accelerationStructure, dataSize, pData);
@@ -8311,11 +8228,11 @@ void DispatchCmdWriteAccelerationStructuresPropertiesNV(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    vl_transient_array<VkAccelerationStructureNV> local_pAccelerationStructures_storage;
     VkAccelerationStructureNV *local_pAccelerationStructures = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pAccelerationStructures) {
-            local_pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
+            local_pAccelerationStructures = local_pAccelerationStructures_storage.alloc(accelerationStructureCount);
             for (uint32_t index0 = 0; index0 < accelerationStructureCount; ++index0) {
                 local_pAccelerationStructures[index0] = layer_data->Unwrap(pAccelerationStructures[index0]);
             }
@@ -8323,8 +8240,6 @@ void DispatchCmdWriteAccelerationStructuresPropertiesNV(
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, (const VkAccelerationStructureNV*)local_pAccelerationStructures, queryType, queryPool, firstQuery);
-    if (local_pAccelerationStructures)
-        delete[] local_pAccelerationStructures;
 }
 
 VkResult DispatchCompileDeferredNV(
@@ -8335,7 +8250,6 @@ VkResult DispatchCompileDeferredNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CompileDeferredNV(device, pipeline, shader);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipeline = layer_data->Unwrap(pipeline);
     }
     VkResult result = layer_data->device_dispatch_table.CompileDeferredNV(device, pipeline, shader);
@@ -8365,7 +8279,6 @@ void DispatchCmdWriteBufferMarkerAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         dstBuffer = layer_data->Unwrap(dstBuffer);
     }
     layer_data->device_dispatch_table.CmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
@@ -8416,7 +8329,6 @@ void DispatchCmdDrawMeshTasksIndirectNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
     }
     layer_data->device_dispatch_table.CmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
@@ -8435,7 +8347,6 @@ void DispatchCmdDrawMeshTasksIndirectCountNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.CmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         buffer = layer_data->Unwrap(buffer);
         countBuffer = layer_data->Unwrap(countBuffer);
     }
@@ -8529,7 +8440,6 @@ VkResult DispatchAcquirePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pConfiguration = layer_data->Unwrap(pConfiguration);
     }
     VkResult result = layer_data->device_dispatch_table.AcquirePerformanceConfigurationINTEL(device, pAcquireInfo, pConfiguration);
@@ -8544,7 +8454,6 @@ VkResult DispatchReleasePerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ReleasePerformanceConfigurationINTEL(device, configuration);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         configuration = layer_data->Unwrap(configuration);
     }
     VkResult result = layer_data->device_dispatch_table.ReleasePerformanceConfigurationINTEL(device, configuration);
@@ -8559,7 +8468,6 @@ VkResult DispatchQueueSetPerformanceConfigurationINTEL(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueueSetPerformanceConfigurationINTEL(queue, configuration);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         configuration = layer_data->Unwrap(configuration);
     }
     VkResult result = layer_data->device_dispatch_table.QueueSetPerformanceConfigurationINTEL(queue, configuration);
@@ -8586,7 +8494,6 @@ void DispatchSetLocalDimmingAMD(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetLocalDimmingAMD(device, swapChain, localDimmingEnable);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapChain = layer_data->Unwrap(swapChain);
     }
     layer_data->device_dispatch_table.SetLocalDimmingAMD(device, swapChain, localDimmingEnable);
@@ -8605,7 +8512,6 @@ VkResult DispatchCreateImagePipeSurfaceFUCHSIA(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateImagePipeSurfaceFUCHSIA(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -8624,7 +8530,6 @@ VkResult DispatchCreateMetalSurfaceEXT(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateMetalSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -8637,9 +8542,9 @@ VkDeviceAddress DispatchGetBufferDeviceAddressEXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetBufferDeviceAddressEXT(device, pInfo);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkBufferDeviceAddressInfoEXT *local_pInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pInfo) {
             local_pInfo = new safe_VkBufferDeviceAddressInfoEXT(pInfo);
             if (pInfo->buffer) {
@@ -8686,13 +8591,13 @@ VkResult DispatchGetPhysicalDeviceSurfacePresentModes2EXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(physicalDevice), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.GetPhysicalDeviceSurfacePresentModes2EXT(physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPhysicalDeviceSurfaceInfo2KHR *local_pSurfaceInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pSurfaceInfo) {
             local_pSurfaceInfo = new safe_VkPhysicalDeviceSurfaceInfo2KHR(pSurfaceInfo);
             if (pSurfaceInfo->surface) {
-                local_pSurfaceInfo->surface = layer_data->Unwrap(pSurfaceInfo->surface);
+                local_pSurfaceInfo->surface = layer_data->UnwrapInstanceScoped(pSurfaceInfo->surface);
             }
         }
     }
@@ -8713,7 +8618,6 @@ VkResult DispatchAcquireFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AcquireFullScreenExclusiveModeEXT(device, swapchain);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result = layer_data->device_dispatch_table.AcquireFullScreenExclusiveModeEXT(device, swapchain);
@@ -8731,7 +8635,6 @@ VkResult DispatchReleaseFullScreenExclusiveModeEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ReleaseFullScreenExclusiveModeEXT(device, swapchain);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result = layer_data->device_dispatch_table.ReleaseFullScreenExclusiveModeEXT(device, swapchain);
@@ -8749,13 +8652,13 @@ VkResult DispatchGetDeviceGroupSurfacePresentModes2EXT(
 {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.GetDeviceGroupSurfacePresentModes2EXT(device, pSurfaceInfo, pModes);
+    safe_struct_transient_arena_scope transient_arena;
     safe_VkPhysicalDeviceSurfaceInfo2KHR *local_pSurfaceInfo = NULL;
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         if (pSurfaceInfo) {
             local_pSurfaceInfo = new safe_VkPhysicalDeviceSurfaceInfo2KHR(pSurfaceInfo);
             if (pSurfaceInfo->surface) {
-                local_pSurfaceInfo->surface = layer_data->Unwrap(pSurfaceInfo->surface);
+                local_pSurfaceInfo->surface = layer_data->UnwrapInstanceScoped(pSurfaceInfo->surface);
             }
         }
     }
@@ -8777,7 +8680,6 @@ VkResult DispatchCreateHeadlessSurfaceEXT(
     if (!wrap_handles) return layer_data->instance_dispatch_table.CreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     VkResult result = layer_data->instance_dispatch_table.CreateHeadlessSurfaceEXT(instance, pCreateInfo, pAllocator, pSurface);
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSurface = layer_data->WrapNew(*pSurface);
     }
     return result;
@@ -8792,7 +8694,6 @@ void DispatchResetQueryPoolEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
     {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         queryPool = layer_data->Unwrap(queryPool);
     }
     layer_data->device_dispatch_table.ResetQueryPoolEXT(device, queryPool, firstQuery, queryCount);
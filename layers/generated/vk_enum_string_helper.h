@@ -38,6 +38,33 @@
 #include <string>
 #include <vulkan/vulkan.h>
 
+// Shared writer behind the string_Vk*Flags(value, buffer, buffer_size) helpers below: renders
+// the set bit names '|'-separated into the caller's buffer and returns it.  Never allocates,
+// so logging paths can render flags without heap traffic; output is always NUL-terminated and
+// truncates if the buffer is too small.
+template <typename BitsType>
+static inline const char* string_flags_into(VkFlags input_value, const char* (*string_bits)(BitsType), char *buffer,
+                                            size_t buffer_size)
+{
+    if (buffer_size == 0) return "";
+    size_t used = 0;
+    int index = 0;
+    while(input_value) {
+        if (input_value & 1) {
+            const char* name = string_bits(static_cast<BitsType>(1 << index));
+            if ((used != 0) && (used + 1 < buffer_size)) buffer[used++] = '|';
+            while (*name && (used + 1 < buffer_size)) buffer[used++] = *name++;
+        }
+        ++index;
+        input_value >>= 1;
+    }
+    if (used == 0) {
+        const char* name = string_bits(static_cast<BitsType>(0));
+        while (*name && (used + 1 < buffer_size)) buffer[used++] = *name++;
+    }
+    buffer[used] = '\0';
+    return buffer;
+}
 
 static inline const char* string_VkPipelineCacheHeaderVersion(VkPipelineCacheHeaderVersion input_value)
 {
@@ -1396,20 +1423,15 @@ static inline const char* string_VkFormatFeatureFlagBits(VkFormatFeatureFlagBits
     }
 }
 
+static inline const char* string_VkFormatFeatureFlags(VkFormatFeatureFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkFormatFeatureFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkFormatFeatureFlags(VkFormatFeatureFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkFormatFeatureFlagBits(static_cast<VkFormatFeatureFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkFormatFeatureFlagBits(static_cast<VkFormatFeatureFlagBits>(0)));
-    return ret;
+    char buffer[1240];
+    return string_VkFormatFeatureFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkImageType(VkImageType input_value)
@@ -1471,20 +1493,15 @@ static inline const char* string_VkImageUsageFlagBits(VkImageUsageFlagBits input
     }
 }
 
+static inline const char* string_VkImageUsageFlags(VkImageUsageFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkImageUsageFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkImageUsageFlags(VkImageUsageFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkImageUsageFlagBits(static_cast<VkImageUsageFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkImageUsageFlagBits(static_cast<VkImageUsageFlagBits>(0)));
-    return ret;
+    char buffer[391];
+    return string_VkImageUsageFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkImageCreateFlagBits(VkImageCreateFlagBits input_value)
@@ -1526,20 +1543,15 @@ static inline const char* string_VkImageCreateFlagBits(VkImageCreateFlagBits inp
     }
 }
 
+static inline const char* string_VkImageCreateFlags(VkImageCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkImageCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkImageCreateFlags(VkImageCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkImageCreateFlagBits(static_cast<VkImageCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkImageCreateFlagBits(static_cast<VkImageCreateFlagBits>(0)));
-    return ret;
+    char buffer[598];
+    return string_VkImageCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSampleCountFlagBits(VkSampleCountFlagBits input_value)
@@ -1565,20 +1577,15 @@ static inline const char* string_VkSampleCountFlagBits(VkSampleCountFlagBits inp
     }
 }
 
+static inline const char* string_VkSampleCountFlags(VkSampleCountFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSampleCountFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSampleCountFlags(VkSampleCountFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSampleCountFlagBits(static_cast<VkSampleCountFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSampleCountFlagBits(static_cast<VkSampleCountFlagBits>(0)));
-    return ret;
+    char buffer[190];
+    return string_VkSampleCountFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPhysicalDeviceType(VkPhysicalDeviceType input_value)
@@ -1619,20 +1626,15 @@ static inline const char* string_VkQueueFlagBits(VkQueueFlagBits input_value)
     }
 }
 
+static inline const char* string_VkQueueFlags(VkQueueFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkQueueFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkQueueFlags(VkQueueFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkQueueFlagBits(static_cast<VkQueueFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkQueueFlagBits(static_cast<VkQueueFlagBits>(0)));
-    return ret;
+    char buffer[143];
+    return string_VkQueueFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkMemoryPropertyFlagBits(VkMemoryPropertyFlagBits input_value)
@@ -1656,20 +1658,15 @@ static inline const char* string_VkMemoryPropertyFlagBits(VkMemoryPropertyFlagBi
     }
 }
 
+static inline const char* string_VkMemoryPropertyFlags(VkMemoryPropertyFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkMemoryPropertyFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkMemoryPropertyFlags(VkMemoryPropertyFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkMemoryPropertyFlagBits(static_cast<VkMemoryPropertyFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkMemoryPropertyFlagBits(static_cast<VkMemoryPropertyFlagBits>(0)));
-    return ret;
+    char buffer[253];
+    return string_VkMemoryPropertyFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkMemoryHeapFlagBits(VkMemoryHeapFlagBits input_value)
@@ -1685,20 +1682,15 @@ static inline const char* string_VkMemoryHeapFlagBits(VkMemoryHeapFlagBits input
     }
 }
 
+static inline const char* string_VkMemoryHeapFlags(VkMemoryHeapFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkMemoryHeapFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkMemoryHeapFlags(VkMemoryHeapFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkMemoryHeapFlagBits(static_cast<VkMemoryHeapFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkMemoryHeapFlagBits(static_cast<VkMemoryHeapFlagBits>(0)));
-    return ret;
+    char buffer[98];
+    return string_VkMemoryHeapFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDeviceQueueCreateFlagBits(VkDeviceQueueCreateFlagBits input_value)
@@ -1712,20 +1704,15 @@ static inline const char* string_VkDeviceQueueCreateFlagBits(VkDeviceQueueCreate
     }
 }
 
+static inline const char* string_VkDeviceQueueCreateFlags(VkDeviceQueueCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDeviceQueueCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkDeviceQueueCreateFlags(VkDeviceQueueCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDeviceQueueCreateFlagBits(static_cast<VkDeviceQueueCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDeviceQueueCreateFlagBits(static_cast<VkDeviceQueueCreateFlagBits>(0)));
-    return ret;
+    char buffer[76];
+    return string_VkDeviceQueueCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPipelineStageFlagBits(VkPipelineStageFlagBits input_value)
@@ -1789,20 +1776,15 @@ static inline const char* string_VkPipelineStageFlagBits(VkPipelineStageFlagBits
     }
 }
 
+static inline const char* string_VkPipelineStageFlags(VkPipelineStageFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkPipelineStageFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkPipelineStageFlags(VkPipelineStageFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkPipelineStageFlagBits(static_cast<VkPipelineStageFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkPipelineStageFlagBits(static_cast<VkPipelineStageFlagBits>(0)));
-    return ret;
+    char buffer[1090];
+    return string_VkPipelineStageFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkImageAspectFlagBits(VkImageAspectFlagBits input_value)
@@ -1836,20 +1818,15 @@ static inline const char* string_VkImageAspectFlagBits(VkImageAspectFlagBits inp
     }
 }
 
+static inline const char* string_VkImageAspectFlags(VkImageAspectFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkImageAspectFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkImageAspectFlags(VkImageAspectFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkImageAspectFlagBits(static_cast<VkImageAspectFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkImageAspectFlagBits(static_cast<VkImageAspectFlagBits>(0)));
-    return ret;
+    char buffer[382];
+    return string_VkImageAspectFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSparseImageFormatFlagBits(VkSparseImageFormatFlagBits input_value)
@@ -1867,20 +1844,15 @@ static inline const char* string_VkSparseImageFormatFlagBits(VkSparseImageFormat
     }
 }
 
+static inline const char* string_VkSparseImageFormatFlags(VkSparseImageFormatFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSparseImageFormatFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSparseImageFormatFlags(VkSparseImageFormatFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSparseImageFormatFlagBits(static_cast<VkSparseImageFormatFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSparseImageFormatFlagBits(static_cast<VkSparseImageFormatFlagBits>(0)));
-    return ret;
+    char buffer[175];
+    return string_VkSparseImageFormatFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSparseMemoryBindFlagBits(VkSparseMemoryBindFlagBits input_value)
@@ -1894,20 +1866,15 @@ static inline const char* string_VkSparseMemoryBindFlagBits(VkSparseMemoryBindFl
     }
 }
 
+static inline const char* string_VkSparseMemoryBindFlags(VkSparseMemoryBindFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSparseMemoryBindFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSparseMemoryBindFlags(VkSparseMemoryBindFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSparseMemoryBindFlagBits(static_cast<VkSparseMemoryBindFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSparseMemoryBindFlagBits(static_cast<VkSparseMemoryBindFlagBits>(0)));
-    return ret;
+    char buffer[73];
+    return string_VkSparseMemoryBindFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkFenceCreateFlagBits(VkFenceCreateFlagBits input_value)
@@ -1921,20 +1888,15 @@ static inline const char* string_VkFenceCreateFlagBits(VkFenceCreateFlagBits inp
     }
 }
 
+static inline const char* string_VkFenceCreateFlags(VkFenceCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkFenceCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkFenceCreateFlags(VkFenceCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkFenceCreateFlagBits(static_cast<VkFenceCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkFenceCreateFlagBits(static_cast<VkFenceCreateFlagBits>(0)));
-    return ret;
+    char buffer[62];
+    return string_VkFenceCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkQueryType(VkQueryType input_value)
@@ -1989,20 +1951,15 @@ static inline const char* string_VkQueryPipelineStatisticFlagBits(VkQueryPipelin
     }
 }
 
+static inline const char* string_VkQueryPipelineStatisticFlags(VkQueryPipelineStatisticFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkQueryPipelineStatisticFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkQueryPipelineStatisticFlags(VkQueryPipelineStatisticFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkQueryPipelineStatisticFlagBits(static_cast<VkQueryPipelineStatisticFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkQueryPipelineStatisticFlagBits(static_cast<VkQueryPipelineStatisticFlagBits>(0)));
-    return ret;
+    char buffer[702];
+    return string_VkQueryPipelineStatisticFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkQueryResultFlagBits(VkQueryResultFlagBits input_value)
@@ -2022,20 +1979,15 @@ static inline const char* string_VkQueryResultFlagBits(VkQueryResultFlagBits inp
     }
 }
 
+static inline const char* string_VkQueryResultFlags(VkQueryResultFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkQueryResultFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkQueryResultFlags(VkQueryResultFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkQueryResultFlagBits(static_cast<VkQueryResultFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkQueryResultFlagBits(static_cast<VkQueryResultFlagBits>(0)));
-    return ret;
+    char buffer[147];
+    return string_VkQueryResultFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkBufferCreateFlagBits(VkBufferCreateFlagBits input_value)
@@ -2057,20 +2009,15 @@ static inline const char* string_VkBufferCreateFlagBits(VkBufferCreateFlagBits i
     }
 }
 
+static inline const char* string_VkBufferCreateFlags(VkBufferCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkBufferCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkBufferCreateFlags(VkBufferCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkBufferCreateFlagBits(static_cast<VkBufferCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkBufferCreateFlagBits(static_cast<VkBufferCreateFlagBits>(0)));
-    return ret;
+    char buffer[230];
+    return string_VkBufferCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkBufferUsageFlagBits(VkBufferUsageFlagBits input_value)
@@ -2110,20 +2057,15 @@ static inline const char* string_VkBufferUsageFlagBits(VkBufferUsageFlagBits inp
     }
 }
 
+static inline const char* string_VkBufferUsageFlags(VkBufferUsageFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkBufferUsageFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkBufferUsageFlags(VkBufferUsageFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkBufferUsageFlagBits(static_cast<VkBufferUsageFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkBufferUsageFlagBits(static_cast<VkBufferUsageFlagBits>(0)));
-    return ret;
+    char buffer[589];
+    return string_VkBufferUsageFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSharingMode(VkSharingMode input_value)
@@ -2189,20 +2131,15 @@ static inline const char* string_VkImageViewCreateFlagBits(VkImageViewCreateFlag
     }
 }
 
+static inline const char* string_VkImageViewCreateFlags(VkImageViewCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkImageViewCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkImageViewCreateFlags(VkImageViewCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkImageViewCreateFlagBits(static_cast<VkImageViewCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkImageViewCreateFlagBits(static_cast<VkImageViewCreateFlagBits>(0)));
-    return ret;
+    char buffer[95];
+    return string_VkImageViewCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkImageViewType(VkImageViewType input_value)
@@ -2272,20 +2209,15 @@ static inline const char* string_VkPipelineCreateFlagBits(VkPipelineCreateFlagBi
     }
 }
 
+static inline const char* string_VkPipelineCreateFlags(VkPipelineCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkPipelineCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkPipelineCreateFlags(VkPipelineCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkPipelineCreateFlagBits(static_cast<VkPipelineCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkPipelineCreateFlagBits(static_cast<VkPipelineCreateFlagBits>(0)));
-    return ret;
+    char buffer[280];
+    return string_VkPipelineCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkShaderStageFlagBits(VkShaderStageFlagBits input_value)
@@ -2329,20 +2261,15 @@ static inline const char* string_VkShaderStageFlagBits(VkShaderStageFlagBits inp
     }
 }
 
+static inline const char* string_VkShaderStageFlags(VkShaderStageFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkShaderStageFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkShaderStageFlags(VkShaderStageFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkShaderStageFlagBits(static_cast<VkShaderStageFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkShaderStageFlagBits(static_cast<VkShaderStageFlagBits>(0)));
-    return ret;
+    char buffer[528];
+    return string_VkShaderStageFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkVertexInputRate(VkVertexInputRate input_value)
@@ -2423,20 +2350,15 @@ static inline const char* string_VkCullModeFlagBits(VkCullModeFlagBits input_val
     }
 }
 
+static inline const char* string_VkCullModeFlags(VkCullModeFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkCullModeFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkCullModeFlags(VkCullModeFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkCullModeFlagBits(static_cast<VkCullModeFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkCullModeFlagBits(static_cast<VkCullModeFlagBits>(0)));
-    return ret;
+    char buffer[121];
+    return string_VkCullModeFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkFrontFace(VkFrontFace input_value)
@@ -2718,20 +2640,15 @@ static inline const char* string_VkColorComponentFlagBits(VkColorComponentFlagBi
     }
 }
 
+static inline const char* string_VkColorComponentFlags(VkColorComponentFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkColorComponentFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkColorComponentFlags(VkColorComponentFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkColorComponentFlagBits(static_cast<VkColorComponentFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkColorComponentFlagBits(static_cast<VkColorComponentFlagBits>(0)));
-    return ret;
+    char buffer[136];
+    return string_VkColorComponentFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDynamicState(VkDynamicState input_value)
@@ -2786,20 +2703,15 @@ static inline const char* string_VkSamplerCreateFlagBits(VkSamplerCreateFlagBits
     }
 }
 
+static inline const char* string_VkSamplerCreateFlags(VkSamplerCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSamplerCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSamplerCreateFlags(VkSamplerCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSamplerCreateFlagBits(static_cast<VkSamplerCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSamplerCreateFlagBits(static_cast<VkSamplerCreateFlagBits>(0)));
-    return ret;
+    char buffer[131];
+    return string_VkSamplerCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkFilter(VkFilter input_value)
@@ -2883,20 +2795,15 @@ static inline const char* string_VkDescriptorSetLayoutCreateFlagBits(VkDescripto
     }
 }
 
+static inline const char* string_VkDescriptorSetLayoutCreateFlags(VkDescriptorSetLayoutCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDescriptorSetLayoutCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkDescriptorSetLayoutCreateFlags(VkDescriptorSetLayoutCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDescriptorSetLayoutCreateFlagBits(static_cast<VkDescriptorSetLayoutCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDescriptorSetLayoutCreateFlagBits(static_cast<VkDescriptorSetLayoutCreateFlagBits>(0)));
-    return ret;
+    char buffer[166];
+    return string_VkDescriptorSetLayoutCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDescriptorType(VkDescriptorType input_value)
@@ -2947,20 +2854,15 @@ static inline const char* string_VkDescriptorPoolCreateFlagBits(VkDescriptorPool
     }
 }
 
+static inline const char* string_VkDescriptorPoolCreateFlags(VkDescriptorPoolCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDescriptorPoolCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkDescriptorPoolCreateFlags(VkDescriptorPoolCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDescriptorPoolCreateFlagBits(static_cast<VkDescriptorPoolCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDescriptorPoolCreateFlagBits(static_cast<VkDescriptorPoolCreateFlagBits>(0)));
-    return ret;
+    char buffer[144];
+    return string_VkDescriptorPoolCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkFramebufferCreateFlagBits(VkFramebufferCreateFlagBits input_value)
@@ -2974,20 +2876,15 @@ static inline const char* string_VkFramebufferCreateFlagBits(VkFramebufferCreate
     }
 }
 
+static inline const char* string_VkFramebufferCreateFlags(VkFramebufferCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkFramebufferCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkFramebufferCreateFlags(VkFramebufferCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkFramebufferCreateFlagBits(static_cast<VkFramebufferCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkFramebufferCreateFlagBits(static_cast<VkFramebufferCreateFlagBits>(0)));
-    return ret;
+    char buffer[79];
+    return string_VkFramebufferCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkAttachmentDescriptionFlagBits(VkAttachmentDescriptionFlagBits input_value)
@@ -3001,20 +2898,15 @@ static inline const char* string_VkAttachmentDescriptionFlagBits(VkAttachmentDes
     }
 }
 
+static inline const char* string_VkAttachmentDescriptionFlags(VkAttachmentDescriptionFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkAttachmentDescriptionFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkAttachmentDescriptionFlags(VkAttachmentDescriptionFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkAttachmentDescriptionFlagBits(static_cast<VkAttachmentDescriptionFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkAttachmentDescriptionFlagBits(static_cast<VkAttachmentDescriptionFlagBits>(0)));
-    return ret;
+    char buffer[83];
+    return string_VkAttachmentDescriptionFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkAttachmentLoadOp(VkAttachmentLoadOp input_value)
@@ -3058,20 +2950,15 @@ static inline const char* string_VkSubpassDescriptionFlagBits(VkSubpassDescripti
     }
 }
 
+static inline const char* string_VkSubpassDescriptionFlags(VkSubpassDescriptionFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSubpassDescriptionFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSubpassDescriptionFlags(VkSubpassDescriptionFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSubpassDescriptionFlagBits(static_cast<VkSubpassDescriptionFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSubpassDescriptionFlagBits(static_cast<VkSubpassDescriptionFlagBits>(0)));
-    return ret;
+    char buffer[147];
+    return string_VkSubpassDescriptionFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPipelineBindPoint(VkPipelineBindPoint input_value)
@@ -3154,20 +3041,15 @@ static inline const char* string_VkAccessFlagBits(VkAccessFlagBits input_value)
     }
 }
 
+static inline const char* string_VkAccessFlags(VkAccessFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkAccessFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkAccessFlags(VkAccessFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkAccessFlagBits(static_cast<VkAccessFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkAccessFlagBits(static_cast<VkAccessFlagBits>(0)));
-    return ret;
+    char buffer[1058];
+    return string_VkAccessFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDependencyFlagBits(VkDependencyFlagBits input_value)
@@ -3185,20 +3067,15 @@ static inline const char* string_VkDependencyFlagBits(VkDependencyFlagBits input
     }
 }
 
+static inline const char* string_VkDependencyFlags(VkDependencyFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDependencyFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkDependencyFlags(VkDependencyFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDependencyFlagBits(static_cast<VkDependencyFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDependencyFlagBits(static_cast<VkDependencyFlagBits>(0)));
-    return ret;
+    char buffer[120];
+    return string_VkDependencyFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkCommandPoolCreateFlagBits(VkCommandPoolCreateFlagBits input_value)
@@ -3216,20 +3093,15 @@ static inline const char* string_VkCommandPoolCreateFlagBits(VkCommandPoolCreate
     }
 }
 
+static inline const char* string_VkCommandPoolCreateFlags(VkCommandPoolCreateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkCommandPoolCreateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkCommandPoolCreateFlags(VkCommandPoolCreateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkCommandPoolCreateFlagBits(static_cast<VkCommandPoolCreateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkCommandPoolCreateFlagBits(static_cast<VkCommandPoolCreateFlagBits>(0)));
-    return ret;
+    char buffer[161];
+    return string_VkCommandPoolCreateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkCommandPoolResetFlagBits(VkCommandPoolResetFlagBits input_value)
@@ -3243,20 +3115,15 @@ static inline const char* string_VkCommandPoolResetFlagBits(VkCommandPoolResetFl
     }
 }
 
+static inline const char* string_VkCommandPoolResetFlags(VkCommandPoolResetFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkCommandPoolResetFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkCommandPoolResetFlags(VkCommandPoolResetFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkCommandPoolResetFlagBits(static_cast<VkCommandPoolResetFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkCommandPoolResetFlagBits(static_cast<VkCommandPoolResetFlagBits>(0)));
-    return ret;
+    char buffer[82];
+    return string_VkCommandPoolResetFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkCommandBufferLevel(VkCommandBufferLevel input_value)
@@ -3287,20 +3154,15 @@ static inline const char* string_VkCommandBufferUsageFlagBits(VkCommandBufferUsa
     }
 }
 
+static inline const char* string_VkCommandBufferUsageFlags(VkCommandBufferUsageFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkCommandBufferUsageFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkCommandBufferUsageFlags(VkCommandBufferUsageFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkCommandBufferUsageFlagBits(static_cast<VkCommandBufferUsageFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkCommandBufferUsageFlagBits(static_cast<VkCommandBufferUsageFlagBits>(0)));
-    return ret;
+    char buffer[178];
+    return string_VkCommandBufferUsageFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkQueryControlFlagBits(VkQueryControlFlagBits input_value)
@@ -3314,20 +3176,15 @@ static inline const char* string_VkQueryControlFlagBits(VkQueryControlFlagBits i
     }
 }
 
+static inline const char* string_VkQueryControlFlags(VkQueryControlFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkQueryControlFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkQueryControlFlags(VkQueryControlFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkQueryControlFlagBits(static_cast<VkQueryControlFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkQueryControlFlagBits(static_cast<VkQueryControlFlagBits>(0)));
-    return ret;
+    char buffer[63];
+    return string_VkQueryControlFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkCommandBufferResetFlagBits(VkCommandBufferResetFlagBits input_value)
@@ -3341,20 +3198,15 @@ static inline const char* string_VkCommandBufferResetFlagBits(VkCommandBufferRes
     }
 }
 
+static inline const char* string_VkCommandBufferResetFlags(VkCommandBufferResetFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkCommandBufferResetFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkCommandBufferResetFlags(VkCommandBufferResetFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkCommandBufferResetFlagBits(static_cast<VkCommandBufferResetFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkCommandBufferResetFlagBits(static_cast<VkCommandBufferResetFlagBits>(0)));
-    return ret;
+    char buffer[86];
+    return string_VkCommandBufferResetFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkStencilFaceFlagBits(VkStencilFaceFlagBits input_value)
@@ -3372,20 +3224,15 @@ static inline const char* string_VkStencilFaceFlagBits(VkStencilFaceFlagBits inp
     }
 }
 
+static inline const char* string_VkStencilFaceFlags(VkStencilFaceFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkStencilFaceFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkStencilFaceFlags(VkStencilFaceFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkStencilFaceFlagBits(static_cast<VkStencilFaceFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkStencilFaceFlagBits(static_cast<VkStencilFaceFlagBits>(0)));
-    return ret;
+    char buffer[110];
+    return string_VkStencilFaceFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkIndexType(VkIndexType input_value)
@@ -3545,20 +3392,15 @@ static inline const char* string_VkSubgroupFeatureFlagBits(VkSubgroupFeatureFlag
     }
 }
 
+static inline const char* string_VkSubgroupFeatureFlags(VkSubgroupFeatureFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSubgroupFeatureFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSubgroupFeatureFlags(VkSubgroupFeatureFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSubgroupFeatureFlagBits(static_cast<VkSubgroupFeatureFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSubgroupFeatureFlagBits(static_cast<VkSubgroupFeatureFlagBits>(0)));
-    return ret;
+    char buffer[337];
+    return string_VkSubgroupFeatureFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPeerMemoryFeatureFlagBits(VkPeerMemoryFeatureFlagBits input_value)
@@ -3578,20 +3420,15 @@ static inline const char* string_VkPeerMemoryFeatureFlagBits(VkPeerMemoryFeature
     }
 }
 
+static inline const char* string_VkPeerMemoryFeatureFlags(VkPeerMemoryFeatureFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkPeerMemoryFeatureFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkPeerMemoryFeatureFlags(VkPeerMemoryFeatureFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkPeerMemoryFeatureFlagBits(static_cast<VkPeerMemoryFeatureFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkPeerMemoryFeatureFlagBits(static_cast<VkPeerMemoryFeatureFlagBits>(0)));
-    return ret;
+    char buffer[189];
+    return string_VkPeerMemoryFeatureFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkMemoryAllocateFlagBits(VkMemoryAllocateFlagBits input_value)
@@ -3605,20 +3442,15 @@ static inline const char* string_VkMemoryAllocateFlagBits(VkMemoryAllocateFlagBi
     }
 }
 
+static inline const char* string_VkMemoryAllocateFlags(VkMemoryAllocateFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkMemoryAllocateFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkMemoryAllocateFlags(VkMemoryAllocateFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkMemoryAllocateFlagBits(static_cast<VkMemoryAllocateFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkMemoryAllocateFlagBits(static_cast<VkMemoryAllocateFlagBits>(0)));
-    return ret;
+    char buffer[71];
+    return string_VkMemoryAllocateFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPointClippingBehavior(VkPointClippingBehavior input_value)
@@ -3736,20 +3568,15 @@ static inline const char* string_VkExternalMemoryHandleTypeFlagBits(VkExternalMe
     }
 }
 
+static inline const char* string_VkExternalMemoryHandleTypeFlags(VkExternalMemoryHandleTypeFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalMemoryHandleTypeFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalMemoryHandleTypeFlags(VkExternalMemoryHandleTypeFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalMemoryHandleTypeFlagBits(static_cast<VkExternalMemoryHandleTypeFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalMemoryHandleTypeFlagBits(static_cast<VkExternalMemoryHandleTypeFlagBits>(0)));
-    return ret;
+    char buffer[624];
+    return string_VkExternalMemoryHandleTypeFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalMemoryFeatureFlagBits(VkExternalMemoryFeatureFlagBits input_value)
@@ -3767,20 +3594,15 @@ static inline const char* string_VkExternalMemoryFeatureFlagBits(VkExternalMemor
     }
 }
 
+static inline const char* string_VkExternalMemoryFeatureFlags(VkExternalMemoryFeatureFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalMemoryFeatureFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalMemoryFeatureFlags(VkExternalMemoryFeatureFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalMemoryFeatureFlagBits(static_cast<VkExternalMemoryFeatureFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalMemoryFeatureFlagBits(static_cast<VkExternalMemoryFeatureFlagBits>(0)));
-    return ret;
+    char buffer[173];
+    return string_VkExternalMemoryFeatureFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalFenceHandleTypeFlagBits(VkExternalFenceHandleTypeFlagBits input_value)
@@ -3800,20 +3622,15 @@ static inline const char* string_VkExternalFenceHandleTypeFlagBits(VkExternalFen
     }
 }
 
+static inline const char* string_VkExternalFenceHandleTypeFlags(VkExternalFenceHandleTypeFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalFenceHandleTypeFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalFenceHandleTypeFlags(VkExternalFenceHandleTypeFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalFenceHandleTypeFlagBits(static_cast<VkExternalFenceHandleTypeFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalFenceHandleTypeFlagBits(static_cast<VkExternalFenceHandleTypeFlagBits>(0)));
-    return ret;
+    char buffer[229];
+    return string_VkExternalFenceHandleTypeFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalFenceFeatureFlagBits(VkExternalFenceFeatureFlagBits input_value)
@@ -3829,20 +3646,15 @@ static inline const char* string_VkExternalFenceFeatureFlagBits(VkExternalFenceF
     }
 }
 
+static inline const char* string_VkExternalFenceFeatureFlags(VkExternalFenceFeatureFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalFenceFeatureFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalFenceFeatureFlags(VkExternalFenceFeatureFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalFenceFeatureFlagBits(static_cast<VkExternalFenceFeatureFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalFenceFeatureFlagBits(static_cast<VkExternalFenceFeatureFlagBits>(0)));
-    return ret;
+    char buffer[124];
+    return string_VkExternalFenceFeatureFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkFenceImportFlagBits(VkFenceImportFlagBits input_value)
@@ -3856,20 +3668,15 @@ static inline const char* string_VkFenceImportFlagBits(VkFenceImportFlagBits inp
     }
 }
 
+static inline const char* string_VkFenceImportFlags(VkFenceImportFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkFenceImportFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkFenceImportFlags(VkFenceImportFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkFenceImportFlagBits(static_cast<VkFenceImportFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkFenceImportFlagBits(static_cast<VkFenceImportFlagBits>(0)));
-    return ret;
+    char buffer[63];
+    return string_VkFenceImportFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSemaphoreImportFlagBits(VkSemaphoreImportFlagBits input_value)
@@ -3883,20 +3690,15 @@ static inline const char* string_VkSemaphoreImportFlagBits(VkSemaphoreImportFlag
     }
 }
 
+static inline const char* string_VkSemaphoreImportFlags(VkSemaphoreImportFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSemaphoreImportFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkSemaphoreImportFlags(VkSemaphoreImportFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSemaphoreImportFlagBits(static_cast<VkSemaphoreImportFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSemaphoreImportFlagBits(static_cast<VkSemaphoreImportFlagBits>(0)));
-    return ret;
+    char buffer[71];
+    return string_VkSemaphoreImportFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalSemaphoreHandleTypeFlagBits(VkExternalSemaphoreHandleTypeFlagBits input_value)
@@ -3918,20 +3720,15 @@ static inline const char* string_VkExternalSemaphoreHandleTypeFlagBits(VkExterna
     }
 }
 
+static inline const char* string_VkExternalSemaphoreHandleTypeFlags(VkExternalSemaphoreHandleTypeFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalSemaphoreHandleTypeFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalSemaphoreHandleTypeFlags(VkExternalSemaphoreHandleTypeFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalSemaphoreHandleTypeFlagBits(static_cast<VkExternalSemaphoreHandleTypeFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalSemaphoreHandleTypeFlagBits(static_cast<VkExternalSemaphoreHandleTypeFlagBits>(0)));
-    return ret;
+    char buffer[299];
+    return string_VkExternalSemaphoreHandleTypeFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalSemaphoreFeatureFlagBits(VkExternalSemaphoreFeatureFlagBits input_value)
@@ -3947,20 +3744,15 @@ static inline const char* string_VkExternalSemaphoreFeatureFlagBits(VkExternalSe
     }
 }
 
+static inline const char* string_VkExternalSemaphoreFeatureFlags(VkExternalSemaphoreFeatureFlags input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalSemaphoreFeatureFlagBits, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalSemaphoreFeatureFlags(VkExternalSemaphoreFeatureFlags input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalSemaphoreFeatureFlagBits(static_cast<VkExternalSemaphoreFeatureFlagBits>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalSemaphoreFeatureFlagBits(static_cast<VkExternalSemaphoreFeatureFlagBits>(0)));
-    return ret;
+    char buffer[136];
+    return string_VkExternalSemaphoreFeatureFlags(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSurfaceTransformFlagBitsKHR(VkSurfaceTransformFlagBitsKHR input_value)
@@ -3990,20 +3782,15 @@ static inline const char* string_VkSurfaceTransformFlagBitsKHR(VkSurfaceTransfor
     }
 }
 
+static inline const char* string_VkSurfaceTransformFlagsKHR(VkSurfaceTransformFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSurfaceTransformFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkSurfaceTransformFlagsKHR(VkSurfaceTransformFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSurfaceTransformFlagBitsKHR(static_cast<VkSurfaceTransformFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSurfaceTransformFlagBitsKHR(static_cast<VkSurfaceTransformFlagBitsKHR>(0)));
-    return ret;
+    char buffer[455];
+    return string_VkSurfaceTransformFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkCompositeAlphaFlagBitsKHR(VkCompositeAlphaFlagBitsKHR input_value)
@@ -4023,20 +3810,15 @@ static inline const char* string_VkCompositeAlphaFlagBitsKHR(VkCompositeAlphaFla
     }
 }
 
+static inline const char* string_VkCompositeAlphaFlagsKHR(VkCompositeAlphaFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkCompositeAlphaFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkCompositeAlphaFlagsKHR(VkCompositeAlphaFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkCompositeAlphaFlagBitsKHR(static_cast<VkCompositeAlphaFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkCompositeAlphaFlagBitsKHR(static_cast<VkCompositeAlphaFlagBitsKHR>(0)));
-    return ret;
+    char buffer[193];
+    return string_VkCompositeAlphaFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkColorSpaceKHR(VkColorSpaceKHR input_value)
@@ -4116,20 +3898,15 @@ static inline const char* string_VkSwapchainCreateFlagBitsKHR(VkSwapchainCreateF
     }
 }
 
+static inline const char* string_VkSwapchainCreateFlagsKHR(VkSwapchainCreateFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSwapchainCreateFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkSwapchainCreateFlagsKHR(VkSwapchainCreateFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSwapchainCreateFlagBitsKHR(static_cast<VkSwapchainCreateFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSwapchainCreateFlagBitsKHR(static_cast<VkSwapchainCreateFlagBitsKHR>(0)));
-    return ret;
+    char buffer[177];
+    return string_VkSwapchainCreateFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDeviceGroupPresentModeFlagBitsKHR(VkDeviceGroupPresentModeFlagBitsKHR input_value)
@@ -4149,20 +3926,15 @@ static inline const char* string_VkDeviceGroupPresentModeFlagBitsKHR(VkDeviceGro
     }
 }
 
+static inline const char* string_VkDeviceGroupPresentModeFlagsKHR(VkDeviceGroupPresentModeFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDeviceGroupPresentModeFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkDeviceGroupPresentModeFlagsKHR(VkDeviceGroupPresentModeFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDeviceGroupPresentModeFlagBitsKHR(static_cast<VkDeviceGroupPresentModeFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDeviceGroupPresentModeFlagBitsKHR(static_cast<VkDeviceGroupPresentModeFlagBitsKHR>(0)));
-    return ret;
+    char buffer[231];
+    return string_VkDeviceGroupPresentModeFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDisplayPlaneAlphaFlagBitsKHR(VkDisplayPlaneAlphaFlagBitsKHR input_value)
@@ -4181,21 +3953,16 @@ static inline const char* string_VkDisplayPlaneAlphaFlagBitsKHR(VkDisplayPlaneAl
             return "Unhandled VkDisplayPlaneAlphaFlagBitsKHR";
     }
 }
-
-static inline std::string string_VkDisplayPlaneAlphaFlagsKHR(VkDisplayPlaneAlphaFlagsKHR input_value)
-{
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDisplayPlaneAlphaFlagBitsKHR(static_cast<VkDisplayPlaneAlphaFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDisplayPlaneAlphaFlagBitsKHR(static_cast<VkDisplayPlaneAlphaFlagBitsKHR>(0)));
-    return ret;
+
+static inline const char* string_VkDisplayPlaneAlphaFlagsKHR(VkDisplayPlaneAlphaFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDisplayPlaneAlphaFlagBitsKHR, buffer, buffer_size);
+}
+
+static inline std::string string_VkDisplayPlaneAlphaFlagsKHR(VkDisplayPlaneAlphaFlagsKHR input_value)
+{
+    char buffer[214];
+    return string_VkDisplayPlaneAlphaFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPeerMemoryFeatureFlagBitsKHR(VkPeerMemoryFeatureFlagBitsKHR input_value)
@@ -4215,20 +3982,15 @@ static inline const char* string_VkPeerMemoryFeatureFlagBitsKHR(VkPeerMemoryFeat
     }
 }
 
+static inline const char* string_VkPeerMemoryFeatureFlagsKHR(VkPeerMemoryFeatureFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkPeerMemoryFeatureFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkPeerMemoryFeatureFlagsKHR(VkPeerMemoryFeatureFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkPeerMemoryFeatureFlagBitsKHR(static_cast<VkPeerMemoryFeatureFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkPeerMemoryFeatureFlagBitsKHR(static_cast<VkPeerMemoryFeatureFlagBitsKHR>(0)));
-    return ret;
+    char buffer[192];
+    return string_VkPeerMemoryFeatureFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkMemoryAllocateFlagBitsKHR(VkMemoryAllocateFlagBitsKHR input_value)
@@ -4242,20 +4004,15 @@ static inline const char* string_VkMemoryAllocateFlagBitsKHR(VkMemoryAllocateFla
     }
 }
 
+static inline const char* string_VkMemoryAllocateFlagsKHR(VkMemoryAllocateFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkMemoryAllocateFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkMemoryAllocateFlagsKHR(VkMemoryAllocateFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkMemoryAllocateFlagBitsKHR(static_cast<VkMemoryAllocateFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkMemoryAllocateFlagBitsKHR(static_cast<VkMemoryAllocateFlagBitsKHR>(0)));
-    return ret;
+    char buffer[74];
+    return string_VkMemoryAllocateFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalMemoryHandleTypeFlagBitsKHR(VkExternalMemoryHandleTypeFlagBitsKHR input_value)
@@ -4289,20 +4046,15 @@ static inline const char* string_VkExternalMemoryHandleTypeFlagBitsKHR(VkExterna
     }
 }
 
+static inline const char* string_VkExternalMemoryHandleTypeFlagsKHR(VkExternalMemoryHandleTypeFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalMemoryHandleTypeFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalMemoryHandleTypeFlagsKHR(VkExternalMemoryHandleTypeFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalMemoryHandleTypeFlagBitsKHR(static_cast<VkExternalMemoryHandleTypeFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalMemoryHandleTypeFlagBitsKHR(static_cast<VkExternalMemoryHandleTypeFlagBitsKHR>(0)));
-    return ret;
+    char buffer[627];
+    return string_VkExternalMemoryHandleTypeFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalMemoryFeatureFlagBitsKHR(VkExternalMemoryFeatureFlagBitsKHR input_value)
@@ -4320,20 +4072,15 @@ static inline const char* string_VkExternalMemoryFeatureFlagBitsKHR(VkExternalMe
     }
 }
 
+static inline const char* string_VkExternalMemoryFeatureFlagsKHR(VkExternalMemoryFeatureFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalMemoryFeatureFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalMemoryFeatureFlagsKHR(VkExternalMemoryFeatureFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalMemoryFeatureFlagBitsKHR(static_cast<VkExternalMemoryFeatureFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalMemoryFeatureFlagBitsKHR(static_cast<VkExternalMemoryFeatureFlagBitsKHR>(0)));
-    return ret;
+    char buffer[176];
+    return string_VkExternalMemoryFeatureFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalSemaphoreHandleTypeFlagBitsKHR(VkExternalSemaphoreHandleTypeFlagBitsKHR input_value)
@@ -4355,20 +4102,15 @@ static inline const char* string_VkExternalSemaphoreHandleTypeFlagBitsKHR(VkExte
     }
 }
 
+static inline const char* string_VkExternalSemaphoreHandleTypeFlagsKHR(VkExternalSemaphoreHandleTypeFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalSemaphoreHandleTypeFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalSemaphoreHandleTypeFlagsKHR(VkExternalSemaphoreHandleTypeFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalSemaphoreHandleTypeFlagBitsKHR(static_cast<VkExternalSemaphoreHandleTypeFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalSemaphoreHandleTypeFlagBitsKHR(static_cast<VkExternalSemaphoreHandleTypeFlagBitsKHR>(0)));
-    return ret;
+    char buffer[302];
+    return string_VkExternalSemaphoreHandleTypeFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalSemaphoreFeatureFlagBitsKHR(VkExternalSemaphoreFeatureFlagBitsKHR input_value)
@@ -4384,20 +4126,15 @@ static inline const char* string_VkExternalSemaphoreFeatureFlagBitsKHR(VkExterna
     }
 }
 
+static inline const char* string_VkExternalSemaphoreFeatureFlagsKHR(VkExternalSemaphoreFeatureFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalSemaphoreFeatureFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalSemaphoreFeatureFlagsKHR(VkExternalSemaphoreFeatureFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalSemaphoreFeatureFlagBitsKHR(static_cast<VkExternalSemaphoreFeatureFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalSemaphoreFeatureFlagBitsKHR(static_cast<VkExternalSemaphoreFeatureFlagBitsKHR>(0)));
-    return ret;
+    char buffer[139];
+    return string_VkExternalSemaphoreFeatureFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSemaphoreImportFlagBitsKHR(VkSemaphoreImportFlagBitsKHR input_value)
@@ -4411,20 +4148,15 @@ static inline const char* string_VkSemaphoreImportFlagBitsKHR(VkSemaphoreImportF
     }
 }
 
+static inline const char* string_VkSemaphoreImportFlagsKHR(VkSemaphoreImportFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSemaphoreImportFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkSemaphoreImportFlagsKHR(VkSemaphoreImportFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSemaphoreImportFlagBitsKHR(static_cast<VkSemaphoreImportFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSemaphoreImportFlagBitsKHR(static_cast<VkSemaphoreImportFlagBitsKHR>(0)));
-    return ret;
+    char buffer[74];
+    return string_VkSemaphoreImportFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDescriptorUpdateTemplateTypeKHR(VkDescriptorUpdateTemplateTypeKHR input_value)
@@ -4457,20 +4189,15 @@ static inline const char* string_VkExternalFenceHandleTypeFlagBitsKHR(VkExternal
     }
 }
 
+static inline const char* string_VkExternalFenceHandleTypeFlagsKHR(VkExternalFenceHandleTypeFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalFenceHandleTypeFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalFenceHandleTypeFlagsKHR(VkExternalFenceHandleTypeFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalFenceHandleTypeFlagBitsKHR(static_cast<VkExternalFenceHandleTypeFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalFenceHandleTypeFlagBitsKHR(static_cast<VkExternalFenceHandleTypeFlagBitsKHR>(0)));
-    return ret;
+    char buffer[232];
+    return string_VkExternalFenceHandleTypeFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalFenceFeatureFlagBitsKHR(VkExternalFenceFeatureFlagBitsKHR input_value)
@@ -4486,20 +4213,15 @@ static inline const char* string_VkExternalFenceFeatureFlagBitsKHR(VkExternalFen
     }
 }
 
+static inline const char* string_VkExternalFenceFeatureFlagsKHR(VkExternalFenceFeatureFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalFenceFeatureFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalFenceFeatureFlagsKHR(VkExternalFenceFeatureFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalFenceFeatureFlagBitsKHR(static_cast<VkExternalFenceFeatureFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalFenceFeatureFlagBitsKHR(static_cast<VkExternalFenceFeatureFlagBitsKHR>(0)));
-    return ret;
+    char buffer[127];
+    return string_VkExternalFenceFeatureFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkFenceImportFlagBitsKHR(VkFenceImportFlagBitsKHR input_value)
@@ -4513,20 +4235,15 @@ static inline const char* string_VkFenceImportFlagBitsKHR(VkFenceImportFlagBitsK
     }
 }
 
+static inline const char* string_VkFenceImportFlagsKHR(VkFenceImportFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkFenceImportFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkFenceImportFlagsKHR(VkFenceImportFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkFenceImportFlagBitsKHR(static_cast<VkFenceImportFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkFenceImportFlagBitsKHR(static_cast<VkFenceImportFlagBitsKHR>(0)));
-    return ret;
+    char buffer[66];
+    return string_VkFenceImportFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPointClippingBehaviorKHR(VkPointClippingBehaviorKHR input_value)
@@ -4652,20 +4369,15 @@ static inline const char* string_VkResolveModeFlagBitsKHR(VkResolveModeFlagBitsK
     }
 }
 
+static inline const char* string_VkResolveModeFlagsKHR(VkResolveModeFlagsKHR input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkResolveModeFlagBitsKHR, buffer, buffer_size);
+}
+
 static inline std::string string_VkResolveModeFlagsKHR(VkResolveModeFlagsKHR input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkResolveModeFlagBitsKHR(static_cast<VkResolveModeFlagBitsKHR>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkResolveModeFlagBitsKHR(static_cast<VkResolveModeFlagBitsKHR>(0)));
-    return ret;
+    char buffer[185];
+    return string_VkResolveModeFlagsKHR(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDebugReportObjectTypeEXT(VkDebugReportObjectTypeEXT input_value)
@@ -4770,20 +4482,15 @@ static inline const char* string_VkDebugReportFlagBitsEXT(VkDebugReportFlagBitsE
     }
 }
 
+static inline const char* string_VkDebugReportFlagsEXT(VkDebugReportFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDebugReportFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkDebugReportFlagsEXT(VkDebugReportFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDebugReportFlagBitsEXT(static_cast<VkDebugReportFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDebugReportFlagBitsEXT(static_cast<VkDebugReportFlagBitsEXT>(0)));
-    return ret;
+    char buffer[208];
+    return string_VkDebugReportFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkRasterizationOrderAMD(VkRasterizationOrderAMD input_value)
@@ -4831,20 +4538,15 @@ static inline const char* string_VkExternalMemoryHandleTypeFlagBitsNV(VkExternal
     }
 }
 
+static inline const char* string_VkExternalMemoryHandleTypeFlagsNV(VkExternalMemoryHandleTypeFlagsNV input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalMemoryHandleTypeFlagBitsNV, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalMemoryHandleTypeFlagsNV(VkExternalMemoryHandleTypeFlagsNV input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalMemoryHandleTypeFlagBitsNV(static_cast<VkExternalMemoryHandleTypeFlagBitsNV>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalMemoryHandleTypeFlagBitsNV(static_cast<VkExternalMemoryHandleTypeFlagBitsNV>(0)));
-    return ret;
+    char buffer[258];
+    return string_VkExternalMemoryHandleTypeFlagsNV(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkExternalMemoryFeatureFlagBitsNV(VkExternalMemoryFeatureFlagBitsNV input_value)
@@ -4862,20 +4564,15 @@ static inline const char* string_VkExternalMemoryFeatureFlagBitsNV(VkExternalMem
     }
 }
 
+static inline const char* string_VkExternalMemoryFeatureFlagsNV(VkExternalMemoryFeatureFlagsNV input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkExternalMemoryFeatureFlagBitsNV, buffer, buffer_size);
+}
+
 static inline std::string string_VkExternalMemoryFeatureFlagsNV(VkExternalMemoryFeatureFlagsNV input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkExternalMemoryFeatureFlagBitsNV(static_cast<VkExternalMemoryFeatureFlagBitsNV>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkExternalMemoryFeatureFlagBitsNV(static_cast<VkExternalMemoryFeatureFlagBitsNV>(0)));
-    return ret;
+    char buffer[184];
+    return string_VkExternalMemoryFeatureFlagsNV(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkValidationCheckEXT(VkValidationCheckEXT input_value)
@@ -4902,20 +4599,15 @@ static inline const char* string_VkConditionalRenderingFlagBitsEXT(VkConditional
     }
 }
 
+static inline const char* string_VkConditionalRenderingFlagsEXT(VkConditionalRenderingFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkConditionalRenderingFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkConditionalRenderingFlagsEXT(VkConditionalRenderingFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkConditionalRenderingFlagBitsEXT(static_cast<VkConditionalRenderingFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkConditionalRenderingFlagBitsEXT(static_cast<VkConditionalRenderingFlagBitsEXT>(0)));
-    return ret;
+    char buffer[87];
+    return string_VkConditionalRenderingFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkIndirectCommandsLayoutUsageFlagBitsNVX(VkIndirectCommandsLayoutUsageFlagBitsNVX input_value)
@@ -4935,20 +4627,15 @@ static inline const char* string_VkIndirectCommandsLayoutUsageFlagBitsNVX(VkIndi
     }
 }
 
+static inline const char* string_VkIndirectCommandsLayoutUsageFlagsNVX(VkIndirectCommandsLayoutUsageFlagsNVX input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkIndirectCommandsLayoutUsageFlagBitsNVX, buffer, buffer_size);
+}
+
 static inline std::string string_VkIndirectCommandsLayoutUsageFlagsNVX(VkIndirectCommandsLayoutUsageFlagsNVX input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkIndirectCommandsLayoutUsageFlagBitsNVX(static_cast<VkIndirectCommandsLayoutUsageFlagBitsNVX>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkIndirectCommandsLayoutUsageFlagBitsNVX(static_cast<VkIndirectCommandsLayoutUsageFlagBitsNVX>(0)));
-    return ret;
+    char buffer[292];
+    return string_VkIndirectCommandsLayoutUsageFlagsNVX(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkObjectEntryUsageFlagBitsNVX(VkObjectEntryUsageFlagBitsNVX input_value)
@@ -4964,20 +4651,15 @@ static inline const char* string_VkObjectEntryUsageFlagBitsNVX(VkObjectEntryUsag
     }
 }
 
+static inline const char* string_VkObjectEntryUsageFlagsNVX(VkObjectEntryUsageFlagsNVX input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkObjectEntryUsageFlagBitsNVX, buffer, buffer_size);
+}
+
 static inline std::string string_VkObjectEntryUsageFlagsNVX(VkObjectEntryUsageFlagsNVX input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkObjectEntryUsageFlagBitsNVX(static_cast<VkObjectEntryUsageFlagBitsNVX>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkObjectEntryUsageFlagBitsNVX(static_cast<VkObjectEntryUsageFlagBitsNVX>(0)));
-    return ret;
+    char buffer[118];
+    return string_VkObjectEntryUsageFlagsNVX(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkIndirectCommandsTokenTypeNVX(VkIndirectCommandsTokenTypeNVX input_value)
@@ -5035,20 +4717,15 @@ static inline const char* string_VkSurfaceCounterFlagBitsEXT(VkSurfaceCounterFla
     }
 }
 
+static inline const char* string_VkSurfaceCounterFlagsEXT(VkSurfaceCounterFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkSurfaceCounterFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkSurfaceCounterFlagsEXT(VkSurfaceCounterFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkSurfaceCounterFlagBitsEXT(static_cast<VkSurfaceCounterFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkSurfaceCounterFlagBitsEXT(static_cast<VkSurfaceCounterFlagBitsEXT>(0)));
-    return ret;
+    char buffer[69];
+    return string_VkSurfaceCounterFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDisplayPowerStateEXT(VkDisplayPowerStateEXT input_value)
@@ -5158,20 +4835,15 @@ static inline const char* string_VkDebugUtilsMessageSeverityFlagBitsEXT(VkDebugU
     }
 }
 
+static inline const char* string_VkDebugUtilsMessageSeverityFlagsEXT(VkDebugUtilsMessageSeverityFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDebugUtilsMessageSeverityFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkDebugUtilsMessageSeverityFlagsEXT(VkDebugUtilsMessageSeverityFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDebugUtilsMessageSeverityFlagBitsEXT(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDebugUtilsMessageSeverityFlagBitsEXT(static_cast<VkDebugUtilsMessageSeverityFlagBitsEXT>(0)));
-    return ret;
+    char buffer[237];
+    return string_VkDebugUtilsMessageSeverityFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkDebugUtilsMessageTypeFlagBitsEXT(VkDebugUtilsMessageTypeFlagBitsEXT input_value)
@@ -5189,20 +4861,15 @@ static inline const char* string_VkDebugUtilsMessageTypeFlagBitsEXT(VkDebugUtils
     }
 }
 
+static inline const char* string_VkDebugUtilsMessageTypeFlagsEXT(VkDebugUtilsMessageTypeFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDebugUtilsMessageTypeFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkDebugUtilsMessageTypeFlagsEXT(VkDebugUtilsMessageTypeFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDebugUtilsMessageTypeFlagBitsEXT(static_cast<VkDebugUtilsMessageTypeFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDebugUtilsMessageTypeFlagBitsEXT(static_cast<VkDebugUtilsMessageTypeFlagBitsEXT>(0)));
-    return ret;
+    char buffer[185];
+    return string_VkDebugUtilsMessageTypeFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkSamplerReductionModeEXT(VkSamplerReductionModeEXT input_value)
@@ -5280,20 +4947,15 @@ static inline const char* string_VkDescriptorBindingFlagBitsEXT(VkDescriptorBind
     }
 }
 
+static inline const char* string_VkDescriptorBindingFlagsEXT(VkDescriptorBindingFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkDescriptorBindingFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkDescriptorBindingFlagsEXT(VkDescriptorBindingFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkDescriptorBindingFlagBitsEXT(static_cast<VkDescriptorBindingFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkDescriptorBindingFlagBitsEXT(static_cast<VkDescriptorBindingFlagBitsEXT>(0)));
-    return ret;
+    char buffer[250];
+    return string_VkDescriptorBindingFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkShadingRatePaletteEntryNV(VkShadingRatePaletteEntryNV input_value)
@@ -5387,20 +5049,15 @@ static inline const char* string_VkGeometryFlagBitsNV(VkGeometryFlagBitsNV input
     }
 }
 
+static inline const char* string_VkGeometryFlagsNV(VkGeometryFlagsNV input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkGeometryFlagBitsNV, buffer, buffer_size);
+}
+
 static inline std::string string_VkGeometryFlagsNV(VkGeometryFlagsNV input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkGeometryFlagBitsNV(static_cast<VkGeometryFlagBitsNV>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkGeometryFlagBitsNV(static_cast<VkGeometryFlagBitsNV>(0)));
-    return ret;
+    char buffer[109];
+    return string_VkGeometryFlagsNV(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkGeometryInstanceFlagBitsNV(VkGeometryInstanceFlagBitsNV input_value)
@@ -5420,20 +5077,15 @@ static inline const char* string_VkGeometryInstanceFlagBitsNV(VkGeometryInstance
     }
 }
 
+static inline const char* string_VkGeometryInstanceFlagsNV(VkGeometryInstanceFlagsNV input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkGeometryInstanceFlagBitsNV, buffer, buffer_size);
+}
+
 static inline std::string string_VkGeometryInstanceFlagsNV(VkGeometryInstanceFlagsNV input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkGeometryInstanceFlagBitsNV(static_cast<VkGeometryInstanceFlagBitsNV>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkGeometryInstanceFlagBitsNV(static_cast<VkGeometryInstanceFlagBitsNV>(0)));
-    return ret;
+    char buffer[235];
+    return string_VkGeometryInstanceFlagsNV(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkAccelerationStructureTypeNV(VkAccelerationStructureTypeNV input_value)
@@ -5468,20 +5120,15 @@ static inline const char* string_VkBuildAccelerationStructureFlagBitsNV(VkBuildA
     }
 }
 
+static inline const char* string_VkBuildAccelerationStructureFlagsNV(VkBuildAccelerationStructureFlagsNV input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkBuildAccelerationStructureFlagBitsNV, buffer, buffer_size);
+}
+
 static inline std::string string_VkBuildAccelerationStructureFlagsNV(VkBuildAccelerationStructureFlagsNV input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkBuildAccelerationStructureFlagBitsNV(static_cast<VkBuildAccelerationStructureFlagBitsNV>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkBuildAccelerationStructureFlagBitsNV(static_cast<VkBuildAccelerationStructureFlagBitsNV>(0)));
-    return ret;
+    char buffer[322];
+    return string_VkBuildAccelerationStructureFlagsNV(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkCopyAccelerationStructureModeNV(VkCopyAccelerationStructureModeNV input_value)
@@ -5576,20 +5223,15 @@ static inline const char* string_VkPipelineCreationFeedbackFlagBitsEXT(VkPipelin
     }
 }
 
+static inline const char* string_VkPipelineCreationFeedbackFlagsEXT(VkPipelineCreationFeedbackFlagsEXT input_value, char *buffer, size_t buffer_size)
+{
+    return string_flags_into(input_value, string_VkPipelineCreationFeedbackFlagBitsEXT, buffer, buffer_size);
+}
+
 static inline std::string string_VkPipelineCreationFeedbackFlagsEXT(VkPipelineCreationFeedbackFlagsEXT input_value)
 {
-    std::string ret;
-    int index = 0;
-    while(input_value) {
-        if (input_value & 1) {
-            if( !ret.empty()) ret.append("|");
-            ret.append(string_VkPipelineCreationFeedbackFlagBitsEXT(static_cast<VkPipelineCreationFeedbackFlagBitsEXT>(1 << index)));
-        }
-        ++index;
-        input_value >>= 1;
-    }
-    if( ret.empty()) ret.append(string_VkPipelineCreationFeedbackFlagBitsEXT(static_cast<VkPipelineCreationFeedbackFlagBitsEXT>(0)));
-    return ret;
+    char buffer[227];
+    return string_VkPipelineCreationFeedbackFlagsEXT(input_value, buffer, sizeof(buffer));
 }
 
 static inline const char* string_VkPerformanceConfigurationTypeINTEL(VkPerformanceConfigurationTypeINTEL input_value)
@@ -31,7 +31,9 @@
 
 
 #include "vk_safe_struct.h"
+#include "vk_safe_struct_arena.h"
 #include <string.h>
+#include <new>
 
 
 safe_VkApplicationInfo::safe_VkApplicationInfo(const VkApplicationInfo* in_struct) :
@@ -75,6 +77,23 @@ safe_VkApplicationInfo& safe_VkApplicationInfo::operator=(const safe_VkApplicati
     return *this;
 }
 
+safe_VkApplicationInfo::safe_VkApplicationInfo(safe_VkApplicationInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkApplicationInfo));
+    new (&src) safe_VkApplicationInfo();
+}
+
+safe_VkApplicationInfo& safe_VkApplicationInfo::operator=(safe_VkApplicationInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkApplicationInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkApplicationInfo));
+    new (&src) safe_VkApplicationInfo();
+
+    return *this;
+}
+
 safe_VkApplicationInfo::~safe_VkApplicationInfo()
 {
 }
@@ -111,7 +130,7 @@ safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo(const VkInstanceCreateInfo*
     ppEnabledExtensionNames(in_struct->ppEnabledExtensionNames)
 {
     if (in_struct->pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(in_struct->pApplicationInfo);
+        pApplicationInfo = vl_safe_new<safe_VkApplicationInfo>(in_struct->pApplicationInfo);
     else
         pApplicationInfo = NULL;
 }
@@ -129,7 +148,7 @@ safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo(const safe_VkInstanceCreate
     enabledExtensionCount = src.enabledExtensionCount;
     ppEnabledExtensionNames = src.ppEnabledExtensionNames;
     if (src.pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(*src.pApplicationInfo);
+        pApplicationInfo = vl_safe_new<safe_VkApplicationInfo>(*src.pApplicationInfo);
     else
         pApplicationInfo = NULL;
 }
@@ -139,7 +158,7 @@ safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(const safe_VkIns
     if (&src == this) return *this;
 
     if (pApplicationInfo)
-        delete pApplicationInfo;
+        vl_safe_delete(pApplicationInfo);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -149,17 +168,34 @@ safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(const safe_VkIns
     enabledExtensionCount = src.enabledExtensionCount;
     ppEnabledExtensionNames = src.ppEnabledExtensionNames;
     if (src.pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(*src.pApplicationInfo);
+        pApplicationInfo = vl_safe_new<safe_VkApplicationInfo>(*src.pApplicationInfo);
     else
         pApplicationInfo = NULL;
 
     return *this;
 }
 
+safe_VkInstanceCreateInfo::safe_VkInstanceCreateInfo(safe_VkInstanceCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkInstanceCreateInfo));
+    new (&src) safe_VkInstanceCreateInfo();
+}
+
+safe_VkInstanceCreateInfo& safe_VkInstanceCreateInfo::operator=(safe_VkInstanceCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkInstanceCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkInstanceCreateInfo));
+    new (&src) safe_VkInstanceCreateInfo();
+
+    return *this;
+}
+
 safe_VkInstanceCreateInfo::~safe_VkInstanceCreateInfo()
 {
     if (pApplicationInfo)
-        delete pApplicationInfo;
+        vl_safe_delete(pApplicationInfo);
 }
 
 void safe_VkInstanceCreateInfo::initialize(const VkInstanceCreateInfo* in_struct)
@@ -172,7 +208,7 @@ void safe_VkInstanceCreateInfo::initialize(const VkInstanceCreateInfo* in_struct
     enabledExtensionCount = in_struct->enabledExtensionCount;
     ppEnabledExtensionNames = in_struct->ppEnabledExtensionNames;
     if (in_struct->pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(in_struct->pApplicationInfo);
+        pApplicationInfo = vl_safe_new<safe_VkApplicationInfo>(in_struct->pApplicationInfo);
     else
         pApplicationInfo = NULL;
 }
@@ -187,7 +223,7 @@ void safe_VkInstanceCreateInfo::initialize(const safe_VkInstanceCreateInfo* src)
     enabledExtensionCount = src->enabledExtensionCount;
     ppEnabledExtensionNames = src->ppEnabledExtensionNames;
     if (src->pApplicationInfo)
-        pApplicationInfo = new safe_VkApplicationInfo(*src->pApplicationInfo);
+        pApplicationInfo = vl_safe_new<safe_VkApplicationInfo>(*src->pApplicationInfo);
     else
         pApplicationInfo = NULL;
 }
@@ -230,6 +266,23 @@ safe_VkAllocationCallbacks& safe_VkAllocationCallbacks::operator=(const safe_VkA
     return *this;
 }
 
+safe_VkAllocationCallbacks::safe_VkAllocationCallbacks(safe_VkAllocationCallbacks&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAllocationCallbacks));
+    new (&src) safe_VkAllocationCallbacks();
+}
+
+safe_VkAllocationCallbacks& safe_VkAllocationCallbacks::operator=(safe_VkAllocationCallbacks&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAllocationCallbacks();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAllocationCallbacks));
+    new (&src) safe_VkAllocationCallbacks();
+
+    return *this;
+}
+
 safe_VkAllocationCallbacks::~safe_VkAllocationCallbacks()
 {
 }
@@ -263,7 +316,7 @@ safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(const VkDeviceQueueCr
     pQueuePriorities(nullptr)
 {
     if (in_struct->pQueuePriorities) {
-        pQueuePriorities = new float[in_struct->queueCount];
+        pQueuePriorities = vl_safe_new_array<float>(in_struct->queueCount);
         memcpy ((void *)pQueuePriorities, (void *)in_struct->pQueuePriorities, sizeof(float)*in_struct->queueCount);
     }
 }
@@ -281,7 +334,7 @@ safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(const safe_VkDeviceQu
     queueCount = src.queueCount;
     pQueuePriorities = nullptr;
     if (src.pQueuePriorities) {
-        pQueuePriorities = new float[src.queueCount];
+        pQueuePriorities = vl_safe_new_array<float>(src.queueCount);
         memcpy ((void *)pQueuePriorities, (void *)src.pQueuePriorities, sizeof(float)*src.queueCount);
     }
 }
@@ -291,7 +344,7 @@ safe_VkDeviceQueueCreateInfo& safe_VkDeviceQueueCreateInfo::operator=(const safe
     if (&src == this) return *this;
 
     if (pQueuePriorities)
-        delete[] pQueuePriorities;
+        vl_safe_delete_array(pQueuePriorities);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -300,17 +353,34 @@ safe_VkDeviceQueueCreateInfo& safe_VkDeviceQueueCreateInfo::operator=(const safe
     queueCount = src.queueCount;
     pQueuePriorities = nullptr;
     if (src.pQueuePriorities) {
-        pQueuePriorities = new float[src.queueCount];
+        pQueuePriorities = vl_safe_new_array<float>(src.queueCount);
         memcpy ((void *)pQueuePriorities, (void *)src.pQueuePriorities, sizeof(float)*src.queueCount);
     }
 
     return *this;
 }
 
+safe_VkDeviceQueueCreateInfo::safe_VkDeviceQueueCreateInfo(safe_VkDeviceQueueCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceQueueCreateInfo));
+    new (&src) safe_VkDeviceQueueCreateInfo();
+}
+
+safe_VkDeviceQueueCreateInfo& safe_VkDeviceQueueCreateInfo::operator=(safe_VkDeviceQueueCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceQueueCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceQueueCreateInfo));
+    new (&src) safe_VkDeviceQueueCreateInfo();
+
+    return *this;
+}
+
 safe_VkDeviceQueueCreateInfo::~safe_VkDeviceQueueCreateInfo()
 {
     if (pQueuePriorities)
-        delete[] pQueuePriorities;
+        vl_safe_delete_array(pQueuePriorities);
 }
 
 void safe_VkDeviceQueueCreateInfo::initialize(const VkDeviceQueueCreateInfo* in_struct)
@@ -322,7 +392,7 @@ void safe_VkDeviceQueueCreateInfo::initialize(const VkDeviceQueueCreateInfo* in_
     queueCount = in_struct->queueCount;
     pQueuePriorities = nullptr;
     if (in_struct->pQueuePriorities) {
-        pQueuePriorities = new float[in_struct->queueCount];
+        pQueuePriorities = vl_safe_new_array<float>(in_struct->queueCount);
         memcpy ((void *)pQueuePriorities, (void *)in_struct->pQueuePriorities, sizeof(float)*in_struct->queueCount);
     }
 }
@@ -336,7 +406,7 @@ void safe_VkDeviceQueueCreateInfo::initialize(const safe_VkDeviceQueueCreateInfo
     queueCount = src->queueCount;
     pQueuePriorities = nullptr;
     if (src->pQueuePriorities) {
-        pQueuePriorities = new float[src->queueCount];
+        pQueuePriorities = vl_safe_new_array<float>(src->queueCount);
         memcpy ((void *)pQueuePriorities, (void *)src->pQueuePriorities, sizeof(float)*src->queueCount);
     }
 }
@@ -354,13 +424,13 @@ safe_VkDeviceCreateInfo::safe_VkDeviceCreateInfo(const VkDeviceCreateInfo* in_st
     pEnabledFeatures(nullptr)
 {
     if (queueCreateInfoCount && in_struct->pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = vl_safe_new_array<safe_VkDeviceQueueCreateInfo>(queueCreateInfoCount);
         for (uint32_t i=0; i<queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&in_struct->pQueueCreateInfos[i]);
         }
     }
     if (in_struct->pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*in_struct->pEnabledFeatures);
+        pEnabledFeatures = vl_safe_new<VkPhysicalDeviceFeatures>(*in_struct->pEnabledFeatures);
     }
 }
 
@@ -382,13 +452,13 @@ safe_VkDeviceCreateInfo::safe_VkDeviceCreateInfo(const safe_VkDeviceCreateInfo&
     ppEnabledExtensionNames = src.ppEnabledExtensionNames;
     pEnabledFeatures = nullptr;
     if (queueCreateInfoCount && src.pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = vl_safe_new_array<safe_VkDeviceQueueCreateInfo>(queueCreateInfoCount);
         for (uint32_t i=0; i<queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&src.pQueueCreateInfos[i]);
         }
     }
     if (src.pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*src.pEnabledFeatures);
+        pEnabledFeatures = vl_safe_new<VkPhysicalDeviceFeatures>(*src.pEnabledFeatures);
     }
 }
 
@@ -397,9 +467,9 @@ safe_VkDeviceCreateInfo& safe_VkDeviceCreateInfo::operator=(const safe_VkDeviceC
     if (&src == this) return *this;
 
     if (pQueueCreateInfos)
-        delete[] pQueueCreateInfos;
+        vl_safe_delete_array(pQueueCreateInfos);
     if (pEnabledFeatures)
-        delete pEnabledFeatures;
+        vl_safe_delete(pEnabledFeatures);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -412,24 +482,41 @@ safe_VkDeviceCreateInfo& safe_VkDeviceCreateInfo::operator=(const safe_VkDeviceC
     ppEnabledExtensionNames = src.ppEnabledExtensionNames;
     pEnabledFeatures = nullptr;
     if (queueCreateInfoCount && src.pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = vl_safe_new_array<safe_VkDeviceQueueCreateInfo>(queueCreateInfoCount);
         for (uint32_t i=0; i<queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&src.pQueueCreateInfos[i]);
         }
     }
     if (src.pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*src.pEnabledFeatures);
+        pEnabledFeatures = vl_safe_new<VkPhysicalDeviceFeatures>(*src.pEnabledFeatures);
     }
 
     return *this;
 }
 
+safe_VkDeviceCreateInfo::safe_VkDeviceCreateInfo(safe_VkDeviceCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceCreateInfo));
+    new (&src) safe_VkDeviceCreateInfo();
+}
+
+safe_VkDeviceCreateInfo& safe_VkDeviceCreateInfo::operator=(safe_VkDeviceCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceCreateInfo));
+    new (&src) safe_VkDeviceCreateInfo();
+
+    return *this;
+}
+
 safe_VkDeviceCreateInfo::~safe_VkDeviceCreateInfo()
 {
     if (pQueueCreateInfos)
-        delete[] pQueueCreateInfos;
+        vl_safe_delete_array(pQueueCreateInfos);
     if (pEnabledFeatures)
-        delete pEnabledFeatures;
+        vl_safe_delete(pEnabledFeatures);
 }
 
 void safe_VkDeviceCreateInfo::initialize(const VkDeviceCreateInfo* in_struct)
@@ -445,13 +532,13 @@ void safe_VkDeviceCreateInfo::initialize(const VkDeviceCreateInfo* in_struct)
     ppEnabledExtensionNames = in_struct->ppEnabledExtensionNames;
     pEnabledFeatures = nullptr;
     if (queueCreateInfoCount && in_struct->pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = vl_safe_new_array<safe_VkDeviceQueueCreateInfo>(queueCreateInfoCount);
         for (uint32_t i=0; i<queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&in_struct->pQueueCreateInfos[i]);
         }
     }
     if (in_struct->pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*in_struct->pEnabledFeatures);
+        pEnabledFeatures = vl_safe_new<VkPhysicalDeviceFeatures>(*in_struct->pEnabledFeatures);
     }
 }
 
@@ -468,13 +555,13 @@ void safe_VkDeviceCreateInfo::initialize(const safe_VkDeviceCreateInfo* src)
     ppEnabledExtensionNames = src->ppEnabledExtensionNames;
     pEnabledFeatures = nullptr;
     if (queueCreateInfoCount && src->pQueueCreateInfos) {
-        pQueueCreateInfos = new safe_VkDeviceQueueCreateInfo[queueCreateInfoCount];
+        pQueueCreateInfos = vl_safe_new_array<safe_VkDeviceQueueCreateInfo>(queueCreateInfoCount);
         for (uint32_t i=0; i<queueCreateInfoCount; ++i) {
             pQueueCreateInfos[i].initialize(&src->pQueueCreateInfos[i]);
         }
     }
     if (src->pEnabledFeatures) {
-        pEnabledFeatures = new VkPhysicalDeviceFeatures(*src->pEnabledFeatures);
+        pEnabledFeatures = vl_safe_new<VkPhysicalDeviceFeatures>(*src->pEnabledFeatures);
     }
 }
 
@@ -490,24 +577,20 @@ safe_VkSubmitInfo::safe_VkSubmitInfo(const VkSubmitInfo* in_struct) :
     pSignalSemaphores(nullptr)
 {
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)in_struct->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (in_struct->pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[in_struct->waitSemaphoreCount];
+        pWaitDstStageMask = vl_safe_new_array<VkPipelineStageFlags>(in_struct->waitSemaphoreCount);
         memcpy ((void *)pWaitDstStageMask, (void *)in_struct->pWaitDstStageMask, sizeof(VkPipelineStageFlags)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[in_struct->commandBufferCount];
+        pCommandBuffers = vl_safe_new_array<VkCommandBuffer>(in_struct->commandBufferCount);
         memcpy ((void *)pCommandBuffers, (void *)in_struct->pCommandBuffers, sizeof(VkCommandBuffer)*in_struct->commandBufferCount);
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)in_struct->pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -530,24 +613,20 @@ safe_VkSubmitInfo::safe_VkSubmitInfo(const safe_VkSubmitInfo& src)
     signalSemaphoreCount = src.signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src.pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src.pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (src.pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[src.waitSemaphoreCount];
+        pWaitDstStageMask = vl_safe_new_array<VkPipelineStageFlags>(src.waitSemaphoreCount);
         memcpy ((void *)pWaitDstStageMask, (void *)src.pWaitDstStageMask, sizeof(VkPipelineStageFlags)*src.waitSemaphoreCount);
     }
     if (src.pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[src.commandBufferCount];
+        pCommandBuffers = vl_safe_new_array<VkCommandBuffer>(src.commandBufferCount);
         memcpy ((void *)pCommandBuffers, (void *)src.pCommandBuffers, sizeof(VkCommandBuffer)*src.commandBufferCount);
     }
     if (signalSemaphoreCount && src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = src.pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)src.pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -556,13 +635,13 @@ safe_VkSubmitInfo& safe_VkSubmitInfo::operator=(const safe_VkSubmitInfo& src)
     if (&src == this) return *this;
 
     if (pWaitSemaphores)
-        delete[] pWaitSemaphores;
+        vl_safe_delete_array(pWaitSemaphores);
     if (pWaitDstStageMask)
-        delete[] pWaitDstStageMask;
+        vl_safe_delete_array(pWaitDstStageMask);
     if (pCommandBuffers)
-        delete[] pCommandBuffers;
+        vl_safe_delete_array(pCommandBuffers);
     if (pSignalSemaphores)
-        delete[] pSignalSemaphores;
+        vl_safe_delete_array(pSignalSemaphores);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -574,39 +653,52 @@ safe_VkSubmitInfo& safe_VkSubmitInfo::operator=(const safe_VkSubmitInfo& src)
     signalSemaphoreCount = src.signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src.pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src.pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (src.pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[src.waitSemaphoreCount];
+        pWaitDstStageMask = vl_safe_new_array<VkPipelineStageFlags>(src.waitSemaphoreCount);
         memcpy ((void *)pWaitDstStageMask, (void *)src.pWaitDstStageMask, sizeof(VkPipelineStageFlags)*src.waitSemaphoreCount);
     }
     if (src.pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[src.commandBufferCount];
+        pCommandBuffers = vl_safe_new_array<VkCommandBuffer>(src.commandBufferCount);
         memcpy ((void *)pCommandBuffers, (void *)src.pCommandBuffers, sizeof(VkCommandBuffer)*src.commandBufferCount);
     }
     if (signalSemaphoreCount && src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = src.pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)src.pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 
     return *this;
 }
 
+safe_VkSubmitInfo::safe_VkSubmitInfo(safe_VkSubmitInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubmitInfo));
+    new (&src) safe_VkSubmitInfo();
+}
+
+safe_VkSubmitInfo& safe_VkSubmitInfo::operator=(safe_VkSubmitInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubmitInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubmitInfo));
+    new (&src) safe_VkSubmitInfo();
+
+    return *this;
+}
+
 safe_VkSubmitInfo::~safe_VkSubmitInfo()
 {
     if (pWaitSemaphores)
-        delete[] pWaitSemaphores;
+        vl_safe_delete_array(pWaitSemaphores);
     if (pWaitDstStageMask)
-        delete[] pWaitDstStageMask;
+        vl_safe_delete_array(pWaitDstStageMask);
     if (pCommandBuffers)
-        delete[] pCommandBuffers;
+        vl_safe_delete_array(pCommandBuffers);
     if (pSignalSemaphores)
-        delete[] pSignalSemaphores;
+        vl_safe_delete_array(pSignalSemaphores);
 }
 
 void safe_VkSubmitInfo::initialize(const VkSubmitInfo* in_struct)
@@ -621,24 +713,20 @@ void safe_VkSubmitInfo::initialize(const VkSubmitInfo* in_struct)
     signalSemaphoreCount = in_struct->signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)in_struct->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (in_struct->pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[in_struct->waitSemaphoreCount];
+        pWaitDstStageMask = vl_safe_new_array<VkPipelineStageFlags>(in_struct->waitSemaphoreCount);
         memcpy ((void *)pWaitDstStageMask, (void *)in_struct->pWaitDstStageMask, sizeof(VkPipelineStageFlags)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[in_struct->commandBufferCount];
+        pCommandBuffers = vl_safe_new_array<VkCommandBuffer>(in_struct->commandBufferCount);
         memcpy ((void *)pCommandBuffers, (void *)in_struct->pCommandBuffers, sizeof(VkCommandBuffer)*in_struct->commandBufferCount);
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)in_struct->pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -654,24 +742,20 @@ void safe_VkSubmitInfo::initialize(const safe_VkSubmitInfo* src)
     signalSemaphoreCount = src->signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && src->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (src->pWaitDstStageMask) {
-        pWaitDstStageMask = new VkPipelineStageFlags[src->waitSemaphoreCount];
+        pWaitDstStageMask = vl_safe_new_array<VkPipelineStageFlags>(src->waitSemaphoreCount);
         memcpy ((void *)pWaitDstStageMask, (void *)src->pWaitDstStageMask, sizeof(VkPipelineStageFlags)*src->waitSemaphoreCount);
     }
     if (src->pCommandBuffers) {
-        pCommandBuffers = new VkCommandBuffer[src->commandBufferCount];
+        pCommandBuffers = vl_safe_new_array<VkCommandBuffer>(src->commandBufferCount);
         memcpy ((void *)pCommandBuffers, (void *)src->pCommandBuffers, sizeof(VkCommandBuffer)*src->commandBufferCount);
     }
     if (signalSemaphoreCount && src->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = src->pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)src->pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -707,6 +791,23 @@ safe_VkMemoryAllocateInfo& safe_VkMemoryAllocateInfo::operator=(const safe_VkMem
     return *this;
 }
 
+safe_VkMemoryAllocateInfo::safe_VkMemoryAllocateInfo(safe_VkMemoryAllocateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryAllocateInfo));
+    new (&src) safe_VkMemoryAllocateInfo();
+}
+
+safe_VkMemoryAllocateInfo& safe_VkMemoryAllocateInfo::operator=(safe_VkMemoryAllocateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryAllocateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryAllocateInfo));
+    new (&src) safe_VkMemoryAllocateInfo();
+
+    return *this;
+}
+
 safe_VkMemoryAllocateInfo::~safe_VkMemoryAllocateInfo()
 {
 }
@@ -762,6 +863,23 @@ safe_VkMappedMemoryRange& safe_VkMappedMemoryRange::operator=(const safe_VkMappe
     return *this;
 }
 
+safe_VkMappedMemoryRange::safe_VkMappedMemoryRange(safe_VkMappedMemoryRange&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMappedMemoryRange));
+    new (&src) safe_VkMappedMemoryRange();
+}
+
+safe_VkMappedMemoryRange& safe_VkMappedMemoryRange::operator=(safe_VkMappedMemoryRange&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMappedMemoryRange();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMappedMemoryRange));
+    new (&src) safe_VkMappedMemoryRange();
+
+    return *this;
+}
+
 safe_VkMappedMemoryRange::~safe_VkMappedMemoryRange()
 {
 }
@@ -790,10 +908,8 @@ safe_VkSparseBufferMemoryBindInfo::safe_VkSparseBufferMemoryBindInfo(const VkSpa
     pBinds(nullptr)
 {
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = in_struct->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)in_struct->pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -807,10 +923,8 @@ safe_VkSparseBufferMemoryBindInfo::safe_VkSparseBufferMemoryBindInfo(const safe_
     bindCount = src.bindCount;
     pBinds = nullptr;
     if (bindCount && src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src.pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src.pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -819,25 +933,40 @@ safe_VkSparseBufferMemoryBindInfo& safe_VkSparseBufferMemoryBindInfo::operator=(
     if (&src == this) return *this;
 
     if (pBinds)
-        delete[] pBinds;
+        vl_safe_delete_array(pBinds);
 
     buffer = src.buffer;
     bindCount = src.bindCount;
     pBinds = nullptr;
     if (bindCount && src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src.pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src.pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 
     return *this;
 }
 
+safe_VkSparseBufferMemoryBindInfo::safe_VkSparseBufferMemoryBindInfo(safe_VkSparseBufferMemoryBindInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseBufferMemoryBindInfo));
+    new (&src) safe_VkSparseBufferMemoryBindInfo();
+}
+
+safe_VkSparseBufferMemoryBindInfo& safe_VkSparseBufferMemoryBindInfo::operator=(safe_VkSparseBufferMemoryBindInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSparseBufferMemoryBindInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseBufferMemoryBindInfo));
+    new (&src) safe_VkSparseBufferMemoryBindInfo();
+
+    return *this;
+}
+
 safe_VkSparseBufferMemoryBindInfo::~safe_VkSparseBufferMemoryBindInfo()
 {
     if (pBinds)
-        delete[] pBinds;
+        vl_safe_delete_array(pBinds);
 }
 
 void safe_VkSparseBufferMemoryBindInfo::initialize(const VkSparseBufferMemoryBindInfo* in_struct)
@@ -846,10 +975,8 @@ void safe_VkSparseBufferMemoryBindInfo::initialize(const VkSparseBufferMemoryBin
     bindCount = in_struct->bindCount;
     pBinds = nullptr;
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = in_struct->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)in_struct->pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -859,10 +986,8 @@ void safe_VkSparseBufferMemoryBindInfo::initialize(const safe_VkSparseBufferMemo
     bindCount = src->bindCount;
     pBinds = nullptr;
     if (bindCount && src->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src->pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -872,10 +997,8 @@ safe_VkSparseImageOpaqueMemoryBindInfo::safe_VkSparseImageOpaqueMemoryBindInfo(c
     pBinds(nullptr)
 {
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = in_struct->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)in_struct->pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -889,10 +1012,8 @@ safe_VkSparseImageOpaqueMemoryBindInfo::safe_VkSparseImageOpaqueMemoryBindInfo(c
     bindCount = src.bindCount;
     pBinds = nullptr;
     if (bindCount && src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src.pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src.pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -901,25 +1022,40 @@ safe_VkSparseImageOpaqueMemoryBindInfo& safe_VkSparseImageOpaqueMemoryBindInfo::
     if (&src == this) return *this;
 
     if (pBinds)
-        delete[] pBinds;
+        vl_safe_delete_array(pBinds);
 
     image = src.image;
     bindCount = src.bindCount;
     pBinds = nullptr;
     if (bindCount && src.pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src.pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src.pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 
     return *this;
 }
 
+safe_VkSparseImageOpaqueMemoryBindInfo::safe_VkSparseImageOpaqueMemoryBindInfo(safe_VkSparseImageOpaqueMemoryBindInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageOpaqueMemoryBindInfo));
+    new (&src) safe_VkSparseImageOpaqueMemoryBindInfo();
+}
+
+safe_VkSparseImageOpaqueMemoryBindInfo& safe_VkSparseImageOpaqueMemoryBindInfo::operator=(safe_VkSparseImageOpaqueMemoryBindInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSparseImageOpaqueMemoryBindInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageOpaqueMemoryBindInfo));
+    new (&src) safe_VkSparseImageOpaqueMemoryBindInfo();
+
+    return *this;
+}
+
 safe_VkSparseImageOpaqueMemoryBindInfo::~safe_VkSparseImageOpaqueMemoryBindInfo()
 {
     if (pBinds)
-        delete[] pBinds;
+        vl_safe_delete_array(pBinds);
 }
 
 void safe_VkSparseImageOpaqueMemoryBindInfo::initialize(const VkSparseImageOpaqueMemoryBindInfo* in_struct)
@@ -928,10 +1064,8 @@ void safe_VkSparseImageOpaqueMemoryBindInfo::initialize(const VkSparseImageOpaqu
     bindCount = in_struct->bindCount;
     pBinds = nullptr;
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = in_struct->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)in_struct->pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -941,10 +1075,8 @@ void safe_VkSparseImageOpaqueMemoryBindInfo::initialize(const safe_VkSparseImage
     bindCount = src->bindCount;
     pBinds = nullptr;
     if (bindCount && src->pBinds) {
-        pBinds = new VkSparseMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src->pBinds, sizeof(VkSparseMemoryBind)*bindCount);
     }
 }
 
@@ -954,10 +1086,8 @@ safe_VkSparseImageMemoryBindInfo::safe_VkSparseImageMemoryBindInfo(const VkSpars
     pBinds(nullptr)
 {
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = in_struct->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseImageMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)in_struct->pBinds, sizeof(VkSparseImageMemoryBind)*bindCount);
     }
 }
 
@@ -971,10 +1101,8 @@ safe_VkSparseImageMemoryBindInfo::safe_VkSparseImageMemoryBindInfo(const safe_Vk
     bindCount = src.bindCount;
     pBinds = nullptr;
     if (bindCount && src.pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src.pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseImageMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src.pBinds, sizeof(VkSparseImageMemoryBind)*bindCount);
     }
 }
 
@@ -983,25 +1111,40 @@ safe_VkSparseImageMemoryBindInfo& safe_VkSparseImageMemoryBindInfo::operator=(co
     if (&src == this) return *this;
 
     if (pBinds)
-        delete[] pBinds;
+        vl_safe_delete_array(pBinds);
 
     image = src.image;
     bindCount = src.bindCount;
     pBinds = nullptr;
     if (bindCount && src.pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src.pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseImageMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src.pBinds, sizeof(VkSparseImageMemoryBind)*bindCount);
     }
 
     return *this;
 }
 
+safe_VkSparseImageMemoryBindInfo::safe_VkSparseImageMemoryBindInfo(safe_VkSparseImageMemoryBindInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageMemoryBindInfo));
+    new (&src) safe_VkSparseImageMemoryBindInfo();
+}
+
+safe_VkSparseImageMemoryBindInfo& safe_VkSparseImageMemoryBindInfo::operator=(safe_VkSparseImageMemoryBindInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSparseImageMemoryBindInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageMemoryBindInfo));
+    new (&src) safe_VkSparseImageMemoryBindInfo();
+
+    return *this;
+}
+
 safe_VkSparseImageMemoryBindInfo::~safe_VkSparseImageMemoryBindInfo()
 {
     if (pBinds)
-        delete[] pBinds;
+        vl_safe_delete_array(pBinds);
 }
 
 void safe_VkSparseImageMemoryBindInfo::initialize(const VkSparseImageMemoryBindInfo* in_struct)
@@ -1010,10 +1153,8 @@ void safe_VkSparseImageMemoryBindInfo::initialize(const VkSparseImageMemoryBindI
     bindCount = in_struct->bindCount;
     pBinds = nullptr;
     if (bindCount && in_struct->pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = in_struct->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseImageMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)in_struct->pBinds, sizeof(VkSparseImageMemoryBind)*bindCount);
     }
 }
 
@@ -1023,10 +1164,8 @@ void safe_VkSparseImageMemoryBindInfo::initialize(const safe_VkSparseImageMemory
     bindCount = src->bindCount;
     pBinds = nullptr;
     if (bindCount && src->pBinds) {
-        pBinds = new VkSparseImageMemoryBind[bindCount];
-        for (uint32_t i=0; i<bindCount; ++i) {
-            pBinds[i] = src->pBinds[i];
-        }
+        pBinds = vl_safe_new_array<VkSparseImageMemoryBind>(bindCount);
+        memcpy ((void *)pBinds, (void *)src->pBinds, sizeof(VkSparseImageMemoryBind)*bindCount);
     }
 }
 
@@ -1045,34 +1184,30 @@ safe_VkBindSparseInfo::safe_VkBindSparseInfo(const VkBindSparseInfo* in_struct)
     pSignalSemaphores(nullptr)
 {
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)in_struct->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (bufferBindCount && in_struct->pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = vl_safe_new_array<safe_VkSparseBufferMemoryBindInfo>(bufferBindCount);
         for (uint32_t i=0; i<bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&in_struct->pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && in_struct->pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = vl_safe_new_array<safe_VkSparseImageOpaqueMemoryBindInfo>(imageOpaqueBindCount);
         for (uint32_t i=0; i<imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&in_struct->pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && in_struct->pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = vl_safe_new_array<safe_VkSparseImageMemoryBindInfo>(imageBindCount);
         for (uint32_t i=0; i<imageBindCount; ++i) {
             pImageBinds[i].initialize(&in_struct->pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)in_struct->pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -1099,34 +1234,30 @@ safe_VkBindSparseInfo::safe_VkBindSparseInfo(const safe_VkBindSparseInfo& src)
     signalSemaphoreCount = src.signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src.pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src.pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (bufferBindCount && src.pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = vl_safe_new_array<safe_VkSparseBufferMemoryBindInfo>(bufferBindCount);
         for (uint32_t i=0; i<bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&src.pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && src.pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = vl_safe_new_array<safe_VkSparseImageOpaqueMemoryBindInfo>(imageOpaqueBindCount);
         for (uint32_t i=0; i<imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&src.pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && src.pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = vl_safe_new_array<safe_VkSparseImageMemoryBindInfo>(imageBindCount);
         for (uint32_t i=0; i<imageBindCount; ++i) {
             pImageBinds[i].initialize(&src.pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = src.pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)src.pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -1135,15 +1266,15 @@ safe_VkBindSparseInfo& safe_VkBindSparseInfo::operator=(const safe_VkBindSparseI
     if (&src == this) return *this;
 
     if (pWaitSemaphores)
-        delete[] pWaitSemaphores;
+        vl_safe_delete_array(pWaitSemaphores);
     if (pBufferBinds)
-        delete[] pBufferBinds;
+        vl_safe_delete_array(pBufferBinds);
     if (pImageOpaqueBinds)
-        delete[] pImageOpaqueBinds;
+        vl_safe_delete_array(pImageOpaqueBinds);
     if (pImageBinds)
-        delete[] pImageBinds;
+        vl_safe_delete_array(pImageBinds);
     if (pSignalSemaphores)
-        delete[] pSignalSemaphores;
+        vl_safe_delete_array(pSignalSemaphores);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -1158,51 +1289,64 @@ safe_VkBindSparseInfo& safe_VkBindSparseInfo::operator=(const safe_VkBindSparseI
     signalSemaphoreCount = src.signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src.pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src.pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (bufferBindCount && src.pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = vl_safe_new_array<safe_VkSparseBufferMemoryBindInfo>(bufferBindCount);
         for (uint32_t i=0; i<bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&src.pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && src.pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = vl_safe_new_array<safe_VkSparseImageOpaqueMemoryBindInfo>(imageOpaqueBindCount);
         for (uint32_t i=0; i<imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&src.pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && src.pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = vl_safe_new_array<safe_VkSparseImageMemoryBindInfo>(imageBindCount);
         for (uint32_t i=0; i<imageBindCount; ++i) {
             pImageBinds[i].initialize(&src.pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && src.pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = src.pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)src.pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 
     return *this;
 }
 
+safe_VkBindSparseInfo::safe_VkBindSparseInfo(safe_VkBindSparseInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindSparseInfo));
+    new (&src) safe_VkBindSparseInfo();
+}
+
+safe_VkBindSparseInfo& safe_VkBindSparseInfo::operator=(safe_VkBindSparseInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindSparseInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindSparseInfo));
+    new (&src) safe_VkBindSparseInfo();
+
+    return *this;
+}
+
 safe_VkBindSparseInfo::~safe_VkBindSparseInfo()
 {
     if (pWaitSemaphores)
-        delete[] pWaitSemaphores;
+        vl_safe_delete_array(pWaitSemaphores);
     if (pBufferBinds)
-        delete[] pBufferBinds;
+        vl_safe_delete_array(pBufferBinds);
     if (pImageOpaqueBinds)
-        delete[] pImageOpaqueBinds;
+        vl_safe_delete_array(pImageOpaqueBinds);
     if (pImageBinds)
-        delete[] pImageBinds;
+        vl_safe_delete_array(pImageBinds);
     if (pSignalSemaphores)
-        delete[] pSignalSemaphores;
+        vl_safe_delete_array(pSignalSemaphores);
 }
 
 void safe_VkBindSparseInfo::initialize(const VkBindSparseInfo* in_struct)
@@ -1220,34 +1364,30 @@ void safe_VkBindSparseInfo::initialize(const VkBindSparseInfo* in_struct)
     signalSemaphoreCount = in_struct->signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)in_struct->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (bufferBindCount && in_struct->pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = vl_safe_new_array<safe_VkSparseBufferMemoryBindInfo>(bufferBindCount);
         for (uint32_t i=0; i<bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&in_struct->pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && in_struct->pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = vl_safe_new_array<safe_VkSparseImageOpaqueMemoryBindInfo>(imageOpaqueBindCount);
         for (uint32_t i=0; i<imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&in_struct->pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && in_struct->pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = vl_safe_new_array<safe_VkSparseImageMemoryBindInfo>(imageBindCount);
         for (uint32_t i=0; i<imageBindCount; ++i) {
             pImageBinds[i].initialize(&in_struct->pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && in_struct->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = in_struct->pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)in_struct->pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -1266,34 +1406,30 @@ void safe_VkBindSparseInfo::initialize(const safe_VkBindSparseInfo* src)
     signalSemaphoreCount = src->signalSemaphoreCount;
     pSignalSemaphores = nullptr;
     if (waitSemaphoreCount && src->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (bufferBindCount && src->pBufferBinds) {
-        pBufferBinds = new safe_VkSparseBufferMemoryBindInfo[bufferBindCount];
+        pBufferBinds = vl_safe_new_array<safe_VkSparseBufferMemoryBindInfo>(bufferBindCount);
         for (uint32_t i=0; i<bufferBindCount; ++i) {
             pBufferBinds[i].initialize(&src->pBufferBinds[i]);
         }
     }
     if (imageOpaqueBindCount && src->pImageOpaqueBinds) {
-        pImageOpaqueBinds = new safe_VkSparseImageOpaqueMemoryBindInfo[imageOpaqueBindCount];
+        pImageOpaqueBinds = vl_safe_new_array<safe_VkSparseImageOpaqueMemoryBindInfo>(imageOpaqueBindCount);
         for (uint32_t i=0; i<imageOpaqueBindCount; ++i) {
             pImageOpaqueBinds[i].initialize(&src->pImageOpaqueBinds[i]);
         }
     }
     if (imageBindCount && src->pImageBinds) {
-        pImageBinds = new safe_VkSparseImageMemoryBindInfo[imageBindCount];
+        pImageBinds = vl_safe_new_array<safe_VkSparseImageMemoryBindInfo>(imageBindCount);
         for (uint32_t i=0; i<imageBindCount; ++i) {
             pImageBinds[i].initialize(&src->pImageBinds[i]);
         }
     }
     if (signalSemaphoreCount && src->pSignalSemaphores) {
-        pSignalSemaphores = new VkSemaphore[signalSemaphoreCount];
-        for (uint32_t i=0; i<signalSemaphoreCount; ++i) {
-            pSignalSemaphores[i] = src->pSignalSemaphores[i];
-        }
+        pSignalSemaphores = vl_safe_new_array<VkSemaphore>(signalSemaphoreCount);
+        memcpy ((void *)pSignalSemaphores, (void *)src->pSignalSemaphores, sizeof(VkSemaphore)*signalSemaphoreCount);
     }
 }
 
@@ -1326,6 +1462,23 @@ safe_VkFenceCreateInfo& safe_VkFenceCreateInfo::operator=(const safe_VkFenceCrea
     return *this;
 }
 
+safe_VkFenceCreateInfo::safe_VkFenceCreateInfo(safe_VkFenceCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFenceCreateInfo));
+    new (&src) safe_VkFenceCreateInfo();
+}
+
+safe_VkFenceCreateInfo& safe_VkFenceCreateInfo::operator=(safe_VkFenceCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFenceCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFenceCreateInfo));
+    new (&src) safe_VkFenceCreateInfo();
+
+    return *this;
+}
+
 safe_VkFenceCreateInfo::~safe_VkFenceCreateInfo()
 {
 }
@@ -1373,6 +1526,23 @@ safe_VkSemaphoreCreateInfo& safe_VkSemaphoreCreateInfo::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkSemaphoreCreateInfo::safe_VkSemaphoreCreateInfo(safe_VkSemaphoreCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSemaphoreCreateInfo));
+    new (&src) safe_VkSemaphoreCreateInfo();
+}
+
+safe_VkSemaphoreCreateInfo& safe_VkSemaphoreCreateInfo::operator=(safe_VkSemaphoreCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSemaphoreCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSemaphoreCreateInfo));
+    new (&src) safe_VkSemaphoreCreateInfo();
+
+    return *this;
+}
+
 safe_VkSemaphoreCreateInfo::~safe_VkSemaphoreCreateInfo()
 {
 }
@@ -1420,6 +1590,23 @@ safe_VkEventCreateInfo& safe_VkEventCreateInfo::operator=(const safe_VkEventCrea
     return *this;
 }
 
+safe_VkEventCreateInfo::safe_VkEventCreateInfo(safe_VkEventCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkEventCreateInfo));
+    new (&src) safe_VkEventCreateInfo();
+}
+
+safe_VkEventCreateInfo& safe_VkEventCreateInfo::operator=(safe_VkEventCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkEventCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkEventCreateInfo));
+    new (&src) safe_VkEventCreateInfo();
+
+    return *this;
+}
+
 safe_VkEventCreateInfo::~safe_VkEventCreateInfo()
 {
 }
@@ -1476,6 +1663,23 @@ safe_VkQueryPoolCreateInfo& safe_VkQueryPoolCreateInfo::operator=(const safe_VkQ
     return *this;
 }
 
+safe_VkQueryPoolCreateInfo::safe_VkQueryPoolCreateInfo(safe_VkQueryPoolCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueryPoolCreateInfo));
+    new (&src) safe_VkQueryPoolCreateInfo();
+}
+
+safe_VkQueryPoolCreateInfo& safe_VkQueryPoolCreateInfo::operator=(safe_VkQueryPoolCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkQueryPoolCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueryPoolCreateInfo));
+    new (&src) safe_VkQueryPoolCreateInfo();
+
+    return *this;
+}
+
 safe_VkQueryPoolCreateInfo::~safe_VkQueryPoolCreateInfo()
 {
 }
@@ -1511,7 +1715,7 @@ safe_VkBufferCreateInfo::safe_VkBufferCreateInfo(const VkBufferCreateInfo* in_st
     pQueueFamilyIndices(nullptr)
 {
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -1531,7 +1735,7 @@ safe_VkBufferCreateInfo::safe_VkBufferCreateInfo(const safe_VkBufferCreateInfo&
     queueFamilyIndexCount = src.queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 }
@@ -1541,7 +1745,7 @@ safe_VkBufferCreateInfo& safe_VkBufferCreateInfo::operator=(const safe_VkBufferC
     if (&src == this) return *this;
 
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -1552,17 +1756,34 @@ safe_VkBufferCreateInfo& safe_VkBufferCreateInfo::operator=(const safe_VkBufferC
     queueFamilyIndexCount = src.queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 
     return *this;
 }
 
+safe_VkBufferCreateInfo::safe_VkBufferCreateInfo(safe_VkBufferCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferCreateInfo));
+    new (&src) safe_VkBufferCreateInfo();
+}
+
+safe_VkBufferCreateInfo& safe_VkBufferCreateInfo::operator=(safe_VkBufferCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBufferCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferCreateInfo));
+    new (&src) safe_VkBufferCreateInfo();
+
+    return *this;
+}
+
 safe_VkBufferCreateInfo::~safe_VkBufferCreateInfo()
 {
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 }
 
 void safe_VkBufferCreateInfo::initialize(const VkBufferCreateInfo* in_struct)
@@ -1576,7 +1797,7 @@ void safe_VkBufferCreateInfo::initialize(const VkBufferCreateInfo* in_struct)
     queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -1592,7 +1813,7 @@ void safe_VkBufferCreateInfo::initialize(const safe_VkBufferCreateInfo* src)
     queueFamilyIndexCount = src->queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src->pQueueFamilyIndices, sizeof(uint32_t)*src->queueFamilyIndexCount);
     }
 }
@@ -1638,6 +1859,23 @@ safe_VkBufferViewCreateInfo& safe_VkBufferViewCreateInfo::operator=(const safe_V
     return *this;
 }
 
+safe_VkBufferViewCreateInfo::safe_VkBufferViewCreateInfo(safe_VkBufferViewCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferViewCreateInfo));
+    new (&src) safe_VkBufferViewCreateInfo();
+}
+
+safe_VkBufferViewCreateInfo& safe_VkBufferViewCreateInfo::operator=(safe_VkBufferViewCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBufferViewCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferViewCreateInfo));
+    new (&src) safe_VkBufferViewCreateInfo();
+
+    return *this;
+}
+
 safe_VkBufferViewCreateInfo::~safe_VkBufferViewCreateInfo()
 {
 }
@@ -1682,7 +1920,7 @@ safe_VkImageCreateInfo::safe_VkImageCreateInfo(const VkImageCreateInfo* in_struc
     initialLayout(in_struct->initialLayout)
 {
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -1709,7 +1947,7 @@ safe_VkImageCreateInfo::safe_VkImageCreateInfo(const safe_VkImageCreateInfo& src
     pQueueFamilyIndices = nullptr;
     initialLayout = src.initialLayout;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 }
@@ -1719,7 +1957,7 @@ safe_VkImageCreateInfo& safe_VkImageCreateInfo::operator=(const safe_VkImageCrea
     if (&src == this) return *this;
 
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -1737,17 +1975,34 @@ safe_VkImageCreateInfo& safe_VkImageCreateInfo::operator=(const safe_VkImageCrea
     pQueueFamilyIndices = nullptr;
     initialLayout = src.initialLayout;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 
     return *this;
 }
 
+safe_VkImageCreateInfo::safe_VkImageCreateInfo(safe_VkImageCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageCreateInfo));
+    new (&src) safe_VkImageCreateInfo();
+}
+
+safe_VkImageCreateInfo& safe_VkImageCreateInfo::operator=(safe_VkImageCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageCreateInfo));
+    new (&src) safe_VkImageCreateInfo();
+
+    return *this;
+}
+
 safe_VkImageCreateInfo::~safe_VkImageCreateInfo()
 {
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 }
 
 void safe_VkImageCreateInfo::initialize(const VkImageCreateInfo* in_struct)
@@ -1768,7 +2023,7 @@ void safe_VkImageCreateInfo::initialize(const VkImageCreateInfo* in_struct)
     pQueueFamilyIndices = nullptr;
     initialLayout = in_struct->initialLayout;
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -1791,7 +2046,7 @@ void safe_VkImageCreateInfo::initialize(const safe_VkImageCreateInfo* src)
     pQueueFamilyIndices = nullptr;
     initialLayout = src->initialLayout;
     if (src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src->pQueueFamilyIndices, sizeof(uint32_t)*src->queueFamilyIndexCount);
     }
 }
@@ -1840,6 +2095,23 @@ safe_VkImageViewCreateInfo& safe_VkImageViewCreateInfo::operator=(const safe_VkI
     return *this;
 }
 
+safe_VkImageViewCreateInfo::safe_VkImageViewCreateInfo(safe_VkImageViewCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewCreateInfo));
+    new (&src) safe_VkImageViewCreateInfo();
+}
+
+safe_VkImageViewCreateInfo& safe_VkImageViewCreateInfo::operator=(safe_VkImageViewCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageViewCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewCreateInfo));
+    new (&src) safe_VkImageViewCreateInfo();
+
+    return *this;
+}
+
 safe_VkImageViewCreateInfo::~safe_VkImageViewCreateInfo()
 {
 }
@@ -1876,7 +2148,7 @@ safe_VkShaderModuleCreateInfo::safe_VkShaderModuleCreateInfo(const VkShaderModul
     pCode(nullptr)
 {
     if (in_struct->pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(vl_safe_new_array<uint8_t>(codeSize));
         memcpy((void *)pCode, (void *)in_struct->pCode, codeSize);
     }
 }
@@ -1893,7 +2165,7 @@ safe_VkShaderModuleCreateInfo::safe_VkShaderModuleCreateInfo(const safe_VkShader
     codeSize = src.codeSize;
     pCode = nullptr;
     if (src.pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(vl_safe_new_array<uint8_t>(codeSize));
         memcpy((void *)pCode, (void *)src.pCode, codeSize);
     }
 }
@@ -1903,7 +2175,7 @@ safe_VkShaderModuleCreateInfo& safe_VkShaderModuleCreateInfo::operator=(const sa
     if (&src == this) return *this;
 
     if (pCode)
-        delete[] reinterpret_cast<const uint8_t *>(pCode);
+        vl_safe_delete_array(reinterpret_cast<const uint8_t *>(pCode));
 
     sType = src.sType;
     pNext = src.pNext;
@@ -1911,17 +2183,34 @@ safe_VkShaderModuleCreateInfo& safe_VkShaderModuleCreateInfo::operator=(const sa
     codeSize = src.codeSize;
     pCode = nullptr;
     if (src.pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(vl_safe_new_array<uint8_t>(codeSize));
         memcpy((void *)pCode, (void *)src.pCode, codeSize);
     }
 
     return *this;
 }
 
+safe_VkShaderModuleCreateInfo::safe_VkShaderModuleCreateInfo(safe_VkShaderModuleCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkShaderModuleCreateInfo));
+    new (&src) safe_VkShaderModuleCreateInfo();
+}
+
+safe_VkShaderModuleCreateInfo& safe_VkShaderModuleCreateInfo::operator=(safe_VkShaderModuleCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkShaderModuleCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkShaderModuleCreateInfo));
+    new (&src) safe_VkShaderModuleCreateInfo();
+
+    return *this;
+}
+
 safe_VkShaderModuleCreateInfo::~safe_VkShaderModuleCreateInfo()
 {
     if (pCode)
-        delete[] reinterpret_cast<const uint8_t *>(pCode);
+        vl_safe_delete_array(reinterpret_cast<const uint8_t *>(pCode));
 }
 
 void safe_VkShaderModuleCreateInfo::initialize(const VkShaderModuleCreateInfo* in_struct)
@@ -1932,7 +2221,7 @@ void safe_VkShaderModuleCreateInfo::initialize(const VkShaderModuleCreateInfo* i
     codeSize = in_struct->codeSize;
     pCode = nullptr;
     if (in_struct->pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(vl_safe_new_array<uint8_t>(codeSize));
         memcpy((void *)pCode, (void *)in_struct->pCode, codeSize);
     }
 }
@@ -1945,7 +2234,7 @@ void safe_VkShaderModuleCreateInfo::initialize(const safe_VkShaderModuleCreateIn
     codeSize = src->codeSize;
     pCode = nullptr;
     if (src->pCode) {
-        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);
+        pCode = reinterpret_cast<uint32_t *>(vl_safe_new_array<uint8_t>(codeSize));
         memcpy((void *)pCode, (void *)src->pCode, codeSize);
     }
 }
@@ -1985,6 +2274,23 @@ safe_VkPipelineCacheCreateInfo& safe_VkPipelineCacheCreateInfo::operator=(const
     return *this;
 }
 
+safe_VkPipelineCacheCreateInfo::safe_VkPipelineCacheCreateInfo(safe_VkPipelineCacheCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCacheCreateInfo));
+    new (&src) safe_VkPipelineCacheCreateInfo();
+}
+
+safe_VkPipelineCacheCreateInfo& safe_VkPipelineCacheCreateInfo::operator=(safe_VkPipelineCacheCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineCacheCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCacheCreateInfo));
+    new (&src) safe_VkPipelineCacheCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineCacheCreateInfo::~safe_VkPipelineCacheCreateInfo()
 {
 }
@@ -2014,7 +2320,7 @@ safe_VkSpecializationInfo::safe_VkSpecializationInfo(const VkSpecializationInfo*
     pData(in_struct->pData)
 {
     if (in_struct->pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[in_struct->mapEntryCount];
+        pMapEntries = vl_safe_new_array<VkSpecializationMapEntry>(in_struct->mapEntryCount);
         memcpy ((void *)pMapEntries, (void *)in_struct->pMapEntries, sizeof(VkSpecializationMapEntry)*in_struct->mapEntryCount);
     }
 }
@@ -2030,7 +2336,7 @@ safe_VkSpecializationInfo::safe_VkSpecializationInfo(const safe_VkSpecialization
     dataSize = src.dataSize;
     pData = src.pData;
     if (src.pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[src.mapEntryCount];
+        pMapEntries = vl_safe_new_array<VkSpecializationMapEntry>(src.mapEntryCount);
         memcpy ((void *)pMapEntries, (void *)src.pMapEntries, sizeof(VkSpecializationMapEntry)*src.mapEntryCount);
     }
 }
@@ -2040,24 +2346,41 @@ safe_VkSpecializationInfo& safe_VkSpecializationInfo::operator=(const safe_VkSpe
     if (&src == this) return *this;
 
     if (pMapEntries)
-        delete[] pMapEntries;
+        vl_safe_delete_array(pMapEntries);
 
     mapEntryCount = src.mapEntryCount;
     pMapEntries = nullptr;
     dataSize = src.dataSize;
     pData = src.pData;
     if (src.pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[src.mapEntryCount];
+        pMapEntries = vl_safe_new_array<VkSpecializationMapEntry>(src.mapEntryCount);
         memcpy ((void *)pMapEntries, (void *)src.pMapEntries, sizeof(VkSpecializationMapEntry)*src.mapEntryCount);
     }
 
     return *this;
 }
 
-safe_VkSpecializationInfo::~safe_VkSpecializationInfo()
+safe_VkSpecializationInfo::safe_VkSpecializationInfo(safe_VkSpecializationInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSpecializationInfo));
+    new (&src) safe_VkSpecializationInfo();
+}
+
+safe_VkSpecializationInfo& safe_VkSpecializationInfo::operator=(safe_VkSpecializationInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSpecializationInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSpecializationInfo));
+    new (&src) safe_VkSpecializationInfo();
+
+    return *this;
+}
+
+safe_VkSpecializationInfo::~safe_VkSpecializationInfo()
 {
     if (pMapEntries)
-        delete[] pMapEntries;
+        vl_safe_delete_array(pMapEntries);
 }
 
 void safe_VkSpecializationInfo::initialize(const VkSpecializationInfo* in_struct)
@@ -2067,7 +2390,7 @@ void safe_VkSpecializationInfo::initialize(const VkSpecializationInfo* in_struct
     dataSize = in_struct->dataSize;
     pData = in_struct->pData;
     if (in_struct->pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[in_struct->mapEntryCount];
+        pMapEntries = vl_safe_new_array<VkSpecializationMapEntry>(in_struct->mapEntryCount);
         memcpy ((void *)pMapEntries, (void *)in_struct->pMapEntries, sizeof(VkSpecializationMapEntry)*in_struct->mapEntryCount);
     }
 }
@@ -2079,7 +2402,7 @@ void safe_VkSpecializationInfo::initialize(const safe_VkSpecializationInfo* src)
     dataSize = src->dataSize;
     pData = src->pData;
     if (src->pMapEntries) {
-        pMapEntries = new VkSpecializationMapEntry[src->mapEntryCount];
+        pMapEntries = vl_safe_new_array<VkSpecializationMapEntry>(src->mapEntryCount);
         memcpy ((void *)pMapEntries, (void *)src->pMapEntries, sizeof(VkSpecializationMapEntry)*src->mapEntryCount);
     }
 }
@@ -2093,7 +2416,7 @@ safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo(const
     pName(in_struct->pName)
 {
     if (in_struct->pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(in_struct->pSpecializationInfo);
+        pSpecializationInfo = vl_safe_new<safe_VkSpecializationInfo>(in_struct->pSpecializationInfo);
     else
         pSpecializationInfo = NULL;
 }
@@ -2110,7 +2433,7 @@ safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo(const
     module = src.module;
     pName = src.pName;
     if (src.pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(*src.pSpecializationInfo);
+        pSpecializationInfo = vl_safe_new<safe_VkSpecializationInfo>(*src.pSpecializationInfo);
     else
         pSpecializationInfo = NULL;
 }
@@ -2120,7 +2443,7 @@ safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::oper
     if (&src == this) return *this;
 
     if (pSpecializationInfo)
-        delete pSpecializationInfo;
+        vl_safe_delete(pSpecializationInfo);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -2129,17 +2452,34 @@ safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::oper
     module = src.module;
     pName = src.pName;
     if (src.pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(*src.pSpecializationInfo);
+        pSpecializationInfo = vl_safe_new<safe_VkSpecializationInfo>(*src.pSpecializationInfo);
     else
         pSpecializationInfo = NULL;
 
     return *this;
 }
 
+safe_VkPipelineShaderStageCreateInfo::safe_VkPipelineShaderStageCreateInfo(safe_VkPipelineShaderStageCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineShaderStageCreateInfo));
+    new (&src) safe_VkPipelineShaderStageCreateInfo();
+}
+
+safe_VkPipelineShaderStageCreateInfo& safe_VkPipelineShaderStageCreateInfo::operator=(safe_VkPipelineShaderStageCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineShaderStageCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineShaderStageCreateInfo));
+    new (&src) safe_VkPipelineShaderStageCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineShaderStageCreateInfo::~safe_VkPipelineShaderStageCreateInfo()
 {
     if (pSpecializationInfo)
-        delete pSpecializationInfo;
+        vl_safe_delete(pSpecializationInfo);
 }
 
 void safe_VkPipelineShaderStageCreateInfo::initialize(const VkPipelineShaderStageCreateInfo* in_struct)
@@ -2151,7 +2491,7 @@ void safe_VkPipelineShaderStageCreateInfo::initialize(const VkPipelineShaderStag
     module = in_struct->module;
     pName = in_struct->pName;
     if (in_struct->pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(in_struct->pSpecializationInfo);
+        pSpecializationInfo = vl_safe_new<safe_VkSpecializationInfo>(in_struct->pSpecializationInfo);
     else
         pSpecializationInfo = NULL;
 }
@@ -2165,7 +2505,7 @@ void safe_VkPipelineShaderStageCreateInfo::initialize(const safe_VkPipelineShade
     module = src->module;
     pName = src->pName;
     if (src->pSpecializationInfo)
-        pSpecializationInfo = new safe_VkSpecializationInfo(*src->pSpecializationInfo);
+        pSpecializationInfo = vl_safe_new<safe_VkSpecializationInfo>(*src->pSpecializationInfo);
     else
         pSpecializationInfo = NULL;
 }
@@ -2180,11 +2520,11 @@ safe_VkPipelineVertexInputStateCreateInfo::safe_VkPipelineVertexInputStateCreate
     pVertexAttributeDescriptions(nullptr)
 {
     if (in_struct->pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[in_struct->vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = vl_safe_new_array<VkVertexInputBindingDescription>(in_struct->vertexBindingDescriptionCount);
         memcpy ((void *)pVertexBindingDescriptions, (void *)in_struct->pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*in_struct->vertexBindingDescriptionCount);
     }
     if (in_struct->pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[in_struct->vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = vl_safe_new_array<VkVertexInputAttributeDescription>(in_struct->vertexAttributeDescriptionCount);
         memcpy ((void *)pVertexAttributeDescriptions, (void *)in_struct->pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*in_struct->vertexAttributeDescriptionCount);
     }
 }
@@ -2204,11 +2544,11 @@ safe_VkPipelineVertexInputStateCreateInfo::safe_VkPipelineVertexInputStateCreate
     vertexAttributeDescriptionCount = src.vertexAttributeDescriptionCount;
     pVertexAttributeDescriptions = nullptr;
     if (src.pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[src.vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = vl_safe_new_array<VkVertexInputBindingDescription>(src.vertexBindingDescriptionCount);
         memcpy ((void *)pVertexBindingDescriptions, (void *)src.pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*src.vertexBindingDescriptionCount);
     }
     if (src.pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[src.vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = vl_safe_new_array<VkVertexInputAttributeDescription>(src.vertexAttributeDescriptionCount);
         memcpy ((void *)pVertexAttributeDescriptions, (void *)src.pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*src.vertexAttributeDescriptionCount);
     }
 }
@@ -2218,9 +2558,9 @@ safe_VkPipelineVertexInputStateCreateInfo& safe_VkPipelineVertexInputStateCreate
     if (&src == this) return *this;
 
     if (pVertexBindingDescriptions)
-        delete[] pVertexBindingDescriptions;
+        vl_safe_delete_array(pVertexBindingDescriptions);
     if (pVertexAttributeDescriptions)
-        delete[] pVertexAttributeDescriptions;
+        vl_safe_delete_array(pVertexAttributeDescriptions);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -2230,23 +2570,40 @@ safe_VkPipelineVertexInputStateCreateInfo& safe_VkPipelineVertexInputStateCreate
     vertexAttributeDescriptionCount = src.vertexAttributeDescriptionCount;
     pVertexAttributeDescriptions = nullptr;
     if (src.pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[src.vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = vl_safe_new_array<VkVertexInputBindingDescription>(src.vertexBindingDescriptionCount);
         memcpy ((void *)pVertexBindingDescriptions, (void *)src.pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*src.vertexBindingDescriptionCount);
     }
     if (src.pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[src.vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = vl_safe_new_array<VkVertexInputAttributeDescription>(src.vertexAttributeDescriptionCount);
         memcpy ((void *)pVertexAttributeDescriptions, (void *)src.pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*src.vertexAttributeDescriptionCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineVertexInputStateCreateInfo::safe_VkPipelineVertexInputStateCreateInfo(safe_VkPipelineVertexInputStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineVertexInputStateCreateInfo));
+    new (&src) safe_VkPipelineVertexInputStateCreateInfo();
+}
+
+safe_VkPipelineVertexInputStateCreateInfo& safe_VkPipelineVertexInputStateCreateInfo::operator=(safe_VkPipelineVertexInputStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineVertexInputStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineVertexInputStateCreateInfo));
+    new (&src) safe_VkPipelineVertexInputStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineVertexInputStateCreateInfo::~safe_VkPipelineVertexInputStateCreateInfo()
 {
     if (pVertexBindingDescriptions)
-        delete[] pVertexBindingDescriptions;
+        vl_safe_delete_array(pVertexBindingDescriptions);
     if (pVertexAttributeDescriptions)
-        delete[] pVertexAttributeDescriptions;
+        vl_safe_delete_array(pVertexAttributeDescriptions);
 }
 
 void safe_VkPipelineVertexInputStateCreateInfo::initialize(const VkPipelineVertexInputStateCreateInfo* in_struct)
@@ -2259,11 +2616,11 @@ void safe_VkPipelineVertexInputStateCreateInfo::initialize(const VkPipelineVerte
     vertexAttributeDescriptionCount = in_struct->vertexAttributeDescriptionCount;
     pVertexAttributeDescriptions = nullptr;
     if (in_struct->pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[in_struct->vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = vl_safe_new_array<VkVertexInputBindingDescription>(in_struct->vertexBindingDescriptionCount);
         memcpy ((void *)pVertexBindingDescriptions, (void *)in_struct->pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*in_struct->vertexBindingDescriptionCount);
     }
     if (in_struct->pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[in_struct->vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = vl_safe_new_array<VkVertexInputAttributeDescription>(in_struct->vertexAttributeDescriptionCount);
         memcpy ((void *)pVertexAttributeDescriptions, (void *)in_struct->pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*in_struct->vertexAttributeDescriptionCount);
     }
 }
@@ -2278,11 +2635,11 @@ void safe_VkPipelineVertexInputStateCreateInfo::initialize(const safe_VkPipeline
     vertexAttributeDescriptionCount = src->vertexAttributeDescriptionCount;
     pVertexAttributeDescriptions = nullptr;
     if (src->pVertexBindingDescriptions) {
-        pVertexBindingDescriptions = new VkVertexInputBindingDescription[src->vertexBindingDescriptionCount];
+        pVertexBindingDescriptions = vl_safe_new_array<VkVertexInputBindingDescription>(src->vertexBindingDescriptionCount);
         memcpy ((void *)pVertexBindingDescriptions, (void *)src->pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription)*src->vertexBindingDescriptionCount);
     }
     if (src->pVertexAttributeDescriptions) {
-        pVertexAttributeDescriptions = new VkVertexInputAttributeDescription[src->vertexAttributeDescriptionCount];
+        pVertexAttributeDescriptions = vl_safe_new_array<VkVertexInputAttributeDescription>(src->vertexAttributeDescriptionCount);
         memcpy ((void *)pVertexAttributeDescriptions, (void *)src->pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription)*src->vertexAttributeDescriptionCount);
     }
 }
@@ -2322,6 +2679,23 @@ safe_VkPipelineInputAssemblyStateCreateInfo& safe_VkPipelineInputAssemblyStateCr
     return *this;
 }
 
+safe_VkPipelineInputAssemblyStateCreateInfo::safe_VkPipelineInputAssemblyStateCreateInfo(safe_VkPipelineInputAssemblyStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineInputAssemblyStateCreateInfo));
+    new (&src) safe_VkPipelineInputAssemblyStateCreateInfo();
+}
+
+safe_VkPipelineInputAssemblyStateCreateInfo& safe_VkPipelineInputAssemblyStateCreateInfo::operator=(safe_VkPipelineInputAssemblyStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineInputAssemblyStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineInputAssemblyStateCreateInfo));
+    new (&src) safe_VkPipelineInputAssemblyStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineInputAssemblyStateCreateInfo::~safe_VkPipelineInputAssemblyStateCreateInfo()
 {
 }
@@ -2376,6 +2750,23 @@ safe_VkPipelineTessellationStateCreateInfo& safe_VkPipelineTessellationStateCrea
     return *this;
 }
 
+safe_VkPipelineTessellationStateCreateInfo::safe_VkPipelineTessellationStateCreateInfo(safe_VkPipelineTessellationStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineTessellationStateCreateInfo));
+    new (&src) safe_VkPipelineTessellationStateCreateInfo();
+}
+
+safe_VkPipelineTessellationStateCreateInfo& safe_VkPipelineTessellationStateCreateInfo::operator=(safe_VkPipelineTessellationStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineTessellationStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineTessellationStateCreateInfo));
+    new (&src) safe_VkPipelineTessellationStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineTessellationStateCreateInfo::~safe_VkPipelineTessellationStateCreateInfo()
 {
 }
@@ -2406,13 +2797,13 @@ safe_VkPipelineViewportStateCreateInfo::safe_VkPipelineViewportStateCreateInfo(c
     pScissors(nullptr)
 {
     if (in_struct->pViewports && !is_dynamic_viewports) {
-        pViewports = new VkViewport[in_struct->viewportCount];
+        pViewports = vl_safe_new_array<VkViewport>(in_struct->viewportCount);
         memcpy ((void *)pViewports, (void *)in_struct->pViewports, sizeof(VkViewport)*in_struct->viewportCount);
     }
     else
         pViewports = NULL;
     if (in_struct->pScissors && !is_dynamic_scissors) {
-        pScissors = new VkRect2D[in_struct->scissorCount];
+        pScissors = vl_safe_new_array<VkRect2D>(in_struct->scissorCount);
         memcpy ((void *)pScissors, (void *)in_struct->pScissors, sizeof(VkRect2D)*in_struct->scissorCount);
     }
     else
@@ -2434,13 +2825,13 @@ safe_VkPipelineViewportStateCreateInfo::safe_VkPipelineViewportStateCreateInfo(c
     scissorCount = src.scissorCount;
     pScissors = nullptr;
     if (src.pViewports) {
-        pViewports = new VkViewport[src.viewportCount];
+        pViewports = vl_safe_new_array<VkViewport>(src.viewportCount);
         memcpy ((void *)pViewports, (void *)src.pViewports, sizeof(VkViewport)*src.viewportCount);
     }
     else
         pViewports = NULL;
     if (src.pScissors) {
-        pScissors = new VkRect2D[src.scissorCount];
+        pScissors = vl_safe_new_array<VkRect2D>(src.scissorCount);
         memcpy ((void *)pScissors, (void *)src.pScissors, sizeof(VkRect2D)*src.scissorCount);
     }
     else
@@ -2452,9 +2843,9 @@ safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::
     if (&src == this) return *this;
 
     if (pViewports)
-        delete[] pViewports;
+        vl_safe_delete_array(pViewports);
     if (pScissors)
-        delete[] pScissors;
+        vl_safe_delete_array(pScissors);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -2464,13 +2855,13 @@ safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::
     scissorCount = src.scissorCount;
     pScissors = nullptr;
     if (src.pViewports) {
-        pViewports = new VkViewport[src.viewportCount];
+        pViewports = vl_safe_new_array<VkViewport>(src.viewportCount);
         memcpy ((void *)pViewports, (void *)src.pViewports, sizeof(VkViewport)*src.viewportCount);
     }
     else
         pViewports = NULL;
     if (src.pScissors) {
-        pScissors = new VkRect2D[src.scissorCount];
+        pScissors = vl_safe_new_array<VkRect2D>(src.scissorCount);
         memcpy ((void *)pScissors, (void *)src.pScissors, sizeof(VkRect2D)*src.scissorCount);
     }
     else
@@ -2479,12 +2870,29 @@ safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::
     return *this;
 }
 
+safe_VkPipelineViewportStateCreateInfo::safe_VkPipelineViewportStateCreateInfo(safe_VkPipelineViewportStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportStateCreateInfo));
+    new (&src) safe_VkPipelineViewportStateCreateInfo();
+}
+
+safe_VkPipelineViewportStateCreateInfo& safe_VkPipelineViewportStateCreateInfo::operator=(safe_VkPipelineViewportStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineViewportStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportStateCreateInfo));
+    new (&src) safe_VkPipelineViewportStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineViewportStateCreateInfo::~safe_VkPipelineViewportStateCreateInfo()
 {
     if (pViewports)
-        delete[] pViewports;
+        vl_safe_delete_array(pViewports);
     if (pScissors)
-        delete[] pScissors;
+        vl_safe_delete_array(pScissors);
 }
 
 void safe_VkPipelineViewportStateCreateInfo::initialize(const VkPipelineViewportStateCreateInfo* in_struct, const bool is_dynamic_viewports, const bool is_dynamic_scissors)
@@ -2497,13 +2905,13 @@ void safe_VkPipelineViewportStateCreateInfo::initialize(const VkPipelineViewport
     scissorCount = in_struct->scissorCount;
     pScissors = nullptr;
     if (in_struct->pViewports && !is_dynamic_viewports) {
-        pViewports = new VkViewport[in_struct->viewportCount];
+        pViewports = vl_safe_new_array<VkViewport>(in_struct->viewportCount);
         memcpy ((void *)pViewports, (void *)in_struct->pViewports, sizeof(VkViewport)*in_struct->viewportCount);
     }
     else
         pViewports = NULL;
     if (in_struct->pScissors && !is_dynamic_scissors) {
-        pScissors = new VkRect2D[in_struct->scissorCount];
+        pScissors = vl_safe_new_array<VkRect2D>(in_struct->scissorCount);
         memcpy ((void *)pScissors, (void *)in_struct->pScissors, sizeof(VkRect2D)*in_struct->scissorCount);
     }
     else
@@ -2520,13 +2928,13 @@ void safe_VkPipelineViewportStateCreateInfo::initialize(const safe_VkPipelineVie
     scissorCount = src->scissorCount;
     pScissors = nullptr;
     if (src->pViewports) {
-        pViewports = new VkViewport[src->viewportCount];
+        pViewports = vl_safe_new_array<VkViewport>(src->viewportCount);
         memcpy ((void *)pViewports, (void *)src->pViewports, sizeof(VkViewport)*src->viewportCount);
     }
     else
         pViewports = NULL;
     if (src->pScissors) {
-        pScissors = new VkRect2D[src->scissorCount];
+        pScissors = vl_safe_new_array<VkRect2D>(src->scissorCount);
         memcpy ((void *)pScissors, (void *)src->pScissors, sizeof(VkRect2D)*src->scissorCount);
     }
     else
@@ -2592,6 +3000,23 @@ safe_VkPipelineRasterizationStateCreateInfo& safe_VkPipelineRasterizationStateCr
     return *this;
 }
 
+safe_VkPipelineRasterizationStateCreateInfo::safe_VkPipelineRasterizationStateCreateInfo(safe_VkPipelineRasterizationStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationStateCreateInfo));
+    new (&src) safe_VkPipelineRasterizationStateCreateInfo();
+}
+
+safe_VkPipelineRasterizationStateCreateInfo& safe_VkPipelineRasterizationStateCreateInfo::operator=(safe_VkPipelineRasterizationStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineRasterizationStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationStateCreateInfo));
+    new (&src) safe_VkPipelineRasterizationStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationStateCreateInfo::~safe_VkPipelineRasterizationStateCreateInfo()
 {
 }
@@ -2642,7 +3067,7 @@ safe_VkPipelineMultisampleStateCreateInfo::safe_VkPipelineMultisampleStateCreate
     alphaToOneEnable(in_struct->alphaToOneEnable)
 {
     if (in_struct->pSampleMask) {
-        pSampleMask = new VkSampleMask(*in_struct->pSampleMask);
+        pSampleMask = vl_safe_new<VkSampleMask>(*in_struct->pSampleMask);
     }
 }
 
@@ -2662,7 +3087,7 @@ safe_VkPipelineMultisampleStateCreateInfo::safe_VkPipelineMultisampleStateCreate
     alphaToCoverageEnable = src.alphaToCoverageEnable;
     alphaToOneEnable = src.alphaToOneEnable;
     if (src.pSampleMask) {
-        pSampleMask = new VkSampleMask(*src.pSampleMask);
+        pSampleMask = vl_safe_new<VkSampleMask>(*src.pSampleMask);
     }
 }
 
@@ -2671,7 +3096,7 @@ safe_VkPipelineMultisampleStateCreateInfo& safe_VkPipelineMultisampleStateCreate
     if (&src == this) return *this;
 
     if (pSampleMask)
-        delete pSampleMask;
+        vl_safe_delete(pSampleMask);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -2683,16 +3108,33 @@ safe_VkPipelineMultisampleStateCreateInfo& safe_VkPipelineMultisampleStateCreate
     alphaToCoverageEnable = src.alphaToCoverageEnable;
     alphaToOneEnable = src.alphaToOneEnable;
     if (src.pSampleMask) {
-        pSampleMask = new VkSampleMask(*src.pSampleMask);
+        pSampleMask = vl_safe_new<VkSampleMask>(*src.pSampleMask);
     }
 
     return *this;
 }
 
+safe_VkPipelineMultisampleStateCreateInfo::safe_VkPipelineMultisampleStateCreateInfo(safe_VkPipelineMultisampleStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineMultisampleStateCreateInfo));
+    new (&src) safe_VkPipelineMultisampleStateCreateInfo();
+}
+
+safe_VkPipelineMultisampleStateCreateInfo& safe_VkPipelineMultisampleStateCreateInfo::operator=(safe_VkPipelineMultisampleStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineMultisampleStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineMultisampleStateCreateInfo));
+    new (&src) safe_VkPipelineMultisampleStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineMultisampleStateCreateInfo::~safe_VkPipelineMultisampleStateCreateInfo()
 {
     if (pSampleMask)
-        delete pSampleMask;
+        vl_safe_delete(pSampleMask);
 }
 
 void safe_VkPipelineMultisampleStateCreateInfo::initialize(const VkPipelineMultisampleStateCreateInfo* in_struct)
@@ -2707,7 +3149,7 @@ void safe_VkPipelineMultisampleStateCreateInfo::initialize(const VkPipelineMulti
     alphaToCoverageEnable = in_struct->alphaToCoverageEnable;
     alphaToOneEnable = in_struct->alphaToOneEnable;
     if (in_struct->pSampleMask) {
-        pSampleMask = new VkSampleMask(*in_struct->pSampleMask);
+        pSampleMask = vl_safe_new<VkSampleMask>(*in_struct->pSampleMask);
     }
 }
 
@@ -2723,7 +3165,7 @@ void safe_VkPipelineMultisampleStateCreateInfo::initialize(const safe_VkPipeline
     alphaToCoverageEnable = src->alphaToCoverageEnable;
     alphaToOneEnable = src->alphaToOneEnable;
     if (src->pSampleMask) {
-        pSampleMask = new VkSampleMask(*src->pSampleMask);
+        pSampleMask = vl_safe_new<VkSampleMask>(*src->pSampleMask);
     }
 }
 
@@ -2783,6 +3225,23 @@ safe_VkPipelineDepthStencilStateCreateInfo& safe_VkPipelineDepthStencilStateCrea
     return *this;
 }
 
+safe_VkPipelineDepthStencilStateCreateInfo::safe_VkPipelineDepthStencilStateCreateInfo(safe_VkPipelineDepthStencilStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineDepthStencilStateCreateInfo));
+    new (&src) safe_VkPipelineDepthStencilStateCreateInfo();
+}
+
+safe_VkPipelineDepthStencilStateCreateInfo& safe_VkPipelineDepthStencilStateCreateInfo::operator=(safe_VkPipelineDepthStencilStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineDepthStencilStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineDepthStencilStateCreateInfo));
+    new (&src) safe_VkPipelineDepthStencilStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineDepthStencilStateCreateInfo::~safe_VkPipelineDepthStencilStateCreateInfo()
 {
 }
@@ -2829,12 +3288,10 @@ safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateIn
     pAttachments(nullptr)
 {
     if (in_struct->pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[in_struct->attachmentCount];
+        pAttachments = vl_safe_new_array<VkPipelineColorBlendAttachmentState>(in_struct->attachmentCount);
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*in_struct->attachmentCount);
     }
-    for (uint32_t i=0; i<4; ++i) {
-        blendConstants[i] = in_struct->blendConstants[i];
-    }
+    memcpy (blendConstants, in_struct->blendConstants, sizeof(blendConstants));
 }
 
 safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateInfo() :
@@ -2851,12 +3308,10 @@ safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateIn
     attachmentCount = src.attachmentCount;
     pAttachments = nullptr;
     if (src.pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[src.attachmentCount];
+        pAttachments = vl_safe_new_array<VkPipelineColorBlendAttachmentState>(src.attachmentCount);
         memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*src.attachmentCount);
     }
-    for (uint32_t i=0; i<4; ++i) {
-        blendConstants[i] = src.blendConstants[i];
-    }
+    memcpy (blendConstants, src.blendConstants, sizeof(blendConstants));
 }
 
 safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateInfo::operator=(const safe_VkPipelineColorBlendStateCreateInfo& src)
@@ -2864,7 +3319,7 @@ safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateIn
     if (&src == this) return *this;
 
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -2874,12 +3329,27 @@ safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateIn
     attachmentCount = src.attachmentCount;
     pAttachments = nullptr;
     if (src.pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[src.attachmentCount];
+        pAttachments = vl_safe_new_array<VkPipelineColorBlendAttachmentState>(src.attachmentCount);
         memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*src.attachmentCount);
     }
-    for (uint32_t i=0; i<4; ++i) {
-        blendConstants[i] = src.blendConstants[i];
-    }
+    memcpy (blendConstants, src.blendConstants, sizeof(blendConstants));
+
+    return *this;
+}
+
+safe_VkPipelineColorBlendStateCreateInfo::safe_VkPipelineColorBlendStateCreateInfo(safe_VkPipelineColorBlendStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineColorBlendStateCreateInfo));
+    new (&src) safe_VkPipelineColorBlendStateCreateInfo();
+}
+
+safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateInfo::operator=(safe_VkPipelineColorBlendStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineColorBlendStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineColorBlendStateCreateInfo));
+    new (&src) safe_VkPipelineColorBlendStateCreateInfo();
 
     return *this;
 }
@@ -2887,7 +3357,7 @@ safe_VkPipelineColorBlendStateCreateInfo& safe_VkPipelineColorBlendStateCreateIn
 safe_VkPipelineColorBlendStateCreateInfo::~safe_VkPipelineColorBlendStateCreateInfo()
 {
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
 }
 
 void safe_VkPipelineColorBlendStateCreateInfo::initialize(const VkPipelineColorBlendStateCreateInfo* in_struct)
@@ -2900,12 +3370,10 @@ void safe_VkPipelineColorBlendStateCreateInfo::initialize(const VkPipelineColorB
     attachmentCount = in_struct->attachmentCount;
     pAttachments = nullptr;
     if (in_struct->pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[in_struct->attachmentCount];
+        pAttachments = vl_safe_new_array<VkPipelineColorBlendAttachmentState>(in_struct->attachmentCount);
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*in_struct->attachmentCount);
     }
-    for (uint32_t i=0; i<4; ++i) {
-        blendConstants[i] = in_struct->blendConstants[i];
-    }
+    memcpy (blendConstants, in_struct->blendConstants, sizeof(blendConstants));
 }
 
 void safe_VkPipelineColorBlendStateCreateInfo::initialize(const safe_VkPipelineColorBlendStateCreateInfo* src)
@@ -2918,12 +3386,10 @@ void safe_VkPipelineColorBlendStateCreateInfo::initialize(const safe_VkPipelineC
     attachmentCount = src->attachmentCount;
     pAttachments = nullptr;
     if (src->pAttachments) {
-        pAttachments = new VkPipelineColorBlendAttachmentState[src->attachmentCount];
+        pAttachments = vl_safe_new_array<VkPipelineColorBlendAttachmentState>(src->attachmentCount);
         memcpy ((void *)pAttachments, (void *)src->pAttachments, sizeof(VkPipelineColorBlendAttachmentState)*src->attachmentCount);
     }
-    for (uint32_t i=0; i<4; ++i) {
-        blendConstants[i] = src->blendConstants[i];
-    }
+    memcpy (blendConstants, src->blendConstants, sizeof(blendConstants));
 }
 
 safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(const VkPipelineDynamicStateCreateInfo* in_struct) :
@@ -2934,7 +3400,7 @@ safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(con
     pDynamicStates(nullptr)
 {
     if (in_struct->pDynamicStates) {
-        pDynamicStates = new VkDynamicState[in_struct->dynamicStateCount];
+        pDynamicStates = vl_safe_new_array<VkDynamicState>(in_struct->dynamicStateCount);
         memcpy ((void *)pDynamicStates, (void *)in_struct->pDynamicStates, sizeof(VkDynamicState)*in_struct->dynamicStateCount);
     }
 }
@@ -2951,7 +3417,7 @@ safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(con
     dynamicStateCount = src.dynamicStateCount;
     pDynamicStates = nullptr;
     if (src.pDynamicStates) {
-        pDynamicStates = new VkDynamicState[src.dynamicStateCount];
+        pDynamicStates = vl_safe_new_array<VkDynamicState>(src.dynamicStateCount);
         memcpy ((void *)pDynamicStates, (void *)src.pDynamicStates, sizeof(VkDynamicState)*src.dynamicStateCount);
     }
 }
@@ -2961,7 +3427,7 @@ safe_VkPipelineDynamicStateCreateInfo& safe_VkPipelineDynamicStateCreateInfo::op
     if (&src == this) return *this;
 
     if (pDynamicStates)
-        delete[] pDynamicStates;
+        vl_safe_delete_array(pDynamicStates);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -2969,17 +3435,34 @@ safe_VkPipelineDynamicStateCreateInfo& safe_VkPipelineDynamicStateCreateInfo::op
     dynamicStateCount = src.dynamicStateCount;
     pDynamicStates = nullptr;
     if (src.pDynamicStates) {
-        pDynamicStates = new VkDynamicState[src.dynamicStateCount];
+        pDynamicStates = vl_safe_new_array<VkDynamicState>(src.dynamicStateCount);
         memcpy ((void *)pDynamicStates, (void *)src.pDynamicStates, sizeof(VkDynamicState)*src.dynamicStateCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineDynamicStateCreateInfo::safe_VkPipelineDynamicStateCreateInfo(safe_VkPipelineDynamicStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineDynamicStateCreateInfo));
+    new (&src) safe_VkPipelineDynamicStateCreateInfo();
+}
+
+safe_VkPipelineDynamicStateCreateInfo& safe_VkPipelineDynamicStateCreateInfo::operator=(safe_VkPipelineDynamicStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineDynamicStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineDynamicStateCreateInfo));
+    new (&src) safe_VkPipelineDynamicStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineDynamicStateCreateInfo::~safe_VkPipelineDynamicStateCreateInfo()
 {
     if (pDynamicStates)
-        delete[] pDynamicStates;
+        vl_safe_delete_array(pDynamicStates);
 }
 
 void safe_VkPipelineDynamicStateCreateInfo::initialize(const VkPipelineDynamicStateCreateInfo* in_struct)
@@ -2990,7 +3473,7 @@ void safe_VkPipelineDynamicStateCreateInfo::initialize(const VkPipelineDynamicSt
     dynamicStateCount = in_struct->dynamicStateCount;
     pDynamicStates = nullptr;
     if (in_struct->pDynamicStates) {
-        pDynamicStates = new VkDynamicState[in_struct->dynamicStateCount];
+        pDynamicStates = vl_safe_new_array<VkDynamicState>(in_struct->dynamicStateCount);
         memcpy ((void *)pDynamicStates, (void *)in_struct->pDynamicStates, sizeof(VkDynamicState)*in_struct->dynamicStateCount);
     }
 }
@@ -3003,7 +3486,7 @@ void safe_VkPipelineDynamicStateCreateInfo::initialize(const safe_VkPipelineDyna
     dynamicStateCount = src->dynamicStateCount;
     pDynamicStates = nullptr;
     if (src->pDynamicStates) {
-        pDynamicStates = new VkDynamicState[src->dynamicStateCount];
+        pDynamicStates = vl_safe_new_array<VkDynamicState>(src->dynamicStateCount);
         memcpy ((void *)pDynamicStates, (void *)src->pDynamicStates, sizeof(VkDynamicState)*src->dynamicStateCount);
     }
 }
@@ -3021,17 +3504,17 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const VkGra
     basePipelineIndex(in_struct->basePipelineIndex)
 {
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (in_struct->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
+        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(in_struct->pVertexInputState);
     else
         pVertexInputState = NULL;
     if (in_struct->pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);
+        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(in_struct->pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -3040,7 +3523,7 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const VkGra
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (in_struct->pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
+        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(in_struct->pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool has_rasterization = in_struct->pRasterizationState ? !in_struct->pRasterizationState->rasterizerDiscardEnable : false;
@@ -3055,29 +3538,29 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const VkGra
                 if (in_struct->pDynamicState->pDynamicStates[i] == VK_DYNAMIC_STATE_SCISSOR)
                     is_dynamic_scissors = true;
         }
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
+        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (in_struct->pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);
+        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(in_struct->pRasterizationState);
     else
         pRasterizationState = NULL;
     if (in_struct->pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);
+        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(in_struct->pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     // needs a tracked subpass state uses_depthstencil_attachment
     if (in_struct->pDepthStencilState && has_rasterization && uses_depthstencil_attachment)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);
+        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(in_struct->pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     // needs a tracked subpass state usesColorAttachment
     if (in_struct->pColorBlendState && has_rasterization && uses_color_attachment)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);
+        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(in_struct->pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (in_struct->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
+        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(in_struct->pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -3099,17 +3582,17 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const safe_
     basePipelineHandle = src.basePipelineHandle;
     basePipelineIndex = src.basePipelineIndex;
     if (stageCount && src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&src.pStages[i]);
         }
     }
     if (src.pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*src.pVertexInputState);
+        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(*src.pVertexInputState);
     else
         pVertexInputState = NULL;
     if (src.pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*src.pInputAssemblyState);
+        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(*src.pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -3118,32 +3601,32 @@ safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(const safe_
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (src.pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*src.pTessellationState);
+        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(*src.pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool has_rasterization = src.pRasterizationState ? !src.pRasterizationState->rasterizerDiscardEnable : false;
     if (src.pViewportState && has_rasterization) {
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*src.pViewportState);
+        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(*src.pViewportState);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (src.pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*src.pRasterizationState);
+        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(*src.pRasterizationState);
     else
         pRasterizationState = NULL;
     if (src.pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*src.pMultisampleState);
+        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(*src.pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     if (src.pDepthStencilState && has_rasterization)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*src.pDepthStencilState);
+        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(*src.pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     if (src.pColorBlendState && has_rasterization)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*src.pColorBlendState);
+        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(*src.pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (src.pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*src.pDynamicState);
+        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(*src.pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -3153,25 +3636,25 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
     if (&src == this) return *this;
 
     if (pStages)
-        delete[] pStages;
+        vl_safe_delete_array(pStages);
     if (pVertexInputState)
-        delete pVertexInputState;
+        vl_safe_delete(pVertexInputState);
     if (pInputAssemblyState)
-        delete pInputAssemblyState;
+        vl_safe_delete(pInputAssemblyState);
     if (pTessellationState)
-        delete pTessellationState;
+        vl_safe_delete(pTessellationState);
     if (pViewportState)
-        delete pViewportState;
+        vl_safe_delete(pViewportState);
     if (pRasterizationState)
-        delete pRasterizationState;
+        vl_safe_delete(pRasterizationState);
     if (pMultisampleState)
-        delete pMultisampleState;
+        vl_safe_delete(pMultisampleState);
     if (pDepthStencilState)
-        delete pDepthStencilState;
+        vl_safe_delete(pDepthStencilState);
     if (pColorBlendState)
-        delete pColorBlendState;
+        vl_safe_delete(pColorBlendState);
     if (pDynamicState)
-        delete pDynamicState;
+        vl_safe_delete(pDynamicState);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -3184,17 +3667,17 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
     basePipelineHandle = src.basePipelineHandle;
     basePipelineIndex = src.basePipelineIndex;
     if (stageCount && src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&src.pStages[i]);
         }
     }
     if (src.pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*src.pVertexInputState);
+        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(*src.pVertexInputState);
     else
         pVertexInputState = NULL;
     if (src.pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*src.pInputAssemblyState);
+        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(*src.pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -3203,60 +3686,77 @@ safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (src.pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*src.pTessellationState);
+        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(*src.pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool has_rasterization = src.pRasterizationState ? !src.pRasterizationState->rasterizerDiscardEnable : false;
     if (src.pViewportState && has_rasterization) {
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*src.pViewportState);
+        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(*src.pViewportState);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (src.pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*src.pRasterizationState);
+        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(*src.pRasterizationState);
     else
         pRasterizationState = NULL;
     if (src.pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*src.pMultisampleState);
+        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(*src.pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     if (src.pDepthStencilState && has_rasterization)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*src.pDepthStencilState);
+        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(*src.pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     if (src.pColorBlendState && has_rasterization)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*src.pColorBlendState);
+        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(*src.pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (src.pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*src.pDynamicState);
+        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(*src.pDynamicState);
     else
         pDynamicState = NULL;
 
     return *this;
 }
 
+safe_VkGraphicsPipelineCreateInfo::safe_VkGraphicsPipelineCreateInfo(safe_VkGraphicsPipelineCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGraphicsPipelineCreateInfo));
+    new (&src) safe_VkGraphicsPipelineCreateInfo();
+}
+
+safe_VkGraphicsPipelineCreateInfo& safe_VkGraphicsPipelineCreateInfo::operator=(safe_VkGraphicsPipelineCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkGraphicsPipelineCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGraphicsPipelineCreateInfo));
+    new (&src) safe_VkGraphicsPipelineCreateInfo();
+
+    return *this;
+}
+
 safe_VkGraphicsPipelineCreateInfo::~safe_VkGraphicsPipelineCreateInfo()
 {
     if (pStages)
-        delete[] pStages;
+        vl_safe_delete_array(pStages);
     if (pVertexInputState)
-        delete pVertexInputState;
+        vl_safe_delete(pVertexInputState);
     if (pInputAssemblyState)
-        delete pInputAssemblyState;
+        vl_safe_delete(pInputAssemblyState);
     if (pTessellationState)
-        delete pTessellationState;
+        vl_safe_delete(pTessellationState);
     if (pViewportState)
-        delete pViewportState;
+        vl_safe_delete(pViewportState);
     if (pRasterizationState)
-        delete pRasterizationState;
+        vl_safe_delete(pRasterizationState);
     if (pMultisampleState)
-        delete pMultisampleState;
+        vl_safe_delete(pMultisampleState);
     if (pDepthStencilState)
-        delete pDepthStencilState;
+        vl_safe_delete(pDepthStencilState);
     if (pColorBlendState)
-        delete pColorBlendState;
+        vl_safe_delete(pColorBlendState);
     if (pDynamicState)
-        delete pDynamicState;
+        vl_safe_delete(pDynamicState);
 }
 
 void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreateInfo* in_struct, const bool uses_color_attachment, const bool uses_depthstencil_attachment)
@@ -3272,17 +3772,17 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreat
     basePipelineHandle = in_struct->basePipelineHandle;
     basePipelineIndex = in_struct->basePipelineIndex;
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (in_struct->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);
+        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(in_struct->pVertexInputState);
     else
         pVertexInputState = NULL;
     if (in_struct->pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);
+        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(in_struct->pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -3291,7 +3791,7 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreat
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (in_struct->pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);
+        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(in_struct->pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool has_rasterization = in_struct->pRasterizationState ? !in_struct->pRasterizationState->rasterizerDiscardEnable : false;
@@ -3306,29 +3806,29 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const VkGraphicsPipelineCreat
                 if (in_struct->pDynamicState->pDynamicStates[i] == VK_DYNAMIC_STATE_SCISSOR)
                     is_dynamic_scissors = true;
         }
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
+        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (in_struct->pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);
+        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(in_struct->pRasterizationState);
     else
         pRasterizationState = NULL;
     if (in_struct->pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);
+        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(in_struct->pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     // needs a tracked subpass state uses_depthstencil_attachment
     if (in_struct->pDepthStencilState && has_rasterization && uses_depthstencil_attachment)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);
+        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(in_struct->pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     // needs a tracked subpass state usesColorAttachment
     if (in_struct->pColorBlendState && has_rasterization && uses_color_attachment)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);
+        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(in_struct->pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (in_struct->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);
+        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(in_struct->pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -3346,17 +3846,17 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const safe_VkGraphicsPipeline
     basePipelineHandle = src->basePipelineHandle;
     basePipelineIndex = src->basePipelineIndex;
     if (stageCount && src->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&src->pStages[i]);
         }
     }
     if (src->pVertexInputState)
-        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*src->pVertexInputState);
+        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(*src->pVertexInputState);
     else
         pVertexInputState = NULL;
     if (src->pInputAssemblyState)
-        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*src->pInputAssemblyState);
+        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(*src->pInputAssemblyState);
     else
         pInputAssemblyState = NULL;
     bool has_tessellation_stage = false;
@@ -3365,32 +3865,32 @@ void safe_VkGraphicsPipelineCreateInfo::initialize(const safe_VkGraphicsPipeline
             if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)
                 has_tessellation_stage = true;
     if (src->pTessellationState && has_tessellation_stage)
-        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*src->pTessellationState);
+        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(*src->pTessellationState);
     else
         pTessellationState = NULL; // original pTessellationState pointer ignored
     bool has_rasterization = src->pRasterizationState ? !src->pRasterizationState->rasterizerDiscardEnable : false;
     if (src->pViewportState && has_rasterization) {
-        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*src->pViewportState);
+        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(*src->pViewportState);
     } else
         pViewportState = NULL; // original pViewportState pointer ignored
     if (src->pRasterizationState)
-        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*src->pRasterizationState);
+        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(*src->pRasterizationState);
     else
         pRasterizationState = NULL;
     if (src->pMultisampleState && has_rasterization)
-        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*src->pMultisampleState);
+        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(*src->pMultisampleState);
     else
         pMultisampleState = NULL; // original pMultisampleState pointer ignored
     if (src->pDepthStencilState && has_rasterization)
-        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*src->pDepthStencilState);
+        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(*src->pDepthStencilState);
     else
         pDepthStencilState = NULL; // original pDepthStencilState pointer ignored
     if (src->pColorBlendState && has_rasterization)
-        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*src->pColorBlendState);
+        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(*src->pColorBlendState);
     else
         pColorBlendState = NULL; // original pColorBlendState pointer ignored
     if (src->pDynamicState)
-        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*src->pDynamicState);
+        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(*src->pDynamicState);
     else
         pDynamicState = NULL;
 }
@@ -3436,6 +3936,23 @@ safe_VkComputePipelineCreateInfo& safe_VkComputePipelineCreateInfo::operator=(co
     return *this;
 }
 
+safe_VkComputePipelineCreateInfo::safe_VkComputePipelineCreateInfo(safe_VkComputePipelineCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkComputePipelineCreateInfo));
+    new (&src) safe_VkComputePipelineCreateInfo();
+}
+
+safe_VkComputePipelineCreateInfo& safe_VkComputePipelineCreateInfo::operator=(safe_VkComputePipelineCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkComputePipelineCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkComputePipelineCreateInfo));
+    new (&src) safe_VkComputePipelineCreateInfo();
+
+    return *this;
+}
+
 safe_VkComputePipelineCreateInfo::~safe_VkComputePipelineCreateInfo()
 {
 }
@@ -3472,13 +3989,11 @@ safe_VkPipelineLayoutCreateInfo::safe_VkPipelineLayoutCreateInfo(const VkPipelin
     pPushConstantRanges(nullptr)
 {
     if (setLayoutCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
-        for (uint32_t i=0; i<setLayoutCount; ++i) {
-            pSetLayouts[i] = in_struct->pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(setLayoutCount);
+        memcpy ((void *)pSetLayouts, (void *)in_struct->pSetLayouts, sizeof(VkDescriptorSetLayout)*setLayoutCount);
     }
     if (in_struct->pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[in_struct->pushConstantRangeCount];
+        pPushConstantRanges = vl_safe_new_array<VkPushConstantRange>(in_struct->pushConstantRangeCount);
         memcpy ((void *)pPushConstantRanges, (void *)in_struct->pPushConstantRanges, sizeof(VkPushConstantRange)*in_struct->pushConstantRangeCount);
     }
 }
@@ -3498,13 +4013,11 @@ safe_VkPipelineLayoutCreateInfo::safe_VkPipelineLayoutCreateInfo(const safe_VkPi
     pushConstantRangeCount = src.pushConstantRangeCount;
     pPushConstantRanges = nullptr;
     if (setLayoutCount && src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
-        for (uint32_t i=0; i<setLayoutCount; ++i) {
-            pSetLayouts[i] = src.pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(setLayoutCount);
+        memcpy ((void *)pSetLayouts, (void *)src.pSetLayouts, sizeof(VkDescriptorSetLayout)*setLayoutCount);
     }
     if (src.pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[src.pushConstantRangeCount];
+        pPushConstantRanges = vl_safe_new_array<VkPushConstantRange>(src.pushConstantRangeCount);
         memcpy ((void *)pPushConstantRanges, (void *)src.pPushConstantRanges, sizeof(VkPushConstantRange)*src.pushConstantRangeCount);
     }
 }
@@ -3514,9 +4027,9 @@ safe_VkPipelineLayoutCreateInfo& safe_VkPipelineLayoutCreateInfo::operator=(cons
     if (&src == this) return *this;
 
     if (pSetLayouts)
-        delete[] pSetLayouts;
+        vl_safe_delete_array(pSetLayouts);
     if (pPushConstantRanges)
-        delete[] pPushConstantRanges;
+        vl_safe_delete_array(pPushConstantRanges);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -3526,25 +4039,40 @@ safe_VkPipelineLayoutCreateInfo& safe_VkPipelineLayoutCreateInfo::operator=(cons
     pushConstantRangeCount = src.pushConstantRangeCount;
     pPushConstantRanges = nullptr;
     if (setLayoutCount && src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
-        for (uint32_t i=0; i<setLayoutCount; ++i) {
-            pSetLayouts[i] = src.pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(setLayoutCount);
+        memcpy ((void *)pSetLayouts, (void *)src.pSetLayouts, sizeof(VkDescriptorSetLayout)*setLayoutCount);
     }
     if (src.pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[src.pushConstantRangeCount];
+        pPushConstantRanges = vl_safe_new_array<VkPushConstantRange>(src.pushConstantRangeCount);
         memcpy ((void *)pPushConstantRanges, (void *)src.pPushConstantRanges, sizeof(VkPushConstantRange)*src.pushConstantRangeCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineLayoutCreateInfo::safe_VkPipelineLayoutCreateInfo(safe_VkPipelineLayoutCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineLayoutCreateInfo));
+    new (&src) safe_VkPipelineLayoutCreateInfo();
+}
+
+safe_VkPipelineLayoutCreateInfo& safe_VkPipelineLayoutCreateInfo::operator=(safe_VkPipelineLayoutCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineLayoutCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineLayoutCreateInfo));
+    new (&src) safe_VkPipelineLayoutCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineLayoutCreateInfo::~safe_VkPipelineLayoutCreateInfo()
 {
     if (pSetLayouts)
-        delete[] pSetLayouts;
+        vl_safe_delete_array(pSetLayouts);
     if (pPushConstantRanges)
-        delete[] pPushConstantRanges;
+        vl_safe_delete_array(pPushConstantRanges);
 }
 
 void safe_VkPipelineLayoutCreateInfo::initialize(const VkPipelineLayoutCreateInfo* in_struct)
@@ -3557,13 +4085,11 @@ void safe_VkPipelineLayoutCreateInfo::initialize(const VkPipelineLayoutCreateInf
     pushConstantRangeCount = in_struct->pushConstantRangeCount;
     pPushConstantRanges = nullptr;
     if (setLayoutCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
-        for (uint32_t i=0; i<setLayoutCount; ++i) {
-            pSetLayouts[i] = in_struct->pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(setLayoutCount);
+        memcpy ((void *)pSetLayouts, (void *)in_struct->pSetLayouts, sizeof(VkDescriptorSetLayout)*setLayoutCount);
     }
     if (in_struct->pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[in_struct->pushConstantRangeCount];
+        pPushConstantRanges = vl_safe_new_array<VkPushConstantRange>(in_struct->pushConstantRangeCount);
         memcpy ((void *)pPushConstantRanges, (void *)in_struct->pPushConstantRanges, sizeof(VkPushConstantRange)*in_struct->pushConstantRangeCount);
     }
 }
@@ -3578,13 +4104,11 @@ void safe_VkPipelineLayoutCreateInfo::initialize(const safe_VkPipelineLayoutCrea
     pushConstantRangeCount = src->pushConstantRangeCount;
     pPushConstantRanges = nullptr;
     if (setLayoutCount && src->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[setLayoutCount];
-        for (uint32_t i=0; i<setLayoutCount; ++i) {
-            pSetLayouts[i] = src->pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(setLayoutCount);
+        memcpy ((void *)pSetLayouts, (void *)src->pSetLayouts, sizeof(VkDescriptorSetLayout)*setLayoutCount);
     }
     if (src->pPushConstantRanges) {
-        pPushConstantRanges = new VkPushConstantRange[src->pushConstantRangeCount];
+        pPushConstantRanges = vl_safe_new_array<VkPushConstantRange>(src->pushConstantRangeCount);
         memcpy ((void *)pPushConstantRanges, (void *)src->pPushConstantRanges, sizeof(VkPushConstantRange)*src->pushConstantRangeCount);
     }
 }
@@ -3663,6 +4187,23 @@ safe_VkSamplerCreateInfo& safe_VkSamplerCreateInfo::operator=(const safe_VkSampl
     return *this;
 }
 
+safe_VkSamplerCreateInfo::safe_VkSamplerCreateInfo(safe_VkSamplerCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerCreateInfo));
+    new (&src) safe_VkSamplerCreateInfo();
+}
+
+safe_VkSamplerCreateInfo& safe_VkSamplerCreateInfo::operator=(safe_VkSamplerCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSamplerCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerCreateInfo));
+    new (&src) safe_VkSamplerCreateInfo();
+
+    return *this;
+}
+
 safe_VkSamplerCreateInfo::~safe_VkSamplerCreateInfo()
 {
 }
@@ -3720,10 +4261,8 @@ safe_VkDescriptorSetLayoutBinding::safe_VkDescriptorSetLayoutBinding(const VkDes
 {
     const bool sampler_type = in_struct->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || in_struct->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && in_struct->pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
-        for (uint32_t i=0; i<descriptorCount; ++i) {
-            pImmutableSamplers[i] = in_struct->pImmutableSamplers[i];
-        }
+        pImmutableSamplers = vl_safe_new_array<VkSampler>(descriptorCount);
+        memcpy ((void *)pImmutableSamplers, (void *)in_struct->pImmutableSamplers, sizeof(VkSampler)*descriptorCount);
     }
 }
 
@@ -3740,10 +4279,8 @@ safe_VkDescriptorSetLayoutBinding::safe_VkDescriptorSetLayoutBinding(const safe_
     pImmutableSamplers = nullptr;
     const bool sampler_type = src.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || src.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && src.pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
-        for (uint32_t i=0; i<descriptorCount; ++i) {
-            pImmutableSamplers[i] = src.pImmutableSamplers[i];
-        }
+        pImmutableSamplers = vl_safe_new_array<VkSampler>(descriptorCount);
+        memcpy ((void *)pImmutableSamplers, (void *)src.pImmutableSamplers, sizeof(VkSampler)*descriptorCount);
     }
 }
 
@@ -3752,7 +4289,7 @@ safe_VkDescriptorSetLayoutBinding& safe_VkDescriptorSetLayoutBinding::operator=(
     if (&src == this) return *this;
 
     if (pImmutableSamplers)
-        delete[] pImmutableSamplers;
+        vl_safe_delete_array(pImmutableSamplers);
 
     binding = src.binding;
     descriptorType = src.descriptorType;
@@ -3761,19 +4298,34 @@ safe_VkDescriptorSetLayoutBinding& safe_VkDescriptorSetLayoutBinding::operator=(
     pImmutableSamplers = nullptr;
     const bool sampler_type = src.descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || src.descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && src.pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
-        for (uint32_t i=0; i<descriptorCount; ++i) {
-            pImmutableSamplers[i] = src.pImmutableSamplers[i];
-        }
+        pImmutableSamplers = vl_safe_new_array<VkSampler>(descriptorCount);
+        memcpy ((void *)pImmutableSamplers, (void *)src.pImmutableSamplers, sizeof(VkSampler)*descriptorCount);
     }
 
     return *this;
 }
 
+safe_VkDescriptorSetLayoutBinding::safe_VkDescriptorSetLayoutBinding(safe_VkDescriptorSetLayoutBinding&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutBinding));
+    new (&src) safe_VkDescriptorSetLayoutBinding();
+}
+
+safe_VkDescriptorSetLayoutBinding& safe_VkDescriptorSetLayoutBinding::operator=(safe_VkDescriptorSetLayoutBinding&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorSetLayoutBinding();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutBinding));
+    new (&src) safe_VkDescriptorSetLayoutBinding();
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutBinding::~safe_VkDescriptorSetLayoutBinding()
 {
     if (pImmutableSamplers)
-        delete[] pImmutableSamplers;
+        vl_safe_delete_array(pImmutableSamplers);
 }
 
 void safe_VkDescriptorSetLayoutBinding::initialize(const VkDescriptorSetLayoutBinding* in_struct)
@@ -3785,10 +4337,8 @@ void safe_VkDescriptorSetLayoutBinding::initialize(const VkDescriptorSetLayoutBi
     pImmutableSamplers = nullptr;
     const bool sampler_type = in_struct->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || in_struct->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && in_struct->pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
-        for (uint32_t i=0; i<descriptorCount; ++i) {
-            pImmutableSamplers[i] = in_struct->pImmutableSamplers[i];
-        }
+        pImmutableSamplers = vl_safe_new_array<VkSampler>(descriptorCount);
+        memcpy ((void *)pImmutableSamplers, (void *)in_struct->pImmutableSamplers, sizeof(VkSampler)*descriptorCount);
     }
 }
 
@@ -3801,10 +4351,8 @@ void safe_VkDescriptorSetLayoutBinding::initialize(const safe_VkDescriptorSetLay
     pImmutableSamplers = nullptr;
     const bool sampler_type = src->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || src->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
     if (descriptorCount && src->pImmutableSamplers && sampler_type) {
-        pImmutableSamplers = new VkSampler[descriptorCount];
-        for (uint32_t i=0; i<descriptorCount; ++i) {
-            pImmutableSamplers[i] = src->pImmutableSamplers[i];
-        }
+        pImmutableSamplers = vl_safe_new_array<VkSampler>(descriptorCount);
+        memcpy ((void *)pImmutableSamplers, (void *)src->pImmutableSamplers, sizeof(VkSampler)*descriptorCount);
     }
 }
 
@@ -3816,7 +4364,7 @@ safe_VkDescriptorSetLayoutCreateInfo::safe_VkDescriptorSetLayoutCreateInfo(const
     pBindings(nullptr)
 {
     if (bindingCount && in_struct->pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = vl_safe_new_array<safe_VkDescriptorSetLayoutBinding>(bindingCount);
         for (uint32_t i=0; i<bindingCount; ++i) {
             pBindings[i].initialize(&in_struct->pBindings[i]);
         }
@@ -3835,7 +4383,7 @@ safe_VkDescriptorSetLayoutCreateInfo::safe_VkDescriptorSetLayoutCreateInfo(const
     bindingCount = src.bindingCount;
     pBindings = nullptr;
     if (bindingCount && src.pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = vl_safe_new_array<safe_VkDescriptorSetLayoutBinding>(bindingCount);
         for (uint32_t i=0; i<bindingCount; ++i) {
             pBindings[i].initialize(&src.pBindings[i]);
         }
@@ -3847,7 +4395,7 @@ safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::oper
     if (&src == this) return *this;
 
     if (pBindings)
-        delete[] pBindings;
+        vl_safe_delete_array(pBindings);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -3855,7 +4403,7 @@ safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::oper
     bindingCount = src.bindingCount;
     pBindings = nullptr;
     if (bindingCount && src.pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = vl_safe_new_array<safe_VkDescriptorSetLayoutBinding>(bindingCount);
         for (uint32_t i=0; i<bindingCount; ++i) {
             pBindings[i].initialize(&src.pBindings[i]);
         }
@@ -3864,10 +4412,27 @@ safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::oper
     return *this;
 }
 
+safe_VkDescriptorSetLayoutCreateInfo::safe_VkDescriptorSetLayoutCreateInfo(safe_VkDescriptorSetLayoutCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutCreateInfo));
+    new (&src) safe_VkDescriptorSetLayoutCreateInfo();
+}
+
+safe_VkDescriptorSetLayoutCreateInfo& safe_VkDescriptorSetLayoutCreateInfo::operator=(safe_VkDescriptorSetLayoutCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorSetLayoutCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutCreateInfo));
+    new (&src) safe_VkDescriptorSetLayoutCreateInfo();
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutCreateInfo::~safe_VkDescriptorSetLayoutCreateInfo()
 {
     if (pBindings)
-        delete[] pBindings;
+        vl_safe_delete_array(pBindings);
 }
 
 void safe_VkDescriptorSetLayoutCreateInfo::initialize(const VkDescriptorSetLayoutCreateInfo* in_struct)
@@ -3878,7 +4443,7 @@ void safe_VkDescriptorSetLayoutCreateInfo::initialize(const VkDescriptorSetLayou
     bindingCount = in_struct->bindingCount;
     pBindings = nullptr;
     if (bindingCount && in_struct->pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = vl_safe_new_array<safe_VkDescriptorSetLayoutBinding>(bindingCount);
         for (uint32_t i=0; i<bindingCount; ++i) {
             pBindings[i].initialize(&in_struct->pBindings[i]);
         }
@@ -3893,7 +4458,7 @@ void safe_VkDescriptorSetLayoutCreateInfo::initialize(const safe_VkDescriptorSet
     bindingCount = src->bindingCount;
     pBindings = nullptr;
     if (bindingCount && src->pBindings) {
-        pBindings = new safe_VkDescriptorSetLayoutBinding[bindingCount];
+        pBindings = vl_safe_new_array<safe_VkDescriptorSetLayoutBinding>(bindingCount);
         for (uint32_t i=0; i<bindingCount; ++i) {
             pBindings[i].initialize(&src->pBindings[i]);
         }
@@ -3909,7 +4474,7 @@ safe_VkDescriptorPoolCreateInfo::safe_VkDescriptorPoolCreateInfo(const VkDescrip
     pPoolSizes(nullptr)
 {
     if (in_struct->pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[in_struct->poolSizeCount];
+        pPoolSizes = vl_safe_new_array<VkDescriptorPoolSize>(in_struct->poolSizeCount);
         memcpy ((void *)pPoolSizes, (void *)in_struct->pPoolSizes, sizeof(VkDescriptorPoolSize)*in_struct->poolSizeCount);
     }
 }
@@ -3927,7 +4492,7 @@ safe_VkDescriptorPoolCreateInfo::safe_VkDescriptorPoolCreateInfo(const safe_VkDe
     poolSizeCount = src.poolSizeCount;
     pPoolSizes = nullptr;
     if (src.pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[src.poolSizeCount];
+        pPoolSizes = vl_safe_new_array<VkDescriptorPoolSize>(src.poolSizeCount);
         memcpy ((void *)pPoolSizes, (void *)src.pPoolSizes, sizeof(VkDescriptorPoolSize)*src.poolSizeCount);
     }
 }
@@ -3937,7 +4502,7 @@ safe_VkDescriptorPoolCreateInfo& safe_VkDescriptorPoolCreateInfo::operator=(cons
     if (&src == this) return *this;
 
     if (pPoolSizes)
-        delete[] pPoolSizes;
+        vl_safe_delete_array(pPoolSizes);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -3946,17 +4511,34 @@ safe_VkDescriptorPoolCreateInfo& safe_VkDescriptorPoolCreateInfo::operator=(cons
     poolSizeCount = src.poolSizeCount;
     pPoolSizes = nullptr;
     if (src.pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[src.poolSizeCount];
+        pPoolSizes = vl_safe_new_array<VkDescriptorPoolSize>(src.poolSizeCount);
         memcpy ((void *)pPoolSizes, (void *)src.pPoolSizes, sizeof(VkDescriptorPoolSize)*src.poolSizeCount);
     }
 
     return *this;
 }
 
+safe_VkDescriptorPoolCreateInfo::safe_VkDescriptorPoolCreateInfo(safe_VkDescriptorPoolCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorPoolCreateInfo));
+    new (&src) safe_VkDescriptorPoolCreateInfo();
+}
+
+safe_VkDescriptorPoolCreateInfo& safe_VkDescriptorPoolCreateInfo::operator=(safe_VkDescriptorPoolCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorPoolCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorPoolCreateInfo));
+    new (&src) safe_VkDescriptorPoolCreateInfo();
+
+    return *this;
+}
+
 safe_VkDescriptorPoolCreateInfo::~safe_VkDescriptorPoolCreateInfo()
 {
     if (pPoolSizes)
-        delete[] pPoolSizes;
+        vl_safe_delete_array(pPoolSizes);
 }
 
 void safe_VkDescriptorPoolCreateInfo::initialize(const VkDescriptorPoolCreateInfo* in_struct)
@@ -3968,7 +4550,7 @@ void safe_VkDescriptorPoolCreateInfo::initialize(const VkDescriptorPoolCreateInf
     poolSizeCount = in_struct->poolSizeCount;
     pPoolSizes = nullptr;
     if (in_struct->pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[in_struct->poolSizeCount];
+        pPoolSizes = vl_safe_new_array<VkDescriptorPoolSize>(in_struct->poolSizeCount);
         memcpy ((void *)pPoolSizes, (void *)in_struct->pPoolSizes, sizeof(VkDescriptorPoolSize)*in_struct->poolSizeCount);
     }
 }
@@ -3982,7 +4564,7 @@ void safe_VkDescriptorPoolCreateInfo::initialize(const safe_VkDescriptorPoolCrea
     poolSizeCount = src->poolSizeCount;
     pPoolSizes = nullptr;
     if (src->pPoolSizes) {
-        pPoolSizes = new VkDescriptorPoolSize[src->poolSizeCount];
+        pPoolSizes = vl_safe_new_array<VkDescriptorPoolSize>(src->poolSizeCount);
         memcpy ((void *)pPoolSizes, (void *)src->pPoolSizes, sizeof(VkDescriptorPoolSize)*src->poolSizeCount);
     }
 }
@@ -3995,10 +4577,8 @@ safe_VkDescriptorSetAllocateInfo::safe_VkDescriptorSetAllocateInfo(const VkDescr
     pSetLayouts(nullptr)
 {
     if (descriptorSetCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
-        for (uint32_t i=0; i<descriptorSetCount; ++i) {
-            pSetLayouts[i] = in_struct->pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(descriptorSetCount);
+        memcpy ((void *)pSetLayouts, (void *)in_struct->pSetLayouts, sizeof(VkDescriptorSetLayout)*descriptorSetCount);
     }
 }
 
@@ -4014,10 +4594,8 @@ safe_VkDescriptorSetAllocateInfo::safe_VkDescriptorSetAllocateInfo(const safe_Vk
     descriptorSetCount = src.descriptorSetCount;
     pSetLayouts = nullptr;
     if (descriptorSetCount && src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
-        for (uint32_t i=0; i<descriptorSetCount; ++i) {
-            pSetLayouts[i] = src.pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(descriptorSetCount);
+        memcpy ((void *)pSetLayouts, (void *)src.pSetLayouts, sizeof(VkDescriptorSetLayout)*descriptorSetCount);
     }
 }
 
@@ -4026,7 +4604,7 @@ safe_VkDescriptorSetAllocateInfo& safe_VkDescriptorSetAllocateInfo::operator=(co
     if (&src == this) return *this;
 
     if (pSetLayouts)
-        delete[] pSetLayouts;
+        vl_safe_delete_array(pSetLayouts);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -4034,19 +4612,34 @@ safe_VkDescriptorSetAllocateInfo& safe_VkDescriptorSetAllocateInfo::operator=(co
     descriptorSetCount = src.descriptorSetCount;
     pSetLayouts = nullptr;
     if (descriptorSetCount && src.pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
-        for (uint32_t i=0; i<descriptorSetCount; ++i) {
-            pSetLayouts[i] = src.pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(descriptorSetCount);
+        memcpy ((void *)pSetLayouts, (void *)src.pSetLayouts, sizeof(VkDescriptorSetLayout)*descriptorSetCount);
     }
 
     return *this;
 }
 
+safe_VkDescriptorSetAllocateInfo::safe_VkDescriptorSetAllocateInfo(safe_VkDescriptorSetAllocateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetAllocateInfo));
+    new (&src) safe_VkDescriptorSetAllocateInfo();
+}
+
+safe_VkDescriptorSetAllocateInfo& safe_VkDescriptorSetAllocateInfo::operator=(safe_VkDescriptorSetAllocateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorSetAllocateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetAllocateInfo));
+    new (&src) safe_VkDescriptorSetAllocateInfo();
+
+    return *this;
+}
+
 safe_VkDescriptorSetAllocateInfo::~safe_VkDescriptorSetAllocateInfo()
 {
     if (pSetLayouts)
-        delete[] pSetLayouts;
+        vl_safe_delete_array(pSetLayouts);
 }
 
 void safe_VkDescriptorSetAllocateInfo::initialize(const VkDescriptorSetAllocateInfo* in_struct)
@@ -4057,10 +4650,8 @@ void safe_VkDescriptorSetAllocateInfo::initialize(const VkDescriptorSetAllocateI
     descriptorSetCount = in_struct->descriptorSetCount;
     pSetLayouts = nullptr;
     if (descriptorSetCount && in_struct->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
-        for (uint32_t i=0; i<descriptorSetCount; ++i) {
-            pSetLayouts[i] = in_struct->pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(descriptorSetCount);
+        memcpy ((void *)pSetLayouts, (void *)in_struct->pSetLayouts, sizeof(VkDescriptorSetLayout)*descriptorSetCount);
     }
 }
 
@@ -4072,10 +4663,8 @@ void safe_VkDescriptorSetAllocateInfo::initialize(const safe_VkDescriptorSetAllo
     descriptorSetCount = src->descriptorSetCount;
     pSetLayouts = nullptr;
     if (descriptorSetCount && src->pSetLayouts) {
-        pSetLayouts = new VkDescriptorSetLayout[descriptorSetCount];
-        for (uint32_t i=0; i<descriptorSetCount; ++i) {
-            pSetLayouts[i] = src->pSetLayouts[i];
-        }
+        pSetLayouts = vl_safe_new_array<VkDescriptorSetLayout>(descriptorSetCount);
+        memcpy ((void *)pSetLayouts, (void *)src->pSetLayouts, sizeof(VkDescriptorSetLayout)*descriptorSetCount);
     }
 }
 
@@ -4098,10 +4687,8 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const VkWriteDescriptorSet*
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && in_struct->pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pImageInfo[i] = in_struct->pImageInfo[i];
-            }
+            pImageInfo = vl_safe_new_array<VkDescriptorImageInfo>(descriptorCount);
+            memcpy ((void *)pImageInfo, (void *)in_struct->pImageInfo, sizeof(VkDescriptorImageInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
@@ -4109,19 +4696,15 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const VkWriteDescriptorSet*
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && in_struct->pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pBufferInfo[i] = in_struct->pBufferInfo[i];
-            }
+            pBufferInfo = vl_safe_new_array<VkDescriptorBufferInfo>(descriptorCount);
+            memcpy ((void *)pBufferInfo, (void *)in_struct->pBufferInfo, sizeof(VkDescriptorBufferInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && in_struct->pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pTexelBufferView[i] = in_struct->pTexelBufferView[i];
-            }
+            pTexelBufferView = vl_safe_new_array<VkBufferView>(descriptorCount);
+            memcpy ((void *)pTexelBufferView, (void *)in_struct->pTexelBufferView, sizeof(VkBufferView)*descriptorCount);
         }
         break;
         default:
@@ -4154,10 +4737,8 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const safe_VkWriteDescripto
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && src.pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pImageInfo[i] = src.pImageInfo[i];
-            }
+            pImageInfo = vl_safe_new_array<VkDescriptorImageInfo>(descriptorCount);
+            memcpy ((void *)pImageInfo, (void *)src.pImageInfo, sizeof(VkDescriptorImageInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
@@ -4165,19 +4746,15 @@ safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(const safe_VkWriteDescripto
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && src.pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pBufferInfo[i] = src.pBufferInfo[i];
-            }
+            pBufferInfo = vl_safe_new_array<VkDescriptorBufferInfo>(descriptorCount);
+            memcpy ((void *)pBufferInfo, (void *)src.pBufferInfo, sizeof(VkDescriptorBufferInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && src.pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pTexelBufferView[i] = src.pTexelBufferView[i];
-            }
+            pTexelBufferView = vl_safe_new_array<VkBufferView>(descriptorCount);
+            memcpy ((void *)pTexelBufferView, (void *)src.pTexelBufferView, sizeof(VkBufferView)*descriptorCount);
         }
         break;
         default:
@@ -4190,11 +4767,11 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
     if (&src == this) return *this;
 
     if (pImageInfo)
-        delete[] pImageInfo;
+        vl_safe_delete_array(pImageInfo);
     if (pBufferInfo)
-        delete[] pBufferInfo;
+        vl_safe_delete_array(pBufferInfo);
     if (pTexelBufferView)
-        delete[] pTexelBufferView;
+        vl_safe_delete_array(pTexelBufferView);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -4213,10 +4790,8 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && src.pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pImageInfo[i] = src.pImageInfo[i];
-            }
+            pImageInfo = vl_safe_new_array<VkDescriptorImageInfo>(descriptorCount);
+            memcpy ((void *)pImageInfo, (void *)src.pImageInfo, sizeof(VkDescriptorImageInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
@@ -4224,19 +4799,15 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && src.pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pBufferInfo[i] = src.pBufferInfo[i];
-            }
+            pBufferInfo = vl_safe_new_array<VkDescriptorBufferInfo>(descriptorCount);
+            memcpy ((void *)pBufferInfo, (void *)src.pBufferInfo, sizeof(VkDescriptorBufferInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && src.pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pTexelBufferView[i] = src.pTexelBufferView[i];
-            }
+            pTexelBufferView = vl_safe_new_array<VkBufferView>(descriptorCount);
+            memcpy ((void *)pTexelBufferView, (void *)src.pTexelBufferView, sizeof(VkBufferView)*descriptorCount);
         }
         break;
         default:
@@ -4246,14 +4817,31 @@ safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(const safe_VkWri
     return *this;
 }
 
+safe_VkWriteDescriptorSet::safe_VkWriteDescriptorSet(safe_VkWriteDescriptorSet&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWriteDescriptorSet));
+    new (&src) safe_VkWriteDescriptorSet();
+}
+
+safe_VkWriteDescriptorSet& safe_VkWriteDescriptorSet::operator=(safe_VkWriteDescriptorSet&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkWriteDescriptorSet();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWriteDescriptorSet));
+    new (&src) safe_VkWriteDescriptorSet();
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSet::~safe_VkWriteDescriptorSet()
 {
     if (pImageInfo)
-        delete[] pImageInfo;
+        vl_safe_delete_array(pImageInfo);
     if (pBufferInfo)
-        delete[] pBufferInfo;
+        vl_safe_delete_array(pBufferInfo);
     if (pTexelBufferView)
-        delete[] pTexelBufferView;
+        vl_safe_delete_array(pTexelBufferView);
 }
 
 void safe_VkWriteDescriptorSet::initialize(const VkWriteDescriptorSet* in_struct)
@@ -4275,10 +4863,8 @@ void safe_VkWriteDescriptorSet::initialize(const VkWriteDescriptorSet* in_struct
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && in_struct->pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pImageInfo[i] = in_struct->pImageInfo[i];
-            }
+            pImageInfo = vl_safe_new_array<VkDescriptorImageInfo>(descriptorCount);
+            memcpy ((void *)pImageInfo, (void *)in_struct->pImageInfo, sizeof(VkDescriptorImageInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
@@ -4286,19 +4872,15 @@ void safe_VkWriteDescriptorSet::initialize(const VkWriteDescriptorSet* in_struct
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && in_struct->pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pBufferInfo[i] = in_struct->pBufferInfo[i];
-            }
+            pBufferInfo = vl_safe_new_array<VkDescriptorBufferInfo>(descriptorCount);
+            memcpy ((void *)pBufferInfo, (void *)in_struct->pBufferInfo, sizeof(VkDescriptorBufferInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && in_struct->pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pTexelBufferView[i] = in_struct->pTexelBufferView[i];
-            }
+            pTexelBufferView = vl_safe_new_array<VkBufferView>(descriptorCount);
+            memcpy ((void *)pTexelBufferView, (void *)in_struct->pTexelBufferView, sizeof(VkBufferView)*descriptorCount);
         }
         break;
         default:
@@ -4325,10 +4907,8 @@ void safe_VkWriteDescriptorSet::initialize(const safe_VkWriteDescriptorSet* src)
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
         if (descriptorCount && src->pImageInfo) {
-            pImageInfo = new VkDescriptorImageInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pImageInfo[i] = src->pImageInfo[i];
-            }
+            pImageInfo = vl_safe_new_array<VkDescriptorImageInfo>(descriptorCount);
+            memcpy ((void *)pImageInfo, (void *)src->pImageInfo, sizeof(VkDescriptorImageInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
@@ -4336,19 +4916,15 @@ void safe_VkWriteDescriptorSet::initialize(const safe_VkWriteDescriptorSet* src)
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
         if (descriptorCount && src->pBufferInfo) {
-            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pBufferInfo[i] = src->pBufferInfo[i];
-            }
+            pBufferInfo = vl_safe_new_array<VkDescriptorBufferInfo>(descriptorCount);
+            memcpy ((void *)pBufferInfo, (void *)src->pBufferInfo, sizeof(VkDescriptorBufferInfo)*descriptorCount);
         }
         break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
         if (descriptorCount && src->pTexelBufferView) {
-            pTexelBufferView = new VkBufferView[descriptorCount];
-            for (uint32_t i=0; i<descriptorCount; ++i) {
-                pTexelBufferView[i] = src->pTexelBufferView[i];
-            }
+            pTexelBufferView = vl_safe_new_array<VkBufferView>(descriptorCount);
+            memcpy ((void *)pTexelBufferView, (void *)src->pTexelBufferView, sizeof(VkBufferView)*descriptorCount);
         }
         break;
         default:
@@ -4403,6 +4979,23 @@ safe_VkCopyDescriptorSet& safe_VkCopyDescriptorSet::operator=(const safe_VkCopyD
     return *this;
 }
 
+safe_VkCopyDescriptorSet::safe_VkCopyDescriptorSet(safe_VkCopyDescriptorSet&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCopyDescriptorSet));
+    new (&src) safe_VkCopyDescriptorSet();
+}
+
+safe_VkCopyDescriptorSet& safe_VkCopyDescriptorSet::operator=(safe_VkCopyDescriptorSet&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCopyDescriptorSet();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCopyDescriptorSet));
+    new (&src) safe_VkCopyDescriptorSet();
+
+    return *this;
+}
+
 safe_VkCopyDescriptorSet::~safe_VkCopyDescriptorSet()
 {
 }
@@ -4445,10 +5038,8 @@ safe_VkFramebufferCreateInfo::safe_VkFramebufferCreateInfo(const VkFramebufferCr
     layers(in_struct->layers)
 {
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = in_struct->pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -4468,10 +5059,8 @@ safe_VkFramebufferCreateInfo::safe_VkFramebufferCreateInfo(const safe_VkFramebuf
     height = src.height;
     layers = src.layers;
     if (attachmentCount && src.pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = src.pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -4480,7 +5069,7 @@ safe_VkFramebufferCreateInfo& safe_VkFramebufferCreateInfo::operator=(const safe
     if (&src == this) return *this;
 
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -4492,19 +5081,34 @@ safe_VkFramebufferCreateInfo& safe_VkFramebufferCreateInfo::operator=(const safe
     height = src.height;
     layers = src.layers;
     if (attachmentCount && src.pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = src.pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 
     return *this;
 }
 
+safe_VkFramebufferCreateInfo::safe_VkFramebufferCreateInfo(safe_VkFramebufferCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferCreateInfo));
+    new (&src) safe_VkFramebufferCreateInfo();
+}
+
+safe_VkFramebufferCreateInfo& safe_VkFramebufferCreateInfo::operator=(safe_VkFramebufferCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFramebufferCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferCreateInfo));
+    new (&src) safe_VkFramebufferCreateInfo();
+
+    return *this;
+}
+
 safe_VkFramebufferCreateInfo::~safe_VkFramebufferCreateInfo()
 {
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
 }
 
 void safe_VkFramebufferCreateInfo::initialize(const VkFramebufferCreateInfo* in_struct)
@@ -4519,10 +5123,8 @@ void safe_VkFramebufferCreateInfo::initialize(const VkFramebufferCreateInfo* in_
     height = in_struct->height;
     layers = in_struct->layers;
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = in_struct->pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -4538,10 +5140,8 @@ void safe_VkFramebufferCreateInfo::initialize(const safe_VkFramebufferCreateInfo
     height = src->height;
     layers = src->layers;
     if (attachmentCount && src->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = src->pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)src->pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -4558,22 +5158,22 @@ safe_VkSubpassDescription::safe_VkSubpassDescription(const VkSubpassDescription*
     pPreserveAttachments(nullptr)
 {
     if (in_struct->pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[in_struct->inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<VkAttachmentReference>(in_struct->inputAttachmentCount);
         memcpy ((void *)pInputAttachments, (void *)in_struct->pInputAttachments, sizeof(VkAttachmentReference)*in_struct->inputAttachmentCount);
     }
     if (in_struct->pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<VkAttachmentReference>(in_struct->colorAttachmentCount);
         memcpy ((void *)pColorAttachments, (void *)in_struct->pColorAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<VkAttachmentReference>(in_struct->colorAttachmentCount);
         memcpy ((void *)pResolveAttachments, (void *)in_struct->pResolveAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<VkAttachmentReference>(*in_struct->pDepthStencilAttachment);
     }
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(in_struct->preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -4599,22 +5199,22 @@ safe_VkSubpassDescription::safe_VkSubpassDescription(const safe_VkSubpassDescrip
     preserveAttachmentCount = src.preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (src.pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[src.inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<VkAttachmentReference>(src.inputAttachmentCount);
         memcpy ((void *)pInputAttachments, (void *)src.pInputAttachments, sizeof(VkAttachmentReference)*src.inputAttachmentCount);
     }
     if (src.pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[src.colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<VkAttachmentReference>(src.colorAttachmentCount);
         memcpy ((void *)pColorAttachments, (void *)src.pColorAttachments, sizeof(VkAttachmentReference)*src.colorAttachmentCount);
     }
     if (src.pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[src.colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<VkAttachmentReference>(src.colorAttachmentCount);
         memcpy ((void *)pResolveAttachments, (void *)src.pResolveAttachments, sizeof(VkAttachmentReference)*src.colorAttachmentCount);
     }
     if (src.pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*src.pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<VkAttachmentReference>(*src.pDepthStencilAttachment);
     }
     if (src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[src.preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(src.preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)src.pPreserveAttachments, sizeof(uint32_t)*src.preserveAttachmentCount);
     }
 }
@@ -4624,15 +5224,15 @@ safe_VkSubpassDescription& safe_VkSubpassDescription::operator=(const safe_VkSub
     if (&src == this) return *this;
 
     if (pInputAttachments)
-        delete[] pInputAttachments;
+        vl_safe_delete_array(pInputAttachments);
     if (pColorAttachments)
-        delete[] pColorAttachments;
+        vl_safe_delete_array(pColorAttachments);
     if (pResolveAttachments)
-        delete[] pResolveAttachments;
+        vl_safe_delete_array(pResolveAttachments);
     if (pDepthStencilAttachment)
-        delete pDepthStencilAttachment;
+        vl_safe_delete(pDepthStencilAttachment);
     if (pPreserveAttachments)
-        delete[] pPreserveAttachments;
+        vl_safe_delete_array(pPreserveAttachments);
 
     flags = src.flags;
     pipelineBindPoint = src.pipelineBindPoint;
@@ -4645,40 +5245,57 @@ safe_VkSubpassDescription& safe_VkSubpassDescription::operator=(const safe_VkSub
     preserveAttachmentCount = src.preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (src.pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[src.inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<VkAttachmentReference>(src.inputAttachmentCount);
         memcpy ((void *)pInputAttachments, (void *)src.pInputAttachments, sizeof(VkAttachmentReference)*src.inputAttachmentCount);
     }
     if (src.pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[src.colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<VkAttachmentReference>(src.colorAttachmentCount);
         memcpy ((void *)pColorAttachments, (void *)src.pColorAttachments, sizeof(VkAttachmentReference)*src.colorAttachmentCount);
     }
     if (src.pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[src.colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<VkAttachmentReference>(src.colorAttachmentCount);
         memcpy ((void *)pResolveAttachments, (void *)src.pResolveAttachments, sizeof(VkAttachmentReference)*src.colorAttachmentCount);
     }
     if (src.pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*src.pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<VkAttachmentReference>(*src.pDepthStencilAttachment);
     }
     if (src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[src.preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(src.preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)src.pPreserveAttachments, sizeof(uint32_t)*src.preserveAttachmentCount);
     }
 
     return *this;
 }
 
-safe_VkSubpassDescription::~safe_VkSubpassDescription()
+safe_VkSubpassDescription::safe_VkSubpassDescription(safe_VkSubpassDescription&& src) noexcept
 {
-    if (pInputAttachments)
-        delete[] pInputAttachments;
-    if (pColorAttachments)
-        delete[] pColorAttachments;
-    if (pResolveAttachments)
-        delete[] pResolveAttachments;
-    if (pDepthStencilAttachment)
-        delete pDepthStencilAttachment;
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDescription));
+    new (&src) safe_VkSubpassDescription();
+}
+
+safe_VkSubpassDescription& safe_VkSubpassDescription::operator=(safe_VkSubpassDescription&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubpassDescription();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDescription));
+    new (&src) safe_VkSubpassDescription();
+
+    return *this;
+}
+
+safe_VkSubpassDescription::~safe_VkSubpassDescription()
+{
+    if (pInputAttachments)
+        vl_safe_delete_array(pInputAttachments);
+    if (pColorAttachments)
+        vl_safe_delete_array(pColorAttachments);
+    if (pResolveAttachments)
+        vl_safe_delete_array(pResolveAttachments);
+    if (pDepthStencilAttachment)
+        vl_safe_delete(pDepthStencilAttachment);
     if (pPreserveAttachments)
-        delete[] pPreserveAttachments;
+        vl_safe_delete_array(pPreserveAttachments);
 }
 
 void safe_VkSubpassDescription::initialize(const VkSubpassDescription* in_struct)
@@ -4694,22 +5311,22 @@ void safe_VkSubpassDescription::initialize(const VkSubpassDescription* in_struct
     preserveAttachmentCount = in_struct->preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (in_struct->pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[in_struct->inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<VkAttachmentReference>(in_struct->inputAttachmentCount);
         memcpy ((void *)pInputAttachments, (void *)in_struct->pInputAttachments, sizeof(VkAttachmentReference)*in_struct->inputAttachmentCount);
     }
     if (in_struct->pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<VkAttachmentReference>(in_struct->colorAttachmentCount);
         memcpy ((void *)pColorAttachments, (void *)in_struct->pColorAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[in_struct->colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<VkAttachmentReference>(in_struct->colorAttachmentCount);
         memcpy ((void *)pResolveAttachments, (void *)in_struct->pResolveAttachments, sizeof(VkAttachmentReference)*in_struct->colorAttachmentCount);
     }
     if (in_struct->pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<VkAttachmentReference>(*in_struct->pDepthStencilAttachment);
     }
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(in_struct->preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -4727,22 +5344,22 @@ void safe_VkSubpassDescription::initialize(const safe_VkSubpassDescription* src)
     preserveAttachmentCount = src->preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (src->pInputAttachments) {
-        pInputAttachments = new VkAttachmentReference[src->inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<VkAttachmentReference>(src->inputAttachmentCount);
         memcpy ((void *)pInputAttachments, (void *)src->pInputAttachments, sizeof(VkAttachmentReference)*src->inputAttachmentCount);
     }
     if (src->pColorAttachments) {
-        pColorAttachments = new VkAttachmentReference[src->colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<VkAttachmentReference>(src->colorAttachmentCount);
         memcpy ((void *)pColorAttachments, (void *)src->pColorAttachments, sizeof(VkAttachmentReference)*src->colorAttachmentCount);
     }
     if (src->pResolveAttachments) {
-        pResolveAttachments = new VkAttachmentReference[src->colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<VkAttachmentReference>(src->colorAttachmentCount);
         memcpy ((void *)pResolveAttachments, (void *)src->pResolveAttachments, sizeof(VkAttachmentReference)*src->colorAttachmentCount);
     }
     if (src->pDepthStencilAttachment) {
-        pDepthStencilAttachment = new VkAttachmentReference(*src->pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<VkAttachmentReference>(*src->pDepthStencilAttachment);
     }
     if (src->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[src->preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(src->preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)src->pPreserveAttachments, sizeof(uint32_t)*src->preserveAttachmentCount);
     }
 }
@@ -4759,17 +5376,17 @@ safe_VkRenderPassCreateInfo::safe_VkRenderPassCreateInfo(const VkRenderPassCreat
     pDependencies(nullptr)
 {
     if (in_struct->pAttachments) {
-        pAttachments = new VkAttachmentDescription[in_struct->attachmentCount];
+        pAttachments = vl_safe_new_array<VkAttachmentDescription>(in_struct->attachmentCount);
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkAttachmentDescription)*in_struct->attachmentCount);
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (in_struct->pDependencies) {
-        pDependencies = new VkSubpassDependency[in_struct->dependencyCount];
+        pDependencies = vl_safe_new_array<VkSubpassDependency>(in_struct->dependencyCount);
         memcpy ((void *)pDependencies, (void *)in_struct->pDependencies, sizeof(VkSubpassDependency)*in_struct->dependencyCount);
     }
 }
@@ -4792,17 +5409,17 @@ safe_VkRenderPassCreateInfo::safe_VkRenderPassCreateInfo(const safe_VkRenderPass
     dependencyCount = src.dependencyCount;
     pDependencies = nullptr;
     if (src.pAttachments) {
-        pAttachments = new VkAttachmentDescription[src.attachmentCount];
+        pAttachments = vl_safe_new_array<VkAttachmentDescription>(src.attachmentCount);
         memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkAttachmentDescription)*src.attachmentCount);
     }
     if (subpassCount && src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&src.pSubpasses[i]);
         }
     }
     if (src.pDependencies) {
-        pDependencies = new VkSubpassDependency[src.dependencyCount];
+        pDependencies = vl_safe_new_array<VkSubpassDependency>(src.dependencyCount);
         memcpy ((void *)pDependencies, (void *)src.pDependencies, sizeof(VkSubpassDependency)*src.dependencyCount);
     }
 }
@@ -4812,11 +5429,11 @@ safe_VkRenderPassCreateInfo& safe_VkRenderPassCreateInfo::operator=(const safe_V
     if (&src == this) return *this;
 
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
     if (pSubpasses)
-        delete[] pSubpasses;
+        vl_safe_delete_array(pSubpasses);
     if (pDependencies)
-        delete[] pDependencies;
+        vl_safe_delete_array(pDependencies);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -4828,31 +5445,48 @@ safe_VkRenderPassCreateInfo& safe_VkRenderPassCreateInfo::operator=(const safe_V
     dependencyCount = src.dependencyCount;
     pDependencies = nullptr;
     if (src.pAttachments) {
-        pAttachments = new VkAttachmentDescription[src.attachmentCount];
+        pAttachments = vl_safe_new_array<VkAttachmentDescription>(src.attachmentCount);
         memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkAttachmentDescription)*src.attachmentCount);
     }
     if (subpassCount && src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&src.pSubpasses[i]);
         }
     }
     if (src.pDependencies) {
-        pDependencies = new VkSubpassDependency[src.dependencyCount];
+        pDependencies = vl_safe_new_array<VkSubpassDependency>(src.dependencyCount);
         memcpy ((void *)pDependencies, (void *)src.pDependencies, sizeof(VkSubpassDependency)*src.dependencyCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassCreateInfo::safe_VkRenderPassCreateInfo(safe_VkRenderPassCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassCreateInfo));
+    new (&src) safe_VkRenderPassCreateInfo();
+}
+
+safe_VkRenderPassCreateInfo& safe_VkRenderPassCreateInfo::operator=(safe_VkRenderPassCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassCreateInfo));
+    new (&src) safe_VkRenderPassCreateInfo();
+
+    return *this;
+}
+
 safe_VkRenderPassCreateInfo::~safe_VkRenderPassCreateInfo()
 {
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
     if (pSubpasses)
-        delete[] pSubpasses;
+        vl_safe_delete_array(pSubpasses);
     if (pDependencies)
-        delete[] pDependencies;
+        vl_safe_delete_array(pDependencies);
 }
 
 void safe_VkRenderPassCreateInfo::initialize(const VkRenderPassCreateInfo* in_struct)
@@ -4867,17 +5501,17 @@ void safe_VkRenderPassCreateInfo::initialize(const VkRenderPassCreateInfo* in_st
     dependencyCount = in_struct->dependencyCount;
     pDependencies = nullptr;
     if (in_struct->pAttachments) {
-        pAttachments = new VkAttachmentDescription[in_struct->attachmentCount];
+        pAttachments = vl_safe_new_array<VkAttachmentDescription>(in_struct->attachmentCount);
         memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkAttachmentDescription)*in_struct->attachmentCount);
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (in_struct->pDependencies) {
-        pDependencies = new VkSubpassDependency[in_struct->dependencyCount];
+        pDependencies = vl_safe_new_array<VkSubpassDependency>(in_struct->dependencyCount);
         memcpy ((void *)pDependencies, (void *)in_struct->pDependencies, sizeof(VkSubpassDependency)*in_struct->dependencyCount);
     }
 }
@@ -4894,17 +5528,17 @@ void safe_VkRenderPassCreateInfo::initialize(const safe_VkRenderPassCreateInfo*
     dependencyCount = src->dependencyCount;
     pDependencies = nullptr;
     if (src->pAttachments) {
-        pAttachments = new VkAttachmentDescription[src->attachmentCount];
+        pAttachments = vl_safe_new_array<VkAttachmentDescription>(src->attachmentCount);
         memcpy ((void *)pAttachments, (void *)src->pAttachments, sizeof(VkAttachmentDescription)*src->attachmentCount);
     }
     if (subpassCount && src->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&src->pSubpasses[i]);
         }
     }
     if (src->pDependencies) {
-        pDependencies = new VkSubpassDependency[src->dependencyCount];
+        pDependencies = vl_safe_new_array<VkSubpassDependency>(src->dependencyCount);
         memcpy ((void *)pDependencies, (void *)src->pDependencies, sizeof(VkSubpassDependency)*src->dependencyCount);
     }
 }
@@ -4941,6 +5575,23 @@ safe_VkCommandPoolCreateInfo& safe_VkCommandPoolCreateInfo::operator=(const safe
     return *this;
 }
 
+safe_VkCommandPoolCreateInfo::safe_VkCommandPoolCreateInfo(safe_VkCommandPoolCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandPoolCreateInfo));
+    new (&src) safe_VkCommandPoolCreateInfo();
+}
+
+safe_VkCommandPoolCreateInfo& safe_VkCommandPoolCreateInfo::operator=(safe_VkCommandPoolCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCommandPoolCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandPoolCreateInfo));
+    new (&src) safe_VkCommandPoolCreateInfo();
+
+    return *this;
+}
+
 safe_VkCommandPoolCreateInfo::~safe_VkCommandPoolCreateInfo()
 {
 }
@@ -4996,6 +5647,23 @@ safe_VkCommandBufferAllocateInfo& safe_VkCommandBufferAllocateInfo::operator=(co
     return *this;
 }
 
+safe_VkCommandBufferAllocateInfo::safe_VkCommandBufferAllocateInfo(safe_VkCommandBufferAllocateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferAllocateInfo));
+    new (&src) safe_VkCommandBufferAllocateInfo();
+}
+
+safe_VkCommandBufferAllocateInfo& safe_VkCommandBufferAllocateInfo::operator=(safe_VkCommandBufferAllocateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCommandBufferAllocateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferAllocateInfo));
+    new (&src) safe_VkCommandBufferAllocateInfo();
+
+    return *this;
+}
+
 safe_VkCommandBufferAllocateInfo::~safe_VkCommandBufferAllocateInfo()
 {
 }
@@ -5062,6 +5730,23 @@ safe_VkCommandBufferInheritanceInfo& safe_VkCommandBufferInheritanceInfo::operat
     return *this;
 }
 
+safe_VkCommandBufferInheritanceInfo::safe_VkCommandBufferInheritanceInfo(safe_VkCommandBufferInheritanceInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferInheritanceInfo));
+    new (&src) safe_VkCommandBufferInheritanceInfo();
+}
+
+safe_VkCommandBufferInheritanceInfo& safe_VkCommandBufferInheritanceInfo::operator=(safe_VkCommandBufferInheritanceInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCommandBufferInheritanceInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferInheritanceInfo));
+    new (&src) safe_VkCommandBufferInheritanceInfo();
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceInfo::~safe_VkCommandBufferInheritanceInfo()
 {
 }
@@ -5096,7 +5781,7 @@ safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo(const VkCommandBuff
     flags(in_struct->flags)
 {
     if (in_struct->pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(in_struct->pInheritanceInfo);
+        pInheritanceInfo = vl_safe_new<safe_VkCommandBufferInheritanceInfo>(in_struct->pInheritanceInfo);
     else
         pInheritanceInfo = NULL;
 }
@@ -5110,7 +5795,7 @@ safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo(const safe_VkComman
     pNext = src.pNext;
     flags = src.flags;
     if (src.pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(*src.pInheritanceInfo);
+        pInheritanceInfo = vl_safe_new<safe_VkCommandBufferInheritanceInfo>(*src.pInheritanceInfo);
     else
         pInheritanceInfo = NULL;
 }
@@ -5120,23 +5805,40 @@ safe_VkCommandBufferBeginInfo& safe_VkCommandBufferBeginInfo::operator=(const sa
     if (&src == this) return *this;
 
     if (pInheritanceInfo)
-        delete pInheritanceInfo;
+        vl_safe_delete(pInheritanceInfo);
 
     sType = src.sType;
     pNext = src.pNext;
     flags = src.flags;
     if (src.pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(*src.pInheritanceInfo);
+        pInheritanceInfo = vl_safe_new<safe_VkCommandBufferInheritanceInfo>(*src.pInheritanceInfo);
     else
         pInheritanceInfo = NULL;
 
     return *this;
 }
 
+safe_VkCommandBufferBeginInfo::safe_VkCommandBufferBeginInfo(safe_VkCommandBufferBeginInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferBeginInfo));
+    new (&src) safe_VkCommandBufferBeginInfo();
+}
+
+safe_VkCommandBufferBeginInfo& safe_VkCommandBufferBeginInfo::operator=(safe_VkCommandBufferBeginInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCommandBufferBeginInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferBeginInfo));
+    new (&src) safe_VkCommandBufferBeginInfo();
+
+    return *this;
+}
+
 safe_VkCommandBufferBeginInfo::~safe_VkCommandBufferBeginInfo()
 {
     if (pInheritanceInfo)
-        delete pInheritanceInfo;
+        vl_safe_delete(pInheritanceInfo);
 }
 
 void safe_VkCommandBufferBeginInfo::initialize(const VkCommandBufferBeginInfo* in_struct)
@@ -5145,7 +5847,7 @@ void safe_VkCommandBufferBeginInfo::initialize(const VkCommandBufferBeginInfo* i
     pNext = in_struct->pNext;
     flags = in_struct->flags;
     if (in_struct->pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(in_struct->pInheritanceInfo);
+        pInheritanceInfo = vl_safe_new<safe_VkCommandBufferInheritanceInfo>(in_struct->pInheritanceInfo);
     else
         pInheritanceInfo = NULL;
 }
@@ -5156,7 +5858,7 @@ void safe_VkCommandBufferBeginInfo::initialize(const safe_VkCommandBufferBeginIn
     pNext = src->pNext;
     flags = src->flags;
     if (src->pInheritanceInfo)
-        pInheritanceInfo = new safe_VkCommandBufferInheritanceInfo(*src->pInheritanceInfo);
+        pInheritanceInfo = vl_safe_new<safe_VkCommandBufferInheritanceInfo>(*src->pInheritanceInfo);
     else
         pInheritanceInfo = NULL;
 }
@@ -5193,6 +5895,23 @@ safe_VkMemoryBarrier& safe_VkMemoryBarrier::operator=(const safe_VkMemoryBarrier
     return *this;
 }
 
+safe_VkMemoryBarrier::safe_VkMemoryBarrier(safe_VkMemoryBarrier&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryBarrier));
+    new (&src) safe_VkMemoryBarrier();
+}
+
+safe_VkMemoryBarrier& safe_VkMemoryBarrier::operator=(safe_VkMemoryBarrier&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryBarrier();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryBarrier));
+    new (&src) safe_VkMemoryBarrier();
+
+    return *this;
+}
+
 safe_VkMemoryBarrier::~safe_VkMemoryBarrier()
 {
 }
@@ -5260,6 +5979,23 @@ safe_VkBufferMemoryBarrier& safe_VkBufferMemoryBarrier::operator=(const safe_VkB
     return *this;
 }
 
+safe_VkBufferMemoryBarrier::safe_VkBufferMemoryBarrier(safe_VkBufferMemoryBarrier&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferMemoryBarrier));
+    new (&src) safe_VkBufferMemoryBarrier();
+}
+
+safe_VkBufferMemoryBarrier& safe_VkBufferMemoryBarrier::operator=(safe_VkBufferMemoryBarrier&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBufferMemoryBarrier();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferMemoryBarrier));
+    new (&src) safe_VkBufferMemoryBarrier();
+
+    return *this;
+}
+
 safe_VkBufferMemoryBarrier::~safe_VkBufferMemoryBarrier()
 {
 }
@@ -5340,6 +6076,23 @@ safe_VkImageMemoryBarrier& safe_VkImageMemoryBarrier::operator=(const safe_VkIma
     return *this;
 }
 
+safe_VkImageMemoryBarrier::safe_VkImageMemoryBarrier(safe_VkImageMemoryBarrier&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageMemoryBarrier));
+    new (&src) safe_VkImageMemoryBarrier();
+}
+
+safe_VkImageMemoryBarrier& safe_VkImageMemoryBarrier::operator=(safe_VkImageMemoryBarrier&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageMemoryBarrier();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageMemoryBarrier));
+    new (&src) safe_VkImageMemoryBarrier();
+
+    return *this;
+}
+
 safe_VkImageMemoryBarrier::~safe_VkImageMemoryBarrier()
 {
 }
@@ -5382,7 +6135,7 @@ safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(const VkRenderPassBeginIn
     pClearValues(nullptr)
 {
     if (in_struct->pClearValues) {
-        pClearValues = new VkClearValue[in_struct->clearValueCount];
+        pClearValues = vl_safe_new_array<VkClearValue>(in_struct->clearValueCount);
         memcpy ((void *)pClearValues, (void *)in_struct->pClearValues, sizeof(VkClearValue)*in_struct->clearValueCount);
     }
 }
@@ -5401,7 +6154,7 @@ safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(const safe_VkRenderPassBe
     clearValueCount = src.clearValueCount;
     pClearValues = nullptr;
     if (src.pClearValues) {
-        pClearValues = new VkClearValue[src.clearValueCount];
+        pClearValues = vl_safe_new_array<VkClearValue>(src.clearValueCount);
         memcpy ((void *)pClearValues, (void *)src.pClearValues, sizeof(VkClearValue)*src.clearValueCount);
     }
 }
@@ -5411,7 +6164,7 @@ safe_VkRenderPassBeginInfo& safe_VkRenderPassBeginInfo::operator=(const safe_VkR
     if (&src == this) return *this;
 
     if (pClearValues)
-        delete[] pClearValues;
+        vl_safe_delete_array(pClearValues);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -5421,17 +6174,34 @@ safe_VkRenderPassBeginInfo& safe_VkRenderPassBeginInfo::operator=(const safe_VkR
     clearValueCount = src.clearValueCount;
     pClearValues = nullptr;
     if (src.pClearValues) {
-        pClearValues = new VkClearValue[src.clearValueCount];
+        pClearValues = vl_safe_new_array<VkClearValue>(src.clearValueCount);
         memcpy ((void *)pClearValues, (void *)src.pClearValues, sizeof(VkClearValue)*src.clearValueCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassBeginInfo::safe_VkRenderPassBeginInfo(safe_VkRenderPassBeginInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassBeginInfo));
+    new (&src) safe_VkRenderPassBeginInfo();
+}
+
+safe_VkRenderPassBeginInfo& safe_VkRenderPassBeginInfo::operator=(safe_VkRenderPassBeginInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassBeginInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassBeginInfo));
+    new (&src) safe_VkRenderPassBeginInfo();
+
+    return *this;
+}
+
 safe_VkRenderPassBeginInfo::~safe_VkRenderPassBeginInfo()
 {
     if (pClearValues)
-        delete[] pClearValues;
+        vl_safe_delete_array(pClearValues);
 }
 
 void safe_VkRenderPassBeginInfo::initialize(const VkRenderPassBeginInfo* in_struct)
@@ -5444,7 +6214,7 @@ void safe_VkRenderPassBeginInfo::initialize(const VkRenderPassBeginInfo* in_stru
     clearValueCount = in_struct->clearValueCount;
     pClearValues = nullptr;
     if (in_struct->pClearValues) {
-        pClearValues = new VkClearValue[in_struct->clearValueCount];
+        pClearValues = vl_safe_new_array<VkClearValue>(in_struct->clearValueCount);
         memcpy ((void *)pClearValues, (void *)in_struct->pClearValues, sizeof(VkClearValue)*in_struct->clearValueCount);
     }
 }
@@ -5459,7 +6229,7 @@ void safe_VkRenderPassBeginInfo::initialize(const safe_VkRenderPassBeginInfo* sr
     clearValueCount = src->clearValueCount;
     pClearValues = nullptr;
     if (src->pClearValues) {
-        pClearValues = new VkClearValue[src->clearValueCount];
+        pClearValues = vl_safe_new_array<VkClearValue>(src->clearValueCount);
         memcpy ((void *)pClearValues, (void *)src->pClearValues, sizeof(VkClearValue)*src->clearValueCount);
     }
 }
@@ -5468,7 +6238,7 @@ safe_VkBaseOutStructure::safe_VkBaseOutStructure(const VkBaseOutStructure* in_st
     sType(in_struct->sType)
 {
     if (in_struct->pNext)
-        pNext = new safe_VkBaseOutStructure(in_struct->pNext);
+        pNext = vl_safe_new<safe_VkBaseOutStructure>(in_struct->pNext);
     else
         pNext = NULL;
 }
@@ -5480,7 +6250,7 @@ safe_VkBaseOutStructure::safe_VkBaseOutStructure(const safe_VkBaseOutStructure&
 {
     sType = src.sType;
     if (src.pNext)
-        pNext = new safe_VkBaseOutStructure(*src.pNext);
+        pNext = vl_safe_new<safe_VkBaseOutStructure>(*src.pNext);
     else
         pNext = NULL;
 }
@@ -5490,28 +6260,45 @@ safe_VkBaseOutStructure& safe_VkBaseOutStructure::operator=(const safe_VkBaseOut
     if (&src == this) return *this;
 
     if (pNext)
-        delete pNext;
+        vl_safe_delete(pNext);
 
     sType = src.sType;
     if (src.pNext)
-        pNext = new safe_VkBaseOutStructure(*src.pNext);
+        pNext = vl_safe_new<safe_VkBaseOutStructure>(*src.pNext);
     else
         pNext = NULL;
 
     return *this;
 }
 
+safe_VkBaseOutStructure::safe_VkBaseOutStructure(safe_VkBaseOutStructure&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBaseOutStructure));
+    new (&src) safe_VkBaseOutStructure();
+}
+
+safe_VkBaseOutStructure& safe_VkBaseOutStructure::operator=(safe_VkBaseOutStructure&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBaseOutStructure();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBaseOutStructure));
+    new (&src) safe_VkBaseOutStructure();
+
+    return *this;
+}
+
 safe_VkBaseOutStructure::~safe_VkBaseOutStructure()
 {
     if (pNext)
-        delete pNext;
+        vl_safe_delete(pNext);
 }
 
 void safe_VkBaseOutStructure::initialize(const VkBaseOutStructure* in_struct)
 {
     sType = in_struct->sType;
     if (in_struct->pNext)
-        pNext = new safe_VkBaseOutStructure(in_struct->pNext);
+        pNext = vl_safe_new<safe_VkBaseOutStructure>(in_struct->pNext);
     else
         pNext = NULL;
 }
@@ -5520,7 +6307,7 @@ void safe_VkBaseOutStructure::initialize(const safe_VkBaseOutStructure* src)
 {
     sType = src->sType;
     if (src->pNext)
-        pNext = new safe_VkBaseOutStructure(*src->pNext);
+        pNext = vl_safe_new<safe_VkBaseOutStructure>(*src->pNext);
     else
         pNext = NULL;
 }
@@ -5529,7 +6316,7 @@ safe_VkBaseInStructure::safe_VkBaseInStructure(const VkBaseInStructure* in_struc
     sType(in_struct->sType)
 {
     if (in_struct->pNext)
-        pNext = new safe_VkBaseInStructure(in_struct->pNext);
+        pNext = vl_safe_new<safe_VkBaseInStructure>(in_struct->pNext);
     else
         pNext = NULL;
 }
@@ -5541,7 +6328,7 @@ safe_VkBaseInStructure::safe_VkBaseInStructure(const safe_VkBaseInStructure& src
 {
     sType = src.sType;
     if (src.pNext)
-        pNext = new safe_VkBaseInStructure(*src.pNext);
+        pNext = vl_safe_new<safe_VkBaseInStructure>(*src.pNext);
     else
         pNext = NULL;
 }
@@ -5551,28 +6338,45 @@ safe_VkBaseInStructure& safe_VkBaseInStructure::operator=(const safe_VkBaseInStr
     if (&src == this) return *this;
 
     if (pNext)
-        delete pNext;
+        vl_safe_delete(pNext);
 
     sType = src.sType;
     if (src.pNext)
-        pNext = new safe_VkBaseInStructure(*src.pNext);
+        pNext = vl_safe_new<safe_VkBaseInStructure>(*src.pNext);
     else
         pNext = NULL;
 
     return *this;
 }
 
+safe_VkBaseInStructure::safe_VkBaseInStructure(safe_VkBaseInStructure&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBaseInStructure));
+    new (&src) safe_VkBaseInStructure();
+}
+
+safe_VkBaseInStructure& safe_VkBaseInStructure::operator=(safe_VkBaseInStructure&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBaseInStructure();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBaseInStructure));
+    new (&src) safe_VkBaseInStructure();
+
+    return *this;
+}
+
 safe_VkBaseInStructure::~safe_VkBaseInStructure()
 {
     if (pNext)
-        delete pNext;
+        vl_safe_delete(pNext);
 }
 
 void safe_VkBaseInStructure::initialize(const VkBaseInStructure* in_struct)
 {
     sType = in_struct->sType;
     if (in_struct->pNext)
-        pNext = new safe_VkBaseInStructure(in_struct->pNext);
+        pNext = vl_safe_new<safe_VkBaseInStructure>(in_struct->pNext);
     else
         pNext = NULL;
 }
@@ -5581,7 +6385,7 @@ void safe_VkBaseInStructure::initialize(const safe_VkBaseInStructure* src)
 {
     sType = src->sType;
     if (src->pNext)
-        pNext = new safe_VkBaseInStructure(*src->pNext);
+        pNext = vl_safe_new<safe_VkBaseInStructure>(*src->pNext);
     else
         pNext = NULL;
 }
@@ -5624,6 +6428,23 @@ safe_VkPhysicalDeviceSubgroupProperties& safe_VkPhysicalDeviceSubgroupProperties
     return *this;
 }
 
+safe_VkPhysicalDeviceSubgroupProperties::safe_VkPhysicalDeviceSubgroupProperties(safe_VkPhysicalDeviceSubgroupProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSubgroupProperties));
+    new (&src) safe_VkPhysicalDeviceSubgroupProperties();
+}
+
+safe_VkPhysicalDeviceSubgroupProperties& safe_VkPhysicalDeviceSubgroupProperties::operator=(safe_VkPhysicalDeviceSubgroupProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceSubgroupProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSubgroupProperties));
+    new (&src) safe_VkPhysicalDeviceSubgroupProperties();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSubgroupProperties::~safe_VkPhysicalDeviceSubgroupProperties()
 {
 }
@@ -5683,6 +6504,23 @@ safe_VkBindBufferMemoryInfo& safe_VkBindBufferMemoryInfo::operator=(const safe_V
     return *this;
 }
 
+safe_VkBindBufferMemoryInfo::safe_VkBindBufferMemoryInfo(safe_VkBindBufferMemoryInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindBufferMemoryInfo));
+    new (&src) safe_VkBindBufferMemoryInfo();
+}
+
+safe_VkBindBufferMemoryInfo& safe_VkBindBufferMemoryInfo::operator=(safe_VkBindBufferMemoryInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindBufferMemoryInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindBufferMemoryInfo));
+    new (&src) safe_VkBindBufferMemoryInfo();
+
+    return *this;
+}
+
 safe_VkBindBufferMemoryInfo::~safe_VkBindBufferMemoryInfo()
 {
 }
@@ -5740,6 +6578,23 @@ safe_VkBindImageMemoryInfo& safe_VkBindImageMemoryInfo::operator=(const safe_VkB
     return *this;
 }
 
+safe_VkBindImageMemoryInfo::safe_VkBindImageMemoryInfo(safe_VkBindImageMemoryInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImageMemoryInfo));
+    new (&src) safe_VkBindImageMemoryInfo();
+}
+
+safe_VkBindImageMemoryInfo& safe_VkBindImageMemoryInfo::operator=(safe_VkBindImageMemoryInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindImageMemoryInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImageMemoryInfo));
+    new (&src) safe_VkBindImageMemoryInfo();
+
+    return *this;
+}
+
 safe_VkBindImageMemoryInfo::~safe_VkBindImageMemoryInfo()
 {
 }
@@ -5800,6 +6655,23 @@ safe_VkPhysicalDevice16BitStorageFeatures& safe_VkPhysicalDevice16BitStorageFeat
     return *this;
 }
 
+safe_VkPhysicalDevice16BitStorageFeatures::safe_VkPhysicalDevice16BitStorageFeatures(safe_VkPhysicalDevice16BitStorageFeatures&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevice16BitStorageFeatures));
+    new (&src) safe_VkPhysicalDevice16BitStorageFeatures();
+}
+
+safe_VkPhysicalDevice16BitStorageFeatures& safe_VkPhysicalDevice16BitStorageFeatures::operator=(safe_VkPhysicalDevice16BitStorageFeatures&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDevice16BitStorageFeatures();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevice16BitStorageFeatures));
+    new (&src) safe_VkPhysicalDevice16BitStorageFeatures();
+
+    return *this;
+}
+
 safe_VkPhysicalDevice16BitStorageFeatures::~safe_VkPhysicalDevice16BitStorageFeatures()
 {
 }
@@ -5856,6 +6728,23 @@ safe_VkMemoryDedicatedRequirements& safe_VkMemoryDedicatedRequirements::operator
     return *this;
 }
 
+safe_VkMemoryDedicatedRequirements::safe_VkMemoryDedicatedRequirements(safe_VkMemoryDedicatedRequirements&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryDedicatedRequirements));
+    new (&src) safe_VkMemoryDedicatedRequirements();
+}
+
+safe_VkMemoryDedicatedRequirements& safe_VkMemoryDedicatedRequirements::operator=(safe_VkMemoryDedicatedRequirements&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryDedicatedRequirements();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryDedicatedRequirements));
+    new (&src) safe_VkMemoryDedicatedRequirements();
+
+    return *this;
+}
+
 safe_VkMemoryDedicatedRequirements::~safe_VkMemoryDedicatedRequirements()
 {
 }
@@ -5908,6 +6797,23 @@ safe_VkMemoryDedicatedAllocateInfo& safe_VkMemoryDedicatedAllocateInfo::operator
     return *this;
 }
 
+safe_VkMemoryDedicatedAllocateInfo::safe_VkMemoryDedicatedAllocateInfo(safe_VkMemoryDedicatedAllocateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryDedicatedAllocateInfo));
+    new (&src) safe_VkMemoryDedicatedAllocateInfo();
+}
+
+safe_VkMemoryDedicatedAllocateInfo& safe_VkMemoryDedicatedAllocateInfo::operator=(safe_VkMemoryDedicatedAllocateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryDedicatedAllocateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryDedicatedAllocateInfo));
+    new (&src) safe_VkMemoryDedicatedAllocateInfo();
+
+    return *this;
+}
+
 safe_VkMemoryDedicatedAllocateInfo::~safe_VkMemoryDedicatedAllocateInfo()
 {
 }
@@ -5960,6 +6866,23 @@ safe_VkMemoryAllocateFlagsInfo& safe_VkMemoryAllocateFlagsInfo::operator=(const
     return *this;
 }
 
+safe_VkMemoryAllocateFlagsInfo::safe_VkMemoryAllocateFlagsInfo(safe_VkMemoryAllocateFlagsInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryAllocateFlagsInfo));
+    new (&src) safe_VkMemoryAllocateFlagsInfo();
+}
+
+safe_VkMemoryAllocateFlagsInfo& safe_VkMemoryAllocateFlagsInfo::operator=(safe_VkMemoryAllocateFlagsInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryAllocateFlagsInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryAllocateFlagsInfo));
+    new (&src) safe_VkMemoryAllocateFlagsInfo();
+
+    return *this;
+}
+
 safe_VkMemoryAllocateFlagsInfo::~safe_VkMemoryAllocateFlagsInfo()
 {
 }
@@ -5988,7 +6911,7 @@ safe_VkDeviceGroupRenderPassBeginInfo::safe_VkDeviceGroupRenderPassBeginInfo(con
     pDeviceRenderAreas(nullptr)
 {
     if (in_struct->pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[in_struct->deviceRenderAreaCount];
+        pDeviceRenderAreas = vl_safe_new_array<VkRect2D>(in_struct->deviceRenderAreaCount);
         memcpy ((void *)pDeviceRenderAreas, (void *)in_struct->pDeviceRenderAreas, sizeof(VkRect2D)*in_struct->deviceRenderAreaCount);
     }
 }
@@ -6005,7 +6928,7 @@ safe_VkDeviceGroupRenderPassBeginInfo::safe_VkDeviceGroupRenderPassBeginInfo(con
     deviceRenderAreaCount = src.deviceRenderAreaCount;
     pDeviceRenderAreas = nullptr;
     if (src.pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[src.deviceRenderAreaCount];
+        pDeviceRenderAreas = vl_safe_new_array<VkRect2D>(src.deviceRenderAreaCount);
         memcpy ((void *)pDeviceRenderAreas, (void *)src.pDeviceRenderAreas, sizeof(VkRect2D)*src.deviceRenderAreaCount);
     }
 }
@@ -6015,7 +6938,7 @@ safe_VkDeviceGroupRenderPassBeginInfo& safe_VkDeviceGroupRenderPassBeginInfo::op
     if (&src == this) return *this;
 
     if (pDeviceRenderAreas)
-        delete[] pDeviceRenderAreas;
+        vl_safe_delete_array(pDeviceRenderAreas);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -6023,17 +6946,34 @@ safe_VkDeviceGroupRenderPassBeginInfo& safe_VkDeviceGroupRenderPassBeginInfo::op
     deviceRenderAreaCount = src.deviceRenderAreaCount;
     pDeviceRenderAreas = nullptr;
     if (src.pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[src.deviceRenderAreaCount];
+        pDeviceRenderAreas = vl_safe_new_array<VkRect2D>(src.deviceRenderAreaCount);
         memcpy ((void *)pDeviceRenderAreas, (void *)src.pDeviceRenderAreas, sizeof(VkRect2D)*src.deviceRenderAreaCount);
     }
 
     return *this;
 }
 
+safe_VkDeviceGroupRenderPassBeginInfo::safe_VkDeviceGroupRenderPassBeginInfo(safe_VkDeviceGroupRenderPassBeginInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupRenderPassBeginInfo));
+    new (&src) safe_VkDeviceGroupRenderPassBeginInfo();
+}
+
+safe_VkDeviceGroupRenderPassBeginInfo& safe_VkDeviceGroupRenderPassBeginInfo::operator=(safe_VkDeviceGroupRenderPassBeginInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupRenderPassBeginInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupRenderPassBeginInfo));
+    new (&src) safe_VkDeviceGroupRenderPassBeginInfo();
+
+    return *this;
+}
+
 safe_VkDeviceGroupRenderPassBeginInfo::~safe_VkDeviceGroupRenderPassBeginInfo()
 {
     if (pDeviceRenderAreas)
-        delete[] pDeviceRenderAreas;
+        vl_safe_delete_array(pDeviceRenderAreas);
 }
 
 void safe_VkDeviceGroupRenderPassBeginInfo::initialize(const VkDeviceGroupRenderPassBeginInfo* in_struct)
@@ -6044,7 +6984,7 @@ void safe_VkDeviceGroupRenderPassBeginInfo::initialize(const VkDeviceGroupRender
     deviceRenderAreaCount = in_struct->deviceRenderAreaCount;
     pDeviceRenderAreas = nullptr;
     if (in_struct->pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[in_struct->deviceRenderAreaCount];
+        pDeviceRenderAreas = vl_safe_new_array<VkRect2D>(in_struct->deviceRenderAreaCount);
         memcpy ((void *)pDeviceRenderAreas, (void *)in_struct->pDeviceRenderAreas, sizeof(VkRect2D)*in_struct->deviceRenderAreaCount);
     }
 }
@@ -6057,7 +6997,7 @@ void safe_VkDeviceGroupRenderPassBeginInfo::initialize(const safe_VkDeviceGroupR
     deviceRenderAreaCount = src->deviceRenderAreaCount;
     pDeviceRenderAreas = nullptr;
     if (src->pDeviceRenderAreas) {
-        pDeviceRenderAreas = new VkRect2D[src->deviceRenderAreaCount];
+        pDeviceRenderAreas = vl_safe_new_array<VkRect2D>(src->deviceRenderAreaCount);
         memcpy ((void *)pDeviceRenderAreas, (void *)src->pDeviceRenderAreas, sizeof(VkRect2D)*src->deviceRenderAreaCount);
     }
 }
@@ -6091,6 +7031,23 @@ safe_VkDeviceGroupCommandBufferBeginInfo& safe_VkDeviceGroupCommandBufferBeginIn
     return *this;
 }
 
+safe_VkDeviceGroupCommandBufferBeginInfo::safe_VkDeviceGroupCommandBufferBeginInfo(safe_VkDeviceGroupCommandBufferBeginInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupCommandBufferBeginInfo));
+    new (&src) safe_VkDeviceGroupCommandBufferBeginInfo();
+}
+
+safe_VkDeviceGroupCommandBufferBeginInfo& safe_VkDeviceGroupCommandBufferBeginInfo::operator=(safe_VkDeviceGroupCommandBufferBeginInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupCommandBufferBeginInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupCommandBufferBeginInfo));
+    new (&src) safe_VkDeviceGroupCommandBufferBeginInfo();
+
+    return *this;
+}
+
 safe_VkDeviceGroupCommandBufferBeginInfo::~safe_VkDeviceGroupCommandBufferBeginInfo()
 {
 }
@@ -6120,15 +7077,15 @@ safe_VkDeviceGroupSubmitInfo::safe_VkDeviceGroupSubmitInfo(const VkDeviceGroupSu
     pSignalSemaphoreDeviceIndices(nullptr)
 {
     if (in_struct->pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[in_struct->waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->waitSemaphoreCount);
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)in_struct->pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[in_struct->commandBufferCount];
+        pCommandBufferDeviceMasks = vl_safe_new_array<uint32_t>(in_struct->commandBufferCount);
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)in_struct->pCommandBufferDeviceMasks, sizeof(uint32_t)*in_struct->commandBufferCount);
     }
     if (in_struct->pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[in_struct->signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->signalSemaphoreCount);
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)in_struct->pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->signalSemaphoreCount);
     }
 }
@@ -6150,15 +7107,15 @@ safe_VkDeviceGroupSubmitInfo::safe_VkDeviceGroupSubmitInfo(const safe_VkDeviceGr
     signalSemaphoreCount = src.signalSemaphoreCount;
     pSignalSemaphoreDeviceIndices = nullptr;
     if (src.pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[src.waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(src.waitSemaphoreCount);
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)src.pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*src.waitSemaphoreCount);
     }
     if (src.pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[src.commandBufferCount];
+        pCommandBufferDeviceMasks = vl_safe_new_array<uint32_t>(src.commandBufferCount);
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)src.pCommandBufferDeviceMasks, sizeof(uint32_t)*src.commandBufferCount);
     }
     if (src.pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[src.signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(src.signalSemaphoreCount);
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)src.pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*src.signalSemaphoreCount);
     }
 }
@@ -6168,11 +7125,11 @@ safe_VkDeviceGroupSubmitInfo& safe_VkDeviceGroupSubmitInfo::operator=(const safe
     if (&src == this) return *this;
 
     if (pWaitSemaphoreDeviceIndices)
-        delete[] pWaitSemaphoreDeviceIndices;
+        vl_safe_delete_array(pWaitSemaphoreDeviceIndices);
     if (pCommandBufferDeviceMasks)
-        delete[] pCommandBufferDeviceMasks;
+        vl_safe_delete_array(pCommandBufferDeviceMasks);
     if (pSignalSemaphoreDeviceIndices)
-        delete[] pSignalSemaphoreDeviceIndices;
+        vl_safe_delete_array(pSignalSemaphoreDeviceIndices);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -6183,29 +7140,46 @@ safe_VkDeviceGroupSubmitInfo& safe_VkDeviceGroupSubmitInfo::operator=(const safe
     signalSemaphoreCount = src.signalSemaphoreCount;
     pSignalSemaphoreDeviceIndices = nullptr;
     if (src.pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[src.waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(src.waitSemaphoreCount);
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)src.pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*src.waitSemaphoreCount);
     }
     if (src.pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[src.commandBufferCount];
+        pCommandBufferDeviceMasks = vl_safe_new_array<uint32_t>(src.commandBufferCount);
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)src.pCommandBufferDeviceMasks, sizeof(uint32_t)*src.commandBufferCount);
     }
     if (src.pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[src.signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(src.signalSemaphoreCount);
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)src.pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*src.signalSemaphoreCount);
     }
 
     return *this;
 }
 
+safe_VkDeviceGroupSubmitInfo::safe_VkDeviceGroupSubmitInfo(safe_VkDeviceGroupSubmitInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupSubmitInfo));
+    new (&src) safe_VkDeviceGroupSubmitInfo();
+}
+
+safe_VkDeviceGroupSubmitInfo& safe_VkDeviceGroupSubmitInfo::operator=(safe_VkDeviceGroupSubmitInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupSubmitInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupSubmitInfo));
+    new (&src) safe_VkDeviceGroupSubmitInfo();
+
+    return *this;
+}
+
 safe_VkDeviceGroupSubmitInfo::~safe_VkDeviceGroupSubmitInfo()
 {
     if (pWaitSemaphoreDeviceIndices)
-        delete[] pWaitSemaphoreDeviceIndices;
+        vl_safe_delete_array(pWaitSemaphoreDeviceIndices);
     if (pCommandBufferDeviceMasks)
-        delete[] pCommandBufferDeviceMasks;
+        vl_safe_delete_array(pCommandBufferDeviceMasks);
     if (pSignalSemaphoreDeviceIndices)
-        delete[] pSignalSemaphoreDeviceIndices;
+        vl_safe_delete_array(pSignalSemaphoreDeviceIndices);
 }
 
 void safe_VkDeviceGroupSubmitInfo::initialize(const VkDeviceGroupSubmitInfo* in_struct)
@@ -6219,15 +7193,15 @@ void safe_VkDeviceGroupSubmitInfo::initialize(const VkDeviceGroupSubmitInfo* in_
     signalSemaphoreCount = in_struct->signalSemaphoreCount;
     pSignalSemaphoreDeviceIndices = nullptr;
     if (in_struct->pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[in_struct->waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->waitSemaphoreCount);
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)in_struct->pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->waitSemaphoreCount);
     }
     if (in_struct->pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[in_struct->commandBufferCount];
+        pCommandBufferDeviceMasks = vl_safe_new_array<uint32_t>(in_struct->commandBufferCount);
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)in_struct->pCommandBufferDeviceMasks, sizeof(uint32_t)*in_struct->commandBufferCount);
     }
     if (in_struct->pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[in_struct->signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->signalSemaphoreCount);
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)in_struct->pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*in_struct->signalSemaphoreCount);
     }
 }
@@ -6243,15 +7217,15 @@ void safe_VkDeviceGroupSubmitInfo::initialize(const safe_VkDeviceGroupSubmitInfo
     signalSemaphoreCount = src->signalSemaphoreCount;
     pSignalSemaphoreDeviceIndices = nullptr;
     if (src->pWaitSemaphoreDeviceIndices) {
-        pWaitSemaphoreDeviceIndices = new uint32_t[src->waitSemaphoreCount];
+        pWaitSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(src->waitSemaphoreCount);
         memcpy ((void *)pWaitSemaphoreDeviceIndices, (void *)src->pWaitSemaphoreDeviceIndices, sizeof(uint32_t)*src->waitSemaphoreCount);
     }
     if (src->pCommandBufferDeviceMasks) {
-        pCommandBufferDeviceMasks = new uint32_t[src->commandBufferCount];
+        pCommandBufferDeviceMasks = vl_safe_new_array<uint32_t>(src->commandBufferCount);
         memcpy ((void *)pCommandBufferDeviceMasks, (void *)src->pCommandBufferDeviceMasks, sizeof(uint32_t)*src->commandBufferCount);
     }
     if (src->pSignalSemaphoreDeviceIndices) {
-        pSignalSemaphoreDeviceIndices = new uint32_t[src->signalSemaphoreCount];
+        pSignalSemaphoreDeviceIndices = vl_safe_new_array<uint32_t>(src->signalSemaphoreCount);
         memcpy ((void *)pSignalSemaphoreDeviceIndices, (void *)src->pSignalSemaphoreDeviceIndices, sizeof(uint32_t)*src->signalSemaphoreCount);
     }
 }
@@ -6288,6 +7262,23 @@ safe_VkDeviceGroupBindSparseInfo& safe_VkDeviceGroupBindSparseInfo::operator=(co
     return *this;
 }
 
+safe_VkDeviceGroupBindSparseInfo::safe_VkDeviceGroupBindSparseInfo(safe_VkDeviceGroupBindSparseInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupBindSparseInfo));
+    new (&src) safe_VkDeviceGroupBindSparseInfo();
+}
+
+safe_VkDeviceGroupBindSparseInfo& safe_VkDeviceGroupBindSparseInfo::operator=(safe_VkDeviceGroupBindSparseInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupBindSparseInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupBindSparseInfo));
+    new (&src) safe_VkDeviceGroupBindSparseInfo();
+
+    return *this;
+}
+
 safe_VkDeviceGroupBindSparseInfo::~safe_VkDeviceGroupBindSparseInfo()
 {
 }
@@ -6315,7 +7306,7 @@ safe_VkBindBufferMemoryDeviceGroupInfo::safe_VkBindBufferMemoryDeviceGroupInfo(c
     pDeviceIndices(nullptr)
 {
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -6331,7 +7322,7 @@ safe_VkBindBufferMemoryDeviceGroupInfo::safe_VkBindBufferMemoryDeviceGroupInfo(c
     deviceIndexCount = src.deviceIndexCount;
     pDeviceIndices = nullptr;
     if (src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src.deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src.deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src.pDeviceIndices, sizeof(uint32_t)*src.deviceIndexCount);
     }
 }
@@ -6341,24 +7332,41 @@ safe_VkBindBufferMemoryDeviceGroupInfo& safe_VkBindBufferMemoryDeviceGroupInfo::
     if (&src == this) return *this;
 
     if (pDeviceIndices)
-        delete[] pDeviceIndices;
+        vl_safe_delete_array(pDeviceIndices);
 
     sType = src.sType;
     pNext = src.pNext;
     deviceIndexCount = src.deviceIndexCount;
     pDeviceIndices = nullptr;
     if (src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src.deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src.deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src.pDeviceIndices, sizeof(uint32_t)*src.deviceIndexCount);
     }
 
     return *this;
 }
 
+safe_VkBindBufferMemoryDeviceGroupInfo::safe_VkBindBufferMemoryDeviceGroupInfo(safe_VkBindBufferMemoryDeviceGroupInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindBufferMemoryDeviceGroupInfo));
+    new (&src) safe_VkBindBufferMemoryDeviceGroupInfo();
+}
+
+safe_VkBindBufferMemoryDeviceGroupInfo& safe_VkBindBufferMemoryDeviceGroupInfo::operator=(safe_VkBindBufferMemoryDeviceGroupInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindBufferMemoryDeviceGroupInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindBufferMemoryDeviceGroupInfo));
+    new (&src) safe_VkBindBufferMemoryDeviceGroupInfo();
+
+    return *this;
+}
+
 safe_VkBindBufferMemoryDeviceGroupInfo::~safe_VkBindBufferMemoryDeviceGroupInfo()
 {
     if (pDeviceIndices)
-        delete[] pDeviceIndices;
+        vl_safe_delete_array(pDeviceIndices);
 }
 
 void safe_VkBindBufferMemoryDeviceGroupInfo::initialize(const VkBindBufferMemoryDeviceGroupInfo* in_struct)
@@ -6368,7 +7376,7 @@ void safe_VkBindBufferMemoryDeviceGroupInfo::initialize(const VkBindBufferMemory
     deviceIndexCount = in_struct->deviceIndexCount;
     pDeviceIndices = nullptr;
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -6380,7 +7388,7 @@ void safe_VkBindBufferMemoryDeviceGroupInfo::initialize(const safe_VkBindBufferM
     deviceIndexCount = src->deviceIndexCount;
     pDeviceIndices = nullptr;
     if (src->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src->pDeviceIndices, sizeof(uint32_t)*src->deviceIndexCount);
     }
 }
@@ -6394,11 +7402,11 @@ safe_VkBindImageMemoryDeviceGroupInfo::safe_VkBindImageMemoryDeviceGroupInfo(con
     pSplitInstanceBindRegions(nullptr)
 {
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
     if (in_struct->pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[in_struct->splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = vl_safe_new_array<VkRect2D>(in_struct->splitInstanceBindRegionCount);
         memcpy ((void *)pSplitInstanceBindRegions, (void *)in_struct->pSplitInstanceBindRegions, sizeof(VkRect2D)*in_struct->splitInstanceBindRegionCount);
     }
 }
@@ -6417,11 +7425,11 @@ safe_VkBindImageMemoryDeviceGroupInfo::safe_VkBindImageMemoryDeviceGroupInfo(con
     splitInstanceBindRegionCount = src.splitInstanceBindRegionCount;
     pSplitInstanceBindRegions = nullptr;
     if (src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src.deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src.deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src.pDeviceIndices, sizeof(uint32_t)*src.deviceIndexCount);
     }
     if (src.pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[src.splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = vl_safe_new_array<VkRect2D>(src.splitInstanceBindRegionCount);
         memcpy ((void *)pSplitInstanceBindRegions, (void *)src.pSplitInstanceBindRegions, sizeof(VkRect2D)*src.splitInstanceBindRegionCount);
     }
 }
@@ -6431,9 +7439,9 @@ safe_VkBindImageMemoryDeviceGroupInfo& safe_VkBindImageMemoryDeviceGroupInfo::op
     if (&src == this) return *this;
 
     if (pDeviceIndices)
-        delete[] pDeviceIndices;
+        vl_safe_delete_array(pDeviceIndices);
     if (pSplitInstanceBindRegions)
-        delete[] pSplitInstanceBindRegions;
+        vl_safe_delete_array(pSplitInstanceBindRegions);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -6442,23 +7450,40 @@ safe_VkBindImageMemoryDeviceGroupInfo& safe_VkBindImageMemoryDeviceGroupInfo::op
     splitInstanceBindRegionCount = src.splitInstanceBindRegionCount;
     pSplitInstanceBindRegions = nullptr;
     if (src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src.deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src.deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src.pDeviceIndices, sizeof(uint32_t)*src.deviceIndexCount);
     }
     if (src.pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[src.splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = vl_safe_new_array<VkRect2D>(src.splitInstanceBindRegionCount);
         memcpy ((void *)pSplitInstanceBindRegions, (void *)src.pSplitInstanceBindRegions, sizeof(VkRect2D)*src.splitInstanceBindRegionCount);
     }
 
     return *this;
 }
 
+safe_VkBindImageMemoryDeviceGroupInfo::safe_VkBindImageMemoryDeviceGroupInfo(safe_VkBindImageMemoryDeviceGroupInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImageMemoryDeviceGroupInfo));
+    new (&src) safe_VkBindImageMemoryDeviceGroupInfo();
+}
+
+safe_VkBindImageMemoryDeviceGroupInfo& safe_VkBindImageMemoryDeviceGroupInfo::operator=(safe_VkBindImageMemoryDeviceGroupInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindImageMemoryDeviceGroupInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImageMemoryDeviceGroupInfo));
+    new (&src) safe_VkBindImageMemoryDeviceGroupInfo();
+
+    return *this;
+}
+
 safe_VkBindImageMemoryDeviceGroupInfo::~safe_VkBindImageMemoryDeviceGroupInfo()
 {
     if (pDeviceIndices)
-        delete[] pDeviceIndices;
+        vl_safe_delete_array(pDeviceIndices);
     if (pSplitInstanceBindRegions)
-        delete[] pSplitInstanceBindRegions;
+        vl_safe_delete_array(pSplitInstanceBindRegions);
 }
 
 void safe_VkBindImageMemoryDeviceGroupInfo::initialize(const VkBindImageMemoryDeviceGroupInfo* in_struct)
@@ -6470,11 +7495,11 @@ void safe_VkBindImageMemoryDeviceGroupInfo::initialize(const VkBindImageMemoryDe
     splitInstanceBindRegionCount = in_struct->splitInstanceBindRegionCount;
     pSplitInstanceBindRegions = nullptr;
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
     if (in_struct->pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[in_struct->splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = vl_safe_new_array<VkRect2D>(in_struct->splitInstanceBindRegionCount);
         memcpy ((void *)pSplitInstanceBindRegions, (void *)in_struct->pSplitInstanceBindRegions, sizeof(VkRect2D)*in_struct->splitInstanceBindRegionCount);
     }
 }
@@ -6488,11 +7513,11 @@ void safe_VkBindImageMemoryDeviceGroupInfo::initialize(const safe_VkBindImageMem
     splitInstanceBindRegionCount = src->splitInstanceBindRegionCount;
     pSplitInstanceBindRegions = nullptr;
     if (src->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src->pDeviceIndices, sizeof(uint32_t)*src->deviceIndexCount);
     }
     if (src->pSplitInstanceBindRegions) {
-        pSplitInstanceBindRegions = new VkRect2D[src->splitInstanceBindRegionCount];
+        pSplitInstanceBindRegions = vl_safe_new_array<VkRect2D>(src->splitInstanceBindRegionCount);
         memcpy ((void *)pSplitInstanceBindRegions, (void *)src->pSplitInstanceBindRegions, sizeof(VkRect2D)*src->splitInstanceBindRegionCount);
     }
 }
@@ -6503,9 +7528,7 @@ safe_VkPhysicalDeviceGroupProperties::safe_VkPhysicalDeviceGroupProperties(const
     physicalDeviceCount(in_struct->physicalDeviceCount),
     subsetAllocation(in_struct->subsetAllocation)
 {
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        physicalDevices[i] = in_struct->physicalDevices[i];
-    }
+    memcpy (physicalDevices, in_struct->physicalDevices, sizeof(physicalDevices));
 }
 
 safe_VkPhysicalDeviceGroupProperties::safe_VkPhysicalDeviceGroupProperties()
@@ -6517,9 +7540,7 @@ safe_VkPhysicalDeviceGroupProperties::safe_VkPhysicalDeviceGroupProperties(const
     pNext = src.pNext;
     physicalDeviceCount = src.physicalDeviceCount;
     subsetAllocation = src.subsetAllocation;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        physicalDevices[i] = src.physicalDevices[i];
-    }
+    memcpy (physicalDevices, src.physicalDevices, sizeof(physicalDevices));
 }
 
 safe_VkPhysicalDeviceGroupProperties& safe_VkPhysicalDeviceGroupProperties::operator=(const safe_VkPhysicalDeviceGroupProperties& src)
@@ -6531,9 +7552,24 @@ safe_VkPhysicalDeviceGroupProperties& safe_VkPhysicalDeviceGroupProperties::oper
     pNext = src.pNext;
     physicalDeviceCount = src.physicalDeviceCount;
     subsetAllocation = src.subsetAllocation;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        physicalDevices[i] = src.physicalDevices[i];
-    }
+    memcpy (physicalDevices, src.physicalDevices, sizeof(physicalDevices));
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceGroupProperties::safe_VkPhysicalDeviceGroupProperties(safe_VkPhysicalDeviceGroupProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceGroupProperties));
+    new (&src) safe_VkPhysicalDeviceGroupProperties();
+}
+
+safe_VkPhysicalDeviceGroupProperties& safe_VkPhysicalDeviceGroupProperties::operator=(safe_VkPhysicalDeviceGroupProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceGroupProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceGroupProperties));
+    new (&src) safe_VkPhysicalDeviceGroupProperties();
 
     return *this;
 }
@@ -6548,9 +7584,7 @@ void safe_VkPhysicalDeviceGroupProperties::initialize(const VkPhysicalDeviceGrou
     pNext = in_struct->pNext;
     physicalDeviceCount = in_struct->physicalDeviceCount;
     subsetAllocation = in_struct->subsetAllocation;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        physicalDevices[i] = in_struct->physicalDevices[i];
-    }
+    memcpy (physicalDevices, in_struct->physicalDevices, sizeof(physicalDevices));
 }
 
 void safe_VkPhysicalDeviceGroupProperties::initialize(const safe_VkPhysicalDeviceGroupProperties* src)
@@ -6559,9 +7593,7 @@ void safe_VkPhysicalDeviceGroupProperties::initialize(const safe_VkPhysicalDevic
     pNext = src->pNext;
     physicalDeviceCount = src->physicalDeviceCount;
     subsetAllocation = src->subsetAllocation;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        physicalDevices[i] = src->physicalDevices[i];
-    }
+    memcpy (physicalDevices, src->physicalDevices, sizeof(physicalDevices));
 }
 
 safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(const VkDeviceGroupDeviceCreateInfo* in_struct) :
@@ -6571,7 +7603,7 @@ safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(const VkD
     pPhysicalDevices(nullptr)
 {
     if (in_struct->pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[in_struct->physicalDeviceCount];
+        pPhysicalDevices = vl_safe_new_array<VkPhysicalDevice>(in_struct->physicalDeviceCount);
         memcpy ((void *)pPhysicalDevices, (void *)in_struct->pPhysicalDevices, sizeof(VkPhysicalDevice)*in_struct->physicalDeviceCount);
     }
 }
@@ -6587,7 +7619,7 @@ safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(const saf
     physicalDeviceCount = src.physicalDeviceCount;
     pPhysicalDevices = nullptr;
     if (src.pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[src.physicalDeviceCount];
+        pPhysicalDevices = vl_safe_new_array<VkPhysicalDevice>(src.physicalDeviceCount);
         memcpy ((void *)pPhysicalDevices, (void *)src.pPhysicalDevices, sizeof(VkPhysicalDevice)*src.physicalDeviceCount);
     }
 }
@@ -6597,24 +7629,41 @@ safe_VkDeviceGroupDeviceCreateInfo& safe_VkDeviceGroupDeviceCreateInfo::operator
     if (&src == this) return *this;
 
     if (pPhysicalDevices)
-        delete[] pPhysicalDevices;
+        vl_safe_delete_array(pPhysicalDevices);
 
     sType = src.sType;
     pNext = src.pNext;
     physicalDeviceCount = src.physicalDeviceCount;
     pPhysicalDevices = nullptr;
     if (src.pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[src.physicalDeviceCount];
+        pPhysicalDevices = vl_safe_new_array<VkPhysicalDevice>(src.physicalDeviceCount);
         memcpy ((void *)pPhysicalDevices, (void *)src.pPhysicalDevices, sizeof(VkPhysicalDevice)*src.physicalDeviceCount);
     }
 
     return *this;
 }
 
+safe_VkDeviceGroupDeviceCreateInfo::safe_VkDeviceGroupDeviceCreateInfo(safe_VkDeviceGroupDeviceCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupDeviceCreateInfo));
+    new (&src) safe_VkDeviceGroupDeviceCreateInfo();
+}
+
+safe_VkDeviceGroupDeviceCreateInfo& safe_VkDeviceGroupDeviceCreateInfo::operator=(safe_VkDeviceGroupDeviceCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupDeviceCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupDeviceCreateInfo));
+    new (&src) safe_VkDeviceGroupDeviceCreateInfo();
+
+    return *this;
+}
+
 safe_VkDeviceGroupDeviceCreateInfo::~safe_VkDeviceGroupDeviceCreateInfo()
 {
     if (pPhysicalDevices)
-        delete[] pPhysicalDevices;
+        vl_safe_delete_array(pPhysicalDevices);
 }
 
 void safe_VkDeviceGroupDeviceCreateInfo::initialize(const VkDeviceGroupDeviceCreateInfo* in_struct)
@@ -6624,7 +7673,7 @@ void safe_VkDeviceGroupDeviceCreateInfo::initialize(const VkDeviceGroupDeviceCre
     physicalDeviceCount = in_struct->physicalDeviceCount;
     pPhysicalDevices = nullptr;
     if (in_struct->pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[in_struct->physicalDeviceCount];
+        pPhysicalDevices = vl_safe_new_array<VkPhysicalDevice>(in_struct->physicalDeviceCount);
         memcpy ((void *)pPhysicalDevices, (void *)in_struct->pPhysicalDevices, sizeof(VkPhysicalDevice)*in_struct->physicalDeviceCount);
     }
 }
@@ -6636,7 +7685,7 @@ void safe_VkDeviceGroupDeviceCreateInfo::initialize(const safe_VkDeviceGroupDevi
     physicalDeviceCount = src->physicalDeviceCount;
     pPhysicalDevices = nullptr;
     if (src->pPhysicalDevices) {
-        pPhysicalDevices = new VkPhysicalDevice[src->physicalDeviceCount];
+        pPhysicalDevices = vl_safe_new_array<VkPhysicalDevice>(src->physicalDeviceCount);
         memcpy ((void *)pPhysicalDevices, (void *)src->pPhysicalDevices, sizeof(VkPhysicalDevice)*src->physicalDeviceCount);
     }
 }
@@ -6670,6 +7719,23 @@ safe_VkBufferMemoryRequirementsInfo2& safe_VkBufferMemoryRequirementsInfo2::oper
     return *this;
 }
 
+safe_VkBufferMemoryRequirementsInfo2::safe_VkBufferMemoryRequirementsInfo2(safe_VkBufferMemoryRequirementsInfo2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferMemoryRequirementsInfo2));
+    new (&src) safe_VkBufferMemoryRequirementsInfo2();
+}
+
+safe_VkBufferMemoryRequirementsInfo2& safe_VkBufferMemoryRequirementsInfo2::operator=(safe_VkBufferMemoryRequirementsInfo2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBufferMemoryRequirementsInfo2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferMemoryRequirementsInfo2));
+    new (&src) safe_VkBufferMemoryRequirementsInfo2();
+
+    return *this;
+}
+
 safe_VkBufferMemoryRequirementsInfo2::~safe_VkBufferMemoryRequirementsInfo2()
 {
 }
@@ -6717,6 +7783,23 @@ safe_VkImageMemoryRequirementsInfo2& safe_VkImageMemoryRequirementsInfo2::operat
     return *this;
 }
 
+safe_VkImageMemoryRequirementsInfo2::safe_VkImageMemoryRequirementsInfo2(safe_VkImageMemoryRequirementsInfo2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageMemoryRequirementsInfo2));
+    new (&src) safe_VkImageMemoryRequirementsInfo2();
+}
+
+safe_VkImageMemoryRequirementsInfo2& safe_VkImageMemoryRequirementsInfo2::operator=(safe_VkImageMemoryRequirementsInfo2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageMemoryRequirementsInfo2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageMemoryRequirementsInfo2));
+    new (&src) safe_VkImageMemoryRequirementsInfo2();
+
+    return *this;
+}
+
 safe_VkImageMemoryRequirementsInfo2::~safe_VkImageMemoryRequirementsInfo2()
 {
 }
@@ -6764,6 +7847,23 @@ safe_VkImageSparseMemoryRequirementsInfo2& safe_VkImageSparseMemoryRequirementsI
     return *this;
 }
 
+safe_VkImageSparseMemoryRequirementsInfo2::safe_VkImageSparseMemoryRequirementsInfo2(safe_VkImageSparseMemoryRequirementsInfo2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageSparseMemoryRequirementsInfo2));
+    new (&src) safe_VkImageSparseMemoryRequirementsInfo2();
+}
+
+safe_VkImageSparseMemoryRequirementsInfo2& safe_VkImageSparseMemoryRequirementsInfo2::operator=(safe_VkImageSparseMemoryRequirementsInfo2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageSparseMemoryRequirementsInfo2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageSparseMemoryRequirementsInfo2));
+    new (&src) safe_VkImageSparseMemoryRequirementsInfo2();
+
+    return *this;
+}
+
 safe_VkImageSparseMemoryRequirementsInfo2::~safe_VkImageSparseMemoryRequirementsInfo2()
 {
 }
@@ -6811,6 +7911,23 @@ safe_VkMemoryRequirements2& safe_VkMemoryRequirements2::operator=(const safe_VkM
     return *this;
 }
 
+safe_VkMemoryRequirements2::safe_VkMemoryRequirements2(safe_VkMemoryRequirements2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryRequirements2));
+    new (&src) safe_VkMemoryRequirements2();
+}
+
+safe_VkMemoryRequirements2& safe_VkMemoryRequirements2::operator=(safe_VkMemoryRequirements2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryRequirements2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryRequirements2));
+    new (&src) safe_VkMemoryRequirements2();
+
+    return *this;
+}
+
 safe_VkMemoryRequirements2::~safe_VkMemoryRequirements2()
 {
 }
@@ -6858,6 +7975,23 @@ safe_VkSparseImageMemoryRequirements2& safe_VkSparseImageMemoryRequirements2::op
     return *this;
 }
 
+safe_VkSparseImageMemoryRequirements2::safe_VkSparseImageMemoryRequirements2(safe_VkSparseImageMemoryRequirements2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageMemoryRequirements2));
+    new (&src) safe_VkSparseImageMemoryRequirements2();
+}
+
+safe_VkSparseImageMemoryRequirements2& safe_VkSparseImageMemoryRequirements2::operator=(safe_VkSparseImageMemoryRequirements2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSparseImageMemoryRequirements2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageMemoryRequirements2));
+    new (&src) safe_VkSparseImageMemoryRequirements2();
+
+    return *this;
+}
+
 safe_VkSparseImageMemoryRequirements2::~safe_VkSparseImageMemoryRequirements2()
 {
 }
@@ -6905,6 +8039,23 @@ safe_VkPhysicalDeviceFeatures2& safe_VkPhysicalDeviceFeatures2::operator=(const
     return *this;
 }
 
+safe_VkPhysicalDeviceFeatures2::safe_VkPhysicalDeviceFeatures2(safe_VkPhysicalDeviceFeatures2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFeatures2));
+    new (&src) safe_VkPhysicalDeviceFeatures2();
+}
+
+safe_VkPhysicalDeviceFeatures2& safe_VkPhysicalDeviceFeatures2::operator=(safe_VkPhysicalDeviceFeatures2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFeatures2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFeatures2));
+    new (&src) safe_VkPhysicalDeviceFeatures2();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFeatures2::~safe_VkPhysicalDeviceFeatures2()
 {
 }
@@ -6952,6 +8103,23 @@ safe_VkPhysicalDeviceProperties2& safe_VkPhysicalDeviceProperties2::operator=(co
     return *this;
 }
 
+safe_VkPhysicalDeviceProperties2::safe_VkPhysicalDeviceProperties2(safe_VkPhysicalDeviceProperties2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceProperties2));
+    new (&src) safe_VkPhysicalDeviceProperties2();
+}
+
+safe_VkPhysicalDeviceProperties2& safe_VkPhysicalDeviceProperties2::operator=(safe_VkPhysicalDeviceProperties2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceProperties2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceProperties2));
+    new (&src) safe_VkPhysicalDeviceProperties2();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProperties2::~safe_VkPhysicalDeviceProperties2()
 {
 }
@@ -6999,6 +8167,23 @@ safe_VkFormatProperties2& safe_VkFormatProperties2::operator=(const safe_VkForma
     return *this;
 }
 
+safe_VkFormatProperties2::safe_VkFormatProperties2(safe_VkFormatProperties2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFormatProperties2));
+    new (&src) safe_VkFormatProperties2();
+}
+
+safe_VkFormatProperties2& safe_VkFormatProperties2::operator=(safe_VkFormatProperties2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFormatProperties2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFormatProperties2));
+    new (&src) safe_VkFormatProperties2();
+
+    return *this;
+}
+
 safe_VkFormatProperties2::~safe_VkFormatProperties2()
 {
 }
@@ -7046,6 +8231,23 @@ safe_VkImageFormatProperties2& safe_VkImageFormatProperties2::operator=(const sa
     return *this;
 }
 
+safe_VkImageFormatProperties2::safe_VkImageFormatProperties2(safe_VkImageFormatProperties2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageFormatProperties2));
+    new (&src) safe_VkImageFormatProperties2();
+}
+
+safe_VkImageFormatProperties2& safe_VkImageFormatProperties2::operator=(safe_VkImageFormatProperties2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageFormatProperties2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageFormatProperties2));
+    new (&src) safe_VkImageFormatProperties2();
+
+    return *this;
+}
+
 safe_VkImageFormatProperties2::~safe_VkImageFormatProperties2()
 {
 }
@@ -7105,6 +8307,23 @@ safe_VkPhysicalDeviceImageFormatInfo2& safe_VkPhysicalDeviceImageFormatInfo2::op
     return *this;
 }
 
+safe_VkPhysicalDeviceImageFormatInfo2::safe_VkPhysicalDeviceImageFormatInfo2(safe_VkPhysicalDeviceImageFormatInfo2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImageFormatInfo2));
+    new (&src) safe_VkPhysicalDeviceImageFormatInfo2();
+}
+
+safe_VkPhysicalDeviceImageFormatInfo2& safe_VkPhysicalDeviceImageFormatInfo2::operator=(safe_VkPhysicalDeviceImageFormatInfo2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceImageFormatInfo2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImageFormatInfo2));
+    new (&src) safe_VkPhysicalDeviceImageFormatInfo2();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageFormatInfo2::~safe_VkPhysicalDeviceImageFormatInfo2()
 {
 }
@@ -7160,6 +8379,23 @@ safe_VkQueueFamilyProperties2& safe_VkQueueFamilyProperties2::operator=(const sa
     return *this;
 }
 
+safe_VkQueueFamilyProperties2::safe_VkQueueFamilyProperties2(safe_VkQueueFamilyProperties2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueueFamilyProperties2));
+    new (&src) safe_VkQueueFamilyProperties2();
+}
+
+safe_VkQueueFamilyProperties2& safe_VkQueueFamilyProperties2::operator=(safe_VkQueueFamilyProperties2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkQueueFamilyProperties2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueueFamilyProperties2));
+    new (&src) safe_VkQueueFamilyProperties2();
+
+    return *this;
+}
+
 safe_VkQueueFamilyProperties2::~safe_VkQueueFamilyProperties2()
 {
 }
@@ -7207,6 +8443,23 @@ safe_VkPhysicalDeviceMemoryProperties2& safe_VkPhysicalDeviceMemoryProperties2::
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryProperties2::safe_VkPhysicalDeviceMemoryProperties2(safe_VkPhysicalDeviceMemoryProperties2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMemoryProperties2));
+    new (&src) safe_VkPhysicalDeviceMemoryProperties2();
+}
+
+safe_VkPhysicalDeviceMemoryProperties2& safe_VkPhysicalDeviceMemoryProperties2::operator=(safe_VkPhysicalDeviceMemoryProperties2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMemoryProperties2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMemoryProperties2));
+    new (&src) safe_VkPhysicalDeviceMemoryProperties2();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryProperties2::~safe_VkPhysicalDeviceMemoryProperties2()
 {
 }
@@ -7254,6 +8507,23 @@ safe_VkSparseImageFormatProperties2& safe_VkSparseImageFormatProperties2::operat
     return *this;
 }
 
+safe_VkSparseImageFormatProperties2::safe_VkSparseImageFormatProperties2(safe_VkSparseImageFormatProperties2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageFormatProperties2));
+    new (&src) safe_VkSparseImageFormatProperties2();
+}
+
+safe_VkSparseImageFormatProperties2& safe_VkSparseImageFormatProperties2::operator=(safe_VkSparseImageFormatProperties2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSparseImageFormatProperties2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSparseImageFormatProperties2));
+    new (&src) safe_VkSparseImageFormatProperties2();
+
+    return *this;
+}
+
 safe_VkSparseImageFormatProperties2::~safe_VkSparseImageFormatProperties2()
 {
 }
@@ -7313,6 +8583,23 @@ safe_VkPhysicalDeviceSparseImageFormatInfo2& safe_VkPhysicalDeviceSparseImageFor
     return *this;
 }
 
+safe_VkPhysicalDeviceSparseImageFormatInfo2::safe_VkPhysicalDeviceSparseImageFormatInfo2(safe_VkPhysicalDeviceSparseImageFormatInfo2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSparseImageFormatInfo2));
+    new (&src) safe_VkPhysicalDeviceSparseImageFormatInfo2();
+}
+
+safe_VkPhysicalDeviceSparseImageFormatInfo2& safe_VkPhysicalDeviceSparseImageFormatInfo2::operator=(safe_VkPhysicalDeviceSparseImageFormatInfo2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceSparseImageFormatInfo2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSparseImageFormatInfo2));
+    new (&src) safe_VkPhysicalDeviceSparseImageFormatInfo2();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSparseImageFormatInfo2::~safe_VkPhysicalDeviceSparseImageFormatInfo2()
 {
 }
@@ -7368,6 +8655,23 @@ safe_VkPhysicalDevicePointClippingProperties& safe_VkPhysicalDevicePointClipping
     return *this;
 }
 
+safe_VkPhysicalDevicePointClippingProperties::safe_VkPhysicalDevicePointClippingProperties(safe_VkPhysicalDevicePointClippingProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevicePointClippingProperties));
+    new (&src) safe_VkPhysicalDevicePointClippingProperties();
+}
+
+safe_VkPhysicalDevicePointClippingProperties& safe_VkPhysicalDevicePointClippingProperties::operator=(safe_VkPhysicalDevicePointClippingProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDevicePointClippingProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevicePointClippingProperties));
+    new (&src) safe_VkPhysicalDevicePointClippingProperties();
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePointClippingProperties::~safe_VkPhysicalDevicePointClippingProperties()
 {
 }
@@ -7393,7 +8697,7 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo::safe_VkRenderPassInputAttachme
     pAspectReferences(nullptr)
 {
     if (in_struct->pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[in_struct->aspectReferenceCount];
+        pAspectReferences = vl_safe_new_array<VkInputAttachmentAspectReference>(in_struct->aspectReferenceCount);
         memcpy ((void *)pAspectReferences, (void *)in_struct->pAspectReferences, sizeof(VkInputAttachmentAspectReference)*in_struct->aspectReferenceCount);
     }
 }
@@ -7409,7 +8713,7 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo::safe_VkRenderPassInputAttachme
     aspectReferenceCount = src.aspectReferenceCount;
     pAspectReferences = nullptr;
     if (src.pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[src.aspectReferenceCount];
+        pAspectReferences = vl_safe_new_array<VkInputAttachmentAspectReference>(src.aspectReferenceCount);
         memcpy ((void *)pAspectReferences, (void *)src.pAspectReferences, sizeof(VkInputAttachmentAspectReference)*src.aspectReferenceCount);
     }
 }
@@ -7419,24 +8723,41 @@ safe_VkRenderPassInputAttachmentAspectCreateInfo& safe_VkRenderPassInputAttachme
     if (&src == this) return *this;
 
     if (pAspectReferences)
-        delete[] pAspectReferences;
+        vl_safe_delete_array(pAspectReferences);
 
     sType = src.sType;
     pNext = src.pNext;
     aspectReferenceCount = src.aspectReferenceCount;
     pAspectReferences = nullptr;
     if (src.pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[src.aspectReferenceCount];
+        pAspectReferences = vl_safe_new_array<VkInputAttachmentAspectReference>(src.aspectReferenceCount);
         memcpy ((void *)pAspectReferences, (void *)src.pAspectReferences, sizeof(VkInputAttachmentAspectReference)*src.aspectReferenceCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassInputAttachmentAspectCreateInfo::safe_VkRenderPassInputAttachmentAspectCreateInfo(safe_VkRenderPassInputAttachmentAspectCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassInputAttachmentAspectCreateInfo));
+    new (&src) safe_VkRenderPassInputAttachmentAspectCreateInfo();
+}
+
+safe_VkRenderPassInputAttachmentAspectCreateInfo& safe_VkRenderPassInputAttachmentAspectCreateInfo::operator=(safe_VkRenderPassInputAttachmentAspectCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassInputAttachmentAspectCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassInputAttachmentAspectCreateInfo));
+    new (&src) safe_VkRenderPassInputAttachmentAspectCreateInfo();
+
+    return *this;
+}
+
 safe_VkRenderPassInputAttachmentAspectCreateInfo::~safe_VkRenderPassInputAttachmentAspectCreateInfo()
 {
     if (pAspectReferences)
-        delete[] pAspectReferences;
+        vl_safe_delete_array(pAspectReferences);
 }
 
 void safe_VkRenderPassInputAttachmentAspectCreateInfo::initialize(const VkRenderPassInputAttachmentAspectCreateInfo* in_struct)
@@ -7446,7 +8767,7 @@ void safe_VkRenderPassInputAttachmentAspectCreateInfo::initialize(const VkRender
     aspectReferenceCount = in_struct->aspectReferenceCount;
     pAspectReferences = nullptr;
     if (in_struct->pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[in_struct->aspectReferenceCount];
+        pAspectReferences = vl_safe_new_array<VkInputAttachmentAspectReference>(in_struct->aspectReferenceCount);
         memcpy ((void *)pAspectReferences, (void *)in_struct->pAspectReferences, sizeof(VkInputAttachmentAspectReference)*in_struct->aspectReferenceCount);
     }
 }
@@ -7458,7 +8779,7 @@ void safe_VkRenderPassInputAttachmentAspectCreateInfo::initialize(const safe_VkR
     aspectReferenceCount = src->aspectReferenceCount;
     pAspectReferences = nullptr;
     if (src->pAspectReferences) {
-        pAspectReferences = new VkInputAttachmentAspectReference[src->aspectReferenceCount];
+        pAspectReferences = vl_safe_new_array<VkInputAttachmentAspectReference>(src->aspectReferenceCount);
         memcpy ((void *)pAspectReferences, (void *)src->pAspectReferences, sizeof(VkInputAttachmentAspectReference)*src->aspectReferenceCount);
     }
 }
@@ -7492,6 +8813,23 @@ safe_VkImageViewUsageCreateInfo& safe_VkImageViewUsageCreateInfo::operator=(cons
     return *this;
 }
 
+safe_VkImageViewUsageCreateInfo::safe_VkImageViewUsageCreateInfo(safe_VkImageViewUsageCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewUsageCreateInfo));
+    new (&src) safe_VkImageViewUsageCreateInfo();
+}
+
+safe_VkImageViewUsageCreateInfo& safe_VkImageViewUsageCreateInfo::operator=(safe_VkImageViewUsageCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageViewUsageCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewUsageCreateInfo));
+    new (&src) safe_VkImageViewUsageCreateInfo();
+
+    return *this;
+}
+
 safe_VkImageViewUsageCreateInfo::~safe_VkImageViewUsageCreateInfo()
 {
 }
@@ -7539,6 +8877,23 @@ safe_VkPipelineTessellationDomainOriginStateCreateInfo& safe_VkPipelineTessellat
     return *this;
 }
 
+safe_VkPipelineTessellationDomainOriginStateCreateInfo::safe_VkPipelineTessellationDomainOriginStateCreateInfo(safe_VkPipelineTessellationDomainOriginStateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineTessellationDomainOriginStateCreateInfo));
+    new (&src) safe_VkPipelineTessellationDomainOriginStateCreateInfo();
+}
+
+safe_VkPipelineTessellationDomainOriginStateCreateInfo& safe_VkPipelineTessellationDomainOriginStateCreateInfo::operator=(safe_VkPipelineTessellationDomainOriginStateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineTessellationDomainOriginStateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineTessellationDomainOriginStateCreateInfo));
+    new (&src) safe_VkPipelineTessellationDomainOriginStateCreateInfo();
+
+    return *this;
+}
+
 safe_VkPipelineTessellationDomainOriginStateCreateInfo::~safe_VkPipelineTessellationDomainOriginStateCreateInfo()
 {
 }
@@ -7568,15 +8923,15 @@ safe_VkRenderPassMultiviewCreateInfo::safe_VkRenderPassMultiviewCreateInfo(const
     pCorrelationMasks(nullptr)
 {
     if (in_struct->pViewMasks) {
-        pViewMasks = new uint32_t[in_struct->subpassCount];
+        pViewMasks = vl_safe_new_array<uint32_t>(in_struct->subpassCount);
         memcpy ((void *)pViewMasks, (void *)in_struct->pViewMasks, sizeof(uint32_t)*in_struct->subpassCount);
     }
     if (in_struct->pViewOffsets) {
-        pViewOffsets = new int32_t[in_struct->dependencyCount];
+        pViewOffsets = vl_safe_new_array<int32_t>(in_struct->dependencyCount);
         memcpy ((void *)pViewOffsets, (void *)in_struct->pViewOffsets, sizeof(int32_t)*in_struct->dependencyCount);
     }
     if (in_struct->pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[in_struct->correlationMaskCount];
+        pCorrelationMasks = vl_safe_new_array<uint32_t>(in_struct->correlationMaskCount);
         memcpy ((void *)pCorrelationMasks, (void *)in_struct->pCorrelationMasks, sizeof(uint32_t)*in_struct->correlationMaskCount);
     }
 }
@@ -7598,15 +8953,15 @@ safe_VkRenderPassMultiviewCreateInfo::safe_VkRenderPassMultiviewCreateInfo(const
     correlationMaskCount = src.correlationMaskCount;
     pCorrelationMasks = nullptr;
     if (src.pViewMasks) {
-        pViewMasks = new uint32_t[src.subpassCount];
+        pViewMasks = vl_safe_new_array<uint32_t>(src.subpassCount);
         memcpy ((void *)pViewMasks, (void *)src.pViewMasks, sizeof(uint32_t)*src.subpassCount);
     }
     if (src.pViewOffsets) {
-        pViewOffsets = new int32_t[src.dependencyCount];
+        pViewOffsets = vl_safe_new_array<int32_t>(src.dependencyCount);
         memcpy ((void *)pViewOffsets, (void *)src.pViewOffsets, sizeof(int32_t)*src.dependencyCount);
     }
     if (src.pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[src.correlationMaskCount];
+        pCorrelationMasks = vl_safe_new_array<uint32_t>(src.correlationMaskCount);
         memcpy ((void *)pCorrelationMasks, (void *)src.pCorrelationMasks, sizeof(uint32_t)*src.correlationMaskCount);
     }
 }
@@ -7616,11 +8971,11 @@ safe_VkRenderPassMultiviewCreateInfo& safe_VkRenderPassMultiviewCreateInfo::oper
     if (&src == this) return *this;
 
     if (pViewMasks)
-        delete[] pViewMasks;
+        vl_safe_delete_array(pViewMasks);
     if (pViewOffsets)
-        delete[] pViewOffsets;
+        vl_safe_delete_array(pViewOffsets);
     if (pCorrelationMasks)
-        delete[] pCorrelationMasks;
+        vl_safe_delete_array(pCorrelationMasks);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -7631,29 +8986,46 @@ safe_VkRenderPassMultiviewCreateInfo& safe_VkRenderPassMultiviewCreateInfo::oper
     correlationMaskCount = src.correlationMaskCount;
     pCorrelationMasks = nullptr;
     if (src.pViewMasks) {
-        pViewMasks = new uint32_t[src.subpassCount];
+        pViewMasks = vl_safe_new_array<uint32_t>(src.subpassCount);
         memcpy ((void *)pViewMasks, (void *)src.pViewMasks, sizeof(uint32_t)*src.subpassCount);
     }
     if (src.pViewOffsets) {
-        pViewOffsets = new int32_t[src.dependencyCount];
+        pViewOffsets = vl_safe_new_array<int32_t>(src.dependencyCount);
         memcpy ((void *)pViewOffsets, (void *)src.pViewOffsets, sizeof(int32_t)*src.dependencyCount);
     }
     if (src.pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[src.correlationMaskCount];
+        pCorrelationMasks = vl_safe_new_array<uint32_t>(src.correlationMaskCount);
         memcpy ((void *)pCorrelationMasks, (void *)src.pCorrelationMasks, sizeof(uint32_t)*src.correlationMaskCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassMultiviewCreateInfo::safe_VkRenderPassMultiviewCreateInfo(safe_VkRenderPassMultiviewCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassMultiviewCreateInfo));
+    new (&src) safe_VkRenderPassMultiviewCreateInfo();
+}
+
+safe_VkRenderPassMultiviewCreateInfo& safe_VkRenderPassMultiviewCreateInfo::operator=(safe_VkRenderPassMultiviewCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassMultiviewCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassMultiviewCreateInfo));
+    new (&src) safe_VkRenderPassMultiviewCreateInfo();
+
+    return *this;
+}
+
 safe_VkRenderPassMultiviewCreateInfo::~safe_VkRenderPassMultiviewCreateInfo()
 {
     if (pViewMasks)
-        delete[] pViewMasks;
+        vl_safe_delete_array(pViewMasks);
     if (pViewOffsets)
-        delete[] pViewOffsets;
+        vl_safe_delete_array(pViewOffsets);
     if (pCorrelationMasks)
-        delete[] pCorrelationMasks;
+        vl_safe_delete_array(pCorrelationMasks);
 }
 
 void safe_VkRenderPassMultiviewCreateInfo::initialize(const VkRenderPassMultiviewCreateInfo* in_struct)
@@ -7667,15 +9039,15 @@ void safe_VkRenderPassMultiviewCreateInfo::initialize(const VkRenderPassMultivie
     correlationMaskCount = in_struct->correlationMaskCount;
     pCorrelationMasks = nullptr;
     if (in_struct->pViewMasks) {
-        pViewMasks = new uint32_t[in_struct->subpassCount];
+        pViewMasks = vl_safe_new_array<uint32_t>(in_struct->subpassCount);
         memcpy ((void *)pViewMasks, (void *)in_struct->pViewMasks, sizeof(uint32_t)*in_struct->subpassCount);
     }
     if (in_struct->pViewOffsets) {
-        pViewOffsets = new int32_t[in_struct->dependencyCount];
+        pViewOffsets = vl_safe_new_array<int32_t>(in_struct->dependencyCount);
         memcpy ((void *)pViewOffsets, (void *)in_struct->pViewOffsets, sizeof(int32_t)*in_struct->dependencyCount);
     }
     if (in_struct->pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[in_struct->correlationMaskCount];
+        pCorrelationMasks = vl_safe_new_array<uint32_t>(in_struct->correlationMaskCount);
         memcpy ((void *)pCorrelationMasks, (void *)in_struct->pCorrelationMasks, sizeof(uint32_t)*in_struct->correlationMaskCount);
     }
 }
@@ -7691,15 +9063,15 @@ void safe_VkRenderPassMultiviewCreateInfo::initialize(const safe_VkRenderPassMul
     correlationMaskCount = src->correlationMaskCount;
     pCorrelationMasks = nullptr;
     if (src->pViewMasks) {
-        pViewMasks = new uint32_t[src->subpassCount];
+        pViewMasks = vl_safe_new_array<uint32_t>(src->subpassCount);
         memcpy ((void *)pViewMasks, (void *)src->pViewMasks, sizeof(uint32_t)*src->subpassCount);
     }
     if (src->pViewOffsets) {
-        pViewOffsets = new int32_t[src->dependencyCount];
+        pViewOffsets = vl_safe_new_array<int32_t>(src->dependencyCount);
         memcpy ((void *)pViewOffsets, (void *)src->pViewOffsets, sizeof(int32_t)*src->dependencyCount);
     }
     if (src->pCorrelationMasks) {
-        pCorrelationMasks = new uint32_t[src->correlationMaskCount];
+        pCorrelationMasks = vl_safe_new_array<uint32_t>(src->correlationMaskCount);
         memcpy ((void *)pCorrelationMasks, (void *)src->pCorrelationMasks, sizeof(uint32_t)*src->correlationMaskCount);
     }
 }
@@ -7739,6 +9111,23 @@ safe_VkPhysicalDeviceMultiviewFeatures& safe_VkPhysicalDeviceMultiviewFeatures::
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewFeatures::safe_VkPhysicalDeviceMultiviewFeatures(safe_VkPhysicalDeviceMultiviewFeatures&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMultiviewFeatures));
+    new (&src) safe_VkPhysicalDeviceMultiviewFeatures();
+}
+
+safe_VkPhysicalDeviceMultiviewFeatures& safe_VkPhysicalDeviceMultiviewFeatures::operator=(safe_VkPhysicalDeviceMultiviewFeatures&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMultiviewFeatures();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMultiviewFeatures));
+    new (&src) safe_VkPhysicalDeviceMultiviewFeatures();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewFeatures::~safe_VkPhysicalDeviceMultiviewFeatures()
 {
 }
@@ -7793,6 +9182,23 @@ safe_VkPhysicalDeviceMultiviewProperties& safe_VkPhysicalDeviceMultiviewProperti
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewProperties::safe_VkPhysicalDeviceMultiviewProperties(safe_VkPhysicalDeviceMultiviewProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMultiviewProperties));
+    new (&src) safe_VkPhysicalDeviceMultiviewProperties();
+}
+
+safe_VkPhysicalDeviceMultiviewProperties& safe_VkPhysicalDeviceMultiviewProperties::operator=(safe_VkPhysicalDeviceMultiviewProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMultiviewProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMultiviewProperties));
+    new (&src) safe_VkPhysicalDeviceMultiviewProperties();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewProperties::~safe_VkPhysicalDeviceMultiviewProperties()
 {
 }
@@ -7845,6 +9251,23 @@ safe_VkPhysicalDeviceVariablePointersFeatures& safe_VkPhysicalDeviceVariablePoin
     return *this;
 }
 
+safe_VkPhysicalDeviceVariablePointersFeatures::safe_VkPhysicalDeviceVariablePointersFeatures(safe_VkPhysicalDeviceVariablePointersFeatures&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVariablePointersFeatures));
+    new (&src) safe_VkPhysicalDeviceVariablePointersFeatures();
+}
+
+safe_VkPhysicalDeviceVariablePointersFeatures& safe_VkPhysicalDeviceVariablePointersFeatures::operator=(safe_VkPhysicalDeviceVariablePointersFeatures&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceVariablePointersFeatures();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVariablePointersFeatures));
+    new (&src) safe_VkPhysicalDeviceVariablePointersFeatures();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVariablePointersFeatures::~safe_VkPhysicalDeviceVariablePointersFeatures()
 {
 }
@@ -7894,6 +9317,23 @@ safe_VkPhysicalDeviceProtectedMemoryFeatures& safe_VkPhysicalDeviceProtectedMemo
     return *this;
 }
 
+safe_VkPhysicalDeviceProtectedMemoryFeatures::safe_VkPhysicalDeviceProtectedMemoryFeatures(safe_VkPhysicalDeviceProtectedMemoryFeatures&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceProtectedMemoryFeatures));
+    new (&src) safe_VkPhysicalDeviceProtectedMemoryFeatures();
+}
+
+safe_VkPhysicalDeviceProtectedMemoryFeatures& safe_VkPhysicalDeviceProtectedMemoryFeatures::operator=(safe_VkPhysicalDeviceProtectedMemoryFeatures&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceProtectedMemoryFeatures();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceProtectedMemoryFeatures));
+    new (&src) safe_VkPhysicalDeviceProtectedMemoryFeatures();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceProtectedMemoryFeatures::~safe_VkPhysicalDeviceProtectedMemoryFeatures()
 {
 }
@@ -7941,11 +9381,28 @@ safe_VkPhysicalDeviceProtectedMemoryProperties& safe_VkPhysicalDeviceProtectedMe
     return *this;
 }
 
-safe_VkPhysicalDeviceProtectedMemoryProperties::~safe_VkPhysicalDeviceProtectedMemoryProperties()
+safe_VkPhysicalDeviceProtectedMemoryProperties::safe_VkPhysicalDeviceProtectedMemoryProperties(safe_VkPhysicalDeviceProtectedMemoryProperties&& src) noexcept
 {
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceProtectedMemoryProperties));
+    new (&src) safe_VkPhysicalDeviceProtectedMemoryProperties();
 }
 
-void safe_VkPhysicalDeviceProtectedMemoryProperties::initialize(const VkPhysicalDeviceProtectedMemoryProperties* in_struct)
+safe_VkPhysicalDeviceProtectedMemoryProperties& safe_VkPhysicalDeviceProtectedMemoryProperties::operator=(safe_VkPhysicalDeviceProtectedMemoryProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceProtectedMemoryProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceProtectedMemoryProperties));
+    new (&src) safe_VkPhysicalDeviceProtectedMemoryProperties();
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceProtectedMemoryProperties::~safe_VkPhysicalDeviceProtectedMemoryProperties()
+{
+}
+
+void safe_VkPhysicalDeviceProtectedMemoryProperties::initialize(const VkPhysicalDeviceProtectedMemoryProperties* in_struct)
 {
     sType = in_struct->sType;
     pNext = in_struct->pNext;
@@ -7994,6 +9451,23 @@ safe_VkDeviceQueueInfo2& safe_VkDeviceQueueInfo2::operator=(const safe_VkDeviceQ
     return *this;
 }
 
+safe_VkDeviceQueueInfo2::safe_VkDeviceQueueInfo2(safe_VkDeviceQueueInfo2&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceQueueInfo2));
+    new (&src) safe_VkDeviceQueueInfo2();
+}
+
+safe_VkDeviceQueueInfo2& safe_VkDeviceQueueInfo2::operator=(safe_VkDeviceQueueInfo2&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceQueueInfo2();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceQueueInfo2));
+    new (&src) safe_VkDeviceQueueInfo2();
+
+    return *this;
+}
+
 safe_VkDeviceQueueInfo2::~safe_VkDeviceQueueInfo2()
 {
 }
@@ -8045,6 +9519,23 @@ safe_VkProtectedSubmitInfo& safe_VkProtectedSubmitInfo::operator=(const safe_VkP
     return *this;
 }
 
+safe_VkProtectedSubmitInfo::safe_VkProtectedSubmitInfo(safe_VkProtectedSubmitInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkProtectedSubmitInfo));
+    new (&src) safe_VkProtectedSubmitInfo();
+}
+
+safe_VkProtectedSubmitInfo& safe_VkProtectedSubmitInfo::operator=(safe_VkProtectedSubmitInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkProtectedSubmitInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkProtectedSubmitInfo));
+    new (&src) safe_VkProtectedSubmitInfo();
+
+    return *this;
+}
+
 safe_VkProtectedSubmitInfo::~safe_VkProtectedSubmitInfo()
 {
 }
@@ -8113,6 +9604,23 @@ safe_VkSamplerYcbcrConversionCreateInfo& safe_VkSamplerYcbcrConversionCreateInfo
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionCreateInfo::safe_VkSamplerYcbcrConversionCreateInfo(safe_VkSamplerYcbcrConversionCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerYcbcrConversionCreateInfo));
+    new (&src) safe_VkSamplerYcbcrConversionCreateInfo();
+}
+
+safe_VkSamplerYcbcrConversionCreateInfo& safe_VkSamplerYcbcrConversionCreateInfo::operator=(safe_VkSamplerYcbcrConversionCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSamplerYcbcrConversionCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerYcbcrConversionCreateInfo));
+    new (&src) safe_VkSamplerYcbcrConversionCreateInfo();
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionCreateInfo::~safe_VkSamplerYcbcrConversionCreateInfo()
 {
 }
@@ -8174,6 +9682,23 @@ safe_VkSamplerYcbcrConversionInfo& safe_VkSamplerYcbcrConversionInfo::operator=(
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionInfo::safe_VkSamplerYcbcrConversionInfo(safe_VkSamplerYcbcrConversionInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerYcbcrConversionInfo));
+    new (&src) safe_VkSamplerYcbcrConversionInfo();
+}
+
+safe_VkSamplerYcbcrConversionInfo& safe_VkSamplerYcbcrConversionInfo::operator=(safe_VkSamplerYcbcrConversionInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSamplerYcbcrConversionInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerYcbcrConversionInfo));
+    new (&src) safe_VkSamplerYcbcrConversionInfo();
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionInfo::~safe_VkSamplerYcbcrConversionInfo()
 {
 }
@@ -8221,6 +9746,23 @@ safe_VkBindImagePlaneMemoryInfo& safe_VkBindImagePlaneMemoryInfo::operator=(cons
     return *this;
 }
 
+safe_VkBindImagePlaneMemoryInfo::safe_VkBindImagePlaneMemoryInfo(safe_VkBindImagePlaneMemoryInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImagePlaneMemoryInfo));
+    new (&src) safe_VkBindImagePlaneMemoryInfo();
+}
+
+safe_VkBindImagePlaneMemoryInfo& safe_VkBindImagePlaneMemoryInfo::operator=(safe_VkBindImagePlaneMemoryInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindImagePlaneMemoryInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImagePlaneMemoryInfo));
+    new (&src) safe_VkBindImagePlaneMemoryInfo();
+
+    return *this;
+}
+
 safe_VkBindImagePlaneMemoryInfo::~safe_VkBindImagePlaneMemoryInfo()
 {
 }
@@ -8268,6 +9810,23 @@ safe_VkImagePlaneMemoryRequirementsInfo& safe_VkImagePlaneMemoryRequirementsInfo
     return *this;
 }
 
+safe_VkImagePlaneMemoryRequirementsInfo::safe_VkImagePlaneMemoryRequirementsInfo(safe_VkImagePlaneMemoryRequirementsInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImagePlaneMemoryRequirementsInfo));
+    new (&src) safe_VkImagePlaneMemoryRequirementsInfo();
+}
+
+safe_VkImagePlaneMemoryRequirementsInfo& safe_VkImagePlaneMemoryRequirementsInfo::operator=(safe_VkImagePlaneMemoryRequirementsInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImagePlaneMemoryRequirementsInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImagePlaneMemoryRequirementsInfo));
+    new (&src) safe_VkImagePlaneMemoryRequirementsInfo();
+
+    return *this;
+}
+
 safe_VkImagePlaneMemoryRequirementsInfo::~safe_VkImagePlaneMemoryRequirementsInfo()
 {
 }
@@ -8315,6 +9874,23 @@ safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& safe_VkPhysicalDeviceSample
     return *this;
 }
 
+safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures::safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures));
+    new (&src) safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
+}
+
+safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures::operator=(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures));
+    new (&src) safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures::~safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures()
 {
 }
@@ -8362,6 +9938,23 @@ safe_VkSamplerYcbcrConversionImageFormatProperties& safe_VkSamplerYcbcrConversio
     return *this;
 }
 
+safe_VkSamplerYcbcrConversionImageFormatProperties::safe_VkSamplerYcbcrConversionImageFormatProperties(safe_VkSamplerYcbcrConversionImageFormatProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerYcbcrConversionImageFormatProperties));
+    new (&src) safe_VkSamplerYcbcrConversionImageFormatProperties();
+}
+
+safe_VkSamplerYcbcrConversionImageFormatProperties& safe_VkSamplerYcbcrConversionImageFormatProperties::operator=(safe_VkSamplerYcbcrConversionImageFormatProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSamplerYcbcrConversionImageFormatProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerYcbcrConversionImageFormatProperties));
+    new (&src) safe_VkSamplerYcbcrConversionImageFormatProperties();
+
+    return *this;
+}
+
 safe_VkSamplerYcbcrConversionImageFormatProperties::~safe_VkSamplerYcbcrConversionImageFormatProperties()
 {
 }
@@ -8393,7 +9986,7 @@ safe_VkDescriptorUpdateTemplateCreateInfo::safe_VkDescriptorUpdateTemplateCreate
     set(in_struct->set)
 {
     if (in_struct->pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[in_struct->descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = vl_safe_new_array<VkDescriptorUpdateTemplateEntry>(in_struct->descriptorUpdateEntryCount);
         memcpy ((void *)pDescriptorUpdateEntries, (void *)in_struct->pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*in_struct->descriptorUpdateEntryCount);
     }
 }
@@ -8415,7 +10008,7 @@ safe_VkDescriptorUpdateTemplateCreateInfo::safe_VkDescriptorUpdateTemplateCreate
     pipelineLayout = src.pipelineLayout;
     set = src.set;
     if (src.pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[src.descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = vl_safe_new_array<VkDescriptorUpdateTemplateEntry>(src.descriptorUpdateEntryCount);
         memcpy ((void *)pDescriptorUpdateEntries, (void *)src.pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*src.descriptorUpdateEntryCount);
     }
 }
@@ -8425,7 +10018,7 @@ safe_VkDescriptorUpdateTemplateCreateInfo& safe_VkDescriptorUpdateTemplateCreate
     if (&src == this) return *this;
 
     if (pDescriptorUpdateEntries)
-        delete[] pDescriptorUpdateEntries;
+        vl_safe_delete_array(pDescriptorUpdateEntries);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -8438,17 +10031,34 @@ safe_VkDescriptorUpdateTemplateCreateInfo& safe_VkDescriptorUpdateTemplateCreate
     pipelineLayout = src.pipelineLayout;
     set = src.set;
     if (src.pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[src.descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = vl_safe_new_array<VkDescriptorUpdateTemplateEntry>(src.descriptorUpdateEntryCount);
         memcpy ((void *)pDescriptorUpdateEntries, (void *)src.pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*src.descriptorUpdateEntryCount);
     }
 
     return *this;
 }
 
+safe_VkDescriptorUpdateTemplateCreateInfo::safe_VkDescriptorUpdateTemplateCreateInfo(safe_VkDescriptorUpdateTemplateCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorUpdateTemplateCreateInfo));
+    new (&src) safe_VkDescriptorUpdateTemplateCreateInfo();
+}
+
+safe_VkDescriptorUpdateTemplateCreateInfo& safe_VkDescriptorUpdateTemplateCreateInfo::operator=(safe_VkDescriptorUpdateTemplateCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorUpdateTemplateCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorUpdateTemplateCreateInfo));
+    new (&src) safe_VkDescriptorUpdateTemplateCreateInfo();
+
+    return *this;
+}
+
 safe_VkDescriptorUpdateTemplateCreateInfo::~safe_VkDescriptorUpdateTemplateCreateInfo()
 {
     if (pDescriptorUpdateEntries)
-        delete[] pDescriptorUpdateEntries;
+        vl_safe_delete_array(pDescriptorUpdateEntries);
 }
 
 void safe_VkDescriptorUpdateTemplateCreateInfo::initialize(const VkDescriptorUpdateTemplateCreateInfo* in_struct)
@@ -8464,7 +10074,7 @@ void safe_VkDescriptorUpdateTemplateCreateInfo::initialize(const VkDescriptorUpd
     pipelineLayout = in_struct->pipelineLayout;
     set = in_struct->set;
     if (in_struct->pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[in_struct->descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = vl_safe_new_array<VkDescriptorUpdateTemplateEntry>(in_struct->descriptorUpdateEntryCount);
         memcpy ((void *)pDescriptorUpdateEntries, (void *)in_struct->pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*in_struct->descriptorUpdateEntryCount);
     }
 }
@@ -8482,7 +10092,7 @@ void safe_VkDescriptorUpdateTemplateCreateInfo::initialize(const safe_VkDescript
     pipelineLayout = src->pipelineLayout;
     set = src->set;
     if (src->pDescriptorUpdateEntries) {
-        pDescriptorUpdateEntries = new VkDescriptorUpdateTemplateEntry[src->descriptorUpdateEntryCount];
+        pDescriptorUpdateEntries = vl_safe_new_array<VkDescriptorUpdateTemplateEntry>(src->descriptorUpdateEntryCount);
         memcpy ((void *)pDescriptorUpdateEntries, (void *)src->pDescriptorUpdateEntries, sizeof(VkDescriptorUpdateTemplateEntry)*src->descriptorUpdateEntryCount);
     }
 }
@@ -8516,6 +10126,23 @@ safe_VkPhysicalDeviceExternalImageFormatInfo& safe_VkPhysicalDeviceExternalImage
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalImageFormatInfo::safe_VkPhysicalDeviceExternalImageFormatInfo(safe_VkPhysicalDeviceExternalImageFormatInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalImageFormatInfo));
+    new (&src) safe_VkPhysicalDeviceExternalImageFormatInfo();
+}
+
+safe_VkPhysicalDeviceExternalImageFormatInfo& safe_VkPhysicalDeviceExternalImageFormatInfo::operator=(safe_VkPhysicalDeviceExternalImageFormatInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceExternalImageFormatInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalImageFormatInfo));
+    new (&src) safe_VkPhysicalDeviceExternalImageFormatInfo();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalImageFormatInfo::~safe_VkPhysicalDeviceExternalImageFormatInfo()
 {
 }
@@ -8563,6 +10190,23 @@ safe_VkExternalImageFormatProperties& safe_VkExternalImageFormatProperties::oper
     return *this;
 }
 
+safe_VkExternalImageFormatProperties::safe_VkExternalImageFormatProperties(safe_VkExternalImageFormatProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalImageFormatProperties));
+    new (&src) safe_VkExternalImageFormatProperties();
+}
+
+safe_VkExternalImageFormatProperties& safe_VkExternalImageFormatProperties::operator=(safe_VkExternalImageFormatProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalImageFormatProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalImageFormatProperties));
+    new (&src) safe_VkExternalImageFormatProperties();
+
+    return *this;
+}
+
 safe_VkExternalImageFormatProperties::~safe_VkExternalImageFormatProperties()
 {
 }
@@ -8616,6 +10260,23 @@ safe_VkPhysicalDeviceExternalBufferInfo& safe_VkPhysicalDeviceExternalBufferInfo
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalBufferInfo::safe_VkPhysicalDeviceExternalBufferInfo(safe_VkPhysicalDeviceExternalBufferInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalBufferInfo));
+    new (&src) safe_VkPhysicalDeviceExternalBufferInfo();
+}
+
+safe_VkPhysicalDeviceExternalBufferInfo& safe_VkPhysicalDeviceExternalBufferInfo::operator=(safe_VkPhysicalDeviceExternalBufferInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceExternalBufferInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalBufferInfo));
+    new (&src) safe_VkPhysicalDeviceExternalBufferInfo();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalBufferInfo::~safe_VkPhysicalDeviceExternalBufferInfo()
 {
 }
@@ -8667,6 +10328,23 @@ safe_VkExternalBufferProperties& safe_VkExternalBufferProperties::operator=(cons
     return *this;
 }
 
+safe_VkExternalBufferProperties::safe_VkExternalBufferProperties(safe_VkExternalBufferProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalBufferProperties));
+    new (&src) safe_VkExternalBufferProperties();
+}
+
+safe_VkExternalBufferProperties& safe_VkExternalBufferProperties::operator=(safe_VkExternalBufferProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalBufferProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalBufferProperties));
+    new (&src) safe_VkExternalBufferProperties();
+
+    return *this;
+}
+
 safe_VkExternalBufferProperties::~safe_VkExternalBufferProperties()
 {
 }
@@ -8691,15 +10369,9 @@ safe_VkPhysicalDeviceIDProperties::safe_VkPhysicalDeviceIDProperties(const VkPhy
     deviceNodeMask(in_struct->deviceNodeMask),
     deviceLUIDValid(in_struct->deviceLUIDValid)
 {
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        deviceUUID[i] = in_struct->deviceUUID[i];
-    }
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        driverUUID[i] = in_struct->driverUUID[i];
-    }
-    for (uint32_t i=0; i<VK_LUID_SIZE; ++i) {
-        deviceLUID[i] = in_struct->deviceLUID[i];
-    }
+    memcpy (deviceUUID, in_struct->deviceUUID, sizeof(deviceUUID));
+    memcpy (driverUUID, in_struct->driverUUID, sizeof(driverUUID));
+    memcpy (deviceLUID, in_struct->deviceLUID, sizeof(deviceLUID));
 }
 
 safe_VkPhysicalDeviceIDProperties::safe_VkPhysicalDeviceIDProperties()
@@ -8711,15 +10383,9 @@ safe_VkPhysicalDeviceIDProperties::safe_VkPhysicalDeviceIDProperties(const safe_
     pNext = src.pNext;
     deviceNodeMask = src.deviceNodeMask;
     deviceLUIDValid = src.deviceLUIDValid;
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        deviceUUID[i] = src.deviceUUID[i];
-    }
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        driverUUID[i] = src.driverUUID[i];
-    }
-    for (uint32_t i=0; i<VK_LUID_SIZE; ++i) {
-        deviceLUID[i] = src.deviceLUID[i];
-    }
+    memcpy (deviceUUID, src.deviceUUID, sizeof(deviceUUID));
+    memcpy (driverUUID, src.driverUUID, sizeof(driverUUID));
+    memcpy (deviceLUID, src.deviceLUID, sizeof(deviceLUID));
 }
 
 safe_VkPhysicalDeviceIDProperties& safe_VkPhysicalDeviceIDProperties::operator=(const safe_VkPhysicalDeviceIDProperties& src)
@@ -8731,15 +10397,26 @@ safe_VkPhysicalDeviceIDProperties& safe_VkPhysicalDeviceIDProperties::operator=(
     pNext = src.pNext;
     deviceNodeMask = src.deviceNodeMask;
     deviceLUIDValid = src.deviceLUIDValid;
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        deviceUUID[i] = src.deviceUUID[i];
-    }
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        driverUUID[i] = src.driverUUID[i];
-    }
-    for (uint32_t i=0; i<VK_LUID_SIZE; ++i) {
-        deviceLUID[i] = src.deviceLUID[i];
-    }
+    memcpy (deviceUUID, src.deviceUUID, sizeof(deviceUUID));
+    memcpy (driverUUID, src.driverUUID, sizeof(driverUUID));
+    memcpy (deviceLUID, src.deviceLUID, sizeof(deviceLUID));
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceIDProperties::safe_VkPhysicalDeviceIDProperties(safe_VkPhysicalDeviceIDProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceIDProperties));
+    new (&src) safe_VkPhysicalDeviceIDProperties();
+}
+
+safe_VkPhysicalDeviceIDProperties& safe_VkPhysicalDeviceIDProperties::operator=(safe_VkPhysicalDeviceIDProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceIDProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceIDProperties));
+    new (&src) safe_VkPhysicalDeviceIDProperties();
 
     return *this;
 }
@@ -8754,15 +10431,9 @@ void safe_VkPhysicalDeviceIDProperties::initialize(const VkPhysicalDeviceIDPrope
     pNext = in_struct->pNext;
     deviceNodeMask = in_struct->deviceNodeMask;
     deviceLUIDValid = in_struct->deviceLUIDValid;
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        deviceUUID[i] = in_struct->deviceUUID[i];
-    }
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        driverUUID[i] = in_struct->driverUUID[i];
-    }
-    for (uint32_t i=0; i<VK_LUID_SIZE; ++i) {
-        deviceLUID[i] = in_struct->deviceLUID[i];
-    }
+    memcpy (deviceUUID, in_struct->deviceUUID, sizeof(deviceUUID));
+    memcpy (driverUUID, in_struct->driverUUID, sizeof(driverUUID));
+    memcpy (deviceLUID, in_struct->deviceLUID, sizeof(deviceLUID));
 }
 
 void safe_VkPhysicalDeviceIDProperties::initialize(const safe_VkPhysicalDeviceIDProperties* src)
@@ -8771,15 +10442,9 @@ void safe_VkPhysicalDeviceIDProperties::initialize(const safe_VkPhysicalDeviceID
     pNext = src->pNext;
     deviceNodeMask = src->deviceNodeMask;
     deviceLUIDValid = src->deviceLUIDValid;
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        deviceUUID[i] = src->deviceUUID[i];
-    }
-    for (uint32_t i=0; i<VK_UUID_SIZE; ++i) {
-        driverUUID[i] = src->driverUUID[i];
-    }
-    for (uint32_t i=0; i<VK_LUID_SIZE; ++i) {
-        deviceLUID[i] = src->deviceLUID[i];
-    }
+    memcpy (deviceUUID, src->deviceUUID, sizeof(deviceUUID));
+    memcpy (driverUUID, src->driverUUID, sizeof(driverUUID));
+    memcpy (deviceLUID, src->deviceLUID, sizeof(deviceLUID));
 }
 
 safe_VkExternalMemoryImageCreateInfo::safe_VkExternalMemoryImageCreateInfo(const VkExternalMemoryImageCreateInfo* in_struct) :
@@ -8811,6 +10476,23 @@ safe_VkExternalMemoryImageCreateInfo& safe_VkExternalMemoryImageCreateInfo::oper
     return *this;
 }
 
+safe_VkExternalMemoryImageCreateInfo::safe_VkExternalMemoryImageCreateInfo(safe_VkExternalMemoryImageCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalMemoryImageCreateInfo));
+    new (&src) safe_VkExternalMemoryImageCreateInfo();
+}
+
+safe_VkExternalMemoryImageCreateInfo& safe_VkExternalMemoryImageCreateInfo::operator=(safe_VkExternalMemoryImageCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalMemoryImageCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalMemoryImageCreateInfo));
+    new (&src) safe_VkExternalMemoryImageCreateInfo();
+
+    return *this;
+}
+
 safe_VkExternalMemoryImageCreateInfo::~safe_VkExternalMemoryImageCreateInfo()
 {
 }
@@ -8858,6 +10540,23 @@ safe_VkExternalMemoryBufferCreateInfo& safe_VkExternalMemoryBufferCreateInfo::op
     return *this;
 }
 
+safe_VkExternalMemoryBufferCreateInfo::safe_VkExternalMemoryBufferCreateInfo(safe_VkExternalMemoryBufferCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalMemoryBufferCreateInfo));
+    new (&src) safe_VkExternalMemoryBufferCreateInfo();
+}
+
+safe_VkExternalMemoryBufferCreateInfo& safe_VkExternalMemoryBufferCreateInfo::operator=(safe_VkExternalMemoryBufferCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalMemoryBufferCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalMemoryBufferCreateInfo));
+    new (&src) safe_VkExternalMemoryBufferCreateInfo();
+
+    return *this;
+}
+
 safe_VkExternalMemoryBufferCreateInfo::~safe_VkExternalMemoryBufferCreateInfo()
 {
 }
@@ -8905,6 +10604,23 @@ safe_VkExportMemoryAllocateInfo& safe_VkExportMemoryAllocateInfo::operator=(cons
     return *this;
 }
 
+safe_VkExportMemoryAllocateInfo::safe_VkExportMemoryAllocateInfo(safe_VkExportMemoryAllocateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryAllocateInfo));
+    new (&src) safe_VkExportMemoryAllocateInfo();
+}
+
+safe_VkExportMemoryAllocateInfo& safe_VkExportMemoryAllocateInfo::operator=(safe_VkExportMemoryAllocateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportMemoryAllocateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryAllocateInfo));
+    new (&src) safe_VkExportMemoryAllocateInfo();
+
+    return *this;
+}
+
 safe_VkExportMemoryAllocateInfo::~safe_VkExportMemoryAllocateInfo()
 {
 }
@@ -8952,6 +10668,23 @@ safe_VkPhysicalDeviceExternalFenceInfo& safe_VkPhysicalDeviceExternalFenceInfo::
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalFenceInfo::safe_VkPhysicalDeviceExternalFenceInfo(safe_VkPhysicalDeviceExternalFenceInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalFenceInfo));
+    new (&src) safe_VkPhysicalDeviceExternalFenceInfo();
+}
+
+safe_VkPhysicalDeviceExternalFenceInfo& safe_VkPhysicalDeviceExternalFenceInfo::operator=(safe_VkPhysicalDeviceExternalFenceInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceExternalFenceInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalFenceInfo));
+    new (&src) safe_VkPhysicalDeviceExternalFenceInfo();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalFenceInfo::~safe_VkPhysicalDeviceExternalFenceInfo()
 {
 }
@@ -9005,6 +10738,23 @@ safe_VkExternalFenceProperties& safe_VkExternalFenceProperties::operator=(const
     return *this;
 }
 
+safe_VkExternalFenceProperties::safe_VkExternalFenceProperties(safe_VkExternalFenceProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalFenceProperties));
+    new (&src) safe_VkExternalFenceProperties();
+}
+
+safe_VkExternalFenceProperties& safe_VkExternalFenceProperties::operator=(safe_VkExternalFenceProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalFenceProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalFenceProperties));
+    new (&src) safe_VkExternalFenceProperties();
+
+    return *this;
+}
+
 safe_VkExternalFenceProperties::~safe_VkExternalFenceProperties()
 {
 }
@@ -9056,6 +10806,23 @@ safe_VkExportFenceCreateInfo& safe_VkExportFenceCreateInfo::operator=(const safe
     return *this;
 }
 
+safe_VkExportFenceCreateInfo::safe_VkExportFenceCreateInfo(safe_VkExportFenceCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportFenceCreateInfo));
+    new (&src) safe_VkExportFenceCreateInfo();
+}
+
+safe_VkExportFenceCreateInfo& safe_VkExportFenceCreateInfo::operator=(safe_VkExportFenceCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportFenceCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportFenceCreateInfo));
+    new (&src) safe_VkExportFenceCreateInfo();
+
+    return *this;
+}
+
 safe_VkExportFenceCreateInfo::~safe_VkExportFenceCreateInfo()
 {
 }
@@ -9103,6 +10870,23 @@ safe_VkExportSemaphoreCreateInfo& safe_VkExportSemaphoreCreateInfo::operator=(co
     return *this;
 }
 
+safe_VkExportSemaphoreCreateInfo::safe_VkExportSemaphoreCreateInfo(safe_VkExportSemaphoreCreateInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportSemaphoreCreateInfo));
+    new (&src) safe_VkExportSemaphoreCreateInfo();
+}
+
+safe_VkExportSemaphoreCreateInfo& safe_VkExportSemaphoreCreateInfo::operator=(safe_VkExportSemaphoreCreateInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportSemaphoreCreateInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportSemaphoreCreateInfo));
+    new (&src) safe_VkExportSemaphoreCreateInfo();
+
+    return *this;
+}
+
 safe_VkExportSemaphoreCreateInfo::~safe_VkExportSemaphoreCreateInfo()
 {
 }
@@ -9150,6 +10934,23 @@ safe_VkPhysicalDeviceExternalSemaphoreInfo& safe_VkPhysicalDeviceExternalSemapho
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalSemaphoreInfo::safe_VkPhysicalDeviceExternalSemaphoreInfo(safe_VkPhysicalDeviceExternalSemaphoreInfo&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalSemaphoreInfo));
+    new (&src) safe_VkPhysicalDeviceExternalSemaphoreInfo();
+}
+
+safe_VkPhysicalDeviceExternalSemaphoreInfo& safe_VkPhysicalDeviceExternalSemaphoreInfo::operator=(safe_VkPhysicalDeviceExternalSemaphoreInfo&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceExternalSemaphoreInfo();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalSemaphoreInfo));
+    new (&src) safe_VkPhysicalDeviceExternalSemaphoreInfo();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalSemaphoreInfo::~safe_VkPhysicalDeviceExternalSemaphoreInfo()
 {
 }
@@ -9203,6 +11004,23 @@ safe_VkExternalSemaphoreProperties& safe_VkExternalSemaphoreProperties::operator
     return *this;
 }
 
+safe_VkExternalSemaphoreProperties::safe_VkExternalSemaphoreProperties(safe_VkExternalSemaphoreProperties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalSemaphoreProperties));
+    new (&src) safe_VkExternalSemaphoreProperties();
+}
+
+safe_VkExternalSemaphoreProperties& safe_VkExternalSemaphoreProperties::operator=(safe_VkExternalSemaphoreProperties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalSemaphoreProperties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalSemaphoreProperties));
+    new (&src) safe_VkExternalSemaphoreProperties();
+
+    return *this;
+}
+
 safe_VkExternalSemaphoreProperties::~safe_VkExternalSemaphoreProperties()
 {
 }
@@ -9257,6 +11075,23 @@ safe_VkPhysicalDeviceMaintenance3Properties& safe_VkPhysicalDeviceMaintenance3Pr
     return *this;
 }
 
+safe_VkPhysicalDeviceMaintenance3Properties::safe_VkPhysicalDeviceMaintenance3Properties(safe_VkPhysicalDeviceMaintenance3Properties&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMaintenance3Properties));
+    new (&src) safe_VkPhysicalDeviceMaintenance3Properties();
+}
+
+safe_VkPhysicalDeviceMaintenance3Properties& safe_VkPhysicalDeviceMaintenance3Properties::operator=(safe_VkPhysicalDeviceMaintenance3Properties&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMaintenance3Properties();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMaintenance3Properties));
+    new (&src) safe_VkPhysicalDeviceMaintenance3Properties();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMaintenance3Properties::~safe_VkPhysicalDeviceMaintenance3Properties()
 {
 }
@@ -9287,21 +11122,38 @@ safe_VkDescriptorSetLayoutSupport::safe_VkDescriptorSetLayoutSupport(const VkDes
 safe_VkDescriptorSetLayoutSupport::safe_VkDescriptorSetLayoutSupport()
 {}
 
-safe_VkDescriptorSetLayoutSupport::safe_VkDescriptorSetLayoutSupport(const safe_VkDescriptorSetLayoutSupport& src)
+safe_VkDescriptorSetLayoutSupport::safe_VkDescriptorSetLayoutSupport(const safe_VkDescriptorSetLayoutSupport& src)
+{
+    sType = src.sType;
+    pNext = src.pNext;
+    supported = src.supported;
+}
+
+safe_VkDescriptorSetLayoutSupport& safe_VkDescriptorSetLayoutSupport::operator=(const safe_VkDescriptorSetLayoutSupport& src)
+{
+    if (&src == this) return *this;
+
+
+    sType = src.sType;
+    pNext = src.pNext;
+    supported = src.supported;
+
+    return *this;
+}
+
+safe_VkDescriptorSetLayoutSupport::safe_VkDescriptorSetLayoutSupport(safe_VkDescriptorSetLayoutSupport&& src) noexcept
 {
-    sType = src.sType;
-    pNext = src.pNext;
-    supported = src.supported;
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutSupport));
+    new (&src) safe_VkDescriptorSetLayoutSupport();
 }
 
-safe_VkDescriptorSetLayoutSupport& safe_VkDescriptorSetLayoutSupport::operator=(const safe_VkDescriptorSetLayoutSupport& src)
+safe_VkDescriptorSetLayoutSupport& safe_VkDescriptorSetLayoutSupport::operator=(safe_VkDescriptorSetLayoutSupport&& src) noexcept
 {
     if (&src == this) return *this;
 
-
-    sType = src.sType;
-    pNext = src.pNext;
-    supported = src.supported;
+    this->~safe_VkDescriptorSetLayoutSupport();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutSupport));
+    new (&src) safe_VkDescriptorSetLayoutSupport();
 
     return *this;
 }
@@ -9353,6 +11205,23 @@ safe_VkPhysicalDeviceShaderDrawParametersFeatures& safe_VkPhysicalDeviceShaderDr
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderDrawParametersFeatures::safe_VkPhysicalDeviceShaderDrawParametersFeatures(safe_VkPhysicalDeviceShaderDrawParametersFeatures&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderDrawParametersFeatures));
+    new (&src) safe_VkPhysicalDeviceShaderDrawParametersFeatures();
+}
+
+safe_VkPhysicalDeviceShaderDrawParametersFeatures& safe_VkPhysicalDeviceShaderDrawParametersFeatures::operator=(safe_VkPhysicalDeviceShaderDrawParametersFeatures&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderDrawParametersFeatures();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderDrawParametersFeatures));
+    new (&src) safe_VkPhysicalDeviceShaderDrawParametersFeatures();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderDrawParametersFeatures::~safe_VkPhysicalDeviceShaderDrawParametersFeatures()
 {
 }
@@ -9392,7 +11261,7 @@ safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(const VkSwapchainCr
     oldSwapchain(in_struct->oldSwapchain)
 {
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -9422,7 +11291,7 @@ safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(const safe_VkSwapch
     clipped = src.clipped;
     oldSwapchain = src.oldSwapchain;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 }
@@ -9432,7 +11301,7 @@ safe_VkSwapchainCreateInfoKHR& safe_VkSwapchainCreateInfoKHR::operator=(const sa
     if (&src == this) return *this;
 
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -9453,17 +11322,34 @@ safe_VkSwapchainCreateInfoKHR& safe_VkSwapchainCreateInfoKHR::operator=(const sa
     clipped = src.clipped;
     oldSwapchain = src.oldSwapchain;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 
     return *this;
 }
 
+safe_VkSwapchainCreateInfoKHR::safe_VkSwapchainCreateInfoKHR(safe_VkSwapchainCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSwapchainCreateInfoKHR));
+    new (&src) safe_VkSwapchainCreateInfoKHR();
+}
+
+safe_VkSwapchainCreateInfoKHR& safe_VkSwapchainCreateInfoKHR::operator=(safe_VkSwapchainCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSwapchainCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSwapchainCreateInfoKHR));
+    new (&src) safe_VkSwapchainCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkSwapchainCreateInfoKHR::~safe_VkSwapchainCreateInfoKHR()
 {
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 }
 
 void safe_VkSwapchainCreateInfoKHR::initialize(const VkSwapchainCreateInfoKHR* in_struct)
@@ -9487,7 +11373,7 @@ void safe_VkSwapchainCreateInfoKHR::initialize(const VkSwapchainCreateInfoKHR* i
     clipped = in_struct->clipped;
     oldSwapchain = in_struct->oldSwapchain;
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -9513,7 +11399,7 @@ void safe_VkSwapchainCreateInfoKHR::initialize(const safe_VkSwapchainCreateInfoK
     clipped = src->clipped;
     oldSwapchain = src->oldSwapchain;
     if (src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src->pQueueFamilyIndices, sizeof(uint32_t)*src->queueFamilyIndexCount);
     }
 }
@@ -9529,23 +11415,19 @@ safe_VkPresentInfoKHR::safe_VkPresentInfoKHR(const VkPresentInfoKHR* in_struct)
     pResults(nullptr)
 {
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)in_struct->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (swapchainCount && in_struct->pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
-        for (uint32_t i=0; i<swapchainCount; ++i) {
-            pSwapchains[i] = in_struct->pSwapchains[i];
-        }
+        pSwapchains = vl_safe_new_array<VkSwapchainKHR>(swapchainCount);
+        memcpy ((void *)pSwapchains, (void *)in_struct->pSwapchains, sizeof(VkSwapchainKHR)*swapchainCount);
     }
     if (in_struct->pImageIndices) {
-        pImageIndices = new uint32_t[in_struct->swapchainCount];
+        pImageIndices = vl_safe_new_array<uint32_t>(in_struct->swapchainCount);
         memcpy ((void *)pImageIndices, (void *)in_struct->pImageIndices, sizeof(uint32_t)*in_struct->swapchainCount);
     }
     if (in_struct->pResults) {
-        pResults = new VkResult[in_struct->swapchainCount];
+        pResults = vl_safe_new_array<VkResult>(in_struct->swapchainCount);
         memcpy ((void *)pResults, (void *)in_struct->pResults, sizeof(VkResult)*in_struct->swapchainCount);
     }
 }
@@ -9568,23 +11450,19 @@ safe_VkPresentInfoKHR::safe_VkPresentInfoKHR(const safe_VkPresentInfoKHR& src)
     pImageIndices = nullptr;
     pResults = nullptr;
     if (waitSemaphoreCount && src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src.pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src.pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (swapchainCount && src.pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
-        for (uint32_t i=0; i<swapchainCount; ++i) {
-            pSwapchains[i] = src.pSwapchains[i];
-        }
+        pSwapchains = vl_safe_new_array<VkSwapchainKHR>(swapchainCount);
+        memcpy ((void *)pSwapchains, (void *)src.pSwapchains, sizeof(VkSwapchainKHR)*swapchainCount);
     }
     if (src.pImageIndices) {
-        pImageIndices = new uint32_t[src.swapchainCount];
+        pImageIndices = vl_safe_new_array<uint32_t>(src.swapchainCount);
         memcpy ((void *)pImageIndices, (void *)src.pImageIndices, sizeof(uint32_t)*src.swapchainCount);
     }
     if (src.pResults) {
-        pResults = new VkResult[src.swapchainCount];
+        pResults = vl_safe_new_array<VkResult>(src.swapchainCount);
         memcpy ((void *)pResults, (void *)src.pResults, sizeof(VkResult)*src.swapchainCount);
     }
 }
@@ -9594,13 +11472,13 @@ safe_VkPresentInfoKHR& safe_VkPresentInfoKHR::operator=(const safe_VkPresentInfo
     if (&src == this) return *this;
 
     if (pWaitSemaphores)
-        delete[] pWaitSemaphores;
+        vl_safe_delete_array(pWaitSemaphores);
     if (pSwapchains)
-        delete[] pSwapchains;
+        vl_safe_delete_array(pSwapchains);
     if (pImageIndices)
-        delete[] pImageIndices;
+        vl_safe_delete_array(pImageIndices);
     if (pResults)
-        delete[] pResults;
+        vl_safe_delete_array(pResults);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -9611,39 +11489,52 @@ safe_VkPresentInfoKHR& safe_VkPresentInfoKHR::operator=(const safe_VkPresentInfo
     pImageIndices = nullptr;
     pResults = nullptr;
     if (waitSemaphoreCount && src.pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src.pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src.pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (swapchainCount && src.pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
-        for (uint32_t i=0; i<swapchainCount; ++i) {
-            pSwapchains[i] = src.pSwapchains[i];
-        }
+        pSwapchains = vl_safe_new_array<VkSwapchainKHR>(swapchainCount);
+        memcpy ((void *)pSwapchains, (void *)src.pSwapchains, sizeof(VkSwapchainKHR)*swapchainCount);
     }
     if (src.pImageIndices) {
-        pImageIndices = new uint32_t[src.swapchainCount];
+        pImageIndices = vl_safe_new_array<uint32_t>(src.swapchainCount);
         memcpy ((void *)pImageIndices, (void *)src.pImageIndices, sizeof(uint32_t)*src.swapchainCount);
     }
     if (src.pResults) {
-        pResults = new VkResult[src.swapchainCount];
+        pResults = vl_safe_new_array<VkResult>(src.swapchainCount);
         memcpy ((void *)pResults, (void *)src.pResults, sizeof(VkResult)*src.swapchainCount);
     }
 
     return *this;
 }
 
+safe_VkPresentInfoKHR::safe_VkPresentInfoKHR(safe_VkPresentInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentInfoKHR));
+    new (&src) safe_VkPresentInfoKHR();
+}
+
+safe_VkPresentInfoKHR& safe_VkPresentInfoKHR::operator=(safe_VkPresentInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPresentInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentInfoKHR));
+    new (&src) safe_VkPresentInfoKHR();
+
+    return *this;
+}
+
 safe_VkPresentInfoKHR::~safe_VkPresentInfoKHR()
 {
     if (pWaitSemaphores)
-        delete[] pWaitSemaphores;
+        vl_safe_delete_array(pWaitSemaphores);
     if (pSwapchains)
-        delete[] pSwapchains;
+        vl_safe_delete_array(pSwapchains);
     if (pImageIndices)
-        delete[] pImageIndices;
+        vl_safe_delete_array(pImageIndices);
     if (pResults)
-        delete[] pResults;
+        vl_safe_delete_array(pResults);
 }
 
 void safe_VkPresentInfoKHR::initialize(const VkPresentInfoKHR* in_struct)
@@ -9657,23 +11548,19 @@ void safe_VkPresentInfoKHR::initialize(const VkPresentInfoKHR* in_struct)
     pImageIndices = nullptr;
     pResults = nullptr;
     if (waitSemaphoreCount && in_struct->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = in_struct->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)in_struct->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (swapchainCount && in_struct->pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
-        for (uint32_t i=0; i<swapchainCount; ++i) {
-            pSwapchains[i] = in_struct->pSwapchains[i];
-        }
+        pSwapchains = vl_safe_new_array<VkSwapchainKHR>(swapchainCount);
+        memcpy ((void *)pSwapchains, (void *)in_struct->pSwapchains, sizeof(VkSwapchainKHR)*swapchainCount);
     }
     if (in_struct->pImageIndices) {
-        pImageIndices = new uint32_t[in_struct->swapchainCount];
+        pImageIndices = vl_safe_new_array<uint32_t>(in_struct->swapchainCount);
         memcpy ((void *)pImageIndices, (void *)in_struct->pImageIndices, sizeof(uint32_t)*in_struct->swapchainCount);
     }
     if (in_struct->pResults) {
-        pResults = new VkResult[in_struct->swapchainCount];
+        pResults = vl_safe_new_array<VkResult>(in_struct->swapchainCount);
         memcpy ((void *)pResults, (void *)in_struct->pResults, sizeof(VkResult)*in_struct->swapchainCount);
     }
 }
@@ -9689,23 +11576,19 @@ void safe_VkPresentInfoKHR::initialize(const safe_VkPresentInfoKHR* src)
     pImageIndices = nullptr;
     pResults = nullptr;
     if (waitSemaphoreCount && src->pWaitSemaphores) {
-        pWaitSemaphores = new VkSemaphore[waitSemaphoreCount];
-        for (uint32_t i=0; i<waitSemaphoreCount; ++i) {
-            pWaitSemaphores[i] = src->pWaitSemaphores[i];
-        }
+        pWaitSemaphores = vl_safe_new_array<VkSemaphore>(waitSemaphoreCount);
+        memcpy ((void *)pWaitSemaphores, (void *)src->pWaitSemaphores, sizeof(VkSemaphore)*waitSemaphoreCount);
     }
     if (swapchainCount && src->pSwapchains) {
-        pSwapchains = new VkSwapchainKHR[swapchainCount];
-        for (uint32_t i=0; i<swapchainCount; ++i) {
-            pSwapchains[i] = src->pSwapchains[i];
-        }
+        pSwapchains = vl_safe_new_array<VkSwapchainKHR>(swapchainCount);
+        memcpy ((void *)pSwapchains, (void *)src->pSwapchains, sizeof(VkSwapchainKHR)*swapchainCount);
     }
     if (src->pImageIndices) {
-        pImageIndices = new uint32_t[src->swapchainCount];
+        pImageIndices = vl_safe_new_array<uint32_t>(src->swapchainCount);
         memcpy ((void *)pImageIndices, (void *)src->pImageIndices, sizeof(uint32_t)*src->swapchainCount);
     }
     if (src->pResults) {
-        pResults = new VkResult[src->swapchainCount];
+        pResults = vl_safe_new_array<VkResult>(src->swapchainCount);
         memcpy ((void *)pResults, (void *)src->pResults, sizeof(VkResult)*src->swapchainCount);
     }
 }
@@ -9739,6 +11622,23 @@ safe_VkImageSwapchainCreateInfoKHR& safe_VkImageSwapchainCreateInfoKHR::operator
     return *this;
 }
 
+safe_VkImageSwapchainCreateInfoKHR::safe_VkImageSwapchainCreateInfoKHR(safe_VkImageSwapchainCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageSwapchainCreateInfoKHR));
+    new (&src) safe_VkImageSwapchainCreateInfoKHR();
+}
+
+safe_VkImageSwapchainCreateInfoKHR& safe_VkImageSwapchainCreateInfoKHR::operator=(safe_VkImageSwapchainCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageSwapchainCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageSwapchainCreateInfoKHR));
+    new (&src) safe_VkImageSwapchainCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkImageSwapchainCreateInfoKHR::~safe_VkImageSwapchainCreateInfoKHR()
 {
 }
@@ -9789,6 +11689,23 @@ safe_VkBindImageMemorySwapchainInfoKHR& safe_VkBindImageMemorySwapchainInfoKHR::
     return *this;
 }
 
+safe_VkBindImageMemorySwapchainInfoKHR::safe_VkBindImageMemorySwapchainInfoKHR(safe_VkBindImageMemorySwapchainInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImageMemorySwapchainInfoKHR));
+    new (&src) safe_VkBindImageMemorySwapchainInfoKHR();
+}
+
+safe_VkBindImageMemorySwapchainInfoKHR& safe_VkBindImageMemorySwapchainInfoKHR::operator=(safe_VkBindImageMemorySwapchainInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindImageMemorySwapchainInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindImageMemorySwapchainInfoKHR));
+    new (&src) safe_VkBindImageMemorySwapchainInfoKHR();
+
+    return *this;
+}
+
 safe_VkBindImageMemorySwapchainInfoKHR::~safe_VkBindImageMemorySwapchainInfoKHR()
 {
 }
@@ -9850,6 +11767,23 @@ safe_VkAcquireNextImageInfoKHR& safe_VkAcquireNextImageInfoKHR::operator=(const
     return *this;
 }
 
+safe_VkAcquireNextImageInfoKHR::safe_VkAcquireNextImageInfoKHR(safe_VkAcquireNextImageInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAcquireNextImageInfoKHR));
+    new (&src) safe_VkAcquireNextImageInfoKHR();
+}
+
+safe_VkAcquireNextImageInfoKHR& safe_VkAcquireNextImageInfoKHR::operator=(safe_VkAcquireNextImageInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAcquireNextImageInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAcquireNextImageInfoKHR));
+    new (&src) safe_VkAcquireNextImageInfoKHR();
+
+    return *this;
+}
+
 safe_VkAcquireNextImageInfoKHR::~safe_VkAcquireNextImageInfoKHR()
 {
 }
@@ -9881,9 +11815,7 @@ safe_VkDeviceGroupPresentCapabilitiesKHR::safe_VkDeviceGroupPresentCapabilitiesK
     pNext(in_struct->pNext),
     modes(in_struct->modes)
 {
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        presentMask[i] = in_struct->presentMask[i];
-    }
+    memcpy (presentMask, in_struct->presentMask, sizeof(presentMask));
 }
 
 safe_VkDeviceGroupPresentCapabilitiesKHR::safe_VkDeviceGroupPresentCapabilitiesKHR()
@@ -9894,9 +11826,7 @@ safe_VkDeviceGroupPresentCapabilitiesKHR::safe_VkDeviceGroupPresentCapabilitiesK
     sType = src.sType;
     pNext = src.pNext;
     modes = src.modes;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        presentMask[i] = src.presentMask[i];
-    }
+    memcpy (presentMask, src.presentMask, sizeof(presentMask));
 }
 
 safe_VkDeviceGroupPresentCapabilitiesKHR& safe_VkDeviceGroupPresentCapabilitiesKHR::operator=(const safe_VkDeviceGroupPresentCapabilitiesKHR& src)
@@ -9907,9 +11837,24 @@ safe_VkDeviceGroupPresentCapabilitiesKHR& safe_VkDeviceGroupPresentCapabilitiesK
     sType = src.sType;
     pNext = src.pNext;
     modes = src.modes;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        presentMask[i] = src.presentMask[i];
-    }
+    memcpy (presentMask, src.presentMask, sizeof(presentMask));
+
+    return *this;
+}
+
+safe_VkDeviceGroupPresentCapabilitiesKHR::safe_VkDeviceGroupPresentCapabilitiesKHR(safe_VkDeviceGroupPresentCapabilitiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupPresentCapabilitiesKHR));
+    new (&src) safe_VkDeviceGroupPresentCapabilitiesKHR();
+}
+
+safe_VkDeviceGroupPresentCapabilitiesKHR& safe_VkDeviceGroupPresentCapabilitiesKHR::operator=(safe_VkDeviceGroupPresentCapabilitiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupPresentCapabilitiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupPresentCapabilitiesKHR));
+    new (&src) safe_VkDeviceGroupPresentCapabilitiesKHR();
 
     return *this;
 }
@@ -9923,9 +11868,7 @@ void safe_VkDeviceGroupPresentCapabilitiesKHR::initialize(const VkDeviceGroupPre
     sType = in_struct->sType;
     pNext = in_struct->pNext;
     modes = in_struct->modes;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        presentMask[i] = in_struct->presentMask[i];
-    }
+    memcpy (presentMask, in_struct->presentMask, sizeof(presentMask));
 }
 
 void safe_VkDeviceGroupPresentCapabilitiesKHR::initialize(const safe_VkDeviceGroupPresentCapabilitiesKHR* src)
@@ -9933,9 +11876,7 @@ void safe_VkDeviceGroupPresentCapabilitiesKHR::initialize(const safe_VkDeviceGro
     sType = src->sType;
     pNext = src->pNext;
     modes = src->modes;
-    for (uint32_t i=0; i<VK_MAX_DEVICE_GROUP_SIZE; ++i) {
-        presentMask[i] = src->presentMask[i];
-    }
+    memcpy (presentMask, src->presentMask, sizeof(presentMask));
 }
 
 safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(const VkDeviceGroupPresentInfoKHR* in_struct) :
@@ -9946,7 +11887,7 @@ safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(const VkDevic
     mode(in_struct->mode)
 {
     if (in_struct->pDeviceMasks) {
-        pDeviceMasks = new uint32_t[in_struct->swapchainCount];
+        pDeviceMasks = vl_safe_new_array<uint32_t>(in_struct->swapchainCount);
         memcpy ((void *)pDeviceMasks, (void *)in_struct->pDeviceMasks, sizeof(uint32_t)*in_struct->swapchainCount);
     }
 }
@@ -9963,7 +11904,7 @@ safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(const safe_Vk
     pDeviceMasks = nullptr;
     mode = src.mode;
     if (src.pDeviceMasks) {
-        pDeviceMasks = new uint32_t[src.swapchainCount];
+        pDeviceMasks = vl_safe_new_array<uint32_t>(src.swapchainCount);
         memcpy ((void *)pDeviceMasks, (void *)src.pDeviceMasks, sizeof(uint32_t)*src.swapchainCount);
     }
 }
@@ -9973,7 +11914,7 @@ safe_VkDeviceGroupPresentInfoKHR& safe_VkDeviceGroupPresentInfoKHR::operator=(co
     if (&src == this) return *this;
 
     if (pDeviceMasks)
-        delete[] pDeviceMasks;
+        vl_safe_delete_array(pDeviceMasks);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -9981,17 +11922,34 @@ safe_VkDeviceGroupPresentInfoKHR& safe_VkDeviceGroupPresentInfoKHR::operator=(co
     pDeviceMasks = nullptr;
     mode = src.mode;
     if (src.pDeviceMasks) {
-        pDeviceMasks = new uint32_t[src.swapchainCount];
+        pDeviceMasks = vl_safe_new_array<uint32_t>(src.swapchainCount);
         memcpy ((void *)pDeviceMasks, (void *)src.pDeviceMasks, sizeof(uint32_t)*src.swapchainCount);
     }
 
     return *this;
 }
 
+safe_VkDeviceGroupPresentInfoKHR::safe_VkDeviceGroupPresentInfoKHR(safe_VkDeviceGroupPresentInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupPresentInfoKHR));
+    new (&src) safe_VkDeviceGroupPresentInfoKHR();
+}
+
+safe_VkDeviceGroupPresentInfoKHR& safe_VkDeviceGroupPresentInfoKHR::operator=(safe_VkDeviceGroupPresentInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupPresentInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupPresentInfoKHR));
+    new (&src) safe_VkDeviceGroupPresentInfoKHR();
+
+    return *this;
+}
+
 safe_VkDeviceGroupPresentInfoKHR::~safe_VkDeviceGroupPresentInfoKHR()
 {
     if (pDeviceMasks)
-        delete[] pDeviceMasks;
+        vl_safe_delete_array(pDeviceMasks);
 }
 
 void safe_VkDeviceGroupPresentInfoKHR::initialize(const VkDeviceGroupPresentInfoKHR* in_struct)
@@ -10002,7 +11960,7 @@ void safe_VkDeviceGroupPresentInfoKHR::initialize(const VkDeviceGroupPresentInfo
     pDeviceMasks = nullptr;
     mode = in_struct->mode;
     if (in_struct->pDeviceMasks) {
-        pDeviceMasks = new uint32_t[in_struct->swapchainCount];
+        pDeviceMasks = vl_safe_new_array<uint32_t>(in_struct->swapchainCount);
         memcpy ((void *)pDeviceMasks, (void *)in_struct->pDeviceMasks, sizeof(uint32_t)*in_struct->swapchainCount);
     }
 }
@@ -10015,7 +11973,7 @@ void safe_VkDeviceGroupPresentInfoKHR::initialize(const safe_VkDeviceGroupPresen
     pDeviceMasks = nullptr;
     mode = src->mode;
     if (src->pDeviceMasks) {
-        pDeviceMasks = new uint32_t[src->swapchainCount];
+        pDeviceMasks = vl_safe_new_array<uint32_t>(src->swapchainCount);
         memcpy ((void *)pDeviceMasks, (void *)src->pDeviceMasks, sizeof(uint32_t)*src->swapchainCount);
     }
 }
@@ -10049,6 +12007,23 @@ safe_VkDeviceGroupSwapchainCreateInfoKHR& safe_VkDeviceGroupSwapchainCreateInfoK
     return *this;
 }
 
+safe_VkDeviceGroupSwapchainCreateInfoKHR::safe_VkDeviceGroupSwapchainCreateInfoKHR(safe_VkDeviceGroupSwapchainCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupSwapchainCreateInfoKHR));
+    new (&src) safe_VkDeviceGroupSwapchainCreateInfoKHR();
+}
+
+safe_VkDeviceGroupSwapchainCreateInfoKHR& safe_VkDeviceGroupSwapchainCreateInfoKHR::operator=(safe_VkDeviceGroupSwapchainCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGroupSwapchainCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGroupSwapchainCreateInfoKHR));
+    new (&src) safe_VkDeviceGroupSwapchainCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkDeviceGroupSwapchainCreateInfoKHR::~safe_VkDeviceGroupSwapchainCreateInfoKHR()
 {
 }
@@ -10108,6 +12083,23 @@ safe_VkDisplayPropertiesKHR& safe_VkDisplayPropertiesKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkDisplayPropertiesKHR::safe_VkDisplayPropertiesKHR(safe_VkDisplayPropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPropertiesKHR));
+    new (&src) safe_VkDisplayPropertiesKHR();
+}
+
+safe_VkDisplayPropertiesKHR& safe_VkDisplayPropertiesKHR::operator=(safe_VkDisplayPropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayPropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPropertiesKHR));
+    new (&src) safe_VkDisplayPropertiesKHR();
+
+    return *this;
+}
+
 safe_VkDisplayPropertiesKHR::~safe_VkDisplayPropertiesKHR()
 {
 }
@@ -10166,6 +12158,23 @@ safe_VkDisplayModeCreateInfoKHR& safe_VkDisplayModeCreateInfoKHR::operator=(cons
     return *this;
 }
 
+safe_VkDisplayModeCreateInfoKHR::safe_VkDisplayModeCreateInfoKHR(safe_VkDisplayModeCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayModeCreateInfoKHR));
+    new (&src) safe_VkDisplayModeCreateInfoKHR();
+}
+
+safe_VkDisplayModeCreateInfoKHR& safe_VkDisplayModeCreateInfoKHR::operator=(safe_VkDisplayModeCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayModeCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayModeCreateInfoKHR));
+    new (&src) safe_VkDisplayModeCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkDisplayModeCreateInfoKHR::~safe_VkDisplayModeCreateInfoKHR()
 {
 }
@@ -10236,6 +12245,23 @@ safe_VkDisplaySurfaceCreateInfoKHR& safe_VkDisplaySurfaceCreateInfoKHR::operator
     return *this;
 }
 
+safe_VkDisplaySurfaceCreateInfoKHR::safe_VkDisplaySurfaceCreateInfoKHR(safe_VkDisplaySurfaceCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplaySurfaceCreateInfoKHR));
+    new (&src) safe_VkDisplaySurfaceCreateInfoKHR();
+}
+
+safe_VkDisplaySurfaceCreateInfoKHR& safe_VkDisplaySurfaceCreateInfoKHR::operator=(safe_VkDisplaySurfaceCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplaySurfaceCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplaySurfaceCreateInfoKHR));
+    new (&src) safe_VkDisplaySurfaceCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkDisplaySurfaceCreateInfoKHR::~safe_VkDisplaySurfaceCreateInfoKHR()
 {
 }
@@ -10303,6 +12329,23 @@ safe_VkDisplayPresentInfoKHR& safe_VkDisplayPresentInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkDisplayPresentInfoKHR::safe_VkDisplayPresentInfoKHR(safe_VkDisplayPresentInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPresentInfoKHR));
+    new (&src) safe_VkDisplayPresentInfoKHR();
+}
+
+safe_VkDisplayPresentInfoKHR& safe_VkDisplayPresentInfoKHR::operator=(safe_VkDisplayPresentInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayPresentInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPresentInfoKHR));
+    new (&src) safe_VkDisplayPresentInfoKHR();
+
+    return *this;
+}
+
 safe_VkDisplayPresentInfoKHR::~safe_VkDisplayPresentInfoKHR()
 {
 }
@@ -10362,6 +12405,23 @@ safe_VkImportMemoryWin32HandleInfoKHR& safe_VkImportMemoryWin32HandleInfoKHR::op
     return *this;
 }
 
+safe_VkImportMemoryWin32HandleInfoKHR::safe_VkImportMemoryWin32HandleInfoKHR(safe_VkImportMemoryWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryWin32HandleInfoKHR));
+    new (&src) safe_VkImportMemoryWin32HandleInfoKHR();
+}
+
+safe_VkImportMemoryWin32HandleInfoKHR& safe_VkImportMemoryWin32HandleInfoKHR::operator=(safe_VkImportMemoryWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportMemoryWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryWin32HandleInfoKHR));
+    new (&src) safe_VkImportMemoryWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkImportMemoryWin32HandleInfoKHR::~safe_VkImportMemoryWin32HandleInfoKHR()
 {
 }
@@ -10396,7 +12456,7 @@ safe_VkExportMemoryWin32HandleInfoKHR::safe_VkExportMemoryWin32HandleInfoKHR(con
     name(in_struct->name)
 {
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -10412,7 +12472,7 @@ safe_VkExportMemoryWin32HandleInfoKHR::safe_VkExportMemoryWin32HandleInfoKHR(con
     dwAccess = src.dwAccess;
     name = src.name;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 }
 
@@ -10421,7 +12481,7 @@ safe_VkExportMemoryWin32HandleInfoKHR& safe_VkExportMemoryWin32HandleInfoKHR::op
     if (&src == this) return *this;
 
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -10429,16 +12489,33 @@ safe_VkExportMemoryWin32HandleInfoKHR& safe_VkExportMemoryWin32HandleInfoKHR::op
     dwAccess = src.dwAccess;
     name = src.name;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 
     return *this;
 }
 
+safe_VkExportMemoryWin32HandleInfoKHR::safe_VkExportMemoryWin32HandleInfoKHR(safe_VkExportMemoryWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryWin32HandleInfoKHR));
+    new (&src) safe_VkExportMemoryWin32HandleInfoKHR();
+}
+
+safe_VkExportMemoryWin32HandleInfoKHR& safe_VkExportMemoryWin32HandleInfoKHR::operator=(safe_VkExportMemoryWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportMemoryWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryWin32HandleInfoKHR));
+    new (&src) safe_VkExportMemoryWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkExportMemoryWin32HandleInfoKHR::~safe_VkExportMemoryWin32HandleInfoKHR()
 {
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 }
 
 void safe_VkExportMemoryWin32HandleInfoKHR::initialize(const VkExportMemoryWin32HandleInfoKHR* in_struct)
@@ -10449,7 +12526,7 @@ void safe_VkExportMemoryWin32HandleInfoKHR::initialize(const VkExportMemoryWin32
     dwAccess = in_struct->dwAccess;
     name = in_struct->name;
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -10461,7 +12538,7 @@ void safe_VkExportMemoryWin32HandleInfoKHR::initialize(const safe_VkExportMemory
     dwAccess = src->dwAccess;
     name = src->name;
     if (src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -10498,6 +12575,23 @@ safe_VkMemoryWin32HandlePropertiesKHR& safe_VkMemoryWin32HandlePropertiesKHR::op
     return *this;
 }
 
+safe_VkMemoryWin32HandlePropertiesKHR::safe_VkMemoryWin32HandlePropertiesKHR(safe_VkMemoryWin32HandlePropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryWin32HandlePropertiesKHR));
+    new (&src) safe_VkMemoryWin32HandlePropertiesKHR();
+}
+
+safe_VkMemoryWin32HandlePropertiesKHR& safe_VkMemoryWin32HandlePropertiesKHR::operator=(safe_VkMemoryWin32HandlePropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryWin32HandlePropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryWin32HandlePropertiesKHR));
+    new (&src) safe_VkMemoryWin32HandlePropertiesKHR();
+
+    return *this;
+}
+
 safe_VkMemoryWin32HandlePropertiesKHR::~safe_VkMemoryWin32HandlePropertiesKHR()
 {
 }
@@ -10552,6 +12646,23 @@ safe_VkMemoryGetWin32HandleInfoKHR& safe_VkMemoryGetWin32HandleInfoKHR::operator
     return *this;
 }
 
+safe_VkMemoryGetWin32HandleInfoKHR::safe_VkMemoryGetWin32HandleInfoKHR(safe_VkMemoryGetWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryGetWin32HandleInfoKHR));
+    new (&src) safe_VkMemoryGetWin32HandleInfoKHR();
+}
+
+safe_VkMemoryGetWin32HandleInfoKHR& safe_VkMemoryGetWin32HandleInfoKHR::operator=(safe_VkMemoryGetWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryGetWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryGetWin32HandleInfoKHR));
+    new (&src) safe_VkMemoryGetWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkMemoryGetWin32HandleInfoKHR::~safe_VkMemoryGetWin32HandleInfoKHR()
 {
 }
@@ -10606,6 +12717,23 @@ safe_VkImportMemoryFdInfoKHR& safe_VkImportMemoryFdInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkImportMemoryFdInfoKHR::safe_VkImportMemoryFdInfoKHR(safe_VkImportMemoryFdInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryFdInfoKHR));
+    new (&src) safe_VkImportMemoryFdInfoKHR();
+}
+
+safe_VkImportMemoryFdInfoKHR& safe_VkImportMemoryFdInfoKHR::operator=(safe_VkImportMemoryFdInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportMemoryFdInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryFdInfoKHR));
+    new (&src) safe_VkImportMemoryFdInfoKHR();
+
+    return *this;
+}
+
 safe_VkImportMemoryFdInfoKHR::~safe_VkImportMemoryFdInfoKHR()
 {
 }
@@ -10655,6 +12783,23 @@ safe_VkMemoryFdPropertiesKHR& safe_VkMemoryFdPropertiesKHR::operator=(const safe
     return *this;
 }
 
+safe_VkMemoryFdPropertiesKHR::safe_VkMemoryFdPropertiesKHR(safe_VkMemoryFdPropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryFdPropertiesKHR));
+    new (&src) safe_VkMemoryFdPropertiesKHR();
+}
+
+safe_VkMemoryFdPropertiesKHR& safe_VkMemoryFdPropertiesKHR::operator=(safe_VkMemoryFdPropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryFdPropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryFdPropertiesKHR));
+    new (&src) safe_VkMemoryFdPropertiesKHR();
+
+    return *this;
+}
+
 safe_VkMemoryFdPropertiesKHR::~safe_VkMemoryFdPropertiesKHR()
 {
 }
@@ -10705,6 +12850,23 @@ safe_VkMemoryGetFdInfoKHR& safe_VkMemoryGetFdInfoKHR::operator=(const safe_VkMem
     return *this;
 }
 
+safe_VkMemoryGetFdInfoKHR::safe_VkMemoryGetFdInfoKHR(safe_VkMemoryGetFdInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryGetFdInfoKHR));
+    new (&src) safe_VkMemoryGetFdInfoKHR();
+}
+
+safe_VkMemoryGetFdInfoKHR& safe_VkMemoryGetFdInfoKHR::operator=(safe_VkMemoryGetFdInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryGetFdInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryGetFdInfoKHR));
+    new (&src) safe_VkMemoryGetFdInfoKHR();
+
+    return *this;
+}
+
 safe_VkMemoryGetFdInfoKHR::~safe_VkMemoryGetFdInfoKHR()
 {
 }
@@ -10739,27 +12901,23 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::safe_VkWin32KeyedMutexAcquireReleas
     pReleaseKeys(nullptr)
 {
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)in_struct->pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeouts = vl_safe_new_array<uint32_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireTimeouts, (void *)in_struct->pAcquireTimeouts, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)in_struct->pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(in_struct->releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -10784,27 +12942,23 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::safe_VkWin32KeyedMutexAcquireReleas
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = src.pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)src.pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[src.acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(src.acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)src.pAcquireKeys, sizeof(uint64_t)*src.acquireCount);
     }
     if (src.pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[src.acquireCount];
+        pAcquireTimeouts = vl_safe_new_array<uint32_t>(src.acquireCount);
         memcpy ((void *)pAcquireTimeouts, (void *)src.pAcquireTimeouts, sizeof(uint32_t)*src.acquireCount);
     }
     if (releaseCount && src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = src.pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)src.pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[src.releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(src.releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)src.pReleaseKeys, sizeof(uint64_t)*src.releaseCount);
     }
 }
@@ -10814,15 +12968,15 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& safe_VkWin32KeyedMutexAcquireReleas
     if (&src == this) return *this;
 
     if (pAcquireSyncs)
-        delete[] pAcquireSyncs;
+        vl_safe_delete_array(pAcquireSyncs);
     if (pAcquireKeys)
-        delete[] pAcquireKeys;
+        vl_safe_delete_array(pAcquireKeys);
     if (pAcquireTimeouts)
-        delete[] pAcquireTimeouts;
+        vl_safe_delete_array(pAcquireTimeouts);
     if (pReleaseSyncs)
-        delete[] pReleaseSyncs;
+        vl_safe_delete_array(pReleaseSyncs);
     if (pReleaseKeys)
-        delete[] pReleaseKeys;
+        vl_safe_delete_array(pReleaseKeys);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -10834,45 +12988,58 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& safe_VkWin32KeyedMutexAcquireReleas
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = src.pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)src.pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[src.acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(src.acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)src.pAcquireKeys, sizeof(uint64_t)*src.acquireCount);
     }
     if (src.pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[src.acquireCount];
+        pAcquireTimeouts = vl_safe_new_array<uint32_t>(src.acquireCount);
         memcpy ((void *)pAcquireTimeouts, (void *)src.pAcquireTimeouts, sizeof(uint32_t)*src.acquireCount);
     }
     if (releaseCount && src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = src.pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)src.pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[src.releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(src.releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)src.pReleaseKeys, sizeof(uint64_t)*src.releaseCount);
     }
 
     return *this;
 }
 
+safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR));
+    new (&src) safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
+}
+
+safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::operator=(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR));
+    new (&src) safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
+
+    return *this;
+}
+
 safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::~safe_VkWin32KeyedMutexAcquireReleaseInfoKHR()
 {
     if (pAcquireSyncs)
-        delete[] pAcquireSyncs;
+        vl_safe_delete_array(pAcquireSyncs);
     if (pAcquireKeys)
-        delete[] pAcquireKeys;
+        vl_safe_delete_array(pAcquireKeys);
     if (pAcquireTimeouts)
-        delete[] pAcquireTimeouts;
+        vl_safe_delete_array(pAcquireTimeouts);
     if (pReleaseSyncs)
-        delete[] pReleaseSyncs;
+        vl_safe_delete_array(pReleaseSyncs);
     if (pReleaseKeys)
-        delete[] pReleaseKeys;
+        vl_safe_delete_array(pReleaseKeys);
 }
 
 void safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::initialize(const VkWin32KeyedMutexAcquireReleaseInfoKHR* in_struct)
@@ -10887,27 +13054,23 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::initialize(const VkWin32KeyedM
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)in_struct->pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeouts = vl_safe_new_array<uint32_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireTimeouts, (void *)in_struct->pAcquireTimeouts, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)in_struct->pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(in_struct->releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -10924,27 +13087,23 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoKHR::initialize(const safe_VkWin32K
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && src->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = src->pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)src->pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (src->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[src->acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(src->acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)src->pAcquireKeys, sizeof(uint64_t)*src->acquireCount);
     }
     if (src->pAcquireTimeouts) {
-        pAcquireTimeouts = new uint32_t[src->acquireCount];
+        pAcquireTimeouts = vl_safe_new_array<uint32_t>(src->acquireCount);
         memcpy ((void *)pAcquireTimeouts, (void *)src->pAcquireTimeouts, sizeof(uint32_t)*src->acquireCount);
     }
     if (releaseCount && src->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = src->pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)src->pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (src->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[src->releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(src->releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)src->pReleaseKeys, sizeof(uint64_t)*src->releaseCount);
     }
 }
@@ -10994,6 +13153,23 @@ safe_VkImportSemaphoreWin32HandleInfoKHR& safe_VkImportSemaphoreWin32HandleInfoK
     return *this;
 }
 
+safe_VkImportSemaphoreWin32HandleInfoKHR::safe_VkImportSemaphoreWin32HandleInfoKHR(safe_VkImportSemaphoreWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportSemaphoreWin32HandleInfoKHR));
+    new (&src) safe_VkImportSemaphoreWin32HandleInfoKHR();
+}
+
+safe_VkImportSemaphoreWin32HandleInfoKHR& safe_VkImportSemaphoreWin32HandleInfoKHR::operator=(safe_VkImportSemaphoreWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportSemaphoreWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportSemaphoreWin32HandleInfoKHR));
+    new (&src) safe_VkImportSemaphoreWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkImportSemaphoreWin32HandleInfoKHR::~safe_VkImportSemaphoreWin32HandleInfoKHR()
 {
 }
@@ -11032,7 +13208,7 @@ safe_VkExportSemaphoreWin32HandleInfoKHR::safe_VkExportSemaphoreWin32HandleInfoK
     name(in_struct->name)
 {
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -11048,7 +13224,7 @@ safe_VkExportSemaphoreWin32HandleInfoKHR::safe_VkExportSemaphoreWin32HandleInfoK
     dwAccess = src.dwAccess;
     name = src.name;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 }
 
@@ -11057,7 +13233,7 @@ safe_VkExportSemaphoreWin32HandleInfoKHR& safe_VkExportSemaphoreWin32HandleInfoK
     if (&src == this) return *this;
 
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -11065,16 +13241,33 @@ safe_VkExportSemaphoreWin32HandleInfoKHR& safe_VkExportSemaphoreWin32HandleInfoK
     dwAccess = src.dwAccess;
     name = src.name;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 
     return *this;
 }
 
+safe_VkExportSemaphoreWin32HandleInfoKHR::safe_VkExportSemaphoreWin32HandleInfoKHR(safe_VkExportSemaphoreWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportSemaphoreWin32HandleInfoKHR));
+    new (&src) safe_VkExportSemaphoreWin32HandleInfoKHR();
+}
+
+safe_VkExportSemaphoreWin32HandleInfoKHR& safe_VkExportSemaphoreWin32HandleInfoKHR::operator=(safe_VkExportSemaphoreWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportSemaphoreWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportSemaphoreWin32HandleInfoKHR));
+    new (&src) safe_VkExportSemaphoreWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkExportSemaphoreWin32HandleInfoKHR::~safe_VkExportSemaphoreWin32HandleInfoKHR()
 {
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 }
 
 void safe_VkExportSemaphoreWin32HandleInfoKHR::initialize(const VkExportSemaphoreWin32HandleInfoKHR* in_struct)
@@ -11085,7 +13278,7 @@ void safe_VkExportSemaphoreWin32HandleInfoKHR::initialize(const VkExportSemaphor
     dwAccess = in_struct->dwAccess;
     name = in_struct->name;
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -11097,7 +13290,7 @@ void safe_VkExportSemaphoreWin32HandleInfoKHR::initialize(const safe_VkExportSem
     dwAccess = src->dwAccess;
     name = src->name;
     if (src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -11114,11 +13307,11 @@ safe_VkD3D12FenceSubmitInfoKHR::safe_VkD3D12FenceSubmitInfoKHR(const VkD3D12Fenc
     pSignalSemaphoreValues(nullptr)
 {
     if (in_struct->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[in_struct->waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = vl_safe_new_array<uint64_t>(in_struct->waitSemaphoreValuesCount);
         memcpy ((void *)pWaitSemaphoreValues, (void *)in_struct->pWaitSemaphoreValues, sizeof(uint64_t)*in_struct->waitSemaphoreValuesCount);
     }
     if (in_struct->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[in_struct->signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = vl_safe_new_array<uint64_t>(in_struct->signalSemaphoreValuesCount);
         memcpy ((void *)pSignalSemaphoreValues, (void *)in_struct->pSignalSemaphoreValues, sizeof(uint64_t)*in_struct->signalSemaphoreValuesCount);
     }
 }
@@ -11137,11 +13330,11 @@ safe_VkD3D12FenceSubmitInfoKHR::safe_VkD3D12FenceSubmitInfoKHR(const safe_VkD3D1
     signalSemaphoreValuesCount = src.signalSemaphoreValuesCount;
     pSignalSemaphoreValues = nullptr;
     if (src.pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[src.waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = vl_safe_new_array<uint64_t>(src.waitSemaphoreValuesCount);
         memcpy ((void *)pWaitSemaphoreValues, (void *)src.pWaitSemaphoreValues, sizeof(uint64_t)*src.waitSemaphoreValuesCount);
     }
     if (src.pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[src.signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = vl_safe_new_array<uint64_t>(src.signalSemaphoreValuesCount);
         memcpy ((void *)pSignalSemaphoreValues, (void *)src.pSignalSemaphoreValues, sizeof(uint64_t)*src.signalSemaphoreValuesCount);
     }
 }
@@ -11151,9 +13344,9 @@ safe_VkD3D12FenceSubmitInfoKHR& safe_VkD3D12FenceSubmitInfoKHR::operator=(const
     if (&src == this) return *this;
 
     if (pWaitSemaphoreValues)
-        delete[] pWaitSemaphoreValues;
+        vl_safe_delete_array(pWaitSemaphoreValues);
     if (pSignalSemaphoreValues)
-        delete[] pSignalSemaphoreValues;
+        vl_safe_delete_array(pSignalSemaphoreValues);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -11162,23 +13355,40 @@ safe_VkD3D12FenceSubmitInfoKHR& safe_VkD3D12FenceSubmitInfoKHR::operator=(const
     signalSemaphoreValuesCount = src.signalSemaphoreValuesCount;
     pSignalSemaphoreValues = nullptr;
     if (src.pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[src.waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = vl_safe_new_array<uint64_t>(src.waitSemaphoreValuesCount);
         memcpy ((void *)pWaitSemaphoreValues, (void *)src.pWaitSemaphoreValues, sizeof(uint64_t)*src.waitSemaphoreValuesCount);
     }
     if (src.pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[src.signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = vl_safe_new_array<uint64_t>(src.signalSemaphoreValuesCount);
         memcpy ((void *)pSignalSemaphoreValues, (void *)src.pSignalSemaphoreValues, sizeof(uint64_t)*src.signalSemaphoreValuesCount);
     }
 
     return *this;
 }
 
+safe_VkD3D12FenceSubmitInfoKHR::safe_VkD3D12FenceSubmitInfoKHR(safe_VkD3D12FenceSubmitInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkD3D12FenceSubmitInfoKHR));
+    new (&src) safe_VkD3D12FenceSubmitInfoKHR();
+}
+
+safe_VkD3D12FenceSubmitInfoKHR& safe_VkD3D12FenceSubmitInfoKHR::operator=(safe_VkD3D12FenceSubmitInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkD3D12FenceSubmitInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkD3D12FenceSubmitInfoKHR));
+    new (&src) safe_VkD3D12FenceSubmitInfoKHR();
+
+    return *this;
+}
+
 safe_VkD3D12FenceSubmitInfoKHR::~safe_VkD3D12FenceSubmitInfoKHR()
 {
     if (pWaitSemaphoreValues)
-        delete[] pWaitSemaphoreValues;
+        vl_safe_delete_array(pWaitSemaphoreValues);
     if (pSignalSemaphoreValues)
-        delete[] pSignalSemaphoreValues;
+        vl_safe_delete_array(pSignalSemaphoreValues);
 }
 
 void safe_VkD3D12FenceSubmitInfoKHR::initialize(const VkD3D12FenceSubmitInfoKHR* in_struct)
@@ -11190,11 +13400,11 @@ void safe_VkD3D12FenceSubmitInfoKHR::initialize(const VkD3D12FenceSubmitInfoKHR*
     signalSemaphoreValuesCount = in_struct->signalSemaphoreValuesCount;
     pSignalSemaphoreValues = nullptr;
     if (in_struct->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[in_struct->waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = vl_safe_new_array<uint64_t>(in_struct->waitSemaphoreValuesCount);
         memcpy ((void *)pWaitSemaphoreValues, (void *)in_struct->pWaitSemaphoreValues, sizeof(uint64_t)*in_struct->waitSemaphoreValuesCount);
     }
     if (in_struct->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[in_struct->signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = vl_safe_new_array<uint64_t>(in_struct->signalSemaphoreValuesCount);
         memcpy ((void *)pSignalSemaphoreValues, (void *)in_struct->pSignalSemaphoreValues, sizeof(uint64_t)*in_struct->signalSemaphoreValuesCount);
     }
 }
@@ -11208,11 +13418,11 @@ void safe_VkD3D12FenceSubmitInfoKHR::initialize(const safe_VkD3D12FenceSubmitInf
     signalSemaphoreValuesCount = src->signalSemaphoreValuesCount;
     pSignalSemaphoreValues = nullptr;
     if (src->pWaitSemaphoreValues) {
-        pWaitSemaphoreValues = new uint64_t[src->waitSemaphoreValuesCount];
+        pWaitSemaphoreValues = vl_safe_new_array<uint64_t>(src->waitSemaphoreValuesCount);
         memcpy ((void *)pWaitSemaphoreValues, (void *)src->pWaitSemaphoreValues, sizeof(uint64_t)*src->waitSemaphoreValuesCount);
     }
     if (src->pSignalSemaphoreValues) {
-        pSignalSemaphoreValues = new uint64_t[src->signalSemaphoreValuesCount];
+        pSignalSemaphoreValues = vl_safe_new_array<uint64_t>(src->signalSemaphoreValuesCount);
         memcpy ((void *)pSignalSemaphoreValues, (void *)src->pSignalSemaphoreValues, sizeof(uint64_t)*src->signalSemaphoreValuesCount);
     }
 }
@@ -11253,6 +13463,23 @@ safe_VkSemaphoreGetWin32HandleInfoKHR& safe_VkSemaphoreGetWin32HandleInfoKHR::op
     return *this;
 }
 
+safe_VkSemaphoreGetWin32HandleInfoKHR::safe_VkSemaphoreGetWin32HandleInfoKHR(safe_VkSemaphoreGetWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSemaphoreGetWin32HandleInfoKHR));
+    new (&src) safe_VkSemaphoreGetWin32HandleInfoKHR();
+}
+
+safe_VkSemaphoreGetWin32HandleInfoKHR& safe_VkSemaphoreGetWin32HandleInfoKHR::operator=(safe_VkSemaphoreGetWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSemaphoreGetWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSemaphoreGetWin32HandleInfoKHR));
+    new (&src) safe_VkSemaphoreGetWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkSemaphoreGetWin32HandleInfoKHR::~safe_VkSemaphoreGetWin32HandleInfoKHR()
 {
 }
@@ -11313,6 +13540,23 @@ safe_VkImportSemaphoreFdInfoKHR& safe_VkImportSemaphoreFdInfoKHR::operator=(cons
     return *this;
 }
 
+safe_VkImportSemaphoreFdInfoKHR::safe_VkImportSemaphoreFdInfoKHR(safe_VkImportSemaphoreFdInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportSemaphoreFdInfoKHR));
+    new (&src) safe_VkImportSemaphoreFdInfoKHR();
+}
+
+safe_VkImportSemaphoreFdInfoKHR& safe_VkImportSemaphoreFdInfoKHR::operator=(safe_VkImportSemaphoreFdInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportSemaphoreFdInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportSemaphoreFdInfoKHR));
+    new (&src) safe_VkImportSemaphoreFdInfoKHR();
+
+    return *this;
+}
+
 safe_VkImportSemaphoreFdInfoKHR::~safe_VkImportSemaphoreFdInfoKHR()
 {
 }
@@ -11369,6 +13613,23 @@ safe_VkSemaphoreGetFdInfoKHR& safe_VkSemaphoreGetFdInfoKHR::operator=(const safe
     return *this;
 }
 
+safe_VkSemaphoreGetFdInfoKHR::safe_VkSemaphoreGetFdInfoKHR(safe_VkSemaphoreGetFdInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSemaphoreGetFdInfoKHR));
+    new (&src) safe_VkSemaphoreGetFdInfoKHR();
+}
+
+safe_VkSemaphoreGetFdInfoKHR& safe_VkSemaphoreGetFdInfoKHR::operator=(safe_VkSemaphoreGetFdInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSemaphoreGetFdInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSemaphoreGetFdInfoKHR));
+    new (&src) safe_VkSemaphoreGetFdInfoKHR();
+
+    return *this;
+}
+
 safe_VkSemaphoreGetFdInfoKHR::~safe_VkSemaphoreGetFdInfoKHR()
 {
 }
@@ -11418,6 +13679,23 @@ safe_VkPhysicalDevicePushDescriptorPropertiesKHR& safe_VkPhysicalDevicePushDescr
     return *this;
 }
 
+safe_VkPhysicalDevicePushDescriptorPropertiesKHR::safe_VkPhysicalDevicePushDescriptorPropertiesKHR(safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevicePushDescriptorPropertiesKHR));
+    new (&src) safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
+}
+
+safe_VkPhysicalDevicePushDescriptorPropertiesKHR& safe_VkPhysicalDevicePushDescriptorPropertiesKHR::operator=(safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevicePushDescriptorPropertiesKHR));
+    new (&src) safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePushDescriptorPropertiesKHR::~safe_VkPhysicalDevicePushDescriptorPropertiesKHR()
 {
 }
@@ -11468,6 +13746,23 @@ safe_VkPhysicalDeviceFloat16Int8FeaturesKHR& safe_VkPhysicalDeviceFloat16Int8Fea
     return *this;
 }
 
+safe_VkPhysicalDeviceFloat16Int8FeaturesKHR::safe_VkPhysicalDeviceFloat16Int8FeaturesKHR(safe_VkPhysicalDeviceFloat16Int8FeaturesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFloat16Int8FeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceFloat16Int8FeaturesKHR();
+}
+
+safe_VkPhysicalDeviceFloat16Int8FeaturesKHR& safe_VkPhysicalDeviceFloat16Int8FeaturesKHR::operator=(safe_VkPhysicalDeviceFloat16Int8FeaturesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFloat16Int8FeaturesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFloat16Int8FeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceFloat16Int8FeaturesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFloat16Int8FeaturesKHR::~safe_VkPhysicalDeviceFloat16Int8FeaturesKHR()
 {
 }
@@ -11493,7 +13788,7 @@ safe_VkPresentRegionKHR::safe_VkPresentRegionKHR(const VkPresentRegionKHR* in_st
     pRectangles(nullptr)
 {
     if (in_struct->pRectangles) {
-        pRectangles = new VkRectLayerKHR[in_struct->rectangleCount];
+        pRectangles = vl_safe_new_array<VkRectLayerKHR>(in_struct->rectangleCount);
         memcpy ((void *)pRectangles, (void *)in_struct->pRectangles, sizeof(VkRectLayerKHR)*in_struct->rectangleCount);
     }
 }
@@ -11507,7 +13802,7 @@ safe_VkPresentRegionKHR::safe_VkPresentRegionKHR(const safe_VkPresentRegionKHR&
     rectangleCount = src.rectangleCount;
     pRectangles = nullptr;
     if (src.pRectangles) {
-        pRectangles = new VkRectLayerKHR[src.rectangleCount];
+        pRectangles = vl_safe_new_array<VkRectLayerKHR>(src.rectangleCount);
         memcpy ((void *)pRectangles, (void *)src.pRectangles, sizeof(VkRectLayerKHR)*src.rectangleCount);
     }
 }
@@ -11517,22 +13812,39 @@ safe_VkPresentRegionKHR& safe_VkPresentRegionKHR::operator=(const safe_VkPresent
     if (&src == this) return *this;
 
     if (pRectangles)
-        delete[] pRectangles;
+        vl_safe_delete_array(pRectangles);
 
     rectangleCount = src.rectangleCount;
     pRectangles = nullptr;
     if (src.pRectangles) {
-        pRectangles = new VkRectLayerKHR[src.rectangleCount];
+        pRectangles = vl_safe_new_array<VkRectLayerKHR>(src.rectangleCount);
         memcpy ((void *)pRectangles, (void *)src.pRectangles, sizeof(VkRectLayerKHR)*src.rectangleCount);
     }
 
     return *this;
 }
 
+safe_VkPresentRegionKHR::safe_VkPresentRegionKHR(safe_VkPresentRegionKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentRegionKHR));
+    new (&src) safe_VkPresentRegionKHR();
+}
+
+safe_VkPresentRegionKHR& safe_VkPresentRegionKHR::operator=(safe_VkPresentRegionKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPresentRegionKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentRegionKHR));
+    new (&src) safe_VkPresentRegionKHR();
+
+    return *this;
+}
+
 safe_VkPresentRegionKHR::~safe_VkPresentRegionKHR()
 {
     if (pRectangles)
-        delete[] pRectangles;
+        vl_safe_delete_array(pRectangles);
 }
 
 void safe_VkPresentRegionKHR::initialize(const VkPresentRegionKHR* in_struct)
@@ -11540,7 +13852,7 @@ void safe_VkPresentRegionKHR::initialize(const VkPresentRegionKHR* in_struct)
     rectangleCount = in_struct->rectangleCount;
     pRectangles = nullptr;
     if (in_struct->pRectangles) {
-        pRectangles = new VkRectLayerKHR[in_struct->rectangleCount];
+        pRectangles = vl_safe_new_array<VkRectLayerKHR>(in_struct->rectangleCount);
         memcpy ((void *)pRectangles, (void *)in_struct->pRectangles, sizeof(VkRectLayerKHR)*in_struct->rectangleCount);
     }
 }
@@ -11550,7 +13862,7 @@ void safe_VkPresentRegionKHR::initialize(const safe_VkPresentRegionKHR* src)
     rectangleCount = src->rectangleCount;
     pRectangles = nullptr;
     if (src->pRectangles) {
-        pRectangles = new VkRectLayerKHR[src->rectangleCount];
+        pRectangles = vl_safe_new_array<VkRectLayerKHR>(src->rectangleCount);
         memcpy ((void *)pRectangles, (void *)src->pRectangles, sizeof(VkRectLayerKHR)*src->rectangleCount);
     }
 }
@@ -11562,7 +13874,7 @@ safe_VkPresentRegionsKHR::safe_VkPresentRegionsKHR(const VkPresentRegionsKHR* in
     pRegions(nullptr)
 {
     if (swapchainCount && in_struct->pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = vl_safe_new_array<safe_VkPresentRegionKHR>(swapchainCount);
         for (uint32_t i=0; i<swapchainCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -11580,7 +13892,7 @@ safe_VkPresentRegionsKHR::safe_VkPresentRegionsKHR(const safe_VkPresentRegionsKH
     swapchainCount = src.swapchainCount;
     pRegions = nullptr;
     if (swapchainCount && src.pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = vl_safe_new_array<safe_VkPresentRegionKHR>(swapchainCount);
         for (uint32_t i=0; i<swapchainCount; ++i) {
             pRegions[i].initialize(&src.pRegions[i]);
         }
@@ -11592,14 +13904,14 @@ safe_VkPresentRegionsKHR& safe_VkPresentRegionsKHR::operator=(const safe_VkPrese
     if (&src == this) return *this;
 
     if (pRegions)
-        delete[] pRegions;
+        vl_safe_delete_array(pRegions);
 
     sType = src.sType;
     pNext = src.pNext;
     swapchainCount = src.swapchainCount;
     pRegions = nullptr;
     if (swapchainCount && src.pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = vl_safe_new_array<safe_VkPresentRegionKHR>(swapchainCount);
         for (uint32_t i=0; i<swapchainCount; ++i) {
             pRegions[i].initialize(&src.pRegions[i]);
         }
@@ -11608,10 +13920,27 @@ safe_VkPresentRegionsKHR& safe_VkPresentRegionsKHR::operator=(const safe_VkPrese
     return *this;
 }
 
+safe_VkPresentRegionsKHR::safe_VkPresentRegionsKHR(safe_VkPresentRegionsKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentRegionsKHR));
+    new (&src) safe_VkPresentRegionsKHR();
+}
+
+safe_VkPresentRegionsKHR& safe_VkPresentRegionsKHR::operator=(safe_VkPresentRegionsKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPresentRegionsKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentRegionsKHR));
+    new (&src) safe_VkPresentRegionsKHR();
+
+    return *this;
+}
+
 safe_VkPresentRegionsKHR::~safe_VkPresentRegionsKHR()
 {
     if (pRegions)
-        delete[] pRegions;
+        vl_safe_delete_array(pRegions);
 }
 
 void safe_VkPresentRegionsKHR::initialize(const VkPresentRegionsKHR* in_struct)
@@ -11621,7 +13950,7 @@ void safe_VkPresentRegionsKHR::initialize(const VkPresentRegionsKHR* in_struct)
     swapchainCount = in_struct->swapchainCount;
     pRegions = nullptr;
     if (swapchainCount && in_struct->pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = vl_safe_new_array<safe_VkPresentRegionKHR>(swapchainCount);
         for (uint32_t i=0; i<swapchainCount; ++i) {
             pRegions[i].initialize(&in_struct->pRegions[i]);
         }
@@ -11635,7 +13964,7 @@ void safe_VkPresentRegionsKHR::initialize(const safe_VkPresentRegionsKHR* src)
     swapchainCount = src->swapchainCount;
     pRegions = nullptr;
     if (swapchainCount && src->pRegions) {
-        pRegions = new safe_VkPresentRegionKHR[swapchainCount];
+        pRegions = vl_safe_new_array<safe_VkPresentRegionKHR>(swapchainCount);
         for (uint32_t i=0; i<swapchainCount; ++i) {
             pRegions[i].initialize(&src->pRegions[i]);
         }
@@ -11671,6 +14000,23 @@ safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR& safe_VkPhysicalDeviceImage
     return *this;
 }
 
+safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR::safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR(safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR();
+}
+
+safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR& safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR::operator=(safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR::~safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR()
 {
 }
@@ -11701,7 +14047,7 @@ safe_VkFramebufferAttachmentImageInfoKHR::safe_VkFramebufferAttachmentImageInfoK
     pViewFormats(nullptr)
 {
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(in_struct->viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -11722,7 +14068,7 @@ safe_VkFramebufferAttachmentImageInfoKHR::safe_VkFramebufferAttachmentImageInfoK
     viewFormatCount = src.viewFormatCount;
     pViewFormats = nullptr;
     if (src.pViewFormats) {
-        pViewFormats = new VkFormat[src.viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(src.viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)src.pViewFormats, sizeof(VkFormat)*src.viewFormatCount);
     }
 }
@@ -11732,7 +14078,7 @@ safe_VkFramebufferAttachmentImageInfoKHR& safe_VkFramebufferAttachmentImageInfoK
     if (&src == this) return *this;
 
     if (pViewFormats)
-        delete[] pViewFormats;
+        vl_safe_delete_array(pViewFormats);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -11744,17 +14090,34 @@ safe_VkFramebufferAttachmentImageInfoKHR& safe_VkFramebufferAttachmentImageInfoK
     viewFormatCount = src.viewFormatCount;
     pViewFormats = nullptr;
     if (src.pViewFormats) {
-        pViewFormats = new VkFormat[src.viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(src.viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)src.pViewFormats, sizeof(VkFormat)*src.viewFormatCount);
     }
 
     return *this;
 }
 
+safe_VkFramebufferAttachmentImageInfoKHR::safe_VkFramebufferAttachmentImageInfoKHR(safe_VkFramebufferAttachmentImageInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferAttachmentImageInfoKHR));
+    new (&src) safe_VkFramebufferAttachmentImageInfoKHR();
+}
+
+safe_VkFramebufferAttachmentImageInfoKHR& safe_VkFramebufferAttachmentImageInfoKHR::operator=(safe_VkFramebufferAttachmentImageInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFramebufferAttachmentImageInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferAttachmentImageInfoKHR));
+    new (&src) safe_VkFramebufferAttachmentImageInfoKHR();
+
+    return *this;
+}
+
 safe_VkFramebufferAttachmentImageInfoKHR::~safe_VkFramebufferAttachmentImageInfoKHR()
 {
     if (pViewFormats)
-        delete[] pViewFormats;
+        vl_safe_delete_array(pViewFormats);
 }
 
 void safe_VkFramebufferAttachmentImageInfoKHR::initialize(const VkFramebufferAttachmentImageInfoKHR* in_struct)
@@ -11769,7 +14132,7 @@ void safe_VkFramebufferAttachmentImageInfoKHR::initialize(const VkFramebufferAtt
     viewFormatCount = in_struct->viewFormatCount;
     pViewFormats = nullptr;
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(in_struct->viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -11786,7 +14149,7 @@ void safe_VkFramebufferAttachmentImageInfoKHR::initialize(const safe_VkFramebuff
     viewFormatCount = src->viewFormatCount;
     pViewFormats = nullptr;
     if (src->pViewFormats) {
-        pViewFormats = new VkFormat[src->viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(src->viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)src->pViewFormats, sizeof(VkFormat)*src->viewFormatCount);
     }
 }
@@ -11798,7 +14161,7 @@ safe_VkFramebufferAttachmentsCreateInfoKHR::safe_VkFramebufferAttachmentsCreateI
     pAttachmentImageInfos(nullptr)
 {
     if (attachmentImageInfoCount && in_struct->pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfoKHR[attachmentImageInfoCount];
+        pAttachmentImageInfos = vl_safe_new_array<safe_VkFramebufferAttachmentImageInfoKHR>(attachmentImageInfoCount);
         for (uint32_t i=0; i<attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&in_struct->pAttachmentImageInfos[i]);
         }
@@ -11816,7 +14179,7 @@ safe_VkFramebufferAttachmentsCreateInfoKHR::safe_VkFramebufferAttachmentsCreateI
     attachmentImageInfoCount = src.attachmentImageInfoCount;
     pAttachmentImageInfos = nullptr;
     if (attachmentImageInfoCount && src.pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfoKHR[attachmentImageInfoCount];
+        pAttachmentImageInfos = vl_safe_new_array<safe_VkFramebufferAttachmentImageInfoKHR>(attachmentImageInfoCount);
         for (uint32_t i=0; i<attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&src.pAttachmentImageInfos[i]);
         }
@@ -11828,14 +14191,14 @@ safe_VkFramebufferAttachmentsCreateInfoKHR& safe_VkFramebufferAttachmentsCreateI
     if (&src == this) return *this;
 
     if (pAttachmentImageInfos)
-        delete[] pAttachmentImageInfos;
+        vl_safe_delete_array(pAttachmentImageInfos);
 
     sType = src.sType;
     pNext = src.pNext;
     attachmentImageInfoCount = src.attachmentImageInfoCount;
     pAttachmentImageInfos = nullptr;
     if (attachmentImageInfoCount && src.pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfoKHR[attachmentImageInfoCount];
+        pAttachmentImageInfos = vl_safe_new_array<safe_VkFramebufferAttachmentImageInfoKHR>(attachmentImageInfoCount);
         for (uint32_t i=0; i<attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&src.pAttachmentImageInfos[i]);
         }
@@ -11844,10 +14207,27 @@ safe_VkFramebufferAttachmentsCreateInfoKHR& safe_VkFramebufferAttachmentsCreateI
     return *this;
 }
 
+safe_VkFramebufferAttachmentsCreateInfoKHR::safe_VkFramebufferAttachmentsCreateInfoKHR(safe_VkFramebufferAttachmentsCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferAttachmentsCreateInfoKHR));
+    new (&src) safe_VkFramebufferAttachmentsCreateInfoKHR();
+}
+
+safe_VkFramebufferAttachmentsCreateInfoKHR& safe_VkFramebufferAttachmentsCreateInfoKHR::operator=(safe_VkFramebufferAttachmentsCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFramebufferAttachmentsCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferAttachmentsCreateInfoKHR));
+    new (&src) safe_VkFramebufferAttachmentsCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkFramebufferAttachmentsCreateInfoKHR::~safe_VkFramebufferAttachmentsCreateInfoKHR()
 {
     if (pAttachmentImageInfos)
-        delete[] pAttachmentImageInfos;
+        vl_safe_delete_array(pAttachmentImageInfos);
 }
 
 void safe_VkFramebufferAttachmentsCreateInfoKHR::initialize(const VkFramebufferAttachmentsCreateInfoKHR* in_struct)
@@ -11857,7 +14237,7 @@ void safe_VkFramebufferAttachmentsCreateInfoKHR::initialize(const VkFramebufferA
     attachmentImageInfoCount = in_struct->attachmentImageInfoCount;
     pAttachmentImageInfos = nullptr;
     if (attachmentImageInfoCount && in_struct->pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfoKHR[attachmentImageInfoCount];
+        pAttachmentImageInfos = vl_safe_new_array<safe_VkFramebufferAttachmentImageInfoKHR>(attachmentImageInfoCount);
         for (uint32_t i=0; i<attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&in_struct->pAttachmentImageInfos[i]);
         }
@@ -11871,7 +14251,7 @@ void safe_VkFramebufferAttachmentsCreateInfoKHR::initialize(const safe_VkFramebu
     attachmentImageInfoCount = src->attachmentImageInfoCount;
     pAttachmentImageInfos = nullptr;
     if (attachmentImageInfoCount && src->pAttachmentImageInfos) {
-        pAttachmentImageInfos = new safe_VkFramebufferAttachmentImageInfoKHR[attachmentImageInfoCount];
+        pAttachmentImageInfos = vl_safe_new_array<safe_VkFramebufferAttachmentImageInfoKHR>(attachmentImageInfoCount);
         for (uint32_t i=0; i<attachmentImageInfoCount; ++i) {
             pAttachmentImageInfos[i].initialize(&src->pAttachmentImageInfos[i]);
         }
@@ -11885,10 +14265,8 @@ safe_VkRenderPassAttachmentBeginInfoKHR::safe_VkRenderPassAttachmentBeginInfoKHR
     pAttachments(nullptr)
 {
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = in_struct->pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -11903,10 +14281,8 @@ safe_VkRenderPassAttachmentBeginInfoKHR::safe_VkRenderPassAttachmentBeginInfoKHR
     attachmentCount = src.attachmentCount;
     pAttachments = nullptr;
     if (attachmentCount && src.pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = src.pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -11915,26 +14291,41 @@ safe_VkRenderPassAttachmentBeginInfoKHR& safe_VkRenderPassAttachmentBeginInfoKHR
     if (&src == this) return *this;
 
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
 
     sType = src.sType;
     pNext = src.pNext;
     attachmentCount = src.attachmentCount;
     pAttachments = nullptr;
     if (attachmentCount && src.pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = src.pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)src.pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassAttachmentBeginInfoKHR::safe_VkRenderPassAttachmentBeginInfoKHR(safe_VkRenderPassAttachmentBeginInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassAttachmentBeginInfoKHR));
+    new (&src) safe_VkRenderPassAttachmentBeginInfoKHR();
+}
+
+safe_VkRenderPassAttachmentBeginInfoKHR& safe_VkRenderPassAttachmentBeginInfoKHR::operator=(safe_VkRenderPassAttachmentBeginInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassAttachmentBeginInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassAttachmentBeginInfoKHR));
+    new (&src) safe_VkRenderPassAttachmentBeginInfoKHR();
+
+    return *this;
+}
+
 safe_VkRenderPassAttachmentBeginInfoKHR::~safe_VkRenderPassAttachmentBeginInfoKHR()
 {
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
 }
 
 void safe_VkRenderPassAttachmentBeginInfoKHR::initialize(const VkRenderPassAttachmentBeginInfoKHR* in_struct)
@@ -11944,10 +14335,8 @@ void safe_VkRenderPassAttachmentBeginInfoKHR::initialize(const VkRenderPassAttac
     attachmentCount = in_struct->attachmentCount;
     pAttachments = nullptr;
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = in_struct->pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)in_struct->pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -11958,10 +14347,8 @@ void safe_VkRenderPassAttachmentBeginInfoKHR::initialize(const safe_VkRenderPass
     attachmentCount = src->attachmentCount;
     pAttachments = nullptr;
     if (attachmentCount && src->pAttachments) {
-        pAttachments = new VkImageView[attachmentCount];
-        for (uint32_t i=0; i<attachmentCount; ++i) {
-            pAttachments[i] = src->pAttachments[i];
-        }
+        pAttachments = vl_safe_new_array<VkImageView>(attachmentCount);
+        memcpy ((void *)pAttachments, (void *)src->pAttachments, sizeof(VkImageView)*attachmentCount);
     }
 }
 
@@ -12018,6 +14405,23 @@ safe_VkAttachmentDescription2KHR& safe_VkAttachmentDescription2KHR::operator=(co
     return *this;
 }
 
+safe_VkAttachmentDescription2KHR::safe_VkAttachmentDescription2KHR(safe_VkAttachmentDescription2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAttachmentDescription2KHR));
+    new (&src) safe_VkAttachmentDescription2KHR();
+}
+
+safe_VkAttachmentDescription2KHR& safe_VkAttachmentDescription2KHR::operator=(safe_VkAttachmentDescription2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAttachmentDescription2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAttachmentDescription2KHR));
+    new (&src) safe_VkAttachmentDescription2KHR();
+
+    return *this;
+}
+
 safe_VkAttachmentDescription2KHR::~safe_VkAttachmentDescription2KHR()
 {
 }
@@ -12087,6 +14491,23 @@ safe_VkAttachmentReference2KHR& safe_VkAttachmentReference2KHR::operator=(const
     return *this;
 }
 
+safe_VkAttachmentReference2KHR::safe_VkAttachmentReference2KHR(safe_VkAttachmentReference2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAttachmentReference2KHR));
+    new (&src) safe_VkAttachmentReference2KHR();
+}
+
+safe_VkAttachmentReference2KHR& safe_VkAttachmentReference2KHR::operator=(safe_VkAttachmentReference2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAttachmentReference2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAttachmentReference2KHR));
+    new (&src) safe_VkAttachmentReference2KHR();
+
+    return *this;
+}
+
 safe_VkAttachmentReference2KHR::~safe_VkAttachmentReference2KHR()
 {
 }
@@ -12124,29 +14545,29 @@ safe_VkSubpassDescription2KHR::safe_VkSubpassDescription2KHR(const VkSubpassDesc
     pPreserveAttachments(nullptr)
 {
     if (inputAttachmentCount && in_struct->pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2KHR[inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(inputAttachmentCount);
         for (uint32_t i=0; i<inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&in_struct->pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&in_struct->pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&in_struct->pResolveAttachments[i]);
         }
     }
     if (in_struct->pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2KHR(in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(in_struct->pDepthStencilAttachment);
     else
         pDepthStencilAttachment = NULL;
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(in_struct->preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -12173,29 +14594,29 @@ safe_VkSubpassDescription2KHR::safe_VkSubpassDescription2KHR(const safe_VkSubpas
     preserveAttachmentCount = src.preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (inputAttachmentCount && src.pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2KHR[inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(inputAttachmentCount);
         for (uint32_t i=0; i<inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&src.pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && src.pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&src.pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && src.pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&src.pResolveAttachments[i]);
         }
     }
     if (src.pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2KHR(*src.pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(*src.pDepthStencilAttachment);
     else
         pDepthStencilAttachment = NULL;
     if (src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[src.preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(src.preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)src.pPreserveAttachments, sizeof(uint32_t)*src.preserveAttachmentCount);
     }
 }
@@ -12205,15 +14626,15 @@ safe_VkSubpassDescription2KHR& safe_VkSubpassDescription2KHR::operator=(const sa
     if (&src == this) return *this;
 
     if (pInputAttachments)
-        delete[] pInputAttachments;
+        vl_safe_delete_array(pInputAttachments);
     if (pColorAttachments)
-        delete[] pColorAttachments;
+        vl_safe_delete_array(pColorAttachments);
     if (pResolveAttachments)
-        delete[] pResolveAttachments;
+        vl_safe_delete_array(pResolveAttachments);
     if (pDepthStencilAttachment)
-        delete pDepthStencilAttachment;
+        vl_safe_delete(pDepthStencilAttachment);
     if (pPreserveAttachments)
-        delete[] pPreserveAttachments;
+        vl_safe_delete_array(pPreserveAttachments);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -12228,47 +14649,64 @@ safe_VkSubpassDescription2KHR& safe_VkSubpassDescription2KHR::operator=(const sa
     preserveAttachmentCount = src.preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (inputAttachmentCount && src.pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2KHR[inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(inputAttachmentCount);
         for (uint32_t i=0; i<inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&src.pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && src.pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&src.pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && src.pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&src.pResolveAttachments[i]);
         }
     }
     if (src.pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2KHR(*src.pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(*src.pDepthStencilAttachment);
     else
         pDepthStencilAttachment = NULL;
     if (src.pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[src.preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(src.preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)src.pPreserveAttachments, sizeof(uint32_t)*src.preserveAttachmentCount);
     }
 
     return *this;
 }
 
+safe_VkSubpassDescription2KHR::safe_VkSubpassDescription2KHR(safe_VkSubpassDescription2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDescription2KHR));
+    new (&src) safe_VkSubpassDescription2KHR();
+}
+
+safe_VkSubpassDescription2KHR& safe_VkSubpassDescription2KHR::operator=(safe_VkSubpassDescription2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubpassDescription2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDescription2KHR));
+    new (&src) safe_VkSubpassDescription2KHR();
+
+    return *this;
+}
+
 safe_VkSubpassDescription2KHR::~safe_VkSubpassDescription2KHR()
 {
     if (pInputAttachments)
-        delete[] pInputAttachments;
+        vl_safe_delete_array(pInputAttachments);
     if (pColorAttachments)
-        delete[] pColorAttachments;
+        vl_safe_delete_array(pColorAttachments);
     if (pResolveAttachments)
-        delete[] pResolveAttachments;
+        vl_safe_delete_array(pResolveAttachments);
     if (pDepthStencilAttachment)
-        delete pDepthStencilAttachment;
+        vl_safe_delete(pDepthStencilAttachment);
     if (pPreserveAttachments)
-        delete[] pPreserveAttachments;
+        vl_safe_delete_array(pPreserveAttachments);
 }
 
 void safe_VkSubpassDescription2KHR::initialize(const VkSubpassDescription2KHR* in_struct)
@@ -12286,29 +14724,29 @@ void safe_VkSubpassDescription2KHR::initialize(const VkSubpassDescription2KHR* i
     preserveAttachmentCount = in_struct->preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (inputAttachmentCount && in_struct->pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2KHR[inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(inputAttachmentCount);
         for (uint32_t i=0; i<inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&in_struct->pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&in_struct->pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && in_struct->pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&in_struct->pResolveAttachments[i]);
         }
     }
     if (in_struct->pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2KHR(in_struct->pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(in_struct->pDepthStencilAttachment);
     else
         pDepthStencilAttachment = NULL;
     if (in_struct->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[in_struct->preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(in_struct->preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)in_struct->pPreserveAttachments, sizeof(uint32_t)*in_struct->preserveAttachmentCount);
     }
 }
@@ -12328,29 +14766,29 @@ void safe_VkSubpassDescription2KHR::initialize(const safe_VkSubpassDescription2K
     preserveAttachmentCount = src->preserveAttachmentCount;
     pPreserveAttachments = nullptr;
     if (inputAttachmentCount && src->pInputAttachments) {
-        pInputAttachments = new safe_VkAttachmentReference2KHR[inputAttachmentCount];
+        pInputAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(inputAttachmentCount);
         for (uint32_t i=0; i<inputAttachmentCount; ++i) {
             pInputAttachments[i].initialize(&src->pInputAttachments[i]);
         }
     }
     if (colorAttachmentCount && src->pColorAttachments) {
-        pColorAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pColorAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pColorAttachments[i].initialize(&src->pColorAttachments[i]);
         }
     }
     if (colorAttachmentCount && src->pResolveAttachments) {
-        pResolveAttachments = new safe_VkAttachmentReference2KHR[colorAttachmentCount];
+        pResolveAttachments = vl_safe_new_array<safe_VkAttachmentReference2KHR>(colorAttachmentCount);
         for (uint32_t i=0; i<colorAttachmentCount; ++i) {
             pResolveAttachments[i].initialize(&src->pResolveAttachments[i]);
         }
     }
     if (src->pDepthStencilAttachment)
-        pDepthStencilAttachment = new safe_VkAttachmentReference2KHR(*src->pDepthStencilAttachment);
+        pDepthStencilAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(*src->pDepthStencilAttachment);
     else
         pDepthStencilAttachment = NULL;
     if (src->pPreserveAttachments) {
-        pPreserveAttachments = new uint32_t[src->preserveAttachmentCount];
+        pPreserveAttachments = vl_safe_new_array<uint32_t>(src->preserveAttachmentCount);
         memcpy ((void *)pPreserveAttachments, (void *)src->pPreserveAttachments, sizeof(uint32_t)*src->preserveAttachmentCount);
     }
 }
@@ -12405,6 +14843,23 @@ safe_VkSubpassDependency2KHR& safe_VkSubpassDependency2KHR::operator=(const safe
     return *this;
 }
 
+safe_VkSubpassDependency2KHR::safe_VkSubpassDependency2KHR(safe_VkSubpassDependency2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDependency2KHR));
+    new (&src) safe_VkSubpassDependency2KHR();
+}
+
+safe_VkSubpassDependency2KHR& safe_VkSubpassDependency2KHR::operator=(safe_VkSubpassDependency2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubpassDependency2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDependency2KHR));
+    new (&src) safe_VkSubpassDependency2KHR();
+
+    return *this;
+}
+
 safe_VkSubpassDependency2KHR::~safe_VkSubpassDependency2KHR()
 {
 }
@@ -12451,25 +14906,25 @@ safe_VkRenderPassCreateInfo2KHR::safe_VkRenderPassCreateInfo2KHR(const VkRenderP
     pCorrelatedViewMasks(nullptr)
 {
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2KHR[attachmentCount];
+        pAttachments = vl_safe_new_array<safe_VkAttachmentDescription2KHR>(attachmentCount);
         for (uint32_t i=0; i<attachmentCount; ++i) {
             pAttachments[i].initialize(&in_struct->pAttachments[i]);
         }
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2KHR[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription2KHR>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (dependencyCount && in_struct->pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2KHR[dependencyCount];
+        pDependencies = vl_safe_new_array<safe_VkSubpassDependency2KHR>(dependencyCount);
         for (uint32_t i=0; i<dependencyCount; ++i) {
             pDependencies[i].initialize(&in_struct->pDependencies[i]);
         }
     }
     if (in_struct->pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[in_struct->correlatedViewMaskCount];
+        pCorrelatedViewMasks = vl_safe_new_array<uint32_t>(in_struct->correlatedViewMaskCount);
         memcpy ((void *)pCorrelatedViewMasks, (void *)in_struct->pCorrelatedViewMasks, sizeof(uint32_t)*in_struct->correlatedViewMaskCount);
     }
 }
@@ -12495,25 +14950,25 @@ safe_VkRenderPassCreateInfo2KHR::safe_VkRenderPassCreateInfo2KHR(const safe_VkRe
     correlatedViewMaskCount = src.correlatedViewMaskCount;
     pCorrelatedViewMasks = nullptr;
     if (attachmentCount && src.pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2KHR[attachmentCount];
+        pAttachments = vl_safe_new_array<safe_VkAttachmentDescription2KHR>(attachmentCount);
         for (uint32_t i=0; i<attachmentCount; ++i) {
             pAttachments[i].initialize(&src.pAttachments[i]);
         }
     }
     if (subpassCount && src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2KHR[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription2KHR>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&src.pSubpasses[i]);
         }
     }
     if (dependencyCount && src.pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2KHR[dependencyCount];
+        pDependencies = vl_safe_new_array<safe_VkSubpassDependency2KHR>(dependencyCount);
         for (uint32_t i=0; i<dependencyCount; ++i) {
             pDependencies[i].initialize(&src.pDependencies[i]);
         }
     }
     if (src.pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[src.correlatedViewMaskCount];
+        pCorrelatedViewMasks = vl_safe_new_array<uint32_t>(src.correlatedViewMaskCount);
         memcpy ((void *)pCorrelatedViewMasks, (void *)src.pCorrelatedViewMasks, sizeof(uint32_t)*src.correlatedViewMaskCount);
     }
 }
@@ -12523,13 +14978,13 @@ safe_VkRenderPassCreateInfo2KHR& safe_VkRenderPassCreateInfo2KHR::operator=(cons
     if (&src == this) return *this;
 
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
     if (pSubpasses)
-        delete[] pSubpasses;
+        vl_safe_delete_array(pSubpasses);
     if (pDependencies)
-        delete[] pDependencies;
+        vl_safe_delete_array(pDependencies);
     if (pCorrelatedViewMasks)
-        delete[] pCorrelatedViewMasks;
+        vl_safe_delete_array(pCorrelatedViewMasks);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -12543,41 +14998,58 @@ safe_VkRenderPassCreateInfo2KHR& safe_VkRenderPassCreateInfo2KHR::operator=(cons
     correlatedViewMaskCount = src.correlatedViewMaskCount;
     pCorrelatedViewMasks = nullptr;
     if (attachmentCount && src.pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2KHR[attachmentCount];
+        pAttachments = vl_safe_new_array<safe_VkAttachmentDescription2KHR>(attachmentCount);
         for (uint32_t i=0; i<attachmentCount; ++i) {
             pAttachments[i].initialize(&src.pAttachments[i]);
         }
     }
     if (subpassCount && src.pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2KHR[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription2KHR>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&src.pSubpasses[i]);
         }
     }
     if (dependencyCount && src.pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2KHR[dependencyCount];
+        pDependencies = vl_safe_new_array<safe_VkSubpassDependency2KHR>(dependencyCount);
         for (uint32_t i=0; i<dependencyCount; ++i) {
             pDependencies[i].initialize(&src.pDependencies[i]);
         }
     }
     if (src.pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[src.correlatedViewMaskCount];
+        pCorrelatedViewMasks = vl_safe_new_array<uint32_t>(src.correlatedViewMaskCount);
         memcpy ((void *)pCorrelatedViewMasks, (void *)src.pCorrelatedViewMasks, sizeof(uint32_t)*src.correlatedViewMaskCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassCreateInfo2KHR::safe_VkRenderPassCreateInfo2KHR(safe_VkRenderPassCreateInfo2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassCreateInfo2KHR));
+    new (&src) safe_VkRenderPassCreateInfo2KHR();
+}
+
+safe_VkRenderPassCreateInfo2KHR& safe_VkRenderPassCreateInfo2KHR::operator=(safe_VkRenderPassCreateInfo2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassCreateInfo2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassCreateInfo2KHR));
+    new (&src) safe_VkRenderPassCreateInfo2KHR();
+
+    return *this;
+}
+
 safe_VkRenderPassCreateInfo2KHR::~safe_VkRenderPassCreateInfo2KHR()
 {
     if (pAttachments)
-        delete[] pAttachments;
+        vl_safe_delete_array(pAttachments);
     if (pSubpasses)
-        delete[] pSubpasses;
+        vl_safe_delete_array(pSubpasses);
     if (pDependencies)
-        delete[] pDependencies;
+        vl_safe_delete_array(pDependencies);
     if (pCorrelatedViewMasks)
-        delete[] pCorrelatedViewMasks;
+        vl_safe_delete_array(pCorrelatedViewMasks);
 }
 
 void safe_VkRenderPassCreateInfo2KHR::initialize(const VkRenderPassCreateInfo2KHR* in_struct)
@@ -12594,25 +15066,25 @@ void safe_VkRenderPassCreateInfo2KHR::initialize(const VkRenderPassCreateInfo2KH
     correlatedViewMaskCount = in_struct->correlatedViewMaskCount;
     pCorrelatedViewMasks = nullptr;
     if (attachmentCount && in_struct->pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2KHR[attachmentCount];
+        pAttachments = vl_safe_new_array<safe_VkAttachmentDescription2KHR>(attachmentCount);
         for (uint32_t i=0; i<attachmentCount; ++i) {
             pAttachments[i].initialize(&in_struct->pAttachments[i]);
         }
     }
     if (subpassCount && in_struct->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2KHR[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription2KHR>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&in_struct->pSubpasses[i]);
         }
     }
     if (dependencyCount && in_struct->pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2KHR[dependencyCount];
+        pDependencies = vl_safe_new_array<safe_VkSubpassDependency2KHR>(dependencyCount);
         for (uint32_t i=0; i<dependencyCount; ++i) {
             pDependencies[i].initialize(&in_struct->pDependencies[i]);
         }
     }
     if (in_struct->pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[in_struct->correlatedViewMaskCount];
+        pCorrelatedViewMasks = vl_safe_new_array<uint32_t>(in_struct->correlatedViewMaskCount);
         memcpy ((void *)pCorrelatedViewMasks, (void *)in_struct->pCorrelatedViewMasks, sizeof(uint32_t)*in_struct->correlatedViewMaskCount);
     }
 }
@@ -12631,25 +15103,25 @@ void safe_VkRenderPassCreateInfo2KHR::initialize(const safe_VkRenderPassCreateIn
     correlatedViewMaskCount = src->correlatedViewMaskCount;
     pCorrelatedViewMasks = nullptr;
     if (attachmentCount && src->pAttachments) {
-        pAttachments = new safe_VkAttachmentDescription2KHR[attachmentCount];
+        pAttachments = vl_safe_new_array<safe_VkAttachmentDescription2KHR>(attachmentCount);
         for (uint32_t i=0; i<attachmentCount; ++i) {
             pAttachments[i].initialize(&src->pAttachments[i]);
         }
     }
     if (subpassCount && src->pSubpasses) {
-        pSubpasses = new safe_VkSubpassDescription2KHR[subpassCount];
+        pSubpasses = vl_safe_new_array<safe_VkSubpassDescription2KHR>(subpassCount);
         for (uint32_t i=0; i<subpassCount; ++i) {
             pSubpasses[i].initialize(&src->pSubpasses[i]);
         }
     }
     if (dependencyCount && src->pDependencies) {
-        pDependencies = new safe_VkSubpassDependency2KHR[dependencyCount];
+        pDependencies = vl_safe_new_array<safe_VkSubpassDependency2KHR>(dependencyCount);
         for (uint32_t i=0; i<dependencyCount; ++i) {
             pDependencies[i].initialize(&src->pDependencies[i]);
         }
     }
     if (src->pCorrelatedViewMasks) {
-        pCorrelatedViewMasks = new uint32_t[src->correlatedViewMaskCount];
+        pCorrelatedViewMasks = vl_safe_new_array<uint32_t>(src->correlatedViewMaskCount);
         memcpy ((void *)pCorrelatedViewMasks, (void *)src->pCorrelatedViewMasks, sizeof(uint32_t)*src->correlatedViewMaskCount);
     }
 }
@@ -12683,6 +15155,23 @@ safe_VkSubpassBeginInfoKHR& safe_VkSubpassBeginInfoKHR::operator=(const safe_VkS
     return *this;
 }
 
+safe_VkSubpassBeginInfoKHR::safe_VkSubpassBeginInfoKHR(safe_VkSubpassBeginInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassBeginInfoKHR));
+    new (&src) safe_VkSubpassBeginInfoKHR();
+}
+
+safe_VkSubpassBeginInfoKHR& safe_VkSubpassBeginInfoKHR::operator=(safe_VkSubpassBeginInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubpassBeginInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassBeginInfoKHR));
+    new (&src) safe_VkSubpassBeginInfoKHR();
+
+    return *this;
+}
+
 safe_VkSubpassBeginInfoKHR::~safe_VkSubpassBeginInfoKHR()
 {
 }
@@ -12727,6 +15216,23 @@ safe_VkSubpassEndInfoKHR& safe_VkSubpassEndInfoKHR::operator=(const safe_VkSubpa
     return *this;
 }
 
+safe_VkSubpassEndInfoKHR::safe_VkSubpassEndInfoKHR(safe_VkSubpassEndInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassEndInfoKHR));
+    new (&src) safe_VkSubpassEndInfoKHR();
+}
+
+safe_VkSubpassEndInfoKHR& safe_VkSubpassEndInfoKHR::operator=(safe_VkSubpassEndInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubpassEndInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassEndInfoKHR));
+    new (&src) safe_VkSubpassEndInfoKHR();
+
+    return *this;
+}
+
 safe_VkSubpassEndInfoKHR::~safe_VkSubpassEndInfoKHR()
 {
 }
@@ -12772,6 +15278,23 @@ safe_VkSharedPresentSurfaceCapabilitiesKHR& safe_VkSharedPresentSurfaceCapabilit
     return *this;
 }
 
+safe_VkSharedPresentSurfaceCapabilitiesKHR::safe_VkSharedPresentSurfaceCapabilitiesKHR(safe_VkSharedPresentSurfaceCapabilitiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSharedPresentSurfaceCapabilitiesKHR));
+    new (&src) safe_VkSharedPresentSurfaceCapabilitiesKHR();
+}
+
+safe_VkSharedPresentSurfaceCapabilitiesKHR& safe_VkSharedPresentSurfaceCapabilitiesKHR::operator=(safe_VkSharedPresentSurfaceCapabilitiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSharedPresentSurfaceCapabilitiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSharedPresentSurfaceCapabilitiesKHR));
+    new (&src) safe_VkSharedPresentSurfaceCapabilitiesKHR();
+
+    return *this;
+}
+
 safe_VkSharedPresentSurfaceCapabilitiesKHR::~safe_VkSharedPresentSurfaceCapabilitiesKHR()
 {
 }
@@ -12833,6 +15356,23 @@ safe_VkImportFenceWin32HandleInfoKHR& safe_VkImportFenceWin32HandleInfoKHR::oper
     return *this;
 }
 
+safe_VkImportFenceWin32HandleInfoKHR::safe_VkImportFenceWin32HandleInfoKHR(safe_VkImportFenceWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportFenceWin32HandleInfoKHR));
+    new (&src) safe_VkImportFenceWin32HandleInfoKHR();
+}
+
+safe_VkImportFenceWin32HandleInfoKHR& safe_VkImportFenceWin32HandleInfoKHR::operator=(safe_VkImportFenceWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportFenceWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportFenceWin32HandleInfoKHR));
+    new (&src) safe_VkImportFenceWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkImportFenceWin32HandleInfoKHR::~safe_VkImportFenceWin32HandleInfoKHR()
 {
 }
@@ -12871,7 +15411,7 @@ safe_VkExportFenceWin32HandleInfoKHR::safe_VkExportFenceWin32HandleInfoKHR(const
     name(in_struct->name)
 {
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -12887,7 +15427,7 @@ safe_VkExportFenceWin32HandleInfoKHR::safe_VkExportFenceWin32HandleInfoKHR(const
     dwAccess = src.dwAccess;
     name = src.name;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 }
 
@@ -12896,7 +15436,7 @@ safe_VkExportFenceWin32HandleInfoKHR& safe_VkExportFenceWin32HandleInfoKHR::oper
     if (&src == this) return *this;
 
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -12904,16 +15444,33 @@ safe_VkExportFenceWin32HandleInfoKHR& safe_VkExportFenceWin32HandleInfoKHR::oper
     dwAccess = src.dwAccess;
     name = src.name;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 
     return *this;
 }
 
+safe_VkExportFenceWin32HandleInfoKHR::safe_VkExportFenceWin32HandleInfoKHR(safe_VkExportFenceWin32HandleInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportFenceWin32HandleInfoKHR));
+    new (&src) safe_VkExportFenceWin32HandleInfoKHR();
+}
+
+safe_VkExportFenceWin32HandleInfoKHR& safe_VkExportFenceWin32HandleInfoKHR::operator=(safe_VkExportFenceWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportFenceWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportFenceWin32HandleInfoKHR));
+    new (&src) safe_VkExportFenceWin32HandleInfoKHR();
+
+    return *this;
+}
+
 safe_VkExportFenceWin32HandleInfoKHR::~safe_VkExportFenceWin32HandleInfoKHR()
 {
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 }
 
 void safe_VkExportFenceWin32HandleInfoKHR::initialize(const VkExportFenceWin32HandleInfoKHR* in_struct)
@@ -12924,7 +15481,7 @@ void safe_VkExportFenceWin32HandleInfoKHR::initialize(const VkExportFenceWin32Ha
     dwAccess = in_struct->dwAccess;
     name = in_struct->name;
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -12936,7 +15493,7 @@ void safe_VkExportFenceWin32HandleInfoKHR::initialize(const safe_VkExportFenceWi
     dwAccess = src->dwAccess;
     name = src->name;
     if (src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -12963,15 +15520,32 @@ safe_VkFenceGetWin32HandleInfoKHR::safe_VkFenceGetWin32HandleInfoKHR(const safe_
     handleType = src.handleType;
 }
 
-safe_VkFenceGetWin32HandleInfoKHR& safe_VkFenceGetWin32HandleInfoKHR::operator=(const safe_VkFenceGetWin32HandleInfoKHR& src)
+safe_VkFenceGetWin32HandleInfoKHR& safe_VkFenceGetWin32HandleInfoKHR::operator=(const safe_VkFenceGetWin32HandleInfoKHR& src)
+{
+    if (&src == this) return *this;
+
+
+    sType = src.sType;
+    pNext = src.pNext;
+    fence = src.fence;
+    handleType = src.handleType;
+
+    return *this;
+}
+
+safe_VkFenceGetWin32HandleInfoKHR::safe_VkFenceGetWin32HandleInfoKHR(safe_VkFenceGetWin32HandleInfoKHR&& src) noexcept
 {
-    if (&src == this) return *this;
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFenceGetWin32HandleInfoKHR));
+    new (&src) safe_VkFenceGetWin32HandleInfoKHR();
+}
 
+safe_VkFenceGetWin32HandleInfoKHR& safe_VkFenceGetWin32HandleInfoKHR::operator=(safe_VkFenceGetWin32HandleInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
 
-    sType = src.sType;
-    pNext = src.pNext;
-    fence = src.fence;
-    handleType = src.handleType;
+    this->~safe_VkFenceGetWin32HandleInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFenceGetWin32HandleInfoKHR));
+    new (&src) safe_VkFenceGetWin32HandleInfoKHR();
 
     return *this;
 }
@@ -13036,6 +15610,23 @@ safe_VkImportFenceFdInfoKHR& safe_VkImportFenceFdInfoKHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkImportFenceFdInfoKHR::safe_VkImportFenceFdInfoKHR(safe_VkImportFenceFdInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportFenceFdInfoKHR));
+    new (&src) safe_VkImportFenceFdInfoKHR();
+}
+
+safe_VkImportFenceFdInfoKHR& safe_VkImportFenceFdInfoKHR::operator=(safe_VkImportFenceFdInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportFenceFdInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportFenceFdInfoKHR));
+    new (&src) safe_VkImportFenceFdInfoKHR();
+
+    return *this;
+}
+
 safe_VkImportFenceFdInfoKHR::~safe_VkImportFenceFdInfoKHR()
 {
 }
@@ -13092,6 +15683,23 @@ safe_VkFenceGetFdInfoKHR& safe_VkFenceGetFdInfoKHR::operator=(const safe_VkFence
     return *this;
 }
 
+safe_VkFenceGetFdInfoKHR::safe_VkFenceGetFdInfoKHR(safe_VkFenceGetFdInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFenceGetFdInfoKHR));
+    new (&src) safe_VkFenceGetFdInfoKHR();
+}
+
+safe_VkFenceGetFdInfoKHR& safe_VkFenceGetFdInfoKHR::operator=(safe_VkFenceGetFdInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFenceGetFdInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFenceGetFdInfoKHR));
+    new (&src) safe_VkFenceGetFdInfoKHR();
+
+    return *this;
+}
+
 safe_VkFenceGetFdInfoKHR::~safe_VkFenceGetFdInfoKHR()
 {
 }
@@ -13141,6 +15749,23 @@ safe_VkPhysicalDeviceSurfaceInfo2KHR& safe_VkPhysicalDeviceSurfaceInfo2KHR::oper
     return *this;
 }
 
+safe_VkPhysicalDeviceSurfaceInfo2KHR::safe_VkPhysicalDeviceSurfaceInfo2KHR(safe_VkPhysicalDeviceSurfaceInfo2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSurfaceInfo2KHR));
+    new (&src) safe_VkPhysicalDeviceSurfaceInfo2KHR();
+}
+
+safe_VkPhysicalDeviceSurfaceInfo2KHR& safe_VkPhysicalDeviceSurfaceInfo2KHR::operator=(safe_VkPhysicalDeviceSurfaceInfo2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceSurfaceInfo2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSurfaceInfo2KHR));
+    new (&src) safe_VkPhysicalDeviceSurfaceInfo2KHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSurfaceInfo2KHR::~safe_VkPhysicalDeviceSurfaceInfo2KHR()
 {
 }
@@ -13188,6 +15813,23 @@ safe_VkSurfaceCapabilities2KHR& safe_VkSurfaceCapabilities2KHR::operator=(const
     return *this;
 }
 
+safe_VkSurfaceCapabilities2KHR::safe_VkSurfaceCapabilities2KHR(safe_VkSurfaceCapabilities2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceCapabilities2KHR));
+    new (&src) safe_VkSurfaceCapabilities2KHR();
+}
+
+safe_VkSurfaceCapabilities2KHR& safe_VkSurfaceCapabilities2KHR::operator=(safe_VkSurfaceCapabilities2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceCapabilities2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceCapabilities2KHR));
+    new (&src) safe_VkSurfaceCapabilities2KHR();
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilities2KHR::~safe_VkSurfaceCapabilities2KHR()
 {
 }
@@ -13235,6 +15877,23 @@ safe_VkSurfaceFormat2KHR& safe_VkSurfaceFormat2KHR::operator=(const safe_VkSurfa
     return *this;
 }
 
+safe_VkSurfaceFormat2KHR::safe_VkSurfaceFormat2KHR(safe_VkSurfaceFormat2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceFormat2KHR));
+    new (&src) safe_VkSurfaceFormat2KHR();
+}
+
+safe_VkSurfaceFormat2KHR& safe_VkSurfaceFormat2KHR::operator=(safe_VkSurfaceFormat2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceFormat2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceFormat2KHR));
+    new (&src) safe_VkSurfaceFormat2KHR();
+
+    return *this;
+}
+
 safe_VkSurfaceFormat2KHR::~safe_VkSurfaceFormat2KHR()
 {
 }
@@ -13282,6 +15941,23 @@ safe_VkDisplayProperties2KHR& safe_VkDisplayProperties2KHR::operator=(const safe
     return *this;
 }
 
+safe_VkDisplayProperties2KHR::safe_VkDisplayProperties2KHR(safe_VkDisplayProperties2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayProperties2KHR));
+    new (&src) safe_VkDisplayProperties2KHR();
+}
+
+safe_VkDisplayProperties2KHR& safe_VkDisplayProperties2KHR::operator=(safe_VkDisplayProperties2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayProperties2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayProperties2KHR));
+    new (&src) safe_VkDisplayProperties2KHR();
+
+    return *this;
+}
+
 safe_VkDisplayProperties2KHR::~safe_VkDisplayProperties2KHR()
 {
 }
@@ -13329,6 +16005,23 @@ safe_VkDisplayPlaneProperties2KHR& safe_VkDisplayPlaneProperties2KHR::operator=(
     return *this;
 }
 
+safe_VkDisplayPlaneProperties2KHR::safe_VkDisplayPlaneProperties2KHR(safe_VkDisplayPlaneProperties2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPlaneProperties2KHR));
+    new (&src) safe_VkDisplayPlaneProperties2KHR();
+}
+
+safe_VkDisplayPlaneProperties2KHR& safe_VkDisplayPlaneProperties2KHR::operator=(safe_VkDisplayPlaneProperties2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayPlaneProperties2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPlaneProperties2KHR));
+    new (&src) safe_VkDisplayPlaneProperties2KHR();
+
+    return *this;
+}
+
 safe_VkDisplayPlaneProperties2KHR::~safe_VkDisplayPlaneProperties2KHR()
 {
 }
@@ -13376,6 +16069,23 @@ safe_VkDisplayModeProperties2KHR& safe_VkDisplayModeProperties2KHR::operator=(co
     return *this;
 }
 
+safe_VkDisplayModeProperties2KHR::safe_VkDisplayModeProperties2KHR(safe_VkDisplayModeProperties2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayModeProperties2KHR));
+    new (&src) safe_VkDisplayModeProperties2KHR();
+}
+
+safe_VkDisplayModeProperties2KHR& safe_VkDisplayModeProperties2KHR::operator=(safe_VkDisplayModeProperties2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayModeProperties2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayModeProperties2KHR));
+    new (&src) safe_VkDisplayModeProperties2KHR();
+
+    return *this;
+}
+
 safe_VkDisplayModeProperties2KHR::~safe_VkDisplayModeProperties2KHR()
 {
 }
@@ -13426,6 +16136,23 @@ safe_VkDisplayPlaneInfo2KHR& safe_VkDisplayPlaneInfo2KHR::operator=(const safe_V
     return *this;
 }
 
+safe_VkDisplayPlaneInfo2KHR::safe_VkDisplayPlaneInfo2KHR(safe_VkDisplayPlaneInfo2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPlaneInfo2KHR));
+    new (&src) safe_VkDisplayPlaneInfo2KHR();
+}
+
+safe_VkDisplayPlaneInfo2KHR& safe_VkDisplayPlaneInfo2KHR::operator=(safe_VkDisplayPlaneInfo2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayPlaneInfo2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPlaneInfo2KHR));
+    new (&src) safe_VkDisplayPlaneInfo2KHR();
+
+    return *this;
+}
+
 safe_VkDisplayPlaneInfo2KHR::~safe_VkDisplayPlaneInfo2KHR()
 {
 }
@@ -13475,6 +16202,23 @@ safe_VkDisplayPlaneCapabilities2KHR& safe_VkDisplayPlaneCapabilities2KHR::operat
     return *this;
 }
 
+safe_VkDisplayPlaneCapabilities2KHR::safe_VkDisplayPlaneCapabilities2KHR(safe_VkDisplayPlaneCapabilities2KHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPlaneCapabilities2KHR));
+    new (&src) safe_VkDisplayPlaneCapabilities2KHR();
+}
+
+safe_VkDisplayPlaneCapabilities2KHR& safe_VkDisplayPlaneCapabilities2KHR::operator=(safe_VkDisplayPlaneCapabilities2KHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayPlaneCapabilities2KHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPlaneCapabilities2KHR));
+    new (&src) safe_VkDisplayPlaneCapabilities2KHR();
+
+    return *this;
+}
+
 safe_VkDisplayPlaneCapabilities2KHR::~safe_VkDisplayPlaneCapabilities2KHR()
 {
 }
@@ -13500,7 +16244,7 @@ safe_VkImageFormatListCreateInfoKHR::safe_VkImageFormatListCreateInfoKHR(const V
     pViewFormats(nullptr)
 {
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(in_struct->viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -13516,7 +16260,7 @@ safe_VkImageFormatListCreateInfoKHR::safe_VkImageFormatListCreateInfoKHR(const s
     viewFormatCount = src.viewFormatCount;
     pViewFormats = nullptr;
     if (src.pViewFormats) {
-        pViewFormats = new VkFormat[src.viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(src.viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)src.pViewFormats, sizeof(VkFormat)*src.viewFormatCount);
     }
 }
@@ -13526,24 +16270,41 @@ safe_VkImageFormatListCreateInfoKHR& safe_VkImageFormatListCreateInfoKHR::operat
     if (&src == this) return *this;
 
     if (pViewFormats)
-        delete[] pViewFormats;
+        vl_safe_delete_array(pViewFormats);
 
     sType = src.sType;
     pNext = src.pNext;
     viewFormatCount = src.viewFormatCount;
     pViewFormats = nullptr;
     if (src.pViewFormats) {
-        pViewFormats = new VkFormat[src.viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(src.viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)src.pViewFormats, sizeof(VkFormat)*src.viewFormatCount);
     }
 
     return *this;
 }
 
+safe_VkImageFormatListCreateInfoKHR::safe_VkImageFormatListCreateInfoKHR(safe_VkImageFormatListCreateInfoKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageFormatListCreateInfoKHR));
+    new (&src) safe_VkImageFormatListCreateInfoKHR();
+}
+
+safe_VkImageFormatListCreateInfoKHR& safe_VkImageFormatListCreateInfoKHR::operator=(safe_VkImageFormatListCreateInfoKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageFormatListCreateInfoKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageFormatListCreateInfoKHR));
+    new (&src) safe_VkImageFormatListCreateInfoKHR();
+
+    return *this;
+}
+
 safe_VkImageFormatListCreateInfoKHR::~safe_VkImageFormatListCreateInfoKHR()
 {
     if (pViewFormats)
-        delete[] pViewFormats;
+        vl_safe_delete_array(pViewFormats);
 }
 
 void safe_VkImageFormatListCreateInfoKHR::initialize(const VkImageFormatListCreateInfoKHR* in_struct)
@@ -13553,7 +16314,7 @@ void safe_VkImageFormatListCreateInfoKHR::initialize(const VkImageFormatListCrea
     viewFormatCount = in_struct->viewFormatCount;
     pViewFormats = nullptr;
     if (in_struct->pViewFormats) {
-        pViewFormats = new VkFormat[in_struct->viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(in_struct->viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)in_struct->pViewFormats, sizeof(VkFormat)*in_struct->viewFormatCount);
     }
 }
@@ -13565,7 +16326,7 @@ void safe_VkImageFormatListCreateInfoKHR::initialize(const safe_VkImageFormatLis
     viewFormatCount = src->viewFormatCount;
     pViewFormats = nullptr;
     if (src->pViewFormats) {
-        pViewFormats = new VkFormat[src->viewFormatCount];
+        pViewFormats = vl_safe_new_array<VkFormat>(src->viewFormatCount);
         memcpy ((void *)pViewFormats, (void *)src->pViewFormats, sizeof(VkFormat)*src->viewFormatCount);
     }
 }
@@ -13605,6 +16366,23 @@ safe_VkPhysicalDevice8BitStorageFeaturesKHR& safe_VkPhysicalDevice8BitStorageFea
     return *this;
 }
 
+safe_VkPhysicalDevice8BitStorageFeaturesKHR::safe_VkPhysicalDevice8BitStorageFeaturesKHR(safe_VkPhysicalDevice8BitStorageFeaturesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevice8BitStorageFeaturesKHR));
+    new (&src) safe_VkPhysicalDevice8BitStorageFeaturesKHR();
+}
+
+safe_VkPhysicalDevice8BitStorageFeaturesKHR& safe_VkPhysicalDevice8BitStorageFeaturesKHR::operator=(safe_VkPhysicalDevice8BitStorageFeaturesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDevice8BitStorageFeaturesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevice8BitStorageFeaturesKHR));
+    new (&src) safe_VkPhysicalDevice8BitStorageFeaturesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDevice8BitStorageFeaturesKHR::~safe_VkPhysicalDevice8BitStorageFeaturesKHR()
 {
 }
@@ -13659,6 +16437,23 @@ safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR& safe_VkPhysicalDeviceShaderAt
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR::safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR(safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR();
+}
+
+safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR& safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR::operator=(safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR::~safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR()
 {
 }
@@ -13685,12 +16480,8 @@ safe_VkPhysicalDeviceDriverPropertiesKHR::safe_VkPhysicalDeviceDriverPropertiesK
     driverID(in_struct->driverID),
     conformanceVersion(in_struct->conformanceVersion)
 {
-    for (uint32_t i=0; i<VK_MAX_DRIVER_NAME_SIZE_KHR; ++i) {
-        driverName[i] = in_struct->driverName[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_DRIVER_INFO_SIZE_KHR; ++i) {
-        driverInfo[i] = in_struct->driverInfo[i];
-    }
+    memcpy (driverName, in_struct->driverName, sizeof(driverName));
+    memcpy (driverInfo, in_struct->driverInfo, sizeof(driverInfo));
 }
 
 safe_VkPhysicalDeviceDriverPropertiesKHR::safe_VkPhysicalDeviceDriverPropertiesKHR()
@@ -13702,12 +16493,8 @@ safe_VkPhysicalDeviceDriverPropertiesKHR::safe_VkPhysicalDeviceDriverPropertiesK
     pNext = src.pNext;
     driverID = src.driverID;
     conformanceVersion = src.conformanceVersion;
-    for (uint32_t i=0; i<VK_MAX_DRIVER_NAME_SIZE_KHR; ++i) {
-        driverName[i] = src.driverName[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_DRIVER_INFO_SIZE_KHR; ++i) {
-        driverInfo[i] = src.driverInfo[i];
-    }
+    memcpy (driverName, src.driverName, sizeof(driverName));
+    memcpy (driverInfo, src.driverInfo, sizeof(driverInfo));
 }
 
 safe_VkPhysicalDeviceDriverPropertiesKHR& safe_VkPhysicalDeviceDriverPropertiesKHR::operator=(const safe_VkPhysicalDeviceDriverPropertiesKHR& src)
@@ -13719,12 +16506,25 @@ safe_VkPhysicalDeviceDriverPropertiesKHR& safe_VkPhysicalDeviceDriverPropertiesK
     pNext = src.pNext;
     driverID = src.driverID;
     conformanceVersion = src.conformanceVersion;
-    for (uint32_t i=0; i<VK_MAX_DRIVER_NAME_SIZE_KHR; ++i) {
-        driverName[i] = src.driverName[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_DRIVER_INFO_SIZE_KHR; ++i) {
-        driverInfo[i] = src.driverInfo[i];
-    }
+    memcpy (driverName, src.driverName, sizeof(driverName));
+    memcpy (driverInfo, src.driverInfo, sizeof(driverInfo));
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceDriverPropertiesKHR::safe_VkPhysicalDeviceDriverPropertiesKHR(safe_VkPhysicalDeviceDriverPropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDriverPropertiesKHR));
+    new (&src) safe_VkPhysicalDeviceDriverPropertiesKHR();
+}
+
+safe_VkPhysicalDeviceDriverPropertiesKHR& safe_VkPhysicalDeviceDriverPropertiesKHR::operator=(safe_VkPhysicalDeviceDriverPropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDriverPropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDriverPropertiesKHR));
+    new (&src) safe_VkPhysicalDeviceDriverPropertiesKHR();
 
     return *this;
 }
@@ -13739,12 +16539,8 @@ void safe_VkPhysicalDeviceDriverPropertiesKHR::initialize(const VkPhysicalDevice
     pNext = in_struct->pNext;
     driverID = in_struct->driverID;
     conformanceVersion = in_struct->conformanceVersion;
-    for (uint32_t i=0; i<VK_MAX_DRIVER_NAME_SIZE_KHR; ++i) {
-        driverName[i] = in_struct->driverName[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_DRIVER_INFO_SIZE_KHR; ++i) {
-        driverInfo[i] = in_struct->driverInfo[i];
-    }
+    memcpy (driverName, in_struct->driverName, sizeof(driverName));
+    memcpy (driverInfo, in_struct->driverInfo, sizeof(driverInfo));
 }
 
 void safe_VkPhysicalDeviceDriverPropertiesKHR::initialize(const safe_VkPhysicalDeviceDriverPropertiesKHR* src)
@@ -13753,12 +16549,8 @@ void safe_VkPhysicalDeviceDriverPropertiesKHR::initialize(const safe_VkPhysicalD
     pNext = src->pNext;
     driverID = src->driverID;
     conformanceVersion = src->conformanceVersion;
-    for (uint32_t i=0; i<VK_MAX_DRIVER_NAME_SIZE_KHR; ++i) {
-        driverName[i] = src->driverName[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_DRIVER_INFO_SIZE_KHR; ++i) {
-        driverInfo[i] = src->driverInfo[i];
-    }
+    memcpy (driverName, src->driverName, sizeof(driverName));
+    memcpy (driverInfo, src->driverInfo, sizeof(driverInfo));
 }
 
 safe_VkPhysicalDeviceFloatControlsPropertiesKHR::safe_VkPhysicalDeviceFloatControlsPropertiesKHR(const VkPhysicalDeviceFloatControlsPropertiesKHR* in_struct) :
@@ -13838,6 +16630,23 @@ safe_VkPhysicalDeviceFloatControlsPropertiesKHR& safe_VkPhysicalDeviceFloatContr
     return *this;
 }
 
+safe_VkPhysicalDeviceFloatControlsPropertiesKHR::safe_VkPhysicalDeviceFloatControlsPropertiesKHR(safe_VkPhysicalDeviceFloatControlsPropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFloatControlsPropertiesKHR));
+    new (&src) safe_VkPhysicalDeviceFloatControlsPropertiesKHR();
+}
+
+safe_VkPhysicalDeviceFloatControlsPropertiesKHR& safe_VkPhysicalDeviceFloatControlsPropertiesKHR::operator=(safe_VkPhysicalDeviceFloatControlsPropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFloatControlsPropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFloatControlsPropertiesKHR));
+    new (&src) safe_VkPhysicalDeviceFloatControlsPropertiesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFloatControlsPropertiesKHR::~safe_VkPhysicalDeviceFloatControlsPropertiesKHR()
 {
 }
@@ -13895,7 +16704,7 @@ safe_VkSubpassDescriptionDepthStencilResolveKHR::safe_VkSubpassDescriptionDepthS
     stencilResolveMode(in_struct->stencilResolveMode)
 {
     if (in_struct->pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2KHR(in_struct->pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(in_struct->pDepthStencilResolveAttachment);
     else
         pDepthStencilResolveAttachment = NULL;
 }
@@ -13910,7 +16719,7 @@ safe_VkSubpassDescriptionDepthStencilResolveKHR::safe_VkSubpassDescriptionDepthS
     depthResolveMode = src.depthResolveMode;
     stencilResolveMode = src.stencilResolveMode;
     if (src.pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2KHR(*src.pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(*src.pDepthStencilResolveAttachment);
     else
         pDepthStencilResolveAttachment = NULL;
 }
@@ -13920,24 +16729,41 @@ safe_VkSubpassDescriptionDepthStencilResolveKHR& safe_VkSubpassDescriptionDepthS
     if (&src == this) return *this;
 
     if (pDepthStencilResolveAttachment)
-        delete pDepthStencilResolveAttachment;
+        vl_safe_delete(pDepthStencilResolveAttachment);
 
     sType = src.sType;
     pNext = src.pNext;
     depthResolveMode = src.depthResolveMode;
     stencilResolveMode = src.stencilResolveMode;
     if (src.pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2KHR(*src.pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(*src.pDepthStencilResolveAttachment);
     else
         pDepthStencilResolveAttachment = NULL;
 
     return *this;
 }
 
+safe_VkSubpassDescriptionDepthStencilResolveKHR::safe_VkSubpassDescriptionDepthStencilResolveKHR(safe_VkSubpassDescriptionDepthStencilResolveKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDescriptionDepthStencilResolveKHR));
+    new (&src) safe_VkSubpassDescriptionDepthStencilResolveKHR();
+}
+
+safe_VkSubpassDescriptionDepthStencilResolveKHR& safe_VkSubpassDescriptionDepthStencilResolveKHR::operator=(safe_VkSubpassDescriptionDepthStencilResolveKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSubpassDescriptionDepthStencilResolveKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSubpassDescriptionDepthStencilResolveKHR));
+    new (&src) safe_VkSubpassDescriptionDepthStencilResolveKHR();
+
+    return *this;
+}
+
 safe_VkSubpassDescriptionDepthStencilResolveKHR::~safe_VkSubpassDescriptionDepthStencilResolveKHR()
 {
     if (pDepthStencilResolveAttachment)
-        delete pDepthStencilResolveAttachment;
+        vl_safe_delete(pDepthStencilResolveAttachment);
 }
 
 void safe_VkSubpassDescriptionDepthStencilResolveKHR::initialize(const VkSubpassDescriptionDepthStencilResolveKHR* in_struct)
@@ -13947,7 +16773,7 @@ void safe_VkSubpassDescriptionDepthStencilResolveKHR::initialize(const VkSubpass
     depthResolveMode = in_struct->depthResolveMode;
     stencilResolveMode = in_struct->stencilResolveMode;
     if (in_struct->pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2KHR(in_struct->pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(in_struct->pDepthStencilResolveAttachment);
     else
         pDepthStencilResolveAttachment = NULL;
 }
@@ -13959,7 +16785,7 @@ void safe_VkSubpassDescriptionDepthStencilResolveKHR::initialize(const safe_VkSu
     depthResolveMode = src->depthResolveMode;
     stencilResolveMode = src->stencilResolveMode;
     if (src->pDepthStencilResolveAttachment)
-        pDepthStencilResolveAttachment = new safe_VkAttachmentReference2KHR(*src->pDepthStencilResolveAttachment);
+        pDepthStencilResolveAttachment = vl_safe_new<safe_VkAttachmentReference2KHR>(*src->pDepthStencilResolveAttachment);
     else
         pDepthStencilResolveAttachment = NULL;
 }
@@ -14002,6 +16828,23 @@ safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR& safe_VkPhysicalDeviceDept
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR::safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR(safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR));
+    new (&src) safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR();
+}
+
+safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR& safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR::operator=(safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR));
+    new (&src) safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR::~safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR()
 {
 }
@@ -14061,6 +16904,23 @@ safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR& safe_VkPhysicalDeviceVulkanMe
     return *this;
 }
 
+safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR::safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR(safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR();
+}
+
+safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR& safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR::operator=(safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR::~safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR()
 {
 }
@@ -14112,6 +16972,23 @@ safe_VkSurfaceProtectedCapabilitiesKHR& safe_VkSurfaceProtectedCapabilitiesKHR::
     return *this;
 }
 
+safe_VkSurfaceProtectedCapabilitiesKHR::safe_VkSurfaceProtectedCapabilitiesKHR(safe_VkSurfaceProtectedCapabilitiesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceProtectedCapabilitiesKHR));
+    new (&src) safe_VkSurfaceProtectedCapabilitiesKHR();
+}
+
+safe_VkSurfaceProtectedCapabilitiesKHR& safe_VkSurfaceProtectedCapabilitiesKHR::operator=(safe_VkSurfaceProtectedCapabilitiesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceProtectedCapabilitiesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceProtectedCapabilitiesKHR));
+    new (&src) safe_VkSurfaceProtectedCapabilitiesKHR();
+
+    return *this;
+}
+
 safe_VkSurfaceProtectedCapabilitiesKHR::~safe_VkSurfaceProtectedCapabilitiesKHR()
 {
 }
@@ -14159,6 +17036,23 @@ safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR::safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR(safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR();
+}
+
+safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR& safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR::operator=(safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR));
+    new (&src) safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR::~safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR()
 {
 }
@@ -14212,6 +17106,23 @@ safe_VkDebugReportCallbackCreateInfoEXT& safe_VkDebugReportCallbackCreateInfoEXT
     return *this;
 }
 
+safe_VkDebugReportCallbackCreateInfoEXT::safe_VkDebugReportCallbackCreateInfoEXT(safe_VkDebugReportCallbackCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugReportCallbackCreateInfoEXT));
+    new (&src) safe_VkDebugReportCallbackCreateInfoEXT();
+}
+
+safe_VkDebugReportCallbackCreateInfoEXT& safe_VkDebugReportCallbackCreateInfoEXT::operator=(safe_VkDebugReportCallbackCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugReportCallbackCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugReportCallbackCreateInfoEXT));
+    new (&src) safe_VkDebugReportCallbackCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkDebugReportCallbackCreateInfoEXT::~safe_VkDebugReportCallbackCreateInfoEXT()
 {
 }
@@ -14263,6 +17174,23 @@ safe_VkPipelineRasterizationStateRasterizationOrderAMD& safe_VkPipelineRasteriza
     return *this;
 }
 
+safe_VkPipelineRasterizationStateRasterizationOrderAMD::safe_VkPipelineRasterizationStateRasterizationOrderAMD(safe_VkPipelineRasterizationStateRasterizationOrderAMD&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationStateRasterizationOrderAMD));
+    new (&src) safe_VkPipelineRasterizationStateRasterizationOrderAMD();
+}
+
+safe_VkPipelineRasterizationStateRasterizationOrderAMD& safe_VkPipelineRasterizationStateRasterizationOrderAMD::operator=(safe_VkPipelineRasterizationStateRasterizationOrderAMD&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineRasterizationStateRasterizationOrderAMD();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationStateRasterizationOrderAMD));
+    new (&src) safe_VkPipelineRasterizationStateRasterizationOrderAMD();
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationStateRasterizationOrderAMD::~safe_VkPipelineRasterizationStateRasterizationOrderAMD()
 {
 }
@@ -14316,6 +17244,23 @@ safe_VkDebugMarkerObjectNameInfoEXT& safe_VkDebugMarkerObjectNameInfoEXT::operat
     return *this;
 }
 
+safe_VkDebugMarkerObjectNameInfoEXT::safe_VkDebugMarkerObjectNameInfoEXT(safe_VkDebugMarkerObjectNameInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugMarkerObjectNameInfoEXT));
+    new (&src) safe_VkDebugMarkerObjectNameInfoEXT();
+}
+
+safe_VkDebugMarkerObjectNameInfoEXT& safe_VkDebugMarkerObjectNameInfoEXT::operator=(safe_VkDebugMarkerObjectNameInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugMarkerObjectNameInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugMarkerObjectNameInfoEXT));
+    new (&src) safe_VkDebugMarkerObjectNameInfoEXT();
+
+    return *this;
+}
+
 safe_VkDebugMarkerObjectNameInfoEXT::~safe_VkDebugMarkerObjectNameInfoEXT()
 {
 }
@@ -14379,6 +17324,23 @@ safe_VkDebugMarkerObjectTagInfoEXT& safe_VkDebugMarkerObjectTagInfoEXT::operator
     return *this;
 }
 
+safe_VkDebugMarkerObjectTagInfoEXT::safe_VkDebugMarkerObjectTagInfoEXT(safe_VkDebugMarkerObjectTagInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugMarkerObjectTagInfoEXT));
+    new (&src) safe_VkDebugMarkerObjectTagInfoEXT();
+}
+
+safe_VkDebugMarkerObjectTagInfoEXT& safe_VkDebugMarkerObjectTagInfoEXT::operator=(safe_VkDebugMarkerObjectTagInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugMarkerObjectTagInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugMarkerObjectTagInfoEXT));
+    new (&src) safe_VkDebugMarkerObjectTagInfoEXT();
+
+    return *this;
+}
+
 safe_VkDebugMarkerObjectTagInfoEXT::~safe_VkDebugMarkerObjectTagInfoEXT()
 {
 }
@@ -14410,9 +17372,7 @@ safe_VkDebugMarkerMarkerInfoEXT::safe_VkDebugMarkerMarkerInfoEXT(const VkDebugMa
     pNext(in_struct->pNext),
     pMarkerName(in_struct->pMarkerName)
 {
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = in_struct->color[i];
-    }
+    memcpy (color, in_struct->color, sizeof(color));
 }
 
 safe_VkDebugMarkerMarkerInfoEXT::safe_VkDebugMarkerMarkerInfoEXT()
@@ -14423,9 +17383,7 @@ safe_VkDebugMarkerMarkerInfoEXT::safe_VkDebugMarkerMarkerInfoEXT(const safe_VkDe
     sType = src.sType;
     pNext = src.pNext;
     pMarkerName = src.pMarkerName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = src.color[i];
-    }
+    memcpy (color, src.color, sizeof(color));
 }
 
 safe_VkDebugMarkerMarkerInfoEXT& safe_VkDebugMarkerMarkerInfoEXT::operator=(const safe_VkDebugMarkerMarkerInfoEXT& src)
@@ -14436,9 +17394,24 @@ safe_VkDebugMarkerMarkerInfoEXT& safe_VkDebugMarkerMarkerInfoEXT::operator=(cons
     sType = src.sType;
     pNext = src.pNext;
     pMarkerName = src.pMarkerName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = src.color[i];
-    }
+    memcpy (color, src.color, sizeof(color));
+
+    return *this;
+}
+
+safe_VkDebugMarkerMarkerInfoEXT::safe_VkDebugMarkerMarkerInfoEXT(safe_VkDebugMarkerMarkerInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugMarkerMarkerInfoEXT));
+    new (&src) safe_VkDebugMarkerMarkerInfoEXT();
+}
+
+safe_VkDebugMarkerMarkerInfoEXT& safe_VkDebugMarkerMarkerInfoEXT::operator=(safe_VkDebugMarkerMarkerInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugMarkerMarkerInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugMarkerMarkerInfoEXT));
+    new (&src) safe_VkDebugMarkerMarkerInfoEXT();
 
     return *this;
 }
@@ -14452,9 +17425,7 @@ void safe_VkDebugMarkerMarkerInfoEXT::initialize(const VkDebugMarkerMarkerInfoEX
     sType = in_struct->sType;
     pNext = in_struct->pNext;
     pMarkerName = in_struct->pMarkerName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = in_struct->color[i];
-    }
+    memcpy (color, in_struct->color, sizeof(color));
 }
 
 void safe_VkDebugMarkerMarkerInfoEXT::initialize(const safe_VkDebugMarkerMarkerInfoEXT* src)
@@ -14462,9 +17433,7 @@ void safe_VkDebugMarkerMarkerInfoEXT::initialize(const safe_VkDebugMarkerMarkerI
     sType = src->sType;
     pNext = src->pNext;
     pMarkerName = src->pMarkerName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = src->color[i];
-    }
+    memcpy (color, src->color, sizeof(color));
 }
 
 safe_VkDedicatedAllocationImageCreateInfoNV::safe_VkDedicatedAllocationImageCreateInfoNV(const VkDedicatedAllocationImageCreateInfoNV* in_struct) :
@@ -14496,6 +17465,23 @@ safe_VkDedicatedAllocationImageCreateInfoNV& safe_VkDedicatedAllocationImageCrea
     return *this;
 }
 
+safe_VkDedicatedAllocationImageCreateInfoNV::safe_VkDedicatedAllocationImageCreateInfoNV(safe_VkDedicatedAllocationImageCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDedicatedAllocationImageCreateInfoNV));
+    new (&src) safe_VkDedicatedAllocationImageCreateInfoNV();
+}
+
+safe_VkDedicatedAllocationImageCreateInfoNV& safe_VkDedicatedAllocationImageCreateInfoNV::operator=(safe_VkDedicatedAllocationImageCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDedicatedAllocationImageCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDedicatedAllocationImageCreateInfoNV));
+    new (&src) safe_VkDedicatedAllocationImageCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkDedicatedAllocationImageCreateInfoNV::~safe_VkDedicatedAllocationImageCreateInfoNV()
 {
 }
@@ -14543,6 +17529,23 @@ safe_VkDedicatedAllocationBufferCreateInfoNV& safe_VkDedicatedAllocationBufferCr
     return *this;
 }
 
+safe_VkDedicatedAllocationBufferCreateInfoNV::safe_VkDedicatedAllocationBufferCreateInfoNV(safe_VkDedicatedAllocationBufferCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDedicatedAllocationBufferCreateInfoNV));
+    new (&src) safe_VkDedicatedAllocationBufferCreateInfoNV();
+}
+
+safe_VkDedicatedAllocationBufferCreateInfoNV& safe_VkDedicatedAllocationBufferCreateInfoNV::operator=(safe_VkDedicatedAllocationBufferCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDedicatedAllocationBufferCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDedicatedAllocationBufferCreateInfoNV));
+    new (&src) safe_VkDedicatedAllocationBufferCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkDedicatedAllocationBufferCreateInfoNV::~safe_VkDedicatedAllocationBufferCreateInfoNV()
 {
 }
@@ -14593,6 +17596,23 @@ safe_VkDedicatedAllocationMemoryAllocateInfoNV& safe_VkDedicatedAllocationMemory
     return *this;
 }
 
+safe_VkDedicatedAllocationMemoryAllocateInfoNV::safe_VkDedicatedAllocationMemoryAllocateInfoNV(safe_VkDedicatedAllocationMemoryAllocateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDedicatedAllocationMemoryAllocateInfoNV));
+    new (&src) safe_VkDedicatedAllocationMemoryAllocateInfoNV();
+}
+
+safe_VkDedicatedAllocationMemoryAllocateInfoNV& safe_VkDedicatedAllocationMemoryAllocateInfoNV::operator=(safe_VkDedicatedAllocationMemoryAllocateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDedicatedAllocationMemoryAllocateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDedicatedAllocationMemoryAllocateInfoNV));
+    new (&src) safe_VkDedicatedAllocationMemoryAllocateInfoNV();
+
+    return *this;
+}
+
 safe_VkDedicatedAllocationMemoryAllocateInfoNV::~safe_VkDedicatedAllocationMemoryAllocateInfoNV()
 {
 }
@@ -14645,6 +17665,23 @@ safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& safe_VkPhysicalDeviceTransfor
     return *this;
 }
 
+safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::operator=(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT::~safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT()
 {
 }
@@ -14721,6 +17758,23 @@ safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& safe_VkPhysicalDeviceTransf
     return *this;
 }
 
+safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT::safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT::operator=(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT::~safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT()
 {
 }
@@ -14789,6 +17843,23 @@ safe_VkPipelineRasterizationStateStreamCreateInfoEXT& safe_VkPipelineRasterizati
     return *this;
 }
 
+safe_VkPipelineRasterizationStateStreamCreateInfoEXT::safe_VkPipelineRasterizationStateStreamCreateInfoEXT(safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationStateStreamCreateInfoEXT));
+    new (&src) safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
+}
+
+safe_VkPipelineRasterizationStateStreamCreateInfoEXT& safe_VkPipelineRasterizationStateStreamCreateInfoEXT::operator=(safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationStateStreamCreateInfoEXT));
+    new (&src) safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationStateStreamCreateInfoEXT::~safe_VkPipelineRasterizationStateStreamCreateInfoEXT()
 {
 }
@@ -14844,6 +17915,23 @@ safe_VkImageViewHandleInfoNVX& safe_VkImageViewHandleInfoNVX::operator=(const sa
     return *this;
 }
 
+safe_VkImageViewHandleInfoNVX::safe_VkImageViewHandleInfoNVX(safe_VkImageViewHandleInfoNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewHandleInfoNVX));
+    new (&src) safe_VkImageViewHandleInfoNVX();
+}
+
+safe_VkImageViewHandleInfoNVX& safe_VkImageViewHandleInfoNVX::operator=(safe_VkImageViewHandleInfoNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageViewHandleInfoNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewHandleInfoNVX));
+    new (&src) safe_VkImageViewHandleInfoNVX();
+
+    return *this;
+}
+
 safe_VkImageViewHandleInfoNVX::~safe_VkImageViewHandleInfoNVX()
 {
 }
@@ -14895,6 +17983,23 @@ safe_VkTextureLODGatherFormatPropertiesAMD& safe_VkTextureLODGatherFormatPropert
     return *this;
 }
 
+safe_VkTextureLODGatherFormatPropertiesAMD::safe_VkTextureLODGatherFormatPropertiesAMD(safe_VkTextureLODGatherFormatPropertiesAMD&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkTextureLODGatherFormatPropertiesAMD));
+    new (&src) safe_VkTextureLODGatherFormatPropertiesAMD();
+}
+
+safe_VkTextureLODGatherFormatPropertiesAMD& safe_VkTextureLODGatherFormatPropertiesAMD::operator=(safe_VkTextureLODGatherFormatPropertiesAMD&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkTextureLODGatherFormatPropertiesAMD();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkTextureLODGatherFormatPropertiesAMD));
+    new (&src) safe_VkTextureLODGatherFormatPropertiesAMD();
+
+    return *this;
+}
+
 safe_VkTextureLODGatherFormatPropertiesAMD::~safe_VkTextureLODGatherFormatPropertiesAMD()
 {
 }
@@ -14947,6 +18052,23 @@ safe_VkStreamDescriptorSurfaceCreateInfoGGP& safe_VkStreamDescriptorSurfaceCreat
     return *this;
 }
 
+safe_VkStreamDescriptorSurfaceCreateInfoGGP::safe_VkStreamDescriptorSurfaceCreateInfoGGP(safe_VkStreamDescriptorSurfaceCreateInfoGGP&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkStreamDescriptorSurfaceCreateInfoGGP));
+    new (&src) safe_VkStreamDescriptorSurfaceCreateInfoGGP();
+}
+
+safe_VkStreamDescriptorSurfaceCreateInfoGGP& safe_VkStreamDescriptorSurfaceCreateInfoGGP::operator=(safe_VkStreamDescriptorSurfaceCreateInfoGGP&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkStreamDescriptorSurfaceCreateInfoGGP();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkStreamDescriptorSurfaceCreateInfoGGP));
+    new (&src) safe_VkStreamDescriptorSurfaceCreateInfoGGP();
+
+    return *this;
+}
+
 safe_VkStreamDescriptorSurfaceCreateInfoGGP::~safe_VkStreamDescriptorSurfaceCreateInfoGGP()
 {
 }
@@ -14998,6 +18120,23 @@ safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& safe_VkPhysicalDeviceCornerSa
     return *this;
 }
 
+safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
+}
+
+safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::operator=(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCornerSampledImageFeaturesNV::~safe_VkPhysicalDeviceCornerSampledImageFeaturesNV()
 {
 }
@@ -15045,6 +18184,23 @@ safe_VkExternalMemoryImageCreateInfoNV& safe_VkExternalMemoryImageCreateInfoNV::
     return *this;
 }
 
+safe_VkExternalMemoryImageCreateInfoNV::safe_VkExternalMemoryImageCreateInfoNV(safe_VkExternalMemoryImageCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalMemoryImageCreateInfoNV));
+    new (&src) safe_VkExternalMemoryImageCreateInfoNV();
+}
+
+safe_VkExternalMemoryImageCreateInfoNV& safe_VkExternalMemoryImageCreateInfoNV::operator=(safe_VkExternalMemoryImageCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalMemoryImageCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalMemoryImageCreateInfoNV));
+    new (&src) safe_VkExternalMemoryImageCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkExternalMemoryImageCreateInfoNV::~safe_VkExternalMemoryImageCreateInfoNV()
 {
 }
@@ -15092,6 +18248,23 @@ safe_VkExportMemoryAllocateInfoNV& safe_VkExportMemoryAllocateInfoNV::operator=(
     return *this;
 }
 
+safe_VkExportMemoryAllocateInfoNV::safe_VkExportMemoryAllocateInfoNV(safe_VkExportMemoryAllocateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryAllocateInfoNV));
+    new (&src) safe_VkExportMemoryAllocateInfoNV();
+}
+
+safe_VkExportMemoryAllocateInfoNV& safe_VkExportMemoryAllocateInfoNV::operator=(safe_VkExportMemoryAllocateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportMemoryAllocateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryAllocateInfoNV));
+    new (&src) safe_VkExportMemoryAllocateInfoNV();
+
+    return *this;
+}
+
 safe_VkExportMemoryAllocateInfoNV::~safe_VkExportMemoryAllocateInfoNV()
 {
 }
@@ -15144,6 +18317,23 @@ safe_VkImportMemoryWin32HandleInfoNV& safe_VkImportMemoryWin32HandleInfoNV::oper
     return *this;
 }
 
+safe_VkImportMemoryWin32HandleInfoNV::safe_VkImportMemoryWin32HandleInfoNV(safe_VkImportMemoryWin32HandleInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryWin32HandleInfoNV));
+    new (&src) safe_VkImportMemoryWin32HandleInfoNV();
+}
+
+safe_VkImportMemoryWin32HandleInfoNV& safe_VkImportMemoryWin32HandleInfoNV::operator=(safe_VkImportMemoryWin32HandleInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportMemoryWin32HandleInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryWin32HandleInfoNV));
+    new (&src) safe_VkImportMemoryWin32HandleInfoNV();
+
+    return *this;
+}
+
 safe_VkImportMemoryWin32HandleInfoNV::~safe_VkImportMemoryWin32HandleInfoNV()
 {
 }
@@ -15175,7 +18365,7 @@ safe_VkExportMemoryWin32HandleInfoNV::safe_VkExportMemoryWin32HandleInfoNV(const
     dwAccess(in_struct->dwAccess)
 {
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -15190,7 +18380,7 @@ safe_VkExportMemoryWin32HandleInfoNV::safe_VkExportMemoryWin32HandleInfoNV(const
     pAttributes = nullptr;
     dwAccess = src.dwAccess;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 }
 
@@ -15199,23 +18389,40 @@ safe_VkExportMemoryWin32HandleInfoNV& safe_VkExportMemoryWin32HandleInfoNV::oper
     if (&src == this) return *this;
 
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 
     sType = src.sType;
     pNext = src.pNext;
     pAttributes = nullptr;
     dwAccess = src.dwAccess;
     if (src.pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src.pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src.pAttributes);
     }
 
     return *this;
 }
 
+safe_VkExportMemoryWin32HandleInfoNV::safe_VkExportMemoryWin32HandleInfoNV(safe_VkExportMemoryWin32HandleInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryWin32HandleInfoNV));
+    new (&src) safe_VkExportMemoryWin32HandleInfoNV();
+}
+
+safe_VkExportMemoryWin32HandleInfoNV& safe_VkExportMemoryWin32HandleInfoNV::operator=(safe_VkExportMemoryWin32HandleInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExportMemoryWin32HandleInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExportMemoryWin32HandleInfoNV));
+    new (&src) safe_VkExportMemoryWin32HandleInfoNV();
+
+    return *this;
+}
+
 safe_VkExportMemoryWin32HandleInfoNV::~safe_VkExportMemoryWin32HandleInfoNV()
 {
     if (pAttributes)
-        delete pAttributes;
+        vl_safe_delete(pAttributes);
 }
 
 void safe_VkExportMemoryWin32HandleInfoNV::initialize(const VkExportMemoryWin32HandleInfoNV* in_struct)
@@ -15225,7 +18432,7 @@ void safe_VkExportMemoryWin32HandleInfoNV::initialize(const VkExportMemoryWin32H
     pAttributes = nullptr;
     dwAccess = in_struct->dwAccess;
     if (in_struct->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*in_struct->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*in_struct->pAttributes);
     }
 }
 
@@ -15236,7 +18443,7 @@ void safe_VkExportMemoryWin32HandleInfoNV::initialize(const safe_VkExportMemoryW
     pAttributes = nullptr;
     dwAccess = src->dwAccess;
     if (src->pAttributes) {
-        pAttributes = new SECURITY_ATTRIBUTES(*src->pAttributes);
+        pAttributes = vl_safe_new<SECURITY_ATTRIBUTES>(*src->pAttributes);
     }
 }
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -15256,27 +18463,23 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV::safe_VkWin32KeyedMutexAcquireRelease
     pReleaseKeys(nullptr)
 {
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)in_struct->pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeoutMilliseconds = vl_safe_new_array<uint32_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)in_struct->pAcquireTimeoutMilliseconds, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)in_struct->pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(in_struct->releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -15301,27 +18504,23 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV::safe_VkWin32KeyedMutexAcquireRelease
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = src.pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)src.pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[src.acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(src.acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)src.pAcquireKeys, sizeof(uint64_t)*src.acquireCount);
     }
     if (src.pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[src.acquireCount];
+        pAcquireTimeoutMilliseconds = vl_safe_new_array<uint32_t>(src.acquireCount);
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)src.pAcquireTimeoutMilliseconds, sizeof(uint32_t)*src.acquireCount);
     }
     if (releaseCount && src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = src.pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)src.pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[src.releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(src.releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)src.pReleaseKeys, sizeof(uint64_t)*src.releaseCount);
     }
 }
@@ -15331,15 +18530,15 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV& safe_VkWin32KeyedMutexAcquireRelease
     if (&src == this) return *this;
 
     if (pAcquireSyncs)
-        delete[] pAcquireSyncs;
+        vl_safe_delete_array(pAcquireSyncs);
     if (pAcquireKeys)
-        delete[] pAcquireKeys;
+        vl_safe_delete_array(pAcquireKeys);
     if (pAcquireTimeoutMilliseconds)
-        delete[] pAcquireTimeoutMilliseconds;
+        vl_safe_delete_array(pAcquireTimeoutMilliseconds);
     if (pReleaseSyncs)
-        delete[] pReleaseSyncs;
+        vl_safe_delete_array(pReleaseSyncs);
     if (pReleaseKeys)
-        delete[] pReleaseKeys;
+        vl_safe_delete_array(pReleaseKeys);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -15351,45 +18550,58 @@ safe_VkWin32KeyedMutexAcquireReleaseInfoNV& safe_VkWin32KeyedMutexAcquireRelease
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && src.pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = src.pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)src.pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (src.pAcquireKeys) {
-        pAcquireKeys = new uint64_t[src.acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(src.acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)src.pAcquireKeys, sizeof(uint64_t)*src.acquireCount);
     }
     if (src.pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[src.acquireCount];
+        pAcquireTimeoutMilliseconds = vl_safe_new_array<uint32_t>(src.acquireCount);
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)src.pAcquireTimeoutMilliseconds, sizeof(uint32_t)*src.acquireCount);
     }
     if (releaseCount && src.pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = src.pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)src.pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (src.pReleaseKeys) {
-        pReleaseKeys = new uint64_t[src.releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(src.releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)src.pReleaseKeys, sizeof(uint64_t)*src.releaseCount);
     }
 
     return *this;
 }
 
+safe_VkWin32KeyedMutexAcquireReleaseInfoNV::safe_VkWin32KeyedMutexAcquireReleaseInfoNV(safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWin32KeyedMutexAcquireReleaseInfoNV));
+    new (&src) safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
+}
+
+safe_VkWin32KeyedMutexAcquireReleaseInfoNV& safe_VkWin32KeyedMutexAcquireReleaseInfoNV::operator=(safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWin32KeyedMutexAcquireReleaseInfoNV));
+    new (&src) safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
+
+    return *this;
+}
+
 safe_VkWin32KeyedMutexAcquireReleaseInfoNV::~safe_VkWin32KeyedMutexAcquireReleaseInfoNV()
 {
     if (pAcquireSyncs)
-        delete[] pAcquireSyncs;
+        vl_safe_delete_array(pAcquireSyncs);
     if (pAcquireKeys)
-        delete[] pAcquireKeys;
+        vl_safe_delete_array(pAcquireKeys);
     if (pAcquireTimeoutMilliseconds)
-        delete[] pAcquireTimeoutMilliseconds;
+        vl_safe_delete_array(pAcquireTimeoutMilliseconds);
     if (pReleaseSyncs)
-        delete[] pReleaseSyncs;
+        vl_safe_delete_array(pReleaseSyncs);
     if (pReleaseKeys)
-        delete[] pReleaseKeys;
+        vl_safe_delete_array(pReleaseKeys);
 }
 
 void safe_VkWin32KeyedMutexAcquireReleaseInfoNV::initialize(const VkWin32KeyedMutexAcquireReleaseInfoNV* in_struct)
@@ -15404,27 +18616,23 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoNV::initialize(const VkWin32KeyedMu
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && in_struct->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = in_struct->pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)in_struct->pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (in_struct->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[in_struct->acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)in_struct->pAcquireKeys, sizeof(uint64_t)*in_struct->acquireCount);
     }
     if (in_struct->pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[in_struct->acquireCount];
+        pAcquireTimeoutMilliseconds = vl_safe_new_array<uint32_t>(in_struct->acquireCount);
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)in_struct->pAcquireTimeoutMilliseconds, sizeof(uint32_t)*in_struct->acquireCount);
     }
     if (releaseCount && in_struct->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = in_struct->pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)in_struct->pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (in_struct->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[in_struct->releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(in_struct->releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)in_struct->pReleaseKeys, sizeof(uint64_t)*in_struct->releaseCount);
     }
 }
@@ -15441,27 +18649,23 @@ void safe_VkWin32KeyedMutexAcquireReleaseInfoNV::initialize(const safe_VkWin32Ke
     pReleaseSyncs = nullptr;
     pReleaseKeys = nullptr;
     if (acquireCount && src->pAcquireSyncs) {
-        pAcquireSyncs = new VkDeviceMemory[acquireCount];
-        for (uint32_t i=0; i<acquireCount; ++i) {
-            pAcquireSyncs[i] = src->pAcquireSyncs[i];
-        }
+        pAcquireSyncs = vl_safe_new_array<VkDeviceMemory>(acquireCount);
+        memcpy ((void *)pAcquireSyncs, (void *)src->pAcquireSyncs, sizeof(VkDeviceMemory)*acquireCount);
     }
     if (src->pAcquireKeys) {
-        pAcquireKeys = new uint64_t[src->acquireCount];
+        pAcquireKeys = vl_safe_new_array<uint64_t>(src->acquireCount);
         memcpy ((void *)pAcquireKeys, (void *)src->pAcquireKeys, sizeof(uint64_t)*src->acquireCount);
     }
     if (src->pAcquireTimeoutMilliseconds) {
-        pAcquireTimeoutMilliseconds = new uint32_t[src->acquireCount];
+        pAcquireTimeoutMilliseconds = vl_safe_new_array<uint32_t>(src->acquireCount);
         memcpy ((void *)pAcquireTimeoutMilliseconds, (void *)src->pAcquireTimeoutMilliseconds, sizeof(uint32_t)*src->acquireCount);
     }
     if (releaseCount && src->pReleaseSyncs) {
-        pReleaseSyncs = new VkDeviceMemory[releaseCount];
-        for (uint32_t i=0; i<releaseCount; ++i) {
-            pReleaseSyncs[i] = src->pReleaseSyncs[i];
-        }
+        pReleaseSyncs = vl_safe_new_array<VkDeviceMemory>(releaseCount);
+        memcpy ((void *)pReleaseSyncs, (void *)src->pReleaseSyncs, sizeof(VkDeviceMemory)*releaseCount);
     }
     if (src->pReleaseKeys) {
-        pReleaseKeys = new uint64_t[src->releaseCount];
+        pReleaseKeys = vl_safe_new_array<uint64_t>(src->releaseCount);
         memcpy ((void *)pReleaseKeys, (void *)src->pReleaseKeys, sizeof(uint64_t)*src->releaseCount);
     }
 }
@@ -15475,7 +18679,7 @@ safe_VkValidationFlagsEXT::safe_VkValidationFlagsEXT(const VkValidationFlagsEXT*
     pDisabledValidationChecks(nullptr)
 {
     if (in_struct->pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[in_struct->disabledValidationCheckCount];
+        pDisabledValidationChecks = vl_safe_new_array<VkValidationCheckEXT>(in_struct->disabledValidationCheckCount);
         memcpy ((void *)pDisabledValidationChecks, (void *)in_struct->pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*in_struct->disabledValidationCheckCount);
     }
 }
@@ -15491,7 +18695,7 @@ safe_VkValidationFlagsEXT::safe_VkValidationFlagsEXT(const safe_VkValidationFlag
     disabledValidationCheckCount = src.disabledValidationCheckCount;
     pDisabledValidationChecks = nullptr;
     if (src.pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[src.disabledValidationCheckCount];
+        pDisabledValidationChecks = vl_safe_new_array<VkValidationCheckEXT>(src.disabledValidationCheckCount);
         memcpy ((void *)pDisabledValidationChecks, (void *)src.pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*src.disabledValidationCheckCount);
     }
 }
@@ -15501,24 +18705,41 @@ safe_VkValidationFlagsEXT& safe_VkValidationFlagsEXT::operator=(const safe_VkVal
     if (&src == this) return *this;
 
     if (pDisabledValidationChecks)
-        delete[] pDisabledValidationChecks;
+        vl_safe_delete_array(pDisabledValidationChecks);
 
     sType = src.sType;
     pNext = src.pNext;
     disabledValidationCheckCount = src.disabledValidationCheckCount;
     pDisabledValidationChecks = nullptr;
     if (src.pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[src.disabledValidationCheckCount];
+        pDisabledValidationChecks = vl_safe_new_array<VkValidationCheckEXT>(src.disabledValidationCheckCount);
         memcpy ((void *)pDisabledValidationChecks, (void *)src.pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*src.disabledValidationCheckCount);
     }
 
     return *this;
 }
 
+safe_VkValidationFlagsEXT::safe_VkValidationFlagsEXT(safe_VkValidationFlagsEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkValidationFlagsEXT));
+    new (&src) safe_VkValidationFlagsEXT();
+}
+
+safe_VkValidationFlagsEXT& safe_VkValidationFlagsEXT::operator=(safe_VkValidationFlagsEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkValidationFlagsEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkValidationFlagsEXT));
+    new (&src) safe_VkValidationFlagsEXT();
+
+    return *this;
+}
+
 safe_VkValidationFlagsEXT::~safe_VkValidationFlagsEXT()
 {
     if (pDisabledValidationChecks)
-        delete[] pDisabledValidationChecks;
+        vl_safe_delete_array(pDisabledValidationChecks);
 }
 
 void safe_VkValidationFlagsEXT::initialize(const VkValidationFlagsEXT* in_struct)
@@ -15528,7 +18749,7 @@ void safe_VkValidationFlagsEXT::initialize(const VkValidationFlagsEXT* in_struct
     disabledValidationCheckCount = in_struct->disabledValidationCheckCount;
     pDisabledValidationChecks = nullptr;
     if (in_struct->pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[in_struct->disabledValidationCheckCount];
+        pDisabledValidationChecks = vl_safe_new_array<VkValidationCheckEXT>(in_struct->disabledValidationCheckCount);
         memcpy ((void *)pDisabledValidationChecks, (void *)in_struct->pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*in_struct->disabledValidationCheckCount);
     }
 }
@@ -15540,7 +18761,7 @@ void safe_VkValidationFlagsEXT::initialize(const safe_VkValidationFlagsEXT* src)
     disabledValidationCheckCount = src->disabledValidationCheckCount;
     pDisabledValidationChecks = nullptr;
     if (src->pDisabledValidationChecks) {
-        pDisabledValidationChecks = new VkValidationCheckEXT[src->disabledValidationCheckCount];
+        pDisabledValidationChecks = vl_safe_new_array<VkValidationCheckEXT>(src->disabledValidationCheckCount);
         memcpy ((void *)pDisabledValidationChecks, (void *)src->pDisabledValidationChecks, sizeof(VkValidationCheckEXT)*src->disabledValidationCheckCount);
     }
 }
@@ -15579,6 +18800,23 @@ safe_VkViSurfaceCreateInfoNN& safe_VkViSurfaceCreateInfoNN::operator=(const safe
     return *this;
 }
 
+safe_VkViSurfaceCreateInfoNN::safe_VkViSurfaceCreateInfoNN(safe_VkViSurfaceCreateInfoNN&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkViSurfaceCreateInfoNN));
+    new (&src) safe_VkViSurfaceCreateInfoNN();
+}
+
+safe_VkViSurfaceCreateInfoNN& safe_VkViSurfaceCreateInfoNN::operator=(safe_VkViSurfaceCreateInfoNN&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkViSurfaceCreateInfoNN();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkViSurfaceCreateInfoNN));
+    new (&src) safe_VkViSurfaceCreateInfoNN();
+
+    return *this;
+}
+
 safe_VkViSurfaceCreateInfoNN::~safe_VkViSurfaceCreateInfoNN()
 {
 }
@@ -15630,6 +18868,23 @@ safe_VkImageViewASTCDecodeModeEXT& safe_VkImageViewASTCDecodeModeEXT::operator=(
     return *this;
 }
 
+safe_VkImageViewASTCDecodeModeEXT::safe_VkImageViewASTCDecodeModeEXT(safe_VkImageViewASTCDecodeModeEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewASTCDecodeModeEXT));
+    new (&src) safe_VkImageViewASTCDecodeModeEXT();
+}
+
+safe_VkImageViewASTCDecodeModeEXT& safe_VkImageViewASTCDecodeModeEXT::operator=(safe_VkImageViewASTCDecodeModeEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageViewASTCDecodeModeEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageViewASTCDecodeModeEXT));
+    new (&src) safe_VkImageViewASTCDecodeModeEXT();
+
+    return *this;
+}
+
 safe_VkImageViewASTCDecodeModeEXT::~safe_VkImageViewASTCDecodeModeEXT()
 {
 }
@@ -15677,6 +18932,23 @@ safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& safe_VkPhysicalDeviceASTCDecodeFeatu
     return *this;
 }
 
+safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::operator=(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceASTCDecodeFeaturesEXT::~safe_VkPhysicalDeviceASTCDecodeFeaturesEXT()
 {
 }
@@ -15730,6 +19002,23 @@ safe_VkConditionalRenderingBeginInfoEXT& safe_VkConditionalRenderingBeginInfoEXT
     return *this;
 }
 
+safe_VkConditionalRenderingBeginInfoEXT::safe_VkConditionalRenderingBeginInfoEXT(safe_VkConditionalRenderingBeginInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkConditionalRenderingBeginInfoEXT));
+    new (&src) safe_VkConditionalRenderingBeginInfoEXT();
+}
+
+safe_VkConditionalRenderingBeginInfoEXT& safe_VkConditionalRenderingBeginInfoEXT::operator=(safe_VkConditionalRenderingBeginInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkConditionalRenderingBeginInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkConditionalRenderingBeginInfoEXT));
+    new (&src) safe_VkConditionalRenderingBeginInfoEXT();
+
+    return *this;
+}
+
 safe_VkConditionalRenderingBeginInfoEXT::~safe_VkConditionalRenderingBeginInfoEXT()
 {
 }
@@ -15784,6 +19073,23 @@ safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& safe_VkPhysicalDeviceCondi
     return *this;
 }
 
+safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT::safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT::operator=(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT::~safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT()
 {
 }
@@ -15833,6 +19139,23 @@ safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& safe_VkCommandBuffer
     return *this;
 }
 
+safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT::safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT));
+    new (&src) safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
+}
+
+safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT::operator=(safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT));
+    new (&src) safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
+
+    return *this;
+}
+
 safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT::~safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT()
 {
 }
@@ -15880,6 +19203,23 @@ safe_VkDeviceGeneratedCommandsFeaturesNVX& safe_VkDeviceGeneratedCommandsFeature
     return *this;
 }
 
+safe_VkDeviceGeneratedCommandsFeaturesNVX::safe_VkDeviceGeneratedCommandsFeaturesNVX(safe_VkDeviceGeneratedCommandsFeaturesNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGeneratedCommandsFeaturesNVX));
+    new (&src) safe_VkDeviceGeneratedCommandsFeaturesNVX();
+}
+
+safe_VkDeviceGeneratedCommandsFeaturesNVX& safe_VkDeviceGeneratedCommandsFeaturesNVX::operator=(safe_VkDeviceGeneratedCommandsFeaturesNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGeneratedCommandsFeaturesNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGeneratedCommandsFeaturesNVX));
+    new (&src) safe_VkDeviceGeneratedCommandsFeaturesNVX();
+
+    return *this;
+}
+
 safe_VkDeviceGeneratedCommandsFeaturesNVX::~safe_VkDeviceGeneratedCommandsFeaturesNVX()
 {
 }
@@ -15939,6 +19279,23 @@ safe_VkDeviceGeneratedCommandsLimitsNVX& safe_VkDeviceGeneratedCommandsLimitsNVX
     return *this;
 }
 
+safe_VkDeviceGeneratedCommandsLimitsNVX::safe_VkDeviceGeneratedCommandsLimitsNVX(safe_VkDeviceGeneratedCommandsLimitsNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGeneratedCommandsLimitsNVX));
+    new (&src) safe_VkDeviceGeneratedCommandsLimitsNVX();
+}
+
+safe_VkDeviceGeneratedCommandsLimitsNVX& safe_VkDeviceGeneratedCommandsLimitsNVX::operator=(safe_VkDeviceGeneratedCommandsLimitsNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceGeneratedCommandsLimitsNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceGeneratedCommandsLimitsNVX));
+    new (&src) safe_VkDeviceGeneratedCommandsLimitsNVX();
+
+    return *this;
+}
+
 safe_VkDeviceGeneratedCommandsLimitsNVX::~safe_VkDeviceGeneratedCommandsLimitsNVX()
 {
 }
@@ -15974,7 +19331,7 @@ safe_VkIndirectCommandsLayoutCreateInfoNVX::safe_VkIndirectCommandsLayoutCreateI
     pTokens(nullptr)
 {
     if (in_struct->pTokens) {
-        pTokens = new VkIndirectCommandsLayoutTokenNVX[in_struct->tokenCount];
+        pTokens = vl_safe_new_array<VkIndirectCommandsLayoutTokenNVX>(in_struct->tokenCount);
         memcpy ((void *)pTokens, (void *)in_struct->pTokens, sizeof(VkIndirectCommandsLayoutTokenNVX)*in_struct->tokenCount);
     }
 }
@@ -15992,7 +19349,7 @@ safe_VkIndirectCommandsLayoutCreateInfoNVX::safe_VkIndirectCommandsLayoutCreateI
     tokenCount = src.tokenCount;
     pTokens = nullptr;
     if (src.pTokens) {
-        pTokens = new VkIndirectCommandsLayoutTokenNVX[src.tokenCount];
+        pTokens = vl_safe_new_array<VkIndirectCommandsLayoutTokenNVX>(src.tokenCount);
         memcpy ((void *)pTokens, (void *)src.pTokens, sizeof(VkIndirectCommandsLayoutTokenNVX)*src.tokenCount);
     }
 }
@@ -16002,7 +19359,7 @@ safe_VkIndirectCommandsLayoutCreateInfoNVX& safe_VkIndirectCommandsLayoutCreateI
     if (&src == this) return *this;
 
     if (pTokens)
-        delete[] pTokens;
+        vl_safe_delete_array(pTokens);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -16011,17 +19368,34 @@ safe_VkIndirectCommandsLayoutCreateInfoNVX& safe_VkIndirectCommandsLayoutCreateI
     tokenCount = src.tokenCount;
     pTokens = nullptr;
     if (src.pTokens) {
-        pTokens = new VkIndirectCommandsLayoutTokenNVX[src.tokenCount];
+        pTokens = vl_safe_new_array<VkIndirectCommandsLayoutTokenNVX>(src.tokenCount);
         memcpy ((void *)pTokens, (void *)src.pTokens, sizeof(VkIndirectCommandsLayoutTokenNVX)*src.tokenCount);
     }
 
     return *this;
 }
 
+safe_VkIndirectCommandsLayoutCreateInfoNVX::safe_VkIndirectCommandsLayoutCreateInfoNVX(safe_VkIndirectCommandsLayoutCreateInfoNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkIndirectCommandsLayoutCreateInfoNVX));
+    new (&src) safe_VkIndirectCommandsLayoutCreateInfoNVX();
+}
+
+safe_VkIndirectCommandsLayoutCreateInfoNVX& safe_VkIndirectCommandsLayoutCreateInfoNVX::operator=(safe_VkIndirectCommandsLayoutCreateInfoNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkIndirectCommandsLayoutCreateInfoNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkIndirectCommandsLayoutCreateInfoNVX));
+    new (&src) safe_VkIndirectCommandsLayoutCreateInfoNVX();
+
+    return *this;
+}
+
 safe_VkIndirectCommandsLayoutCreateInfoNVX::~safe_VkIndirectCommandsLayoutCreateInfoNVX()
 {
     if (pTokens)
-        delete[] pTokens;
+        vl_safe_delete_array(pTokens);
 }
 
 void safe_VkIndirectCommandsLayoutCreateInfoNVX::initialize(const VkIndirectCommandsLayoutCreateInfoNVX* in_struct)
@@ -16033,7 +19407,7 @@ void safe_VkIndirectCommandsLayoutCreateInfoNVX::initialize(const VkIndirectComm
     tokenCount = in_struct->tokenCount;
     pTokens = nullptr;
     if (in_struct->pTokens) {
-        pTokens = new VkIndirectCommandsLayoutTokenNVX[in_struct->tokenCount];
+        pTokens = vl_safe_new_array<VkIndirectCommandsLayoutTokenNVX>(in_struct->tokenCount);
         memcpy ((void *)pTokens, (void *)in_struct->pTokens, sizeof(VkIndirectCommandsLayoutTokenNVX)*in_struct->tokenCount);
     }
 }
@@ -16047,7 +19421,7 @@ void safe_VkIndirectCommandsLayoutCreateInfoNVX::initialize(const safe_VkIndirec
     tokenCount = src->tokenCount;
     pTokens = nullptr;
     if (src->pTokens) {
-        pTokens = new VkIndirectCommandsLayoutTokenNVX[src->tokenCount];
+        pTokens = vl_safe_new_array<VkIndirectCommandsLayoutTokenNVX>(src->tokenCount);
         memcpy ((void *)pTokens, (void *)src->pTokens, sizeof(VkIndirectCommandsLayoutTokenNVX)*src->tokenCount);
     }
 }
@@ -16067,10 +19441,8 @@ safe_VkCmdProcessCommandsInfoNVX::safe_VkCmdProcessCommandsInfoNVX(const VkCmdPr
     sequencesIndexOffset(in_struct->sequencesIndexOffset)
 {
     if (indirectCommandsTokenCount && in_struct->pIndirectCommandsTokens) {
-        pIndirectCommandsTokens = new VkIndirectCommandsTokenNVX[indirectCommandsTokenCount];
-        for (uint32_t i=0; i<indirectCommandsTokenCount; ++i) {
-            pIndirectCommandsTokens[i] = in_struct->pIndirectCommandsTokens[i];
-        }
+        pIndirectCommandsTokens = vl_safe_new_array<VkIndirectCommandsTokenNVX>(indirectCommandsTokenCount);
+        memcpy ((void *)pIndirectCommandsTokens, (void *)in_struct->pIndirectCommandsTokens, sizeof(VkIndirectCommandsTokenNVX)*indirectCommandsTokenCount);
     }
 }
 
@@ -16093,10 +19465,8 @@ safe_VkCmdProcessCommandsInfoNVX::safe_VkCmdProcessCommandsInfoNVX(const safe_Vk
     sequencesIndexBuffer = src.sequencesIndexBuffer;
     sequencesIndexOffset = src.sequencesIndexOffset;
     if (indirectCommandsTokenCount && src.pIndirectCommandsTokens) {
-        pIndirectCommandsTokens = new VkIndirectCommandsTokenNVX[indirectCommandsTokenCount];
-        for (uint32_t i=0; i<indirectCommandsTokenCount; ++i) {
-            pIndirectCommandsTokens[i] = src.pIndirectCommandsTokens[i];
-        }
+        pIndirectCommandsTokens = vl_safe_new_array<VkIndirectCommandsTokenNVX>(indirectCommandsTokenCount);
+        memcpy ((void *)pIndirectCommandsTokens, (void *)src.pIndirectCommandsTokens, sizeof(VkIndirectCommandsTokenNVX)*indirectCommandsTokenCount);
     }
 }
 
@@ -16105,7 +19475,7 @@ safe_VkCmdProcessCommandsInfoNVX& safe_VkCmdProcessCommandsInfoNVX::operator=(co
     if (&src == this) return *this;
 
     if (pIndirectCommandsTokens)
-        delete[] pIndirectCommandsTokens;
+        vl_safe_delete_array(pIndirectCommandsTokens);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -16120,19 +19490,34 @@ safe_VkCmdProcessCommandsInfoNVX& safe_VkCmdProcessCommandsInfoNVX::operator=(co
     sequencesIndexBuffer = src.sequencesIndexBuffer;
     sequencesIndexOffset = src.sequencesIndexOffset;
     if (indirectCommandsTokenCount && src.pIndirectCommandsTokens) {
-        pIndirectCommandsTokens = new VkIndirectCommandsTokenNVX[indirectCommandsTokenCount];
-        for (uint32_t i=0; i<indirectCommandsTokenCount; ++i) {
-            pIndirectCommandsTokens[i] = src.pIndirectCommandsTokens[i];
-        }
+        pIndirectCommandsTokens = vl_safe_new_array<VkIndirectCommandsTokenNVX>(indirectCommandsTokenCount);
+        memcpy ((void *)pIndirectCommandsTokens, (void *)src.pIndirectCommandsTokens, sizeof(VkIndirectCommandsTokenNVX)*indirectCommandsTokenCount);
     }
 
     return *this;
 }
 
+safe_VkCmdProcessCommandsInfoNVX::safe_VkCmdProcessCommandsInfoNVX(safe_VkCmdProcessCommandsInfoNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCmdProcessCommandsInfoNVX));
+    new (&src) safe_VkCmdProcessCommandsInfoNVX();
+}
+
+safe_VkCmdProcessCommandsInfoNVX& safe_VkCmdProcessCommandsInfoNVX::operator=(safe_VkCmdProcessCommandsInfoNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCmdProcessCommandsInfoNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCmdProcessCommandsInfoNVX));
+    new (&src) safe_VkCmdProcessCommandsInfoNVX();
+
+    return *this;
+}
+
 safe_VkCmdProcessCommandsInfoNVX::~safe_VkCmdProcessCommandsInfoNVX()
 {
     if (pIndirectCommandsTokens)
-        delete[] pIndirectCommandsTokens;
+        vl_safe_delete_array(pIndirectCommandsTokens);
 }
 
 void safe_VkCmdProcessCommandsInfoNVX::initialize(const VkCmdProcessCommandsInfoNVX* in_struct)
@@ -16150,10 +19535,8 @@ void safe_VkCmdProcessCommandsInfoNVX::initialize(const VkCmdProcessCommandsInfo
     sequencesIndexBuffer = in_struct->sequencesIndexBuffer;
     sequencesIndexOffset = in_struct->sequencesIndexOffset;
     if (indirectCommandsTokenCount && in_struct->pIndirectCommandsTokens) {
-        pIndirectCommandsTokens = new VkIndirectCommandsTokenNVX[indirectCommandsTokenCount];
-        for (uint32_t i=0; i<indirectCommandsTokenCount; ++i) {
-            pIndirectCommandsTokens[i] = in_struct->pIndirectCommandsTokens[i];
-        }
+        pIndirectCommandsTokens = vl_safe_new_array<VkIndirectCommandsTokenNVX>(indirectCommandsTokenCount);
+        memcpy ((void *)pIndirectCommandsTokens, (void *)in_struct->pIndirectCommandsTokens, sizeof(VkIndirectCommandsTokenNVX)*indirectCommandsTokenCount);
     }
 }
 
@@ -16172,10 +19555,8 @@ void safe_VkCmdProcessCommandsInfoNVX::initialize(const safe_VkCmdProcessCommand
     sequencesIndexBuffer = src->sequencesIndexBuffer;
     sequencesIndexOffset = src->sequencesIndexOffset;
     if (indirectCommandsTokenCount && src->pIndirectCommandsTokens) {
-        pIndirectCommandsTokens = new VkIndirectCommandsTokenNVX[indirectCommandsTokenCount];
-        for (uint32_t i=0; i<indirectCommandsTokenCount; ++i) {
-            pIndirectCommandsTokens[i] = src->pIndirectCommandsTokens[i];
-        }
+        pIndirectCommandsTokens = vl_safe_new_array<VkIndirectCommandsTokenNVX>(indirectCommandsTokenCount);
+        memcpy ((void *)pIndirectCommandsTokens, (void *)src->pIndirectCommandsTokens, sizeof(VkIndirectCommandsTokenNVX)*indirectCommandsTokenCount);
     }
 }
 
@@ -16214,6 +19595,23 @@ safe_VkCmdReserveSpaceForCommandsInfoNVX& safe_VkCmdReserveSpaceForCommandsInfoN
     return *this;
 }
 
+safe_VkCmdReserveSpaceForCommandsInfoNVX::safe_VkCmdReserveSpaceForCommandsInfoNVX(safe_VkCmdReserveSpaceForCommandsInfoNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCmdReserveSpaceForCommandsInfoNVX));
+    new (&src) safe_VkCmdReserveSpaceForCommandsInfoNVX();
+}
+
+safe_VkCmdReserveSpaceForCommandsInfoNVX& safe_VkCmdReserveSpaceForCommandsInfoNVX::operator=(safe_VkCmdReserveSpaceForCommandsInfoNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCmdReserveSpaceForCommandsInfoNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCmdReserveSpaceForCommandsInfoNVX));
+    new (&src) safe_VkCmdReserveSpaceForCommandsInfoNVX();
+
+    return *this;
+}
+
 safe_VkCmdReserveSpaceForCommandsInfoNVX::~safe_VkCmdReserveSpaceForCommandsInfoNVX()
 {
 }
@@ -16250,15 +19648,15 @@ safe_VkObjectTableCreateInfoNVX::safe_VkObjectTableCreateInfoNVX(const VkObjectT
     maxPipelineLayouts(in_struct->maxPipelineLayouts)
 {
     if (in_struct->pObjectEntryTypes) {
-        pObjectEntryTypes = new VkObjectEntryTypeNVX[in_struct->objectCount];
+        pObjectEntryTypes = vl_safe_new_array<VkObjectEntryTypeNVX>(in_struct->objectCount);
         memcpy ((void *)pObjectEntryTypes, (void *)in_struct->pObjectEntryTypes, sizeof(VkObjectEntryTypeNVX)*in_struct->objectCount);
     }
     if (in_struct->pObjectEntryCounts) {
-        pObjectEntryCounts = new uint32_t[in_struct->objectCount];
+        pObjectEntryCounts = vl_safe_new_array<uint32_t>(in_struct->objectCount);
         memcpy ((void *)pObjectEntryCounts, (void *)in_struct->pObjectEntryCounts, sizeof(uint32_t)*in_struct->objectCount);
     }
     if (in_struct->pObjectEntryUsageFlags) {
-        pObjectEntryUsageFlags = new VkObjectEntryUsageFlagsNVX[in_struct->objectCount];
+        pObjectEntryUsageFlags = vl_safe_new_array<VkObjectEntryUsageFlagsNVX>(in_struct->objectCount);
         memcpy ((void *)pObjectEntryUsageFlags, (void *)in_struct->pObjectEntryUsageFlags, sizeof(VkObjectEntryUsageFlagsNVX)*in_struct->objectCount);
     }
 }
@@ -16283,15 +19681,15 @@ safe_VkObjectTableCreateInfoNVX::safe_VkObjectTableCreateInfoNVX(const safe_VkOb
     maxSampledImagesPerDescriptor = src.maxSampledImagesPerDescriptor;
     maxPipelineLayouts = src.maxPipelineLayouts;
     if (src.pObjectEntryTypes) {
-        pObjectEntryTypes = new VkObjectEntryTypeNVX[src.objectCount];
+        pObjectEntryTypes = vl_safe_new_array<VkObjectEntryTypeNVX>(src.objectCount);
         memcpy ((void *)pObjectEntryTypes, (void *)src.pObjectEntryTypes, sizeof(VkObjectEntryTypeNVX)*src.objectCount);
     }
     if (src.pObjectEntryCounts) {
-        pObjectEntryCounts = new uint32_t[src.objectCount];
+        pObjectEntryCounts = vl_safe_new_array<uint32_t>(src.objectCount);
         memcpy ((void *)pObjectEntryCounts, (void *)src.pObjectEntryCounts, sizeof(uint32_t)*src.objectCount);
     }
     if (src.pObjectEntryUsageFlags) {
-        pObjectEntryUsageFlags = new VkObjectEntryUsageFlagsNVX[src.objectCount];
+        pObjectEntryUsageFlags = vl_safe_new_array<VkObjectEntryUsageFlagsNVX>(src.objectCount);
         memcpy ((void *)pObjectEntryUsageFlags, (void *)src.pObjectEntryUsageFlags, sizeof(VkObjectEntryUsageFlagsNVX)*src.objectCount);
     }
 }
@@ -16301,11 +19699,11 @@ safe_VkObjectTableCreateInfoNVX& safe_VkObjectTableCreateInfoNVX::operator=(cons
     if (&src == this) return *this;
 
     if (pObjectEntryTypes)
-        delete[] pObjectEntryTypes;
+        vl_safe_delete_array(pObjectEntryTypes);
     if (pObjectEntryCounts)
-        delete[] pObjectEntryCounts;
+        vl_safe_delete_array(pObjectEntryCounts);
     if (pObjectEntryUsageFlags)
-        delete[] pObjectEntryUsageFlags;
+        vl_safe_delete_array(pObjectEntryUsageFlags);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -16319,29 +19717,46 @@ safe_VkObjectTableCreateInfoNVX& safe_VkObjectTableCreateInfoNVX::operator=(cons
     maxSampledImagesPerDescriptor = src.maxSampledImagesPerDescriptor;
     maxPipelineLayouts = src.maxPipelineLayouts;
     if (src.pObjectEntryTypes) {
-        pObjectEntryTypes = new VkObjectEntryTypeNVX[src.objectCount];
+        pObjectEntryTypes = vl_safe_new_array<VkObjectEntryTypeNVX>(src.objectCount);
         memcpy ((void *)pObjectEntryTypes, (void *)src.pObjectEntryTypes, sizeof(VkObjectEntryTypeNVX)*src.objectCount);
     }
     if (src.pObjectEntryCounts) {
-        pObjectEntryCounts = new uint32_t[src.objectCount];
+        pObjectEntryCounts = vl_safe_new_array<uint32_t>(src.objectCount);
         memcpy ((void *)pObjectEntryCounts, (void *)src.pObjectEntryCounts, sizeof(uint32_t)*src.objectCount);
     }
     if (src.pObjectEntryUsageFlags) {
-        pObjectEntryUsageFlags = new VkObjectEntryUsageFlagsNVX[src.objectCount];
+        pObjectEntryUsageFlags = vl_safe_new_array<VkObjectEntryUsageFlagsNVX>(src.objectCount);
         memcpy ((void *)pObjectEntryUsageFlags, (void *)src.pObjectEntryUsageFlags, sizeof(VkObjectEntryUsageFlagsNVX)*src.objectCount);
     }
 
     return *this;
 }
 
+safe_VkObjectTableCreateInfoNVX::safe_VkObjectTableCreateInfoNVX(safe_VkObjectTableCreateInfoNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkObjectTableCreateInfoNVX));
+    new (&src) safe_VkObjectTableCreateInfoNVX();
+}
+
+safe_VkObjectTableCreateInfoNVX& safe_VkObjectTableCreateInfoNVX::operator=(safe_VkObjectTableCreateInfoNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkObjectTableCreateInfoNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkObjectTableCreateInfoNVX));
+    new (&src) safe_VkObjectTableCreateInfoNVX();
+
+    return *this;
+}
+
 safe_VkObjectTableCreateInfoNVX::~safe_VkObjectTableCreateInfoNVX()
 {
     if (pObjectEntryTypes)
-        delete[] pObjectEntryTypes;
+        vl_safe_delete_array(pObjectEntryTypes);
     if (pObjectEntryCounts)
-        delete[] pObjectEntryCounts;
+        vl_safe_delete_array(pObjectEntryCounts);
     if (pObjectEntryUsageFlags)
-        delete[] pObjectEntryUsageFlags;
+        vl_safe_delete_array(pObjectEntryUsageFlags);
 }
 
 void safe_VkObjectTableCreateInfoNVX::initialize(const VkObjectTableCreateInfoNVX* in_struct)
@@ -16358,15 +19773,15 @@ void safe_VkObjectTableCreateInfoNVX::initialize(const VkObjectTableCreateInfoNV
     maxSampledImagesPerDescriptor = in_struct->maxSampledImagesPerDescriptor;
     maxPipelineLayouts = in_struct->maxPipelineLayouts;
     if (in_struct->pObjectEntryTypes) {
-        pObjectEntryTypes = new VkObjectEntryTypeNVX[in_struct->objectCount];
+        pObjectEntryTypes = vl_safe_new_array<VkObjectEntryTypeNVX>(in_struct->objectCount);
         memcpy ((void *)pObjectEntryTypes, (void *)in_struct->pObjectEntryTypes, sizeof(VkObjectEntryTypeNVX)*in_struct->objectCount);
     }
     if (in_struct->pObjectEntryCounts) {
-        pObjectEntryCounts = new uint32_t[in_struct->objectCount];
+        pObjectEntryCounts = vl_safe_new_array<uint32_t>(in_struct->objectCount);
         memcpy ((void *)pObjectEntryCounts, (void *)in_struct->pObjectEntryCounts, sizeof(uint32_t)*in_struct->objectCount);
     }
     if (in_struct->pObjectEntryUsageFlags) {
-        pObjectEntryUsageFlags = new VkObjectEntryUsageFlagsNVX[in_struct->objectCount];
+        pObjectEntryUsageFlags = vl_safe_new_array<VkObjectEntryUsageFlagsNVX>(in_struct->objectCount);
         memcpy ((void *)pObjectEntryUsageFlags, (void *)in_struct->pObjectEntryUsageFlags, sizeof(VkObjectEntryUsageFlagsNVX)*in_struct->objectCount);
     }
 }
@@ -16385,15 +19800,15 @@ void safe_VkObjectTableCreateInfoNVX::initialize(const safe_VkObjectTableCreateI
     maxSampledImagesPerDescriptor = src->maxSampledImagesPerDescriptor;
     maxPipelineLayouts = src->maxPipelineLayouts;
     if (src->pObjectEntryTypes) {
-        pObjectEntryTypes = new VkObjectEntryTypeNVX[src->objectCount];
+        pObjectEntryTypes = vl_safe_new_array<VkObjectEntryTypeNVX>(src->objectCount);
         memcpy ((void *)pObjectEntryTypes, (void *)src->pObjectEntryTypes, sizeof(VkObjectEntryTypeNVX)*src->objectCount);
     }
     if (src->pObjectEntryCounts) {
-        pObjectEntryCounts = new uint32_t[src->objectCount];
+        pObjectEntryCounts = vl_safe_new_array<uint32_t>(src->objectCount);
         memcpy ((void *)pObjectEntryCounts, (void *)src->pObjectEntryCounts, sizeof(uint32_t)*src->objectCount);
     }
     if (src->pObjectEntryUsageFlags) {
-        pObjectEntryUsageFlags = new VkObjectEntryUsageFlagsNVX[src->objectCount];
+        pObjectEntryUsageFlags = vl_safe_new_array<VkObjectEntryUsageFlagsNVX>(src->objectCount);
         memcpy ((void *)pObjectEntryUsageFlags, (void *)src->pObjectEntryUsageFlags, sizeof(VkObjectEntryUsageFlagsNVX)*src->objectCount);
     }
 }
@@ -16406,7 +19821,7 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV::safe_VkPipelineViewportWScalin
     pViewportWScalings(nullptr)
 {
     if (in_struct->pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[in_struct->viewportCount];
+        pViewportWScalings = vl_safe_new_array<VkViewportWScalingNV>(in_struct->viewportCount);
         memcpy ((void *)pViewportWScalings, (void *)in_struct->pViewportWScalings, sizeof(VkViewportWScalingNV)*in_struct->viewportCount);
     }
 }
@@ -16423,7 +19838,7 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV::safe_VkPipelineViewportWScalin
     viewportCount = src.viewportCount;
     pViewportWScalings = nullptr;
     if (src.pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[src.viewportCount];
+        pViewportWScalings = vl_safe_new_array<VkViewportWScalingNV>(src.viewportCount);
         memcpy ((void *)pViewportWScalings, (void *)src.pViewportWScalings, sizeof(VkViewportWScalingNV)*src.viewportCount);
     }
 }
@@ -16433,7 +19848,7 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV& safe_VkPipelineViewportWScalin
     if (&src == this) return *this;
 
     if (pViewportWScalings)
-        delete[] pViewportWScalings;
+        vl_safe_delete_array(pViewportWScalings);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -16441,17 +19856,34 @@ safe_VkPipelineViewportWScalingStateCreateInfoNV& safe_VkPipelineViewportWScalin
     viewportCount = src.viewportCount;
     pViewportWScalings = nullptr;
     if (src.pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[src.viewportCount];
+        pViewportWScalings = vl_safe_new_array<VkViewportWScalingNV>(src.viewportCount);
         memcpy ((void *)pViewportWScalings, (void *)src.pViewportWScalings, sizeof(VkViewportWScalingNV)*src.viewportCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineViewportWScalingStateCreateInfoNV::safe_VkPipelineViewportWScalingStateCreateInfoNV(safe_VkPipelineViewportWScalingStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportWScalingStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportWScalingStateCreateInfoNV();
+}
+
+safe_VkPipelineViewportWScalingStateCreateInfoNV& safe_VkPipelineViewportWScalingStateCreateInfoNV::operator=(safe_VkPipelineViewportWScalingStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineViewportWScalingStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportWScalingStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportWScalingStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineViewportWScalingStateCreateInfoNV::~safe_VkPipelineViewportWScalingStateCreateInfoNV()
 {
     if (pViewportWScalings)
-        delete[] pViewportWScalings;
+        vl_safe_delete_array(pViewportWScalings);
 }
 
 void safe_VkPipelineViewportWScalingStateCreateInfoNV::initialize(const VkPipelineViewportWScalingStateCreateInfoNV* in_struct)
@@ -16462,7 +19894,7 @@ void safe_VkPipelineViewportWScalingStateCreateInfoNV::initialize(const VkPipeli
     viewportCount = in_struct->viewportCount;
     pViewportWScalings = nullptr;
     if (in_struct->pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[in_struct->viewportCount];
+        pViewportWScalings = vl_safe_new_array<VkViewportWScalingNV>(in_struct->viewportCount);
         memcpy ((void *)pViewportWScalings, (void *)in_struct->pViewportWScalings, sizeof(VkViewportWScalingNV)*in_struct->viewportCount);
     }
 }
@@ -16475,7 +19907,7 @@ void safe_VkPipelineViewportWScalingStateCreateInfoNV::initialize(const safe_VkP
     viewportCount = src->viewportCount;
     pViewportWScalings = nullptr;
     if (src->pViewportWScalings) {
-        pViewportWScalings = new VkViewportWScalingNV[src->viewportCount];
+        pViewportWScalings = vl_safe_new_array<VkViewportWScalingNV>(src->viewportCount);
         memcpy ((void *)pViewportWScalings, (void *)src->pViewportWScalings, sizeof(VkViewportWScalingNV)*src->viewportCount);
     }
 }
@@ -16539,6 +19971,23 @@ safe_VkSurfaceCapabilities2EXT& safe_VkSurfaceCapabilities2EXT::operator=(const
     return *this;
 }
 
+safe_VkSurfaceCapabilities2EXT::safe_VkSurfaceCapabilities2EXT(safe_VkSurfaceCapabilities2EXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceCapabilities2EXT));
+    new (&src) safe_VkSurfaceCapabilities2EXT();
+}
+
+safe_VkSurfaceCapabilities2EXT& safe_VkSurfaceCapabilities2EXT::operator=(safe_VkSurfaceCapabilities2EXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceCapabilities2EXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceCapabilities2EXT));
+    new (&src) safe_VkSurfaceCapabilities2EXT();
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilities2EXT::~safe_VkSurfaceCapabilities2EXT()
 {
 }
@@ -16606,6 +20055,23 @@ safe_VkDisplayPowerInfoEXT& safe_VkDisplayPowerInfoEXT::operator=(const safe_VkD
     return *this;
 }
 
+safe_VkDisplayPowerInfoEXT::safe_VkDisplayPowerInfoEXT(safe_VkDisplayPowerInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPowerInfoEXT));
+    new (&src) safe_VkDisplayPowerInfoEXT();
+}
+
+safe_VkDisplayPowerInfoEXT& safe_VkDisplayPowerInfoEXT::operator=(safe_VkDisplayPowerInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayPowerInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayPowerInfoEXT));
+    new (&src) safe_VkDisplayPowerInfoEXT();
+
+    return *this;
+}
+
 safe_VkDisplayPowerInfoEXT::~safe_VkDisplayPowerInfoEXT()
 {
 }
@@ -16653,6 +20119,23 @@ safe_VkDeviceEventInfoEXT& safe_VkDeviceEventInfoEXT::operator=(const safe_VkDev
     return *this;
 }
 
+safe_VkDeviceEventInfoEXT::safe_VkDeviceEventInfoEXT(safe_VkDeviceEventInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceEventInfoEXT));
+    new (&src) safe_VkDeviceEventInfoEXT();
+}
+
+safe_VkDeviceEventInfoEXT& safe_VkDeviceEventInfoEXT::operator=(safe_VkDeviceEventInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceEventInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceEventInfoEXT));
+    new (&src) safe_VkDeviceEventInfoEXT();
+
+    return *this;
+}
+
 safe_VkDeviceEventInfoEXT::~safe_VkDeviceEventInfoEXT()
 {
 }
@@ -16700,6 +20183,23 @@ safe_VkDisplayEventInfoEXT& safe_VkDisplayEventInfoEXT::operator=(const safe_VkD
     return *this;
 }
 
+safe_VkDisplayEventInfoEXT::safe_VkDisplayEventInfoEXT(safe_VkDisplayEventInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayEventInfoEXT));
+    new (&src) safe_VkDisplayEventInfoEXT();
+}
+
+safe_VkDisplayEventInfoEXT& safe_VkDisplayEventInfoEXT::operator=(safe_VkDisplayEventInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayEventInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayEventInfoEXT));
+    new (&src) safe_VkDisplayEventInfoEXT();
+
+    return *this;
+}
+
 safe_VkDisplayEventInfoEXT::~safe_VkDisplayEventInfoEXT()
 {
 }
@@ -16747,6 +20247,23 @@ safe_VkSwapchainCounterCreateInfoEXT& safe_VkSwapchainCounterCreateInfoEXT::oper
     return *this;
 }
 
+safe_VkSwapchainCounterCreateInfoEXT::safe_VkSwapchainCounterCreateInfoEXT(safe_VkSwapchainCounterCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSwapchainCounterCreateInfoEXT));
+    new (&src) safe_VkSwapchainCounterCreateInfoEXT();
+}
+
+safe_VkSwapchainCounterCreateInfoEXT& safe_VkSwapchainCounterCreateInfoEXT::operator=(safe_VkSwapchainCounterCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSwapchainCounterCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSwapchainCounterCreateInfoEXT));
+    new (&src) safe_VkSwapchainCounterCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkSwapchainCounterCreateInfoEXT::~safe_VkSwapchainCounterCreateInfoEXT()
 {
 }
@@ -16772,7 +20289,7 @@ safe_VkPresentTimesInfoGOOGLE::safe_VkPresentTimesInfoGOOGLE(const VkPresentTime
     pTimes(nullptr)
 {
     if (in_struct->pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[in_struct->swapchainCount];
+        pTimes = vl_safe_new_array<VkPresentTimeGOOGLE>(in_struct->swapchainCount);
         memcpy ((void *)pTimes, (void *)in_struct->pTimes, sizeof(VkPresentTimeGOOGLE)*in_struct->swapchainCount);
     }
 }
@@ -16788,7 +20305,7 @@ safe_VkPresentTimesInfoGOOGLE::safe_VkPresentTimesInfoGOOGLE(const safe_VkPresen
     swapchainCount = src.swapchainCount;
     pTimes = nullptr;
     if (src.pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[src.swapchainCount];
+        pTimes = vl_safe_new_array<VkPresentTimeGOOGLE>(src.swapchainCount);
         memcpy ((void *)pTimes, (void *)src.pTimes, sizeof(VkPresentTimeGOOGLE)*src.swapchainCount);
     }
 }
@@ -16798,24 +20315,41 @@ safe_VkPresentTimesInfoGOOGLE& safe_VkPresentTimesInfoGOOGLE::operator=(const sa
     if (&src == this) return *this;
 
     if (pTimes)
-        delete[] pTimes;
+        vl_safe_delete_array(pTimes);
 
     sType = src.sType;
     pNext = src.pNext;
     swapchainCount = src.swapchainCount;
     pTimes = nullptr;
     if (src.pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[src.swapchainCount];
+        pTimes = vl_safe_new_array<VkPresentTimeGOOGLE>(src.swapchainCount);
         memcpy ((void *)pTimes, (void *)src.pTimes, sizeof(VkPresentTimeGOOGLE)*src.swapchainCount);
     }
 
     return *this;
 }
 
+safe_VkPresentTimesInfoGOOGLE::safe_VkPresentTimesInfoGOOGLE(safe_VkPresentTimesInfoGOOGLE&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentTimesInfoGOOGLE));
+    new (&src) safe_VkPresentTimesInfoGOOGLE();
+}
+
+safe_VkPresentTimesInfoGOOGLE& safe_VkPresentTimesInfoGOOGLE::operator=(safe_VkPresentTimesInfoGOOGLE&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPresentTimesInfoGOOGLE();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentTimesInfoGOOGLE));
+    new (&src) safe_VkPresentTimesInfoGOOGLE();
+
+    return *this;
+}
+
 safe_VkPresentTimesInfoGOOGLE::~safe_VkPresentTimesInfoGOOGLE()
 {
     if (pTimes)
-        delete[] pTimes;
+        vl_safe_delete_array(pTimes);
 }
 
 void safe_VkPresentTimesInfoGOOGLE::initialize(const VkPresentTimesInfoGOOGLE* in_struct)
@@ -16825,7 +20359,7 @@ void safe_VkPresentTimesInfoGOOGLE::initialize(const VkPresentTimesInfoGOOGLE* i
     swapchainCount = in_struct->swapchainCount;
     pTimes = nullptr;
     if (in_struct->pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[in_struct->swapchainCount];
+        pTimes = vl_safe_new_array<VkPresentTimeGOOGLE>(in_struct->swapchainCount);
         memcpy ((void *)pTimes, (void *)in_struct->pTimes, sizeof(VkPresentTimeGOOGLE)*in_struct->swapchainCount);
     }
 }
@@ -16837,7 +20371,7 @@ void safe_VkPresentTimesInfoGOOGLE::initialize(const safe_VkPresentTimesInfoGOOG
     swapchainCount = src->swapchainCount;
     pTimes = nullptr;
     if (src->pTimes) {
-        pTimes = new VkPresentTimeGOOGLE[src->swapchainCount];
+        pTimes = vl_safe_new_array<VkPresentTimeGOOGLE>(src->swapchainCount);
         memcpy ((void *)pTimes, (void *)src->pTimes, sizeof(VkPresentTimeGOOGLE)*src->swapchainCount);
     }
 }
@@ -16871,6 +20405,23 @@ safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& safe_VkPhysicalDev
     return *this;
 }
 
+safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX));
+    new (&src) safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
+}
+
+safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::operator=(safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX));
+    new (&src) safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX::~safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX()
 {
 }
@@ -16897,7 +20448,7 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV::safe_VkPipelineViewportSwizzleS
     pViewportSwizzles(nullptr)
 {
     if (in_struct->pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[in_struct->viewportCount];
+        pViewportSwizzles = vl_safe_new_array<VkViewportSwizzleNV>(in_struct->viewportCount);
         memcpy ((void *)pViewportSwizzles, (void *)in_struct->pViewportSwizzles, sizeof(VkViewportSwizzleNV)*in_struct->viewportCount);
     }
 }
@@ -16914,7 +20465,7 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV::safe_VkPipelineViewportSwizzleS
     viewportCount = src.viewportCount;
     pViewportSwizzles = nullptr;
     if (src.pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[src.viewportCount];
+        pViewportSwizzles = vl_safe_new_array<VkViewportSwizzleNV>(src.viewportCount);
         memcpy ((void *)pViewportSwizzles, (void *)src.pViewportSwizzles, sizeof(VkViewportSwizzleNV)*src.viewportCount);
     }
 }
@@ -16924,7 +20475,7 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV& safe_VkPipelineViewportSwizzleS
     if (&src == this) return *this;
 
     if (pViewportSwizzles)
-        delete[] pViewportSwizzles;
+        vl_safe_delete_array(pViewportSwizzles);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -16932,17 +20483,34 @@ safe_VkPipelineViewportSwizzleStateCreateInfoNV& safe_VkPipelineViewportSwizzleS
     viewportCount = src.viewportCount;
     pViewportSwizzles = nullptr;
     if (src.pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[src.viewportCount];
+        pViewportSwizzles = vl_safe_new_array<VkViewportSwizzleNV>(src.viewportCount);
         memcpy ((void *)pViewportSwizzles, (void *)src.pViewportSwizzles, sizeof(VkViewportSwizzleNV)*src.viewportCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineViewportSwizzleStateCreateInfoNV::safe_VkPipelineViewportSwizzleStateCreateInfoNV(safe_VkPipelineViewportSwizzleStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportSwizzleStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportSwizzleStateCreateInfoNV();
+}
+
+safe_VkPipelineViewportSwizzleStateCreateInfoNV& safe_VkPipelineViewportSwizzleStateCreateInfoNV::operator=(safe_VkPipelineViewportSwizzleStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineViewportSwizzleStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportSwizzleStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportSwizzleStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineViewportSwizzleStateCreateInfoNV::~safe_VkPipelineViewportSwizzleStateCreateInfoNV()
 {
     if (pViewportSwizzles)
-        delete[] pViewportSwizzles;
+        vl_safe_delete_array(pViewportSwizzles);
 }
 
 void safe_VkPipelineViewportSwizzleStateCreateInfoNV::initialize(const VkPipelineViewportSwizzleStateCreateInfoNV* in_struct)
@@ -16953,7 +20521,7 @@ void safe_VkPipelineViewportSwizzleStateCreateInfoNV::initialize(const VkPipelin
     viewportCount = in_struct->viewportCount;
     pViewportSwizzles = nullptr;
     if (in_struct->pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[in_struct->viewportCount];
+        pViewportSwizzles = vl_safe_new_array<VkViewportSwizzleNV>(in_struct->viewportCount);
         memcpy ((void *)pViewportSwizzles, (void *)in_struct->pViewportSwizzles, sizeof(VkViewportSwizzleNV)*in_struct->viewportCount);
     }
 }
@@ -16966,7 +20534,7 @@ void safe_VkPipelineViewportSwizzleStateCreateInfoNV::initialize(const safe_VkPi
     viewportCount = src->viewportCount;
     pViewportSwizzles = nullptr;
     if (src->pViewportSwizzles) {
-        pViewportSwizzles = new VkViewportSwizzleNV[src->viewportCount];
+        pViewportSwizzles = vl_safe_new_array<VkViewportSwizzleNV>(src->viewportCount);
         memcpy ((void *)pViewportSwizzles, (void *)src->pViewportSwizzles, sizeof(VkViewportSwizzleNV)*src->viewportCount);
     }
 }
@@ -17000,6 +20568,23 @@ safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& safe_VkPhysicalDeviceDiscard
     return *this;
 }
 
+safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
+}
+
+safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::operator=(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT::~safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT()
 {
 }
@@ -17027,7 +20612,7 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT::safe_VkPipelineDiscardRectang
     pDiscardRectangles(nullptr)
 {
     if (in_struct->pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[in_struct->discardRectangleCount];
+        pDiscardRectangles = vl_safe_new_array<VkRect2D>(in_struct->discardRectangleCount);
         memcpy ((void *)pDiscardRectangles, (void *)in_struct->pDiscardRectangles, sizeof(VkRect2D)*in_struct->discardRectangleCount);
     }
 }
@@ -17045,7 +20630,7 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT::safe_VkPipelineDiscardRectang
     discardRectangleCount = src.discardRectangleCount;
     pDiscardRectangles = nullptr;
     if (src.pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[src.discardRectangleCount];
+        pDiscardRectangles = vl_safe_new_array<VkRect2D>(src.discardRectangleCount);
         memcpy ((void *)pDiscardRectangles, (void *)src.pDiscardRectangles, sizeof(VkRect2D)*src.discardRectangleCount);
     }
 }
@@ -17055,7 +20640,7 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT& safe_VkPipelineDiscardRectang
     if (&src == this) return *this;
 
     if (pDiscardRectangles)
-        delete[] pDiscardRectangles;
+        vl_safe_delete_array(pDiscardRectangles);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -17064,17 +20649,34 @@ safe_VkPipelineDiscardRectangleStateCreateInfoEXT& safe_VkPipelineDiscardRectang
     discardRectangleCount = src.discardRectangleCount;
     pDiscardRectangles = nullptr;
     if (src.pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[src.discardRectangleCount];
+        pDiscardRectangles = vl_safe_new_array<VkRect2D>(src.discardRectangleCount);
         memcpy ((void *)pDiscardRectangles, (void *)src.pDiscardRectangles, sizeof(VkRect2D)*src.discardRectangleCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineDiscardRectangleStateCreateInfoEXT::safe_VkPipelineDiscardRectangleStateCreateInfoEXT(safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineDiscardRectangleStateCreateInfoEXT));
+    new (&src) safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
+}
+
+safe_VkPipelineDiscardRectangleStateCreateInfoEXT& safe_VkPipelineDiscardRectangleStateCreateInfoEXT::operator=(safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineDiscardRectangleStateCreateInfoEXT));
+    new (&src) safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineDiscardRectangleStateCreateInfoEXT::~safe_VkPipelineDiscardRectangleStateCreateInfoEXT()
 {
     if (pDiscardRectangles)
-        delete[] pDiscardRectangles;
+        vl_safe_delete_array(pDiscardRectangles);
 }
 
 void safe_VkPipelineDiscardRectangleStateCreateInfoEXT::initialize(const VkPipelineDiscardRectangleStateCreateInfoEXT* in_struct)
@@ -17086,7 +20688,7 @@ void safe_VkPipelineDiscardRectangleStateCreateInfoEXT::initialize(const VkPipel
     discardRectangleCount = in_struct->discardRectangleCount;
     pDiscardRectangles = nullptr;
     if (in_struct->pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[in_struct->discardRectangleCount];
+        pDiscardRectangles = vl_safe_new_array<VkRect2D>(in_struct->discardRectangleCount);
         memcpy ((void *)pDiscardRectangles, (void *)in_struct->pDiscardRectangles, sizeof(VkRect2D)*in_struct->discardRectangleCount);
     }
 }
@@ -17100,7 +20702,7 @@ void safe_VkPipelineDiscardRectangleStateCreateInfoEXT::initialize(const safe_Vk
     discardRectangleCount = src->discardRectangleCount;
     pDiscardRectangles = nullptr;
     if (src->pDiscardRectangles) {
-        pDiscardRectangles = new VkRect2D[src->discardRectangleCount];
+        pDiscardRectangles = vl_safe_new_array<VkRect2D>(src->discardRectangleCount);
         memcpy ((void *)pDiscardRectangles, (void *)src->pDiscardRectangles, sizeof(VkRect2D)*src->discardRectangleCount);
     }
 }
@@ -17158,6 +20760,23 @@ safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& safe_VkPhysicalDevi
     return *this;
 }
 
+safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT::safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT::operator=(safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT::~safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT()
 {
 }
@@ -17227,6 +20846,23 @@ safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& safe_VkPipelineRaste
     return *this;
 }
 
+safe_VkPipelineRasterizationConservativeStateCreateInfoEXT::safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationConservativeStateCreateInfoEXT));
+    new (&src) safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
+}
+
+safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& safe_VkPipelineRasterizationConservativeStateCreateInfoEXT::operator=(safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationConservativeStateCreateInfoEXT));
+    new (&src) safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationConservativeStateCreateInfoEXT::~safe_VkPipelineRasterizationConservativeStateCreateInfoEXT()
 {
 }
@@ -17278,6 +20914,23 @@ safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& safe_VkPhysicalDeviceDepthClipE
     return *this;
 }
 
+safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::operator=(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT::~safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT()
 {
 }
@@ -17328,6 +20981,23 @@ safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& safe_VkPipelineRasteriz
     return *this;
 }
 
+safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT::safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT));
+    new (&src) safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
+}
+
+safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT::operator=(safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT));
+    new (&src) safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT::~safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT()
 {
 }
@@ -17398,6 +21068,23 @@ safe_VkHdrMetadataEXT& safe_VkHdrMetadataEXT::operator=(const safe_VkHdrMetadata
     return *this;
 }
 
+safe_VkHdrMetadataEXT::safe_VkHdrMetadataEXT(safe_VkHdrMetadataEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkHdrMetadataEXT));
+    new (&src) safe_VkHdrMetadataEXT();
+}
+
+safe_VkHdrMetadataEXT& safe_VkHdrMetadataEXT::operator=(safe_VkHdrMetadataEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkHdrMetadataEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkHdrMetadataEXT));
+    new (&src) safe_VkHdrMetadataEXT();
+
+    return *this;
+}
+
 safe_VkHdrMetadataEXT::~safe_VkHdrMetadataEXT()
 {
 }
@@ -17464,6 +21151,23 @@ safe_VkIOSSurfaceCreateInfoMVK& safe_VkIOSSurfaceCreateInfoMVK::operator=(const
     return *this;
 }
 
+safe_VkIOSSurfaceCreateInfoMVK::safe_VkIOSSurfaceCreateInfoMVK(safe_VkIOSSurfaceCreateInfoMVK&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkIOSSurfaceCreateInfoMVK));
+    new (&src) safe_VkIOSSurfaceCreateInfoMVK();
+}
+
+safe_VkIOSSurfaceCreateInfoMVK& safe_VkIOSSurfaceCreateInfoMVK::operator=(safe_VkIOSSurfaceCreateInfoMVK&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkIOSSurfaceCreateInfoMVK();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkIOSSurfaceCreateInfoMVK));
+    new (&src) safe_VkIOSSurfaceCreateInfoMVK();
+
+    return *this;
+}
+
 safe_VkIOSSurfaceCreateInfoMVK::~safe_VkIOSSurfaceCreateInfoMVK()
 {
 }
@@ -17520,6 +21224,23 @@ safe_VkMacOSSurfaceCreateInfoMVK& safe_VkMacOSSurfaceCreateInfoMVK::operator=(co
     return *this;
 }
 
+safe_VkMacOSSurfaceCreateInfoMVK::safe_VkMacOSSurfaceCreateInfoMVK(safe_VkMacOSSurfaceCreateInfoMVK&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMacOSSurfaceCreateInfoMVK));
+    new (&src) safe_VkMacOSSurfaceCreateInfoMVK();
+}
+
+safe_VkMacOSSurfaceCreateInfoMVK& safe_VkMacOSSurfaceCreateInfoMVK::operator=(safe_VkMacOSSurfaceCreateInfoMVK&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMacOSSurfaceCreateInfoMVK();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMacOSSurfaceCreateInfoMVK));
+    new (&src) safe_VkMacOSSurfaceCreateInfoMVK();
+
+    return *this;
+}
+
 safe_VkMacOSSurfaceCreateInfoMVK::~safe_VkMacOSSurfaceCreateInfoMVK()
 {
 }
@@ -17577,6 +21298,23 @@ safe_VkDebugUtilsObjectNameInfoEXT& safe_VkDebugUtilsObjectNameInfoEXT::operator
     return *this;
 }
 
+safe_VkDebugUtilsObjectNameInfoEXT::safe_VkDebugUtilsObjectNameInfoEXT(safe_VkDebugUtilsObjectNameInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsObjectNameInfoEXT));
+    new (&src) safe_VkDebugUtilsObjectNameInfoEXT();
+}
+
+safe_VkDebugUtilsObjectNameInfoEXT& safe_VkDebugUtilsObjectNameInfoEXT::operator=(safe_VkDebugUtilsObjectNameInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugUtilsObjectNameInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsObjectNameInfoEXT));
+    new (&src) safe_VkDebugUtilsObjectNameInfoEXT();
+
+    return *this;
+}
+
 safe_VkDebugUtilsObjectNameInfoEXT::~safe_VkDebugUtilsObjectNameInfoEXT()
 {
 }
@@ -17640,6 +21378,23 @@ safe_VkDebugUtilsObjectTagInfoEXT& safe_VkDebugUtilsObjectTagInfoEXT::operator=(
     return *this;
 }
 
+safe_VkDebugUtilsObjectTagInfoEXT::safe_VkDebugUtilsObjectTagInfoEXT(safe_VkDebugUtilsObjectTagInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsObjectTagInfoEXT));
+    new (&src) safe_VkDebugUtilsObjectTagInfoEXT();
+}
+
+safe_VkDebugUtilsObjectTagInfoEXT& safe_VkDebugUtilsObjectTagInfoEXT::operator=(safe_VkDebugUtilsObjectTagInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugUtilsObjectTagInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsObjectTagInfoEXT));
+    new (&src) safe_VkDebugUtilsObjectTagInfoEXT();
+
+    return *this;
+}
+
 safe_VkDebugUtilsObjectTagInfoEXT::~safe_VkDebugUtilsObjectTagInfoEXT()
 {
 }
@@ -17671,9 +21426,7 @@ safe_VkDebugUtilsLabelEXT::safe_VkDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT*
     pNext(in_struct->pNext),
     pLabelName(in_struct->pLabelName)
 {
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = in_struct->color[i];
-    }
+    memcpy (color, in_struct->color, sizeof(color));
 }
 
 safe_VkDebugUtilsLabelEXT::safe_VkDebugUtilsLabelEXT()
@@ -17684,9 +21437,7 @@ safe_VkDebugUtilsLabelEXT::safe_VkDebugUtilsLabelEXT(const safe_VkDebugUtilsLabe
     sType = src.sType;
     pNext = src.pNext;
     pLabelName = src.pLabelName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = src.color[i];
-    }
+    memcpy (color, src.color, sizeof(color));
 }
 
 safe_VkDebugUtilsLabelEXT& safe_VkDebugUtilsLabelEXT::operator=(const safe_VkDebugUtilsLabelEXT& src)
@@ -17697,9 +21448,24 @@ safe_VkDebugUtilsLabelEXT& safe_VkDebugUtilsLabelEXT::operator=(const safe_VkDeb
     sType = src.sType;
     pNext = src.pNext;
     pLabelName = src.pLabelName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = src.color[i];
-    }
+    memcpy (color, src.color, sizeof(color));
+
+    return *this;
+}
+
+safe_VkDebugUtilsLabelEXT::safe_VkDebugUtilsLabelEXT(safe_VkDebugUtilsLabelEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsLabelEXT));
+    new (&src) safe_VkDebugUtilsLabelEXT();
+}
+
+safe_VkDebugUtilsLabelEXT& safe_VkDebugUtilsLabelEXT::operator=(safe_VkDebugUtilsLabelEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugUtilsLabelEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsLabelEXT));
+    new (&src) safe_VkDebugUtilsLabelEXT();
 
     return *this;
 }
@@ -17713,9 +21479,7 @@ void safe_VkDebugUtilsLabelEXT::initialize(const VkDebugUtilsLabelEXT* in_struct
     sType = in_struct->sType;
     pNext = in_struct->pNext;
     pLabelName = in_struct->pLabelName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = in_struct->color[i];
-    }
+    memcpy (color, in_struct->color, sizeof(color));
 }
 
 void safe_VkDebugUtilsLabelEXT::initialize(const safe_VkDebugUtilsLabelEXT* src)
@@ -17723,9 +21487,7 @@ void safe_VkDebugUtilsLabelEXT::initialize(const safe_VkDebugUtilsLabelEXT* src)
     sType = src->sType;
     pNext = src->pNext;
     pLabelName = src->pLabelName;
-    for (uint32_t i=0; i<4; ++i) {
-        color[i] = src->color[i];
-    }
+    memcpy (color, src->color, sizeof(color));
 }
 
 safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDataEXT(const VkDebugUtilsMessengerCallbackDataEXT* in_struct) :
@@ -17743,19 +21505,19 @@ safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDat
     pObjects(nullptr)
 {
     if (queueLabelCount && in_struct->pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(queueLabelCount);
         for (uint32_t i=0; i<queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&in_struct->pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && in_struct->pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(cmdBufLabelCount);
         for (uint32_t i=0; i<cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&in_struct->pCmdBufLabels[i]);
         }
     }
     if (objectCount && in_struct->pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = vl_safe_new_array<safe_VkDebugUtilsObjectNameInfoEXT>(objectCount);
         for (uint32_t i=0; i<objectCount; ++i) {
             pObjects[i].initialize(&in_struct->pObjects[i]);
         }
@@ -17783,19 +21545,19 @@ safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDat
     objectCount = src.objectCount;
     pObjects = nullptr;
     if (queueLabelCount && src.pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(queueLabelCount);
         for (uint32_t i=0; i<queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&src.pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && src.pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(cmdBufLabelCount);
         for (uint32_t i=0; i<cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&src.pCmdBufLabels[i]);
         }
     }
     if (objectCount && src.pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = vl_safe_new_array<safe_VkDebugUtilsObjectNameInfoEXT>(objectCount);
         for (uint32_t i=0; i<objectCount; ++i) {
             pObjects[i].initialize(&src.pObjects[i]);
         }
@@ -17807,11 +21569,11 @@ safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDat
     if (&src == this) return *this;
 
     if (pQueueLabels)
-        delete[] pQueueLabels;
+        vl_safe_delete_array(pQueueLabels);
     if (pCmdBufLabels)
-        delete[] pCmdBufLabels;
+        vl_safe_delete_array(pCmdBufLabels);
     if (pObjects)
-        delete[] pObjects;
+        vl_safe_delete_array(pObjects);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -17826,19 +21588,19 @@ safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDat
     objectCount = src.objectCount;
     pObjects = nullptr;
     if (queueLabelCount && src.pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(queueLabelCount);
         for (uint32_t i=0; i<queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&src.pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && src.pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(cmdBufLabelCount);
         for (uint32_t i=0; i<cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&src.pCmdBufLabels[i]);
         }
     }
     if (objectCount && src.pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = vl_safe_new_array<safe_VkDebugUtilsObjectNameInfoEXT>(objectCount);
         for (uint32_t i=0; i<objectCount; ++i) {
             pObjects[i].initialize(&src.pObjects[i]);
         }
@@ -17847,14 +21609,31 @@ safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDat
     return *this;
 }
 
+safe_VkDebugUtilsMessengerCallbackDataEXT::safe_VkDebugUtilsMessengerCallbackDataEXT(safe_VkDebugUtilsMessengerCallbackDataEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsMessengerCallbackDataEXT));
+    new (&src) safe_VkDebugUtilsMessengerCallbackDataEXT();
+}
+
+safe_VkDebugUtilsMessengerCallbackDataEXT& safe_VkDebugUtilsMessengerCallbackDataEXT::operator=(safe_VkDebugUtilsMessengerCallbackDataEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugUtilsMessengerCallbackDataEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsMessengerCallbackDataEXT));
+    new (&src) safe_VkDebugUtilsMessengerCallbackDataEXT();
+
+    return *this;
+}
+
 safe_VkDebugUtilsMessengerCallbackDataEXT::~safe_VkDebugUtilsMessengerCallbackDataEXT()
 {
     if (pQueueLabels)
-        delete[] pQueueLabels;
+        vl_safe_delete_array(pQueueLabels);
     if (pCmdBufLabels)
-        delete[] pCmdBufLabels;
+        vl_safe_delete_array(pCmdBufLabels);
     if (pObjects)
-        delete[] pObjects;
+        vl_safe_delete_array(pObjects);
 }
 
 void safe_VkDebugUtilsMessengerCallbackDataEXT::initialize(const VkDebugUtilsMessengerCallbackDataEXT* in_struct)
@@ -17872,19 +21651,19 @@ void safe_VkDebugUtilsMessengerCallbackDataEXT::initialize(const VkDebugUtilsMes
     objectCount = in_struct->objectCount;
     pObjects = nullptr;
     if (queueLabelCount && in_struct->pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(queueLabelCount);
         for (uint32_t i=0; i<queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&in_struct->pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && in_struct->pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(cmdBufLabelCount);
         for (uint32_t i=0; i<cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&in_struct->pCmdBufLabels[i]);
         }
     }
     if (objectCount && in_struct->pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = vl_safe_new_array<safe_VkDebugUtilsObjectNameInfoEXT>(objectCount);
         for (uint32_t i=0; i<objectCount; ++i) {
             pObjects[i].initialize(&in_struct->pObjects[i]);
         }
@@ -17906,19 +21685,19 @@ void safe_VkDebugUtilsMessengerCallbackDataEXT::initialize(const safe_VkDebugUti
     objectCount = src->objectCount;
     pObjects = nullptr;
     if (queueLabelCount && src->pQueueLabels) {
-        pQueueLabels = new safe_VkDebugUtilsLabelEXT[queueLabelCount];
+        pQueueLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(queueLabelCount);
         for (uint32_t i=0; i<queueLabelCount; ++i) {
             pQueueLabels[i].initialize(&src->pQueueLabels[i]);
         }
     }
     if (cmdBufLabelCount && src->pCmdBufLabels) {
-        pCmdBufLabels = new safe_VkDebugUtilsLabelEXT[cmdBufLabelCount];
+        pCmdBufLabels = vl_safe_new_array<safe_VkDebugUtilsLabelEXT>(cmdBufLabelCount);
         for (uint32_t i=0; i<cmdBufLabelCount; ++i) {
             pCmdBufLabels[i].initialize(&src->pCmdBufLabels[i]);
         }
     }
     if (objectCount && src->pObjects) {
-        pObjects = new safe_VkDebugUtilsObjectNameInfoEXT[objectCount];
+        pObjects = vl_safe_new_array<safe_VkDebugUtilsObjectNameInfoEXT>(objectCount);
         for (uint32_t i=0; i<objectCount; ++i) {
             pObjects[i].initialize(&src->pObjects[i]);
         }
@@ -17966,6 +21745,23 @@ safe_VkDebugUtilsMessengerCreateInfoEXT& safe_VkDebugUtilsMessengerCreateInfoEXT
     return *this;
 }
 
+safe_VkDebugUtilsMessengerCreateInfoEXT::safe_VkDebugUtilsMessengerCreateInfoEXT(safe_VkDebugUtilsMessengerCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsMessengerCreateInfoEXT));
+    new (&src) safe_VkDebugUtilsMessengerCreateInfoEXT();
+}
+
+safe_VkDebugUtilsMessengerCreateInfoEXT& safe_VkDebugUtilsMessengerCreateInfoEXT::operator=(safe_VkDebugUtilsMessengerCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDebugUtilsMessengerCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDebugUtilsMessengerCreateInfoEXT));
+    new (&src) safe_VkDebugUtilsMessengerCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkDebugUtilsMessengerCreateInfoEXT::~safe_VkDebugUtilsMessengerCreateInfoEXT()
 {
 }
@@ -18023,6 +21819,23 @@ safe_VkAndroidHardwareBufferUsageANDROID& safe_VkAndroidHardwareBufferUsageANDRO
     return *this;
 }
 
+safe_VkAndroidHardwareBufferUsageANDROID::safe_VkAndroidHardwareBufferUsageANDROID(safe_VkAndroidHardwareBufferUsageANDROID&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAndroidHardwareBufferUsageANDROID));
+    new (&src) safe_VkAndroidHardwareBufferUsageANDROID();
+}
+
+safe_VkAndroidHardwareBufferUsageANDROID& safe_VkAndroidHardwareBufferUsageANDROID::operator=(safe_VkAndroidHardwareBufferUsageANDROID&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAndroidHardwareBufferUsageANDROID();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAndroidHardwareBufferUsageANDROID));
+    new (&src) safe_VkAndroidHardwareBufferUsageANDROID();
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferUsageANDROID::~safe_VkAndroidHardwareBufferUsageANDROID()
 {
 }
@@ -18077,6 +21890,23 @@ safe_VkAndroidHardwareBufferPropertiesANDROID& safe_VkAndroidHardwareBufferPrope
     return *this;
 }
 
+safe_VkAndroidHardwareBufferPropertiesANDROID::safe_VkAndroidHardwareBufferPropertiesANDROID(safe_VkAndroidHardwareBufferPropertiesANDROID&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAndroidHardwareBufferPropertiesANDROID));
+    new (&src) safe_VkAndroidHardwareBufferPropertiesANDROID();
+}
+
+safe_VkAndroidHardwareBufferPropertiesANDROID& safe_VkAndroidHardwareBufferPropertiesANDROID::operator=(safe_VkAndroidHardwareBufferPropertiesANDROID&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAndroidHardwareBufferPropertiesANDROID();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAndroidHardwareBufferPropertiesANDROID));
+    new (&src) safe_VkAndroidHardwareBufferPropertiesANDROID();
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferPropertiesANDROID::~safe_VkAndroidHardwareBufferPropertiesANDROID()
 {
 }
@@ -18151,6 +21981,23 @@ safe_VkAndroidHardwareBufferFormatPropertiesANDROID& safe_VkAndroidHardwareBuffe
     return *this;
 }
 
+safe_VkAndroidHardwareBufferFormatPropertiesANDROID::safe_VkAndroidHardwareBufferFormatPropertiesANDROID(safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAndroidHardwareBufferFormatPropertiesANDROID));
+    new (&src) safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
+}
+
+safe_VkAndroidHardwareBufferFormatPropertiesANDROID& safe_VkAndroidHardwareBufferFormatPropertiesANDROID::operator=(safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAndroidHardwareBufferFormatPropertiesANDROID));
+    new (&src) safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
+
+    return *this;
+}
+
 safe_VkAndroidHardwareBufferFormatPropertiesANDROID::~safe_VkAndroidHardwareBufferFormatPropertiesANDROID()
 {
 }
@@ -18218,6 +22065,23 @@ safe_VkImportAndroidHardwareBufferInfoANDROID& safe_VkImportAndroidHardwareBuffe
     return *this;
 }
 
+safe_VkImportAndroidHardwareBufferInfoANDROID::safe_VkImportAndroidHardwareBufferInfoANDROID(safe_VkImportAndroidHardwareBufferInfoANDROID&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportAndroidHardwareBufferInfoANDROID));
+    new (&src) safe_VkImportAndroidHardwareBufferInfoANDROID();
+}
+
+safe_VkImportAndroidHardwareBufferInfoANDROID& safe_VkImportAndroidHardwareBufferInfoANDROID::operator=(safe_VkImportAndroidHardwareBufferInfoANDROID&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportAndroidHardwareBufferInfoANDROID();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportAndroidHardwareBufferInfoANDROID));
+    new (&src) safe_VkImportAndroidHardwareBufferInfoANDROID();
+
+    return *this;
+}
+
 safe_VkImportAndroidHardwareBufferInfoANDROID::~safe_VkImportAndroidHardwareBufferInfoANDROID()
 {
 }
@@ -18269,6 +22133,23 @@ safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& safe_VkMemoryGetAndroidHardwar
     return *this;
 }
 
+safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID));
+    new (&src) safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
+}
+
+safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::operator=(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID));
+    new (&src) safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
+
+    return *this;
+}
+
 safe_VkMemoryGetAndroidHardwareBufferInfoANDROID::~safe_VkMemoryGetAndroidHardwareBufferInfoANDROID()
 {
 }
@@ -18320,6 +22201,23 @@ safe_VkExternalFormatANDROID& safe_VkExternalFormatANDROID::operator=(const safe
     return *this;
 }
 
+safe_VkExternalFormatANDROID::safe_VkExternalFormatANDROID(safe_VkExternalFormatANDROID&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalFormatANDROID));
+    new (&src) safe_VkExternalFormatANDROID();
+}
+
+safe_VkExternalFormatANDROID& safe_VkExternalFormatANDROID::operator=(safe_VkExternalFormatANDROID&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkExternalFormatANDROID();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkExternalFormatANDROID));
+    new (&src) safe_VkExternalFormatANDROID();
+
+    return *this;
+}
+
 safe_VkExternalFormatANDROID::~safe_VkExternalFormatANDROID()
 {
 }
@@ -18369,6 +22267,23 @@ safe_VkSamplerReductionModeCreateInfoEXT& safe_VkSamplerReductionModeCreateInfoE
     return *this;
 }
 
+safe_VkSamplerReductionModeCreateInfoEXT::safe_VkSamplerReductionModeCreateInfoEXT(safe_VkSamplerReductionModeCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerReductionModeCreateInfoEXT));
+    new (&src) safe_VkSamplerReductionModeCreateInfoEXT();
+}
+
+safe_VkSamplerReductionModeCreateInfoEXT& safe_VkSamplerReductionModeCreateInfoEXT::operator=(safe_VkSamplerReductionModeCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSamplerReductionModeCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSamplerReductionModeCreateInfoEXT));
+    new (&src) safe_VkSamplerReductionModeCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkSamplerReductionModeCreateInfoEXT::~safe_VkSamplerReductionModeCreateInfoEXT()
 {
 }
@@ -18419,6 +22334,23 @@ safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT& safe_VkPhysicalDeviceSamp
     return *this;
 }
 
+safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT::safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT& safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT::operator=(safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT::~safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT()
 {
 }
@@ -18471,6 +22403,23 @@ safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& safe_VkPhysicalDeviceInlineU
     return *this;
 }
 
+safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT::safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT(safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT::operator=(safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT::~safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT()
 {
 }
@@ -18532,6 +22481,23 @@ safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& safe_VkPhysicalDeviceInlin
     return *this;
 }
 
+safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT::safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT(safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT::operator=(safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT::~safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT()
 {
 }
@@ -18590,6 +22556,23 @@ safe_VkWriteDescriptorSetInlineUniformBlockEXT& safe_VkWriteDescriptorSetInlineU
     return *this;
 }
 
+safe_VkWriteDescriptorSetInlineUniformBlockEXT::safe_VkWriteDescriptorSetInlineUniformBlockEXT(safe_VkWriteDescriptorSetInlineUniformBlockEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWriteDescriptorSetInlineUniformBlockEXT));
+    new (&src) safe_VkWriteDescriptorSetInlineUniformBlockEXT();
+}
+
+safe_VkWriteDescriptorSetInlineUniformBlockEXT& safe_VkWriteDescriptorSetInlineUniformBlockEXT::operator=(safe_VkWriteDescriptorSetInlineUniformBlockEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkWriteDescriptorSetInlineUniformBlockEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWriteDescriptorSetInlineUniformBlockEXT));
+    new (&src) safe_VkWriteDescriptorSetInlineUniformBlockEXT();
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSetInlineUniformBlockEXT::~safe_VkWriteDescriptorSetInlineUniformBlockEXT()
 {
 }
@@ -18639,6 +22622,23 @@ safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& safe_VkDescriptorPoolInlin
     return *this;
 }
 
+safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT::safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT(safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT));
+    new (&src) safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT();
+}
+
+safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT::operator=(safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT));
+    new (&src) safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT::~safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT()
 {
 }
@@ -18666,7 +22666,7 @@ safe_VkSampleLocationsInfoEXT::safe_VkSampleLocationsInfoEXT(const VkSampleLocat
     pSampleLocations(nullptr)
 {
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[in_struct->sampleLocationsCount];
+        pSampleLocations = vl_safe_new_array<VkSampleLocationEXT>(in_struct->sampleLocationsCount);
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkSampleLocationEXT)*in_struct->sampleLocationsCount);
     }
 }
@@ -18684,7 +22684,7 @@ safe_VkSampleLocationsInfoEXT::safe_VkSampleLocationsInfoEXT(const safe_VkSample
     sampleLocationsCount = src.sampleLocationsCount;
     pSampleLocations = nullptr;
     if (src.pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[src.sampleLocationsCount];
+        pSampleLocations = vl_safe_new_array<VkSampleLocationEXT>(src.sampleLocationsCount);
         memcpy ((void *)pSampleLocations, (void *)src.pSampleLocations, sizeof(VkSampleLocationEXT)*src.sampleLocationsCount);
     }
 }
@@ -18694,7 +22694,7 @@ safe_VkSampleLocationsInfoEXT& safe_VkSampleLocationsInfoEXT::operator=(const sa
     if (&src == this) return *this;
 
     if (pSampleLocations)
-        delete[] pSampleLocations;
+        vl_safe_delete_array(pSampleLocations);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -18703,17 +22703,34 @@ safe_VkSampleLocationsInfoEXT& safe_VkSampleLocationsInfoEXT::operator=(const sa
     sampleLocationsCount = src.sampleLocationsCount;
     pSampleLocations = nullptr;
     if (src.pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[src.sampleLocationsCount];
+        pSampleLocations = vl_safe_new_array<VkSampleLocationEXT>(src.sampleLocationsCount);
         memcpy ((void *)pSampleLocations, (void *)src.pSampleLocations, sizeof(VkSampleLocationEXT)*src.sampleLocationsCount);
     }
 
     return *this;
 }
 
+safe_VkSampleLocationsInfoEXT::safe_VkSampleLocationsInfoEXT(safe_VkSampleLocationsInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSampleLocationsInfoEXT));
+    new (&src) safe_VkSampleLocationsInfoEXT();
+}
+
+safe_VkSampleLocationsInfoEXT& safe_VkSampleLocationsInfoEXT::operator=(safe_VkSampleLocationsInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSampleLocationsInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSampleLocationsInfoEXT));
+    new (&src) safe_VkSampleLocationsInfoEXT();
+
+    return *this;
+}
+
 safe_VkSampleLocationsInfoEXT::~safe_VkSampleLocationsInfoEXT()
 {
     if (pSampleLocations)
-        delete[] pSampleLocations;
+        vl_safe_delete_array(pSampleLocations);
 }
 
 void safe_VkSampleLocationsInfoEXT::initialize(const VkSampleLocationsInfoEXT* in_struct)
@@ -18725,7 +22742,7 @@ void safe_VkSampleLocationsInfoEXT::initialize(const VkSampleLocationsInfoEXT* i
     sampleLocationsCount = in_struct->sampleLocationsCount;
     pSampleLocations = nullptr;
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[in_struct->sampleLocationsCount];
+        pSampleLocations = vl_safe_new_array<VkSampleLocationEXT>(in_struct->sampleLocationsCount);
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkSampleLocationEXT)*in_struct->sampleLocationsCount);
     }
 }
@@ -18739,7 +22756,7 @@ void safe_VkSampleLocationsInfoEXT::initialize(const safe_VkSampleLocationsInfoE
     sampleLocationsCount = src->sampleLocationsCount;
     pSampleLocations = nullptr;
     if (src->pSampleLocations) {
-        pSampleLocations = new VkSampleLocationEXT[src->sampleLocationsCount];
+        pSampleLocations = vl_safe_new_array<VkSampleLocationEXT>(src->sampleLocationsCount);
         memcpy ((void *)pSampleLocations, (void *)src->pSampleLocations, sizeof(VkSampleLocationEXT)*src->sampleLocationsCount);
     }
 }
@@ -18753,11 +22770,11 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT::safe_VkRenderPassSampleLocationsBe
     pPostSubpassSampleLocations(nullptr)
 {
     if (in_struct->pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[in_struct->attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = vl_safe_new_array<VkAttachmentSampleLocationsEXT>(in_struct->attachmentInitialSampleLocationsCount);
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)in_struct->pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*in_struct->attachmentInitialSampleLocationsCount);
     }
     if (in_struct->pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[in_struct->postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = vl_safe_new_array<VkSubpassSampleLocationsEXT>(in_struct->postSubpassSampleLocationsCount);
         memcpy ((void *)pPostSubpassSampleLocations, (void *)in_struct->pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*in_struct->postSubpassSampleLocationsCount);
     }
 }
@@ -18776,11 +22793,11 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT::safe_VkRenderPassSampleLocationsBe
     postSubpassSampleLocationsCount = src.postSubpassSampleLocationsCount;
     pPostSubpassSampleLocations = nullptr;
     if (src.pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[src.attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = vl_safe_new_array<VkAttachmentSampleLocationsEXT>(src.attachmentInitialSampleLocationsCount);
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)src.pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*src.attachmentInitialSampleLocationsCount);
     }
     if (src.pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[src.postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = vl_safe_new_array<VkSubpassSampleLocationsEXT>(src.postSubpassSampleLocationsCount);
         memcpy ((void *)pPostSubpassSampleLocations, (void *)src.pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*src.postSubpassSampleLocationsCount);
     }
 }
@@ -18790,9 +22807,9 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT& safe_VkRenderPassSampleLocationsBe
     if (&src == this) return *this;
 
     if (pAttachmentInitialSampleLocations)
-        delete[] pAttachmentInitialSampleLocations;
+        vl_safe_delete_array(pAttachmentInitialSampleLocations);
     if (pPostSubpassSampleLocations)
-        delete[] pPostSubpassSampleLocations;
+        vl_safe_delete_array(pPostSubpassSampleLocations);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -18801,23 +22818,40 @@ safe_VkRenderPassSampleLocationsBeginInfoEXT& safe_VkRenderPassSampleLocationsBe
     postSubpassSampleLocationsCount = src.postSubpassSampleLocationsCount;
     pPostSubpassSampleLocations = nullptr;
     if (src.pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[src.attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = vl_safe_new_array<VkAttachmentSampleLocationsEXT>(src.attachmentInitialSampleLocationsCount);
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)src.pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*src.attachmentInitialSampleLocationsCount);
     }
     if (src.pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[src.postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = vl_safe_new_array<VkSubpassSampleLocationsEXT>(src.postSubpassSampleLocationsCount);
         memcpy ((void *)pPostSubpassSampleLocations, (void *)src.pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*src.postSubpassSampleLocationsCount);
     }
 
     return *this;
 }
 
+safe_VkRenderPassSampleLocationsBeginInfoEXT::safe_VkRenderPassSampleLocationsBeginInfoEXT(safe_VkRenderPassSampleLocationsBeginInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassSampleLocationsBeginInfoEXT));
+    new (&src) safe_VkRenderPassSampleLocationsBeginInfoEXT();
+}
+
+safe_VkRenderPassSampleLocationsBeginInfoEXT& safe_VkRenderPassSampleLocationsBeginInfoEXT::operator=(safe_VkRenderPassSampleLocationsBeginInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassSampleLocationsBeginInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassSampleLocationsBeginInfoEXT));
+    new (&src) safe_VkRenderPassSampleLocationsBeginInfoEXT();
+
+    return *this;
+}
+
 safe_VkRenderPassSampleLocationsBeginInfoEXT::~safe_VkRenderPassSampleLocationsBeginInfoEXT()
 {
     if (pAttachmentInitialSampleLocations)
-        delete[] pAttachmentInitialSampleLocations;
+        vl_safe_delete_array(pAttachmentInitialSampleLocations);
     if (pPostSubpassSampleLocations)
-        delete[] pPostSubpassSampleLocations;
+        vl_safe_delete_array(pPostSubpassSampleLocations);
 }
 
 void safe_VkRenderPassSampleLocationsBeginInfoEXT::initialize(const VkRenderPassSampleLocationsBeginInfoEXT* in_struct)
@@ -18829,11 +22863,11 @@ void safe_VkRenderPassSampleLocationsBeginInfoEXT::initialize(const VkRenderPass
     postSubpassSampleLocationsCount = in_struct->postSubpassSampleLocationsCount;
     pPostSubpassSampleLocations = nullptr;
     if (in_struct->pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[in_struct->attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = vl_safe_new_array<VkAttachmentSampleLocationsEXT>(in_struct->attachmentInitialSampleLocationsCount);
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)in_struct->pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*in_struct->attachmentInitialSampleLocationsCount);
     }
     if (in_struct->pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[in_struct->postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = vl_safe_new_array<VkSubpassSampleLocationsEXT>(in_struct->postSubpassSampleLocationsCount);
         memcpy ((void *)pPostSubpassSampleLocations, (void *)in_struct->pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*in_struct->postSubpassSampleLocationsCount);
     }
 }
@@ -18847,11 +22881,11 @@ void safe_VkRenderPassSampleLocationsBeginInfoEXT::initialize(const safe_VkRende
     postSubpassSampleLocationsCount = src->postSubpassSampleLocationsCount;
     pPostSubpassSampleLocations = nullptr;
     if (src->pAttachmentInitialSampleLocations) {
-        pAttachmentInitialSampleLocations = new VkAttachmentSampleLocationsEXT[src->attachmentInitialSampleLocationsCount];
+        pAttachmentInitialSampleLocations = vl_safe_new_array<VkAttachmentSampleLocationsEXT>(src->attachmentInitialSampleLocationsCount);
         memcpy ((void *)pAttachmentInitialSampleLocations, (void *)src->pAttachmentInitialSampleLocations, sizeof(VkAttachmentSampleLocationsEXT)*src->attachmentInitialSampleLocationsCount);
     }
     if (src->pPostSubpassSampleLocations) {
-        pPostSubpassSampleLocations = new VkSubpassSampleLocationsEXT[src->postSubpassSampleLocationsCount];
+        pPostSubpassSampleLocations = vl_safe_new_array<VkSubpassSampleLocationsEXT>(src->postSubpassSampleLocationsCount);
         memcpy ((void *)pPostSubpassSampleLocations, (void *)src->pPostSubpassSampleLocations, sizeof(VkSubpassSampleLocationsEXT)*src->postSubpassSampleLocationsCount);
     }
 }
@@ -18888,6 +22922,23 @@ safe_VkPipelineSampleLocationsStateCreateInfoEXT& safe_VkPipelineSampleLocations
     return *this;
 }
 
+safe_VkPipelineSampleLocationsStateCreateInfoEXT::safe_VkPipelineSampleLocationsStateCreateInfoEXT(safe_VkPipelineSampleLocationsStateCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineSampleLocationsStateCreateInfoEXT));
+    new (&src) safe_VkPipelineSampleLocationsStateCreateInfoEXT();
+}
+
+safe_VkPipelineSampleLocationsStateCreateInfoEXT& safe_VkPipelineSampleLocationsStateCreateInfoEXT::operator=(safe_VkPipelineSampleLocationsStateCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineSampleLocationsStateCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineSampleLocationsStateCreateInfoEXT));
+    new (&src) safe_VkPipelineSampleLocationsStateCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineSampleLocationsStateCreateInfoEXT::~safe_VkPipelineSampleLocationsStateCreateInfoEXT()
 {
 }
@@ -18916,9 +22967,7 @@ safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::safe_VkPhysicalDeviceSampleLo
     sampleLocationSubPixelBits(in_struct->sampleLocationSubPixelBits),
     variableSampleLocations(in_struct->variableSampleLocations)
 {
-    for (uint32_t i=0; i<2; ++i) {
-        sampleLocationCoordinateRange[i] = in_struct->sampleLocationCoordinateRange[i];
-    }
+    memcpy (sampleLocationCoordinateRange, in_struct->sampleLocationCoordinateRange, sizeof(sampleLocationCoordinateRange));
 }
 
 safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::safe_VkPhysicalDeviceSampleLocationsPropertiesEXT()
@@ -18932,9 +22981,7 @@ safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::safe_VkPhysicalDeviceSampleLo
     maxSampleLocationGridSize = src.maxSampleLocationGridSize;
     sampleLocationSubPixelBits = src.sampleLocationSubPixelBits;
     variableSampleLocations = src.variableSampleLocations;
-    for (uint32_t i=0; i<2; ++i) {
-        sampleLocationCoordinateRange[i] = src.sampleLocationCoordinateRange[i];
-    }
+    memcpy (sampleLocationCoordinateRange, src.sampleLocationCoordinateRange, sizeof(sampleLocationCoordinateRange));
 }
 
 safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::operator=(const safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& src)
@@ -18948,9 +22995,24 @@ safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& safe_VkPhysicalDeviceSampleLo
     maxSampleLocationGridSize = src.maxSampleLocationGridSize;
     sampleLocationSubPixelBits = src.sampleLocationSubPixelBits;
     variableSampleLocations = src.variableSampleLocations;
-    for (uint32_t i=0; i<2; ++i) {
-        sampleLocationCoordinateRange[i] = src.sampleLocationCoordinateRange[i];
-    }
+    memcpy (sampleLocationCoordinateRange, src.sampleLocationCoordinateRange, sizeof(sampleLocationCoordinateRange));
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::operator=(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
 
     return *this;
 }
@@ -18967,9 +23029,7 @@ void safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::initialize(const VkPhysi
     maxSampleLocationGridSize = in_struct->maxSampleLocationGridSize;
     sampleLocationSubPixelBits = in_struct->sampleLocationSubPixelBits;
     variableSampleLocations = in_struct->variableSampleLocations;
-    for (uint32_t i=0; i<2; ++i) {
-        sampleLocationCoordinateRange[i] = in_struct->sampleLocationCoordinateRange[i];
-    }
+    memcpy (sampleLocationCoordinateRange, in_struct->sampleLocationCoordinateRange, sizeof(sampleLocationCoordinateRange));
 }
 
 void safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::initialize(const safe_VkPhysicalDeviceSampleLocationsPropertiesEXT* src)
@@ -18980,9 +23040,7 @@ void safe_VkPhysicalDeviceSampleLocationsPropertiesEXT::initialize(const safe_Vk
     maxSampleLocationGridSize = src->maxSampleLocationGridSize;
     sampleLocationSubPixelBits = src->sampleLocationSubPixelBits;
     variableSampleLocations = src->variableSampleLocations;
-    for (uint32_t i=0; i<2; ++i) {
-        sampleLocationCoordinateRange[i] = src->sampleLocationCoordinateRange[i];
-    }
+    memcpy (sampleLocationCoordinateRange, src->sampleLocationCoordinateRange, sizeof(sampleLocationCoordinateRange));
 }
 
 safe_VkMultisamplePropertiesEXT::safe_VkMultisamplePropertiesEXT(const VkMultisamplePropertiesEXT* in_struct) :
@@ -19014,6 +23072,23 @@ safe_VkMultisamplePropertiesEXT& safe_VkMultisamplePropertiesEXT::operator=(cons
     return *this;
 }
 
+safe_VkMultisamplePropertiesEXT::safe_VkMultisamplePropertiesEXT(safe_VkMultisamplePropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMultisamplePropertiesEXT));
+    new (&src) safe_VkMultisamplePropertiesEXT();
+}
+
+safe_VkMultisamplePropertiesEXT& safe_VkMultisamplePropertiesEXT::operator=(safe_VkMultisamplePropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMultisamplePropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMultisamplePropertiesEXT));
+    new (&src) safe_VkMultisamplePropertiesEXT();
+
+    return *this;
+}
+
 safe_VkMultisamplePropertiesEXT::~safe_VkMultisamplePropertiesEXT()
 {
 }
@@ -19061,6 +23136,23 @@ safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& safe_VkPhysicalDeviceBle
     return *this;
 }
 
+safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT::safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT::operator=(safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT::~safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT()
 {
 }
@@ -19123,6 +23215,23 @@ safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& safe_VkPhysicalDeviceB
     return *this;
 }
 
+safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT::safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT::operator=(safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT::~safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT()
 {
 }
@@ -19186,6 +23295,23 @@ safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& safe_VkPipelineColorBlendAd
     return *this;
 }
 
+safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT::safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT));
+    new (&src) safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
+}
+
+safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT::operator=(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT));
+    new (&src) safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT::~safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT()
 {
 }
@@ -19229,16 +23355,33 @@ safe_VkPipelineCoverageToColorStateCreateInfoNV::safe_VkPipelineCoverageToColorS
     coverageToColorLocation = src.coverageToColorLocation;
 }
 
-safe_VkPipelineCoverageToColorStateCreateInfoNV& safe_VkPipelineCoverageToColorStateCreateInfoNV::operator=(const safe_VkPipelineCoverageToColorStateCreateInfoNV& src)
+safe_VkPipelineCoverageToColorStateCreateInfoNV& safe_VkPipelineCoverageToColorStateCreateInfoNV::operator=(const safe_VkPipelineCoverageToColorStateCreateInfoNV& src)
+{
+    if (&src == this) return *this;
+
+
+    sType = src.sType;
+    pNext = src.pNext;
+    flags = src.flags;
+    coverageToColorEnable = src.coverageToColorEnable;
+    coverageToColorLocation = src.coverageToColorLocation;
+
+    return *this;
+}
+
+safe_VkPipelineCoverageToColorStateCreateInfoNV::safe_VkPipelineCoverageToColorStateCreateInfoNV(safe_VkPipelineCoverageToColorStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCoverageToColorStateCreateInfoNV));
+    new (&src) safe_VkPipelineCoverageToColorStateCreateInfoNV();
+}
+
+safe_VkPipelineCoverageToColorStateCreateInfoNV& safe_VkPipelineCoverageToColorStateCreateInfoNV::operator=(safe_VkPipelineCoverageToColorStateCreateInfoNV&& src) noexcept
 {
     if (&src == this) return *this;
 
-
-    sType = src.sType;
-    pNext = src.pNext;
-    flags = src.flags;
-    coverageToColorEnable = src.coverageToColorEnable;
-    coverageToColorLocation = src.coverageToColorLocation;
+    this->~safe_VkPipelineCoverageToColorStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCoverageToColorStateCreateInfoNV));
+    new (&src) safe_VkPipelineCoverageToColorStateCreateInfoNV();
 
     return *this;
 }
@@ -19275,7 +23418,7 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV::safe_VkPipelineCoverageModul
     pCoverageModulationTable(nullptr)
 {
     if (in_struct->pCoverageModulationTable) {
-        pCoverageModulationTable = new float[in_struct->coverageModulationTableCount];
+        pCoverageModulationTable = vl_safe_new_array<float>(in_struct->coverageModulationTableCount);
         memcpy ((void *)pCoverageModulationTable, (void *)in_struct->pCoverageModulationTable, sizeof(float)*in_struct->coverageModulationTableCount);
     }
 }
@@ -19294,7 +23437,7 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV::safe_VkPipelineCoverageModul
     coverageModulationTableCount = src.coverageModulationTableCount;
     pCoverageModulationTable = nullptr;
     if (src.pCoverageModulationTable) {
-        pCoverageModulationTable = new float[src.coverageModulationTableCount];
+        pCoverageModulationTable = vl_safe_new_array<float>(src.coverageModulationTableCount);
         memcpy ((void *)pCoverageModulationTable, (void *)src.pCoverageModulationTable, sizeof(float)*src.coverageModulationTableCount);
     }
 }
@@ -19304,7 +23447,7 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV& safe_VkPipelineCoverageModul
     if (&src == this) return *this;
 
     if (pCoverageModulationTable)
-        delete[] pCoverageModulationTable;
+        vl_safe_delete_array(pCoverageModulationTable);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -19314,17 +23457,34 @@ safe_VkPipelineCoverageModulationStateCreateInfoNV& safe_VkPipelineCoverageModul
     coverageModulationTableCount = src.coverageModulationTableCount;
     pCoverageModulationTable = nullptr;
     if (src.pCoverageModulationTable) {
-        pCoverageModulationTable = new float[src.coverageModulationTableCount];
+        pCoverageModulationTable = vl_safe_new_array<float>(src.coverageModulationTableCount);
         memcpy ((void *)pCoverageModulationTable, (void *)src.pCoverageModulationTable, sizeof(float)*src.coverageModulationTableCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineCoverageModulationStateCreateInfoNV::safe_VkPipelineCoverageModulationStateCreateInfoNV(safe_VkPipelineCoverageModulationStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCoverageModulationStateCreateInfoNV));
+    new (&src) safe_VkPipelineCoverageModulationStateCreateInfoNV();
+}
+
+safe_VkPipelineCoverageModulationStateCreateInfoNV& safe_VkPipelineCoverageModulationStateCreateInfoNV::operator=(safe_VkPipelineCoverageModulationStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineCoverageModulationStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCoverageModulationStateCreateInfoNV));
+    new (&src) safe_VkPipelineCoverageModulationStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineCoverageModulationStateCreateInfoNV::~safe_VkPipelineCoverageModulationStateCreateInfoNV()
 {
     if (pCoverageModulationTable)
-        delete[] pCoverageModulationTable;
+        vl_safe_delete_array(pCoverageModulationTable);
 }
 
 void safe_VkPipelineCoverageModulationStateCreateInfoNV::initialize(const VkPipelineCoverageModulationStateCreateInfoNV* in_struct)
@@ -19337,7 +23497,7 @@ void safe_VkPipelineCoverageModulationStateCreateInfoNV::initialize(const VkPipe
     coverageModulationTableCount = in_struct->coverageModulationTableCount;
     pCoverageModulationTable = nullptr;
     if (in_struct->pCoverageModulationTable) {
-        pCoverageModulationTable = new float[in_struct->coverageModulationTableCount];
+        pCoverageModulationTable = vl_safe_new_array<float>(in_struct->coverageModulationTableCount);
         memcpy ((void *)pCoverageModulationTable, (void *)in_struct->pCoverageModulationTable, sizeof(float)*in_struct->coverageModulationTableCount);
     }
 }
@@ -19352,7 +23512,7 @@ void safe_VkPipelineCoverageModulationStateCreateInfoNV::initialize(const safe_V
     coverageModulationTableCount = src->coverageModulationTableCount;
     pCoverageModulationTable = nullptr;
     if (src->pCoverageModulationTable) {
-        pCoverageModulationTable = new float[src->coverageModulationTableCount];
+        pCoverageModulationTable = vl_safe_new_array<float>(src->coverageModulationTableCount);
         memcpy ((void *)pCoverageModulationTable, (void *)src->pCoverageModulationTable, sizeof(float)*src->coverageModulationTableCount);
     }
 }
@@ -19389,6 +23549,23 @@ safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& safe_VkPhysicalDeviceShaderSM
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
+}
+
+safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::operator=(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV::~safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV()
 {
 }
@@ -19438,6 +23615,23 @@ safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& safe_VkPhysicalDeviceShaderSMBu
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
+}
+
+safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::operator=(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV::~safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV()
 {
 }
@@ -19463,7 +23657,7 @@ safe_VkDrmFormatModifierPropertiesListEXT::safe_VkDrmFormatModifierPropertiesLis
     pDrmFormatModifierProperties(nullptr)
 {
     if (in_struct->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[in_struct->drmFormatModifierCount];
+        pDrmFormatModifierProperties = vl_safe_new_array<VkDrmFormatModifierPropertiesEXT>(in_struct->drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifierProperties, (void *)in_struct->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*in_struct->drmFormatModifierCount);
     }
 }
@@ -19479,7 +23673,7 @@ safe_VkDrmFormatModifierPropertiesListEXT::safe_VkDrmFormatModifierPropertiesLis
     drmFormatModifierCount = src.drmFormatModifierCount;
     pDrmFormatModifierProperties = nullptr;
     if (src.pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[src.drmFormatModifierCount];
+        pDrmFormatModifierProperties = vl_safe_new_array<VkDrmFormatModifierPropertiesEXT>(src.drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifierProperties, (void *)src.pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*src.drmFormatModifierCount);
     }
 }
@@ -19489,24 +23683,41 @@ safe_VkDrmFormatModifierPropertiesListEXT& safe_VkDrmFormatModifierPropertiesLis
     if (&src == this) return *this;
 
     if (pDrmFormatModifierProperties)
-        delete[] pDrmFormatModifierProperties;
+        vl_safe_delete_array(pDrmFormatModifierProperties);
 
     sType = src.sType;
     pNext = src.pNext;
     drmFormatModifierCount = src.drmFormatModifierCount;
     pDrmFormatModifierProperties = nullptr;
     if (src.pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[src.drmFormatModifierCount];
+        pDrmFormatModifierProperties = vl_safe_new_array<VkDrmFormatModifierPropertiesEXT>(src.drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifierProperties, (void *)src.pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*src.drmFormatModifierCount);
     }
 
     return *this;
 }
 
+safe_VkDrmFormatModifierPropertiesListEXT::safe_VkDrmFormatModifierPropertiesListEXT(safe_VkDrmFormatModifierPropertiesListEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDrmFormatModifierPropertiesListEXT));
+    new (&src) safe_VkDrmFormatModifierPropertiesListEXT();
+}
+
+safe_VkDrmFormatModifierPropertiesListEXT& safe_VkDrmFormatModifierPropertiesListEXT::operator=(safe_VkDrmFormatModifierPropertiesListEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDrmFormatModifierPropertiesListEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDrmFormatModifierPropertiesListEXT));
+    new (&src) safe_VkDrmFormatModifierPropertiesListEXT();
+
+    return *this;
+}
+
 safe_VkDrmFormatModifierPropertiesListEXT::~safe_VkDrmFormatModifierPropertiesListEXT()
 {
     if (pDrmFormatModifierProperties)
-        delete[] pDrmFormatModifierProperties;
+        vl_safe_delete_array(pDrmFormatModifierProperties);
 }
 
 void safe_VkDrmFormatModifierPropertiesListEXT::initialize(const VkDrmFormatModifierPropertiesListEXT* in_struct)
@@ -19516,7 +23727,7 @@ void safe_VkDrmFormatModifierPropertiesListEXT::initialize(const VkDrmFormatModi
     drmFormatModifierCount = in_struct->drmFormatModifierCount;
     pDrmFormatModifierProperties = nullptr;
     if (in_struct->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[in_struct->drmFormatModifierCount];
+        pDrmFormatModifierProperties = vl_safe_new_array<VkDrmFormatModifierPropertiesEXT>(in_struct->drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifierProperties, (void *)in_struct->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*in_struct->drmFormatModifierCount);
     }
 }
@@ -19528,7 +23739,7 @@ void safe_VkDrmFormatModifierPropertiesListEXT::initialize(const safe_VkDrmForma
     drmFormatModifierCount = src->drmFormatModifierCount;
     pDrmFormatModifierProperties = nullptr;
     if (src->pDrmFormatModifierProperties) {
-        pDrmFormatModifierProperties = new VkDrmFormatModifierPropertiesEXT[src->drmFormatModifierCount];
+        pDrmFormatModifierProperties = vl_safe_new_array<VkDrmFormatModifierPropertiesEXT>(src->drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifierProperties, (void *)src->pDrmFormatModifierProperties, sizeof(VkDrmFormatModifierPropertiesEXT)*src->drmFormatModifierCount);
     }
 }
@@ -19542,7 +23753,7 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::safe_VkPhysicalDeviceImageDr
     pQueueFamilyIndices(nullptr)
 {
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -19560,7 +23771,7 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::safe_VkPhysicalDeviceImageDr
     queueFamilyIndexCount = src.queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 }
@@ -19570,7 +23781,7 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& safe_VkPhysicalDeviceImageDr
     if (&src == this) return *this;
 
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -19579,17 +23790,34 @@ safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& safe_VkPhysicalDeviceImageDr
     queueFamilyIndexCount = src.queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (src.pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src.queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src.queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src.pQueueFamilyIndices, sizeof(uint32_t)*src.queueFamilyIndexCount);
     }
 
     return *this;
 }
 
+safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT));
+    new (&src) safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
+}
+
+safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::operator=(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT));
+    new (&src) safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::~safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT()
 {
     if (pQueueFamilyIndices)
-        delete[] pQueueFamilyIndices;
+        vl_safe_delete_array(pQueueFamilyIndices);
 }
 
 void safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::initialize(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT* in_struct)
@@ -19601,7 +23829,7 @@ void safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::initialize(const VkPhys
     queueFamilyIndexCount = in_struct->queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (in_struct->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[in_struct->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(in_struct->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)in_struct->pQueueFamilyIndices, sizeof(uint32_t)*in_struct->queueFamilyIndexCount);
     }
 }
@@ -19615,7 +23843,7 @@ void safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT::initialize(const safe_V
     queueFamilyIndexCount = src->queueFamilyIndexCount;
     pQueueFamilyIndices = nullptr;
     if (src->pQueueFamilyIndices) {
-        pQueueFamilyIndices = new uint32_t[src->queueFamilyIndexCount];
+        pQueueFamilyIndices = vl_safe_new_array<uint32_t>(src->queueFamilyIndexCount);
         memcpy ((void *)pQueueFamilyIndices, (void *)src->pQueueFamilyIndices, sizeof(uint32_t)*src->queueFamilyIndexCount);
     }
 }
@@ -19627,7 +23855,7 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT::safe_VkImageDrmFormatModifierLis
     pDrmFormatModifiers(nullptr)
 {
     if (in_struct->pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[in_struct->drmFormatModifierCount];
+        pDrmFormatModifiers = vl_safe_new_array<uint64_t>(in_struct->drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifiers, (void *)in_struct->pDrmFormatModifiers, sizeof(uint64_t)*in_struct->drmFormatModifierCount);
     }
 }
@@ -19643,7 +23871,7 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT::safe_VkImageDrmFormatModifierLis
     drmFormatModifierCount = src.drmFormatModifierCount;
     pDrmFormatModifiers = nullptr;
     if (src.pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[src.drmFormatModifierCount];
+        pDrmFormatModifiers = vl_safe_new_array<uint64_t>(src.drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifiers, (void *)src.pDrmFormatModifiers, sizeof(uint64_t)*src.drmFormatModifierCount);
     }
 }
@@ -19653,24 +23881,41 @@ safe_VkImageDrmFormatModifierListCreateInfoEXT& safe_VkImageDrmFormatModifierLis
     if (&src == this) return *this;
 
     if (pDrmFormatModifiers)
-        delete[] pDrmFormatModifiers;
+        vl_safe_delete_array(pDrmFormatModifiers);
 
     sType = src.sType;
     pNext = src.pNext;
     drmFormatModifierCount = src.drmFormatModifierCount;
     pDrmFormatModifiers = nullptr;
     if (src.pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[src.drmFormatModifierCount];
+        pDrmFormatModifiers = vl_safe_new_array<uint64_t>(src.drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifiers, (void *)src.pDrmFormatModifiers, sizeof(uint64_t)*src.drmFormatModifierCount);
     }
 
     return *this;
 }
 
+safe_VkImageDrmFormatModifierListCreateInfoEXT::safe_VkImageDrmFormatModifierListCreateInfoEXT(safe_VkImageDrmFormatModifierListCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageDrmFormatModifierListCreateInfoEXT));
+    new (&src) safe_VkImageDrmFormatModifierListCreateInfoEXT();
+}
+
+safe_VkImageDrmFormatModifierListCreateInfoEXT& safe_VkImageDrmFormatModifierListCreateInfoEXT::operator=(safe_VkImageDrmFormatModifierListCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageDrmFormatModifierListCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageDrmFormatModifierListCreateInfoEXT));
+    new (&src) safe_VkImageDrmFormatModifierListCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkImageDrmFormatModifierListCreateInfoEXT::~safe_VkImageDrmFormatModifierListCreateInfoEXT()
 {
     if (pDrmFormatModifiers)
-        delete[] pDrmFormatModifiers;
+        vl_safe_delete_array(pDrmFormatModifiers);
 }
 
 void safe_VkImageDrmFormatModifierListCreateInfoEXT::initialize(const VkImageDrmFormatModifierListCreateInfoEXT* in_struct)
@@ -19680,7 +23925,7 @@ void safe_VkImageDrmFormatModifierListCreateInfoEXT::initialize(const VkImageDrm
     drmFormatModifierCount = in_struct->drmFormatModifierCount;
     pDrmFormatModifiers = nullptr;
     if (in_struct->pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[in_struct->drmFormatModifierCount];
+        pDrmFormatModifiers = vl_safe_new_array<uint64_t>(in_struct->drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifiers, (void *)in_struct->pDrmFormatModifiers, sizeof(uint64_t)*in_struct->drmFormatModifierCount);
     }
 }
@@ -19692,7 +23937,7 @@ void safe_VkImageDrmFormatModifierListCreateInfoEXT::initialize(const safe_VkIma
     drmFormatModifierCount = src->drmFormatModifierCount;
     pDrmFormatModifiers = nullptr;
     if (src->pDrmFormatModifiers) {
-        pDrmFormatModifiers = new uint64_t[src->drmFormatModifierCount];
+        pDrmFormatModifiers = vl_safe_new_array<uint64_t>(src->drmFormatModifierCount);
         memcpy ((void *)pDrmFormatModifiers, (void *)src->pDrmFormatModifiers, sizeof(uint64_t)*src->drmFormatModifierCount);
     }
 }
@@ -19705,7 +23950,7 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::safe_VkImageDrmFormatModifie
     pPlaneLayouts(nullptr)
 {
     if (in_struct->pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[in_struct->drmFormatModifierPlaneCount];
+        pPlaneLayouts = vl_safe_new_array<VkSubresourceLayout>(in_struct->drmFormatModifierPlaneCount);
         memcpy ((void *)pPlaneLayouts, (void *)in_struct->pPlaneLayouts, sizeof(VkSubresourceLayout)*in_struct->drmFormatModifierPlaneCount);
     }
 }
@@ -19722,7 +23967,7 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::safe_VkImageDrmFormatModifie
     drmFormatModifierPlaneCount = src.drmFormatModifierPlaneCount;
     pPlaneLayouts = nullptr;
     if (src.pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[src.drmFormatModifierPlaneCount];
+        pPlaneLayouts = vl_safe_new_array<VkSubresourceLayout>(src.drmFormatModifierPlaneCount);
         memcpy ((void *)pPlaneLayouts, (void *)src.pPlaneLayouts, sizeof(VkSubresourceLayout)*src.drmFormatModifierPlaneCount);
     }
 }
@@ -19732,7 +23977,7 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& safe_VkImageDrmFormatModifie
     if (&src == this) return *this;
 
     if (pPlaneLayouts)
-        delete[] pPlaneLayouts;
+        vl_safe_delete_array(pPlaneLayouts);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -19740,17 +23985,34 @@ safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& safe_VkImageDrmFormatModifie
     drmFormatModifierPlaneCount = src.drmFormatModifierPlaneCount;
     pPlaneLayouts = nullptr;
     if (src.pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[src.drmFormatModifierPlaneCount];
+        pPlaneLayouts = vl_safe_new_array<VkSubresourceLayout>(src.drmFormatModifierPlaneCount);
         memcpy ((void *)pPlaneLayouts, (void *)src.pPlaneLayouts, sizeof(VkSubresourceLayout)*src.drmFormatModifierPlaneCount);
     }
 
     return *this;
 }
 
+safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT));
+    new (&src) safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
+}
+
+safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::operator=(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT));
+    new (&src) safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::~safe_VkImageDrmFormatModifierExplicitCreateInfoEXT()
 {
     if (pPlaneLayouts)
-        delete[] pPlaneLayouts;
+        vl_safe_delete_array(pPlaneLayouts);
 }
 
 void safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::initialize(const VkImageDrmFormatModifierExplicitCreateInfoEXT* in_struct)
@@ -19761,7 +24023,7 @@ void safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::initialize(const VkImag
     drmFormatModifierPlaneCount = in_struct->drmFormatModifierPlaneCount;
     pPlaneLayouts = nullptr;
     if (in_struct->pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[in_struct->drmFormatModifierPlaneCount];
+        pPlaneLayouts = vl_safe_new_array<VkSubresourceLayout>(in_struct->drmFormatModifierPlaneCount);
         memcpy ((void *)pPlaneLayouts, (void *)in_struct->pPlaneLayouts, sizeof(VkSubresourceLayout)*in_struct->drmFormatModifierPlaneCount);
     }
 }
@@ -19774,7 +24036,7 @@ void safe_VkImageDrmFormatModifierExplicitCreateInfoEXT::initialize(const safe_V
     drmFormatModifierPlaneCount = src->drmFormatModifierPlaneCount;
     pPlaneLayouts = nullptr;
     if (src->pPlaneLayouts) {
-        pPlaneLayouts = new VkSubresourceLayout[src->drmFormatModifierPlaneCount];
+        pPlaneLayouts = vl_safe_new_array<VkSubresourceLayout>(src->drmFormatModifierPlaneCount);
         memcpy ((void *)pPlaneLayouts, (void *)src->pPlaneLayouts, sizeof(VkSubresourceLayout)*src->drmFormatModifierPlaneCount);
     }
 }
@@ -19808,6 +24070,23 @@ safe_VkImageDrmFormatModifierPropertiesEXT& safe_VkImageDrmFormatModifierPropert
     return *this;
 }
 
+safe_VkImageDrmFormatModifierPropertiesEXT::safe_VkImageDrmFormatModifierPropertiesEXT(safe_VkImageDrmFormatModifierPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageDrmFormatModifierPropertiesEXT));
+    new (&src) safe_VkImageDrmFormatModifierPropertiesEXT();
+}
+
+safe_VkImageDrmFormatModifierPropertiesEXT& safe_VkImageDrmFormatModifierPropertiesEXT::operator=(safe_VkImageDrmFormatModifierPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageDrmFormatModifierPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageDrmFormatModifierPropertiesEXT));
+    new (&src) safe_VkImageDrmFormatModifierPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkImageDrmFormatModifierPropertiesEXT::~safe_VkImageDrmFormatModifierPropertiesEXT()
 {
 }
@@ -19861,6 +24140,23 @@ safe_VkValidationCacheCreateInfoEXT& safe_VkValidationCacheCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkValidationCacheCreateInfoEXT::safe_VkValidationCacheCreateInfoEXT(safe_VkValidationCacheCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkValidationCacheCreateInfoEXT));
+    new (&src) safe_VkValidationCacheCreateInfoEXT();
+}
+
+safe_VkValidationCacheCreateInfoEXT& safe_VkValidationCacheCreateInfoEXT::operator=(safe_VkValidationCacheCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkValidationCacheCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkValidationCacheCreateInfoEXT));
+    new (&src) safe_VkValidationCacheCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkValidationCacheCreateInfoEXT::~safe_VkValidationCacheCreateInfoEXT()
 {
 }
@@ -19912,6 +24208,23 @@ safe_VkShaderModuleValidationCacheCreateInfoEXT& safe_VkShaderModuleValidationCa
     return *this;
 }
 
+safe_VkShaderModuleValidationCacheCreateInfoEXT::safe_VkShaderModuleValidationCacheCreateInfoEXT(safe_VkShaderModuleValidationCacheCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkShaderModuleValidationCacheCreateInfoEXT));
+    new (&src) safe_VkShaderModuleValidationCacheCreateInfoEXT();
+}
+
+safe_VkShaderModuleValidationCacheCreateInfoEXT& safe_VkShaderModuleValidationCacheCreateInfoEXT::operator=(safe_VkShaderModuleValidationCacheCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkShaderModuleValidationCacheCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkShaderModuleValidationCacheCreateInfoEXT));
+    new (&src) safe_VkShaderModuleValidationCacheCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkShaderModuleValidationCacheCreateInfoEXT::~safe_VkShaderModuleValidationCacheCreateInfoEXT()
 {
 }
@@ -19937,7 +24250,7 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::safe_VkDescriptorSetLayoutB
     pBindingFlags(nullptr)
 {
     if (in_struct->pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlagsEXT[in_struct->bindingCount];
+        pBindingFlags = vl_safe_new_array<VkDescriptorBindingFlagsEXT>(in_struct->bindingCount);
         memcpy ((void *)pBindingFlags, (void *)in_struct->pBindingFlags, sizeof(VkDescriptorBindingFlagsEXT)*in_struct->bindingCount);
     }
 }
@@ -19953,7 +24266,7 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::safe_VkDescriptorSetLayoutB
     bindingCount = src.bindingCount;
     pBindingFlags = nullptr;
     if (src.pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlagsEXT[src.bindingCount];
+        pBindingFlags = vl_safe_new_array<VkDescriptorBindingFlagsEXT>(src.bindingCount);
         memcpy ((void *)pBindingFlags, (void *)src.pBindingFlags, sizeof(VkDescriptorBindingFlagsEXT)*src.bindingCount);
     }
 }
@@ -19963,24 +24276,41 @@ safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT& safe_VkDescriptorSetLayoutB
     if (&src == this) return *this;
 
     if (pBindingFlags)
-        delete[] pBindingFlags;
+        vl_safe_delete_array(pBindingFlags);
 
     sType = src.sType;
     pNext = src.pNext;
     bindingCount = src.bindingCount;
     pBindingFlags = nullptr;
     if (src.pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlagsEXT[src.bindingCount];
+        pBindingFlags = vl_safe_new_array<VkDescriptorBindingFlagsEXT>(src.bindingCount);
         memcpy ((void *)pBindingFlags, (void *)src.pBindingFlags, sizeof(VkDescriptorBindingFlagsEXT)*src.bindingCount);
     }
 
     return *this;
 }
 
+safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT));
+    new (&src) safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT();
+}
+
+safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT& safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::operator=(safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT));
+    new (&src) safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::~safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT()
 {
     if (pBindingFlags)
-        delete[] pBindingFlags;
+        vl_safe_delete_array(pBindingFlags);
 }
 
 void safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::initialize(const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT* in_struct)
@@ -19990,7 +24320,7 @@ void safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::initialize(const VkDes
     bindingCount = in_struct->bindingCount;
     pBindingFlags = nullptr;
     if (in_struct->pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlagsEXT[in_struct->bindingCount];
+        pBindingFlags = vl_safe_new_array<VkDescriptorBindingFlagsEXT>(in_struct->bindingCount);
         memcpy ((void *)pBindingFlags, (void *)in_struct->pBindingFlags, sizeof(VkDescriptorBindingFlagsEXT)*in_struct->bindingCount);
     }
 }
@@ -20002,7 +24332,7 @@ void safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT::initialize(const safe_
     bindingCount = src->bindingCount;
     pBindingFlags = nullptr;
     if (src->pBindingFlags) {
-        pBindingFlags = new VkDescriptorBindingFlagsEXT[src->bindingCount];
+        pBindingFlags = vl_safe_new_array<VkDescriptorBindingFlagsEXT>(src->bindingCount);
         memcpy ((void *)pBindingFlags, (void *)src->pBindingFlags, sizeof(VkDescriptorBindingFlagsEXT)*src->bindingCount);
     }
 }
@@ -20093,6 +24423,23 @@ safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT& safe_VkPhysicalDeviceDescrip
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT::safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT& safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT::operator=(safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT::~safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT()
 {
 }
@@ -20244,6 +24591,23 @@ safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT& safe_VkPhysicalDeviceDescr
     return *this;
 }
 
+safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT::safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT& safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT::operator=(safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT::~safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT()
 {
 }
@@ -20313,7 +24677,7 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::safe_VkDescriptorSet
     pDescriptorCounts(nullptr)
 {
     if (in_struct->pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[in_struct->descriptorSetCount];
+        pDescriptorCounts = vl_safe_new_array<uint32_t>(in_struct->descriptorSetCount);
         memcpy ((void *)pDescriptorCounts, (void *)in_struct->pDescriptorCounts, sizeof(uint32_t)*in_struct->descriptorSetCount);
     }
 }
@@ -20329,7 +24693,7 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::safe_VkDescriptorSet
     descriptorSetCount = src.descriptorSetCount;
     pDescriptorCounts = nullptr;
     if (src.pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[src.descriptorSetCount];
+        pDescriptorCounts = vl_safe_new_array<uint32_t>(src.descriptorSetCount);
         memcpy ((void *)pDescriptorCounts, (void *)src.pDescriptorCounts, sizeof(uint32_t)*src.descriptorSetCount);
     }
 }
@@ -20339,24 +24703,41 @@ safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT& safe_VkDescriptorSet
     if (&src == this) return *this;
 
     if (pDescriptorCounts)
-        delete[] pDescriptorCounts;
+        vl_safe_delete_array(pDescriptorCounts);
 
     sType = src.sType;
     pNext = src.pNext;
     descriptorSetCount = src.descriptorSetCount;
     pDescriptorCounts = nullptr;
     if (src.pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[src.descriptorSetCount];
+        pDescriptorCounts = vl_safe_new_array<uint32_t>(src.descriptorSetCount);
         memcpy ((void *)pDescriptorCounts, (void *)src.pDescriptorCounts, sizeof(uint32_t)*src.descriptorSetCount);
     }
 
     return *this;
 }
 
+safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT));
+    new (&src) safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT();
+}
+
+safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT& safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::operator=(safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT));
+    new (&src) safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT();
+
+    return *this;
+}
+
 safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::~safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT()
 {
     if (pDescriptorCounts)
-        delete[] pDescriptorCounts;
+        vl_safe_delete_array(pDescriptorCounts);
 }
 
 void safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::initialize(const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT* in_struct)
@@ -20366,7 +24747,7 @@ void safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::initialize(cons
     descriptorSetCount = in_struct->descriptorSetCount;
     pDescriptorCounts = nullptr;
     if (in_struct->pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[in_struct->descriptorSetCount];
+        pDescriptorCounts = vl_safe_new_array<uint32_t>(in_struct->descriptorSetCount);
         memcpy ((void *)pDescriptorCounts, (void *)in_struct->pDescriptorCounts, sizeof(uint32_t)*in_struct->descriptorSetCount);
     }
 }
@@ -20378,7 +24759,7 @@ void safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT::initialize(cons
     descriptorSetCount = src->descriptorSetCount;
     pDescriptorCounts = nullptr;
     if (src->pDescriptorCounts) {
-        pDescriptorCounts = new uint32_t[src->descriptorSetCount];
+        pDescriptorCounts = vl_safe_new_array<uint32_t>(src->descriptorSetCount);
         memcpy ((void *)pDescriptorCounts, (void *)src->pDescriptorCounts, sizeof(uint32_t)*src->descriptorSetCount);
     }
 }
@@ -20412,6 +24793,23 @@ safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT& safe_VkDescriptorSe
     return *this;
 }
 
+safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT::safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT));
+    new (&src) safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT();
+}
+
+safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT& safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT::operator=(safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT));
+    new (&src) safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT();
+
+    return *this;
+}
+
 safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT::~safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT()
 {
 }
@@ -20435,7 +24833,7 @@ safe_VkShadingRatePaletteNV::safe_VkShadingRatePaletteNV(const VkShadingRatePale
     pShadingRatePaletteEntries(nullptr)
 {
     if (in_struct->pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[in_struct->shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = vl_safe_new_array<VkShadingRatePaletteEntryNV>(in_struct->shadingRatePaletteEntryCount);
         memcpy ((void *)pShadingRatePaletteEntries, (void *)in_struct->pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*in_struct->shadingRatePaletteEntryCount);
     }
 }
@@ -20449,7 +24847,7 @@ safe_VkShadingRatePaletteNV::safe_VkShadingRatePaletteNV(const safe_VkShadingRat
     shadingRatePaletteEntryCount = src.shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (src.pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[src.shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = vl_safe_new_array<VkShadingRatePaletteEntryNV>(src.shadingRatePaletteEntryCount);
         memcpy ((void *)pShadingRatePaletteEntries, (void *)src.pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*src.shadingRatePaletteEntryCount);
     }
 }
@@ -20459,22 +24857,39 @@ safe_VkShadingRatePaletteNV& safe_VkShadingRatePaletteNV::operator=(const safe_V
     if (&src == this) return *this;
 
     if (pShadingRatePaletteEntries)
-        delete[] pShadingRatePaletteEntries;
+        vl_safe_delete_array(pShadingRatePaletteEntries);
 
     shadingRatePaletteEntryCount = src.shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (src.pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[src.shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = vl_safe_new_array<VkShadingRatePaletteEntryNV>(src.shadingRatePaletteEntryCount);
         memcpy ((void *)pShadingRatePaletteEntries, (void *)src.pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*src.shadingRatePaletteEntryCount);
     }
 
     return *this;
 }
 
+safe_VkShadingRatePaletteNV::safe_VkShadingRatePaletteNV(safe_VkShadingRatePaletteNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkShadingRatePaletteNV));
+    new (&src) safe_VkShadingRatePaletteNV();
+}
+
+safe_VkShadingRatePaletteNV& safe_VkShadingRatePaletteNV::operator=(safe_VkShadingRatePaletteNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkShadingRatePaletteNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkShadingRatePaletteNV));
+    new (&src) safe_VkShadingRatePaletteNV();
+
+    return *this;
+}
+
 safe_VkShadingRatePaletteNV::~safe_VkShadingRatePaletteNV()
 {
     if (pShadingRatePaletteEntries)
-        delete[] pShadingRatePaletteEntries;
+        vl_safe_delete_array(pShadingRatePaletteEntries);
 }
 
 void safe_VkShadingRatePaletteNV::initialize(const VkShadingRatePaletteNV* in_struct)
@@ -20482,7 +24897,7 @@ void safe_VkShadingRatePaletteNV::initialize(const VkShadingRatePaletteNV* in_st
     shadingRatePaletteEntryCount = in_struct->shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (in_struct->pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[in_struct->shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = vl_safe_new_array<VkShadingRatePaletteEntryNV>(in_struct->shadingRatePaletteEntryCount);
         memcpy ((void *)pShadingRatePaletteEntries, (void *)in_struct->pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*in_struct->shadingRatePaletteEntryCount);
     }
 }
@@ -20492,7 +24907,7 @@ void safe_VkShadingRatePaletteNV::initialize(const safe_VkShadingRatePaletteNV*
     shadingRatePaletteEntryCount = src->shadingRatePaletteEntryCount;
     pShadingRatePaletteEntries = nullptr;
     if (src->pShadingRatePaletteEntries) {
-        pShadingRatePaletteEntries = new VkShadingRatePaletteEntryNV[src->shadingRatePaletteEntryCount];
+        pShadingRatePaletteEntries = vl_safe_new_array<VkShadingRatePaletteEntryNV>(src->shadingRatePaletteEntryCount);
         memcpy ((void *)pShadingRatePaletteEntries, (void *)src->pShadingRatePaletteEntries, sizeof(VkShadingRatePaletteEntryNV)*src->shadingRatePaletteEntryCount);
     }
 }
@@ -20505,7 +24920,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::safe_VkPipelineViewpor
     pShadingRatePalettes(nullptr)
 {
     if (viewportCount && in_struct->pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = vl_safe_new_array<safe_VkShadingRatePaletteNV>(viewportCount);
         for (uint32_t i=0; i<viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&in_struct->pShadingRatePalettes[i]);
         }
@@ -20524,7 +24939,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::safe_VkPipelineViewpor
     viewportCount = src.viewportCount;
     pShadingRatePalettes = nullptr;
     if (viewportCount && src.pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = vl_safe_new_array<safe_VkShadingRatePaletteNV>(viewportCount);
         for (uint32_t i=0; i<viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&src.pShadingRatePalettes[i]);
         }
@@ -20536,7 +24951,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewpor
     if (&src == this) return *this;
 
     if (pShadingRatePalettes)
-        delete[] pShadingRatePalettes;
+        vl_safe_delete_array(pShadingRatePalettes);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -20544,7 +24959,7 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewpor
     viewportCount = src.viewportCount;
     pShadingRatePalettes = nullptr;
     if (viewportCount && src.pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = vl_safe_new_array<safe_VkShadingRatePaletteNV>(viewportCount);
         for (uint32_t i=0; i<viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&src.pShadingRatePalettes[i]);
         }
@@ -20553,10 +24968,27 @@ safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewpor
     return *this;
 }
 
+safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportShadingRateImageStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
+}
+
+safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::operator=(safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportShadingRateImageStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::~safe_VkPipelineViewportShadingRateImageStateCreateInfoNV()
 {
     if (pShadingRatePalettes)
-        delete[] pShadingRatePalettes;
+        vl_safe_delete_array(pShadingRatePalettes);
 }
 
 void safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::initialize(const VkPipelineViewportShadingRateImageStateCreateInfoNV* in_struct)
@@ -20567,7 +24999,7 @@ void safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::initialize(const
     viewportCount = in_struct->viewportCount;
     pShadingRatePalettes = nullptr;
     if (viewportCount && in_struct->pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = vl_safe_new_array<safe_VkShadingRatePaletteNV>(viewportCount);
         for (uint32_t i=0; i<viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&in_struct->pShadingRatePalettes[i]);
         }
@@ -20582,7 +25014,7 @@ void safe_VkPipelineViewportShadingRateImageStateCreateInfoNV::initialize(const
     viewportCount = src->viewportCount;
     pShadingRatePalettes = nullptr;
     if (viewportCount && src->pShadingRatePalettes) {
-        pShadingRatePalettes = new safe_VkShadingRatePaletteNV[viewportCount];
+        pShadingRatePalettes = vl_safe_new_array<safe_VkShadingRatePaletteNV>(viewportCount);
         for (uint32_t i=0; i<viewportCount; ++i) {
             pShadingRatePalettes[i].initialize(&src->pShadingRatePalettes[i]);
         }
@@ -20621,6 +25053,23 @@ safe_VkPhysicalDeviceShadingRateImageFeaturesNV& safe_VkPhysicalDeviceShadingRat
     return *this;
 }
 
+safe_VkPhysicalDeviceShadingRateImageFeaturesNV::safe_VkPhysicalDeviceShadingRateImageFeaturesNV(safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShadingRateImageFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
+}
+
+safe_VkPhysicalDeviceShadingRateImageFeaturesNV& safe_VkPhysicalDeviceShadingRateImageFeaturesNV::operator=(safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShadingRateImageFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShadingRateImageFeaturesNV::~safe_VkPhysicalDeviceShadingRateImageFeaturesNV()
 {
 }
@@ -20676,6 +25125,23 @@ safe_VkPhysicalDeviceShadingRateImagePropertiesNV& safe_VkPhysicalDeviceShadingR
     return *this;
 }
 
+safe_VkPhysicalDeviceShadingRateImagePropertiesNV::safe_VkPhysicalDeviceShadingRateImagePropertiesNV(safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShadingRateImagePropertiesNV));
+    new (&src) safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
+}
+
+safe_VkPhysicalDeviceShadingRateImagePropertiesNV& safe_VkPhysicalDeviceShadingRateImagePropertiesNV::operator=(safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShadingRateImagePropertiesNV));
+    new (&src) safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShadingRateImagePropertiesNV::~safe_VkPhysicalDeviceShadingRateImagePropertiesNV()
 {
 }
@@ -20705,7 +25171,7 @@ safe_VkCoarseSampleOrderCustomNV::safe_VkCoarseSampleOrderCustomNV(const VkCoars
     pSampleLocations(nullptr)
 {
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[in_struct->sampleLocationCount];
+        pSampleLocations = vl_safe_new_array<VkCoarseSampleLocationNV>(in_struct->sampleLocationCount);
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkCoarseSampleLocationNV)*in_struct->sampleLocationCount);
     }
 }
@@ -20721,7 +25187,7 @@ safe_VkCoarseSampleOrderCustomNV::safe_VkCoarseSampleOrderCustomNV(const safe_Vk
     sampleLocationCount = src.sampleLocationCount;
     pSampleLocations = nullptr;
     if (src.pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[src.sampleLocationCount];
+        pSampleLocations = vl_safe_new_array<VkCoarseSampleLocationNV>(src.sampleLocationCount);
         memcpy ((void *)pSampleLocations, (void *)src.pSampleLocations, sizeof(VkCoarseSampleLocationNV)*src.sampleLocationCount);
     }
 }
@@ -20731,24 +25197,41 @@ safe_VkCoarseSampleOrderCustomNV& safe_VkCoarseSampleOrderCustomNV::operator=(co
     if (&src == this) return *this;
 
     if (pSampleLocations)
-        delete[] pSampleLocations;
+        vl_safe_delete_array(pSampleLocations);
 
     shadingRate = src.shadingRate;
     sampleCount = src.sampleCount;
     sampleLocationCount = src.sampleLocationCount;
     pSampleLocations = nullptr;
     if (src.pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[src.sampleLocationCount];
+        pSampleLocations = vl_safe_new_array<VkCoarseSampleLocationNV>(src.sampleLocationCount);
         memcpy ((void *)pSampleLocations, (void *)src.pSampleLocations, sizeof(VkCoarseSampleLocationNV)*src.sampleLocationCount);
     }
 
     return *this;
 }
 
+safe_VkCoarseSampleOrderCustomNV::safe_VkCoarseSampleOrderCustomNV(safe_VkCoarseSampleOrderCustomNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCoarseSampleOrderCustomNV));
+    new (&src) safe_VkCoarseSampleOrderCustomNV();
+}
+
+safe_VkCoarseSampleOrderCustomNV& safe_VkCoarseSampleOrderCustomNV::operator=(safe_VkCoarseSampleOrderCustomNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCoarseSampleOrderCustomNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCoarseSampleOrderCustomNV));
+    new (&src) safe_VkCoarseSampleOrderCustomNV();
+
+    return *this;
+}
+
 safe_VkCoarseSampleOrderCustomNV::~safe_VkCoarseSampleOrderCustomNV()
 {
     if (pSampleLocations)
-        delete[] pSampleLocations;
+        vl_safe_delete_array(pSampleLocations);
 }
 
 void safe_VkCoarseSampleOrderCustomNV::initialize(const VkCoarseSampleOrderCustomNV* in_struct)
@@ -20758,7 +25241,7 @@ void safe_VkCoarseSampleOrderCustomNV::initialize(const VkCoarseSampleOrderCusto
     sampleLocationCount = in_struct->sampleLocationCount;
     pSampleLocations = nullptr;
     if (in_struct->pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[in_struct->sampleLocationCount];
+        pSampleLocations = vl_safe_new_array<VkCoarseSampleLocationNV>(in_struct->sampleLocationCount);
         memcpy ((void *)pSampleLocations, (void *)in_struct->pSampleLocations, sizeof(VkCoarseSampleLocationNV)*in_struct->sampleLocationCount);
     }
 }
@@ -20770,7 +25253,7 @@ void safe_VkCoarseSampleOrderCustomNV::initialize(const safe_VkCoarseSampleOrder
     sampleLocationCount = src->sampleLocationCount;
     pSampleLocations = nullptr;
     if (src->pSampleLocations) {
-        pSampleLocations = new VkCoarseSampleLocationNV[src->sampleLocationCount];
+        pSampleLocations = vl_safe_new_array<VkCoarseSampleLocationNV>(src->sampleLocationCount);
         memcpy ((void *)pSampleLocations, (void *)src->pSampleLocations, sizeof(VkCoarseSampleLocationNV)*src->sampleLocationCount);
     }
 }
@@ -20783,7 +25266,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::safe_VkPipelineViewpo
     pCustomSampleOrders(nullptr)
 {
     if (customSampleOrderCount && in_struct->pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = vl_safe_new_array<safe_VkCoarseSampleOrderCustomNV>(customSampleOrderCount);
         for (uint32_t i=0; i<customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&in_struct->pCustomSampleOrders[i]);
         }
@@ -20802,7 +25285,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::safe_VkPipelineViewpo
     customSampleOrderCount = src.customSampleOrderCount;
     pCustomSampleOrders = nullptr;
     if (customSampleOrderCount && src.pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = vl_safe_new_array<safe_VkCoarseSampleOrderCustomNV>(customSampleOrderCount);
         for (uint32_t i=0; i<customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&src.pCustomSampleOrders[i]);
         }
@@ -20814,7 +25297,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewpo
     if (&src == this) return *this;
 
     if (pCustomSampleOrders)
-        delete[] pCustomSampleOrders;
+        vl_safe_delete_array(pCustomSampleOrders);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -20822,7 +25305,7 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewpo
     customSampleOrderCount = src.customSampleOrderCount;
     pCustomSampleOrders = nullptr;
     if (customSampleOrderCount && src.pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = vl_safe_new_array<safe_VkCoarseSampleOrderCustomNV>(customSampleOrderCount);
         for (uint32_t i=0; i<customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&src.pCustomSampleOrders[i]);
         }
@@ -20831,10 +25314,27 @@ safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewpo
     return *this;
 }
 
+safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
+}
+
+safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::operator=(safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::~safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV()
 {
     if (pCustomSampleOrders)
-        delete[] pCustomSampleOrders;
+        vl_safe_delete_array(pCustomSampleOrders);
 }
 
 void safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::initialize(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* in_struct)
@@ -20845,7 +25345,7 @@ void safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::initialize(const
     customSampleOrderCount = in_struct->customSampleOrderCount;
     pCustomSampleOrders = nullptr;
     if (customSampleOrderCount && in_struct->pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = vl_safe_new_array<safe_VkCoarseSampleOrderCustomNV>(customSampleOrderCount);
         for (uint32_t i=0; i<customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&in_struct->pCustomSampleOrders[i]);
         }
@@ -20860,7 +25360,7 @@ void safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV::initialize(const
     customSampleOrderCount = src->customSampleOrderCount;
     pCustomSampleOrders = nullptr;
     if (customSampleOrderCount && src->pCustomSampleOrders) {
-        pCustomSampleOrders = new safe_VkCoarseSampleOrderCustomNV[customSampleOrderCount];
+        pCustomSampleOrders = vl_safe_new_array<safe_VkCoarseSampleOrderCustomNV>(customSampleOrderCount);
         for (uint32_t i=0; i<customSampleOrderCount; ++i) {
             pCustomSampleOrders[i].initialize(&src->pCustomSampleOrders[i]);
         }
@@ -20908,6 +25408,23 @@ safe_VkRayTracingShaderGroupCreateInfoNV& safe_VkRayTracingShaderGroupCreateInfo
     return *this;
 }
 
+safe_VkRayTracingShaderGroupCreateInfoNV::safe_VkRayTracingShaderGroupCreateInfoNV(safe_VkRayTracingShaderGroupCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRayTracingShaderGroupCreateInfoNV));
+    new (&src) safe_VkRayTracingShaderGroupCreateInfoNV();
+}
+
+safe_VkRayTracingShaderGroupCreateInfoNV& safe_VkRayTracingShaderGroupCreateInfoNV::operator=(safe_VkRayTracingShaderGroupCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRayTracingShaderGroupCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRayTracingShaderGroupCreateInfoNV));
+    new (&src) safe_VkRayTracingShaderGroupCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkRayTracingShaderGroupCreateInfoNV::~safe_VkRayTracingShaderGroupCreateInfoNV()
 {
 }
@@ -20948,13 +25465,13 @@ safe_VkRayTracingPipelineCreateInfoNV::safe_VkRayTracingPipelineCreateInfoNV(con
     basePipelineIndex(in_struct->basePipelineIndex)
 {
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = vl_safe_new_array<safe_VkRayTracingShaderGroupCreateInfoNV>(groupCount);
         for (uint32_t i=0; i<groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
@@ -20980,13 +25497,13 @@ safe_VkRayTracingPipelineCreateInfoNV::safe_VkRayTracingPipelineCreateInfoNV(con
     basePipelineHandle = src.basePipelineHandle;
     basePipelineIndex = src.basePipelineIndex;
     if (stageCount && src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&src.pStages[i]);
         }
     }
     if (groupCount && src.pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = vl_safe_new_array<safe_VkRayTracingShaderGroupCreateInfoNV>(groupCount);
         for (uint32_t i=0; i<groupCount; ++i) {
             pGroups[i].initialize(&src.pGroups[i]);
         }
@@ -20998,9 +25515,9 @@ safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::op
     if (&src == this) return *this;
 
     if (pStages)
-        delete[] pStages;
+        vl_safe_delete_array(pStages);
     if (pGroups)
-        delete[] pGroups;
+        vl_safe_delete_array(pGroups);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -21014,13 +25531,13 @@ safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::op
     basePipelineHandle = src.basePipelineHandle;
     basePipelineIndex = src.basePipelineIndex;
     if (stageCount && src.pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&src.pStages[i]);
         }
     }
     if (groupCount && src.pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = vl_safe_new_array<safe_VkRayTracingShaderGroupCreateInfoNV>(groupCount);
         for (uint32_t i=0; i<groupCount; ++i) {
             pGroups[i].initialize(&src.pGroups[i]);
         }
@@ -21029,12 +25546,29 @@ safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::op
     return *this;
 }
 
+safe_VkRayTracingPipelineCreateInfoNV::safe_VkRayTracingPipelineCreateInfoNV(safe_VkRayTracingPipelineCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRayTracingPipelineCreateInfoNV));
+    new (&src) safe_VkRayTracingPipelineCreateInfoNV();
+}
+
+safe_VkRayTracingPipelineCreateInfoNV& safe_VkRayTracingPipelineCreateInfoNV::operator=(safe_VkRayTracingPipelineCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRayTracingPipelineCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRayTracingPipelineCreateInfoNV));
+    new (&src) safe_VkRayTracingPipelineCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkRayTracingPipelineCreateInfoNV::~safe_VkRayTracingPipelineCreateInfoNV()
 {
     if (pStages)
-        delete[] pStages;
+        vl_safe_delete_array(pStages);
     if (pGroups)
-        delete[] pGroups;
+        vl_safe_delete_array(pGroups);
 }
 
 void safe_VkRayTracingPipelineCreateInfoNV::initialize(const VkRayTracingPipelineCreateInfoNV* in_struct)
@@ -21051,13 +25585,13 @@ void safe_VkRayTracingPipelineCreateInfoNV::initialize(const VkRayTracingPipelin
     basePipelineHandle = in_struct->basePipelineHandle;
     basePipelineIndex = in_struct->basePipelineIndex;
     if (stageCount && in_struct->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&in_struct->pStages[i]);
         }
     }
     if (groupCount && in_struct->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = vl_safe_new_array<safe_VkRayTracingShaderGroupCreateInfoNV>(groupCount);
         for (uint32_t i=0; i<groupCount; ++i) {
             pGroups[i].initialize(&in_struct->pGroups[i]);
         }
@@ -21078,13 +25612,13 @@ void safe_VkRayTracingPipelineCreateInfoNV::initialize(const safe_VkRayTracingPi
     basePipelineHandle = src->basePipelineHandle;
     basePipelineIndex = src->basePipelineIndex;
     if (stageCount && src->pStages) {
-        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];
+        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);
         for (uint32_t i=0; i<stageCount; ++i) {
             pStages[i].initialize(&src->pStages[i]);
         }
     }
     if (groupCount && src->pGroups) {
-        pGroups = new safe_VkRayTracingShaderGroupCreateInfoNV[groupCount];
+        pGroups = vl_safe_new_array<safe_VkRayTracingShaderGroupCreateInfoNV>(groupCount);
         for (uint32_t i=0; i<groupCount; ++i) {
             pGroups[i].initialize(&src->pGroups[i]);
         }
@@ -21150,6 +25684,23 @@ safe_VkGeometryTrianglesNV& safe_VkGeometryTrianglesNV::operator=(const safe_VkG
     return *this;
 }
 
+safe_VkGeometryTrianglesNV::safe_VkGeometryTrianglesNV(safe_VkGeometryTrianglesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGeometryTrianglesNV));
+    new (&src) safe_VkGeometryTrianglesNV();
+}
+
+safe_VkGeometryTrianglesNV& safe_VkGeometryTrianglesNV::operator=(safe_VkGeometryTrianglesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkGeometryTrianglesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGeometryTrianglesNV));
+    new (&src) safe_VkGeometryTrianglesNV();
+
+    return *this;
+}
+
 safe_VkGeometryTrianglesNV::~safe_VkGeometryTrianglesNV()
 {
 }
@@ -21226,6 +25777,23 @@ safe_VkGeometryAABBNV& safe_VkGeometryAABBNV::operator=(const safe_VkGeometryAAB
     return *this;
 }
 
+safe_VkGeometryAABBNV::safe_VkGeometryAABBNV(safe_VkGeometryAABBNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGeometryAABBNV));
+    new (&src) safe_VkGeometryAABBNV();
+}
+
+safe_VkGeometryAABBNV& safe_VkGeometryAABBNV::operator=(safe_VkGeometryAABBNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkGeometryAABBNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGeometryAABBNV));
+    new (&src) safe_VkGeometryAABBNV();
+
+    return *this;
+}
+
 safe_VkGeometryAABBNV::~safe_VkGeometryAABBNV()
 {
 }
@@ -21285,6 +25853,23 @@ safe_VkGeometryNV& safe_VkGeometryNV::operator=(const safe_VkGeometryNV& src)
     return *this;
 }
 
+safe_VkGeometryNV::safe_VkGeometryNV(safe_VkGeometryNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGeometryNV));
+    new (&src) safe_VkGeometryNV();
+}
+
+safe_VkGeometryNV& safe_VkGeometryNV::operator=(safe_VkGeometryNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkGeometryNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkGeometryNV));
+    new (&src) safe_VkGeometryNV();
+
+    return *this;
+}
+
 safe_VkGeometryNV::~safe_VkGeometryNV()
 {
 }
@@ -21317,7 +25902,7 @@ safe_VkAccelerationStructureInfoNV::safe_VkAccelerationStructureInfoNV(const VkA
     pGeometries(nullptr)
 {
     if (geometryCount && in_struct->pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = vl_safe_new_array<safe_VkGeometryNV>(geometryCount);
         for (uint32_t i=0; i<geometryCount; ++i) {
             pGeometries[i].initialize(&in_struct->pGeometries[i]);
         }
@@ -21338,7 +25923,7 @@ safe_VkAccelerationStructureInfoNV::safe_VkAccelerationStructureInfoNV(const saf
     geometryCount = src.geometryCount;
     pGeometries = nullptr;
     if (geometryCount && src.pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = vl_safe_new_array<safe_VkGeometryNV>(geometryCount);
         for (uint32_t i=0; i<geometryCount; ++i) {
             pGeometries[i].initialize(&src.pGeometries[i]);
         }
@@ -21350,7 +25935,7 @@ safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator
     if (&src == this) return *this;
 
     if (pGeometries)
-        delete[] pGeometries;
+        vl_safe_delete_array(pGeometries);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -21360,7 +25945,7 @@ safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator
     geometryCount = src.geometryCount;
     pGeometries = nullptr;
     if (geometryCount && src.pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = vl_safe_new_array<safe_VkGeometryNV>(geometryCount);
         for (uint32_t i=0; i<geometryCount; ++i) {
             pGeometries[i].initialize(&src.pGeometries[i]);
         }
@@ -21369,10 +25954,27 @@ safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator
     return *this;
 }
 
+safe_VkAccelerationStructureInfoNV::safe_VkAccelerationStructureInfoNV(safe_VkAccelerationStructureInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAccelerationStructureInfoNV));
+    new (&src) safe_VkAccelerationStructureInfoNV();
+}
+
+safe_VkAccelerationStructureInfoNV& safe_VkAccelerationStructureInfoNV::operator=(safe_VkAccelerationStructureInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAccelerationStructureInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAccelerationStructureInfoNV));
+    new (&src) safe_VkAccelerationStructureInfoNV();
+
+    return *this;
+}
+
 safe_VkAccelerationStructureInfoNV::~safe_VkAccelerationStructureInfoNV()
 {
     if (pGeometries)
-        delete[] pGeometries;
+        vl_safe_delete_array(pGeometries);
 }
 
 void safe_VkAccelerationStructureInfoNV::initialize(const VkAccelerationStructureInfoNV* in_struct)
@@ -21385,7 +25987,7 @@ void safe_VkAccelerationStructureInfoNV::initialize(const VkAccelerationStructur
     geometryCount = in_struct->geometryCount;
     pGeometries = nullptr;
     if (geometryCount && in_struct->pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = vl_safe_new_array<safe_VkGeometryNV>(geometryCount);
         for (uint32_t i=0; i<geometryCount; ++i) {
             pGeometries[i].initialize(&in_struct->pGeometries[i]);
         }
@@ -21402,7 +26004,7 @@ void safe_VkAccelerationStructureInfoNV::initialize(const safe_VkAccelerationStr
     geometryCount = src->geometryCount;
     pGeometries = nullptr;
     if (geometryCount && src->pGeometries) {
-        pGeometries = new safe_VkGeometryNV[geometryCount];
+        pGeometries = vl_safe_new_array<safe_VkGeometryNV>(geometryCount);
         for (uint32_t i=0; i<geometryCount; ++i) {
             pGeometries[i].initialize(&src->pGeometries[i]);
         }
@@ -21441,6 +26043,23 @@ safe_VkAccelerationStructureCreateInfoNV& safe_VkAccelerationStructureCreateInfo
     return *this;
 }
 
+safe_VkAccelerationStructureCreateInfoNV::safe_VkAccelerationStructureCreateInfoNV(safe_VkAccelerationStructureCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAccelerationStructureCreateInfoNV));
+    new (&src) safe_VkAccelerationStructureCreateInfoNV();
+}
+
+safe_VkAccelerationStructureCreateInfoNV& safe_VkAccelerationStructureCreateInfoNV::operator=(safe_VkAccelerationStructureCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAccelerationStructureCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAccelerationStructureCreateInfoNV));
+    new (&src) safe_VkAccelerationStructureCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkAccelerationStructureCreateInfoNV::~safe_VkAccelerationStructureCreateInfoNV()
 {
 }
@@ -21471,7 +26090,7 @@ safe_VkBindAccelerationStructureMemoryInfoNV::safe_VkBindAccelerationStructureMe
     pDeviceIndices(nullptr)
 {
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -21490,7 +26109,7 @@ safe_VkBindAccelerationStructureMemoryInfoNV::safe_VkBindAccelerationStructureMe
     deviceIndexCount = src.deviceIndexCount;
     pDeviceIndices = nullptr;
     if (src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src.deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src.deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src.pDeviceIndices, sizeof(uint32_t)*src.deviceIndexCount);
     }
 }
@@ -21500,7 +26119,7 @@ safe_VkBindAccelerationStructureMemoryInfoNV& safe_VkBindAccelerationStructureMe
     if (&src == this) return *this;
 
     if (pDeviceIndices)
-        delete[] pDeviceIndices;
+        vl_safe_delete_array(pDeviceIndices);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -21510,17 +26129,34 @@ safe_VkBindAccelerationStructureMemoryInfoNV& safe_VkBindAccelerationStructureMe
     deviceIndexCount = src.deviceIndexCount;
     pDeviceIndices = nullptr;
     if (src.pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src.deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src.deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src.pDeviceIndices, sizeof(uint32_t)*src.deviceIndexCount);
     }
 
     return *this;
 }
 
+safe_VkBindAccelerationStructureMemoryInfoNV::safe_VkBindAccelerationStructureMemoryInfoNV(safe_VkBindAccelerationStructureMemoryInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindAccelerationStructureMemoryInfoNV));
+    new (&src) safe_VkBindAccelerationStructureMemoryInfoNV();
+}
+
+safe_VkBindAccelerationStructureMemoryInfoNV& safe_VkBindAccelerationStructureMemoryInfoNV::operator=(safe_VkBindAccelerationStructureMemoryInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBindAccelerationStructureMemoryInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBindAccelerationStructureMemoryInfoNV));
+    new (&src) safe_VkBindAccelerationStructureMemoryInfoNV();
+
+    return *this;
+}
+
 safe_VkBindAccelerationStructureMemoryInfoNV::~safe_VkBindAccelerationStructureMemoryInfoNV()
 {
     if (pDeviceIndices)
-        delete[] pDeviceIndices;
+        vl_safe_delete_array(pDeviceIndices);
 }
 
 void safe_VkBindAccelerationStructureMemoryInfoNV::initialize(const VkBindAccelerationStructureMemoryInfoNV* in_struct)
@@ -21533,7 +26169,7 @@ void safe_VkBindAccelerationStructureMemoryInfoNV::initialize(const VkBindAccele
     deviceIndexCount = in_struct->deviceIndexCount;
     pDeviceIndices = nullptr;
     if (in_struct->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[in_struct->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(in_struct->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)in_struct->pDeviceIndices, sizeof(uint32_t)*in_struct->deviceIndexCount);
     }
 }
@@ -21548,7 +26184,7 @@ void safe_VkBindAccelerationStructureMemoryInfoNV::initialize(const safe_VkBindA
     deviceIndexCount = src->deviceIndexCount;
     pDeviceIndices = nullptr;
     if (src->pDeviceIndices) {
-        pDeviceIndices = new uint32_t[src->deviceIndexCount];
+        pDeviceIndices = vl_safe_new_array<uint32_t>(src->deviceIndexCount);
         memcpy ((void *)pDeviceIndices, (void *)src->pDeviceIndices, sizeof(uint32_t)*src->deviceIndexCount);
     }
 }
@@ -21560,10 +26196,8 @@ safe_VkWriteDescriptorSetAccelerationStructureNV::safe_VkWriteDescriptorSetAccel
     pAccelerationStructures(nullptr)
 {
     if (accelerationStructureCount && in_struct->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
-        for (uint32_t i=0; i<accelerationStructureCount; ++i) {
-            pAccelerationStructures[i] = in_struct->pAccelerationStructures[i];
-        }
+        pAccelerationStructures = vl_safe_new_array<VkAccelerationStructureNV>(accelerationStructureCount);
+        memcpy ((void *)pAccelerationStructures, (void *)in_struct->pAccelerationStructures, sizeof(VkAccelerationStructureNV)*accelerationStructureCount);
     }
 }
 
@@ -21578,10 +26212,8 @@ safe_VkWriteDescriptorSetAccelerationStructureNV::safe_VkWriteDescriptorSetAccel
     accelerationStructureCount = src.accelerationStructureCount;
     pAccelerationStructures = nullptr;
     if (accelerationStructureCount && src.pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
-        for (uint32_t i=0; i<accelerationStructureCount; ++i) {
-            pAccelerationStructures[i] = src.pAccelerationStructures[i];
-        }
+        pAccelerationStructures = vl_safe_new_array<VkAccelerationStructureNV>(accelerationStructureCount);
+        memcpy ((void *)pAccelerationStructures, (void *)src.pAccelerationStructures, sizeof(VkAccelerationStructureNV)*accelerationStructureCount);
     }
 }
 
@@ -21590,26 +26222,41 @@ safe_VkWriteDescriptorSetAccelerationStructureNV& safe_VkWriteDescriptorSetAccel
     if (&src == this) return *this;
 
     if (pAccelerationStructures)
-        delete[] pAccelerationStructures;
+        vl_safe_delete_array(pAccelerationStructures);
 
     sType = src.sType;
     pNext = src.pNext;
     accelerationStructureCount = src.accelerationStructureCount;
     pAccelerationStructures = nullptr;
     if (accelerationStructureCount && src.pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
-        for (uint32_t i=0; i<accelerationStructureCount; ++i) {
-            pAccelerationStructures[i] = src.pAccelerationStructures[i];
-        }
+        pAccelerationStructures = vl_safe_new_array<VkAccelerationStructureNV>(accelerationStructureCount);
+        memcpy ((void *)pAccelerationStructures, (void *)src.pAccelerationStructures, sizeof(VkAccelerationStructureNV)*accelerationStructureCount);
     }
 
     return *this;
 }
 
+safe_VkWriteDescriptorSetAccelerationStructureNV::safe_VkWriteDescriptorSetAccelerationStructureNV(safe_VkWriteDescriptorSetAccelerationStructureNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWriteDescriptorSetAccelerationStructureNV));
+    new (&src) safe_VkWriteDescriptorSetAccelerationStructureNV();
+}
+
+safe_VkWriteDescriptorSetAccelerationStructureNV& safe_VkWriteDescriptorSetAccelerationStructureNV::operator=(safe_VkWriteDescriptorSetAccelerationStructureNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkWriteDescriptorSetAccelerationStructureNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkWriteDescriptorSetAccelerationStructureNV));
+    new (&src) safe_VkWriteDescriptorSetAccelerationStructureNV();
+
+    return *this;
+}
+
 safe_VkWriteDescriptorSetAccelerationStructureNV::~safe_VkWriteDescriptorSetAccelerationStructureNV()
 {
     if (pAccelerationStructures)
-        delete[] pAccelerationStructures;
+        vl_safe_delete_array(pAccelerationStructures);
 }
 
 void safe_VkWriteDescriptorSetAccelerationStructureNV::initialize(const VkWriteDescriptorSetAccelerationStructureNV* in_struct)
@@ -21619,10 +26266,8 @@ void safe_VkWriteDescriptorSetAccelerationStructureNV::initialize(const VkWriteD
     accelerationStructureCount = in_struct->accelerationStructureCount;
     pAccelerationStructures = nullptr;
     if (accelerationStructureCount && in_struct->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
-        for (uint32_t i=0; i<accelerationStructureCount; ++i) {
-            pAccelerationStructures[i] = in_struct->pAccelerationStructures[i];
-        }
+        pAccelerationStructures = vl_safe_new_array<VkAccelerationStructureNV>(accelerationStructureCount);
+        memcpy ((void *)pAccelerationStructures, (void *)in_struct->pAccelerationStructures, sizeof(VkAccelerationStructureNV)*accelerationStructureCount);
     }
 }
 
@@ -21633,10 +26278,8 @@ void safe_VkWriteDescriptorSetAccelerationStructureNV::initialize(const safe_VkW
     accelerationStructureCount = src->accelerationStructureCount;
     pAccelerationStructures = nullptr;
     if (accelerationStructureCount && src->pAccelerationStructures) {
-        pAccelerationStructures = new VkAccelerationStructureNV[accelerationStructureCount];
-        for (uint32_t i=0; i<accelerationStructureCount; ++i) {
-            pAccelerationStructures[i] = src->pAccelerationStructures[i];
-        }
+        pAccelerationStructures = vl_safe_new_array<VkAccelerationStructureNV>(accelerationStructureCount);
+        memcpy ((void *)pAccelerationStructures, (void *)src->pAccelerationStructures, sizeof(VkAccelerationStructureNV)*accelerationStructureCount);
     }
 }
 
@@ -21672,6 +26315,23 @@ safe_VkAccelerationStructureMemoryRequirementsInfoNV& safe_VkAccelerationStructu
     return *this;
 }
 
+safe_VkAccelerationStructureMemoryRequirementsInfoNV::safe_VkAccelerationStructureMemoryRequirementsInfoNV(safe_VkAccelerationStructureMemoryRequirementsInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAccelerationStructureMemoryRequirementsInfoNV));
+    new (&src) safe_VkAccelerationStructureMemoryRequirementsInfoNV();
+}
+
+safe_VkAccelerationStructureMemoryRequirementsInfoNV& safe_VkAccelerationStructureMemoryRequirementsInfoNV::operator=(safe_VkAccelerationStructureMemoryRequirementsInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkAccelerationStructureMemoryRequirementsInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkAccelerationStructureMemoryRequirementsInfoNV));
+    new (&src) safe_VkAccelerationStructureMemoryRequirementsInfoNV();
+
+    return *this;
+}
+
 safe_VkAccelerationStructureMemoryRequirementsInfoNV::~safe_VkAccelerationStructureMemoryRequirementsInfoNV()
 {
 }
@@ -21742,6 +26402,23 @@ safe_VkPhysicalDeviceRayTracingPropertiesNV& safe_VkPhysicalDeviceRayTracingProp
     return *this;
 }
 
+safe_VkPhysicalDeviceRayTracingPropertiesNV::safe_VkPhysicalDeviceRayTracingPropertiesNV(safe_VkPhysicalDeviceRayTracingPropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceRayTracingPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceRayTracingPropertiesNV();
+}
+
+safe_VkPhysicalDeviceRayTracingPropertiesNV& safe_VkPhysicalDeviceRayTracingPropertiesNV::operator=(safe_VkPhysicalDeviceRayTracingPropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceRayTracingPropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceRayTracingPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceRayTracingPropertiesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRayTracingPropertiesNV::~safe_VkPhysicalDeviceRayTracingPropertiesNV()
 {
 }
@@ -21803,6 +26480,23 @@ safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& safe_VkPhysicalDevice
     return *this;
 }
 
+safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV::safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
+}
+
+safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV::operator=(safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV::~safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV()
 {
 }
@@ -21850,6 +26544,23 @@ safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& safe_VkPipelineRepre
     return *this;
 }
 
+safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV::safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV));
+    new (&src) safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
+}
+
+safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV::operator=(safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV));
+    new (&src) safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV::~safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV()
 {
 }
@@ -21897,6 +26608,23 @@ safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& safe_VkPhysicalDeviceImageView
     return *this;
 }
 
+safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT));
+    new (&src) safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
+}
+
+safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::operator=(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT));
+    new (&src) safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceImageViewImageFormatInfoEXT::~safe_VkPhysicalDeviceImageViewImageFormatInfoEXT()
 {
 }
@@ -21947,6 +26675,23 @@ safe_VkFilterCubicImageViewImageFormatPropertiesEXT& safe_VkFilterCubicImageView
     return *this;
 }
 
+safe_VkFilterCubicImageViewImageFormatPropertiesEXT::safe_VkFilterCubicImageViewImageFormatPropertiesEXT(safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFilterCubicImageViewImageFormatPropertiesEXT));
+    new (&src) safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
+}
+
+safe_VkFilterCubicImageViewImageFormatPropertiesEXT& safe_VkFilterCubicImageViewImageFormatPropertiesEXT::operator=(safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFilterCubicImageViewImageFormatPropertiesEXT));
+    new (&src) safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkFilterCubicImageViewImageFormatPropertiesEXT::~safe_VkFilterCubicImageViewImageFormatPropertiesEXT()
 {
 }
@@ -21996,6 +26741,23 @@ safe_VkDeviceQueueGlobalPriorityCreateInfoEXT& safe_VkDeviceQueueGlobalPriorityC
     return *this;
 }
 
+safe_VkDeviceQueueGlobalPriorityCreateInfoEXT::safe_VkDeviceQueueGlobalPriorityCreateInfoEXT(safe_VkDeviceQueueGlobalPriorityCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceQueueGlobalPriorityCreateInfoEXT));
+    new (&src) safe_VkDeviceQueueGlobalPriorityCreateInfoEXT();
+}
+
+safe_VkDeviceQueueGlobalPriorityCreateInfoEXT& safe_VkDeviceQueueGlobalPriorityCreateInfoEXT::operator=(safe_VkDeviceQueueGlobalPriorityCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceQueueGlobalPriorityCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceQueueGlobalPriorityCreateInfoEXT));
+    new (&src) safe_VkDeviceQueueGlobalPriorityCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkDeviceQueueGlobalPriorityCreateInfoEXT::~safe_VkDeviceQueueGlobalPriorityCreateInfoEXT()
 {
 }
@@ -22046,6 +26808,23 @@ safe_VkImportMemoryHostPointerInfoEXT& safe_VkImportMemoryHostPointerInfoEXT::op
     return *this;
 }
 
+safe_VkImportMemoryHostPointerInfoEXT::safe_VkImportMemoryHostPointerInfoEXT(safe_VkImportMemoryHostPointerInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryHostPointerInfoEXT));
+    new (&src) safe_VkImportMemoryHostPointerInfoEXT();
+}
+
+safe_VkImportMemoryHostPointerInfoEXT& safe_VkImportMemoryHostPointerInfoEXT::operator=(safe_VkImportMemoryHostPointerInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImportMemoryHostPointerInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImportMemoryHostPointerInfoEXT));
+    new (&src) safe_VkImportMemoryHostPointerInfoEXT();
+
+    return *this;
+}
+
 safe_VkImportMemoryHostPointerInfoEXT::~safe_VkImportMemoryHostPointerInfoEXT()
 {
 }
@@ -22095,6 +26874,23 @@ safe_VkMemoryHostPointerPropertiesEXT& safe_VkMemoryHostPointerPropertiesEXT::op
     return *this;
 }
 
+safe_VkMemoryHostPointerPropertiesEXT::safe_VkMemoryHostPointerPropertiesEXT(safe_VkMemoryHostPointerPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryHostPointerPropertiesEXT));
+    new (&src) safe_VkMemoryHostPointerPropertiesEXT();
+}
+
+safe_VkMemoryHostPointerPropertiesEXT& safe_VkMemoryHostPointerPropertiesEXT::operator=(safe_VkMemoryHostPointerPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryHostPointerPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryHostPointerPropertiesEXT));
+    new (&src) safe_VkMemoryHostPointerPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkMemoryHostPointerPropertiesEXT::~safe_VkMemoryHostPointerPropertiesEXT()
 {
 }
@@ -22142,6 +26938,23 @@ safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& safe_VkPhysicalDeviceExter
     return *this;
 }
 
+safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT::safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT::operator=(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT::~safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT()
 {
 }
@@ -22189,6 +27002,23 @@ safe_VkCalibratedTimestampInfoEXT& safe_VkCalibratedTimestampInfoEXT::operator=(
     return *this;
 }
 
+safe_VkCalibratedTimestampInfoEXT::safe_VkCalibratedTimestampInfoEXT(safe_VkCalibratedTimestampInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCalibratedTimestampInfoEXT));
+    new (&src) safe_VkCalibratedTimestampInfoEXT();
+}
+
+safe_VkCalibratedTimestampInfoEXT& safe_VkCalibratedTimestampInfoEXT::operator=(safe_VkCalibratedTimestampInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCalibratedTimestampInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCalibratedTimestampInfoEXT));
+    new (&src) safe_VkCalibratedTimestampInfoEXT();
+
+    return *this;
+}
+
 safe_VkCalibratedTimestampInfoEXT::~safe_VkCalibratedTimestampInfoEXT()
 {
 }
@@ -22275,6 +27105,23 @@ safe_VkPhysicalDeviceShaderCorePropertiesAMD& safe_VkPhysicalDeviceShaderCorePro
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderCorePropertiesAMD::safe_VkPhysicalDeviceShaderCorePropertiesAMD(safe_VkPhysicalDeviceShaderCorePropertiesAMD&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderCorePropertiesAMD));
+    new (&src) safe_VkPhysicalDeviceShaderCorePropertiesAMD();
+}
+
+safe_VkPhysicalDeviceShaderCorePropertiesAMD& safe_VkPhysicalDeviceShaderCorePropertiesAMD::operator=(safe_VkPhysicalDeviceShaderCorePropertiesAMD&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderCorePropertiesAMD();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderCorePropertiesAMD));
+    new (&src) safe_VkPhysicalDeviceShaderCorePropertiesAMD();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderCorePropertiesAMD::~safe_VkPhysicalDeviceShaderCorePropertiesAMD()
 {
 }
@@ -22348,6 +27195,23 @@ safe_VkDeviceMemoryOverallocationCreateInfoAMD& safe_VkDeviceMemoryOverallocatio
     return *this;
 }
 
+safe_VkDeviceMemoryOverallocationCreateInfoAMD::safe_VkDeviceMemoryOverallocationCreateInfoAMD(safe_VkDeviceMemoryOverallocationCreateInfoAMD&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceMemoryOverallocationCreateInfoAMD));
+    new (&src) safe_VkDeviceMemoryOverallocationCreateInfoAMD();
+}
+
+safe_VkDeviceMemoryOverallocationCreateInfoAMD& safe_VkDeviceMemoryOverallocationCreateInfoAMD::operator=(safe_VkDeviceMemoryOverallocationCreateInfoAMD&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDeviceMemoryOverallocationCreateInfoAMD();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDeviceMemoryOverallocationCreateInfoAMD));
+    new (&src) safe_VkDeviceMemoryOverallocationCreateInfoAMD();
+
+    return *this;
+}
+
 safe_VkDeviceMemoryOverallocationCreateInfoAMD::~safe_VkDeviceMemoryOverallocationCreateInfoAMD()
 {
 }
@@ -22395,6 +27259,23 @@ safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& safe_VkPhysicalDeviceV
     return *this;
 }
 
+safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT::safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT::operator=(safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT::~safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT()
 {
 }
@@ -22420,7 +27301,7 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::safe_VkPipelineVertexInputD
     pVertexBindingDivisors(nullptr)
 {
     if (in_struct->pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[in_struct->vertexBindingDivisorCount];
+        pVertexBindingDivisors = vl_safe_new_array<VkVertexInputBindingDivisorDescriptionEXT>(in_struct->vertexBindingDivisorCount);
         memcpy ((void *)pVertexBindingDivisors, (void *)in_struct->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*in_struct->vertexBindingDivisorCount);
     }
 }
@@ -22436,7 +27317,7 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::safe_VkPipelineVertexInputD
     vertexBindingDivisorCount = src.vertexBindingDivisorCount;
     pVertexBindingDivisors = nullptr;
     if (src.pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[src.vertexBindingDivisorCount];
+        pVertexBindingDivisors = vl_safe_new_array<VkVertexInputBindingDivisorDescriptionEXT>(src.vertexBindingDivisorCount);
         memcpy ((void *)pVertexBindingDivisors, (void *)src.pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*src.vertexBindingDivisorCount);
     }
 }
@@ -22446,24 +27327,41 @@ safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& safe_VkPipelineVertexInputD
     if (&src == this) return *this;
 
     if (pVertexBindingDivisors)
-        delete[] pVertexBindingDivisors;
+        vl_safe_delete_array(pVertexBindingDivisors);
 
     sType = src.sType;
     pNext = src.pNext;
     vertexBindingDivisorCount = src.vertexBindingDivisorCount;
     pVertexBindingDivisors = nullptr;
     if (src.pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[src.vertexBindingDivisorCount];
+        pVertexBindingDivisors = vl_safe_new_array<VkVertexInputBindingDivisorDescriptionEXT>(src.vertexBindingDivisorCount);
         memcpy ((void *)pVertexBindingDivisors, (void *)src.pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*src.vertexBindingDivisorCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::safe_VkPipelineVertexInputDivisorStateCreateInfoEXT(safe_VkPipelineVertexInputDivisorStateCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineVertexInputDivisorStateCreateInfoEXT));
+    new (&src) safe_VkPipelineVertexInputDivisorStateCreateInfoEXT();
+}
+
+safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::operator=(safe_VkPipelineVertexInputDivisorStateCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineVertexInputDivisorStateCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineVertexInputDivisorStateCreateInfoEXT));
+    new (&src) safe_VkPipelineVertexInputDivisorStateCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::~safe_VkPipelineVertexInputDivisorStateCreateInfoEXT()
 {
     if (pVertexBindingDivisors)
-        delete[] pVertexBindingDivisors;
+        vl_safe_delete_array(pVertexBindingDivisors);
 }
 
 void safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::initialize(const VkPipelineVertexInputDivisorStateCreateInfoEXT* in_struct)
@@ -22473,7 +27371,7 @@ void safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::initialize(const VkPip
     vertexBindingDivisorCount = in_struct->vertexBindingDivisorCount;
     pVertexBindingDivisors = nullptr;
     if (in_struct->pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[in_struct->vertexBindingDivisorCount];
+        pVertexBindingDivisors = vl_safe_new_array<VkVertexInputBindingDivisorDescriptionEXT>(in_struct->vertexBindingDivisorCount);
         memcpy ((void *)pVertexBindingDivisors, (void *)in_struct->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*in_struct->vertexBindingDivisorCount);
     }
 }
@@ -22485,7 +27383,7 @@ void safe_VkPipelineVertexInputDivisorStateCreateInfoEXT::initialize(const safe_
     vertexBindingDivisorCount = src->vertexBindingDivisorCount;
     pVertexBindingDivisors = nullptr;
     if (src->pVertexBindingDivisors) {
-        pVertexBindingDivisors = new VkVertexInputBindingDivisorDescriptionEXT[src->vertexBindingDivisorCount];
+        pVertexBindingDivisors = vl_safe_new_array<VkVertexInputBindingDivisorDescriptionEXT>(src->vertexBindingDivisorCount);
         memcpy ((void *)pVertexBindingDivisors, (void *)src->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT)*src->vertexBindingDivisorCount);
     }
 }
@@ -22522,6 +27420,23 @@ safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& safe_VkPhysicalDeviceVer
     return *this;
 }
 
+safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT::safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT(safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT::operator=(safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT::~safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT()
 {
 }
@@ -22573,6 +27488,23 @@ safe_VkPresentFrameTokenGGP& safe_VkPresentFrameTokenGGP::operator=(const safe_V
     return *this;
 }
 
+safe_VkPresentFrameTokenGGP::safe_VkPresentFrameTokenGGP(safe_VkPresentFrameTokenGGP&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentFrameTokenGGP));
+    new (&src) safe_VkPresentFrameTokenGGP();
+}
+
+safe_VkPresentFrameTokenGGP& safe_VkPresentFrameTokenGGP::operator=(safe_VkPresentFrameTokenGGP&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPresentFrameTokenGGP();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPresentFrameTokenGGP));
+    new (&src) safe_VkPresentFrameTokenGGP();
+
+    return *this;
+}
+
 safe_VkPresentFrameTokenGGP::~safe_VkPresentFrameTokenGGP()
 {
 }
@@ -22601,10 +27533,10 @@ safe_VkPipelineCreationFeedbackCreateInfoEXT::safe_VkPipelineCreationFeedbackCre
     pPipelineStageCreationFeedbacks(nullptr)
 {
     if (in_struct->pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedbackEXT(*in_struct->pPipelineCreationFeedback);
+        pPipelineCreationFeedback = vl_safe_new<VkPipelineCreationFeedbackEXT>(*in_struct->pPipelineCreationFeedback);
     }
     if (in_struct->pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedbackEXT[in_struct->pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = vl_safe_new_array<VkPipelineCreationFeedbackEXT>(in_struct->pipelineStageCreationFeedbackCount);
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)in_struct->pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedbackEXT)*in_struct->pipelineStageCreationFeedbackCount);
     }
 }
@@ -22622,10 +27554,10 @@ safe_VkPipelineCreationFeedbackCreateInfoEXT::safe_VkPipelineCreationFeedbackCre
     pipelineStageCreationFeedbackCount = src.pipelineStageCreationFeedbackCount;
     pPipelineStageCreationFeedbacks = nullptr;
     if (src.pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedbackEXT(*src.pPipelineCreationFeedback);
+        pPipelineCreationFeedback = vl_safe_new<VkPipelineCreationFeedbackEXT>(*src.pPipelineCreationFeedback);
     }
     if (src.pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedbackEXT[src.pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = vl_safe_new_array<VkPipelineCreationFeedbackEXT>(src.pipelineStageCreationFeedbackCount);
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)src.pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedbackEXT)*src.pipelineStageCreationFeedbackCount);
     }
 }
@@ -22635,9 +27567,9 @@ safe_VkPipelineCreationFeedbackCreateInfoEXT& safe_VkPipelineCreationFeedbackCre
     if (&src == this) return *this;
 
     if (pPipelineCreationFeedback)
-        delete pPipelineCreationFeedback;
+        vl_safe_delete(pPipelineCreationFeedback);
     if (pPipelineStageCreationFeedbacks)
-        delete[] pPipelineStageCreationFeedbacks;
+        vl_safe_delete_array(pPipelineStageCreationFeedbacks);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -22645,22 +27577,39 @@ safe_VkPipelineCreationFeedbackCreateInfoEXT& safe_VkPipelineCreationFeedbackCre
     pipelineStageCreationFeedbackCount = src.pipelineStageCreationFeedbackCount;
     pPipelineStageCreationFeedbacks = nullptr;
     if (src.pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedbackEXT(*src.pPipelineCreationFeedback);
+        pPipelineCreationFeedback = vl_safe_new<VkPipelineCreationFeedbackEXT>(*src.pPipelineCreationFeedback);
     }
     if (src.pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedbackEXT[src.pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = vl_safe_new_array<VkPipelineCreationFeedbackEXT>(src.pipelineStageCreationFeedbackCount);
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)src.pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedbackEXT)*src.pipelineStageCreationFeedbackCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineCreationFeedbackCreateInfoEXT::safe_VkPipelineCreationFeedbackCreateInfoEXT(safe_VkPipelineCreationFeedbackCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCreationFeedbackCreateInfoEXT));
+    new (&src) safe_VkPipelineCreationFeedbackCreateInfoEXT();
+}
+
+safe_VkPipelineCreationFeedbackCreateInfoEXT& safe_VkPipelineCreationFeedbackCreateInfoEXT::operator=(safe_VkPipelineCreationFeedbackCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineCreationFeedbackCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCreationFeedbackCreateInfoEXT));
+    new (&src) safe_VkPipelineCreationFeedbackCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkPipelineCreationFeedbackCreateInfoEXT::~safe_VkPipelineCreationFeedbackCreateInfoEXT()
 {
     if (pPipelineCreationFeedback)
-        delete pPipelineCreationFeedback;
+        vl_safe_delete(pPipelineCreationFeedback);
     if (pPipelineStageCreationFeedbacks)
-        delete[] pPipelineStageCreationFeedbacks;
+        vl_safe_delete_array(pPipelineStageCreationFeedbacks);
 }
 
 void safe_VkPipelineCreationFeedbackCreateInfoEXT::initialize(const VkPipelineCreationFeedbackCreateInfoEXT* in_struct)
@@ -22671,10 +27620,10 @@ void safe_VkPipelineCreationFeedbackCreateInfoEXT::initialize(const VkPipelineCr
     pipelineStageCreationFeedbackCount = in_struct->pipelineStageCreationFeedbackCount;
     pPipelineStageCreationFeedbacks = nullptr;
     if (in_struct->pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedbackEXT(*in_struct->pPipelineCreationFeedback);
+        pPipelineCreationFeedback = vl_safe_new<VkPipelineCreationFeedbackEXT>(*in_struct->pPipelineCreationFeedback);
     }
     if (in_struct->pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedbackEXT[in_struct->pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = vl_safe_new_array<VkPipelineCreationFeedbackEXT>(in_struct->pipelineStageCreationFeedbackCount);
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)in_struct->pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedbackEXT)*in_struct->pipelineStageCreationFeedbackCount);
     }
 }
@@ -22687,10 +27636,10 @@ void safe_VkPipelineCreationFeedbackCreateInfoEXT::initialize(const safe_VkPipel
     pipelineStageCreationFeedbackCount = src->pipelineStageCreationFeedbackCount;
     pPipelineStageCreationFeedbacks = nullptr;
     if (src->pPipelineCreationFeedback) {
-        pPipelineCreationFeedback = new VkPipelineCreationFeedbackEXT(*src->pPipelineCreationFeedback);
+        pPipelineCreationFeedback = vl_safe_new<VkPipelineCreationFeedbackEXT>(*src->pPipelineCreationFeedback);
     }
     if (src->pPipelineStageCreationFeedbacks) {
-        pPipelineStageCreationFeedbacks = new VkPipelineCreationFeedbackEXT[src->pipelineStageCreationFeedbackCount];
+        pPipelineStageCreationFeedbacks = vl_safe_new_array<VkPipelineCreationFeedbackEXT>(src->pipelineStageCreationFeedbackCount);
         memcpy ((void *)pPipelineStageCreationFeedbacks, (void *)src->pPipelineStageCreationFeedbacks, sizeof(VkPipelineCreationFeedbackEXT)*src->pipelineStageCreationFeedbackCount);
     }
 }
@@ -22727,6 +27676,23 @@ safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& safe_VkPhysicalDeviceCo
     return *this;
 }
 
+safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
+}
+
+safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::operator=(safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV::~safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV()
 {
 }
@@ -22779,6 +27745,23 @@ safe_VkPhysicalDeviceMeshShaderFeaturesNV& safe_VkPhysicalDeviceMeshShaderFeatur
     return *this;
 }
 
+safe_VkPhysicalDeviceMeshShaderFeaturesNV::safe_VkPhysicalDeviceMeshShaderFeaturesNV(safe_VkPhysicalDeviceMeshShaderFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMeshShaderFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceMeshShaderFeaturesNV();
+}
+
+safe_VkPhysicalDeviceMeshShaderFeaturesNV& safe_VkPhysicalDeviceMeshShaderFeaturesNV::operator=(safe_VkPhysicalDeviceMeshShaderFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMeshShaderFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMeshShaderFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceMeshShaderFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMeshShaderFeaturesNV::~safe_VkPhysicalDeviceMeshShaderFeaturesNV()
 {
 }
@@ -22814,12 +27797,8 @@ safe_VkPhysicalDeviceMeshShaderPropertiesNV::safe_VkPhysicalDeviceMeshShaderProp
     meshOutputPerVertexGranularity(in_struct->meshOutputPerVertexGranularity),
     meshOutputPerPrimitiveGranularity(in_struct->meshOutputPerPrimitiveGranularity)
 {
-    for (uint32_t i=0; i<3; ++i) {
-        maxTaskWorkGroupSize[i] = in_struct->maxTaskWorkGroupSize[i];
-    }
-    for (uint32_t i=0; i<3; ++i) {
-        maxMeshWorkGroupSize[i] = in_struct->maxMeshWorkGroupSize[i];
-    }
+    memcpy (maxTaskWorkGroupSize, in_struct->maxTaskWorkGroupSize, sizeof(maxTaskWorkGroupSize));
+    memcpy (maxMeshWorkGroupSize, in_struct->maxMeshWorkGroupSize, sizeof(maxMeshWorkGroupSize));
 }
 
 safe_VkPhysicalDeviceMeshShaderPropertiesNV::safe_VkPhysicalDeviceMeshShaderPropertiesNV()
@@ -22840,12 +27819,8 @@ safe_VkPhysicalDeviceMeshShaderPropertiesNV::safe_VkPhysicalDeviceMeshShaderProp
     maxMeshMultiviewViewCount = src.maxMeshMultiviewViewCount;
     meshOutputPerVertexGranularity = src.meshOutputPerVertexGranularity;
     meshOutputPerPrimitiveGranularity = src.meshOutputPerPrimitiveGranularity;
-    for (uint32_t i=0; i<3; ++i) {
-        maxTaskWorkGroupSize[i] = src.maxTaskWorkGroupSize[i];
-    }
-    for (uint32_t i=0; i<3; ++i) {
-        maxMeshWorkGroupSize[i] = src.maxMeshWorkGroupSize[i];
-    }
+    memcpy (maxTaskWorkGroupSize, src.maxTaskWorkGroupSize, sizeof(maxTaskWorkGroupSize));
+    memcpy (maxMeshWorkGroupSize, src.maxMeshWorkGroupSize, sizeof(maxMeshWorkGroupSize));
 }
 
 safe_VkPhysicalDeviceMeshShaderPropertiesNV& safe_VkPhysicalDeviceMeshShaderPropertiesNV::operator=(const safe_VkPhysicalDeviceMeshShaderPropertiesNV& src)
@@ -22866,12 +27841,25 @@ safe_VkPhysicalDeviceMeshShaderPropertiesNV& safe_VkPhysicalDeviceMeshShaderProp
     maxMeshMultiviewViewCount = src.maxMeshMultiviewViewCount;
     meshOutputPerVertexGranularity = src.meshOutputPerVertexGranularity;
     meshOutputPerPrimitiveGranularity = src.meshOutputPerPrimitiveGranularity;
-    for (uint32_t i=0; i<3; ++i) {
-        maxTaskWorkGroupSize[i] = src.maxTaskWorkGroupSize[i];
-    }
-    for (uint32_t i=0; i<3; ++i) {
-        maxMeshWorkGroupSize[i] = src.maxMeshWorkGroupSize[i];
-    }
+    memcpy (maxTaskWorkGroupSize, src.maxTaskWorkGroupSize, sizeof(maxTaskWorkGroupSize));
+    memcpy (maxMeshWorkGroupSize, src.maxMeshWorkGroupSize, sizeof(maxMeshWorkGroupSize));
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceMeshShaderPropertiesNV::safe_VkPhysicalDeviceMeshShaderPropertiesNV(safe_VkPhysicalDeviceMeshShaderPropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMeshShaderPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceMeshShaderPropertiesNV();
+}
+
+safe_VkPhysicalDeviceMeshShaderPropertiesNV& safe_VkPhysicalDeviceMeshShaderPropertiesNV::operator=(safe_VkPhysicalDeviceMeshShaderPropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMeshShaderPropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMeshShaderPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceMeshShaderPropertiesNV();
 
     return *this;
 }
@@ -22895,12 +27883,8 @@ void safe_VkPhysicalDeviceMeshShaderPropertiesNV::initialize(const VkPhysicalDev
     maxMeshMultiviewViewCount = in_struct->maxMeshMultiviewViewCount;
     meshOutputPerVertexGranularity = in_struct->meshOutputPerVertexGranularity;
     meshOutputPerPrimitiveGranularity = in_struct->meshOutputPerPrimitiveGranularity;
-    for (uint32_t i=0; i<3; ++i) {
-        maxTaskWorkGroupSize[i] = in_struct->maxTaskWorkGroupSize[i];
-    }
-    for (uint32_t i=0; i<3; ++i) {
-        maxMeshWorkGroupSize[i] = in_struct->maxMeshWorkGroupSize[i];
-    }
+    memcpy (maxTaskWorkGroupSize, in_struct->maxTaskWorkGroupSize, sizeof(maxTaskWorkGroupSize));
+    memcpy (maxMeshWorkGroupSize, in_struct->maxMeshWorkGroupSize, sizeof(maxMeshWorkGroupSize));
 }
 
 void safe_VkPhysicalDeviceMeshShaderPropertiesNV::initialize(const safe_VkPhysicalDeviceMeshShaderPropertiesNV* src)
@@ -22918,12 +27902,8 @@ void safe_VkPhysicalDeviceMeshShaderPropertiesNV::initialize(const safe_VkPhysic
     maxMeshMultiviewViewCount = src->maxMeshMultiviewViewCount;
     meshOutputPerVertexGranularity = src->meshOutputPerVertexGranularity;
     meshOutputPerPrimitiveGranularity = src->meshOutputPerPrimitiveGranularity;
-    for (uint32_t i=0; i<3; ++i) {
-        maxTaskWorkGroupSize[i] = src->maxTaskWorkGroupSize[i];
-    }
-    for (uint32_t i=0; i<3; ++i) {
-        maxMeshWorkGroupSize[i] = src->maxMeshWorkGroupSize[i];
-    }
+    memcpy (maxTaskWorkGroupSize, src->maxTaskWorkGroupSize, sizeof(maxTaskWorkGroupSize));
+    memcpy (maxMeshWorkGroupSize, src->maxMeshWorkGroupSize, sizeof(maxMeshWorkGroupSize));
 }
 
 safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV* in_struct) :
@@ -22955,6 +27935,23 @@ safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& safe_VkPhysicalDeviceF
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV(safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV();
+}
+
+safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::operator=(safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV::~safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV()
 {
 }
@@ -23002,6 +27999,23 @@ safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& safe_VkPhysicalDeviceShader
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV::safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
+}
+
+safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV::operator=(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV::~safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV()
 {
 }
@@ -23027,7 +28041,7 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::safe_VkPipelineViewpor
     pExclusiveScissors(nullptr)
 {
     if (in_struct->pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[in_struct->exclusiveScissorCount];
+        pExclusiveScissors = vl_safe_new_array<VkRect2D>(in_struct->exclusiveScissorCount);
         memcpy ((void *)pExclusiveScissors, (void *)in_struct->pExclusiveScissors, sizeof(VkRect2D)*in_struct->exclusiveScissorCount);
     }
 }
@@ -23043,7 +28057,7 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::safe_VkPipelineViewpor
     exclusiveScissorCount = src.exclusiveScissorCount;
     pExclusiveScissors = nullptr;
     if (src.pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[src.exclusiveScissorCount];
+        pExclusiveScissors = vl_safe_new_array<VkRect2D>(src.exclusiveScissorCount);
         memcpy ((void *)pExclusiveScissors, (void *)src.pExclusiveScissors, sizeof(VkRect2D)*src.exclusiveScissorCount);
     }
 }
@@ -23053,24 +28067,41 @@ safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& safe_VkPipelineViewpor
     if (&src == this) return *this;
 
     if (pExclusiveScissors)
-        delete[] pExclusiveScissors;
+        vl_safe_delete_array(pExclusiveScissors);
 
     sType = src.sType;
     pNext = src.pNext;
     exclusiveScissorCount = src.exclusiveScissorCount;
     pExclusiveScissors = nullptr;
     if (src.pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[src.exclusiveScissorCount];
+        pExclusiveScissors = vl_safe_new_array<VkRect2D>(src.exclusiveScissorCount);
         memcpy ((void *)pExclusiveScissors, (void *)src.pExclusiveScissors, sizeof(VkRect2D)*src.exclusiveScissorCount);
     }
 
     return *this;
 }
 
+safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
+}
+
+safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::operator=(safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV));
+    new (&src) safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::~safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV()
 {
     if (pExclusiveScissors)
-        delete[] pExclusiveScissors;
+        vl_safe_delete_array(pExclusiveScissors);
 }
 
 void safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::initialize(const VkPipelineViewportExclusiveScissorStateCreateInfoNV* in_struct)
@@ -23080,7 +28111,7 @@ void safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::initialize(const
     exclusiveScissorCount = in_struct->exclusiveScissorCount;
     pExclusiveScissors = nullptr;
     if (in_struct->pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[in_struct->exclusiveScissorCount];
+        pExclusiveScissors = vl_safe_new_array<VkRect2D>(in_struct->exclusiveScissorCount);
         memcpy ((void *)pExclusiveScissors, (void *)in_struct->pExclusiveScissors, sizeof(VkRect2D)*in_struct->exclusiveScissorCount);
     }
 }
@@ -23092,7 +28123,7 @@ void safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV::initialize(const
     exclusiveScissorCount = src->exclusiveScissorCount;
     pExclusiveScissors = nullptr;
     if (src->pExclusiveScissors) {
-        pExclusiveScissors = new VkRect2D[src->exclusiveScissorCount];
+        pExclusiveScissors = vl_safe_new_array<VkRect2D>(src->exclusiveScissorCount);
         memcpy ((void *)pExclusiveScissors, (void *)src->pExclusiveScissors, sizeof(VkRect2D)*src->exclusiveScissorCount);
     }
 }
@@ -23126,6 +28157,23 @@ safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& safe_VkPhysicalDeviceExclusiveS
     return *this;
 }
 
+safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
+}
+
+safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::operator=(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceExclusiveScissorFeaturesNV::~safe_VkPhysicalDeviceExclusiveScissorFeaturesNV()
 {
 }
@@ -23173,6 +28221,23 @@ safe_VkQueueFamilyCheckpointPropertiesNV& safe_VkQueueFamilyCheckpointProperties
     return *this;
 }
 
+safe_VkQueueFamilyCheckpointPropertiesNV::safe_VkQueueFamilyCheckpointPropertiesNV(safe_VkQueueFamilyCheckpointPropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueueFamilyCheckpointPropertiesNV));
+    new (&src) safe_VkQueueFamilyCheckpointPropertiesNV();
+}
+
+safe_VkQueueFamilyCheckpointPropertiesNV& safe_VkQueueFamilyCheckpointPropertiesNV::operator=(safe_VkQueueFamilyCheckpointPropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkQueueFamilyCheckpointPropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueueFamilyCheckpointPropertiesNV));
+    new (&src) safe_VkQueueFamilyCheckpointPropertiesNV();
+
+    return *this;
+}
+
 safe_VkQueueFamilyCheckpointPropertiesNV::~safe_VkQueueFamilyCheckpointPropertiesNV()
 {
 }
@@ -23223,6 +28288,23 @@ safe_VkCheckpointDataNV& safe_VkCheckpointDataNV::operator=(const safe_VkCheckpo
     return *this;
 }
 
+safe_VkCheckpointDataNV::safe_VkCheckpointDataNV(safe_VkCheckpointDataNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCheckpointDataNV));
+    new (&src) safe_VkCheckpointDataNV();
+}
+
+safe_VkCheckpointDataNV& safe_VkCheckpointDataNV::operator=(safe_VkCheckpointDataNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCheckpointDataNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCheckpointDataNV));
+    new (&src) safe_VkCheckpointDataNV();
+
+    return *this;
+}
+
 safe_VkCheckpointDataNV::~safe_VkCheckpointDataNV()
 {
 }
@@ -23272,6 +28354,23 @@ safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL& safe_VkPhysicalDeviceShaderIn
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL::safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL(safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL));
+    new (&src) safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL();
+}
+
+safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL& safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL::operator=(safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL));
+    new (&src) safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL::~safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL()
 {
 }
@@ -23325,6 +28424,23 @@ safe_VkPerformanceValueDataINTEL& safe_VkPerformanceValueDataINTEL::operator=(co
     return *this;
 }
 
+safe_VkPerformanceValueDataINTEL::safe_VkPerformanceValueDataINTEL(safe_VkPerformanceValueDataINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceValueDataINTEL));
+    new (&src) safe_VkPerformanceValueDataINTEL();
+}
+
+safe_VkPerformanceValueDataINTEL& safe_VkPerformanceValueDataINTEL::operator=(safe_VkPerformanceValueDataINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPerformanceValueDataINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceValueDataINTEL));
+    new (&src) safe_VkPerformanceValueDataINTEL();
+
+    return *this;
+}
+
 safe_VkPerformanceValueDataINTEL::~safe_VkPerformanceValueDataINTEL()
 {
 }
@@ -23376,6 +28492,23 @@ safe_VkInitializePerformanceApiInfoINTEL& safe_VkInitializePerformanceApiInfoINT
     return *this;
 }
 
+safe_VkInitializePerformanceApiInfoINTEL::safe_VkInitializePerformanceApiInfoINTEL(safe_VkInitializePerformanceApiInfoINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkInitializePerformanceApiInfoINTEL));
+    new (&src) safe_VkInitializePerformanceApiInfoINTEL();
+}
+
+safe_VkInitializePerformanceApiInfoINTEL& safe_VkInitializePerformanceApiInfoINTEL::operator=(safe_VkInitializePerformanceApiInfoINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkInitializePerformanceApiInfoINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkInitializePerformanceApiInfoINTEL));
+    new (&src) safe_VkInitializePerformanceApiInfoINTEL();
+
+    return *this;
+}
+
 safe_VkInitializePerformanceApiInfoINTEL::~safe_VkInitializePerformanceApiInfoINTEL()
 {
 }
@@ -23423,6 +28556,23 @@ safe_VkQueryPoolCreateInfoINTEL& safe_VkQueryPoolCreateInfoINTEL::operator=(cons
     return *this;
 }
 
+safe_VkQueryPoolCreateInfoINTEL::safe_VkQueryPoolCreateInfoINTEL(safe_VkQueryPoolCreateInfoINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueryPoolCreateInfoINTEL));
+    new (&src) safe_VkQueryPoolCreateInfoINTEL();
+}
+
+safe_VkQueryPoolCreateInfoINTEL& safe_VkQueryPoolCreateInfoINTEL::operator=(safe_VkQueryPoolCreateInfoINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkQueryPoolCreateInfoINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkQueryPoolCreateInfoINTEL));
+    new (&src) safe_VkQueryPoolCreateInfoINTEL();
+
+    return *this;
+}
+
 safe_VkQueryPoolCreateInfoINTEL::~safe_VkQueryPoolCreateInfoINTEL()
 {
 }
@@ -23470,6 +28620,23 @@ safe_VkPerformanceMarkerInfoINTEL& safe_VkPerformanceMarkerInfoINTEL::operator=(
     return *this;
 }
 
+safe_VkPerformanceMarkerInfoINTEL::safe_VkPerformanceMarkerInfoINTEL(safe_VkPerformanceMarkerInfoINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceMarkerInfoINTEL));
+    new (&src) safe_VkPerformanceMarkerInfoINTEL();
+}
+
+safe_VkPerformanceMarkerInfoINTEL& safe_VkPerformanceMarkerInfoINTEL::operator=(safe_VkPerformanceMarkerInfoINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPerformanceMarkerInfoINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceMarkerInfoINTEL));
+    new (&src) safe_VkPerformanceMarkerInfoINTEL();
+
+    return *this;
+}
+
 safe_VkPerformanceMarkerInfoINTEL::~safe_VkPerformanceMarkerInfoINTEL()
 {
 }
@@ -23517,6 +28684,23 @@ safe_VkPerformanceStreamMarkerInfoINTEL& safe_VkPerformanceStreamMarkerInfoINTEL
     return *this;
 }
 
+safe_VkPerformanceStreamMarkerInfoINTEL::safe_VkPerformanceStreamMarkerInfoINTEL(safe_VkPerformanceStreamMarkerInfoINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceStreamMarkerInfoINTEL));
+    new (&src) safe_VkPerformanceStreamMarkerInfoINTEL();
+}
+
+safe_VkPerformanceStreamMarkerInfoINTEL& safe_VkPerformanceStreamMarkerInfoINTEL::operator=(safe_VkPerformanceStreamMarkerInfoINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPerformanceStreamMarkerInfoINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceStreamMarkerInfoINTEL));
+    new (&src) safe_VkPerformanceStreamMarkerInfoINTEL();
+
+    return *this;
+}
+
 safe_VkPerformanceStreamMarkerInfoINTEL::~safe_VkPerformanceStreamMarkerInfoINTEL()
 {
 }
@@ -23570,6 +28754,23 @@ safe_VkPerformanceOverrideInfoINTEL& safe_VkPerformanceOverrideInfoINTEL::operat
     return *this;
 }
 
+safe_VkPerformanceOverrideInfoINTEL::safe_VkPerformanceOverrideInfoINTEL(safe_VkPerformanceOverrideInfoINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceOverrideInfoINTEL));
+    new (&src) safe_VkPerformanceOverrideInfoINTEL();
+}
+
+safe_VkPerformanceOverrideInfoINTEL& safe_VkPerformanceOverrideInfoINTEL::operator=(safe_VkPerformanceOverrideInfoINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPerformanceOverrideInfoINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceOverrideInfoINTEL));
+    new (&src) safe_VkPerformanceOverrideInfoINTEL();
+
+    return *this;
+}
+
 safe_VkPerformanceOverrideInfoINTEL::~safe_VkPerformanceOverrideInfoINTEL()
 {
 }
@@ -23621,6 +28822,23 @@ safe_VkPerformanceConfigurationAcquireInfoINTEL& safe_VkPerformanceConfiguration
     return *this;
 }
 
+safe_VkPerformanceConfigurationAcquireInfoINTEL::safe_VkPerformanceConfigurationAcquireInfoINTEL(safe_VkPerformanceConfigurationAcquireInfoINTEL&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceConfigurationAcquireInfoINTEL));
+    new (&src) safe_VkPerformanceConfigurationAcquireInfoINTEL();
+}
+
+safe_VkPerformanceConfigurationAcquireInfoINTEL& safe_VkPerformanceConfigurationAcquireInfoINTEL::operator=(safe_VkPerformanceConfigurationAcquireInfoINTEL&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPerformanceConfigurationAcquireInfoINTEL();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPerformanceConfigurationAcquireInfoINTEL));
+    new (&src) safe_VkPerformanceConfigurationAcquireInfoINTEL();
+
+    return *this;
+}
+
 safe_VkPerformanceConfigurationAcquireInfoINTEL::~safe_VkPerformanceConfigurationAcquireInfoINTEL()
 {
 }
@@ -23677,6 +28895,23 @@ safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& safe_VkPhysicalDevicePCIBusInfoPro
     return *this;
 }
 
+safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT));
+    new (&src) safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
+}
+
+safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::operator=(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT));
+    new (&src) safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDevicePCIBusInfoPropertiesEXT::~safe_VkPhysicalDevicePCIBusInfoPropertiesEXT()
 {
 }
@@ -23730,6 +28965,23 @@ safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& safe_VkDisplayNativeHdrSurfaceCap
     return *this;
 }
 
+safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD));
+    new (&src) safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
+}
+
+safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::operator=(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD));
+    new (&src) safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
+
+    return *this;
+}
+
 safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD::~safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD()
 {
 }
@@ -23777,6 +29029,23 @@ safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& safe_VkSwapchainDisplayNativeHdrC
     return *this;
 }
 
+safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD));
+    new (&src) safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
+}
+
+safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::operator=(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD));
+    new (&src) safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
+
+    return *this;
+}
+
 safe_VkSwapchainDisplayNativeHdrCreateInfoAMD::~safe_VkSwapchainDisplayNativeHdrCreateInfoAMD()
 {
 }
@@ -23829,6 +29098,23 @@ safe_VkImagePipeSurfaceCreateInfoFUCHSIA& safe_VkImagePipeSurfaceCreateInfoFUCHS
     return *this;
 }
 
+safe_VkImagePipeSurfaceCreateInfoFUCHSIA::safe_VkImagePipeSurfaceCreateInfoFUCHSIA(safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImagePipeSurfaceCreateInfoFUCHSIA));
+    new (&src) safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
+}
+
+safe_VkImagePipeSurfaceCreateInfoFUCHSIA& safe_VkImagePipeSurfaceCreateInfoFUCHSIA::operator=(safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImagePipeSurfaceCreateInfoFUCHSIA));
+    new (&src) safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
+
+    return *this;
+}
+
 safe_VkImagePipeSurfaceCreateInfoFUCHSIA::~safe_VkImagePipeSurfaceCreateInfoFUCHSIA()
 {
 }
@@ -23860,7 +29146,7 @@ safe_VkMetalSurfaceCreateInfoEXT::safe_VkMetalSurfaceCreateInfoEXT(const VkMetal
     pLayer(nullptr)
 {
     if (in_struct->pLayer) {
-        pLayer = new CAMetalLayer(*in_struct->pLayer);
+        pLayer = vl_safe_new<CAMetalLayer>(*in_struct->pLayer);
     }
 }
 
@@ -23875,7 +29161,7 @@ safe_VkMetalSurfaceCreateInfoEXT::safe_VkMetalSurfaceCreateInfoEXT(const safe_Vk
     flags = src.flags;
     pLayer = nullptr;
     if (src.pLayer) {
-        pLayer = new CAMetalLayer(*src.pLayer);
+        pLayer = vl_safe_new<CAMetalLayer>(*src.pLayer);
     }
 }
 
@@ -23884,23 +29170,40 @@ safe_VkMetalSurfaceCreateInfoEXT& safe_VkMetalSurfaceCreateInfoEXT::operator=(co
     if (&src == this) return *this;
 
     if (pLayer)
-        delete pLayer;
+        vl_safe_delete(pLayer);
 
     sType = src.sType;
     pNext = src.pNext;
     flags = src.flags;
     pLayer = nullptr;
     if (src.pLayer) {
-        pLayer = new CAMetalLayer(*src.pLayer);
+        pLayer = vl_safe_new<CAMetalLayer>(*src.pLayer);
     }
 
     return *this;
 }
 
+safe_VkMetalSurfaceCreateInfoEXT::safe_VkMetalSurfaceCreateInfoEXT(safe_VkMetalSurfaceCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMetalSurfaceCreateInfoEXT));
+    new (&src) safe_VkMetalSurfaceCreateInfoEXT();
+}
+
+safe_VkMetalSurfaceCreateInfoEXT& safe_VkMetalSurfaceCreateInfoEXT::operator=(safe_VkMetalSurfaceCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMetalSurfaceCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMetalSurfaceCreateInfoEXT));
+    new (&src) safe_VkMetalSurfaceCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkMetalSurfaceCreateInfoEXT::~safe_VkMetalSurfaceCreateInfoEXT()
 {
     if (pLayer)
-        delete pLayer;
+        vl_safe_delete(pLayer);
 }
 
 void safe_VkMetalSurfaceCreateInfoEXT::initialize(const VkMetalSurfaceCreateInfoEXT* in_struct)
@@ -23910,7 +29213,7 @@ void safe_VkMetalSurfaceCreateInfoEXT::initialize(const VkMetalSurfaceCreateInfo
     flags = in_struct->flags;
     pLayer = nullptr;
     if (in_struct->pLayer) {
-        pLayer = new CAMetalLayer(*in_struct->pLayer);
+        pLayer = vl_safe_new<CAMetalLayer>(*in_struct->pLayer);
     }
 }
 
@@ -23921,7 +29224,7 @@ void safe_VkMetalSurfaceCreateInfoEXT::initialize(const safe_VkMetalSurfaceCreat
     flags = src->flags;
     pLayer = nullptr;
     if (src->pLayer) {
-        pLayer = new CAMetalLayer(*src->pLayer);
+        pLayer = vl_safe_new<CAMetalLayer>(*src->pLayer);
     }
 }
 #endif // VK_USE_PLATFORM_METAL_EXT
@@ -23962,6 +29265,23 @@ safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& safe_VkPhysicalDeviceFragmen
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::operator=(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT::~safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT()
 {
 }
@@ -24019,6 +29339,23 @@ safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& safe_VkPhysicalDeviceFragm
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT::safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT::operator=(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT::~safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT()
 {
 }
@@ -24070,6 +29407,23 @@ safe_VkRenderPassFragmentDensityMapCreateInfoEXT& safe_VkRenderPassFragmentDensi
     return *this;
 }
 
+safe_VkRenderPassFragmentDensityMapCreateInfoEXT::safe_VkRenderPassFragmentDensityMapCreateInfoEXT(safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassFragmentDensityMapCreateInfoEXT));
+    new (&src) safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
+}
+
+safe_VkRenderPassFragmentDensityMapCreateInfoEXT& safe_VkRenderPassFragmentDensityMapCreateInfoEXT::operator=(safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkRenderPassFragmentDensityMapCreateInfoEXT));
+    new (&src) safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkRenderPassFragmentDensityMapCreateInfoEXT::~safe_VkRenderPassFragmentDensityMapCreateInfoEXT()
 {
 }
@@ -24117,6 +29471,23 @@ safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT& safe_VkPhysicalDeviceScalarBl
     return *this;
 }
 
+safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT::safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT(safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT& safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT::operator=(safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT::~safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT()
 {
 }
@@ -24139,12 +29510,8 @@ safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::safe_VkPhysicalDeviceMemoryBudge
     sType(in_struct->sType),
     pNext(in_struct->pNext)
 {
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapBudget[i] = in_struct->heapBudget[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapUsage[i] = in_struct->heapUsage[i];
-    }
+    memcpy (heapBudget, in_struct->heapBudget, sizeof(heapBudget));
+    memcpy (heapUsage, in_struct->heapUsage, sizeof(heapUsage));
 }
 
 safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT()
@@ -24154,12 +29521,8 @@ safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::safe_VkPhysicalDeviceMemoryBudge
 {
     sType = src.sType;
     pNext = src.pNext;
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapBudget[i] = src.heapBudget[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapUsage[i] = src.heapUsage[i];
-    }
+    memcpy (heapBudget, src.heapBudget, sizeof(heapBudget));
+    memcpy (heapUsage, src.heapUsage, sizeof(heapUsage));
 }
 
 safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::operator=(const safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& src)
@@ -24169,12 +29532,25 @@ safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& safe_VkPhysicalDeviceMemoryBudge
 
     sType = src.sType;
     pNext = src.pNext;
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapBudget[i] = src.heapBudget[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapUsage[i] = src.heapUsage[i];
-    }
+    memcpy (heapBudget, src.heapBudget, sizeof(heapBudget));
+    memcpy (heapUsage, src.heapUsage, sizeof(heapUsage));
+
+    return *this;
+}
+
+safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::operator=(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
 
     return *this;
 }
@@ -24187,24 +29563,16 @@ void safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::initialize(const VkPhysical
 {
     sType = in_struct->sType;
     pNext = in_struct->pNext;
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapBudget[i] = in_struct->heapBudget[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapUsage[i] = in_struct->heapUsage[i];
-    }
+    memcpy (heapBudget, in_struct->heapBudget, sizeof(heapBudget));
+    memcpy (heapUsage, in_struct->heapUsage, sizeof(heapUsage));
 }
 
 void safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT::initialize(const safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT* src)
 {
     sType = src->sType;
     pNext = src->pNext;
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapBudget[i] = src->heapBudget[i];
-    }
-    for (uint32_t i=0; i<VK_MAX_MEMORY_HEAPS; ++i) {
-        heapUsage[i] = src->heapUsage[i];
-    }
+    memcpy (heapBudget, src->heapBudget, sizeof(heapBudget));
+    memcpy (heapUsage, src->heapUsage, sizeof(heapUsage));
 }
 
 safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(const VkPhysicalDeviceMemoryPriorityFeaturesEXT* in_struct) :
@@ -24236,6 +29604,23 @@ safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& safe_VkPhysicalDeviceMemoryPrior
     return *this;
 }
 
+safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::operator=(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT::~safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT()
 {
 }
@@ -24283,6 +29668,23 @@ safe_VkMemoryPriorityAllocateInfoEXT& safe_VkMemoryPriorityAllocateInfoEXT::oper
     return *this;
 }
 
+safe_VkMemoryPriorityAllocateInfoEXT::safe_VkMemoryPriorityAllocateInfoEXT(safe_VkMemoryPriorityAllocateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryPriorityAllocateInfoEXT));
+    new (&src) safe_VkMemoryPriorityAllocateInfoEXT();
+}
+
+safe_VkMemoryPriorityAllocateInfoEXT& safe_VkMemoryPriorityAllocateInfoEXT::operator=(safe_VkMemoryPriorityAllocateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkMemoryPriorityAllocateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkMemoryPriorityAllocateInfoEXT));
+    new (&src) safe_VkMemoryPriorityAllocateInfoEXT();
+
+    return *this;
+}
+
 safe_VkMemoryPriorityAllocateInfoEXT::~safe_VkMemoryPriorityAllocateInfoEXT()
 {
 }
@@ -24330,6 +29732,23 @@ safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& safe_VkPhysical
     return *this;
 }
 
+safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
+}
+
+safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::operator=(safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV::~safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV()
 {
 }
@@ -24383,6 +29802,23 @@ safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& safe_VkPhysicalDeviceBuffer
     return *this;
 }
 
+safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::operator=(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT::~safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT()
 {
 }
@@ -24434,6 +29870,23 @@ safe_VkBufferDeviceAddressInfoEXT& safe_VkBufferDeviceAddressInfoEXT::operator=(
     return *this;
 }
 
+safe_VkBufferDeviceAddressInfoEXT::safe_VkBufferDeviceAddressInfoEXT(safe_VkBufferDeviceAddressInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferDeviceAddressInfoEXT));
+    new (&src) safe_VkBufferDeviceAddressInfoEXT();
+}
+
+safe_VkBufferDeviceAddressInfoEXT& safe_VkBufferDeviceAddressInfoEXT::operator=(safe_VkBufferDeviceAddressInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBufferDeviceAddressInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferDeviceAddressInfoEXT));
+    new (&src) safe_VkBufferDeviceAddressInfoEXT();
+
+    return *this;
+}
+
 safe_VkBufferDeviceAddressInfoEXT::~safe_VkBufferDeviceAddressInfoEXT()
 {
 }
@@ -24481,6 +29934,23 @@ safe_VkBufferDeviceAddressCreateInfoEXT& safe_VkBufferDeviceAddressCreateInfoEXT
     return *this;
 }
 
+safe_VkBufferDeviceAddressCreateInfoEXT::safe_VkBufferDeviceAddressCreateInfoEXT(safe_VkBufferDeviceAddressCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferDeviceAddressCreateInfoEXT));
+    new (&src) safe_VkBufferDeviceAddressCreateInfoEXT();
+}
+
+safe_VkBufferDeviceAddressCreateInfoEXT& safe_VkBufferDeviceAddressCreateInfoEXT::operator=(safe_VkBufferDeviceAddressCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkBufferDeviceAddressCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkBufferDeviceAddressCreateInfoEXT));
+    new (&src) safe_VkBufferDeviceAddressCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkBufferDeviceAddressCreateInfoEXT::~safe_VkBufferDeviceAddressCreateInfoEXT()
 {
 }
@@ -24528,6 +29998,23 @@ safe_VkImageStencilUsageCreateInfoEXT& safe_VkImageStencilUsageCreateInfoEXT::op
     return *this;
 }
 
+safe_VkImageStencilUsageCreateInfoEXT::safe_VkImageStencilUsageCreateInfoEXT(safe_VkImageStencilUsageCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageStencilUsageCreateInfoEXT));
+    new (&src) safe_VkImageStencilUsageCreateInfoEXT();
+}
+
+safe_VkImageStencilUsageCreateInfoEXT& safe_VkImageStencilUsageCreateInfoEXT::operator=(safe_VkImageStencilUsageCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkImageStencilUsageCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkImageStencilUsageCreateInfoEXT));
+    new (&src) safe_VkImageStencilUsageCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkImageStencilUsageCreateInfoEXT::~safe_VkImageStencilUsageCreateInfoEXT()
 {
 }
@@ -24555,11 +30042,11 @@ safe_VkValidationFeaturesEXT::safe_VkValidationFeaturesEXT(const VkValidationFea
     pDisabledValidationFeatures(nullptr)
 {
     if (in_struct->pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[in_struct->enabledValidationFeatureCount];
+        pEnabledValidationFeatures = vl_safe_new_array<VkValidationFeatureEnableEXT>(in_struct->enabledValidationFeatureCount);
         memcpy ((void *)pEnabledValidationFeatures, (void *)in_struct->pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*in_struct->enabledValidationFeatureCount);
     }
     if (in_struct->pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[in_struct->disabledValidationFeatureCount];
+        pDisabledValidationFeatures = vl_safe_new_array<VkValidationFeatureDisableEXT>(in_struct->disabledValidationFeatureCount);
         memcpy ((void *)pDisabledValidationFeatures, (void *)in_struct->pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*in_struct->disabledValidationFeatureCount);
     }
 }
@@ -24578,11 +30065,11 @@ safe_VkValidationFeaturesEXT::safe_VkValidationFeaturesEXT(const safe_VkValidati
     disabledValidationFeatureCount = src.disabledValidationFeatureCount;
     pDisabledValidationFeatures = nullptr;
     if (src.pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[src.enabledValidationFeatureCount];
+        pEnabledValidationFeatures = vl_safe_new_array<VkValidationFeatureEnableEXT>(src.enabledValidationFeatureCount);
         memcpy ((void *)pEnabledValidationFeatures, (void *)src.pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*src.enabledValidationFeatureCount);
     }
     if (src.pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[src.disabledValidationFeatureCount];
+        pDisabledValidationFeatures = vl_safe_new_array<VkValidationFeatureDisableEXT>(src.disabledValidationFeatureCount);
         memcpy ((void *)pDisabledValidationFeatures, (void *)src.pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*src.disabledValidationFeatureCount);
     }
 }
@@ -24592,9 +30079,9 @@ safe_VkValidationFeaturesEXT& safe_VkValidationFeaturesEXT::operator=(const safe
     if (&src == this) return *this;
 
     if (pEnabledValidationFeatures)
-        delete[] pEnabledValidationFeatures;
+        vl_safe_delete_array(pEnabledValidationFeatures);
     if (pDisabledValidationFeatures)
-        delete[] pDisabledValidationFeatures;
+        vl_safe_delete_array(pDisabledValidationFeatures);
 
     sType = src.sType;
     pNext = src.pNext;
@@ -24603,23 +30090,40 @@ safe_VkValidationFeaturesEXT& safe_VkValidationFeaturesEXT::operator=(const safe
     disabledValidationFeatureCount = src.disabledValidationFeatureCount;
     pDisabledValidationFeatures = nullptr;
     if (src.pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[src.enabledValidationFeatureCount];
+        pEnabledValidationFeatures = vl_safe_new_array<VkValidationFeatureEnableEXT>(src.enabledValidationFeatureCount);
         memcpy ((void *)pEnabledValidationFeatures, (void *)src.pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*src.enabledValidationFeatureCount);
     }
     if (src.pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[src.disabledValidationFeatureCount];
+        pDisabledValidationFeatures = vl_safe_new_array<VkValidationFeatureDisableEXT>(src.disabledValidationFeatureCount);
         memcpy ((void *)pDisabledValidationFeatures, (void *)src.pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*src.disabledValidationFeatureCount);
     }
 
     return *this;
 }
 
+safe_VkValidationFeaturesEXT::safe_VkValidationFeaturesEXT(safe_VkValidationFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkValidationFeaturesEXT));
+    new (&src) safe_VkValidationFeaturesEXT();
+}
+
+safe_VkValidationFeaturesEXT& safe_VkValidationFeaturesEXT::operator=(safe_VkValidationFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkValidationFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkValidationFeaturesEXT));
+    new (&src) safe_VkValidationFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkValidationFeaturesEXT::~safe_VkValidationFeaturesEXT()
 {
     if (pEnabledValidationFeatures)
-        delete[] pEnabledValidationFeatures;
+        vl_safe_delete_array(pEnabledValidationFeatures);
     if (pDisabledValidationFeatures)
-        delete[] pDisabledValidationFeatures;
+        vl_safe_delete_array(pDisabledValidationFeatures);
 }
 
 void safe_VkValidationFeaturesEXT::initialize(const VkValidationFeaturesEXT* in_struct)
@@ -24631,11 +30135,11 @@ void safe_VkValidationFeaturesEXT::initialize(const VkValidationFeaturesEXT* in_
     disabledValidationFeatureCount = in_struct->disabledValidationFeatureCount;
     pDisabledValidationFeatures = nullptr;
     if (in_struct->pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[in_struct->enabledValidationFeatureCount];
+        pEnabledValidationFeatures = vl_safe_new_array<VkValidationFeatureEnableEXT>(in_struct->enabledValidationFeatureCount);
         memcpy ((void *)pEnabledValidationFeatures, (void *)in_struct->pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*in_struct->enabledValidationFeatureCount);
     }
     if (in_struct->pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[in_struct->disabledValidationFeatureCount];
+        pDisabledValidationFeatures = vl_safe_new_array<VkValidationFeatureDisableEXT>(in_struct->disabledValidationFeatureCount);
         memcpy ((void *)pDisabledValidationFeatures, (void *)in_struct->pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*in_struct->disabledValidationFeatureCount);
     }
 }
@@ -24649,11 +30153,11 @@ void safe_VkValidationFeaturesEXT::initialize(const safe_VkValidationFeaturesEXT
     disabledValidationFeatureCount = src->disabledValidationFeatureCount;
     pDisabledValidationFeatures = nullptr;
     if (src->pEnabledValidationFeatures) {
-        pEnabledValidationFeatures = new VkValidationFeatureEnableEXT[src->enabledValidationFeatureCount];
+        pEnabledValidationFeatures = vl_safe_new_array<VkValidationFeatureEnableEXT>(src->enabledValidationFeatureCount);
         memcpy ((void *)pEnabledValidationFeatures, (void *)src->pEnabledValidationFeatures, sizeof(VkValidationFeatureEnableEXT)*src->enabledValidationFeatureCount);
     }
     if (src->pDisabledValidationFeatures) {
-        pDisabledValidationFeatures = new VkValidationFeatureDisableEXT[src->disabledValidationFeatureCount];
+        pDisabledValidationFeatures = vl_safe_new_array<VkValidationFeatureDisableEXT>(src->disabledValidationFeatureCount);
         memcpy ((void *)pDisabledValidationFeatures, (void *)src->pDisabledValidationFeatures, sizeof(VkValidationFeatureDisableEXT)*src->disabledValidationFeatureCount);
     }
 }
@@ -24708,6 +30212,23 @@ safe_VkCooperativeMatrixPropertiesNV& safe_VkCooperativeMatrixPropertiesNV::oper
     return *this;
 }
 
+safe_VkCooperativeMatrixPropertiesNV::safe_VkCooperativeMatrixPropertiesNV(safe_VkCooperativeMatrixPropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCooperativeMatrixPropertiesNV));
+    new (&src) safe_VkCooperativeMatrixPropertiesNV();
+}
+
+safe_VkCooperativeMatrixPropertiesNV& safe_VkCooperativeMatrixPropertiesNV::operator=(safe_VkCooperativeMatrixPropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkCooperativeMatrixPropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkCooperativeMatrixPropertiesNV));
+    new (&src) safe_VkCooperativeMatrixPropertiesNV();
+
+    return *this;
+}
+
 safe_VkCooperativeMatrixPropertiesNV::~safe_VkCooperativeMatrixPropertiesNV()
 {
 }
@@ -24772,6 +30293,23 @@ safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& safe_VkPhysicalDeviceCooperati
     return *this;
 }
 
+safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
+}
+
+safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::operator=(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV::~safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV()
 {
 }
@@ -24821,6 +30359,23 @@ safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& safe_VkPhysicalDeviceCoopera
     return *this;
 }
 
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
+}
+
+safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::operator=(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV));
+    new (&src) safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV::~safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV()
 {
 }
@@ -24868,6 +30423,23 @@ safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& safe_VkPhysicalDeviceCover
     return *this;
 }
 
+safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV::safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
+}
+
+safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV::operator=(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV));
+    new (&src) safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV::~safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV()
 {
 }
@@ -24918,6 +30490,23 @@ safe_VkPipelineCoverageReductionStateCreateInfoNV& safe_VkPipelineCoverageReduct
     return *this;
 }
 
+safe_VkPipelineCoverageReductionStateCreateInfoNV::safe_VkPipelineCoverageReductionStateCreateInfoNV(safe_VkPipelineCoverageReductionStateCreateInfoNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCoverageReductionStateCreateInfoNV));
+    new (&src) safe_VkPipelineCoverageReductionStateCreateInfoNV();
+}
+
+safe_VkPipelineCoverageReductionStateCreateInfoNV& safe_VkPipelineCoverageReductionStateCreateInfoNV::operator=(safe_VkPipelineCoverageReductionStateCreateInfoNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPipelineCoverageReductionStateCreateInfoNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPipelineCoverageReductionStateCreateInfoNV));
+    new (&src) safe_VkPipelineCoverageReductionStateCreateInfoNV();
+
+    return *this;
+}
+
 safe_VkPipelineCoverageReductionStateCreateInfoNV::~safe_VkPipelineCoverageReductionStateCreateInfoNV()
 {
 }
@@ -24976,6 +30565,23 @@ safe_VkFramebufferMixedSamplesCombinationNV& safe_VkFramebufferMixedSamplesCombi
     return *this;
 }
 
+safe_VkFramebufferMixedSamplesCombinationNV::safe_VkFramebufferMixedSamplesCombinationNV(safe_VkFramebufferMixedSamplesCombinationNV&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferMixedSamplesCombinationNV));
+    new (&src) safe_VkFramebufferMixedSamplesCombinationNV();
+}
+
+safe_VkFramebufferMixedSamplesCombinationNV& safe_VkFramebufferMixedSamplesCombinationNV::operator=(safe_VkFramebufferMixedSamplesCombinationNV&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkFramebufferMixedSamplesCombinationNV();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkFramebufferMixedSamplesCombinationNV));
+    new (&src) safe_VkFramebufferMixedSamplesCombinationNV();
+
+    return *this;
+}
+
 safe_VkFramebufferMixedSamplesCombinationNV::~safe_VkFramebufferMixedSamplesCombinationNV()
 {
 }
@@ -25035,6 +30641,23 @@ safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& safe_VkPhysicalDeviceFr
     return *this;
 }
 
+safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::operator=(safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT::~safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT()
 {
 }
@@ -25086,6 +30709,23 @@ safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& safe_VkPhysicalDeviceYcbcrImag
     return *this;
 }
 
+safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::operator=(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT::~safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT()
 {
 }
@@ -25135,6 +30775,23 @@ safe_VkSurfaceFullScreenExclusiveInfoEXT& safe_VkSurfaceFullScreenExclusiveInfoE
     return *this;
 }
 
+safe_VkSurfaceFullScreenExclusiveInfoEXT::safe_VkSurfaceFullScreenExclusiveInfoEXT(safe_VkSurfaceFullScreenExclusiveInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceFullScreenExclusiveInfoEXT));
+    new (&src) safe_VkSurfaceFullScreenExclusiveInfoEXT();
+}
+
+safe_VkSurfaceFullScreenExclusiveInfoEXT& safe_VkSurfaceFullScreenExclusiveInfoEXT::operator=(safe_VkSurfaceFullScreenExclusiveInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceFullScreenExclusiveInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceFullScreenExclusiveInfoEXT));
+    new (&src) safe_VkSurfaceFullScreenExclusiveInfoEXT();
+
+    return *this;
+}
+
 safe_VkSurfaceFullScreenExclusiveInfoEXT::~safe_VkSurfaceFullScreenExclusiveInfoEXT()
 {
 }
@@ -25186,6 +30843,23 @@ safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& safe_VkSurfaceCapabilitiesFull
     return *this;
 }
 
+safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT));
+    new (&src) safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
+}
+
+safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::operator=(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT));
+    new (&src) safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
+
+    return *this;
+}
+
 safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT::~safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT()
 {
 }
@@ -25237,6 +30911,23 @@ safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& safe_VkSurfaceFullScreenExclusive
     return *this;
 }
 
+safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT));
+    new (&src) safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
+}
+
+safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::operator=(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT));
+    new (&src) safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
+
+    return *this;
+}
+
 safe_VkSurfaceFullScreenExclusiveWin32InfoEXT::~safe_VkSurfaceFullScreenExclusiveWin32InfoEXT()
 {
 }
@@ -25286,6 +30977,23 @@ safe_VkHeadlessSurfaceCreateInfoEXT& safe_VkHeadlessSurfaceCreateInfoEXT::operat
     return *this;
 }
 
+safe_VkHeadlessSurfaceCreateInfoEXT::safe_VkHeadlessSurfaceCreateInfoEXT(safe_VkHeadlessSurfaceCreateInfoEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkHeadlessSurfaceCreateInfoEXT));
+    new (&src) safe_VkHeadlessSurfaceCreateInfoEXT();
+}
+
+safe_VkHeadlessSurfaceCreateInfoEXT& safe_VkHeadlessSurfaceCreateInfoEXT::operator=(safe_VkHeadlessSurfaceCreateInfoEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkHeadlessSurfaceCreateInfoEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkHeadlessSurfaceCreateInfoEXT));
+    new (&src) safe_VkHeadlessSurfaceCreateInfoEXT();
+
+    return *this;
+}
+
 safe_VkHeadlessSurfaceCreateInfoEXT::~safe_VkHeadlessSurfaceCreateInfoEXT()
 {
 }
@@ -25333,6 +31041,23 @@ safe_VkPhysicalDeviceHostQueryResetFeaturesEXT& safe_VkPhysicalDeviceHostQueryRe
     return *this;
 }
 
+safe_VkPhysicalDeviceHostQueryResetFeaturesEXT::safe_VkPhysicalDeviceHostQueryResetFeaturesEXT(safe_VkPhysicalDeviceHostQueryResetFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceHostQueryResetFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceHostQueryResetFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceHostQueryResetFeaturesEXT& safe_VkPhysicalDeviceHostQueryResetFeaturesEXT::operator=(safe_VkPhysicalDeviceHostQueryResetFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceHostQueryResetFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceHostQueryResetFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceHostQueryResetFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceHostQueryResetFeaturesEXT::~safe_VkPhysicalDeviceHostQueryResetFeaturesEXT()
 {
 }
@@ -25380,6 +31105,23 @@ safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& safe_VkPhysicalD
     return *this;
 }
 
+safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT::safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT(safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT::operator=(safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT::~safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT()
 {
 }
@@ -25427,6 +31169,23 @@ safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& safe_VkPhysicalDeviceTexel
     return *this;
 }
 
+safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT::safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
+}
+
+safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT::operator=(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT));
+    new (&src) safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT::~safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT()
 {
 }
@@ -25483,6 +31242,23 @@ safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& safe_VkPhysicalDeviceTex
     return *this;
 }
 
+safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT::safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT(safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT&& src) noexcept
+{
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT();
+}
+
+safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT::operator=(safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT&& src) noexcept
+{
+    if (&src == this) return *this;
+
+    this->~safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT();
+    memcpy(static_cast<void *>(this), &src, sizeof(safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT));
+    new (&src) safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT();
+
+    return *this;
+}
+
 safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT::~safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT()
 {
 }
@@ -45,6 +45,8 @@ struct safe_VkApplicationInfo {
     safe_VkApplicationInfo(const VkApplicationInfo* in_struct);
     safe_VkApplicationInfo(const safe_VkApplicationInfo& src);
     safe_VkApplicationInfo& operator=(const safe_VkApplicationInfo& src);
+    safe_VkApplicationInfo(safe_VkApplicationInfo&& src) noexcept;
+    safe_VkApplicationInfo& operator=(safe_VkApplicationInfo&& src) noexcept;
     safe_VkApplicationInfo();
     ~safe_VkApplicationInfo();
     void initialize(const VkApplicationInfo* in_struct);
@@ -65,6 +67,8 @@ struct safe_VkInstanceCreateInfo {
     safe_VkInstanceCreateInfo(const VkInstanceCreateInfo* in_struct);
     safe_VkInstanceCreateInfo(const safe_VkInstanceCreateInfo& src);
     safe_VkInstanceCreateInfo& operator=(const safe_VkInstanceCreateInfo& src);
+    safe_VkInstanceCreateInfo(safe_VkInstanceCreateInfo&& src) noexcept;
+    safe_VkInstanceCreateInfo& operator=(safe_VkInstanceCreateInfo&& src) noexcept;
     safe_VkInstanceCreateInfo();
     ~safe_VkInstanceCreateInfo();
     void initialize(const VkInstanceCreateInfo* in_struct);
@@ -83,6 +87,8 @@ struct safe_VkAllocationCallbacks {
     safe_VkAllocationCallbacks(const VkAllocationCallbacks* in_struct);
     safe_VkAllocationCallbacks(const safe_VkAllocationCallbacks& src);
     safe_VkAllocationCallbacks& operator=(const safe_VkAllocationCallbacks& src);
+    safe_VkAllocationCallbacks(safe_VkAllocationCallbacks&& src) noexcept;
+    safe_VkAllocationCallbacks& operator=(safe_VkAllocationCallbacks&& src) noexcept;
     safe_VkAllocationCallbacks();
     ~safe_VkAllocationCallbacks();
     void initialize(const VkAllocationCallbacks* in_struct);
@@ -101,6 +107,8 @@ struct safe_VkDeviceQueueCreateInfo {
     safe_VkDeviceQueueCreateInfo(const VkDeviceQueueCreateInfo* in_struct);
     safe_VkDeviceQueueCreateInfo(const safe_VkDeviceQueueCreateInfo& src);
     safe_VkDeviceQueueCreateInfo& operator=(const safe_VkDeviceQueueCreateInfo& src);
+    safe_VkDeviceQueueCreateInfo(safe_VkDeviceQueueCreateInfo&& src) noexcept;
+    safe_VkDeviceQueueCreateInfo& operator=(safe_VkDeviceQueueCreateInfo&& src) noexcept;
     safe_VkDeviceQueueCreateInfo();
     ~safe_VkDeviceQueueCreateInfo();
     void initialize(const VkDeviceQueueCreateInfo* in_struct);
@@ -123,6 +131,8 @@ struct safe_VkDeviceCreateInfo {
     safe_VkDeviceCreateInfo(const VkDeviceCreateInfo* in_struct);
     safe_VkDeviceCreateInfo(const safe_VkDeviceCreateInfo& src);
     safe_VkDeviceCreateInfo& operator=(const safe_VkDeviceCreateInfo& src);
+    safe_VkDeviceCreateInfo(safe_VkDeviceCreateInfo&& src) noexcept;
+    safe_VkDeviceCreateInfo& operator=(safe_VkDeviceCreateInfo&& src) noexcept;
     safe_VkDeviceCreateInfo();
     ~safe_VkDeviceCreateInfo();
     void initialize(const VkDeviceCreateInfo* in_struct);
@@ -144,6 +154,8 @@ struct safe_VkSubmitInfo {
     safe_VkSubmitInfo(const VkSubmitInfo* in_struct);
     safe_VkSubmitInfo(const safe_VkSubmitInfo& src);
     safe_VkSubmitInfo& operator=(const safe_VkSubmitInfo& src);
+    safe_VkSubmitInfo(safe_VkSubmitInfo&& src) noexcept;
+    safe_VkSubmitInfo& operator=(safe_VkSubmitInfo&& src) noexcept;
     safe_VkSubmitInfo();
     ~safe_VkSubmitInfo();
     void initialize(const VkSubmitInfo* in_struct);
@@ -160,6 +172,8 @@ struct safe_VkMemoryAllocateInfo {
     safe_VkMemoryAllocateInfo(const VkMemoryAllocateInfo* in_struct);
     safe_VkMemoryAllocateInfo(const safe_VkMemoryAllocateInfo& src);
     safe_VkMemoryAllocateInfo& operator=(const safe_VkMemoryAllocateInfo& src);
+    safe_VkMemoryAllocateInfo(safe_VkMemoryAllocateInfo&& src) noexcept;
+    safe_VkMemoryAllocateInfo& operator=(safe_VkMemoryAllocateInfo&& src) noexcept;
     safe_VkMemoryAllocateInfo();
     ~safe_VkMemoryAllocateInfo();
     void initialize(const VkMemoryAllocateInfo* in_struct);
@@ -177,6 +191,8 @@ struct safe_VkMappedMemoryRange {
     safe_VkMappedMemoryRange(const VkMappedMemoryRange* in_struct);
     safe_VkMappedMemoryRange(const safe_VkMappedMemoryRange& src);
     safe_VkMappedMemoryRange& operator=(const safe_VkMappedMemoryRange& src);
+    safe_VkMappedMemoryRange(safe_VkMappedMemoryRange&& src) noexcept;
+    safe_VkMappedMemoryRange& operator=(safe_VkMappedMemoryRange&& src) noexcept;
     safe_VkMappedMemoryRange();
     ~safe_VkMappedMemoryRange();
     void initialize(const VkMappedMemoryRange* in_struct);
@@ -192,6 +208,8 @@ struct safe_VkSparseBufferMemoryBindInfo {
     safe_VkSparseBufferMemoryBindInfo(const VkSparseBufferMemoryBindInfo* in_struct);
     safe_VkSparseBufferMemoryBindInfo(const safe_VkSparseBufferMemoryBindInfo& src);
     safe_VkSparseBufferMemoryBindInfo& operator=(const safe_VkSparseBufferMemoryBindInfo& src);
+    safe_VkSparseBufferMemoryBindInfo(safe_VkSparseBufferMemoryBindInfo&& src) noexcept;
+    safe_VkSparseBufferMemoryBindInfo& operator=(safe_VkSparseBufferMemoryBindInfo&& src) noexcept;
     safe_VkSparseBufferMemoryBindInfo();
     ~safe_VkSparseBufferMemoryBindInfo();
     void initialize(const VkSparseBufferMemoryBindInfo* in_struct);
@@ -207,6 +225,8 @@ struct safe_VkSparseImageOpaqueMemoryBindInfo {
     safe_VkSparseImageOpaqueMemoryBindInfo(const VkSparseImageOpaqueMemoryBindInfo* in_struct);
     safe_VkSparseImageOpaqueMemoryBindInfo(const safe_VkSparseImageOpaqueMemoryBindInfo& src);
     safe_VkSparseImageOpaqueMemoryBindInfo& operator=(const safe_VkSparseImageOpaqueMemoryBindInfo& src);
+    safe_VkSparseImageOpaqueMemoryBindInfo(safe_VkSparseImageOpaqueMemoryBindInfo&& src) noexcept;
+    safe_VkSparseImageOpaqueMemoryBindInfo& operator=(safe_VkSparseImageOpaqueMemoryBindInfo&& src) noexcept;
     safe_VkSparseImageOpaqueMemoryBindInfo();
     ~safe_VkSparseImageOpaqueMemoryBindInfo();
     void initialize(const VkSparseImageOpaqueMemoryBindInfo* in_struct);
@@ -222,6 +242,8 @@ struct safe_VkSparseImageMemoryBindInfo {
     safe_VkSparseImageMemoryBindInfo(const VkSparseImageMemoryBindInfo* in_struct);
     safe_VkSparseImageMemoryBindInfo(const safe_VkSparseImageMemoryBindInfo& src);
     safe_VkSparseImageMemoryBindInfo& operator=(const safe_VkSparseImageMemoryBindInfo& src);
+    safe_VkSparseImageMemoryBindInfo(safe_VkSparseImageMemoryBindInfo&& src) noexcept;
+    safe_VkSparseImageMemoryBindInfo& operator=(safe_VkSparseImageMemoryBindInfo&& src) noexcept;
     safe_VkSparseImageMemoryBindInfo();
     ~safe_VkSparseImageMemoryBindInfo();
     void initialize(const VkSparseImageMemoryBindInfo* in_struct);
@@ -246,6 +268,8 @@ struct safe_VkBindSparseInfo {
     safe_VkBindSparseInfo(const VkBindSparseInfo* in_struct);
     safe_VkBindSparseInfo(const safe_VkBindSparseInfo& src);
     safe_VkBindSparseInfo& operator=(const safe_VkBindSparseInfo& src);
+    safe_VkBindSparseInfo(safe_VkBindSparseInfo&& src) noexcept;
+    safe_VkBindSparseInfo& operator=(safe_VkBindSparseInfo&& src) noexcept;
     safe_VkBindSparseInfo();
     ~safe_VkBindSparseInfo();
     void initialize(const VkBindSparseInfo* in_struct);
@@ -261,6 +285,8 @@ struct safe_VkFenceCreateInfo {
     safe_VkFenceCreateInfo(const VkFenceCreateInfo* in_struct);
     safe_VkFenceCreateInfo(const safe_VkFenceCreateInfo& src);
     safe_VkFenceCreateInfo& operator=(const safe_VkFenceCreateInfo& src);
+    safe_VkFenceCreateInfo(safe_VkFenceCreateInfo&& src) noexcept;
+    safe_VkFenceCreateInfo& operator=(safe_VkFenceCreateInfo&& src) noexcept;
     safe_VkFenceCreateInfo();
     ~safe_VkFenceCreateInfo();
     void initialize(const VkFenceCreateInfo* in_struct);
@@ -276,6 +302,8 @@ struct safe_VkSemaphoreCreateInfo {
     safe_VkSemaphoreCreateInfo(const VkSemaphoreCreateInfo* in_struct);
     safe_VkSemaphoreCreateInfo(const safe_VkSemaphoreCreateInfo& src);
     safe_VkSemaphoreCreateInfo& operator=(const safe_VkSemaphoreCreateInfo& src);
+    safe_VkSemaphoreCreateInfo(safe_VkSemaphoreCreateInfo&& src) noexcept;
+    safe_VkSemaphoreCreateInfo& operator=(safe_VkSemaphoreCreateInfo&& src) noexcept;
     safe_VkSemaphoreCreateInfo();
     ~safe_VkSemaphoreCreateInfo();
     void initialize(const VkSemaphoreCreateInfo* in_struct);
@@ -291,6 +319,8 @@ struct safe_VkEventCreateInfo {
     safe_VkEventCreateInfo(const VkEventCreateInfo* in_struct);
     safe_VkEventCreateInfo(const safe_VkEventCreateInfo& src);
     safe_VkEventCreateInfo& operator=(const safe_VkEventCreateInfo& src);
+    safe_VkEventCreateInfo(safe_VkEventCreateInfo&& src) noexcept;
+    safe_VkEventCreateInfo& operator=(safe_VkEventCreateInfo&& src) noexcept;
     safe_VkEventCreateInfo();
     ~safe_VkEventCreateInfo();
     void initialize(const VkEventCreateInfo* in_struct);
@@ -309,6 +339,8 @@ struct safe_VkQueryPoolCreateInfo {
     safe_VkQueryPoolCreateInfo(const VkQueryPoolCreateInfo* in_struct);
     safe_VkQueryPoolCreateInfo(const safe_VkQueryPoolCreateInfo& src);
     safe_VkQueryPoolCreateInfo& operator=(const safe_VkQueryPoolCreateInfo& src);
+    safe_VkQueryPoolCreateInfo(safe_VkQueryPoolCreateInfo&& src) noexcept;
+    safe_VkQueryPoolCreateInfo& operator=(safe_VkQueryPoolCreateInfo&& src) noexcept;
     safe_VkQueryPoolCreateInfo();
     ~safe_VkQueryPoolCreateInfo();
     void initialize(const VkQueryPoolCreateInfo* in_struct);
@@ -329,6 +361,8 @@ struct safe_VkBufferCreateInfo {
     safe_VkBufferCreateInfo(const VkBufferCreateInfo* in_struct);
     safe_VkBufferCreateInfo(const safe_VkBufferCreateInfo& src);
     safe_VkBufferCreateInfo& operator=(const safe_VkBufferCreateInfo& src);
+    safe_VkBufferCreateInfo(safe_VkBufferCreateInfo&& src) noexcept;
+    safe_VkBufferCreateInfo& operator=(safe_VkBufferCreateInfo&& src) noexcept;
     safe_VkBufferCreateInfo();
     ~safe_VkBufferCreateInfo();
     void initialize(const VkBufferCreateInfo* in_struct);
@@ -348,6 +382,8 @@ struct safe_VkBufferViewCreateInfo {
     safe_VkBufferViewCreateInfo(const VkBufferViewCreateInfo* in_struct);
     safe_VkBufferViewCreateInfo(const safe_VkBufferViewCreateInfo& src);
     safe_VkBufferViewCreateInfo& operator=(const safe_VkBufferViewCreateInfo& src);
+    safe_VkBufferViewCreateInfo(safe_VkBufferViewCreateInfo&& src) noexcept;
+    safe_VkBufferViewCreateInfo& operator=(safe_VkBufferViewCreateInfo&& src) noexcept;
     safe_VkBufferViewCreateInfo();
     ~safe_VkBufferViewCreateInfo();
     void initialize(const VkBufferViewCreateInfo* in_struct);
@@ -375,6 +411,8 @@ struct safe_VkImageCreateInfo {
     safe_VkImageCreateInfo(const VkImageCreateInfo* in_struct);
     safe_VkImageCreateInfo(const safe_VkImageCreateInfo& src);
     safe_VkImageCreateInfo& operator=(const safe_VkImageCreateInfo& src);
+    safe_VkImageCreateInfo(safe_VkImageCreateInfo&& src) noexcept;
+    safe_VkImageCreateInfo& operator=(safe_VkImageCreateInfo&& src) noexcept;
     safe_VkImageCreateInfo();
     ~safe_VkImageCreateInfo();
     void initialize(const VkImageCreateInfo* in_struct);
@@ -395,6 +433,8 @@ struct safe_VkImageViewCreateInfo {
     safe_VkImageViewCreateInfo(const VkImageViewCreateInfo* in_struct);
     safe_VkImageViewCreateInfo(const safe_VkImageViewCreateInfo& src);
     safe_VkImageViewCreateInfo& operator=(const safe_VkImageViewCreateInfo& src);
+    safe_VkImageViewCreateInfo(safe_VkImageViewCreateInfo&& src) noexcept;
+    safe_VkImageViewCreateInfo& operator=(safe_VkImageViewCreateInfo&& src) noexcept;
     safe_VkImageViewCreateInfo();
     ~safe_VkImageViewCreateInfo();
     void initialize(const VkImageViewCreateInfo* in_struct);
@@ -412,6 +452,8 @@ struct safe_VkShaderModuleCreateInfo {
     safe_VkShaderModuleCreateInfo(const VkShaderModuleCreateInfo* in_struct);
     safe_VkShaderModuleCreateInfo(const safe_VkShaderModuleCreateInfo& src);
     safe_VkShaderModuleCreateInfo& operator=(const safe_VkShaderModuleCreateInfo& src);
+    safe_VkShaderModuleCreateInfo(safe_VkShaderModuleCreateInfo&& src) noexcept;
+    safe_VkShaderModuleCreateInfo& operator=(safe_VkShaderModuleCreateInfo&& src) noexcept;
     safe_VkShaderModuleCreateInfo();
     ~safe_VkShaderModuleCreateInfo();
     void initialize(const VkShaderModuleCreateInfo* in_struct);
@@ -429,6 +471,8 @@ struct safe_VkPipelineCacheCreateInfo {
     safe_VkPipelineCacheCreateInfo(const VkPipelineCacheCreateInfo* in_struct);
     safe_VkPipelineCacheCreateInfo(const safe_VkPipelineCacheCreateInfo& src);
     safe_VkPipelineCacheCreateInfo& operator=(const safe_VkPipelineCacheCreateInfo& src);
+    safe_VkPipelineCacheCreateInfo(safe_VkPipelineCacheCreateInfo&& src) noexcept;
+    safe_VkPipelineCacheCreateInfo& operator=(safe_VkPipelineCacheCreateInfo&& src) noexcept;
     safe_VkPipelineCacheCreateInfo();
     ~safe_VkPipelineCacheCreateInfo();
     void initialize(const VkPipelineCacheCreateInfo* in_struct);
@@ -445,6 +489,8 @@ struct safe_VkSpecializationInfo {
     safe_VkSpecializationInfo(const VkSpecializationInfo* in_struct);
     safe_VkSpecializationInfo(const safe_VkSpecializationInfo& src);
     safe_VkSpecializationInfo& operator=(const safe_VkSpecializationInfo& src);
+    safe_VkSpecializationInfo(safe_VkSpecializationInfo&& src) noexcept;
+    safe_VkSpecializationInfo& operator=(safe_VkSpecializationInfo&& src) noexcept;
     safe_VkSpecializationInfo();
     ~safe_VkSpecializationInfo();
     void initialize(const VkSpecializationInfo* in_struct);
@@ -464,6 +510,8 @@ struct safe_VkPipelineShaderStageCreateInfo {
     safe_VkPipelineShaderStageCreateInfo(const VkPipelineShaderStageCreateInfo* in_struct);
     safe_VkPipelineShaderStageCreateInfo(const safe_VkPipelineShaderStageCreateInfo& src);
     safe_VkPipelineShaderStageCreateInfo& operator=(const safe_VkPipelineShaderStageCreateInfo& src);
+    safe_VkPipelineShaderStageCreateInfo(safe_VkPipelineShaderStageCreateInfo&& src) noexcept;
+    safe_VkPipelineShaderStageCreateInfo& operator=(safe_VkPipelineShaderStageCreateInfo&& src) noexcept;
     safe_VkPipelineShaderStageCreateInfo();
     ~safe_VkPipelineShaderStageCreateInfo();
     void initialize(const VkPipelineShaderStageCreateInfo* in_struct);
@@ -483,6 +531,8 @@ struct safe_VkPipelineVertexInputStateCreateInfo {
     safe_VkPipelineVertexInputStateCreateInfo(const VkPipelineVertexInputStateCreateInfo* in_struct);
     safe_VkPipelineVertexInputStateCreateInfo(const safe_VkPipelineVertexInputStateCreateInfo& src);
     safe_VkPipelineVertexInputStateCreateInfo& operator=(const safe_VkPipelineVertexInputStateCreateInfo& src);
+    safe_VkPipelineVertexInputStateCreateInfo(safe_VkPipelineVertexInputStateCreateInfo&& src) noexcept;
+    safe_VkPipelineVertexInputStateCreateInfo& operator=(safe_VkPipelineVertexInputStateCreateInfo&& src) noexcept;
     safe_VkPipelineVertexInputStateCreateInfo();
     ~safe_VkPipelineVertexInputStateCreateInfo();
     void initialize(const VkPipelineVertexInputStateCreateInfo* in_struct);
@@ -500,6 +550,8 @@ struct safe_VkPipelineInputAssemblyStateCreateInfo {
     safe_VkPipelineInputAssemblyStateCreateInfo(const VkPipelineInputAssemblyStateCreateInfo* in_struct);
     safe_VkPipelineInputAssemblyStateCreateInfo(const safe_VkPipelineInputAssemblyStateCreateInfo& src);
     safe_VkPipelineInputAssemblyStateCreateInfo& operator=(const safe_VkPipelineInputAssemblyStateCreateInfo& src);
+    safe_VkPipelineInputAssemblyStateCreateInfo(safe_VkPipelineInputAssemblyStateCreateInfo&& src) noexcept;
+    safe_VkPipelineInputAssemblyStateCreateInfo& operator=(safe_VkPipelineInputAssemblyStateCreateInfo&& src) noexcept;
     safe_VkPipelineInputAssemblyStateCreateInfo();
     ~safe_VkPipelineInputAssemblyStateCreateInfo();
     void initialize(const VkPipelineInputAssemblyStateCreateInfo* in_struct);
@@ -516,6 +568,8 @@ struct safe_VkPipelineTessellationStateCreateInfo {
     safe_VkPipelineTessellationStateCreateInfo(const VkPipelineTessellationStateCreateInfo* in_struct);
     safe_VkPipelineTessellationStateCreateInfo(const safe_VkPipelineTessellationStateCreateInfo& src);
     safe_VkPipelineTessellationStateCreateInfo& operator=(const safe_VkPipelineTessellationStateCreateInfo& src);
+    safe_VkPipelineTessellationStateCreateInfo(safe_VkPipelineTessellationStateCreateInfo&& src) noexcept;
+    safe_VkPipelineTessellationStateCreateInfo& operator=(safe_VkPipelineTessellationStateCreateInfo&& src) noexcept;
     safe_VkPipelineTessellationStateCreateInfo();
     ~safe_VkPipelineTessellationStateCreateInfo();
     void initialize(const VkPipelineTessellationStateCreateInfo* in_struct);
@@ -535,6 +589,8 @@ struct safe_VkPipelineViewportStateCreateInfo {
     safe_VkPipelineViewportStateCreateInfo(const VkPipelineViewportStateCreateInfo* in_struct, const bool is_dynamic_viewports, const bool is_dynamic_scissors);
     safe_VkPipelineViewportStateCreateInfo(const safe_VkPipelineViewportStateCreateInfo& src);
     safe_VkPipelineViewportStateCreateInfo& operator=(const safe_VkPipelineViewportStateCreateInfo& src);
+    safe_VkPipelineViewportStateCreateInfo(safe_VkPipelineViewportStateCreateInfo&& src) noexcept;
+    safe_VkPipelineViewportStateCreateInfo& operator=(safe_VkPipelineViewportStateCreateInfo&& src) noexcept;
     safe_VkPipelineViewportStateCreateInfo();
     ~safe_VkPipelineViewportStateCreateInfo();
     void initialize(const VkPipelineViewportStateCreateInfo* in_struct, const bool is_dynamic_viewports, const bool is_dynamic_scissors);
@@ -560,6 +616,8 @@ struct safe_VkPipelineRasterizationStateCreateInfo {
     safe_VkPipelineRasterizationStateCreateInfo(const VkPipelineRasterizationStateCreateInfo* in_struct);
     safe_VkPipelineRasterizationStateCreateInfo(const safe_VkPipelineRasterizationStateCreateInfo& src);
     safe_VkPipelineRasterizationStateCreateInfo& operator=(const safe_VkPipelineRasterizationStateCreateInfo& src);
+    safe_VkPipelineRasterizationStateCreateInfo(safe_VkPipelineRasterizationStateCreateInfo&& src) noexcept;
+    safe_VkPipelineRasterizationStateCreateInfo& operator=(safe_VkPipelineRasterizationStateCreateInfo&& src) noexcept;
     safe_VkPipelineRasterizationStateCreateInfo();
     ~safe_VkPipelineRasterizationStateCreateInfo();
     void initialize(const VkPipelineRasterizationStateCreateInfo* in_struct);
@@ -581,6 +639,8 @@ struct safe_VkPipelineMultisampleStateCreateInfo {
     safe_VkPipelineMultisampleStateCreateInfo(const VkPipelineMultisampleStateCreateInfo* in_struct);
     safe_VkPipelineMultisampleStateCreateInfo(const safe_VkPipelineMultisampleStateCreateInfo& src);
     safe_VkPipelineMultisampleStateCreateInfo& operator=(const safe_VkPipelineMultisampleStateCreateInfo& src);
+    safe_VkPipelineMultisampleStateCreateInfo(safe_VkPipelineMultisampleStateCreateInfo&& src) noexcept;
+    safe_VkPipelineMultisampleStateCreateInfo& operator=(safe_VkPipelineMultisampleStateCreateInfo&& src) noexcept;
     safe_VkPipelineMultisampleStateCreateInfo();
     ~safe_VkPipelineMultisampleStateCreateInfo();
     void initialize(const VkPipelineMultisampleStateCreateInfo* in_struct);
@@ -605,6 +665,8 @@ struct safe_VkPipelineDepthStencilStateCreateInfo {
     safe_VkPipelineDepthStencilStateCreateInfo(const VkPipelineDepthStencilStateCreateInfo* in_struct);
     safe_VkPipelineDepthStencilStateCreateInfo(const safe_VkPipelineDepthStencilStateCreateInfo& src);
     safe_VkPipelineDepthStencilStateCreateInfo& operator=(const safe_VkPipelineDepthStencilStateCreateInfo& src);
+    safe_VkPipelineDepthStencilStateCreateInfo(safe_VkPipelineDepthStencilStateCreateInfo&& src) noexcept;
+    safe_VkPipelineDepthStencilStateCreateInfo& operator=(safe_VkPipelineDepthStencilStateCreateInfo&& src) noexcept;
     safe_VkPipelineDepthStencilStateCreateInfo();
     ~safe_VkPipelineDepthStencilStateCreateInfo();
     void initialize(const VkPipelineDepthStencilStateCreateInfo* in_struct);
@@ -625,6 +687,8 @@ struct safe_VkPipelineColorBlendStateCreateInfo {
     safe_VkPipelineColorBlendStateCreateInfo(const VkPipelineColorBlendStateCreateInfo* in_struct);
     safe_VkPipelineColorBlendStateCreateInfo(const safe_VkPipelineColorBlendStateCreateInfo& src);
     safe_VkPipelineColorBlendStateCreateInfo& operator=(const safe_VkPipelineColorBlendStateCreateInfo& src);
+    safe_VkPipelineColorBlendStateCreateInfo(safe_VkPipelineColorBlendStateCreateInfo&& src) noexcept;
+    safe_VkPipelineColorBlendStateCreateInfo& operator=(safe_VkPipelineColorBlendStateCreateInfo&& src) noexcept;
     safe_VkPipelineColorBlendStateCreateInfo();
     ~safe_VkPipelineColorBlendStateCreateInfo();
     void initialize(const VkPipelineColorBlendStateCreateInfo* in_struct);
@@ -642,6 +706,8 @@ struct safe_VkPipelineDynamicStateCreateInfo {
     safe_VkPipelineDynamicStateCreateInfo(const VkPipelineDynamicStateCreateInfo* in_struct);
     safe_VkPipelineDynamicStateCreateInfo(const safe_VkPipelineDynamicStateCreateInfo& src);
     safe_VkPipelineDynamicStateCreateInfo& operator=(const safe_VkPipelineDynamicStateCreateInfo& src);
+    safe_VkPipelineDynamicStateCreateInfo(safe_VkPipelineDynamicStateCreateInfo&& src) noexcept;
+    safe_VkPipelineDynamicStateCreateInfo& operator=(safe_VkPipelineDynamicStateCreateInfo&& src) noexcept;
     safe_VkPipelineDynamicStateCreateInfo();
     ~safe_VkPipelineDynamicStateCreateInfo();
     void initialize(const VkPipelineDynamicStateCreateInfo* in_struct);
@@ -673,6 +739,8 @@ struct safe_VkGraphicsPipelineCreateInfo {
     safe_VkGraphicsPipelineCreateInfo(const VkGraphicsPipelineCreateInfo* in_struct, const bool uses_color_attachment, const bool uses_depthstencil_attachment);
     safe_VkGraphicsPipelineCreateInfo(const safe_VkGraphicsPipelineCreateInfo& src);
     safe_VkGraphicsPipelineCreateInfo& operator=(const safe_VkGraphicsPipelineCreateInfo& src);
+    safe_VkGraphicsPipelineCreateInfo(safe_VkGraphicsPipelineCreateInfo&& src) noexcept;
+    safe_VkGraphicsPipelineCreateInfo& operator=(safe_VkGraphicsPipelineCreateInfo&& src) noexcept;
     safe_VkGraphicsPipelineCreateInfo();
     ~safe_VkGraphicsPipelineCreateInfo();
     void initialize(const VkGraphicsPipelineCreateInfo* in_struct, const bool uses_color_attachment, const bool uses_depthstencil_attachment);
@@ -692,6 +760,8 @@ struct safe_VkComputePipelineCreateInfo {
     safe_VkComputePipelineCreateInfo(const VkComputePipelineCreateInfo* in_struct);
     safe_VkComputePipelineCreateInfo(const safe_VkComputePipelineCreateInfo& src);
     safe_VkComputePipelineCreateInfo& operator=(const safe_VkComputePipelineCreateInfo& src);
+    safe_VkComputePipelineCreateInfo(safe_VkComputePipelineCreateInfo&& src) noexcept;
+    safe_VkComputePipelineCreateInfo& operator=(safe_VkComputePipelineCreateInfo&& src) noexcept;
     safe_VkComputePipelineCreateInfo();
     ~safe_VkComputePipelineCreateInfo();
     void initialize(const VkComputePipelineCreateInfo* in_struct);
@@ -711,6 +781,8 @@ struct safe_VkPipelineLayoutCreateInfo {
     safe_VkPipelineLayoutCreateInfo(const VkPipelineLayoutCreateInfo* in_struct);
     safe_VkPipelineLayoutCreateInfo(const safe_VkPipelineLayoutCreateInfo& src);
     safe_VkPipelineLayoutCreateInfo& operator=(const safe_VkPipelineLayoutCreateInfo& src);
+    safe_VkPipelineLayoutCreateInfo(safe_VkPipelineLayoutCreateInfo&& src) noexcept;
+    safe_VkPipelineLayoutCreateInfo& operator=(safe_VkPipelineLayoutCreateInfo&& src) noexcept;
     safe_VkPipelineLayoutCreateInfo();
     ~safe_VkPipelineLayoutCreateInfo();
     void initialize(const VkPipelineLayoutCreateInfo* in_struct);
@@ -741,6 +813,8 @@ struct safe_VkSamplerCreateInfo {
     safe_VkSamplerCreateInfo(const VkSamplerCreateInfo* in_struct);
     safe_VkSamplerCreateInfo(const safe_VkSamplerCreateInfo& src);
     safe_VkSamplerCreateInfo& operator=(const safe_VkSamplerCreateInfo& src);
+    safe_VkSamplerCreateInfo(safe_VkSamplerCreateInfo&& src) noexcept;
+    safe_VkSamplerCreateInfo& operator=(safe_VkSamplerCreateInfo&& src) noexcept;
     safe_VkSamplerCreateInfo();
     ~safe_VkSamplerCreateInfo();
     void initialize(const VkSamplerCreateInfo* in_struct);
@@ -758,6 +832,8 @@ struct safe_VkDescriptorSetLayoutBinding {
     safe_VkDescriptorSetLayoutBinding(const VkDescriptorSetLayoutBinding* in_struct);
     safe_VkDescriptorSetLayoutBinding(const safe_VkDescriptorSetLayoutBinding& src);
     safe_VkDescriptorSetLayoutBinding& operator=(const safe_VkDescriptorSetLayoutBinding& src);
+    safe_VkDescriptorSetLayoutBinding(safe_VkDescriptorSetLayoutBinding&& src) noexcept;
+    safe_VkDescriptorSetLayoutBinding& operator=(safe_VkDescriptorSetLayoutBinding&& src) noexcept;
     safe_VkDescriptorSetLayoutBinding();
     ~safe_VkDescriptorSetLayoutBinding();
     void initialize(const VkDescriptorSetLayoutBinding* in_struct);
@@ -775,6 +851,8 @@ struct safe_VkDescriptorSetLayoutCreateInfo {
     safe_VkDescriptorSetLayoutCreateInfo(const VkDescriptorSetLayoutCreateInfo* in_struct);
     safe_VkDescriptorSetLayoutCreateInfo(const safe_VkDescriptorSetLayoutCreateInfo& src);
     safe_VkDescriptorSetLayoutCreateInfo& operator=(const safe_VkDescriptorSetLayoutCreateInfo& src);
+    safe_VkDescriptorSetLayoutCreateInfo(safe_VkDescriptorSetLayoutCreateInfo&& src) noexcept;
+    safe_VkDescriptorSetLayoutCreateInfo& operator=(safe_VkDescriptorSetLayoutCreateInfo&& src) noexcept;
     safe_VkDescriptorSetLayoutCreateInfo();
     ~safe_VkDescriptorSetLayoutCreateInfo();
     void initialize(const VkDescriptorSetLayoutCreateInfo* in_struct);
@@ -793,6 +871,8 @@ struct safe_VkDescriptorPoolCreateInfo {
     safe_VkDescriptorPoolCreateInfo(const VkDescriptorPoolCreateInfo* in_struct);
     safe_VkDescriptorPoolCreateInfo(const safe_VkDescriptorPoolCreateInfo& src);
     safe_VkDescriptorPoolCreateInfo& operator=(const safe_VkDescriptorPoolCreateInfo& src);
+    safe_VkDescriptorPoolCreateInfo(safe_VkDescriptorPoolCreateInfo&& src) noexcept;
+    safe_VkDescriptorPoolCreateInfo& operator=(safe_VkDescriptorPoolCreateInfo&& src) noexcept;
     safe_VkDescriptorPoolCreateInfo();
     ~safe_VkDescriptorPoolCreateInfo();
     void initialize(const VkDescriptorPoolCreateInfo* in_struct);
@@ -810,6 +890,8 @@ struct safe_VkDescriptorSetAllocateInfo {
     safe_VkDescriptorSetAllocateInfo(const VkDescriptorSetAllocateInfo* in_struct);
     safe_VkDescriptorSetAllocateInfo(const safe_VkDescriptorSetAllocateInfo& src);
     safe_VkDescriptorSetAllocateInfo& operator=(const safe_VkDescriptorSetAllocateInfo& src);
+    safe_VkDescriptorSetAllocateInfo(safe_VkDescriptorSetAllocateInfo&& src) noexcept;
+    safe_VkDescriptorSetAllocateInfo& operator=(safe_VkDescriptorSetAllocateInfo&& src) noexcept;
     safe_VkDescriptorSetAllocateInfo();
     ~safe_VkDescriptorSetAllocateInfo();
     void initialize(const VkDescriptorSetAllocateInfo* in_struct);
@@ -832,6 +914,8 @@ struct safe_VkWriteDescriptorSet {
     safe_VkWriteDescriptorSet(const VkWriteDescriptorSet* in_struct);
     safe_VkWriteDescriptorSet(const safe_VkWriteDescriptorSet& src);
     safe_VkWriteDescriptorSet& operator=(const safe_VkWriteDescriptorSet& src);
+    safe_VkWriteDescriptorSet(safe_VkWriteDescriptorSet&& src) noexcept;
+    safe_VkWriteDescriptorSet& operator=(safe_VkWriteDescriptorSet&& src) noexcept;
     safe_VkWriteDescriptorSet();
     ~safe_VkWriteDescriptorSet();
     void initialize(const VkWriteDescriptorSet* in_struct);
@@ -853,6 +937,8 @@ struct safe_VkCopyDescriptorSet {
     safe_VkCopyDescriptorSet(const VkCopyDescriptorSet* in_struct);
     safe_VkCopyDescriptorSet(const safe_VkCopyDescriptorSet& src);
     safe_VkCopyDescriptorSet& operator=(const safe_VkCopyDescriptorSet& src);
+    safe_VkCopyDescriptorSet(safe_VkCopyDescriptorSet&& src) noexcept;
+    safe_VkCopyDescriptorSet& operator=(safe_VkCopyDescriptorSet&& src) noexcept;
     safe_VkCopyDescriptorSet();
     ~safe_VkCopyDescriptorSet();
     void initialize(const VkCopyDescriptorSet* in_struct);
@@ -874,6 +960,8 @@ struct safe_VkFramebufferCreateInfo {
     safe_VkFramebufferCreateInfo(const VkFramebufferCreateInfo* in_struct);
     safe_VkFramebufferCreateInfo(const safe_VkFramebufferCreateInfo& src);
     safe_VkFramebufferCreateInfo& operator=(const safe_VkFramebufferCreateInfo& src);
+    safe_VkFramebufferCreateInfo(safe_VkFramebufferCreateInfo&& src) noexcept;
+    safe_VkFramebufferCreateInfo& operator=(safe_VkFramebufferCreateInfo&& src) noexcept;
     safe_VkFramebufferCreateInfo();
     ~safe_VkFramebufferCreateInfo();
     void initialize(const VkFramebufferCreateInfo* in_struct);
@@ -896,6 +984,8 @@ struct safe_VkSubpassDescription {
     safe_VkSubpassDescription(const VkSubpassDescription* in_struct);
     safe_VkSubpassDescription(const safe_VkSubpassDescription& src);
     safe_VkSubpassDescription& operator=(const safe_VkSubpassDescription& src);
+    safe_VkSubpassDescription(safe_VkSubpassDescription&& src) noexcept;
+    safe_VkSubpassDescription& operator=(safe_VkSubpassDescription&& src) noexcept;
     safe_VkSubpassDescription();
     ~safe_VkSubpassDescription();
     void initialize(const VkSubpassDescription* in_struct);
@@ -917,6 +1007,8 @@ struct safe_VkRenderPassCreateInfo {
     safe_VkRenderPassCreateInfo(const VkRenderPassCreateInfo* in_struct);
     safe_VkRenderPassCreateInfo(const safe_VkRenderPassCreateInfo& src);
     safe_VkRenderPassCreateInfo& operator=(const safe_VkRenderPassCreateInfo& src);
+    safe_VkRenderPassCreateInfo(safe_VkRenderPassCreateInfo&& src) noexcept;
+    safe_VkRenderPassCreateInfo& operator=(safe_VkRenderPassCreateInfo&& src) noexcept;
     safe_VkRenderPassCreateInfo();
     ~safe_VkRenderPassCreateInfo();
     void initialize(const VkRenderPassCreateInfo* in_struct);
@@ -933,6 +1025,8 @@ struct safe_VkCommandPoolCreateInfo {
     safe_VkCommandPoolCreateInfo(const VkCommandPoolCreateInfo* in_struct);
     safe_VkCommandPoolCreateInfo(const safe_VkCommandPoolCreateInfo& src);
     safe_VkCommandPoolCreateInfo& operator=(const safe_VkCommandPoolCreateInfo& src);
+    safe_VkCommandPoolCreateInfo(safe_VkCommandPoolCreateInfo&& src) noexcept;
+    safe_VkCommandPoolCreateInfo& operator=(safe_VkCommandPoolCreateInfo&& src) noexcept;
     safe_VkCommandPoolCreateInfo();
     ~safe_VkCommandPoolCreateInfo();
     void initialize(const VkCommandPoolCreateInfo* in_struct);
@@ -950,6 +1044,8 @@ struct safe_VkCommandBufferAllocateInfo {
     safe_VkCommandBufferAllocateInfo(const VkCommandBufferAllocateInfo* in_struct);
     safe_VkCommandBufferAllocateInfo(const safe_VkCommandBufferAllocateInfo& src);
     safe_VkCommandBufferAllocateInfo& operator=(const safe_VkCommandBufferAllocateInfo& src);
+    safe_VkCommandBufferAllocateInfo(safe_VkCommandBufferAllocateInfo&& src) noexcept;
+    safe_VkCommandBufferAllocateInfo& operator=(safe_VkCommandBufferAllocateInfo&& src) noexcept;
     safe_VkCommandBufferAllocateInfo();
     ~safe_VkCommandBufferAllocateInfo();
     void initialize(const VkCommandBufferAllocateInfo* in_struct);
@@ -970,6 +1066,8 @@ struct safe_VkCommandBufferInheritanceInfo {
     safe_VkCommandBufferInheritanceInfo(const VkCommandBufferInheritanceInfo* in_struct);
     safe_VkCommandBufferInheritanceInfo(const safe_VkCommandBufferInheritanceInfo& src);
     safe_VkCommandBufferInheritanceInfo& operator=(const safe_VkCommandBufferInheritanceInfo& src);
+    safe_VkCommandBufferInheritanceInfo(safe_VkCommandBufferInheritanceInfo&& src) noexcept;
+    safe_VkCommandBufferInheritanceInfo& operator=(safe_VkCommandBufferInheritanceInfo&& src) noexcept;
     safe_VkCommandBufferInheritanceInfo();
     ~safe_VkCommandBufferInheritanceInfo();
     void initialize(const VkCommandBufferInheritanceInfo* in_struct);
@@ -986,6 +1084,8 @@ struct safe_VkCommandBufferBeginInfo {
     safe_VkCommandBufferBeginInfo(const VkCommandBufferBeginInfo* in_struct);
     safe_VkCommandBufferBeginInfo(const safe_VkCommandBufferBeginInfo& src);
     safe_VkCommandBufferBeginInfo& operator=(const safe_VkCommandBufferBeginInfo& src);
+    safe_VkCommandBufferBeginInfo(safe_VkCommandBufferBeginInfo&& src) noexcept;
+    safe_VkCommandBufferBeginInfo& operator=(safe_VkCommandBufferBeginInfo&& src) noexcept;
     safe_VkCommandBufferBeginInfo();
     ~safe_VkCommandBufferBeginInfo();
     void initialize(const VkCommandBufferBeginInfo* in_struct);
@@ -1002,6 +1102,8 @@ struct safe_VkMemoryBarrier {
     safe_VkMemoryBarrier(const VkMemoryBarrier* in_struct);
     safe_VkMemoryBarrier(const safe_VkMemoryBarrier& src);
     safe_VkMemoryBarrier& operator=(const safe_VkMemoryBarrier& src);
+    safe_VkMemoryBarrier(safe_VkMemoryBarrier&& src) noexcept;
+    safe_VkMemoryBarrier& operator=(safe_VkMemoryBarrier&& src) noexcept;
     safe_VkMemoryBarrier();
     ~safe_VkMemoryBarrier();
     void initialize(const VkMemoryBarrier* in_struct);
@@ -1023,6 +1125,8 @@ struct safe_VkBufferMemoryBarrier {
     safe_VkBufferMemoryBarrier(const VkBufferMemoryBarrier* in_struct);
     safe_VkBufferMemoryBarrier(const safe_VkBufferMemoryBarrier& src);
     safe_VkBufferMemoryBarrier& operator=(const safe_VkBufferMemoryBarrier& src);
+    safe_VkBufferMemoryBarrier(safe_VkBufferMemoryBarrier&& src) noexcept;
+    safe_VkBufferMemoryBarrier& operator=(safe_VkBufferMemoryBarrier&& src) noexcept;
     safe_VkBufferMemoryBarrier();
     ~safe_VkBufferMemoryBarrier();
     void initialize(const VkBufferMemoryBarrier* in_struct);
@@ -1045,6 +1149,8 @@ struct safe_VkImageMemoryBarrier {
     safe_VkImageMemoryBarrier(const VkImageMemoryBarrier* in_struct);
     safe_VkImageMemoryBarrier(const safe_VkImageMemoryBarrier& src);
     safe_VkImageMemoryBarrier& operator=(const safe_VkImageMemoryBarrier& src);
+    safe_VkImageMemoryBarrier(safe_VkImageMemoryBarrier&& src) noexcept;
+    safe_VkImageMemoryBarrier& operator=(safe_VkImageMemoryBarrier&& src) noexcept;
     safe_VkImageMemoryBarrier();
     ~safe_VkImageMemoryBarrier();
     void initialize(const VkImageMemoryBarrier* in_struct);
@@ -1064,6 +1170,8 @@ struct safe_VkRenderPassBeginInfo {
     safe_VkRenderPassBeginInfo(const VkRenderPassBeginInfo* in_struct);
     safe_VkRenderPassBeginInfo(const safe_VkRenderPassBeginInfo& src);
     safe_VkRenderPassBeginInfo& operator=(const safe_VkRenderPassBeginInfo& src);
+    safe_VkRenderPassBeginInfo(safe_VkRenderPassBeginInfo&& src) noexcept;
+    safe_VkRenderPassBeginInfo& operator=(safe_VkRenderPassBeginInfo&& src) noexcept;
     safe_VkRenderPassBeginInfo();
     ~safe_VkRenderPassBeginInfo();
     void initialize(const VkRenderPassBeginInfo* in_struct);
@@ -1078,6 +1186,8 @@ struct safe_VkBaseOutStructure {
     safe_VkBaseOutStructure(const VkBaseOutStructure* in_struct);
     safe_VkBaseOutStructure(const safe_VkBaseOutStructure& src);
     safe_VkBaseOutStructure& operator=(const safe_VkBaseOutStructure& src);
+    safe_VkBaseOutStructure(safe_VkBaseOutStructure&& src) noexcept;
+    safe_VkBaseOutStructure& operator=(safe_VkBaseOutStructure&& src) noexcept;
     safe_VkBaseOutStructure();
     ~safe_VkBaseOutStructure();
     void initialize(const VkBaseOutStructure* in_struct);
@@ -1092,6 +1202,8 @@ struct safe_VkBaseInStructure {
     safe_VkBaseInStructure(const VkBaseInStructure* in_struct);
     safe_VkBaseInStructure(const safe_VkBaseInStructure& src);
     safe_VkBaseInStructure& operator=(const safe_VkBaseInStructure& src);
+    safe_VkBaseInStructure(safe_VkBaseInStructure&& src) noexcept;
+    safe_VkBaseInStructure& operator=(safe_VkBaseInStructure&& src) noexcept;
     safe_VkBaseInStructure();
     ~safe_VkBaseInStructure();
     void initialize(const VkBaseInStructure* in_struct);
@@ -1110,6 +1222,8 @@ struct safe_VkPhysicalDeviceSubgroupProperties {
     safe_VkPhysicalDeviceSubgroupProperties(const VkPhysicalDeviceSubgroupProperties* in_struct);
     safe_VkPhysicalDeviceSubgroupProperties(const safe_VkPhysicalDeviceSubgroupProperties& src);
     safe_VkPhysicalDeviceSubgroupProperties& operator=(const safe_VkPhysicalDeviceSubgroupProperties& src);
+    safe_VkPhysicalDeviceSubgroupProperties(safe_VkPhysicalDeviceSubgroupProperties&& src) noexcept;
+    safe_VkPhysicalDeviceSubgroupProperties& operator=(safe_VkPhysicalDeviceSubgroupProperties&& src) noexcept;
     safe_VkPhysicalDeviceSubgroupProperties();
     ~safe_VkPhysicalDeviceSubgroupProperties();
     void initialize(const VkPhysicalDeviceSubgroupProperties* in_struct);
@@ -1127,6 +1241,8 @@ struct safe_VkBindBufferMemoryInfo {
     safe_VkBindBufferMemoryInfo(const VkBindBufferMemoryInfo* in_struct);
     safe_VkBindBufferMemoryInfo(const safe_VkBindBufferMemoryInfo& src);
     safe_VkBindBufferMemoryInfo& operator=(const safe_VkBindBufferMemoryInfo& src);
+    safe_VkBindBufferMemoryInfo(safe_VkBindBufferMemoryInfo&& src) noexcept;
+    safe_VkBindBufferMemoryInfo& operator=(safe_VkBindBufferMemoryInfo&& src) noexcept;
     safe_VkBindBufferMemoryInfo();
     ~safe_VkBindBufferMemoryInfo();
     void initialize(const VkBindBufferMemoryInfo* in_struct);
@@ -1144,6 +1260,8 @@ struct safe_VkBindImageMemoryInfo {
     safe_VkBindImageMemoryInfo(const VkBindImageMemoryInfo* in_struct);
     safe_VkBindImageMemoryInfo(const safe_VkBindImageMemoryInfo& src);
     safe_VkBindImageMemoryInfo& operator=(const safe_VkBindImageMemoryInfo& src);
+    safe_VkBindImageMemoryInfo(safe_VkBindImageMemoryInfo&& src) noexcept;
+    safe_VkBindImageMemoryInfo& operator=(safe_VkBindImageMemoryInfo&& src) noexcept;
     safe_VkBindImageMemoryInfo();
     ~safe_VkBindImageMemoryInfo();
     void initialize(const VkBindImageMemoryInfo* in_struct);
@@ -1162,6 +1280,8 @@ struct safe_VkPhysicalDevice16BitStorageFeatures {
     safe_VkPhysicalDevice16BitStorageFeatures(const VkPhysicalDevice16BitStorageFeatures* in_struct);
     safe_VkPhysicalDevice16BitStorageFeatures(const safe_VkPhysicalDevice16BitStorageFeatures& src);
     safe_VkPhysicalDevice16BitStorageFeatures& operator=(const safe_VkPhysicalDevice16BitStorageFeatures& src);
+    safe_VkPhysicalDevice16BitStorageFeatures(safe_VkPhysicalDevice16BitStorageFeatures&& src) noexcept;
+    safe_VkPhysicalDevice16BitStorageFeatures& operator=(safe_VkPhysicalDevice16BitStorageFeatures&& src) noexcept;
     safe_VkPhysicalDevice16BitStorageFeatures();
     ~safe_VkPhysicalDevice16BitStorageFeatures();
     void initialize(const VkPhysicalDevice16BitStorageFeatures* in_struct);
@@ -1178,6 +1298,8 @@ struct safe_VkMemoryDedicatedRequirements {
     safe_VkMemoryDedicatedRequirements(const VkMemoryDedicatedRequirements* in_struct);
     safe_VkMemoryDedicatedRequirements(const safe_VkMemoryDedicatedRequirements& src);
     safe_VkMemoryDedicatedRequirements& operator=(const safe_VkMemoryDedicatedRequirements& src);
+    safe_VkMemoryDedicatedRequirements(safe_VkMemoryDedicatedRequirements&& src) noexcept;
+    safe_VkMemoryDedicatedRequirements& operator=(safe_VkMemoryDedicatedRequirements&& src) noexcept;
     safe_VkMemoryDedicatedRequirements();
     ~safe_VkMemoryDedicatedRequirements();
     void initialize(const VkMemoryDedicatedRequirements* in_struct);
@@ -1194,6 +1316,8 @@ struct safe_VkMemoryDedicatedAllocateInfo {
     safe_VkMemoryDedicatedAllocateInfo(const VkMemoryDedicatedAllocateInfo* in_struct);
     safe_VkMemoryDedicatedAllocateInfo(const safe_VkMemoryDedicatedAllocateInfo& src);
     safe_VkMemoryDedicatedAllocateInfo& operator=(const safe_VkMemoryDedicatedAllocateInfo& src);
+    safe_VkMemoryDedicatedAllocateInfo(safe_VkMemoryDedicatedAllocateInfo&& src) noexcept;
+    safe_VkMemoryDedicatedAllocateInfo& operator=(safe_VkMemoryDedicatedAllocateInfo&& src) noexcept;
     safe_VkMemoryDedicatedAllocateInfo();
     ~safe_VkMemoryDedicatedAllocateInfo();
     void initialize(const VkMemoryDedicatedAllocateInfo* in_struct);
@@ -1210,6 +1334,8 @@ struct safe_VkMemoryAllocateFlagsInfo {
     safe_VkMemoryAllocateFlagsInfo(const VkMemoryAllocateFlagsInfo* in_struct);
     safe_VkMemoryAllocateFlagsInfo(const safe_VkMemoryAllocateFlagsInfo& src);
     safe_VkMemoryAllocateFlagsInfo& operator=(const safe_VkMemoryAllocateFlagsInfo& src);
+    safe_VkMemoryAllocateFlagsInfo(safe_VkMemoryAllocateFlagsInfo&& src) noexcept;
+    safe_VkMemoryAllocateFlagsInfo& operator=(safe_VkMemoryAllocateFlagsInfo&& src) noexcept;
     safe_VkMemoryAllocateFlagsInfo();
     ~safe_VkMemoryAllocateFlagsInfo();
     void initialize(const VkMemoryAllocateFlagsInfo* in_struct);
@@ -1227,6 +1353,8 @@ struct safe_VkDeviceGroupRenderPassBeginInfo {
     safe_VkDeviceGroupRenderPassBeginInfo(const VkDeviceGroupRenderPassBeginInfo* in_struct);
     safe_VkDeviceGroupRenderPassBeginInfo(const safe_VkDeviceGroupRenderPassBeginInfo& src);
     safe_VkDeviceGroupRenderPassBeginInfo& operator=(const safe_VkDeviceGroupRenderPassBeginInfo& src);
+    safe_VkDeviceGroupRenderPassBeginInfo(safe_VkDeviceGroupRenderPassBeginInfo&& src) noexcept;
+    safe_VkDeviceGroupRenderPassBeginInfo& operator=(safe_VkDeviceGroupRenderPassBeginInfo&& src) noexcept;
     safe_VkDeviceGroupRenderPassBeginInfo();
     ~safe_VkDeviceGroupRenderPassBeginInfo();
     void initialize(const VkDeviceGroupRenderPassBeginInfo* in_struct);
@@ -1242,6 +1370,8 @@ struct safe_VkDeviceGroupCommandBufferBeginInfo {
     safe_VkDeviceGroupCommandBufferBeginInfo(const VkDeviceGroupCommandBufferBeginInfo* in_struct);
     safe_VkDeviceGroupCommandBufferBeginInfo(const safe_VkDeviceGroupCommandBufferBeginInfo& src);
     safe_VkDeviceGroupCommandBufferBeginInfo& operator=(const safe_VkDeviceGroupCommandBufferBeginInfo& src);
+    safe_VkDeviceGroupCommandBufferBeginInfo(safe_VkDeviceGroupCommandBufferBeginInfo&& src) noexcept;
+    safe_VkDeviceGroupCommandBufferBeginInfo& operator=(safe_VkDeviceGroupCommandBufferBeginInfo&& src) noexcept;
     safe_VkDeviceGroupCommandBufferBeginInfo();
     ~safe_VkDeviceGroupCommandBufferBeginInfo();
     void initialize(const VkDeviceGroupCommandBufferBeginInfo* in_struct);
@@ -1262,6 +1392,8 @@ struct safe_VkDeviceGroupSubmitInfo {
     safe_VkDeviceGroupSubmitInfo(const VkDeviceGroupSubmitInfo* in_struct);
     safe_VkDeviceGroupSubmitInfo(const safe_VkDeviceGroupSubmitInfo& src);
     safe_VkDeviceGroupSubmitInfo& operator=(const safe_VkDeviceGroupSubmitInfo& src);
+    safe_VkDeviceGroupSubmitInfo(safe_VkDeviceGroupSubmitInfo&& src) noexcept;
+    safe_VkDeviceGroupSubmitInfo& operator=(safe_VkDeviceGroupSubmitInfo&& src) noexcept;
     safe_VkDeviceGroupSubmitInfo();
     ~safe_VkDeviceGroupSubmitInfo();
     void initialize(const VkDeviceGroupSubmitInfo* in_struct);
@@ -1278,6 +1410,8 @@ struct safe_VkDeviceGroupBindSparseInfo {
     safe_VkDeviceGroupBindSparseInfo(const VkDeviceGroupBindSparseInfo* in_struct);
     safe_VkDeviceGroupBindSparseInfo(const safe_VkDeviceGroupBindSparseInfo& src);
     safe_VkDeviceGroupBindSparseInfo& operator=(const safe_VkDeviceGroupBindSparseInfo& src);
+    safe_VkDeviceGroupBindSparseInfo(safe_VkDeviceGroupBindSparseInfo&& src) noexcept;
+    safe_VkDeviceGroupBindSparseInfo& operator=(safe_VkDeviceGroupBindSparseInfo&& src) noexcept;
     safe_VkDeviceGroupBindSparseInfo();
     ~safe_VkDeviceGroupBindSparseInfo();
     void initialize(const VkDeviceGroupBindSparseInfo* in_struct);
@@ -1294,6 +1428,8 @@ struct safe_VkBindBufferMemoryDeviceGroupInfo {
     safe_VkBindBufferMemoryDeviceGroupInfo(const VkBindBufferMemoryDeviceGroupInfo* in_struct);
     safe_VkBindBufferMemoryDeviceGroupInfo(const safe_VkBindBufferMemoryDeviceGroupInfo& src);
     safe_VkBindBufferMemoryDeviceGroupInfo& operator=(const safe_VkBindBufferMemoryDeviceGroupInfo& src);
+    safe_VkBindBufferMemoryDeviceGroupInfo(safe_VkBindBufferMemoryDeviceGroupInfo&& src) noexcept;
+    safe_VkBindBufferMemoryDeviceGroupInfo& operator=(safe_VkBindBufferMemoryDeviceGroupInfo&& src) noexcept;
     safe_VkBindBufferMemoryDeviceGroupInfo();
     ~safe_VkBindBufferMemoryDeviceGroupInfo();
     void initialize(const VkBindBufferMemoryDeviceGroupInfo* in_struct);
@@ -1312,6 +1448,8 @@ struct safe_VkBindImageMemoryDeviceGroupInfo {
     safe_VkBindImageMemoryDeviceGroupInfo(const VkBindImageMemoryDeviceGroupInfo* in_struct);
     safe_VkBindImageMemoryDeviceGroupInfo(const safe_VkBindImageMemoryDeviceGroupInfo& src);
     safe_VkBindImageMemoryDeviceGroupInfo& operator=(const safe_VkBindImageMemoryDeviceGroupInfo& src);
+    safe_VkBindImageMemoryDeviceGroupInfo(safe_VkBindImageMemoryDeviceGroupInfo&& src) noexcept;
+    safe_VkBindImageMemoryDeviceGroupInfo& operator=(safe_VkBindImageMemoryDeviceGroupInfo&& src) noexcept;
     safe_VkBindImageMemoryDeviceGroupInfo();
     ~safe_VkBindImageMemoryDeviceGroupInfo();
     void initialize(const VkBindImageMemoryDeviceGroupInfo* in_struct);
@@ -1329,6 +1467,8 @@ struct safe_VkPhysicalDeviceGroupProperties {
     safe_VkPhysicalDeviceGroupProperties(const VkPhysicalDeviceGroupProperties* in_struct);
     safe_VkPhysicalDeviceGroupProperties(const safe_VkPhysicalDeviceGroupProperties& src);
     safe_VkPhysicalDeviceGroupProperties& operator=(const safe_VkPhysicalDeviceGroupProperties& src);
+    safe_VkPhysicalDeviceGroupProperties(safe_VkPhysicalDeviceGroupProperties&& src) noexcept;
+    safe_VkPhysicalDeviceGroupProperties& operator=(safe_VkPhysicalDeviceGroupProperties&& src) noexcept;
     safe_VkPhysicalDeviceGroupProperties();
     ~safe_VkPhysicalDeviceGroupProperties();
     void initialize(const VkPhysicalDeviceGroupProperties* in_struct);
@@ -1345,6 +1485,8 @@ struct safe_VkDeviceGroupDeviceCreateInfo {
     safe_VkDeviceGroupDeviceCreateInfo(const VkDeviceGroupDeviceCreateInfo* in_struct);
     safe_VkDeviceGroupDeviceCreateInfo(const safe_VkDeviceGroupDeviceCreateInfo& src);
     safe_VkDeviceGroupDeviceCreateInfo& operator=(const safe_VkDeviceGroupDeviceCreateInfo& src);
+    safe_VkDeviceGroupDeviceCreateInfo(safe_VkDeviceGroupDeviceCreateInfo&& src) noexcept;
+    safe_VkDeviceGroupDeviceCreateInfo& operator=(safe_VkDeviceGroupDeviceCreateInfo&& src) noexcept;
     safe_VkDeviceGroupDeviceCreateInfo();
     ~safe_VkDeviceGroupDeviceCreateInfo();
     void initialize(const VkDeviceGroupDeviceCreateInfo* in_struct);
@@ -1360,6 +1502,8 @@ struct safe_VkBufferMemoryRequirementsInfo2 {
     safe_VkBufferMemoryRequirementsInfo2(const VkBufferMemoryRequirementsInfo2* in_struct);
     safe_VkBufferMemoryRequirementsInfo2(const safe_VkBufferMemoryRequirementsInfo2& src);
     safe_VkBufferMemoryRequirementsInfo2& operator=(const safe_VkBufferMemoryRequirementsInfo2& src);
+    safe_VkBufferMemoryRequirementsInfo2(safe_VkBufferMemoryRequirementsInfo2&& src) noexcept;
+    safe_VkBufferMemoryRequirementsInfo2& operator=(safe_VkBufferMemoryRequirementsInfo2&& src) noexcept;
     safe_VkBufferMemoryRequirementsInfo2();
     ~safe_VkBufferMemoryRequirementsInfo2();
     void initialize(const VkBufferMemoryRequirementsInfo2* in_struct);
@@ -1375,6 +1519,8 @@ struct safe_VkImageMemoryRequirementsInfo2 {
     safe_VkImageMemoryRequirementsInfo2(const VkImageMemoryRequirementsInfo2* in_struct);
     safe_VkImageMemoryRequirementsInfo2(const safe_VkImageMemoryRequirementsInfo2& src);
     safe_VkImageMemoryRequirementsInfo2& operator=(const safe_VkImageMemoryRequirementsInfo2& src);
+    safe_VkImageMemoryRequirementsInfo2(safe_VkImageMemoryRequirementsInfo2&& src) noexcept;
+    safe_VkImageMemoryRequirementsInfo2& operator=(safe_VkImageMemoryRequirementsInfo2&& src) noexcept;
     safe_VkImageMemoryRequirementsInfo2();
     ~safe_VkImageMemoryRequirementsInfo2();
     void initialize(const VkImageMemoryRequirementsInfo2* in_struct);
@@ -1390,6 +1536,8 @@ struct safe_VkImageSparseMemoryRequirementsInfo2 {
     safe_VkImageSparseMemoryRequirementsInfo2(const VkImageSparseMemoryRequirementsInfo2* in_struct);
     safe_VkImageSparseMemoryRequirementsInfo2(const safe_VkImageSparseMemoryRequirementsInfo2& src);
     safe_VkImageSparseMemoryRequirementsInfo2& operator=(const safe_VkImageSparseMemoryRequirementsInfo2& src);
+    safe_VkImageSparseMemoryRequirementsInfo2(safe_VkImageSparseMemoryRequirementsInfo2&& src) noexcept;
+    safe_VkImageSparseMemoryRequirementsInfo2& operator=(safe_VkImageSparseMemoryRequirementsInfo2&& src) noexcept;
     safe_VkImageSparseMemoryRequirementsInfo2();
     ~safe_VkImageSparseMemoryRequirementsInfo2();
     void initialize(const VkImageSparseMemoryRequirementsInfo2* in_struct);
@@ -1405,6 +1553,8 @@ struct safe_VkMemoryRequirements2 {
     safe_VkMemoryRequirements2(const VkMemoryRequirements2* in_struct);
     safe_VkMemoryRequirements2(const safe_VkMemoryRequirements2& src);
     safe_VkMemoryRequirements2& operator=(const safe_VkMemoryRequirements2& src);
+    safe_VkMemoryRequirements2(safe_VkMemoryRequirements2&& src) noexcept;
+    safe_VkMemoryRequirements2& operator=(safe_VkMemoryRequirements2&& src) noexcept;
     safe_VkMemoryRequirements2();
     ~safe_VkMemoryRequirements2();
     void initialize(const VkMemoryRequirements2* in_struct);
@@ -1420,6 +1570,8 @@ struct safe_VkSparseImageMemoryRequirements2 {
     safe_VkSparseImageMemoryRequirements2(const VkSparseImageMemoryRequirements2* in_struct);
     safe_VkSparseImageMemoryRequirements2(const safe_VkSparseImageMemoryRequirements2& src);
     safe_VkSparseImageMemoryRequirements2& operator=(const safe_VkSparseImageMemoryRequirements2& src);
+    safe_VkSparseImageMemoryRequirements2(safe_VkSparseImageMemoryRequirements2&& src) noexcept;
+    safe_VkSparseImageMemoryRequirements2& operator=(safe_VkSparseImageMemoryRequirements2&& src) noexcept;
     safe_VkSparseImageMemoryRequirements2();
     ~safe_VkSparseImageMemoryRequirements2();
     void initialize(const VkSparseImageMemoryRequirements2* in_struct);
@@ -1435,6 +1587,8 @@ struct safe_VkPhysicalDeviceFeatures2 {
     safe_VkPhysicalDeviceFeatures2(const VkPhysicalDeviceFeatures2* in_struct);
     safe_VkPhysicalDeviceFeatures2(const safe_VkPhysicalDeviceFeatures2& src);
     safe_VkPhysicalDeviceFeatures2& operator=(const safe_VkPhysicalDeviceFeatures2& src);
+    safe_VkPhysicalDeviceFeatures2(safe_VkPhysicalDeviceFeatures2&& src) noexcept;
+    safe_VkPhysicalDeviceFeatures2& operator=(safe_VkPhysicalDeviceFeatures2&& src) noexcept;
     safe_VkPhysicalDeviceFeatures2();
     ~safe_VkPhysicalDeviceFeatures2();
     void initialize(const VkPhysicalDeviceFeatures2* in_struct);
@@ -1450,6 +1604,8 @@ struct safe_VkPhysicalDeviceProperties2 {
     safe_VkPhysicalDeviceProperties2(const VkPhysicalDeviceProperties2* in_struct);
     safe_VkPhysicalDeviceProperties2(const safe_VkPhysicalDeviceProperties2& src);
     safe_VkPhysicalDeviceProperties2& operator=(const safe_VkPhysicalDeviceProperties2& src);
+    safe_VkPhysicalDeviceProperties2(safe_VkPhysicalDeviceProperties2&& src) noexcept;
+    safe_VkPhysicalDeviceProperties2& operator=(safe_VkPhysicalDeviceProperties2&& src) noexcept;
     safe_VkPhysicalDeviceProperties2();
     ~safe_VkPhysicalDeviceProperties2();
     void initialize(const VkPhysicalDeviceProperties2* in_struct);
@@ -1465,6 +1621,8 @@ struct safe_VkFormatProperties2 {
     safe_VkFormatProperties2(const VkFormatProperties2* in_struct);
     safe_VkFormatProperties2(const safe_VkFormatProperties2& src);
     safe_VkFormatProperties2& operator=(const safe_VkFormatProperties2& src);
+    safe_VkFormatProperties2(safe_VkFormatProperties2&& src) noexcept;
+    safe_VkFormatProperties2& operator=(safe_VkFormatProperties2&& src) noexcept;
     safe_VkFormatProperties2();
     ~safe_VkFormatProperties2();
     void initialize(const VkFormatProperties2* in_struct);
@@ -1480,6 +1638,8 @@ struct safe_VkImageFormatProperties2 {
     safe_VkImageFormatProperties2(const VkImageFormatProperties2* in_struct);
     safe_VkImageFormatProperties2(const safe_VkImageFormatProperties2& src);
     safe_VkImageFormatProperties2& operator=(const safe_VkImageFormatProperties2& src);
+    safe_VkImageFormatProperties2(safe_VkImageFormatProperties2&& src) noexcept;
+    safe_VkImageFormatProperties2& operator=(safe_VkImageFormatProperties2&& src) noexcept;
     safe_VkImageFormatProperties2();
     ~safe_VkImageFormatProperties2();
     void initialize(const VkImageFormatProperties2* in_struct);
@@ -1499,6 +1659,8 @@ struct safe_VkPhysicalDeviceImageFormatInfo2 {
     safe_VkPhysicalDeviceImageFormatInfo2(const VkPhysicalDeviceImageFormatInfo2* in_struct);
     safe_VkPhysicalDeviceImageFormatInfo2(const safe_VkPhysicalDeviceImageFormatInfo2& src);
     safe_VkPhysicalDeviceImageFormatInfo2& operator=(const safe_VkPhysicalDeviceImageFormatInfo2& src);
+    safe_VkPhysicalDeviceImageFormatInfo2(safe_VkPhysicalDeviceImageFormatInfo2&& src) noexcept;
+    safe_VkPhysicalDeviceImageFormatInfo2& operator=(safe_VkPhysicalDeviceImageFormatInfo2&& src) noexcept;
     safe_VkPhysicalDeviceImageFormatInfo2();
     ~safe_VkPhysicalDeviceImageFormatInfo2();
     void initialize(const VkPhysicalDeviceImageFormatInfo2* in_struct);
@@ -1514,6 +1676,8 @@ struct safe_VkQueueFamilyProperties2 {
     safe_VkQueueFamilyProperties2(const VkQueueFamilyProperties2* in_struct);
     safe_VkQueueFamilyProperties2(const safe_VkQueueFamilyProperties2& src);
     safe_VkQueueFamilyProperties2& operator=(const safe_VkQueueFamilyProperties2& src);
+    safe_VkQueueFamilyProperties2(safe_VkQueueFamilyProperties2&& src) noexcept;
+    safe_VkQueueFamilyProperties2& operator=(safe_VkQueueFamilyProperties2&& src) noexcept;
     safe_VkQueueFamilyProperties2();
     ~safe_VkQueueFamilyProperties2();
     void initialize(const VkQueueFamilyProperties2* in_struct);
@@ -1529,6 +1693,8 @@ struct safe_VkPhysicalDeviceMemoryProperties2 {
     safe_VkPhysicalDeviceMemoryProperties2(const VkPhysicalDeviceMemoryProperties2* in_struct);
     safe_VkPhysicalDeviceMemoryProperties2(const safe_VkPhysicalDeviceMemoryProperties2& src);
     safe_VkPhysicalDeviceMemoryProperties2& operator=(const safe_VkPhysicalDeviceMemoryProperties2& src);
+    safe_VkPhysicalDeviceMemoryProperties2(safe_VkPhysicalDeviceMemoryProperties2&& src) noexcept;
+    safe_VkPhysicalDeviceMemoryProperties2& operator=(safe_VkPhysicalDeviceMemoryProperties2&& src) noexcept;
     safe_VkPhysicalDeviceMemoryProperties2();
     ~safe_VkPhysicalDeviceMemoryProperties2();
     void initialize(const VkPhysicalDeviceMemoryProperties2* in_struct);
@@ -1544,6 +1710,8 @@ struct safe_VkSparseImageFormatProperties2 {
     safe_VkSparseImageFormatProperties2(const VkSparseImageFormatProperties2* in_struct);
     safe_VkSparseImageFormatProperties2(const safe_VkSparseImageFormatProperties2& src);
     safe_VkSparseImageFormatProperties2& operator=(const safe_VkSparseImageFormatProperties2& src);
+    safe_VkSparseImageFormatProperties2(safe_VkSparseImageFormatProperties2&& src) noexcept;
+    safe_VkSparseImageFormatProperties2& operator=(safe_VkSparseImageFormatProperties2&& src) noexcept;
     safe_VkSparseImageFormatProperties2();
     ~safe_VkSparseImageFormatProperties2();
     void initialize(const VkSparseImageFormatProperties2* in_struct);
@@ -1563,6 +1731,8 @@ struct safe_VkPhysicalDeviceSparseImageFormatInfo2 {
     safe_VkPhysicalDeviceSparseImageFormatInfo2(const VkPhysicalDeviceSparseImageFormatInfo2* in_struct);
     safe_VkPhysicalDeviceSparseImageFormatInfo2(const safe_VkPhysicalDeviceSparseImageFormatInfo2& src);
     safe_VkPhysicalDeviceSparseImageFormatInfo2& operator=(const safe_VkPhysicalDeviceSparseImageFormatInfo2& src);
+    safe_VkPhysicalDeviceSparseImageFormatInfo2(safe_VkPhysicalDeviceSparseImageFormatInfo2&& src) noexcept;
+    safe_VkPhysicalDeviceSparseImageFormatInfo2& operator=(safe_VkPhysicalDeviceSparseImageFormatInfo2&& src) noexcept;
     safe_VkPhysicalDeviceSparseImageFormatInfo2();
     ~safe_VkPhysicalDeviceSparseImageFormatInfo2();
     void initialize(const VkPhysicalDeviceSparseImageFormatInfo2* in_struct);
@@ -1578,6 +1748,8 @@ struct safe_VkPhysicalDevicePointClippingProperties {
     safe_VkPhysicalDevicePointClippingProperties(const VkPhysicalDevicePointClippingProperties* in_struct);
     safe_VkPhysicalDevicePointClippingProperties(const safe_VkPhysicalDevicePointClippingProperties& src);
     safe_VkPhysicalDevicePointClippingProperties& operator=(const safe_VkPhysicalDevicePointClippingProperties& src);
+    safe_VkPhysicalDevicePointClippingProperties(safe_VkPhysicalDevicePointClippingProperties&& src) noexcept;
+    safe_VkPhysicalDevicePointClippingProperties& operator=(safe_VkPhysicalDevicePointClippingProperties&& src) noexcept;
     safe_VkPhysicalDevicePointClippingProperties();
     ~safe_VkPhysicalDevicePointClippingProperties();
     void initialize(const VkPhysicalDevicePointClippingProperties* in_struct);
@@ -1594,6 +1766,8 @@ struct safe_VkRenderPassInputAttachmentAspectCreateInfo {
     safe_VkRenderPassInputAttachmentAspectCreateInfo(const VkRenderPassInputAttachmentAspectCreateInfo* in_struct);
     safe_VkRenderPassInputAttachmentAspectCreateInfo(const safe_VkRenderPassInputAttachmentAspectCreateInfo& src);
     safe_VkRenderPassInputAttachmentAspectCreateInfo& operator=(const safe_VkRenderPassInputAttachmentAspectCreateInfo& src);
+    safe_VkRenderPassInputAttachmentAspectCreateInfo(safe_VkRenderPassInputAttachmentAspectCreateInfo&& src) noexcept;
+    safe_VkRenderPassInputAttachmentAspectCreateInfo& operator=(safe_VkRenderPassInputAttachmentAspectCreateInfo&& src) noexcept;
     safe_VkRenderPassInputAttachmentAspectCreateInfo();
     ~safe_VkRenderPassInputAttachmentAspectCreateInfo();
     void initialize(const VkRenderPassInputAttachmentAspectCreateInfo* in_struct);
@@ -1609,6 +1783,8 @@ struct safe_VkImageViewUsageCreateInfo {
     safe_VkImageViewUsageCreateInfo(const VkImageViewUsageCreateInfo* in_struct);
     safe_VkImageViewUsageCreateInfo(const safe_VkImageViewUsageCreateInfo& src);
     safe_VkImageViewUsageCreateInfo& operator=(const safe_VkImageViewUsageCreateInfo& src);
+    safe_VkImageViewUsageCreateInfo(safe_VkImageViewUsageCreateInfo&& src) noexcept;
+    safe_VkImageViewUsageCreateInfo& operator=(safe_VkImageViewUsageCreateInfo&& src) noexcept;
     safe_VkImageViewUsageCreateInfo();
     ~safe_VkImageViewUsageCreateInfo();
     void initialize(const VkImageViewUsageCreateInfo* in_struct);
@@ -1624,6 +1800,8 @@ struct safe_VkPipelineTessellationDomainOriginStateCreateInfo {
     safe_VkPipelineTessellationDomainOriginStateCreateInfo(const VkPipelineTessellationDomainOriginStateCreateInfo* in_struct);
     safe_VkPipelineTessellationDomainOriginStateCreateInfo(const safe_VkPipelineTessellationDomainOriginStateCreateInfo& src);
     safe_VkPipelineTessellationDomainOriginStateCreateInfo& operator=(const safe_VkPipelineTessellationDomainOriginStateCreateInfo& src);
+    safe_VkPipelineTessellationDomainOriginStateCreateInfo(safe_VkPipelineTessellationDomainOriginStateCreateInfo&& src) noexcept;
+    safe_VkPipelineTessellationDomainOriginStateCreateInfo& operator=(safe_VkPipelineTessellationDomainOriginStateCreateInfo&& src) noexcept;
     safe_VkPipelineTessellationDomainOriginStateCreateInfo();
     ~safe_VkPipelineTessellationDomainOriginStateCreateInfo();
     void initialize(const VkPipelineTessellationDomainOriginStateCreateInfo* in_struct);
@@ -1644,6 +1822,8 @@ struct safe_VkRenderPassMultiviewCreateInfo {
     safe_VkRenderPassMultiviewCreateInfo(const VkRenderPassMultiviewCreateInfo* in_struct);
     safe_VkRenderPassMultiviewCreateInfo(const safe_VkRenderPassMultiviewCreateInfo& src);
     safe_VkRenderPassMultiviewCreateInfo& operator=(const safe_VkRenderPassMultiviewCreateInfo& src);
+    safe_VkRenderPassMultiviewCreateInfo(safe_VkRenderPassMultiviewCreateInfo&& src) noexcept;
+    safe_VkRenderPassMultiviewCreateInfo& operator=(safe_VkRenderPassMultiviewCreateInfo&& src) noexcept;
     safe_VkRenderPassMultiviewCreateInfo();
     ~safe_VkRenderPassMultiviewCreateInfo();
     void initialize(const VkRenderPassMultiviewCreateInfo* in_struct);
@@ -1661,6 +1841,8 @@ struct safe_VkPhysicalDeviceMultiviewFeatures {
     safe_VkPhysicalDeviceMultiviewFeatures(const VkPhysicalDeviceMultiviewFeatures* in_struct);
     safe_VkPhysicalDeviceMultiviewFeatures(const safe_VkPhysicalDeviceMultiviewFeatures& src);
     safe_VkPhysicalDeviceMultiviewFeatures& operator=(const safe_VkPhysicalDeviceMultiviewFeatures& src);
+    safe_VkPhysicalDeviceMultiviewFeatures(safe_VkPhysicalDeviceMultiviewFeatures&& src) noexcept;
+    safe_VkPhysicalDeviceMultiviewFeatures& operator=(safe_VkPhysicalDeviceMultiviewFeatures&& src) noexcept;
     safe_VkPhysicalDeviceMultiviewFeatures();
     ~safe_VkPhysicalDeviceMultiviewFeatures();
     void initialize(const VkPhysicalDeviceMultiviewFeatures* in_struct);
@@ -1677,6 +1859,8 @@ struct safe_VkPhysicalDeviceMultiviewProperties {
     safe_VkPhysicalDeviceMultiviewProperties(const VkPhysicalDeviceMultiviewProperties* in_struct);
     safe_VkPhysicalDeviceMultiviewProperties(const safe_VkPhysicalDeviceMultiviewProperties& src);
     safe_VkPhysicalDeviceMultiviewProperties& operator=(const safe_VkPhysicalDeviceMultiviewProperties& src);
+    safe_VkPhysicalDeviceMultiviewProperties(safe_VkPhysicalDeviceMultiviewProperties&& src) noexcept;
+    safe_VkPhysicalDeviceMultiviewProperties& operator=(safe_VkPhysicalDeviceMultiviewProperties&& src) noexcept;
     safe_VkPhysicalDeviceMultiviewProperties();
     ~safe_VkPhysicalDeviceMultiviewProperties();
     void initialize(const VkPhysicalDeviceMultiviewProperties* in_struct);
@@ -1693,6 +1877,8 @@ struct safe_VkPhysicalDeviceVariablePointersFeatures {
     safe_VkPhysicalDeviceVariablePointersFeatures(const VkPhysicalDeviceVariablePointersFeatures* in_struct);
     safe_VkPhysicalDeviceVariablePointersFeatures(const safe_VkPhysicalDeviceVariablePointersFeatures& src);
     safe_VkPhysicalDeviceVariablePointersFeatures& operator=(const safe_VkPhysicalDeviceVariablePointersFeatures& src);
+    safe_VkPhysicalDeviceVariablePointersFeatures(safe_VkPhysicalDeviceVariablePointersFeatures&& src) noexcept;
+    safe_VkPhysicalDeviceVariablePointersFeatures& operator=(safe_VkPhysicalDeviceVariablePointersFeatures&& src) noexcept;
     safe_VkPhysicalDeviceVariablePointersFeatures();
     ~safe_VkPhysicalDeviceVariablePointersFeatures();
     void initialize(const VkPhysicalDeviceVariablePointersFeatures* in_struct);
@@ -1708,6 +1894,8 @@ struct safe_VkPhysicalDeviceProtectedMemoryFeatures {
     safe_VkPhysicalDeviceProtectedMemoryFeatures(const VkPhysicalDeviceProtectedMemoryFeatures* in_struct);
     safe_VkPhysicalDeviceProtectedMemoryFeatures(const safe_VkPhysicalDeviceProtectedMemoryFeatures& src);
     safe_VkPhysicalDeviceProtectedMemoryFeatures& operator=(const safe_VkPhysicalDeviceProtectedMemoryFeatures& src);
+    safe_VkPhysicalDeviceProtectedMemoryFeatures(safe_VkPhysicalDeviceProtectedMemoryFeatures&& src) noexcept;
+    safe_VkPhysicalDeviceProtectedMemoryFeatures& operator=(safe_VkPhysicalDeviceProtectedMemoryFeatures&& src) noexcept;
     safe_VkPhysicalDeviceProtectedMemoryFeatures();
     ~safe_VkPhysicalDeviceProtectedMemoryFeatures();
     void initialize(const VkPhysicalDeviceProtectedMemoryFeatures* in_struct);
@@ -1723,6 +1911,8 @@ struct safe_VkPhysicalDeviceProtectedMemoryProperties {
     safe_VkPhysicalDeviceProtectedMemoryProperties(const VkPhysicalDeviceProtectedMemoryProperties* in_struct);
     safe_VkPhysicalDeviceProtectedMemoryProperties(const safe_VkPhysicalDeviceProtectedMemoryProperties& src);
     safe_VkPhysicalDeviceProtectedMemoryProperties& operator=(const safe_VkPhysicalDeviceProtectedMemoryProperties& src);
+    safe_VkPhysicalDeviceProtectedMemoryProperties(safe_VkPhysicalDeviceProtectedMemoryProperties&& src) noexcept;
+    safe_VkPhysicalDeviceProtectedMemoryProperties& operator=(safe_VkPhysicalDeviceProtectedMemoryProperties&& src) noexcept;
     safe_VkPhysicalDeviceProtectedMemoryProperties();
     ~safe_VkPhysicalDeviceProtectedMemoryProperties();
     void initialize(const VkPhysicalDeviceProtectedMemoryProperties* in_struct);
@@ -1740,6 +1930,8 @@ struct safe_VkDeviceQueueInfo2 {
     safe_VkDeviceQueueInfo2(const VkDeviceQueueInfo2* in_struct);
     safe_VkDeviceQueueInfo2(const safe_VkDeviceQueueInfo2& src);
     safe_VkDeviceQueueInfo2& operator=(const safe_VkDeviceQueueInfo2& src);
+    safe_VkDeviceQueueInfo2(safe_VkDeviceQueueInfo2&& src) noexcept;
+    safe_VkDeviceQueueInfo2& operator=(safe_VkDeviceQueueInfo2&& src) noexcept;
     safe_VkDeviceQueueInfo2();
     ~safe_VkDeviceQueueInfo2();
     void initialize(const VkDeviceQueueInfo2* in_struct);
@@ -1755,6 +1947,8 @@ struct safe_VkProtectedSubmitInfo {
     safe_VkProtectedSubmitInfo(const VkProtectedSubmitInfo* in_struct);
     safe_VkProtectedSubmitInfo(const safe_VkProtectedSubmitInfo& src);
     safe_VkProtectedSubmitInfo& operator=(const safe_VkProtectedSubmitInfo& src);
+    safe_VkProtectedSubmitInfo(safe_VkProtectedSubmitInfo&& src) noexcept;
+    safe_VkProtectedSubmitInfo& operator=(safe_VkProtectedSubmitInfo&& src) noexcept;
     safe_VkProtectedSubmitInfo();
     ~safe_VkProtectedSubmitInfo();
     void initialize(const VkProtectedSubmitInfo* in_struct);
@@ -1777,6 +1971,8 @@ struct safe_VkSamplerYcbcrConversionCreateInfo {
     safe_VkSamplerYcbcrConversionCreateInfo(const VkSamplerYcbcrConversionCreateInfo* in_struct);
     safe_VkSamplerYcbcrConversionCreateInfo(const safe_VkSamplerYcbcrConversionCreateInfo& src);
     safe_VkSamplerYcbcrConversionCreateInfo& operator=(const safe_VkSamplerYcbcrConversionCreateInfo& src);
+    safe_VkSamplerYcbcrConversionCreateInfo(safe_VkSamplerYcbcrConversionCreateInfo&& src) noexcept;
+    safe_VkSamplerYcbcrConversionCreateInfo& operator=(safe_VkSamplerYcbcrConversionCreateInfo&& src) noexcept;
     safe_VkSamplerYcbcrConversionCreateInfo();
     ~safe_VkSamplerYcbcrConversionCreateInfo();
     void initialize(const VkSamplerYcbcrConversionCreateInfo* in_struct);
@@ -1792,6 +1988,8 @@ struct safe_VkSamplerYcbcrConversionInfo {
     safe_VkSamplerYcbcrConversionInfo(const VkSamplerYcbcrConversionInfo* in_struct);
     safe_VkSamplerYcbcrConversionInfo(const safe_VkSamplerYcbcrConversionInfo& src);
     safe_VkSamplerYcbcrConversionInfo& operator=(const safe_VkSamplerYcbcrConversionInfo& src);
+    safe_VkSamplerYcbcrConversionInfo(safe_VkSamplerYcbcrConversionInfo&& src) noexcept;
+    safe_VkSamplerYcbcrConversionInfo& operator=(safe_VkSamplerYcbcrConversionInfo&& src) noexcept;
     safe_VkSamplerYcbcrConversionInfo();
     ~safe_VkSamplerYcbcrConversionInfo();
     void initialize(const VkSamplerYcbcrConversionInfo* in_struct);
@@ -1807,6 +2005,8 @@ struct safe_VkBindImagePlaneMemoryInfo {
     safe_VkBindImagePlaneMemoryInfo(const VkBindImagePlaneMemoryInfo* in_struct);
     safe_VkBindImagePlaneMemoryInfo(const safe_VkBindImagePlaneMemoryInfo& src);
     safe_VkBindImagePlaneMemoryInfo& operator=(const safe_VkBindImagePlaneMemoryInfo& src);
+    safe_VkBindImagePlaneMemoryInfo(safe_VkBindImagePlaneMemoryInfo&& src) noexcept;
+    safe_VkBindImagePlaneMemoryInfo& operator=(safe_VkBindImagePlaneMemoryInfo&& src) noexcept;
     safe_VkBindImagePlaneMemoryInfo();
     ~safe_VkBindImagePlaneMemoryInfo();
     void initialize(const VkBindImagePlaneMemoryInfo* in_struct);
@@ -1822,6 +2022,8 @@ struct safe_VkImagePlaneMemoryRequirementsInfo {
     safe_VkImagePlaneMemoryRequirementsInfo(const VkImagePlaneMemoryRequirementsInfo* in_struct);
     safe_VkImagePlaneMemoryRequirementsInfo(const safe_VkImagePlaneMemoryRequirementsInfo& src);
     safe_VkImagePlaneMemoryRequirementsInfo& operator=(const safe_VkImagePlaneMemoryRequirementsInfo& src);
+    safe_VkImagePlaneMemoryRequirementsInfo(safe_VkImagePlaneMemoryRequirementsInfo&& src) noexcept;
+    safe_VkImagePlaneMemoryRequirementsInfo& operator=(safe_VkImagePlaneMemoryRequirementsInfo&& src) noexcept;
     safe_VkImagePlaneMemoryRequirementsInfo();
     ~safe_VkImagePlaneMemoryRequirementsInfo();
     void initialize(const VkImagePlaneMemoryRequirementsInfo* in_struct);
@@ -1837,6 +2039,8 @@ struct safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures {
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(const VkPhysicalDeviceSamplerYcbcrConversionFeatures* in_struct);
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(const safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& src);
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& operator=(const safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& src);
+    safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& src) noexcept;
+    safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures& operator=(safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures&& src) noexcept;
     safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
     ~safe_VkPhysicalDeviceSamplerYcbcrConversionFeatures();
     void initialize(const VkPhysicalDeviceSamplerYcbcrConversionFeatures* in_struct);
@@ -1852,6 +2056,8 @@ struct safe_VkSamplerYcbcrConversionImageFormatProperties {
     safe_VkSamplerYcbcrConversionImageFormatProperties(const VkSamplerYcbcrConversionImageFormatProperties* in_struct);
     safe_VkSamplerYcbcrConversionImageFormatProperties(const safe_VkSamplerYcbcrConversionImageFormatProperties& src);
     safe_VkSamplerYcbcrConversionImageFormatProperties& operator=(const safe_VkSamplerYcbcrConversionImageFormatProperties& src);
+    safe_VkSamplerYcbcrConversionImageFormatProperties(safe_VkSamplerYcbcrConversionImageFormatProperties&& src) noexcept;
+    safe_VkSamplerYcbcrConversionImageFormatProperties& operator=(safe_VkSamplerYcbcrConversionImageFormatProperties&& src) noexcept;
     safe_VkSamplerYcbcrConversionImageFormatProperties();
     ~safe_VkSamplerYcbcrConversionImageFormatProperties();
     void initialize(const VkSamplerYcbcrConversionImageFormatProperties* in_struct);
@@ -1874,6 +2080,8 @@ struct safe_VkDescriptorUpdateTemplateCreateInfo {
     safe_VkDescriptorUpdateTemplateCreateInfo(const VkDescriptorUpdateTemplateCreateInfo* in_struct);
     safe_VkDescriptorUpdateTemplateCreateInfo(const safe_VkDescriptorUpdateTemplateCreateInfo& src);
     safe_VkDescriptorUpdateTemplateCreateInfo& operator=(const safe_VkDescriptorUpdateTemplateCreateInfo& src);
+    safe_VkDescriptorUpdateTemplateCreateInfo(safe_VkDescriptorUpdateTemplateCreateInfo&& src) noexcept;
+    safe_VkDescriptorUpdateTemplateCreateInfo& operator=(safe_VkDescriptorUpdateTemplateCreateInfo&& src) noexcept;
     safe_VkDescriptorUpdateTemplateCreateInfo();
     ~safe_VkDescriptorUpdateTemplateCreateInfo();
     void initialize(const VkDescriptorUpdateTemplateCreateInfo* in_struct);
@@ -1889,6 +2097,8 @@ struct safe_VkPhysicalDeviceExternalImageFormatInfo {
     safe_VkPhysicalDeviceExternalImageFormatInfo(const VkPhysicalDeviceExternalImageFormatInfo* in_struct);
     safe_VkPhysicalDeviceExternalImageFormatInfo(const safe_VkPhysicalDeviceExternalImageFormatInfo& src);
     safe_VkPhysicalDeviceExternalImageFormatInfo& operator=(const safe_VkPhysicalDeviceExternalImageFormatInfo& src);
+    safe_VkPhysicalDeviceExternalImageFormatInfo(safe_VkPhysicalDeviceExternalImageFormatInfo&& src) noexcept;
+    safe_VkPhysicalDeviceExternalImageFormatInfo& operator=(safe_VkPhysicalDeviceExternalImageFormatInfo&& src) noexcept;
     safe_VkPhysicalDeviceExternalImageFormatInfo();
     ~safe_VkPhysicalDeviceExternalImageFormatInfo();
     void initialize(const VkPhysicalDeviceExternalImageFormatInfo* in_struct);
@@ -1904,6 +2114,8 @@ struct safe_VkExternalImageFormatProperties {
     safe_VkExternalImageFormatProperties(const VkExternalImageFormatProperties* in_struct);
     safe_VkExternalImageFormatProperties(const safe_VkExternalImageFormatProperties& src);
     safe_VkExternalImageFormatProperties& operator=(const safe_VkExternalImageFormatProperties& src);
+    safe_VkExternalImageFormatProperties(safe_VkExternalImageFormatProperties&& src) noexcept;
+    safe_VkExternalImageFormatProperties& operator=(safe_VkExternalImageFormatProperties&& src) noexcept;
     safe_VkExternalImageFormatProperties();
     ~safe_VkExternalImageFormatProperties();
     void initialize(const VkExternalImageFormatProperties* in_struct);
@@ -1921,6 +2133,8 @@ struct safe_VkPhysicalDeviceExternalBufferInfo {
     safe_VkPhysicalDeviceExternalBufferInfo(const VkPhysicalDeviceExternalBufferInfo* in_struct);
     safe_VkPhysicalDeviceExternalBufferInfo(const safe_VkPhysicalDeviceExternalBufferInfo& src);
     safe_VkPhysicalDeviceExternalBufferInfo& operator=(const safe_VkPhysicalDeviceExternalBufferInfo& src);
+    safe_VkPhysicalDeviceExternalBufferInfo(safe_VkPhysicalDeviceExternalBufferInfo&& src) noexcept;
+    safe_VkPhysicalDeviceExternalBufferInfo& operator=(safe_VkPhysicalDeviceExternalBufferInfo&& src) noexcept;
     safe_VkPhysicalDeviceExternalBufferInfo();
     ~safe_VkPhysicalDeviceExternalBufferInfo();
     void initialize(const VkPhysicalDeviceExternalBufferInfo* in_struct);
@@ -1936,6 +2150,8 @@ struct safe_VkExternalBufferProperties {
     safe_VkExternalBufferProperties(const VkExternalBufferProperties* in_struct);
     safe_VkExternalBufferProperties(const safe_VkExternalBufferProperties& src);
     safe_VkExternalBufferProperties& operator=(const safe_VkExternalBufferProperties& src);
+    safe_VkExternalBufferProperties(safe_VkExternalBufferProperties&& src) noexcept;
+    safe_VkExternalBufferProperties& operator=(safe_VkExternalBufferProperties&& src) noexcept;
     safe_VkExternalBufferProperties();
     ~safe_VkExternalBufferProperties();
     void initialize(const VkExternalBufferProperties* in_struct);
@@ -1955,6 +2171,8 @@ struct safe_VkPhysicalDeviceIDProperties {
     safe_VkPhysicalDeviceIDProperties(const VkPhysicalDeviceIDProperties* in_struct);
     safe_VkPhysicalDeviceIDProperties(const safe_VkPhysicalDeviceIDProperties& src);
     safe_VkPhysicalDeviceIDProperties& operator=(const safe_VkPhysicalDeviceIDProperties& src);
+    safe_VkPhysicalDeviceIDProperties(safe_VkPhysicalDeviceIDProperties&& src) noexcept;
+    safe_VkPhysicalDeviceIDProperties& operator=(safe_VkPhysicalDeviceIDProperties&& src) noexcept;
     safe_VkPhysicalDeviceIDProperties();
     ~safe_VkPhysicalDeviceIDProperties();
     void initialize(const VkPhysicalDeviceIDProperties* in_struct);
@@ -1970,6 +2188,8 @@ struct safe_VkExternalMemoryImageCreateInfo {
     safe_VkExternalMemoryImageCreateInfo(const VkExternalMemoryImageCreateInfo* in_struct);
     safe_VkExternalMemoryImageCreateInfo(const safe_VkExternalMemoryImageCreateInfo& src);
     safe_VkExternalMemoryImageCreateInfo& operator=(const safe_VkExternalMemoryImageCreateInfo& src);
+    safe_VkExternalMemoryImageCreateInfo(safe_VkExternalMemoryImageCreateInfo&& src) noexcept;
+    safe_VkExternalMemoryImageCreateInfo& operator=(safe_VkExternalMemoryImageCreateInfo&& src) noexcept;
     safe_VkExternalMemoryImageCreateInfo();
     ~safe_VkExternalMemoryImageCreateInfo();
     void initialize(const VkExternalMemoryImageCreateInfo* in_struct);
@@ -1985,6 +2205,8 @@ struct safe_VkExternalMemoryBufferCreateInfo {
     safe_VkExternalMemoryBufferCreateInfo(const VkExternalMemoryBufferCreateInfo* in_struct);
     safe_VkExternalMemoryBufferCreateInfo(const safe_VkExternalMemoryBufferCreateInfo& src);
     safe_VkExternalMemoryBufferCreateInfo& operator=(const safe_VkExternalMemoryBufferCreateInfo& src);
+    safe_VkExternalMemoryBufferCreateInfo(safe_VkExternalMemoryBufferCreateInfo&& src) noexcept;
+    safe_VkExternalMemoryBufferCreateInfo& operator=(safe_VkExternalMemoryBufferCreateInfo&& src) noexcept;
     safe_VkExternalMemoryBufferCreateInfo();
     ~safe_VkExternalMemoryBufferCreateInfo();
     void initialize(const VkExternalMemoryBufferCreateInfo* in_struct);
@@ -2000,6 +2222,8 @@ struct safe_VkExportMemoryAllocateInfo {
     safe_VkExportMemoryAllocateInfo(const VkExportMemoryAllocateInfo* in_struct);
     safe_VkExportMemoryAllocateInfo(const safe_VkExportMemoryAllocateInfo& src);
     safe_VkExportMemoryAllocateInfo& operator=(const safe_VkExportMemoryAllocateInfo& src);
+    safe_VkExportMemoryAllocateInfo(safe_VkExportMemoryAllocateInfo&& src) noexcept;
+    safe_VkExportMemoryAllocateInfo& operator=(safe_VkExportMemoryAllocateInfo&& src) noexcept;
     safe_VkExportMemoryAllocateInfo();
     ~safe_VkExportMemoryAllocateInfo();
     void initialize(const VkExportMemoryAllocateInfo* in_struct);
@@ -2015,6 +2239,8 @@ struct safe_VkPhysicalDeviceExternalFenceInfo {
     safe_VkPhysicalDeviceExternalFenceInfo(const VkPhysicalDeviceExternalFenceInfo* in_struct);
     safe_VkPhysicalDeviceExternalFenceInfo(const safe_VkPhysicalDeviceExternalFenceInfo& src);
     safe_VkPhysicalDeviceExternalFenceInfo& operator=(const safe_VkPhysicalDeviceExternalFenceInfo& src);
+    safe_VkPhysicalDeviceExternalFenceInfo(safe_VkPhysicalDeviceExternalFenceInfo&& src) noexcept;
+    safe_VkPhysicalDeviceExternalFenceInfo& operator=(safe_VkPhysicalDeviceExternalFenceInfo&& src) noexcept;
     safe_VkPhysicalDeviceExternalFenceInfo();
     ~safe_VkPhysicalDeviceExternalFenceInfo();
     void initialize(const VkPhysicalDeviceExternalFenceInfo* in_struct);
@@ -2032,6 +2258,8 @@ struct safe_VkExternalFenceProperties {
     safe_VkExternalFenceProperties(const VkExternalFenceProperties* in_struct);
     safe_VkExternalFenceProperties(const safe_VkExternalFenceProperties& src);
     safe_VkExternalFenceProperties& operator=(const safe_VkExternalFenceProperties& src);
+    safe_VkExternalFenceProperties(safe_VkExternalFenceProperties&& src) noexcept;
+    safe_VkExternalFenceProperties& operator=(safe_VkExternalFenceProperties&& src) noexcept;
     safe_VkExternalFenceProperties();
     ~safe_VkExternalFenceProperties();
     void initialize(const VkExternalFenceProperties* in_struct);
@@ -2047,6 +2275,8 @@ struct safe_VkExportFenceCreateInfo {
     safe_VkExportFenceCreateInfo(const VkExportFenceCreateInfo* in_struct);
     safe_VkExportFenceCreateInfo(const safe_VkExportFenceCreateInfo& src);
     safe_VkExportFenceCreateInfo& operator=(const safe_VkExportFenceCreateInfo& src);
+    safe_VkExportFenceCreateInfo(safe_VkExportFenceCreateInfo&& src) noexcept;
+    safe_VkExportFenceCreateInfo& operator=(safe_VkExportFenceCreateInfo&& src) noexcept;
     safe_VkExportFenceCreateInfo();
     ~safe_VkExportFenceCreateInfo();
     void initialize(const VkExportFenceCreateInfo* in_struct);
@@ -2062,6 +2292,8 @@ struct safe_VkExportSemaphoreCreateInfo {
     safe_VkExportSemaphoreCreateInfo(const VkExportSemaphoreCreateInfo* in_struct);
     safe_VkExportSemaphoreCreateInfo(const safe_VkExportSemaphoreCreateInfo& src);
     safe_VkExportSemaphoreCreateInfo& operator=(const safe_VkExportSemaphoreCreateInfo& src);
+    safe_VkExportSemaphoreCreateInfo(safe_VkExportSemaphoreCreateInfo&& src) noexcept;
+    safe_VkExportSemaphoreCreateInfo& operator=(safe_VkExportSemaphoreCreateInfo&& src) noexcept;
     safe_VkExportSemaphoreCreateInfo();
     ~safe_VkExportSemaphoreCreateInfo();
     void initialize(const VkExportSemaphoreCreateInfo* in_struct);
@@ -2077,6 +2309,8 @@ struct safe_VkPhysicalDeviceExternalSemaphoreInfo {
     safe_VkPhysicalDeviceExternalSemaphoreInfo(const VkPhysicalDeviceExternalSemaphoreInfo* in_struct);
     safe_VkPhysicalDeviceExternalSemaphoreInfo(const safe_VkPhysicalDeviceExternalSemaphoreInfo& src);
     safe_VkPhysicalDeviceExternalSemaphoreInfo& operator=(const safe_VkPhysicalDeviceExternalSemaphoreInfo& src);
+    safe_VkPhysicalDeviceExternalSemaphoreInfo(safe_VkPhysicalDeviceExternalSemaphoreInfo&& src) noexcept;
+    safe_VkPhysicalDeviceExternalSemaphoreInfo& operator=(safe_VkPhysicalDeviceExternalSemaphoreInfo&& src) noexcept;
     safe_VkPhysicalDeviceExternalSemaphoreInfo();
     ~safe_VkPhysicalDeviceExternalSemaphoreInfo();
     void initialize(const VkPhysicalDeviceExternalSemaphoreInfo* in_struct);
@@ -2094,6 +2328,8 @@ struct safe_VkExternalSemaphoreProperties {
     safe_VkExternalSemaphoreProperties(const VkExternalSemaphoreProperties* in_struct);
     safe_VkExternalSemaphoreProperties(const safe_VkExternalSemaphoreProperties& src);
     safe_VkExternalSemaphoreProperties& operator=(const safe_VkExternalSemaphoreProperties& src);
+    safe_VkExternalSemaphoreProperties(safe_VkExternalSemaphoreProperties&& src) noexcept;
+    safe_VkExternalSemaphoreProperties& operator=(safe_VkExternalSemaphoreProperties&& src) noexcept;
     safe_VkExternalSemaphoreProperties();
     ~safe_VkExternalSemaphoreProperties();
     void initialize(const VkExternalSemaphoreProperties* in_struct);
@@ -2110,6 +2346,8 @@ struct safe_VkPhysicalDeviceMaintenance3Properties {
     safe_VkPhysicalDeviceMaintenance3Properties(const VkPhysicalDeviceMaintenance3Properties* in_struct);
     safe_VkPhysicalDeviceMaintenance3Properties(const safe_VkPhysicalDeviceMaintenance3Properties& src);
     safe_VkPhysicalDeviceMaintenance3Properties& operator=(const safe_VkPhysicalDeviceMaintenance3Properties& src);
+    safe_VkPhysicalDeviceMaintenance3Properties(safe_VkPhysicalDeviceMaintenance3Properties&& src) noexcept;
+    safe_VkPhysicalDeviceMaintenance3Properties& operator=(safe_VkPhysicalDeviceMaintenance3Properties&& src) noexcept;
     safe_VkPhysicalDeviceMaintenance3Properties();
     ~safe_VkPhysicalDeviceMaintenance3Properties();
     void initialize(const VkPhysicalDeviceMaintenance3Properties* in_struct);
@@ -2125,6 +2363,8 @@ struct safe_VkDescriptorSetLayoutSupport {
     safe_VkDescriptorSetLayoutSupport(const VkDescriptorSetLayoutSupport* in_struct);
     safe_VkDescriptorSetLayoutSupport(const safe_VkDescriptorSetLayoutSupport& src);
     safe_VkDescriptorSetLayoutSupport& operator=(const safe_VkDescriptorSetLayoutSupport& src);
+    safe_VkDescriptorSetLayoutSupport(safe_VkDescriptorSetLayoutSupport&& src) noexcept;
+    safe_VkDescriptorSetLayoutSupport& operator=(safe_VkDescriptorSetLayoutSupport&& src) noexcept;
     safe_VkDescriptorSetLayoutSupport();
     ~safe_VkDescriptorSetLayoutSupport();
     void initialize(const VkDescriptorSetLayoutSupport* in_struct);
@@ -2140,6 +2380,8 @@ struct safe_VkPhysicalDeviceShaderDrawParametersFeatures {
     safe_VkPhysicalDeviceShaderDrawParametersFeatures(const VkPhysicalDeviceShaderDrawParametersFeatures* in_struct);
     safe_VkPhysicalDeviceShaderDrawParametersFeatures(const safe_VkPhysicalDeviceShaderDrawParametersFeatures& src);
     safe_VkPhysicalDeviceShaderDrawParametersFeatures& operator=(const safe_VkPhysicalDeviceShaderDrawParametersFeatures& src);
+    safe_VkPhysicalDeviceShaderDrawParametersFeatures(safe_VkPhysicalDeviceShaderDrawParametersFeatures&& src) noexcept;
+    safe_VkPhysicalDeviceShaderDrawParametersFeatures& operator=(safe_VkPhysicalDeviceShaderDrawParametersFeatures&& src) noexcept;
     safe_VkPhysicalDeviceShaderDrawParametersFeatures();
     ~safe_VkPhysicalDeviceShaderDrawParametersFeatures();
     void initialize(const VkPhysicalDeviceShaderDrawParametersFeatures* in_struct);
@@ -2170,6 +2412,8 @@ struct safe_VkSwapchainCreateInfoKHR {
     safe_VkSwapchainCreateInfoKHR(const VkSwapchainCreateInfoKHR* in_struct);
     safe_VkSwapchainCreateInfoKHR(const safe_VkSwapchainCreateInfoKHR& src);
     safe_VkSwapchainCreateInfoKHR& operator=(const safe_VkSwapchainCreateInfoKHR& src);
+    safe_VkSwapchainCreateInfoKHR(safe_VkSwapchainCreateInfoKHR&& src) noexcept;
+    safe_VkSwapchainCreateInfoKHR& operator=(safe_VkSwapchainCreateInfoKHR&& src) noexcept;
     safe_VkSwapchainCreateInfoKHR();
     ~safe_VkSwapchainCreateInfoKHR();
     void initialize(const VkSwapchainCreateInfoKHR* in_struct);
@@ -2190,6 +2434,8 @@ struct safe_VkPresentInfoKHR {
     safe_VkPresentInfoKHR(const VkPresentInfoKHR* in_struct);
     safe_VkPresentInfoKHR(const safe_VkPresentInfoKHR& src);
     safe_VkPresentInfoKHR& operator=(const safe_VkPresentInfoKHR& src);
+    safe_VkPresentInfoKHR(safe_VkPresentInfoKHR&& src) noexcept;
+    safe_VkPresentInfoKHR& operator=(safe_VkPresentInfoKHR&& src) noexcept;
     safe_VkPresentInfoKHR();
     ~safe_VkPresentInfoKHR();
     void initialize(const VkPresentInfoKHR* in_struct);
@@ -2205,6 +2451,8 @@ struct safe_VkImageSwapchainCreateInfoKHR {
     safe_VkImageSwapchainCreateInfoKHR(const VkImageSwapchainCreateInfoKHR* in_struct);
     safe_VkImageSwapchainCreateInfoKHR(const safe_VkImageSwapchainCreateInfoKHR& src);
     safe_VkImageSwapchainCreateInfoKHR& operator=(const safe_VkImageSwapchainCreateInfoKHR& src);
+    safe_VkImageSwapchainCreateInfoKHR(safe_VkImageSwapchainCreateInfoKHR&& src) noexcept;
+    safe_VkImageSwapchainCreateInfoKHR& operator=(safe_VkImageSwapchainCreateInfoKHR&& src) noexcept;
     safe_VkImageSwapchainCreateInfoKHR();
     ~safe_VkImageSwapchainCreateInfoKHR();
     void initialize(const VkImageSwapchainCreateInfoKHR* in_struct);
@@ -2221,6 +2469,8 @@ struct safe_VkBindImageMemorySwapchainInfoKHR {
     safe_VkBindImageMemorySwapchainInfoKHR(const VkBindImageMemorySwapchainInfoKHR* in_struct);
     safe_VkBindImageMemorySwapchainInfoKHR(const safe_VkBindImageMemorySwapchainInfoKHR& src);
     safe_VkBindImageMemorySwapchainInfoKHR& operator=(const safe_VkBindImageMemorySwapchainInfoKHR& src);
+    safe_VkBindImageMemorySwapchainInfoKHR(safe_VkBindImageMemorySwapchainInfoKHR&& src) noexcept;
+    safe_VkBindImageMemorySwapchainInfoKHR& operator=(safe_VkBindImageMemorySwapchainInfoKHR&& src) noexcept;
     safe_VkBindImageMemorySwapchainInfoKHR();
     ~safe_VkBindImageMemorySwapchainInfoKHR();
     void initialize(const VkBindImageMemorySwapchainInfoKHR* in_struct);
@@ -2240,6 +2490,8 @@ struct safe_VkAcquireNextImageInfoKHR {
     safe_VkAcquireNextImageInfoKHR(const VkAcquireNextImageInfoKHR* in_struct);
     safe_VkAcquireNextImageInfoKHR(const safe_VkAcquireNextImageInfoKHR& src);
     safe_VkAcquireNextImageInfoKHR& operator=(const safe_VkAcquireNextImageInfoKHR& src);
+    safe_VkAcquireNextImageInfoKHR(safe_VkAcquireNextImageInfoKHR&& src) noexcept;
+    safe_VkAcquireNextImageInfoKHR& operator=(safe_VkAcquireNextImageInfoKHR&& src) noexcept;
     safe_VkAcquireNextImageInfoKHR();
     ~safe_VkAcquireNextImageInfoKHR();
     void initialize(const VkAcquireNextImageInfoKHR* in_struct);
@@ -2256,6 +2508,8 @@ struct safe_VkDeviceGroupPresentCapabilitiesKHR {
     safe_VkDeviceGroupPresentCapabilitiesKHR(const VkDeviceGroupPresentCapabilitiesKHR* in_struct);
     safe_VkDeviceGroupPresentCapabilitiesKHR(const safe_VkDeviceGroupPresentCapabilitiesKHR& src);
     safe_VkDeviceGroupPresentCapabilitiesKHR& operator=(const safe_VkDeviceGroupPresentCapabilitiesKHR& src);
+    safe_VkDeviceGroupPresentCapabilitiesKHR(safe_VkDeviceGroupPresentCapabilitiesKHR&& src) noexcept;
+    safe_VkDeviceGroupPresentCapabilitiesKHR& operator=(safe_VkDeviceGroupPresentCapabilitiesKHR&& src) noexcept;
     safe_VkDeviceGroupPresentCapabilitiesKHR();
     ~safe_VkDeviceGroupPresentCapabilitiesKHR();
     void initialize(const VkDeviceGroupPresentCapabilitiesKHR* in_struct);
@@ -2273,6 +2527,8 @@ struct safe_VkDeviceGroupPresentInfoKHR {
     safe_VkDeviceGroupPresentInfoKHR(const VkDeviceGroupPresentInfoKHR* in_struct);
     safe_VkDeviceGroupPresentInfoKHR(const safe_VkDeviceGroupPresentInfoKHR& src);
     safe_VkDeviceGroupPresentInfoKHR& operator=(const safe_VkDeviceGroupPresentInfoKHR& src);
+    safe_VkDeviceGroupPresentInfoKHR(safe_VkDeviceGroupPresentInfoKHR&& src) noexcept;
+    safe_VkDeviceGroupPresentInfoKHR& operator=(safe_VkDeviceGroupPresentInfoKHR&& src) noexcept;
     safe_VkDeviceGroupPresentInfoKHR();
     ~safe_VkDeviceGroupPresentInfoKHR();
     void initialize(const VkDeviceGroupPresentInfoKHR* in_struct);
@@ -2288,6 +2544,8 @@ struct safe_VkDeviceGroupSwapchainCreateInfoKHR {
     safe_VkDeviceGroupSwapchainCreateInfoKHR(const VkDeviceGroupSwapchainCreateInfoKHR* in_struct);
     safe_VkDeviceGroupSwapchainCreateInfoKHR(const safe_VkDeviceGroupSwapchainCreateInfoKHR& src);
     safe_VkDeviceGroupSwapchainCreateInfoKHR& operator=(const safe_VkDeviceGroupSwapchainCreateInfoKHR& src);
+    safe_VkDeviceGroupSwapchainCreateInfoKHR(safe_VkDeviceGroupSwapchainCreateInfoKHR&& src) noexcept;
+    safe_VkDeviceGroupSwapchainCreateInfoKHR& operator=(safe_VkDeviceGroupSwapchainCreateInfoKHR&& src) noexcept;
     safe_VkDeviceGroupSwapchainCreateInfoKHR();
     ~safe_VkDeviceGroupSwapchainCreateInfoKHR();
     void initialize(const VkDeviceGroupSwapchainCreateInfoKHR* in_struct);
@@ -2307,6 +2565,8 @@ struct safe_VkDisplayPropertiesKHR {
     safe_VkDisplayPropertiesKHR(const VkDisplayPropertiesKHR* in_struct);
     safe_VkDisplayPropertiesKHR(const safe_VkDisplayPropertiesKHR& src);
     safe_VkDisplayPropertiesKHR& operator=(const safe_VkDisplayPropertiesKHR& src);
+    safe_VkDisplayPropertiesKHR(safe_VkDisplayPropertiesKHR&& src) noexcept;
+    safe_VkDisplayPropertiesKHR& operator=(safe_VkDisplayPropertiesKHR&& src) noexcept;
     safe_VkDisplayPropertiesKHR();
     ~safe_VkDisplayPropertiesKHR();
     void initialize(const VkDisplayPropertiesKHR* in_struct);
@@ -2323,6 +2583,8 @@ struct safe_VkDisplayModeCreateInfoKHR {
     safe_VkDisplayModeCreateInfoKHR(const VkDisplayModeCreateInfoKHR* in_struct);
     safe_VkDisplayModeCreateInfoKHR(const safe_VkDisplayModeCreateInfoKHR& src);
     safe_VkDisplayModeCreateInfoKHR& operator=(const safe_VkDisplayModeCreateInfoKHR& src);
+    safe_VkDisplayModeCreateInfoKHR(safe_VkDisplayModeCreateInfoKHR&& src) noexcept;
+    safe_VkDisplayModeCreateInfoKHR& operator=(safe_VkDisplayModeCreateInfoKHR&& src) noexcept;
     safe_VkDisplayModeCreateInfoKHR();
     ~safe_VkDisplayModeCreateInfoKHR();
     void initialize(const VkDisplayModeCreateInfoKHR* in_struct);
@@ -2345,6 +2607,8 @@ struct safe_VkDisplaySurfaceCreateInfoKHR {
     safe_VkDisplaySurfaceCreateInfoKHR(const VkDisplaySurfaceCreateInfoKHR* in_struct);
     safe_VkDisplaySurfaceCreateInfoKHR(const safe_VkDisplaySurfaceCreateInfoKHR& src);
     safe_VkDisplaySurfaceCreateInfoKHR& operator=(const safe_VkDisplaySurfaceCreateInfoKHR& src);
+    safe_VkDisplaySurfaceCreateInfoKHR(safe_VkDisplaySurfaceCreateInfoKHR&& src) noexcept;
+    safe_VkDisplaySurfaceCreateInfoKHR& operator=(safe_VkDisplaySurfaceCreateInfoKHR&& src) noexcept;
     safe_VkDisplaySurfaceCreateInfoKHR();
     ~safe_VkDisplaySurfaceCreateInfoKHR();
     void initialize(const VkDisplaySurfaceCreateInfoKHR* in_struct);
@@ -2362,6 +2626,8 @@ struct safe_VkDisplayPresentInfoKHR {
     safe_VkDisplayPresentInfoKHR(const VkDisplayPresentInfoKHR* in_struct);
     safe_VkDisplayPresentInfoKHR(const safe_VkDisplayPresentInfoKHR& src);
     safe_VkDisplayPresentInfoKHR& operator=(const safe_VkDisplayPresentInfoKHR& src);
+    safe_VkDisplayPresentInfoKHR(safe_VkDisplayPresentInfoKHR&& src) noexcept;
+    safe_VkDisplayPresentInfoKHR& operator=(safe_VkDisplayPresentInfoKHR&& src) noexcept;
     safe_VkDisplayPresentInfoKHR();
     ~safe_VkDisplayPresentInfoKHR();
     void initialize(const VkDisplayPresentInfoKHR* in_struct);
@@ -2380,6 +2646,8 @@ struct safe_VkXlibSurfaceCreateInfoKHR {
     safe_VkXlibSurfaceCreateInfoKHR(const VkXlibSurfaceCreateInfoKHR* in_struct);
     safe_VkXlibSurfaceCreateInfoKHR(const safe_VkXlibSurfaceCreateInfoKHR& src);
     safe_VkXlibSurfaceCreateInfoKHR& operator=(const safe_VkXlibSurfaceCreateInfoKHR& src);
+    safe_VkXlibSurfaceCreateInfoKHR(safe_VkXlibSurfaceCreateInfoKHR&& src) noexcept;
+    safe_VkXlibSurfaceCreateInfoKHR& operator=(safe_VkXlibSurfaceCreateInfoKHR&& src) noexcept;
     safe_VkXlibSurfaceCreateInfoKHR();
     ~safe_VkXlibSurfaceCreateInfoKHR();
     void initialize(const VkXlibSurfaceCreateInfoKHR* in_struct);
@@ -2399,6 +2667,8 @@ struct safe_VkXcbSurfaceCreateInfoKHR {
     safe_VkXcbSurfaceCreateInfoKHR(const VkXcbSurfaceCreateInfoKHR* in_struct);
     safe_VkXcbSurfaceCreateInfoKHR(const safe_VkXcbSurfaceCreateInfoKHR& src);
     safe_VkXcbSurfaceCreateInfoKHR& operator=(const safe_VkXcbSurfaceCreateInfoKHR& src);
+    safe_VkXcbSurfaceCreateInfoKHR(safe_VkXcbSurfaceCreateInfoKHR&& src) noexcept;
+    safe_VkXcbSurfaceCreateInfoKHR& operator=(safe_VkXcbSurfaceCreateInfoKHR&& src) noexcept;
     safe_VkXcbSurfaceCreateInfoKHR();
     ~safe_VkXcbSurfaceCreateInfoKHR();
     void initialize(const VkXcbSurfaceCreateInfoKHR* in_struct);
@@ -2418,6 +2688,8 @@ struct safe_VkWaylandSurfaceCreateInfoKHR {
     safe_VkWaylandSurfaceCreateInfoKHR(const VkWaylandSurfaceCreateInfoKHR* in_struct);
     safe_VkWaylandSurfaceCreateInfoKHR(const safe_VkWaylandSurfaceCreateInfoKHR& src);
     safe_VkWaylandSurfaceCreateInfoKHR& operator=(const safe_VkWaylandSurfaceCreateInfoKHR& src);
+    safe_VkWaylandSurfaceCreateInfoKHR(safe_VkWaylandSurfaceCreateInfoKHR&& src) noexcept;
+    safe_VkWaylandSurfaceCreateInfoKHR& operator=(safe_VkWaylandSurfaceCreateInfoKHR&& src) noexcept;
     safe_VkWaylandSurfaceCreateInfoKHR();
     ~safe_VkWaylandSurfaceCreateInfoKHR();
     void initialize(const VkWaylandSurfaceCreateInfoKHR* in_struct);
@@ -2436,6 +2708,8 @@ struct safe_VkAndroidSurfaceCreateInfoKHR {
     safe_VkAndroidSurfaceCreateInfoKHR(const VkAndroidSurfaceCreateInfoKHR* in_struct);
     safe_VkAndroidSurfaceCreateInfoKHR(const safe_VkAndroidSurfaceCreateInfoKHR& src);
     safe_VkAndroidSurfaceCreateInfoKHR& operator=(const safe_VkAndroidSurfaceCreateInfoKHR& src);
+    safe_VkAndroidSurfaceCreateInfoKHR(safe_VkAndroidSurfaceCreateInfoKHR&& src) noexcept;
+    safe_VkAndroidSurfaceCreateInfoKHR& operator=(safe_VkAndroidSurfaceCreateInfoKHR&& src) noexcept;
     safe_VkAndroidSurfaceCreateInfoKHR();
     ~safe_VkAndroidSurfaceCreateInfoKHR();
     void initialize(const VkAndroidSurfaceCreateInfoKHR* in_struct);
@@ -2455,6 +2729,8 @@ struct safe_VkWin32SurfaceCreateInfoKHR {
     safe_VkWin32SurfaceCreateInfoKHR(const VkWin32SurfaceCreateInfoKHR* in_struct);
     safe_VkWin32SurfaceCreateInfoKHR(const safe_VkWin32SurfaceCreateInfoKHR& src);
     safe_VkWin32SurfaceCreateInfoKHR& operator=(const safe_VkWin32SurfaceCreateInfoKHR& src);
+    safe_VkWin32SurfaceCreateInfoKHR(safe_VkWin32SurfaceCreateInfoKHR&& src) noexcept;
+    safe_VkWin32SurfaceCreateInfoKHR& operator=(safe_VkWin32SurfaceCreateInfoKHR&& src) noexcept;
     safe_VkWin32SurfaceCreateInfoKHR();
     ~safe_VkWin32SurfaceCreateInfoKHR();
     void initialize(const VkWin32SurfaceCreateInfoKHR* in_struct);
@@ -2474,6 +2750,8 @@ struct safe_VkImportMemoryWin32HandleInfoKHR {
     safe_VkImportMemoryWin32HandleInfoKHR(const VkImportMemoryWin32HandleInfoKHR* in_struct);
     safe_VkImportMemoryWin32HandleInfoKHR(const safe_VkImportMemoryWin32HandleInfoKHR& src);
     safe_VkImportMemoryWin32HandleInfoKHR& operator=(const safe_VkImportMemoryWin32HandleInfoKHR& src);
+    safe_VkImportMemoryWin32HandleInfoKHR(safe_VkImportMemoryWin32HandleInfoKHR&& src) noexcept;
+    safe_VkImportMemoryWin32HandleInfoKHR& operator=(safe_VkImportMemoryWin32HandleInfoKHR&& src) noexcept;
     safe_VkImportMemoryWin32HandleInfoKHR();
     ~safe_VkImportMemoryWin32HandleInfoKHR();
     void initialize(const VkImportMemoryWin32HandleInfoKHR* in_struct);
@@ -2493,6 +2771,8 @@ struct safe_VkExportMemoryWin32HandleInfoKHR {
     safe_VkExportMemoryWin32HandleInfoKHR(const VkExportMemoryWin32HandleInfoKHR* in_struct);
     safe_VkExportMemoryWin32HandleInfoKHR(const safe_VkExportMemoryWin32HandleInfoKHR& src);
     safe_VkExportMemoryWin32HandleInfoKHR& operator=(const safe_VkExportMemoryWin32HandleInfoKHR& src);
+    safe_VkExportMemoryWin32HandleInfoKHR(safe_VkExportMemoryWin32HandleInfoKHR&& src) noexcept;
+    safe_VkExportMemoryWin32HandleInfoKHR& operator=(safe_VkExportMemoryWin32HandleInfoKHR&& src) noexcept;
     safe_VkExportMemoryWin32HandleInfoKHR();
     ~safe_VkExportMemoryWin32HandleInfoKHR();
     void initialize(const VkExportMemoryWin32HandleInfoKHR* in_struct);
@@ -2510,6 +2790,8 @@ struct safe_VkMemoryWin32HandlePropertiesKHR {
     safe_VkMemoryWin32HandlePropertiesKHR(const VkMemoryWin32HandlePropertiesKHR* in_struct);
     safe_VkMemoryWin32HandlePropertiesKHR(const safe_VkMemoryWin32HandlePropertiesKHR& src);
     safe_VkMemoryWin32HandlePropertiesKHR& operator=(const safe_VkMemoryWin32HandlePropertiesKHR& src);
+    safe_VkMemoryWin32HandlePropertiesKHR(safe_VkMemoryWin32HandlePropertiesKHR&& src) noexcept;
+    safe_VkMemoryWin32HandlePropertiesKHR& operator=(safe_VkMemoryWin32HandlePropertiesKHR&& src) noexcept;
     safe_VkMemoryWin32HandlePropertiesKHR();
     ~safe_VkMemoryWin32HandlePropertiesKHR();
     void initialize(const VkMemoryWin32HandlePropertiesKHR* in_struct);
@@ -2528,6 +2810,8 @@ struct safe_VkMemoryGetWin32HandleInfoKHR {
     safe_VkMemoryGetWin32HandleInfoKHR(const VkMemoryGetWin32HandleInfoKHR* in_struct);
     safe_VkMemoryGetWin32HandleInfoKHR(const safe_VkMemoryGetWin32HandleInfoKHR& src);
     safe_VkMemoryGetWin32HandleInfoKHR& operator=(const safe_VkMemoryGetWin32HandleInfoKHR& src);
+    safe_VkMemoryGetWin32HandleInfoKHR(safe_VkMemoryGetWin32HandleInfoKHR&& src) noexcept;
+    safe_VkMemoryGetWin32HandleInfoKHR& operator=(safe_VkMemoryGetWin32HandleInfoKHR&& src) noexcept;
     safe_VkMemoryGetWin32HandleInfoKHR();
     ~safe_VkMemoryGetWin32HandleInfoKHR();
     void initialize(const VkMemoryGetWin32HandleInfoKHR* in_struct);
@@ -2545,6 +2829,8 @@ struct safe_VkImportMemoryFdInfoKHR {
     safe_VkImportMemoryFdInfoKHR(const VkImportMemoryFdInfoKHR* in_struct);
     safe_VkImportMemoryFdInfoKHR(const safe_VkImportMemoryFdInfoKHR& src);
     safe_VkImportMemoryFdInfoKHR& operator=(const safe_VkImportMemoryFdInfoKHR& src);
+    safe_VkImportMemoryFdInfoKHR(safe_VkImportMemoryFdInfoKHR&& src) noexcept;
+    safe_VkImportMemoryFdInfoKHR& operator=(safe_VkImportMemoryFdInfoKHR&& src) noexcept;
     safe_VkImportMemoryFdInfoKHR();
     ~safe_VkImportMemoryFdInfoKHR();
     void initialize(const VkImportMemoryFdInfoKHR* in_struct);
@@ -2560,6 +2846,8 @@ struct safe_VkMemoryFdPropertiesKHR {
     safe_VkMemoryFdPropertiesKHR(const VkMemoryFdPropertiesKHR* in_struct);
     safe_VkMemoryFdPropertiesKHR(const safe_VkMemoryFdPropertiesKHR& src);
     safe_VkMemoryFdPropertiesKHR& operator=(const safe_VkMemoryFdPropertiesKHR& src);
+    safe_VkMemoryFdPropertiesKHR(safe_VkMemoryFdPropertiesKHR&& src) noexcept;
+    safe_VkMemoryFdPropertiesKHR& operator=(safe_VkMemoryFdPropertiesKHR&& src) noexcept;
     safe_VkMemoryFdPropertiesKHR();
     ~safe_VkMemoryFdPropertiesKHR();
     void initialize(const VkMemoryFdPropertiesKHR* in_struct);
@@ -2576,6 +2864,8 @@ struct safe_VkMemoryGetFdInfoKHR {
     safe_VkMemoryGetFdInfoKHR(const VkMemoryGetFdInfoKHR* in_struct);
     safe_VkMemoryGetFdInfoKHR(const safe_VkMemoryGetFdInfoKHR& src);
     safe_VkMemoryGetFdInfoKHR& operator=(const safe_VkMemoryGetFdInfoKHR& src);
+    safe_VkMemoryGetFdInfoKHR(safe_VkMemoryGetFdInfoKHR&& src) noexcept;
+    safe_VkMemoryGetFdInfoKHR& operator=(safe_VkMemoryGetFdInfoKHR&& src) noexcept;
     safe_VkMemoryGetFdInfoKHR();
     ~safe_VkMemoryGetFdInfoKHR();
     void initialize(const VkMemoryGetFdInfoKHR* in_struct);
@@ -2598,6 +2888,8 @@ struct safe_VkWin32KeyedMutexAcquireReleaseInfoKHR {
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(const VkWin32KeyedMutexAcquireReleaseInfoKHR* in_struct);
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(const safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& src);
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& operator=(const safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& src);
+    safe_VkWin32KeyedMutexAcquireReleaseInfoKHR(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& src) noexcept;
+    safe_VkWin32KeyedMutexAcquireReleaseInfoKHR& operator=(safe_VkWin32KeyedMutexAcquireReleaseInfoKHR&& src) noexcept;
     safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
     ~safe_VkWin32KeyedMutexAcquireReleaseInfoKHR();
     void initialize(const VkWin32KeyedMutexAcquireReleaseInfoKHR* in_struct);
@@ -2619,6 +2911,8 @@ struct safe_VkImportSemaphoreWin32HandleInfoKHR {
     safe_VkImportSemaphoreWin32HandleInfoKHR(const VkImportSemaphoreWin32HandleInfoKHR* in_struct);
     safe_VkImportSemaphoreWin32HandleInfoKHR(const safe_VkImportSemaphoreWin32HandleInfoKHR& src);
     safe_VkImportSemaphoreWin32HandleInfoKHR& operator=(const safe_VkImportSemaphoreWin32HandleInfoKHR& src);
+    safe_VkImportSemaphoreWin32HandleInfoKHR(safe_VkImportSemaphoreWin32HandleInfoKHR&& src) noexcept;
+    safe_VkImportSemaphoreWin32HandleInfoKHR& operator=(safe_VkImportSemaphoreWin32HandleInfoKHR&& src) noexcept;
     safe_VkImportSemaphoreWin32HandleInfoKHR();
     ~safe_VkImportSemaphoreWin32HandleInfoKHR();
     void initialize(const VkImportSemaphoreWin32HandleInfoKHR* in_struct);
@@ -2638,6 +2932,8 @@ struct safe_VkExportSemaphoreWin32HandleInfoKHR {
     safe_VkExportSemaphoreWin32HandleInfoKHR(const VkExportSemaphoreWin32HandleInfoKHR* in_struct);
     safe_VkExportSemaphoreWin32HandleInfoKHR(const safe_VkExportSemaphoreWin32HandleInfoKHR& src);
     safe_VkExportSemaphoreWin32HandleInfoKHR& operator=(const safe_VkExportSemaphoreWin32HandleInfoKHR& src);
+    safe_VkExportSemaphoreWin32HandleInfoKHR(safe_VkExportSemaphoreWin32HandleInfoKHR&& src) noexcept;
+    safe_VkExportSemaphoreWin32HandleInfoKHR& operator=(safe_VkExportSemaphoreWin32HandleInfoKHR&& src) noexcept;
     safe_VkExportSemaphoreWin32HandleInfoKHR();
     ~safe_VkExportSemaphoreWin32HandleInfoKHR();
     void initialize(const VkExportSemaphoreWin32HandleInfoKHR* in_struct);
@@ -2658,6 +2954,8 @@ struct safe_VkD3D12FenceSubmitInfoKHR {
     safe_VkD3D12FenceSubmitInfoKHR(const VkD3D12FenceSubmitInfoKHR* in_struct);
     safe_VkD3D12FenceSubmitInfoKHR(const safe_VkD3D12FenceSubmitInfoKHR& src);
     safe_VkD3D12FenceSubmitInfoKHR& operator=(const safe_VkD3D12FenceSubmitInfoKHR& src);
+    safe_VkD3D12FenceSubmitInfoKHR(safe_VkD3D12FenceSubmitInfoKHR&& src) noexcept;
+    safe_VkD3D12FenceSubmitInfoKHR& operator=(safe_VkD3D12FenceSubmitInfoKHR&& src) noexcept;
     safe_VkD3D12FenceSubmitInfoKHR();
     ~safe_VkD3D12FenceSubmitInfoKHR();
     void initialize(const VkD3D12FenceSubmitInfoKHR* in_struct);
@@ -2676,6 +2974,8 @@ struct safe_VkSemaphoreGetWin32HandleInfoKHR {
     safe_VkSemaphoreGetWin32HandleInfoKHR(const VkSemaphoreGetWin32HandleInfoKHR* in_struct);
     safe_VkSemaphoreGetWin32HandleInfoKHR(const safe_VkSemaphoreGetWin32HandleInfoKHR& src);
     safe_VkSemaphoreGetWin32HandleInfoKHR& operator=(const safe_VkSemaphoreGetWin32HandleInfoKHR& src);
+    safe_VkSemaphoreGetWin32HandleInfoKHR(safe_VkSemaphoreGetWin32HandleInfoKHR&& src) noexcept;
+    safe_VkSemaphoreGetWin32HandleInfoKHR& operator=(safe_VkSemaphoreGetWin32HandleInfoKHR&& src) noexcept;
     safe_VkSemaphoreGetWin32HandleInfoKHR();
     ~safe_VkSemaphoreGetWin32HandleInfoKHR();
     void initialize(const VkSemaphoreGetWin32HandleInfoKHR* in_struct);
@@ -2695,6 +2995,8 @@ struct safe_VkImportSemaphoreFdInfoKHR {
     safe_VkImportSemaphoreFdInfoKHR(const VkImportSemaphoreFdInfoKHR* in_struct);
     safe_VkImportSemaphoreFdInfoKHR(const safe_VkImportSemaphoreFdInfoKHR& src);
     safe_VkImportSemaphoreFdInfoKHR& operator=(const safe_VkImportSemaphoreFdInfoKHR& src);
+    safe_VkImportSemaphoreFdInfoKHR(safe_VkImportSemaphoreFdInfoKHR&& src) noexcept;
+    safe_VkImportSemaphoreFdInfoKHR& operator=(safe_VkImportSemaphoreFdInfoKHR&& src) noexcept;
     safe_VkImportSemaphoreFdInfoKHR();
     ~safe_VkImportSemaphoreFdInfoKHR();
     void initialize(const VkImportSemaphoreFdInfoKHR* in_struct);
@@ -2711,6 +3013,8 @@ struct safe_VkSemaphoreGetFdInfoKHR {
     safe_VkSemaphoreGetFdInfoKHR(const VkSemaphoreGetFdInfoKHR* in_struct);
     safe_VkSemaphoreGetFdInfoKHR(const safe_VkSemaphoreGetFdInfoKHR& src);
     safe_VkSemaphoreGetFdInfoKHR& operator=(const safe_VkSemaphoreGetFdInfoKHR& src);
+    safe_VkSemaphoreGetFdInfoKHR(safe_VkSemaphoreGetFdInfoKHR&& src) noexcept;
+    safe_VkSemaphoreGetFdInfoKHR& operator=(safe_VkSemaphoreGetFdInfoKHR&& src) noexcept;
     safe_VkSemaphoreGetFdInfoKHR();
     ~safe_VkSemaphoreGetFdInfoKHR();
     void initialize(const VkSemaphoreGetFdInfoKHR* in_struct);
@@ -2726,6 +3030,8 @@ struct safe_VkPhysicalDevicePushDescriptorPropertiesKHR {
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR(const VkPhysicalDevicePushDescriptorPropertiesKHR* in_struct);
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR(const safe_VkPhysicalDevicePushDescriptorPropertiesKHR& src);
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR& operator=(const safe_VkPhysicalDevicePushDescriptorPropertiesKHR& src);
+    safe_VkPhysicalDevicePushDescriptorPropertiesKHR(safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& src) noexcept;
+    safe_VkPhysicalDevicePushDescriptorPropertiesKHR& operator=(safe_VkPhysicalDevicePushDescriptorPropertiesKHR&& src) noexcept;
     safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
     ~safe_VkPhysicalDevicePushDescriptorPropertiesKHR();
     void initialize(const VkPhysicalDevicePushDescriptorPropertiesKHR* in_struct);
@@ -2742,6 +3048,8 @@ struct safe_VkPhysicalDeviceFloat16Int8FeaturesKHR {
     safe_VkPhysicalDeviceFloat16Int8FeaturesKHR(const VkPhysicalDeviceFloat16Int8FeaturesKHR* in_struct);
     safe_VkPhysicalDeviceFloat16Int8FeaturesKHR(const safe_VkPhysicalDeviceFloat16Int8FeaturesKHR& src);
     safe_VkPhysicalDeviceFloat16Int8FeaturesKHR& operator=(const safe_VkPhysicalDeviceFloat16Int8FeaturesKHR& src);
+    safe_VkPhysicalDeviceFloat16Int8FeaturesKHR(safe_VkPhysicalDeviceFloat16Int8FeaturesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceFloat16Int8FeaturesKHR& operator=(safe_VkPhysicalDeviceFloat16Int8FeaturesKHR&& src) noexcept;
     safe_VkPhysicalDeviceFloat16Int8FeaturesKHR();
     ~safe_VkPhysicalDeviceFloat16Int8FeaturesKHR();
     void initialize(const VkPhysicalDeviceFloat16Int8FeaturesKHR* in_struct);
@@ -2756,6 +3064,8 @@ struct safe_VkPresentRegionKHR {
     safe_VkPresentRegionKHR(const VkPresentRegionKHR* in_struct);
     safe_VkPresentRegionKHR(const safe_VkPresentRegionKHR& src);
     safe_VkPresentRegionKHR& operator=(const safe_VkPresentRegionKHR& src);
+    safe_VkPresentRegionKHR(safe_VkPresentRegionKHR&& src) noexcept;
+    safe_VkPresentRegionKHR& operator=(safe_VkPresentRegionKHR&& src) noexcept;
     safe_VkPresentRegionKHR();
     ~safe_VkPresentRegionKHR();
     void initialize(const VkPresentRegionKHR* in_struct);
@@ -2772,6 +3082,8 @@ struct safe_VkPresentRegionsKHR {
     safe_VkPresentRegionsKHR(const VkPresentRegionsKHR* in_struct);
     safe_VkPresentRegionsKHR(const safe_VkPresentRegionsKHR& src);
     safe_VkPresentRegionsKHR& operator=(const safe_VkPresentRegionsKHR& src);
+    safe_VkPresentRegionsKHR(safe_VkPresentRegionsKHR&& src) noexcept;
+    safe_VkPresentRegionsKHR& operator=(safe_VkPresentRegionsKHR&& src) noexcept;
     safe_VkPresentRegionsKHR();
     ~safe_VkPresentRegionsKHR();
     void initialize(const VkPresentRegionsKHR* in_struct);
@@ -2787,6 +3099,8 @@ struct safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR {
     safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR(const VkPhysicalDeviceImagelessFramebufferFeaturesKHR* in_struct);
     safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR(const safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR& src);
     safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR& operator=(const safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR& src);
+    safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR(safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR& operator=(safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR&& src) noexcept;
     safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR();
     ~safe_VkPhysicalDeviceImagelessFramebufferFeaturesKHR();
     void initialize(const VkPhysicalDeviceImagelessFramebufferFeaturesKHR* in_struct);
@@ -2808,6 +3122,8 @@ struct safe_VkFramebufferAttachmentImageInfoKHR {
     safe_VkFramebufferAttachmentImageInfoKHR(const VkFramebufferAttachmentImageInfoKHR* in_struct);
     safe_VkFramebufferAttachmentImageInfoKHR(const safe_VkFramebufferAttachmentImageInfoKHR& src);
     safe_VkFramebufferAttachmentImageInfoKHR& operator=(const safe_VkFramebufferAttachmentImageInfoKHR& src);
+    safe_VkFramebufferAttachmentImageInfoKHR(safe_VkFramebufferAttachmentImageInfoKHR&& src) noexcept;
+    safe_VkFramebufferAttachmentImageInfoKHR& operator=(safe_VkFramebufferAttachmentImageInfoKHR&& src) noexcept;
     safe_VkFramebufferAttachmentImageInfoKHR();
     ~safe_VkFramebufferAttachmentImageInfoKHR();
     void initialize(const VkFramebufferAttachmentImageInfoKHR* in_struct);
@@ -2824,6 +3140,8 @@ struct safe_VkFramebufferAttachmentsCreateInfoKHR {
     safe_VkFramebufferAttachmentsCreateInfoKHR(const VkFramebufferAttachmentsCreateInfoKHR* in_struct);
     safe_VkFramebufferAttachmentsCreateInfoKHR(const safe_VkFramebufferAttachmentsCreateInfoKHR& src);
     safe_VkFramebufferAttachmentsCreateInfoKHR& operator=(const safe_VkFramebufferAttachmentsCreateInfoKHR& src);
+    safe_VkFramebufferAttachmentsCreateInfoKHR(safe_VkFramebufferAttachmentsCreateInfoKHR&& src) noexcept;
+    safe_VkFramebufferAttachmentsCreateInfoKHR& operator=(safe_VkFramebufferAttachmentsCreateInfoKHR&& src) noexcept;
     safe_VkFramebufferAttachmentsCreateInfoKHR();
     ~safe_VkFramebufferAttachmentsCreateInfoKHR();
     void initialize(const VkFramebufferAttachmentsCreateInfoKHR* in_struct);
@@ -2840,6 +3158,8 @@ struct safe_VkRenderPassAttachmentBeginInfoKHR {
     safe_VkRenderPassAttachmentBeginInfoKHR(const VkRenderPassAttachmentBeginInfoKHR* in_struct);
     safe_VkRenderPassAttachmentBeginInfoKHR(const safe_VkRenderPassAttachmentBeginInfoKHR& src);
     safe_VkRenderPassAttachmentBeginInfoKHR& operator=(const safe_VkRenderPassAttachmentBeginInfoKHR& src);
+    safe_VkRenderPassAttachmentBeginInfoKHR(safe_VkRenderPassAttachmentBeginInfoKHR&& src) noexcept;
+    safe_VkRenderPassAttachmentBeginInfoKHR& operator=(safe_VkRenderPassAttachmentBeginInfoKHR&& src) noexcept;
     safe_VkRenderPassAttachmentBeginInfoKHR();
     ~safe_VkRenderPassAttachmentBeginInfoKHR();
     void initialize(const VkRenderPassAttachmentBeginInfoKHR* in_struct);
@@ -2863,6 +3183,8 @@ struct safe_VkAttachmentDescription2KHR {
     safe_VkAttachmentDescription2KHR(const VkAttachmentDescription2KHR* in_struct);
     safe_VkAttachmentDescription2KHR(const safe_VkAttachmentDescription2KHR& src);
     safe_VkAttachmentDescription2KHR& operator=(const safe_VkAttachmentDescription2KHR& src);
+    safe_VkAttachmentDescription2KHR(safe_VkAttachmentDescription2KHR&& src) noexcept;
+    safe_VkAttachmentDescription2KHR& operator=(safe_VkAttachmentDescription2KHR&& src) noexcept;
     safe_VkAttachmentDescription2KHR();
     ~safe_VkAttachmentDescription2KHR();
     void initialize(const VkAttachmentDescription2KHR* in_struct);
@@ -2880,6 +3202,8 @@ struct safe_VkAttachmentReference2KHR {
     safe_VkAttachmentReference2KHR(const VkAttachmentReference2KHR* in_struct);
     safe_VkAttachmentReference2KHR(const safe_VkAttachmentReference2KHR& src);
     safe_VkAttachmentReference2KHR& operator=(const safe_VkAttachmentReference2KHR& src);
+    safe_VkAttachmentReference2KHR(safe_VkAttachmentReference2KHR&& src) noexcept;
+    safe_VkAttachmentReference2KHR& operator=(safe_VkAttachmentReference2KHR&& src) noexcept;
     safe_VkAttachmentReference2KHR();
     ~safe_VkAttachmentReference2KHR();
     void initialize(const VkAttachmentReference2KHR* in_struct);
@@ -2905,6 +3229,8 @@ struct safe_VkSubpassDescription2KHR {
     safe_VkSubpassDescription2KHR(const VkSubpassDescription2KHR* in_struct);
     safe_VkSubpassDescription2KHR(const safe_VkSubpassDescription2KHR& src);
     safe_VkSubpassDescription2KHR& operator=(const safe_VkSubpassDescription2KHR& src);
+    safe_VkSubpassDescription2KHR(safe_VkSubpassDescription2KHR&& src) noexcept;
+    safe_VkSubpassDescription2KHR& operator=(safe_VkSubpassDescription2KHR&& src) noexcept;
     safe_VkSubpassDescription2KHR();
     ~safe_VkSubpassDescription2KHR();
     void initialize(const VkSubpassDescription2KHR* in_struct);
@@ -2927,6 +3253,8 @@ struct safe_VkSubpassDependency2KHR {
     safe_VkSubpassDependency2KHR(const VkSubpassDependency2KHR* in_struct);
     safe_VkSubpassDependency2KHR(const safe_VkSubpassDependency2KHR& src);
     safe_VkSubpassDependency2KHR& operator=(const safe_VkSubpassDependency2KHR& src);
+    safe_VkSubpassDependency2KHR(safe_VkSubpassDependency2KHR&& src) noexcept;
+    safe_VkSubpassDependency2KHR& operator=(safe_VkSubpassDependency2KHR&& src) noexcept;
     safe_VkSubpassDependency2KHR();
     ~safe_VkSubpassDependency2KHR();
     void initialize(const VkSubpassDependency2KHR* in_struct);
@@ -2950,6 +3278,8 @@ struct safe_VkRenderPassCreateInfo2KHR {
     safe_VkRenderPassCreateInfo2KHR(const VkRenderPassCreateInfo2KHR* in_struct);
     safe_VkRenderPassCreateInfo2KHR(const safe_VkRenderPassCreateInfo2KHR& src);
     safe_VkRenderPassCreateInfo2KHR& operator=(const safe_VkRenderPassCreateInfo2KHR& src);
+    safe_VkRenderPassCreateInfo2KHR(safe_VkRenderPassCreateInfo2KHR&& src) noexcept;
+    safe_VkRenderPassCreateInfo2KHR& operator=(safe_VkRenderPassCreateInfo2KHR&& src) noexcept;
     safe_VkRenderPassCreateInfo2KHR();
     ~safe_VkRenderPassCreateInfo2KHR();
     void initialize(const VkRenderPassCreateInfo2KHR* in_struct);
@@ -2965,6 +3295,8 @@ struct safe_VkSubpassBeginInfoKHR {
     safe_VkSubpassBeginInfoKHR(const VkSubpassBeginInfoKHR* in_struct);
     safe_VkSubpassBeginInfoKHR(const safe_VkSubpassBeginInfoKHR& src);
     safe_VkSubpassBeginInfoKHR& operator=(const safe_VkSubpassBeginInfoKHR& src);
+    safe_VkSubpassBeginInfoKHR(safe_VkSubpassBeginInfoKHR&& src) noexcept;
+    safe_VkSubpassBeginInfoKHR& operator=(safe_VkSubpassBeginInfoKHR&& src) noexcept;
     safe_VkSubpassBeginInfoKHR();
     ~safe_VkSubpassBeginInfoKHR();
     void initialize(const VkSubpassBeginInfoKHR* in_struct);
@@ -2979,6 +3311,8 @@ struct safe_VkSubpassEndInfoKHR {
     safe_VkSubpassEndInfoKHR(const VkSubpassEndInfoKHR* in_struct);
     safe_VkSubpassEndInfoKHR(const safe_VkSubpassEndInfoKHR& src);
     safe_VkSubpassEndInfoKHR& operator=(const safe_VkSubpassEndInfoKHR& src);
+    safe_VkSubpassEndInfoKHR(safe_VkSubpassEndInfoKHR&& src) noexcept;
+    safe_VkSubpassEndInfoKHR& operator=(safe_VkSubpassEndInfoKHR&& src) noexcept;
     safe_VkSubpassEndInfoKHR();
     ~safe_VkSubpassEndInfoKHR();
     void initialize(const VkSubpassEndInfoKHR* in_struct);
@@ -2994,6 +3328,8 @@ struct safe_VkSharedPresentSurfaceCapabilitiesKHR {
     safe_VkSharedPresentSurfaceCapabilitiesKHR(const VkSharedPresentSurfaceCapabilitiesKHR* in_struct);
     safe_VkSharedPresentSurfaceCapabilitiesKHR(const safe_VkSharedPresentSurfaceCapabilitiesKHR& src);
     safe_VkSharedPresentSurfaceCapabilitiesKHR& operator=(const safe_VkSharedPresentSurfaceCapabilitiesKHR& src);
+    safe_VkSharedPresentSurfaceCapabilitiesKHR(safe_VkSharedPresentSurfaceCapabilitiesKHR&& src) noexcept;
+    safe_VkSharedPresentSurfaceCapabilitiesKHR& operator=(safe_VkSharedPresentSurfaceCapabilitiesKHR&& src) noexcept;
     safe_VkSharedPresentSurfaceCapabilitiesKHR();
     ~safe_VkSharedPresentSurfaceCapabilitiesKHR();
     void initialize(const VkSharedPresentSurfaceCapabilitiesKHR* in_struct);
@@ -3014,6 +3350,8 @@ struct safe_VkImportFenceWin32HandleInfoKHR {
     safe_VkImportFenceWin32HandleInfoKHR(const VkImportFenceWin32HandleInfoKHR* in_struct);
     safe_VkImportFenceWin32HandleInfoKHR(const safe_VkImportFenceWin32HandleInfoKHR& src);
     safe_VkImportFenceWin32HandleInfoKHR& operator=(const safe_VkImportFenceWin32HandleInfoKHR& src);
+    safe_VkImportFenceWin32HandleInfoKHR(safe_VkImportFenceWin32HandleInfoKHR&& src) noexcept;
+    safe_VkImportFenceWin32HandleInfoKHR& operator=(safe_VkImportFenceWin32HandleInfoKHR&& src) noexcept;
     safe_VkImportFenceWin32HandleInfoKHR();
     ~safe_VkImportFenceWin32HandleInfoKHR();
     void initialize(const VkImportFenceWin32HandleInfoKHR* in_struct);
@@ -3033,6 +3371,8 @@ struct safe_VkExportFenceWin32HandleInfoKHR {
     safe_VkExportFenceWin32HandleInfoKHR(const VkExportFenceWin32HandleInfoKHR* in_struct);
     safe_VkExportFenceWin32HandleInfoKHR(const safe_VkExportFenceWin32HandleInfoKHR& src);
     safe_VkExportFenceWin32HandleInfoKHR& operator=(const safe_VkExportFenceWin32HandleInfoKHR& src);
+    safe_VkExportFenceWin32HandleInfoKHR(safe_VkExportFenceWin32HandleInfoKHR&& src) noexcept;
+    safe_VkExportFenceWin32HandleInfoKHR& operator=(safe_VkExportFenceWin32HandleInfoKHR&& src) noexcept;
     safe_VkExportFenceWin32HandleInfoKHR();
     ~safe_VkExportFenceWin32HandleInfoKHR();
     void initialize(const VkExportFenceWin32HandleInfoKHR* in_struct);
@@ -3051,6 +3391,8 @@ struct safe_VkFenceGetWin32HandleInfoKHR {
     safe_VkFenceGetWin32HandleInfoKHR(const VkFenceGetWin32HandleInfoKHR* in_struct);
     safe_VkFenceGetWin32HandleInfoKHR(const safe_VkFenceGetWin32HandleInfoKHR& src);
     safe_VkFenceGetWin32HandleInfoKHR& operator=(const safe_VkFenceGetWin32HandleInfoKHR& src);
+    safe_VkFenceGetWin32HandleInfoKHR(safe_VkFenceGetWin32HandleInfoKHR&& src) noexcept;
+    safe_VkFenceGetWin32HandleInfoKHR& operator=(safe_VkFenceGetWin32HandleInfoKHR&& src) noexcept;
     safe_VkFenceGetWin32HandleInfoKHR();
     ~safe_VkFenceGetWin32HandleInfoKHR();
     void initialize(const VkFenceGetWin32HandleInfoKHR* in_struct);
@@ -3070,6 +3412,8 @@ struct safe_VkImportFenceFdInfoKHR {
     safe_VkImportFenceFdInfoKHR(const VkImportFenceFdInfoKHR* in_struct);
     safe_VkImportFenceFdInfoKHR(const safe_VkImportFenceFdInfoKHR& src);
     safe_VkImportFenceFdInfoKHR& operator=(const safe_VkImportFenceFdInfoKHR& src);
+    safe_VkImportFenceFdInfoKHR(safe_VkImportFenceFdInfoKHR&& src) noexcept;
+    safe_VkImportFenceFdInfoKHR& operator=(safe_VkImportFenceFdInfoKHR&& src) noexcept;
     safe_VkImportFenceFdInfoKHR();
     ~safe_VkImportFenceFdInfoKHR();
     void initialize(const VkImportFenceFdInfoKHR* in_struct);
@@ -3086,6 +3430,8 @@ struct safe_VkFenceGetFdInfoKHR {
     safe_VkFenceGetFdInfoKHR(const VkFenceGetFdInfoKHR* in_struct);
     safe_VkFenceGetFdInfoKHR(const safe_VkFenceGetFdInfoKHR& src);
     safe_VkFenceGetFdInfoKHR& operator=(const safe_VkFenceGetFdInfoKHR& src);
+    safe_VkFenceGetFdInfoKHR(safe_VkFenceGetFdInfoKHR&& src) noexcept;
+    safe_VkFenceGetFdInfoKHR& operator=(safe_VkFenceGetFdInfoKHR&& src) noexcept;
     safe_VkFenceGetFdInfoKHR();
     ~safe_VkFenceGetFdInfoKHR();
     void initialize(const VkFenceGetFdInfoKHR* in_struct);
@@ -3101,6 +3447,8 @@ struct safe_VkPhysicalDeviceSurfaceInfo2KHR {
     safe_VkPhysicalDeviceSurfaceInfo2KHR(const VkPhysicalDeviceSurfaceInfo2KHR* in_struct);
     safe_VkPhysicalDeviceSurfaceInfo2KHR(const safe_VkPhysicalDeviceSurfaceInfo2KHR& src);
     safe_VkPhysicalDeviceSurfaceInfo2KHR& operator=(const safe_VkPhysicalDeviceSurfaceInfo2KHR& src);
+    safe_VkPhysicalDeviceSurfaceInfo2KHR(safe_VkPhysicalDeviceSurfaceInfo2KHR&& src) noexcept;
+    safe_VkPhysicalDeviceSurfaceInfo2KHR& operator=(safe_VkPhysicalDeviceSurfaceInfo2KHR&& src) noexcept;
     safe_VkPhysicalDeviceSurfaceInfo2KHR();
     ~safe_VkPhysicalDeviceSurfaceInfo2KHR();
     void initialize(const VkPhysicalDeviceSurfaceInfo2KHR* in_struct);
@@ -3116,6 +3464,8 @@ struct safe_VkSurfaceCapabilities2KHR {
     safe_VkSurfaceCapabilities2KHR(const VkSurfaceCapabilities2KHR* in_struct);
     safe_VkSurfaceCapabilities2KHR(const safe_VkSurfaceCapabilities2KHR& src);
     safe_VkSurfaceCapabilities2KHR& operator=(const safe_VkSurfaceCapabilities2KHR& src);
+    safe_VkSurfaceCapabilities2KHR(safe_VkSurfaceCapabilities2KHR&& src) noexcept;
+    safe_VkSurfaceCapabilities2KHR& operator=(safe_VkSurfaceCapabilities2KHR&& src) noexcept;
     safe_VkSurfaceCapabilities2KHR();
     ~safe_VkSurfaceCapabilities2KHR();
     void initialize(const VkSurfaceCapabilities2KHR* in_struct);
@@ -3131,6 +3481,8 @@ struct safe_VkSurfaceFormat2KHR {
     safe_VkSurfaceFormat2KHR(const VkSurfaceFormat2KHR* in_struct);
     safe_VkSurfaceFormat2KHR(const safe_VkSurfaceFormat2KHR& src);
     safe_VkSurfaceFormat2KHR& operator=(const safe_VkSurfaceFormat2KHR& src);
+    safe_VkSurfaceFormat2KHR(safe_VkSurfaceFormat2KHR&& src) noexcept;
+    safe_VkSurfaceFormat2KHR& operator=(safe_VkSurfaceFormat2KHR&& src) noexcept;
     safe_VkSurfaceFormat2KHR();
     ~safe_VkSurfaceFormat2KHR();
     void initialize(const VkSurfaceFormat2KHR* in_struct);
@@ -3146,6 +3498,8 @@ struct safe_VkDisplayProperties2KHR {
     safe_VkDisplayProperties2KHR(const VkDisplayProperties2KHR* in_struct);
     safe_VkDisplayProperties2KHR(const safe_VkDisplayProperties2KHR& src);
     safe_VkDisplayProperties2KHR& operator=(const safe_VkDisplayProperties2KHR& src);
+    safe_VkDisplayProperties2KHR(safe_VkDisplayProperties2KHR&& src) noexcept;
+    safe_VkDisplayProperties2KHR& operator=(safe_VkDisplayProperties2KHR&& src) noexcept;
     safe_VkDisplayProperties2KHR();
     ~safe_VkDisplayProperties2KHR();
     void initialize(const VkDisplayProperties2KHR* in_struct);
@@ -3161,6 +3515,8 @@ struct safe_VkDisplayPlaneProperties2KHR {
     safe_VkDisplayPlaneProperties2KHR(const VkDisplayPlaneProperties2KHR* in_struct);
     safe_VkDisplayPlaneProperties2KHR(const safe_VkDisplayPlaneProperties2KHR& src);
     safe_VkDisplayPlaneProperties2KHR& operator=(const safe_VkDisplayPlaneProperties2KHR& src);
+    safe_VkDisplayPlaneProperties2KHR(safe_VkDisplayPlaneProperties2KHR&& src) noexcept;
+    safe_VkDisplayPlaneProperties2KHR& operator=(safe_VkDisplayPlaneProperties2KHR&& src) noexcept;
     safe_VkDisplayPlaneProperties2KHR();
     ~safe_VkDisplayPlaneProperties2KHR();
     void initialize(const VkDisplayPlaneProperties2KHR* in_struct);
@@ -3176,6 +3532,8 @@ struct safe_VkDisplayModeProperties2KHR {
     safe_VkDisplayModeProperties2KHR(const VkDisplayModeProperties2KHR* in_struct);
     safe_VkDisplayModeProperties2KHR(const safe_VkDisplayModeProperties2KHR& src);
     safe_VkDisplayModeProperties2KHR& operator=(const safe_VkDisplayModeProperties2KHR& src);
+    safe_VkDisplayModeProperties2KHR(safe_VkDisplayModeProperties2KHR&& src) noexcept;
+    safe_VkDisplayModeProperties2KHR& operator=(safe_VkDisplayModeProperties2KHR&& src) noexcept;
     safe_VkDisplayModeProperties2KHR();
     ~safe_VkDisplayModeProperties2KHR();
     void initialize(const VkDisplayModeProperties2KHR* in_struct);
@@ -3192,6 +3550,8 @@ struct safe_VkDisplayPlaneInfo2KHR {
     safe_VkDisplayPlaneInfo2KHR(const VkDisplayPlaneInfo2KHR* in_struct);
     safe_VkDisplayPlaneInfo2KHR(const safe_VkDisplayPlaneInfo2KHR& src);
     safe_VkDisplayPlaneInfo2KHR& operator=(const safe_VkDisplayPlaneInfo2KHR& src);
+    safe_VkDisplayPlaneInfo2KHR(safe_VkDisplayPlaneInfo2KHR&& src) noexcept;
+    safe_VkDisplayPlaneInfo2KHR& operator=(safe_VkDisplayPlaneInfo2KHR&& src) noexcept;
     safe_VkDisplayPlaneInfo2KHR();
     ~safe_VkDisplayPlaneInfo2KHR();
     void initialize(const VkDisplayPlaneInfo2KHR* in_struct);
@@ -3207,6 +3567,8 @@ struct safe_VkDisplayPlaneCapabilities2KHR {
     safe_VkDisplayPlaneCapabilities2KHR(const VkDisplayPlaneCapabilities2KHR* in_struct);
     safe_VkDisplayPlaneCapabilities2KHR(const safe_VkDisplayPlaneCapabilities2KHR& src);
     safe_VkDisplayPlaneCapabilities2KHR& operator=(const safe_VkDisplayPlaneCapabilities2KHR& src);
+    safe_VkDisplayPlaneCapabilities2KHR(safe_VkDisplayPlaneCapabilities2KHR&& src) noexcept;
+    safe_VkDisplayPlaneCapabilities2KHR& operator=(safe_VkDisplayPlaneCapabilities2KHR&& src) noexcept;
     safe_VkDisplayPlaneCapabilities2KHR();
     ~safe_VkDisplayPlaneCapabilities2KHR();
     void initialize(const VkDisplayPlaneCapabilities2KHR* in_struct);
@@ -3223,6 +3585,8 @@ struct safe_VkImageFormatListCreateInfoKHR {
     safe_VkImageFormatListCreateInfoKHR(const VkImageFormatListCreateInfoKHR* in_struct);
     safe_VkImageFormatListCreateInfoKHR(const safe_VkImageFormatListCreateInfoKHR& src);
     safe_VkImageFormatListCreateInfoKHR& operator=(const safe_VkImageFormatListCreateInfoKHR& src);
+    safe_VkImageFormatListCreateInfoKHR(safe_VkImageFormatListCreateInfoKHR&& src) noexcept;
+    safe_VkImageFormatListCreateInfoKHR& operator=(safe_VkImageFormatListCreateInfoKHR&& src) noexcept;
     safe_VkImageFormatListCreateInfoKHR();
     ~safe_VkImageFormatListCreateInfoKHR();
     void initialize(const VkImageFormatListCreateInfoKHR* in_struct);
@@ -3240,6 +3604,8 @@ struct safe_VkPhysicalDevice8BitStorageFeaturesKHR {
     safe_VkPhysicalDevice8BitStorageFeaturesKHR(const VkPhysicalDevice8BitStorageFeaturesKHR* in_struct);
     safe_VkPhysicalDevice8BitStorageFeaturesKHR(const safe_VkPhysicalDevice8BitStorageFeaturesKHR& src);
     safe_VkPhysicalDevice8BitStorageFeaturesKHR& operator=(const safe_VkPhysicalDevice8BitStorageFeaturesKHR& src);
+    safe_VkPhysicalDevice8BitStorageFeaturesKHR(safe_VkPhysicalDevice8BitStorageFeaturesKHR&& src) noexcept;
+    safe_VkPhysicalDevice8BitStorageFeaturesKHR& operator=(safe_VkPhysicalDevice8BitStorageFeaturesKHR&& src) noexcept;
     safe_VkPhysicalDevice8BitStorageFeaturesKHR();
     ~safe_VkPhysicalDevice8BitStorageFeaturesKHR();
     void initialize(const VkPhysicalDevice8BitStorageFeaturesKHR* in_struct);
@@ -3256,6 +3622,8 @@ struct safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR {
     safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR(const VkPhysicalDeviceShaderAtomicInt64FeaturesKHR* in_struct);
     safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR(const safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR& src);
     safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR& operator=(const safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR& src);
+    safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR(safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR& operator=(safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR&& src) noexcept;
     safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR();
     ~safe_VkPhysicalDeviceShaderAtomicInt64FeaturesKHR();
     void initialize(const VkPhysicalDeviceShaderAtomicInt64FeaturesKHR* in_struct);
@@ -3274,6 +3642,8 @@ struct safe_VkPhysicalDeviceDriverPropertiesKHR {
     safe_VkPhysicalDeviceDriverPropertiesKHR(const VkPhysicalDeviceDriverPropertiesKHR* in_struct);
     safe_VkPhysicalDeviceDriverPropertiesKHR(const safe_VkPhysicalDeviceDriverPropertiesKHR& src);
     safe_VkPhysicalDeviceDriverPropertiesKHR& operator=(const safe_VkPhysicalDeviceDriverPropertiesKHR& src);
+    safe_VkPhysicalDeviceDriverPropertiesKHR(safe_VkPhysicalDeviceDriverPropertiesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceDriverPropertiesKHR& operator=(safe_VkPhysicalDeviceDriverPropertiesKHR&& src) noexcept;
     safe_VkPhysicalDeviceDriverPropertiesKHR();
     ~safe_VkPhysicalDeviceDriverPropertiesKHR();
     void initialize(const VkPhysicalDeviceDriverPropertiesKHR* in_struct);
@@ -3305,6 +3675,8 @@ struct safe_VkPhysicalDeviceFloatControlsPropertiesKHR {
     safe_VkPhysicalDeviceFloatControlsPropertiesKHR(const VkPhysicalDeviceFloatControlsPropertiesKHR* in_struct);
     safe_VkPhysicalDeviceFloatControlsPropertiesKHR(const safe_VkPhysicalDeviceFloatControlsPropertiesKHR& src);
     safe_VkPhysicalDeviceFloatControlsPropertiesKHR& operator=(const safe_VkPhysicalDeviceFloatControlsPropertiesKHR& src);
+    safe_VkPhysicalDeviceFloatControlsPropertiesKHR(safe_VkPhysicalDeviceFloatControlsPropertiesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceFloatControlsPropertiesKHR& operator=(safe_VkPhysicalDeviceFloatControlsPropertiesKHR&& src) noexcept;
     safe_VkPhysicalDeviceFloatControlsPropertiesKHR();
     ~safe_VkPhysicalDeviceFloatControlsPropertiesKHR();
     void initialize(const VkPhysicalDeviceFloatControlsPropertiesKHR* in_struct);
@@ -3322,6 +3694,8 @@ struct safe_VkSubpassDescriptionDepthStencilResolveKHR {
     safe_VkSubpassDescriptionDepthStencilResolveKHR(const VkSubpassDescriptionDepthStencilResolveKHR* in_struct);
     safe_VkSubpassDescriptionDepthStencilResolveKHR(const safe_VkSubpassDescriptionDepthStencilResolveKHR& src);
     safe_VkSubpassDescriptionDepthStencilResolveKHR& operator=(const safe_VkSubpassDescriptionDepthStencilResolveKHR& src);
+    safe_VkSubpassDescriptionDepthStencilResolveKHR(safe_VkSubpassDescriptionDepthStencilResolveKHR&& src) noexcept;
+    safe_VkSubpassDescriptionDepthStencilResolveKHR& operator=(safe_VkSubpassDescriptionDepthStencilResolveKHR&& src) noexcept;
     safe_VkSubpassDescriptionDepthStencilResolveKHR();
     ~safe_VkSubpassDescriptionDepthStencilResolveKHR();
     void initialize(const VkSubpassDescriptionDepthStencilResolveKHR* in_struct);
@@ -3340,6 +3714,8 @@ struct safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR {
     safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR(const VkPhysicalDeviceDepthStencilResolvePropertiesKHR* in_struct);
     safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR(const safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR& src);
     safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR& operator=(const safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR& src);
+    safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR(safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR& operator=(safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR&& src) noexcept;
     safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR();
     ~safe_VkPhysicalDeviceDepthStencilResolvePropertiesKHR();
     void initialize(const VkPhysicalDeviceDepthStencilResolvePropertiesKHR* in_struct);
@@ -3357,6 +3733,8 @@ struct safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR {
     safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR(const VkPhysicalDeviceVulkanMemoryModelFeaturesKHR* in_struct);
     safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR(const safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR& src);
     safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR& operator=(const safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR& src);
+    safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR(safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR& operator=(safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR&& src) noexcept;
     safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR();
     ~safe_VkPhysicalDeviceVulkanMemoryModelFeaturesKHR();
     void initialize(const VkPhysicalDeviceVulkanMemoryModelFeaturesKHR* in_struct);
@@ -3372,6 +3750,8 @@ struct safe_VkSurfaceProtectedCapabilitiesKHR {
     safe_VkSurfaceProtectedCapabilitiesKHR(const VkSurfaceProtectedCapabilitiesKHR* in_struct);
     safe_VkSurfaceProtectedCapabilitiesKHR(const safe_VkSurfaceProtectedCapabilitiesKHR& src);
     safe_VkSurfaceProtectedCapabilitiesKHR& operator=(const safe_VkSurfaceProtectedCapabilitiesKHR& src);
+    safe_VkSurfaceProtectedCapabilitiesKHR(safe_VkSurfaceProtectedCapabilitiesKHR&& src) noexcept;
+    safe_VkSurfaceProtectedCapabilitiesKHR& operator=(safe_VkSurfaceProtectedCapabilitiesKHR&& src) noexcept;
     safe_VkSurfaceProtectedCapabilitiesKHR();
     ~safe_VkSurfaceProtectedCapabilitiesKHR();
     void initialize(const VkSurfaceProtectedCapabilitiesKHR* in_struct);
@@ -3387,6 +3767,8 @@ struct safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR {
     safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR(const VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR* in_struct);
     safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR(const safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR& src);
     safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR& operator=(const safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR& src);
+    safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR(safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR&& src) noexcept;
+    safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR& operator=(safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR&& src) noexcept;
     safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR();
     ~safe_VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR();
     void initialize(const VkPhysicalDeviceUniformBufferStandardLayoutFeaturesKHR* in_struct);
@@ -3404,6 +3786,8 @@ struct safe_VkDebugReportCallbackCreateInfoEXT {
     safe_VkDebugReportCallbackCreateInfoEXT(const VkDebugReportCallbackCreateInfoEXT* in_struct);
     safe_VkDebugReportCallbackCreateInfoEXT(const safe_VkDebugReportCallbackCreateInfoEXT& src);
     safe_VkDebugReportCallbackCreateInfoEXT& operator=(const safe_VkDebugReportCallbackCreateInfoEXT& src);
+    safe_VkDebugReportCallbackCreateInfoEXT(safe_VkDebugReportCallbackCreateInfoEXT&& src) noexcept;
+    safe_VkDebugReportCallbackCreateInfoEXT& operator=(safe_VkDebugReportCallbackCreateInfoEXT&& src) noexcept;
     safe_VkDebugReportCallbackCreateInfoEXT();
     ~safe_VkDebugReportCallbackCreateInfoEXT();
     void initialize(const VkDebugReportCallbackCreateInfoEXT* in_struct);
@@ -3419,6 +3803,8 @@ struct safe_VkPipelineRasterizationStateRasterizationOrderAMD {
     safe_VkPipelineRasterizationStateRasterizationOrderAMD(const VkPipelineRasterizationStateRasterizationOrderAMD* in_struct);
     safe_VkPipelineRasterizationStateRasterizationOrderAMD(const safe_VkPipelineRasterizationStateRasterizationOrderAMD& src);
     safe_VkPipelineRasterizationStateRasterizationOrderAMD& operator=(const safe_VkPipelineRasterizationStateRasterizationOrderAMD& src);
+    safe_VkPipelineRasterizationStateRasterizationOrderAMD(safe_VkPipelineRasterizationStateRasterizationOrderAMD&& src) noexcept;
+    safe_VkPipelineRasterizationStateRasterizationOrderAMD& operator=(safe_VkPipelineRasterizationStateRasterizationOrderAMD&& src) noexcept;
     safe_VkPipelineRasterizationStateRasterizationOrderAMD();
     ~safe_VkPipelineRasterizationStateRasterizationOrderAMD();
     void initialize(const VkPipelineRasterizationStateRasterizationOrderAMD* in_struct);
@@ -3436,6 +3822,8 @@ struct safe_VkDebugMarkerObjectNameInfoEXT {
     safe_VkDebugMarkerObjectNameInfoEXT(const VkDebugMarkerObjectNameInfoEXT* in_struct);
     safe_VkDebugMarkerObjectNameInfoEXT(const safe_VkDebugMarkerObjectNameInfoEXT& src);
     safe_VkDebugMarkerObjectNameInfoEXT& operator=(const safe_VkDebugMarkerObjectNameInfoEXT& src);
+    safe_VkDebugMarkerObjectNameInfoEXT(safe_VkDebugMarkerObjectNameInfoEXT&& src) noexcept;
+    safe_VkDebugMarkerObjectNameInfoEXT& operator=(safe_VkDebugMarkerObjectNameInfoEXT&& src) noexcept;
     safe_VkDebugMarkerObjectNameInfoEXT();
     ~safe_VkDebugMarkerObjectNameInfoEXT();
     void initialize(const VkDebugMarkerObjectNameInfoEXT* in_struct);
@@ -3455,6 +3843,8 @@ struct safe_VkDebugMarkerObjectTagInfoEXT {
     safe_VkDebugMarkerObjectTagInfoEXT(const VkDebugMarkerObjectTagInfoEXT* in_struct);
     safe_VkDebugMarkerObjectTagInfoEXT(const safe_VkDebugMarkerObjectTagInfoEXT& src);
     safe_VkDebugMarkerObjectTagInfoEXT& operator=(const safe_VkDebugMarkerObjectTagInfoEXT& src);
+    safe_VkDebugMarkerObjectTagInfoEXT(safe_VkDebugMarkerObjectTagInfoEXT&& src) noexcept;
+    safe_VkDebugMarkerObjectTagInfoEXT& operator=(safe_VkDebugMarkerObjectTagInfoEXT&& src) noexcept;
     safe_VkDebugMarkerObjectTagInfoEXT();
     ~safe_VkDebugMarkerObjectTagInfoEXT();
     void initialize(const VkDebugMarkerObjectTagInfoEXT* in_struct);
@@ -3471,6 +3861,8 @@ struct safe_VkDebugMarkerMarkerInfoEXT {
     safe_VkDebugMarkerMarkerInfoEXT(const VkDebugMarkerMarkerInfoEXT* in_struct);
     safe_VkDebugMarkerMarkerInfoEXT(const safe_VkDebugMarkerMarkerInfoEXT& src);
     safe_VkDebugMarkerMarkerInfoEXT& operator=(const safe_VkDebugMarkerMarkerInfoEXT& src);
+    safe_VkDebugMarkerMarkerInfoEXT(safe_VkDebugMarkerMarkerInfoEXT&& src) noexcept;
+    safe_VkDebugMarkerMarkerInfoEXT& operator=(safe_VkDebugMarkerMarkerInfoEXT&& src) noexcept;
     safe_VkDebugMarkerMarkerInfoEXT();
     ~safe_VkDebugMarkerMarkerInfoEXT();
     void initialize(const VkDebugMarkerMarkerInfoEXT* in_struct);
@@ -3486,6 +3878,8 @@ struct safe_VkDedicatedAllocationImageCreateInfoNV {
     safe_VkDedicatedAllocationImageCreateInfoNV(const VkDedicatedAllocationImageCreateInfoNV* in_struct);
     safe_VkDedicatedAllocationImageCreateInfoNV(const safe_VkDedicatedAllocationImageCreateInfoNV& src);
     safe_VkDedicatedAllocationImageCreateInfoNV& operator=(const safe_VkDedicatedAllocationImageCreateInfoNV& src);
+    safe_VkDedicatedAllocationImageCreateInfoNV(safe_VkDedicatedAllocationImageCreateInfoNV&& src) noexcept;
+    safe_VkDedicatedAllocationImageCreateInfoNV& operator=(safe_VkDedicatedAllocationImageCreateInfoNV&& src) noexcept;
     safe_VkDedicatedAllocationImageCreateInfoNV();
     ~safe_VkDedicatedAllocationImageCreateInfoNV();
     void initialize(const VkDedicatedAllocationImageCreateInfoNV* in_struct);
@@ -3501,6 +3895,8 @@ struct safe_VkDedicatedAllocationBufferCreateInfoNV {
     safe_VkDedicatedAllocationBufferCreateInfoNV(const VkDedicatedAllocationBufferCreateInfoNV* in_struct);
     safe_VkDedicatedAllocationBufferCreateInfoNV(const safe_VkDedicatedAllocationBufferCreateInfoNV& src);
     safe_VkDedicatedAllocationBufferCreateInfoNV& operator=(const safe_VkDedicatedAllocationBufferCreateInfoNV& src);
+    safe_VkDedicatedAllocationBufferCreateInfoNV(safe_VkDedicatedAllocationBufferCreateInfoNV&& src) noexcept;
+    safe_VkDedicatedAllocationBufferCreateInfoNV& operator=(safe_VkDedicatedAllocationBufferCreateInfoNV&& src) noexcept;
     safe_VkDedicatedAllocationBufferCreateInfoNV();
     ~safe_VkDedicatedAllocationBufferCreateInfoNV();
     void initialize(const VkDedicatedAllocationBufferCreateInfoNV* in_struct);
@@ -3517,6 +3913,8 @@ struct safe_VkDedicatedAllocationMemoryAllocateInfoNV {
     safe_VkDedicatedAllocationMemoryAllocateInfoNV(const VkDedicatedAllocationMemoryAllocateInfoNV* in_struct);
     safe_VkDedicatedAllocationMemoryAllocateInfoNV(const safe_VkDedicatedAllocationMemoryAllocateInfoNV& src);
     safe_VkDedicatedAllocationMemoryAllocateInfoNV& operator=(const safe_VkDedicatedAllocationMemoryAllocateInfoNV& src);
+    safe_VkDedicatedAllocationMemoryAllocateInfoNV(safe_VkDedicatedAllocationMemoryAllocateInfoNV&& src) noexcept;
+    safe_VkDedicatedAllocationMemoryAllocateInfoNV& operator=(safe_VkDedicatedAllocationMemoryAllocateInfoNV&& src) noexcept;
     safe_VkDedicatedAllocationMemoryAllocateInfoNV();
     ~safe_VkDedicatedAllocationMemoryAllocateInfoNV();
     void initialize(const VkDedicatedAllocationMemoryAllocateInfoNV* in_struct);
@@ -3533,6 +3931,8 @@ struct safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT {
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(const VkPhysicalDeviceTransformFeedbackFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(const safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& src);
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& operator=(const safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& src);
+    safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT& operator=(safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
     ~safe_VkPhysicalDeviceTransformFeedbackFeaturesEXT();
     void initialize(const VkPhysicalDeviceTransformFeedbackFeaturesEXT* in_struct);
@@ -3557,6 +3957,8 @@ struct safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT {
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(const VkPhysicalDeviceTransformFeedbackPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(const safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& src);
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& operator=(const safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& src);
+    safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT& operator=(safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
     ~safe_VkPhysicalDeviceTransformFeedbackPropertiesEXT();
     void initialize(const VkPhysicalDeviceTransformFeedbackPropertiesEXT* in_struct);
@@ -3573,6 +3975,8 @@ struct safe_VkPipelineRasterizationStateStreamCreateInfoEXT {
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT(const VkPipelineRasterizationStateStreamCreateInfoEXT* in_struct);
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT(const safe_VkPipelineRasterizationStateStreamCreateInfoEXT& src);
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT& operator=(const safe_VkPipelineRasterizationStateStreamCreateInfoEXT& src);
+    safe_VkPipelineRasterizationStateStreamCreateInfoEXT(safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineRasterizationStateStreamCreateInfoEXT& operator=(safe_VkPipelineRasterizationStateStreamCreateInfoEXT&& src) noexcept;
     safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
     ~safe_VkPipelineRasterizationStateStreamCreateInfoEXT();
     void initialize(const VkPipelineRasterizationStateStreamCreateInfoEXT* in_struct);
@@ -3590,6 +3994,8 @@ struct safe_VkImageViewHandleInfoNVX {
     safe_VkImageViewHandleInfoNVX(const VkImageViewHandleInfoNVX* in_struct);
     safe_VkImageViewHandleInfoNVX(const safe_VkImageViewHandleInfoNVX& src);
     safe_VkImageViewHandleInfoNVX& operator=(const safe_VkImageViewHandleInfoNVX& src);
+    safe_VkImageViewHandleInfoNVX(safe_VkImageViewHandleInfoNVX&& src) noexcept;
+    safe_VkImageViewHandleInfoNVX& operator=(safe_VkImageViewHandleInfoNVX&& src) noexcept;
     safe_VkImageViewHandleInfoNVX();
     ~safe_VkImageViewHandleInfoNVX();
     void initialize(const VkImageViewHandleInfoNVX* in_struct);
@@ -3605,6 +4011,8 @@ struct safe_VkTextureLODGatherFormatPropertiesAMD {
     safe_VkTextureLODGatherFormatPropertiesAMD(const VkTextureLODGatherFormatPropertiesAMD* in_struct);
     safe_VkTextureLODGatherFormatPropertiesAMD(const safe_VkTextureLODGatherFormatPropertiesAMD& src);
     safe_VkTextureLODGatherFormatPropertiesAMD& operator=(const safe_VkTextureLODGatherFormatPropertiesAMD& src);
+    safe_VkTextureLODGatherFormatPropertiesAMD(safe_VkTextureLODGatherFormatPropertiesAMD&& src) noexcept;
+    safe_VkTextureLODGatherFormatPropertiesAMD& operator=(safe_VkTextureLODGatherFormatPropertiesAMD&& src) noexcept;
     safe_VkTextureLODGatherFormatPropertiesAMD();
     ~safe_VkTextureLODGatherFormatPropertiesAMD();
     void initialize(const VkTextureLODGatherFormatPropertiesAMD* in_struct);
@@ -3622,6 +4030,8 @@ struct safe_VkStreamDescriptorSurfaceCreateInfoGGP {
     safe_VkStreamDescriptorSurfaceCreateInfoGGP(const VkStreamDescriptorSurfaceCreateInfoGGP* in_struct);
     safe_VkStreamDescriptorSurfaceCreateInfoGGP(const safe_VkStreamDescriptorSurfaceCreateInfoGGP& src);
     safe_VkStreamDescriptorSurfaceCreateInfoGGP& operator=(const safe_VkStreamDescriptorSurfaceCreateInfoGGP& src);
+    safe_VkStreamDescriptorSurfaceCreateInfoGGP(safe_VkStreamDescriptorSurfaceCreateInfoGGP&& src) noexcept;
+    safe_VkStreamDescriptorSurfaceCreateInfoGGP& operator=(safe_VkStreamDescriptorSurfaceCreateInfoGGP&& src) noexcept;
     safe_VkStreamDescriptorSurfaceCreateInfoGGP();
     ~safe_VkStreamDescriptorSurfaceCreateInfoGGP();
     void initialize(const VkStreamDescriptorSurfaceCreateInfoGGP* in_struct);
@@ -3638,6 +4048,8 @@ struct safe_VkPhysicalDeviceCornerSampledImageFeaturesNV {
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(const VkPhysicalDeviceCornerSampledImageFeaturesNV* in_struct);
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(const safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& src);
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& operator=(const safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& src);
+    safe_VkPhysicalDeviceCornerSampledImageFeaturesNV(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceCornerSampledImageFeaturesNV& operator=(safe_VkPhysicalDeviceCornerSampledImageFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
     ~safe_VkPhysicalDeviceCornerSampledImageFeaturesNV();
     void initialize(const VkPhysicalDeviceCornerSampledImageFeaturesNV* in_struct);
@@ -3653,6 +4065,8 @@ struct safe_VkExternalMemoryImageCreateInfoNV {
     safe_VkExternalMemoryImageCreateInfoNV(const VkExternalMemoryImageCreateInfoNV* in_struct);
     safe_VkExternalMemoryImageCreateInfoNV(const safe_VkExternalMemoryImageCreateInfoNV& src);
     safe_VkExternalMemoryImageCreateInfoNV& operator=(const safe_VkExternalMemoryImageCreateInfoNV& src);
+    safe_VkExternalMemoryImageCreateInfoNV(safe_VkExternalMemoryImageCreateInfoNV&& src) noexcept;
+    safe_VkExternalMemoryImageCreateInfoNV& operator=(safe_VkExternalMemoryImageCreateInfoNV&& src) noexcept;
     safe_VkExternalMemoryImageCreateInfoNV();
     ~safe_VkExternalMemoryImageCreateInfoNV();
     void initialize(const VkExternalMemoryImageCreateInfoNV* in_struct);
@@ -3668,6 +4082,8 @@ struct safe_VkExportMemoryAllocateInfoNV {
     safe_VkExportMemoryAllocateInfoNV(const VkExportMemoryAllocateInfoNV* in_struct);
     safe_VkExportMemoryAllocateInfoNV(const safe_VkExportMemoryAllocateInfoNV& src);
     safe_VkExportMemoryAllocateInfoNV& operator=(const safe_VkExportMemoryAllocateInfoNV& src);
+    safe_VkExportMemoryAllocateInfoNV(safe_VkExportMemoryAllocateInfoNV&& src) noexcept;
+    safe_VkExportMemoryAllocateInfoNV& operator=(safe_VkExportMemoryAllocateInfoNV&& src) noexcept;
     safe_VkExportMemoryAllocateInfoNV();
     ~safe_VkExportMemoryAllocateInfoNV();
     void initialize(const VkExportMemoryAllocateInfoNV* in_struct);
@@ -3685,6 +4101,8 @@ struct safe_VkImportMemoryWin32HandleInfoNV {
     safe_VkImportMemoryWin32HandleInfoNV(const VkImportMemoryWin32HandleInfoNV* in_struct);
     safe_VkImportMemoryWin32HandleInfoNV(const safe_VkImportMemoryWin32HandleInfoNV& src);
     safe_VkImportMemoryWin32HandleInfoNV& operator=(const safe_VkImportMemoryWin32HandleInfoNV& src);
+    safe_VkImportMemoryWin32HandleInfoNV(safe_VkImportMemoryWin32HandleInfoNV&& src) noexcept;
+    safe_VkImportMemoryWin32HandleInfoNV& operator=(safe_VkImportMemoryWin32HandleInfoNV&& src) noexcept;
     safe_VkImportMemoryWin32HandleInfoNV();
     ~safe_VkImportMemoryWin32HandleInfoNV();
     void initialize(const VkImportMemoryWin32HandleInfoNV* in_struct);
@@ -3703,6 +4121,8 @@ struct safe_VkExportMemoryWin32HandleInfoNV {
     safe_VkExportMemoryWin32HandleInfoNV(const VkExportMemoryWin32HandleInfoNV* in_struct);
     safe_VkExportMemoryWin32HandleInfoNV(const safe_VkExportMemoryWin32HandleInfoNV& src);
     safe_VkExportMemoryWin32HandleInfoNV& operator=(const safe_VkExportMemoryWin32HandleInfoNV& src);
+    safe_VkExportMemoryWin32HandleInfoNV(safe_VkExportMemoryWin32HandleInfoNV&& src) noexcept;
+    safe_VkExportMemoryWin32HandleInfoNV& operator=(safe_VkExportMemoryWin32HandleInfoNV&& src) noexcept;
     safe_VkExportMemoryWin32HandleInfoNV();
     ~safe_VkExportMemoryWin32HandleInfoNV();
     void initialize(const VkExportMemoryWin32HandleInfoNV* in_struct);
@@ -3726,6 +4146,8 @@ struct safe_VkWin32KeyedMutexAcquireReleaseInfoNV {
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV(const VkWin32KeyedMutexAcquireReleaseInfoNV* in_struct);
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV(const safe_VkWin32KeyedMutexAcquireReleaseInfoNV& src);
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV& operator=(const safe_VkWin32KeyedMutexAcquireReleaseInfoNV& src);
+    safe_VkWin32KeyedMutexAcquireReleaseInfoNV(safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& src) noexcept;
+    safe_VkWin32KeyedMutexAcquireReleaseInfoNV& operator=(safe_VkWin32KeyedMutexAcquireReleaseInfoNV&& src) noexcept;
     safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
     ~safe_VkWin32KeyedMutexAcquireReleaseInfoNV();
     void initialize(const VkWin32KeyedMutexAcquireReleaseInfoNV* in_struct);
@@ -3743,6 +4165,8 @@ struct safe_VkValidationFlagsEXT {
     safe_VkValidationFlagsEXT(const VkValidationFlagsEXT* in_struct);
     safe_VkValidationFlagsEXT(const safe_VkValidationFlagsEXT& src);
     safe_VkValidationFlagsEXT& operator=(const safe_VkValidationFlagsEXT& src);
+    safe_VkValidationFlagsEXT(safe_VkValidationFlagsEXT&& src) noexcept;
+    safe_VkValidationFlagsEXT& operator=(safe_VkValidationFlagsEXT&& src) noexcept;
     safe_VkValidationFlagsEXT();
     ~safe_VkValidationFlagsEXT();
     void initialize(const VkValidationFlagsEXT* in_struct);
@@ -3760,6 +4184,8 @@ struct safe_VkViSurfaceCreateInfoNN {
     safe_VkViSurfaceCreateInfoNN(const VkViSurfaceCreateInfoNN* in_struct);
     safe_VkViSurfaceCreateInfoNN(const safe_VkViSurfaceCreateInfoNN& src);
     safe_VkViSurfaceCreateInfoNN& operator=(const safe_VkViSurfaceCreateInfoNN& src);
+    safe_VkViSurfaceCreateInfoNN(safe_VkViSurfaceCreateInfoNN&& src) noexcept;
+    safe_VkViSurfaceCreateInfoNN& operator=(safe_VkViSurfaceCreateInfoNN&& src) noexcept;
     safe_VkViSurfaceCreateInfoNN();
     ~safe_VkViSurfaceCreateInfoNN();
     void initialize(const VkViSurfaceCreateInfoNN* in_struct);
@@ -3776,6 +4202,8 @@ struct safe_VkImageViewASTCDecodeModeEXT {
     safe_VkImageViewASTCDecodeModeEXT(const VkImageViewASTCDecodeModeEXT* in_struct);
     safe_VkImageViewASTCDecodeModeEXT(const safe_VkImageViewASTCDecodeModeEXT& src);
     safe_VkImageViewASTCDecodeModeEXT& operator=(const safe_VkImageViewASTCDecodeModeEXT& src);
+    safe_VkImageViewASTCDecodeModeEXT(safe_VkImageViewASTCDecodeModeEXT&& src) noexcept;
+    safe_VkImageViewASTCDecodeModeEXT& operator=(safe_VkImageViewASTCDecodeModeEXT&& src) noexcept;
     safe_VkImageViewASTCDecodeModeEXT();
     ~safe_VkImageViewASTCDecodeModeEXT();
     void initialize(const VkImageViewASTCDecodeModeEXT* in_struct);
@@ -3791,6 +4219,8 @@ struct safe_VkPhysicalDeviceASTCDecodeFeaturesEXT {
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(const VkPhysicalDeviceASTCDecodeFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(const safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& src);
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& operator=(const safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& src);
+    safe_VkPhysicalDeviceASTCDecodeFeaturesEXT(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceASTCDecodeFeaturesEXT& operator=(safe_VkPhysicalDeviceASTCDecodeFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
     ~safe_VkPhysicalDeviceASTCDecodeFeaturesEXT();
     void initialize(const VkPhysicalDeviceASTCDecodeFeaturesEXT* in_struct);
@@ -3808,6 +4238,8 @@ struct safe_VkConditionalRenderingBeginInfoEXT {
     safe_VkConditionalRenderingBeginInfoEXT(const VkConditionalRenderingBeginInfoEXT* in_struct);
     safe_VkConditionalRenderingBeginInfoEXT(const safe_VkConditionalRenderingBeginInfoEXT& src);
     safe_VkConditionalRenderingBeginInfoEXT& operator=(const safe_VkConditionalRenderingBeginInfoEXT& src);
+    safe_VkConditionalRenderingBeginInfoEXT(safe_VkConditionalRenderingBeginInfoEXT&& src) noexcept;
+    safe_VkConditionalRenderingBeginInfoEXT& operator=(safe_VkConditionalRenderingBeginInfoEXT&& src) noexcept;
     safe_VkConditionalRenderingBeginInfoEXT();
     ~safe_VkConditionalRenderingBeginInfoEXT();
     void initialize(const VkConditionalRenderingBeginInfoEXT* in_struct);
@@ -3824,6 +4256,8 @@ struct safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT {
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(const VkPhysicalDeviceConditionalRenderingFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(const safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& src);
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& operator=(const safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& src);
+    safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT& operator=(safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
     ~safe_VkPhysicalDeviceConditionalRenderingFeaturesEXT();
     void initialize(const VkPhysicalDeviceConditionalRenderingFeaturesEXT* in_struct);
@@ -3839,6 +4273,8 @@ struct safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT {
     safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(const VkCommandBufferInheritanceConditionalRenderingInfoEXT* in_struct);
     safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(const safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& src);
     safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& operator=(const safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& src);
+    safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT(safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& src) noexcept;
+    safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT& operator=(safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT&& src) noexcept;
     safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
     ~safe_VkCommandBufferInheritanceConditionalRenderingInfoEXT();
     void initialize(const VkCommandBufferInheritanceConditionalRenderingInfoEXT* in_struct);
@@ -3854,6 +4290,8 @@ struct safe_VkDeviceGeneratedCommandsFeaturesNVX {
     safe_VkDeviceGeneratedCommandsFeaturesNVX(const VkDeviceGeneratedCommandsFeaturesNVX* in_struct);
     safe_VkDeviceGeneratedCommandsFeaturesNVX(const safe_VkDeviceGeneratedCommandsFeaturesNVX& src);
     safe_VkDeviceGeneratedCommandsFeaturesNVX& operator=(const safe_VkDeviceGeneratedCommandsFeaturesNVX& src);
+    safe_VkDeviceGeneratedCommandsFeaturesNVX(safe_VkDeviceGeneratedCommandsFeaturesNVX&& src) noexcept;
+    safe_VkDeviceGeneratedCommandsFeaturesNVX& operator=(safe_VkDeviceGeneratedCommandsFeaturesNVX&& src) noexcept;
     safe_VkDeviceGeneratedCommandsFeaturesNVX();
     ~safe_VkDeviceGeneratedCommandsFeaturesNVX();
     void initialize(const VkDeviceGeneratedCommandsFeaturesNVX* in_struct);
@@ -3873,6 +4311,8 @@ struct safe_VkDeviceGeneratedCommandsLimitsNVX {
     safe_VkDeviceGeneratedCommandsLimitsNVX(const VkDeviceGeneratedCommandsLimitsNVX* in_struct);
     safe_VkDeviceGeneratedCommandsLimitsNVX(const safe_VkDeviceGeneratedCommandsLimitsNVX& src);
     safe_VkDeviceGeneratedCommandsLimitsNVX& operator=(const safe_VkDeviceGeneratedCommandsLimitsNVX& src);
+    safe_VkDeviceGeneratedCommandsLimitsNVX(safe_VkDeviceGeneratedCommandsLimitsNVX&& src) noexcept;
+    safe_VkDeviceGeneratedCommandsLimitsNVX& operator=(safe_VkDeviceGeneratedCommandsLimitsNVX&& src) noexcept;
     safe_VkDeviceGeneratedCommandsLimitsNVX();
     ~safe_VkDeviceGeneratedCommandsLimitsNVX();
     void initialize(const VkDeviceGeneratedCommandsLimitsNVX* in_struct);
@@ -3891,6 +4331,8 @@ struct safe_VkIndirectCommandsLayoutCreateInfoNVX {
     safe_VkIndirectCommandsLayoutCreateInfoNVX(const VkIndirectCommandsLayoutCreateInfoNVX* in_struct);
     safe_VkIndirectCommandsLayoutCreateInfoNVX(const safe_VkIndirectCommandsLayoutCreateInfoNVX& src);
     safe_VkIndirectCommandsLayoutCreateInfoNVX& operator=(const safe_VkIndirectCommandsLayoutCreateInfoNVX& src);
+    safe_VkIndirectCommandsLayoutCreateInfoNVX(safe_VkIndirectCommandsLayoutCreateInfoNVX&& src) noexcept;
+    safe_VkIndirectCommandsLayoutCreateInfoNVX& operator=(safe_VkIndirectCommandsLayoutCreateInfoNVX&& src) noexcept;
     safe_VkIndirectCommandsLayoutCreateInfoNVX();
     ~safe_VkIndirectCommandsLayoutCreateInfoNVX();
     void initialize(const VkIndirectCommandsLayoutCreateInfoNVX* in_struct);
@@ -3915,6 +4357,8 @@ struct safe_VkCmdProcessCommandsInfoNVX {
     safe_VkCmdProcessCommandsInfoNVX(const VkCmdProcessCommandsInfoNVX* in_struct);
     safe_VkCmdProcessCommandsInfoNVX(const safe_VkCmdProcessCommandsInfoNVX& src);
     safe_VkCmdProcessCommandsInfoNVX& operator=(const safe_VkCmdProcessCommandsInfoNVX& src);
+    safe_VkCmdProcessCommandsInfoNVX(safe_VkCmdProcessCommandsInfoNVX&& src) noexcept;
+    safe_VkCmdProcessCommandsInfoNVX& operator=(safe_VkCmdProcessCommandsInfoNVX&& src) noexcept;
     safe_VkCmdProcessCommandsInfoNVX();
     ~safe_VkCmdProcessCommandsInfoNVX();
     void initialize(const VkCmdProcessCommandsInfoNVX* in_struct);
@@ -3932,6 +4376,8 @@ struct safe_VkCmdReserveSpaceForCommandsInfoNVX {
     safe_VkCmdReserveSpaceForCommandsInfoNVX(const VkCmdReserveSpaceForCommandsInfoNVX* in_struct);
     safe_VkCmdReserveSpaceForCommandsInfoNVX(const safe_VkCmdReserveSpaceForCommandsInfoNVX& src);
     safe_VkCmdReserveSpaceForCommandsInfoNVX& operator=(const safe_VkCmdReserveSpaceForCommandsInfoNVX& src);
+    safe_VkCmdReserveSpaceForCommandsInfoNVX(safe_VkCmdReserveSpaceForCommandsInfoNVX&& src) noexcept;
+    safe_VkCmdReserveSpaceForCommandsInfoNVX& operator=(safe_VkCmdReserveSpaceForCommandsInfoNVX&& src) noexcept;
     safe_VkCmdReserveSpaceForCommandsInfoNVX();
     ~safe_VkCmdReserveSpaceForCommandsInfoNVX();
     void initialize(const VkCmdReserveSpaceForCommandsInfoNVX* in_struct);
@@ -3955,6 +4401,8 @@ struct safe_VkObjectTableCreateInfoNVX {
     safe_VkObjectTableCreateInfoNVX(const VkObjectTableCreateInfoNVX* in_struct);
     safe_VkObjectTableCreateInfoNVX(const safe_VkObjectTableCreateInfoNVX& src);
     safe_VkObjectTableCreateInfoNVX& operator=(const safe_VkObjectTableCreateInfoNVX& src);
+    safe_VkObjectTableCreateInfoNVX(safe_VkObjectTableCreateInfoNVX&& src) noexcept;
+    safe_VkObjectTableCreateInfoNVX& operator=(safe_VkObjectTableCreateInfoNVX&& src) noexcept;
     safe_VkObjectTableCreateInfoNVX();
     ~safe_VkObjectTableCreateInfoNVX();
     void initialize(const VkObjectTableCreateInfoNVX* in_struct);
@@ -3972,6 +4420,8 @@ struct safe_VkPipelineViewportWScalingStateCreateInfoNV {
     safe_VkPipelineViewportWScalingStateCreateInfoNV(const VkPipelineViewportWScalingStateCreateInfoNV* in_struct);
     safe_VkPipelineViewportWScalingStateCreateInfoNV(const safe_VkPipelineViewportWScalingStateCreateInfoNV& src);
     safe_VkPipelineViewportWScalingStateCreateInfoNV& operator=(const safe_VkPipelineViewportWScalingStateCreateInfoNV& src);
+    safe_VkPipelineViewportWScalingStateCreateInfoNV(safe_VkPipelineViewportWScalingStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineViewportWScalingStateCreateInfoNV& operator=(safe_VkPipelineViewportWScalingStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineViewportWScalingStateCreateInfoNV();
     ~safe_VkPipelineViewportWScalingStateCreateInfoNV();
     void initialize(const VkPipelineViewportWScalingStateCreateInfoNV* in_struct);
@@ -3997,6 +4447,8 @@ struct safe_VkSurfaceCapabilities2EXT {
     safe_VkSurfaceCapabilities2EXT(const VkSurfaceCapabilities2EXT* in_struct);
     safe_VkSurfaceCapabilities2EXT(const safe_VkSurfaceCapabilities2EXT& src);
     safe_VkSurfaceCapabilities2EXT& operator=(const safe_VkSurfaceCapabilities2EXT& src);
+    safe_VkSurfaceCapabilities2EXT(safe_VkSurfaceCapabilities2EXT&& src) noexcept;
+    safe_VkSurfaceCapabilities2EXT& operator=(safe_VkSurfaceCapabilities2EXT&& src) noexcept;
     safe_VkSurfaceCapabilities2EXT();
     ~safe_VkSurfaceCapabilities2EXT();
     void initialize(const VkSurfaceCapabilities2EXT* in_struct);
@@ -4012,6 +4464,8 @@ struct safe_VkDisplayPowerInfoEXT {
     safe_VkDisplayPowerInfoEXT(const VkDisplayPowerInfoEXT* in_struct);
     safe_VkDisplayPowerInfoEXT(const safe_VkDisplayPowerInfoEXT& src);
     safe_VkDisplayPowerInfoEXT& operator=(const safe_VkDisplayPowerInfoEXT& src);
+    safe_VkDisplayPowerInfoEXT(safe_VkDisplayPowerInfoEXT&& src) noexcept;
+    safe_VkDisplayPowerInfoEXT& operator=(safe_VkDisplayPowerInfoEXT&& src) noexcept;
     safe_VkDisplayPowerInfoEXT();
     ~safe_VkDisplayPowerInfoEXT();
     void initialize(const VkDisplayPowerInfoEXT* in_struct);
@@ -4027,6 +4481,8 @@ struct safe_VkDeviceEventInfoEXT {
     safe_VkDeviceEventInfoEXT(const VkDeviceEventInfoEXT* in_struct);
     safe_VkDeviceEventInfoEXT(const safe_VkDeviceEventInfoEXT& src);
     safe_VkDeviceEventInfoEXT& operator=(const safe_VkDeviceEventInfoEXT& src);
+    safe_VkDeviceEventInfoEXT(safe_VkDeviceEventInfoEXT&& src) noexcept;
+    safe_VkDeviceEventInfoEXT& operator=(safe_VkDeviceEventInfoEXT&& src) noexcept;
     safe_VkDeviceEventInfoEXT();
     ~safe_VkDeviceEventInfoEXT();
     void initialize(const VkDeviceEventInfoEXT* in_struct);
@@ -4042,6 +4498,8 @@ struct safe_VkDisplayEventInfoEXT {
     safe_VkDisplayEventInfoEXT(const VkDisplayEventInfoEXT* in_struct);
     safe_VkDisplayEventInfoEXT(const safe_VkDisplayEventInfoEXT& src);
     safe_VkDisplayEventInfoEXT& operator=(const safe_VkDisplayEventInfoEXT& src);
+    safe_VkDisplayEventInfoEXT(safe_VkDisplayEventInfoEXT&& src) noexcept;
+    safe_VkDisplayEventInfoEXT& operator=(safe_VkDisplayEventInfoEXT&& src) noexcept;
     safe_VkDisplayEventInfoEXT();
     ~safe_VkDisplayEventInfoEXT();
     void initialize(const VkDisplayEventInfoEXT* in_struct);
@@ -4057,6 +4515,8 @@ struct safe_VkSwapchainCounterCreateInfoEXT {
     safe_VkSwapchainCounterCreateInfoEXT(const VkSwapchainCounterCreateInfoEXT* in_struct);
     safe_VkSwapchainCounterCreateInfoEXT(const safe_VkSwapchainCounterCreateInfoEXT& src);
     safe_VkSwapchainCounterCreateInfoEXT& operator=(const safe_VkSwapchainCounterCreateInfoEXT& src);
+    safe_VkSwapchainCounterCreateInfoEXT(safe_VkSwapchainCounterCreateInfoEXT&& src) noexcept;
+    safe_VkSwapchainCounterCreateInfoEXT& operator=(safe_VkSwapchainCounterCreateInfoEXT&& src) noexcept;
     safe_VkSwapchainCounterCreateInfoEXT();
     ~safe_VkSwapchainCounterCreateInfoEXT();
     void initialize(const VkSwapchainCounterCreateInfoEXT* in_struct);
@@ -4073,6 +4533,8 @@ struct safe_VkPresentTimesInfoGOOGLE {
     safe_VkPresentTimesInfoGOOGLE(const VkPresentTimesInfoGOOGLE* in_struct);
     safe_VkPresentTimesInfoGOOGLE(const safe_VkPresentTimesInfoGOOGLE& src);
     safe_VkPresentTimesInfoGOOGLE& operator=(const safe_VkPresentTimesInfoGOOGLE& src);
+    safe_VkPresentTimesInfoGOOGLE(safe_VkPresentTimesInfoGOOGLE&& src) noexcept;
+    safe_VkPresentTimesInfoGOOGLE& operator=(safe_VkPresentTimesInfoGOOGLE&& src) noexcept;
     safe_VkPresentTimesInfoGOOGLE();
     ~safe_VkPresentTimesInfoGOOGLE();
     void initialize(const VkPresentTimesInfoGOOGLE* in_struct);
@@ -4088,6 +4550,8 @@ struct safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX {
     safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* in_struct);
     safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(const safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& src);
     safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& operator=(const safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& src);
+    safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& src) noexcept;
+    safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& operator=(safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX&& src) noexcept;
     safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
     ~safe_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX();
     void initialize(const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* in_struct);
@@ -4105,6 +4569,8 @@ struct safe_VkPipelineViewportSwizzleStateCreateInfoNV {
     safe_VkPipelineViewportSwizzleStateCreateInfoNV(const VkPipelineViewportSwizzleStateCreateInfoNV* in_struct);
     safe_VkPipelineViewportSwizzleStateCreateInfoNV(const safe_VkPipelineViewportSwizzleStateCreateInfoNV& src);
     safe_VkPipelineViewportSwizzleStateCreateInfoNV& operator=(const safe_VkPipelineViewportSwizzleStateCreateInfoNV& src);
+    safe_VkPipelineViewportSwizzleStateCreateInfoNV(safe_VkPipelineViewportSwizzleStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineViewportSwizzleStateCreateInfoNV& operator=(safe_VkPipelineViewportSwizzleStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineViewportSwizzleStateCreateInfoNV();
     ~safe_VkPipelineViewportSwizzleStateCreateInfoNV();
     void initialize(const VkPipelineViewportSwizzleStateCreateInfoNV* in_struct);
@@ -4120,6 +4586,8 @@ struct safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT {
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(const VkPhysicalDeviceDiscardRectanglePropertiesEXT* in_struct);
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(const safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& src);
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& operator=(const safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& src);
+    safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT& operator=(safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
     ~safe_VkPhysicalDeviceDiscardRectanglePropertiesEXT();
     void initialize(const VkPhysicalDeviceDiscardRectanglePropertiesEXT* in_struct);
@@ -4138,6 +4606,8 @@ struct safe_VkPipelineDiscardRectangleStateCreateInfoEXT {
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT(const VkPipelineDiscardRectangleStateCreateInfoEXT* in_struct);
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT(const safe_VkPipelineDiscardRectangleStateCreateInfoEXT& src);
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT& operator=(const safe_VkPipelineDiscardRectangleStateCreateInfoEXT& src);
+    safe_VkPipelineDiscardRectangleStateCreateInfoEXT(safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineDiscardRectangleStateCreateInfoEXT& operator=(safe_VkPipelineDiscardRectangleStateCreateInfoEXT&& src) noexcept;
     safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
     ~safe_VkPipelineDiscardRectangleStateCreateInfoEXT();
     void initialize(const VkPipelineDiscardRectangleStateCreateInfoEXT* in_struct);
@@ -4161,6 +4631,8 @@ struct safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT {
     safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(const safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& src);
     safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& operator=(const safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& src);
+    safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& operator=(safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
     ~safe_VkPhysicalDeviceConservativeRasterizationPropertiesEXT();
     void initialize(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT* in_struct);
@@ -4178,6 +4650,8 @@ struct safe_VkPipelineRasterizationConservativeStateCreateInfoEXT {
     safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(const VkPipelineRasterizationConservativeStateCreateInfoEXT* in_struct);
     safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(const safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& src);
     safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& operator=(const safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& src);
+    safe_VkPipelineRasterizationConservativeStateCreateInfoEXT(safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineRasterizationConservativeStateCreateInfoEXT& operator=(safe_VkPipelineRasterizationConservativeStateCreateInfoEXT&& src) noexcept;
     safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
     ~safe_VkPipelineRasterizationConservativeStateCreateInfoEXT();
     void initialize(const VkPipelineRasterizationConservativeStateCreateInfoEXT* in_struct);
@@ -4193,6 +4667,8 @@ struct safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT {
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(const VkPhysicalDeviceDepthClipEnableFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(const safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& src);
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& operator=(const safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& src);
+    safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT& operator=(safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
     ~safe_VkPhysicalDeviceDepthClipEnableFeaturesEXT();
     void initialize(const VkPhysicalDeviceDepthClipEnableFeaturesEXT* in_struct);
@@ -4209,6 +4685,8 @@ struct safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT {
     safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(const VkPipelineRasterizationDepthClipStateCreateInfoEXT* in_struct);
     safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(const safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& src);
     safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& operator=(const safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& src);
+    safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT(safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT& operator=(safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT&& src) noexcept;
     safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
     ~safe_VkPipelineRasterizationDepthClipStateCreateInfoEXT();
     void initialize(const VkPipelineRasterizationDepthClipStateCreateInfoEXT* in_struct);
@@ -4231,6 +4709,8 @@ struct safe_VkHdrMetadataEXT {
     safe_VkHdrMetadataEXT(const VkHdrMetadataEXT* in_struct);
     safe_VkHdrMetadataEXT(const safe_VkHdrMetadataEXT& src);
     safe_VkHdrMetadataEXT& operator=(const safe_VkHdrMetadataEXT& src);
+    safe_VkHdrMetadataEXT(safe_VkHdrMetadataEXT&& src) noexcept;
+    safe_VkHdrMetadataEXT& operator=(safe_VkHdrMetadataEXT&& src) noexcept;
     safe_VkHdrMetadataEXT();
     ~safe_VkHdrMetadataEXT();
     void initialize(const VkHdrMetadataEXT* in_struct);
@@ -4248,6 +4728,8 @@ struct safe_VkIOSSurfaceCreateInfoMVK {
     safe_VkIOSSurfaceCreateInfoMVK(const VkIOSSurfaceCreateInfoMVK* in_struct);
     safe_VkIOSSurfaceCreateInfoMVK(const safe_VkIOSSurfaceCreateInfoMVK& src);
     safe_VkIOSSurfaceCreateInfoMVK& operator=(const safe_VkIOSSurfaceCreateInfoMVK& src);
+    safe_VkIOSSurfaceCreateInfoMVK(safe_VkIOSSurfaceCreateInfoMVK&& src) noexcept;
+    safe_VkIOSSurfaceCreateInfoMVK& operator=(safe_VkIOSSurfaceCreateInfoMVK&& src) noexcept;
     safe_VkIOSSurfaceCreateInfoMVK();
     ~safe_VkIOSSurfaceCreateInfoMVK();
     void initialize(const VkIOSSurfaceCreateInfoMVK* in_struct);
@@ -4266,6 +4748,8 @@ struct safe_VkMacOSSurfaceCreateInfoMVK {
     safe_VkMacOSSurfaceCreateInfoMVK(const VkMacOSSurfaceCreateInfoMVK* in_struct);
     safe_VkMacOSSurfaceCreateInfoMVK(const safe_VkMacOSSurfaceCreateInfoMVK& src);
     safe_VkMacOSSurfaceCreateInfoMVK& operator=(const safe_VkMacOSSurfaceCreateInfoMVK& src);
+    safe_VkMacOSSurfaceCreateInfoMVK(safe_VkMacOSSurfaceCreateInfoMVK&& src) noexcept;
+    safe_VkMacOSSurfaceCreateInfoMVK& operator=(safe_VkMacOSSurfaceCreateInfoMVK&& src) noexcept;
     safe_VkMacOSSurfaceCreateInfoMVK();
     ~safe_VkMacOSSurfaceCreateInfoMVK();
     void initialize(const VkMacOSSurfaceCreateInfoMVK* in_struct);
@@ -4284,6 +4768,8 @@ struct safe_VkDebugUtilsObjectNameInfoEXT {
     safe_VkDebugUtilsObjectNameInfoEXT(const VkDebugUtilsObjectNameInfoEXT* in_struct);
     safe_VkDebugUtilsObjectNameInfoEXT(const safe_VkDebugUtilsObjectNameInfoEXT& src);
     safe_VkDebugUtilsObjectNameInfoEXT& operator=(const safe_VkDebugUtilsObjectNameInfoEXT& src);
+    safe_VkDebugUtilsObjectNameInfoEXT(safe_VkDebugUtilsObjectNameInfoEXT&& src) noexcept;
+    safe_VkDebugUtilsObjectNameInfoEXT& operator=(safe_VkDebugUtilsObjectNameInfoEXT&& src) noexcept;
     safe_VkDebugUtilsObjectNameInfoEXT();
     ~safe_VkDebugUtilsObjectNameInfoEXT();
     void initialize(const VkDebugUtilsObjectNameInfoEXT* in_struct);
@@ -4303,6 +4789,8 @@ struct safe_VkDebugUtilsObjectTagInfoEXT {
     safe_VkDebugUtilsObjectTagInfoEXT(const VkDebugUtilsObjectTagInfoEXT* in_struct);
     safe_VkDebugUtilsObjectTagInfoEXT(const safe_VkDebugUtilsObjectTagInfoEXT& src);
     safe_VkDebugUtilsObjectTagInfoEXT& operator=(const safe_VkDebugUtilsObjectTagInfoEXT& src);
+    safe_VkDebugUtilsObjectTagInfoEXT(safe_VkDebugUtilsObjectTagInfoEXT&& src) noexcept;
+    safe_VkDebugUtilsObjectTagInfoEXT& operator=(safe_VkDebugUtilsObjectTagInfoEXT&& src) noexcept;
     safe_VkDebugUtilsObjectTagInfoEXT();
     ~safe_VkDebugUtilsObjectTagInfoEXT();
     void initialize(const VkDebugUtilsObjectTagInfoEXT* in_struct);
@@ -4319,6 +4807,8 @@ struct safe_VkDebugUtilsLabelEXT {
     safe_VkDebugUtilsLabelEXT(const VkDebugUtilsLabelEXT* in_struct);
     safe_VkDebugUtilsLabelEXT(const safe_VkDebugUtilsLabelEXT& src);
     safe_VkDebugUtilsLabelEXT& operator=(const safe_VkDebugUtilsLabelEXT& src);
+    safe_VkDebugUtilsLabelEXT(safe_VkDebugUtilsLabelEXT&& src) noexcept;
+    safe_VkDebugUtilsLabelEXT& operator=(safe_VkDebugUtilsLabelEXT&& src) noexcept;
     safe_VkDebugUtilsLabelEXT();
     ~safe_VkDebugUtilsLabelEXT();
     void initialize(const VkDebugUtilsLabelEXT* in_struct);
@@ -4343,6 +4833,8 @@ struct safe_VkDebugUtilsMessengerCallbackDataEXT {
     safe_VkDebugUtilsMessengerCallbackDataEXT(const VkDebugUtilsMessengerCallbackDataEXT* in_struct);
     safe_VkDebugUtilsMessengerCallbackDataEXT(const safe_VkDebugUtilsMessengerCallbackDataEXT& src);
     safe_VkDebugUtilsMessengerCallbackDataEXT& operator=(const safe_VkDebugUtilsMessengerCallbackDataEXT& src);
+    safe_VkDebugUtilsMessengerCallbackDataEXT(safe_VkDebugUtilsMessengerCallbackDataEXT&& src) noexcept;
+    safe_VkDebugUtilsMessengerCallbackDataEXT& operator=(safe_VkDebugUtilsMessengerCallbackDataEXT&& src) noexcept;
     safe_VkDebugUtilsMessengerCallbackDataEXT();
     ~safe_VkDebugUtilsMessengerCallbackDataEXT();
     void initialize(const VkDebugUtilsMessengerCallbackDataEXT* in_struct);
@@ -4362,6 +4854,8 @@ struct safe_VkDebugUtilsMessengerCreateInfoEXT {
     safe_VkDebugUtilsMessengerCreateInfoEXT(const VkDebugUtilsMessengerCreateInfoEXT* in_struct);
     safe_VkDebugUtilsMessengerCreateInfoEXT(const safe_VkDebugUtilsMessengerCreateInfoEXT& src);
     safe_VkDebugUtilsMessengerCreateInfoEXT& operator=(const safe_VkDebugUtilsMessengerCreateInfoEXT& src);
+    safe_VkDebugUtilsMessengerCreateInfoEXT(safe_VkDebugUtilsMessengerCreateInfoEXT&& src) noexcept;
+    safe_VkDebugUtilsMessengerCreateInfoEXT& operator=(safe_VkDebugUtilsMessengerCreateInfoEXT&& src) noexcept;
     safe_VkDebugUtilsMessengerCreateInfoEXT();
     ~safe_VkDebugUtilsMessengerCreateInfoEXT();
     void initialize(const VkDebugUtilsMessengerCreateInfoEXT* in_struct);
@@ -4378,6 +4872,8 @@ struct safe_VkAndroidHardwareBufferUsageANDROID {
     safe_VkAndroidHardwareBufferUsageANDROID(const VkAndroidHardwareBufferUsageANDROID* in_struct);
     safe_VkAndroidHardwareBufferUsageANDROID(const safe_VkAndroidHardwareBufferUsageANDROID& src);
     safe_VkAndroidHardwareBufferUsageANDROID& operator=(const safe_VkAndroidHardwareBufferUsageANDROID& src);
+    safe_VkAndroidHardwareBufferUsageANDROID(safe_VkAndroidHardwareBufferUsageANDROID&& src) noexcept;
+    safe_VkAndroidHardwareBufferUsageANDROID& operator=(safe_VkAndroidHardwareBufferUsageANDROID&& src) noexcept;
     safe_VkAndroidHardwareBufferUsageANDROID();
     ~safe_VkAndroidHardwareBufferUsageANDROID();
     void initialize(const VkAndroidHardwareBufferUsageANDROID* in_struct);
@@ -4396,6 +4892,8 @@ struct safe_VkAndroidHardwareBufferPropertiesANDROID {
     safe_VkAndroidHardwareBufferPropertiesANDROID(const VkAndroidHardwareBufferPropertiesANDROID* in_struct);
     safe_VkAndroidHardwareBufferPropertiesANDROID(const safe_VkAndroidHardwareBufferPropertiesANDROID& src);
     safe_VkAndroidHardwareBufferPropertiesANDROID& operator=(const safe_VkAndroidHardwareBufferPropertiesANDROID& src);
+    safe_VkAndroidHardwareBufferPropertiesANDROID(safe_VkAndroidHardwareBufferPropertiesANDROID&& src) noexcept;
+    safe_VkAndroidHardwareBufferPropertiesANDROID& operator=(safe_VkAndroidHardwareBufferPropertiesANDROID&& src) noexcept;
     safe_VkAndroidHardwareBufferPropertiesANDROID();
     ~safe_VkAndroidHardwareBufferPropertiesANDROID();
     void initialize(const VkAndroidHardwareBufferPropertiesANDROID* in_struct);
@@ -4420,6 +4918,8 @@ struct safe_VkAndroidHardwareBufferFormatPropertiesANDROID {
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID(const VkAndroidHardwareBufferFormatPropertiesANDROID* in_struct);
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID(const safe_VkAndroidHardwareBufferFormatPropertiesANDROID& src);
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID& operator=(const safe_VkAndroidHardwareBufferFormatPropertiesANDROID& src);
+    safe_VkAndroidHardwareBufferFormatPropertiesANDROID(safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& src) noexcept;
+    safe_VkAndroidHardwareBufferFormatPropertiesANDROID& operator=(safe_VkAndroidHardwareBufferFormatPropertiesANDROID&& src) noexcept;
     safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
     ~safe_VkAndroidHardwareBufferFormatPropertiesANDROID();
     void initialize(const VkAndroidHardwareBufferFormatPropertiesANDROID* in_struct);
@@ -4437,6 +4937,8 @@ struct safe_VkImportAndroidHardwareBufferInfoANDROID {
     safe_VkImportAndroidHardwareBufferInfoANDROID(const VkImportAndroidHardwareBufferInfoANDROID* in_struct);
     safe_VkImportAndroidHardwareBufferInfoANDROID(const safe_VkImportAndroidHardwareBufferInfoANDROID& src);
     safe_VkImportAndroidHardwareBufferInfoANDROID& operator=(const safe_VkImportAndroidHardwareBufferInfoANDROID& src);
+    safe_VkImportAndroidHardwareBufferInfoANDROID(safe_VkImportAndroidHardwareBufferInfoANDROID&& src) noexcept;
+    safe_VkImportAndroidHardwareBufferInfoANDROID& operator=(safe_VkImportAndroidHardwareBufferInfoANDROID&& src) noexcept;
     safe_VkImportAndroidHardwareBufferInfoANDROID();
     ~safe_VkImportAndroidHardwareBufferInfoANDROID();
     void initialize(const VkImportAndroidHardwareBufferInfoANDROID* in_struct);
@@ -4454,6 +4956,8 @@ struct safe_VkMemoryGetAndroidHardwareBufferInfoANDROID {
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(const VkMemoryGetAndroidHardwareBufferInfoANDROID* in_struct);
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(const safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& src);
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& operator=(const safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& src);
+    safe_VkMemoryGetAndroidHardwareBufferInfoANDROID(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& src) noexcept;
+    safe_VkMemoryGetAndroidHardwareBufferInfoANDROID& operator=(safe_VkMemoryGetAndroidHardwareBufferInfoANDROID&& src) noexcept;
     safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
     ~safe_VkMemoryGetAndroidHardwareBufferInfoANDROID();
     void initialize(const VkMemoryGetAndroidHardwareBufferInfoANDROID* in_struct);
@@ -4471,6 +4975,8 @@ struct safe_VkExternalFormatANDROID {
     safe_VkExternalFormatANDROID(const VkExternalFormatANDROID* in_struct);
     safe_VkExternalFormatANDROID(const safe_VkExternalFormatANDROID& src);
     safe_VkExternalFormatANDROID& operator=(const safe_VkExternalFormatANDROID& src);
+    safe_VkExternalFormatANDROID(safe_VkExternalFormatANDROID&& src) noexcept;
+    safe_VkExternalFormatANDROID& operator=(safe_VkExternalFormatANDROID&& src) noexcept;
     safe_VkExternalFormatANDROID();
     ~safe_VkExternalFormatANDROID();
     void initialize(const VkExternalFormatANDROID* in_struct);
@@ -4487,6 +4993,8 @@ struct safe_VkSamplerReductionModeCreateInfoEXT {
     safe_VkSamplerReductionModeCreateInfoEXT(const VkSamplerReductionModeCreateInfoEXT* in_struct);
     safe_VkSamplerReductionModeCreateInfoEXT(const safe_VkSamplerReductionModeCreateInfoEXT& src);
     safe_VkSamplerReductionModeCreateInfoEXT& operator=(const safe_VkSamplerReductionModeCreateInfoEXT& src);
+    safe_VkSamplerReductionModeCreateInfoEXT(safe_VkSamplerReductionModeCreateInfoEXT&& src) noexcept;
+    safe_VkSamplerReductionModeCreateInfoEXT& operator=(safe_VkSamplerReductionModeCreateInfoEXT&& src) noexcept;
     safe_VkSamplerReductionModeCreateInfoEXT();
     ~safe_VkSamplerReductionModeCreateInfoEXT();
     void initialize(const VkSamplerReductionModeCreateInfoEXT* in_struct);
@@ -4503,6 +5011,8 @@ struct safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT {
     safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(const VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(const safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT& src);
     safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT& operator=(const safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT& src);
+    safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT& operator=(safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT();
     ~safe_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT();
     void initialize(const VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT* in_struct);
@@ -4519,6 +5029,8 @@ struct safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT {
     safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT(const VkPhysicalDeviceInlineUniformBlockFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT(const safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& src);
     safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& operator=(const safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& src);
+    safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT(safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& operator=(safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT();
     ~safe_VkPhysicalDeviceInlineUniformBlockFeaturesEXT();
     void initialize(const VkPhysicalDeviceInlineUniformBlockFeaturesEXT* in_struct);
@@ -4538,6 +5050,8 @@ struct safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT {
     safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT(const VkPhysicalDeviceInlineUniformBlockPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT(const safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& src);
     safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& operator=(const safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& src);
+    safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT(safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& operator=(safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT();
     ~safe_VkPhysicalDeviceInlineUniformBlockPropertiesEXT();
     void initialize(const VkPhysicalDeviceInlineUniformBlockPropertiesEXT* in_struct);
@@ -4554,6 +5068,8 @@ struct safe_VkWriteDescriptorSetInlineUniformBlockEXT {
     safe_VkWriteDescriptorSetInlineUniformBlockEXT(const VkWriteDescriptorSetInlineUniformBlockEXT* in_struct);
     safe_VkWriteDescriptorSetInlineUniformBlockEXT(const safe_VkWriteDescriptorSetInlineUniformBlockEXT& src);
     safe_VkWriteDescriptorSetInlineUniformBlockEXT& operator=(const safe_VkWriteDescriptorSetInlineUniformBlockEXT& src);
+    safe_VkWriteDescriptorSetInlineUniformBlockEXT(safe_VkWriteDescriptorSetInlineUniformBlockEXT&& src) noexcept;
+    safe_VkWriteDescriptorSetInlineUniformBlockEXT& operator=(safe_VkWriteDescriptorSetInlineUniformBlockEXT&& src) noexcept;
     safe_VkWriteDescriptorSetInlineUniformBlockEXT();
     ~safe_VkWriteDescriptorSetInlineUniformBlockEXT();
     void initialize(const VkWriteDescriptorSetInlineUniformBlockEXT* in_struct);
@@ -4569,6 +5085,8 @@ struct safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT {
     safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT(const VkDescriptorPoolInlineUniformBlockCreateInfoEXT* in_struct);
     safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT(const safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& src);
     safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& operator=(const safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& src);
+    safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT(safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT&& src) noexcept;
+    safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& operator=(safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT&& src) noexcept;
     safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT();
     ~safe_VkDescriptorPoolInlineUniformBlockCreateInfoEXT();
     void initialize(const VkDescriptorPoolInlineUniformBlockCreateInfoEXT* in_struct);
@@ -4587,6 +5105,8 @@ struct safe_VkSampleLocationsInfoEXT {
     safe_VkSampleLocationsInfoEXT(const VkSampleLocationsInfoEXT* in_struct);
     safe_VkSampleLocationsInfoEXT(const safe_VkSampleLocationsInfoEXT& src);
     safe_VkSampleLocationsInfoEXT& operator=(const safe_VkSampleLocationsInfoEXT& src);
+    safe_VkSampleLocationsInfoEXT(safe_VkSampleLocationsInfoEXT&& src) noexcept;
+    safe_VkSampleLocationsInfoEXT& operator=(safe_VkSampleLocationsInfoEXT&& src) noexcept;
     safe_VkSampleLocationsInfoEXT();
     ~safe_VkSampleLocationsInfoEXT();
     void initialize(const VkSampleLocationsInfoEXT* in_struct);
@@ -4605,6 +5125,8 @@ struct safe_VkRenderPassSampleLocationsBeginInfoEXT {
     safe_VkRenderPassSampleLocationsBeginInfoEXT(const VkRenderPassSampleLocationsBeginInfoEXT* in_struct);
     safe_VkRenderPassSampleLocationsBeginInfoEXT(const safe_VkRenderPassSampleLocationsBeginInfoEXT& src);
     safe_VkRenderPassSampleLocationsBeginInfoEXT& operator=(const safe_VkRenderPassSampleLocationsBeginInfoEXT& src);
+    safe_VkRenderPassSampleLocationsBeginInfoEXT(safe_VkRenderPassSampleLocationsBeginInfoEXT&& src) noexcept;
+    safe_VkRenderPassSampleLocationsBeginInfoEXT& operator=(safe_VkRenderPassSampleLocationsBeginInfoEXT&& src) noexcept;
     safe_VkRenderPassSampleLocationsBeginInfoEXT();
     ~safe_VkRenderPassSampleLocationsBeginInfoEXT();
     void initialize(const VkRenderPassSampleLocationsBeginInfoEXT* in_struct);
@@ -4621,6 +5143,8 @@ struct safe_VkPipelineSampleLocationsStateCreateInfoEXT {
     safe_VkPipelineSampleLocationsStateCreateInfoEXT(const VkPipelineSampleLocationsStateCreateInfoEXT* in_struct);
     safe_VkPipelineSampleLocationsStateCreateInfoEXT(const safe_VkPipelineSampleLocationsStateCreateInfoEXT& src);
     safe_VkPipelineSampleLocationsStateCreateInfoEXT& operator=(const safe_VkPipelineSampleLocationsStateCreateInfoEXT& src);
+    safe_VkPipelineSampleLocationsStateCreateInfoEXT(safe_VkPipelineSampleLocationsStateCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineSampleLocationsStateCreateInfoEXT& operator=(safe_VkPipelineSampleLocationsStateCreateInfoEXT&& src) noexcept;
     safe_VkPipelineSampleLocationsStateCreateInfoEXT();
     ~safe_VkPipelineSampleLocationsStateCreateInfoEXT();
     void initialize(const VkPipelineSampleLocationsStateCreateInfoEXT* in_struct);
@@ -4640,6 +5164,8 @@ struct safe_VkPhysicalDeviceSampleLocationsPropertiesEXT {
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(const VkPhysicalDeviceSampleLocationsPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(const safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& src);
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& operator=(const safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& src);
+    safe_VkPhysicalDeviceSampleLocationsPropertiesEXT(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceSampleLocationsPropertiesEXT& operator=(safe_VkPhysicalDeviceSampleLocationsPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
     ~safe_VkPhysicalDeviceSampleLocationsPropertiesEXT();
     void initialize(const VkPhysicalDeviceSampleLocationsPropertiesEXT* in_struct);
@@ -4655,6 +5181,8 @@ struct safe_VkMultisamplePropertiesEXT {
     safe_VkMultisamplePropertiesEXT(const VkMultisamplePropertiesEXT* in_struct);
     safe_VkMultisamplePropertiesEXT(const safe_VkMultisamplePropertiesEXT& src);
     safe_VkMultisamplePropertiesEXT& operator=(const safe_VkMultisamplePropertiesEXT& src);
+    safe_VkMultisamplePropertiesEXT(safe_VkMultisamplePropertiesEXT&& src) noexcept;
+    safe_VkMultisamplePropertiesEXT& operator=(safe_VkMultisamplePropertiesEXT&& src) noexcept;
     safe_VkMultisamplePropertiesEXT();
     ~safe_VkMultisamplePropertiesEXT();
     void initialize(const VkMultisamplePropertiesEXT* in_struct);
@@ -4670,6 +5198,8 @@ struct safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT {
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(const safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& src);
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& operator=(const safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& src);
+    safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& operator=(safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
     ~safe_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT();
     void initialize(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* in_struct);
@@ -4690,6 +5220,8 @@ struct safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT {
     safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(const safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& src);
     safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& operator=(const safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& src);
+    safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& operator=(safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
     ~safe_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT();
     void initialize(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* in_struct);
@@ -4707,6 +5239,8 @@ struct safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT {
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(const VkPipelineColorBlendAdvancedStateCreateInfoEXT* in_struct);
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(const safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& src);
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& operator=(const safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& src);
+    safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT& operator=(safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT&& src) noexcept;
     safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
     ~safe_VkPipelineColorBlendAdvancedStateCreateInfoEXT();
     void initialize(const VkPipelineColorBlendAdvancedStateCreateInfoEXT* in_struct);
@@ -4724,6 +5258,8 @@ struct safe_VkPipelineCoverageToColorStateCreateInfoNV {
     safe_VkPipelineCoverageToColorStateCreateInfoNV(const VkPipelineCoverageToColorStateCreateInfoNV* in_struct);
     safe_VkPipelineCoverageToColorStateCreateInfoNV(const safe_VkPipelineCoverageToColorStateCreateInfoNV& src);
     safe_VkPipelineCoverageToColorStateCreateInfoNV& operator=(const safe_VkPipelineCoverageToColorStateCreateInfoNV& src);
+    safe_VkPipelineCoverageToColorStateCreateInfoNV(safe_VkPipelineCoverageToColorStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineCoverageToColorStateCreateInfoNV& operator=(safe_VkPipelineCoverageToColorStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineCoverageToColorStateCreateInfoNV();
     ~safe_VkPipelineCoverageToColorStateCreateInfoNV();
     void initialize(const VkPipelineCoverageToColorStateCreateInfoNV* in_struct);
@@ -4743,6 +5279,8 @@ struct safe_VkPipelineCoverageModulationStateCreateInfoNV {
     safe_VkPipelineCoverageModulationStateCreateInfoNV(const VkPipelineCoverageModulationStateCreateInfoNV* in_struct);
     safe_VkPipelineCoverageModulationStateCreateInfoNV(const safe_VkPipelineCoverageModulationStateCreateInfoNV& src);
     safe_VkPipelineCoverageModulationStateCreateInfoNV& operator=(const safe_VkPipelineCoverageModulationStateCreateInfoNV& src);
+    safe_VkPipelineCoverageModulationStateCreateInfoNV(safe_VkPipelineCoverageModulationStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineCoverageModulationStateCreateInfoNV& operator=(safe_VkPipelineCoverageModulationStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineCoverageModulationStateCreateInfoNV();
     ~safe_VkPipelineCoverageModulationStateCreateInfoNV();
     void initialize(const VkPipelineCoverageModulationStateCreateInfoNV* in_struct);
@@ -4759,6 +5297,8 @@ struct safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV {
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV* in_struct);
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(const safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& src);
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& operator=(const safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& src);
+    safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& src) noexcept;
+    safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& operator=(safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV&& src) noexcept;
     safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
     ~safe_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV();
     void initialize(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV* in_struct);
@@ -4774,6 +5314,8 @@ struct safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV {
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* in_struct);
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(const safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& src);
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& operator=(const safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& src);
+    safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& operator=(safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
     ~safe_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV();
     void initialize(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV* in_struct);
@@ -4790,6 +5332,8 @@ struct safe_VkDrmFormatModifierPropertiesListEXT {
     safe_VkDrmFormatModifierPropertiesListEXT(const VkDrmFormatModifierPropertiesListEXT* in_struct);
     safe_VkDrmFormatModifierPropertiesListEXT(const safe_VkDrmFormatModifierPropertiesListEXT& src);
     safe_VkDrmFormatModifierPropertiesListEXT& operator=(const safe_VkDrmFormatModifierPropertiesListEXT& src);
+    safe_VkDrmFormatModifierPropertiesListEXT(safe_VkDrmFormatModifierPropertiesListEXT&& src) noexcept;
+    safe_VkDrmFormatModifierPropertiesListEXT& operator=(safe_VkDrmFormatModifierPropertiesListEXT&& src) noexcept;
     safe_VkDrmFormatModifierPropertiesListEXT();
     ~safe_VkDrmFormatModifierPropertiesListEXT();
     void initialize(const VkDrmFormatModifierPropertiesListEXT* in_struct);
@@ -4808,6 +5352,8 @@ struct safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT {
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT* in_struct);
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(const safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& src);
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& operator=(const safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& src);
+    safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& src) noexcept;
+    safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& operator=(safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT&& src) noexcept;
     safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
     ~safe_VkPhysicalDeviceImageDrmFormatModifierInfoEXT();
     void initialize(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT* in_struct);
@@ -4824,6 +5370,8 @@ struct safe_VkImageDrmFormatModifierListCreateInfoEXT {
     safe_VkImageDrmFormatModifierListCreateInfoEXT(const VkImageDrmFormatModifierListCreateInfoEXT* in_struct);
     safe_VkImageDrmFormatModifierListCreateInfoEXT(const safe_VkImageDrmFormatModifierListCreateInfoEXT& src);
     safe_VkImageDrmFormatModifierListCreateInfoEXT& operator=(const safe_VkImageDrmFormatModifierListCreateInfoEXT& src);
+    safe_VkImageDrmFormatModifierListCreateInfoEXT(safe_VkImageDrmFormatModifierListCreateInfoEXT&& src) noexcept;
+    safe_VkImageDrmFormatModifierListCreateInfoEXT& operator=(safe_VkImageDrmFormatModifierListCreateInfoEXT&& src) noexcept;
     safe_VkImageDrmFormatModifierListCreateInfoEXT();
     ~safe_VkImageDrmFormatModifierListCreateInfoEXT();
     void initialize(const VkImageDrmFormatModifierListCreateInfoEXT* in_struct);
@@ -4841,6 +5389,8 @@ struct safe_VkImageDrmFormatModifierExplicitCreateInfoEXT {
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(const VkImageDrmFormatModifierExplicitCreateInfoEXT* in_struct);
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(const safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& src);
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& operator=(const safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& src);
+    safe_VkImageDrmFormatModifierExplicitCreateInfoEXT(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& src) noexcept;
+    safe_VkImageDrmFormatModifierExplicitCreateInfoEXT& operator=(safe_VkImageDrmFormatModifierExplicitCreateInfoEXT&& src) noexcept;
     safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
     ~safe_VkImageDrmFormatModifierExplicitCreateInfoEXT();
     void initialize(const VkImageDrmFormatModifierExplicitCreateInfoEXT* in_struct);
@@ -4856,6 +5406,8 @@ struct safe_VkImageDrmFormatModifierPropertiesEXT {
     safe_VkImageDrmFormatModifierPropertiesEXT(const VkImageDrmFormatModifierPropertiesEXT* in_struct);
     safe_VkImageDrmFormatModifierPropertiesEXT(const safe_VkImageDrmFormatModifierPropertiesEXT& src);
     safe_VkImageDrmFormatModifierPropertiesEXT& operator=(const safe_VkImageDrmFormatModifierPropertiesEXT& src);
+    safe_VkImageDrmFormatModifierPropertiesEXT(safe_VkImageDrmFormatModifierPropertiesEXT&& src) noexcept;
+    safe_VkImageDrmFormatModifierPropertiesEXT& operator=(safe_VkImageDrmFormatModifierPropertiesEXT&& src) noexcept;
     safe_VkImageDrmFormatModifierPropertiesEXT();
     ~safe_VkImageDrmFormatModifierPropertiesEXT();
     void initialize(const VkImageDrmFormatModifierPropertiesEXT* in_struct);
@@ -4873,6 +5425,8 @@ struct safe_VkValidationCacheCreateInfoEXT {
     safe_VkValidationCacheCreateInfoEXT(const VkValidationCacheCreateInfoEXT* in_struct);
     safe_VkValidationCacheCreateInfoEXT(const safe_VkValidationCacheCreateInfoEXT& src);
     safe_VkValidationCacheCreateInfoEXT& operator=(const safe_VkValidationCacheCreateInfoEXT& src);
+    safe_VkValidationCacheCreateInfoEXT(safe_VkValidationCacheCreateInfoEXT&& src) noexcept;
+    safe_VkValidationCacheCreateInfoEXT& operator=(safe_VkValidationCacheCreateInfoEXT&& src) noexcept;
     safe_VkValidationCacheCreateInfoEXT();
     ~safe_VkValidationCacheCreateInfoEXT();
     void initialize(const VkValidationCacheCreateInfoEXT* in_struct);
@@ -4888,6 +5442,8 @@ struct safe_VkShaderModuleValidationCacheCreateInfoEXT {
     safe_VkShaderModuleValidationCacheCreateInfoEXT(const VkShaderModuleValidationCacheCreateInfoEXT* in_struct);
     safe_VkShaderModuleValidationCacheCreateInfoEXT(const safe_VkShaderModuleValidationCacheCreateInfoEXT& src);
     safe_VkShaderModuleValidationCacheCreateInfoEXT& operator=(const safe_VkShaderModuleValidationCacheCreateInfoEXT& src);
+    safe_VkShaderModuleValidationCacheCreateInfoEXT(safe_VkShaderModuleValidationCacheCreateInfoEXT&& src) noexcept;
+    safe_VkShaderModuleValidationCacheCreateInfoEXT& operator=(safe_VkShaderModuleValidationCacheCreateInfoEXT&& src) noexcept;
     safe_VkShaderModuleValidationCacheCreateInfoEXT();
     ~safe_VkShaderModuleValidationCacheCreateInfoEXT();
     void initialize(const VkShaderModuleValidationCacheCreateInfoEXT* in_struct);
@@ -4904,6 +5460,8 @@ struct safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT {
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT* in_struct);
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(const safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT& src);
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT& operator=(const safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT& src);
+    safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT&& src) noexcept;
+    safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT& operator=(safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT&& src) noexcept;
     safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT();
     ~safe_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT();
     void initialize(const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT* in_struct);
@@ -4938,6 +5496,8 @@ struct safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT {
     safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(const VkPhysicalDeviceDescriptorIndexingFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(const safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT& src);
     safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT& operator=(const safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT& src);
+    safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT& operator=(safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT();
     ~safe_VkPhysicalDeviceDescriptorIndexingFeaturesEXT();
     void initialize(const VkPhysicalDeviceDescriptorIndexingFeaturesEXT* in_struct);
@@ -4975,6 +5535,8 @@ struct safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT {
     safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(const VkPhysicalDeviceDescriptorIndexingPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(const safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT& src);
     safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT& operator=(const safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT& src);
+    safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT& operator=(safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT();
     ~safe_VkPhysicalDeviceDescriptorIndexingPropertiesEXT();
     void initialize(const VkPhysicalDeviceDescriptorIndexingPropertiesEXT* in_struct);
@@ -4991,6 +5553,8 @@ struct safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT {
     safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT* in_struct);
     safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(const safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT& src);
     safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT& operator=(const safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT& src);
+    safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT&& src) noexcept;
+    safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT& operator=(safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT&& src) noexcept;
     safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT();
     ~safe_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT();
     void initialize(const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT* in_struct);
@@ -5006,6 +5570,8 @@ struct safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT {
     safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(const VkDescriptorSetVariableDescriptorCountLayoutSupportEXT* in_struct);
     safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(const safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT& src);
     safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT& operator=(const safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT& src);
+    safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT&& src) noexcept;
+    safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT& operator=(safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT&& src) noexcept;
     safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT();
     ~safe_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT();
     void initialize(const VkDescriptorSetVariableDescriptorCountLayoutSupportEXT* in_struct);
@@ -5020,6 +5586,8 @@ struct safe_VkShadingRatePaletteNV {
     safe_VkShadingRatePaletteNV(const VkShadingRatePaletteNV* in_struct);
     safe_VkShadingRatePaletteNV(const safe_VkShadingRatePaletteNV& src);
     safe_VkShadingRatePaletteNV& operator=(const safe_VkShadingRatePaletteNV& src);
+    safe_VkShadingRatePaletteNV(safe_VkShadingRatePaletteNV&& src) noexcept;
+    safe_VkShadingRatePaletteNV& operator=(safe_VkShadingRatePaletteNV&& src) noexcept;
     safe_VkShadingRatePaletteNV();
     ~safe_VkShadingRatePaletteNV();
     void initialize(const VkShadingRatePaletteNV* in_struct);
@@ -5037,6 +5605,8 @@ struct safe_VkPipelineViewportShadingRateImageStateCreateInfoNV {
     safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(const VkPipelineViewportShadingRateImageStateCreateInfoNV* in_struct);
     safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(const safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& src);
     safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& operator=(const safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& src);
+    safe_VkPipelineViewportShadingRateImageStateCreateInfoNV(safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineViewportShadingRateImageStateCreateInfoNV& operator=(safe_VkPipelineViewportShadingRateImageStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
     ~safe_VkPipelineViewportShadingRateImageStateCreateInfoNV();
     void initialize(const VkPipelineViewportShadingRateImageStateCreateInfoNV* in_struct);
@@ -5053,6 +5623,8 @@ struct safe_VkPhysicalDeviceShadingRateImageFeaturesNV {
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV(const VkPhysicalDeviceShadingRateImageFeaturesNV* in_struct);
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV(const safe_VkPhysicalDeviceShadingRateImageFeaturesNV& src);
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV& operator=(const safe_VkPhysicalDeviceShadingRateImageFeaturesNV& src);
+    safe_VkPhysicalDeviceShadingRateImageFeaturesNV(safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceShadingRateImageFeaturesNV& operator=(safe_VkPhysicalDeviceShadingRateImageFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
     ~safe_VkPhysicalDeviceShadingRateImageFeaturesNV();
     void initialize(const VkPhysicalDeviceShadingRateImageFeaturesNV* in_struct);
@@ -5070,6 +5642,8 @@ struct safe_VkPhysicalDeviceShadingRateImagePropertiesNV {
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV(const VkPhysicalDeviceShadingRateImagePropertiesNV* in_struct);
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV(const safe_VkPhysicalDeviceShadingRateImagePropertiesNV& src);
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV& operator=(const safe_VkPhysicalDeviceShadingRateImagePropertiesNV& src);
+    safe_VkPhysicalDeviceShadingRateImagePropertiesNV(safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& src) noexcept;
+    safe_VkPhysicalDeviceShadingRateImagePropertiesNV& operator=(safe_VkPhysicalDeviceShadingRateImagePropertiesNV&& src) noexcept;
     safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
     ~safe_VkPhysicalDeviceShadingRateImagePropertiesNV();
     void initialize(const VkPhysicalDeviceShadingRateImagePropertiesNV* in_struct);
@@ -5086,6 +5660,8 @@ struct safe_VkCoarseSampleOrderCustomNV {
     safe_VkCoarseSampleOrderCustomNV(const VkCoarseSampleOrderCustomNV* in_struct);
     safe_VkCoarseSampleOrderCustomNV(const safe_VkCoarseSampleOrderCustomNV& src);
     safe_VkCoarseSampleOrderCustomNV& operator=(const safe_VkCoarseSampleOrderCustomNV& src);
+    safe_VkCoarseSampleOrderCustomNV(safe_VkCoarseSampleOrderCustomNV&& src) noexcept;
+    safe_VkCoarseSampleOrderCustomNV& operator=(safe_VkCoarseSampleOrderCustomNV&& src) noexcept;
     safe_VkCoarseSampleOrderCustomNV();
     ~safe_VkCoarseSampleOrderCustomNV();
     void initialize(const VkCoarseSampleOrderCustomNV* in_struct);
@@ -5103,6 +5679,8 @@ struct safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV {
     safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* in_struct);
     safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(const safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& src);
     safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& operator=(const safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& src);
+    safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV(safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& operator=(safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
     ~safe_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV();
     void initialize(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV* in_struct);
@@ -5122,6 +5700,8 @@ struct safe_VkRayTracingShaderGroupCreateInfoNV {
     safe_VkRayTracingShaderGroupCreateInfoNV(const VkRayTracingShaderGroupCreateInfoNV* in_struct);
     safe_VkRayTracingShaderGroupCreateInfoNV(const safe_VkRayTracingShaderGroupCreateInfoNV& src);
     safe_VkRayTracingShaderGroupCreateInfoNV& operator=(const safe_VkRayTracingShaderGroupCreateInfoNV& src);
+    safe_VkRayTracingShaderGroupCreateInfoNV(safe_VkRayTracingShaderGroupCreateInfoNV&& src) noexcept;
+    safe_VkRayTracingShaderGroupCreateInfoNV& operator=(safe_VkRayTracingShaderGroupCreateInfoNV&& src) noexcept;
     safe_VkRayTracingShaderGroupCreateInfoNV();
     ~safe_VkRayTracingShaderGroupCreateInfoNV();
     void initialize(const VkRayTracingShaderGroupCreateInfoNV* in_struct);
@@ -5145,6 +5725,8 @@ struct safe_VkRayTracingPipelineCreateInfoNV {
     safe_VkRayTracingPipelineCreateInfoNV(const VkRayTracingPipelineCreateInfoNV* in_struct);
     safe_VkRayTracingPipelineCreateInfoNV(const safe_VkRayTracingPipelineCreateInfoNV& src);
     safe_VkRayTracingPipelineCreateInfoNV& operator=(const safe_VkRayTracingPipelineCreateInfoNV& src);
+    safe_VkRayTracingPipelineCreateInfoNV(safe_VkRayTracingPipelineCreateInfoNV&& src) noexcept;
+    safe_VkRayTracingPipelineCreateInfoNV& operator=(safe_VkRayTracingPipelineCreateInfoNV&& src) noexcept;
     safe_VkRayTracingPipelineCreateInfoNV();
     ~safe_VkRayTracingPipelineCreateInfoNV();
     void initialize(const VkRayTracingPipelineCreateInfoNV* in_struct);
@@ -5170,6 +5752,8 @@ struct safe_VkGeometryTrianglesNV {
     safe_VkGeometryTrianglesNV(const VkGeometryTrianglesNV* in_struct);
     safe_VkGeometryTrianglesNV(const safe_VkGeometryTrianglesNV& src);
     safe_VkGeometryTrianglesNV& operator=(const safe_VkGeometryTrianglesNV& src);
+    safe_VkGeometryTrianglesNV(safe_VkGeometryTrianglesNV&& src) noexcept;
+    safe_VkGeometryTrianglesNV& operator=(safe_VkGeometryTrianglesNV&& src) noexcept;
     safe_VkGeometryTrianglesNV();
     ~safe_VkGeometryTrianglesNV();
     void initialize(const VkGeometryTrianglesNV* in_struct);
@@ -5188,6 +5772,8 @@ struct safe_VkGeometryAABBNV {
     safe_VkGeometryAABBNV(const VkGeometryAABBNV* in_struct);
     safe_VkGeometryAABBNV(const safe_VkGeometryAABBNV& src);
     safe_VkGeometryAABBNV& operator=(const safe_VkGeometryAABBNV& src);
+    safe_VkGeometryAABBNV(safe_VkGeometryAABBNV&& src) noexcept;
+    safe_VkGeometryAABBNV& operator=(safe_VkGeometryAABBNV&& src) noexcept;
     safe_VkGeometryAABBNV();
     ~safe_VkGeometryAABBNV();
     void initialize(const VkGeometryAABBNV* in_struct);
@@ -5205,6 +5791,8 @@ struct safe_VkGeometryNV {
     safe_VkGeometryNV(const VkGeometryNV* in_struct);
     safe_VkGeometryNV(const safe_VkGeometryNV& src);
     safe_VkGeometryNV& operator=(const safe_VkGeometryNV& src);
+    safe_VkGeometryNV(safe_VkGeometryNV&& src) noexcept;
+    safe_VkGeometryNV& operator=(safe_VkGeometryNV&& src) noexcept;
     safe_VkGeometryNV();
     ~safe_VkGeometryNV();
     void initialize(const VkGeometryNV* in_struct);
@@ -5224,6 +5812,8 @@ struct safe_VkAccelerationStructureInfoNV {
     safe_VkAccelerationStructureInfoNV(const VkAccelerationStructureInfoNV* in_struct);
     safe_VkAccelerationStructureInfoNV(const safe_VkAccelerationStructureInfoNV& src);
     safe_VkAccelerationStructureInfoNV& operator=(const safe_VkAccelerationStructureInfoNV& src);
+    safe_VkAccelerationStructureInfoNV(safe_VkAccelerationStructureInfoNV&& src) noexcept;
+    safe_VkAccelerationStructureInfoNV& operator=(safe_VkAccelerationStructureInfoNV&& src) noexcept;
     safe_VkAccelerationStructureInfoNV();
     ~safe_VkAccelerationStructureInfoNV();
     void initialize(const VkAccelerationStructureInfoNV* in_struct);
@@ -5240,6 +5830,8 @@ struct safe_VkAccelerationStructureCreateInfoNV {
     safe_VkAccelerationStructureCreateInfoNV(const VkAccelerationStructureCreateInfoNV* in_struct);
     safe_VkAccelerationStructureCreateInfoNV(const safe_VkAccelerationStructureCreateInfoNV& src);
     safe_VkAccelerationStructureCreateInfoNV& operator=(const safe_VkAccelerationStructureCreateInfoNV& src);
+    safe_VkAccelerationStructureCreateInfoNV(safe_VkAccelerationStructureCreateInfoNV&& src) noexcept;
+    safe_VkAccelerationStructureCreateInfoNV& operator=(safe_VkAccelerationStructureCreateInfoNV&& src) noexcept;
     safe_VkAccelerationStructureCreateInfoNV();
     ~safe_VkAccelerationStructureCreateInfoNV();
     void initialize(const VkAccelerationStructureCreateInfoNV* in_struct);
@@ -5259,6 +5851,8 @@ struct safe_VkBindAccelerationStructureMemoryInfoNV {
     safe_VkBindAccelerationStructureMemoryInfoNV(const VkBindAccelerationStructureMemoryInfoNV* in_struct);
     safe_VkBindAccelerationStructureMemoryInfoNV(const safe_VkBindAccelerationStructureMemoryInfoNV& src);
     safe_VkBindAccelerationStructureMemoryInfoNV& operator=(const safe_VkBindAccelerationStructureMemoryInfoNV& src);
+    safe_VkBindAccelerationStructureMemoryInfoNV(safe_VkBindAccelerationStructureMemoryInfoNV&& src) noexcept;
+    safe_VkBindAccelerationStructureMemoryInfoNV& operator=(safe_VkBindAccelerationStructureMemoryInfoNV&& src) noexcept;
     safe_VkBindAccelerationStructureMemoryInfoNV();
     ~safe_VkBindAccelerationStructureMemoryInfoNV();
     void initialize(const VkBindAccelerationStructureMemoryInfoNV* in_struct);
@@ -5275,6 +5869,8 @@ struct safe_VkWriteDescriptorSetAccelerationStructureNV {
     safe_VkWriteDescriptorSetAccelerationStructureNV(const VkWriteDescriptorSetAccelerationStructureNV* in_struct);
     safe_VkWriteDescriptorSetAccelerationStructureNV(const safe_VkWriteDescriptorSetAccelerationStructureNV& src);
     safe_VkWriteDescriptorSetAccelerationStructureNV& operator=(const safe_VkWriteDescriptorSetAccelerationStructureNV& src);
+    safe_VkWriteDescriptorSetAccelerationStructureNV(safe_VkWriteDescriptorSetAccelerationStructureNV&& src) noexcept;
+    safe_VkWriteDescriptorSetAccelerationStructureNV& operator=(safe_VkWriteDescriptorSetAccelerationStructureNV&& src) noexcept;
     safe_VkWriteDescriptorSetAccelerationStructureNV();
     ~safe_VkWriteDescriptorSetAccelerationStructureNV();
     void initialize(const VkWriteDescriptorSetAccelerationStructureNV* in_struct);
@@ -5291,6 +5887,8 @@ struct safe_VkAccelerationStructureMemoryRequirementsInfoNV {
     safe_VkAccelerationStructureMemoryRequirementsInfoNV(const VkAccelerationStructureMemoryRequirementsInfoNV* in_struct);
     safe_VkAccelerationStructureMemoryRequirementsInfoNV(const safe_VkAccelerationStructureMemoryRequirementsInfoNV& src);
     safe_VkAccelerationStructureMemoryRequirementsInfoNV& operator=(const safe_VkAccelerationStructureMemoryRequirementsInfoNV& src);
+    safe_VkAccelerationStructureMemoryRequirementsInfoNV(safe_VkAccelerationStructureMemoryRequirementsInfoNV&& src) noexcept;
+    safe_VkAccelerationStructureMemoryRequirementsInfoNV& operator=(safe_VkAccelerationStructureMemoryRequirementsInfoNV&& src) noexcept;
     safe_VkAccelerationStructureMemoryRequirementsInfoNV();
     ~safe_VkAccelerationStructureMemoryRequirementsInfoNV();
     void initialize(const VkAccelerationStructureMemoryRequirementsInfoNV* in_struct);
@@ -5313,6 +5911,8 @@ struct safe_VkPhysicalDeviceRayTracingPropertiesNV {
     safe_VkPhysicalDeviceRayTracingPropertiesNV(const VkPhysicalDeviceRayTracingPropertiesNV* in_struct);
     safe_VkPhysicalDeviceRayTracingPropertiesNV(const safe_VkPhysicalDeviceRayTracingPropertiesNV& src);
     safe_VkPhysicalDeviceRayTracingPropertiesNV& operator=(const safe_VkPhysicalDeviceRayTracingPropertiesNV& src);
+    safe_VkPhysicalDeviceRayTracingPropertiesNV(safe_VkPhysicalDeviceRayTracingPropertiesNV&& src) noexcept;
+    safe_VkPhysicalDeviceRayTracingPropertiesNV& operator=(safe_VkPhysicalDeviceRayTracingPropertiesNV&& src) noexcept;
     safe_VkPhysicalDeviceRayTracingPropertiesNV();
     ~safe_VkPhysicalDeviceRayTracingPropertiesNV();
     void initialize(const VkPhysicalDeviceRayTracingPropertiesNV* in_struct);
@@ -5328,6 +5928,8 @@ struct safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV {
     safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV* in_struct);
     safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(const safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& src);
     safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& operator=(const safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& src);
+    safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV(safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& operator=(safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
     ~safe_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV();
     void initialize(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV* in_struct);
@@ -5343,6 +5945,8 @@ struct safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV {
     safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV* in_struct);
     safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(const safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& src);
     safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& operator=(const safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& src);
+    safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV(safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& operator=(safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
     ~safe_VkPipelineRepresentativeFragmentTestStateCreateInfoNV();
     void initialize(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV* in_struct);
@@ -5358,6 +5962,8 @@ struct safe_VkPhysicalDeviceImageViewImageFormatInfoEXT {
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(const VkPhysicalDeviceImageViewImageFormatInfoEXT* in_struct);
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(const safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& src);
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& operator=(const safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& src);
+    safe_VkPhysicalDeviceImageViewImageFormatInfoEXT(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& src) noexcept;
+    safe_VkPhysicalDeviceImageViewImageFormatInfoEXT& operator=(safe_VkPhysicalDeviceImageViewImageFormatInfoEXT&& src) noexcept;
     safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
     ~safe_VkPhysicalDeviceImageViewImageFormatInfoEXT();
     void initialize(const VkPhysicalDeviceImageViewImageFormatInfoEXT* in_struct);
@@ -5374,6 +5980,8 @@ struct safe_VkFilterCubicImageViewImageFormatPropertiesEXT {
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT(const VkFilterCubicImageViewImageFormatPropertiesEXT* in_struct);
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT(const safe_VkFilterCubicImageViewImageFormatPropertiesEXT& src);
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT& operator=(const safe_VkFilterCubicImageViewImageFormatPropertiesEXT& src);
+    safe_VkFilterCubicImageViewImageFormatPropertiesEXT(safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& src) noexcept;
+    safe_VkFilterCubicImageViewImageFormatPropertiesEXT& operator=(safe_VkFilterCubicImageViewImageFormatPropertiesEXT&& src) noexcept;
     safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
     ~safe_VkFilterCubicImageViewImageFormatPropertiesEXT();
     void initialize(const VkFilterCubicImageViewImageFormatPropertiesEXT* in_struct);
@@ -5389,6 +5997,8 @@ struct safe_VkDeviceQueueGlobalPriorityCreateInfoEXT {
     safe_VkDeviceQueueGlobalPriorityCreateInfoEXT(const VkDeviceQueueGlobalPriorityCreateInfoEXT* in_struct);
     safe_VkDeviceQueueGlobalPriorityCreateInfoEXT(const safe_VkDeviceQueueGlobalPriorityCreateInfoEXT& src);
     safe_VkDeviceQueueGlobalPriorityCreateInfoEXT& operator=(const safe_VkDeviceQueueGlobalPriorityCreateInfoEXT& src);
+    safe_VkDeviceQueueGlobalPriorityCreateInfoEXT(safe_VkDeviceQueueGlobalPriorityCreateInfoEXT&& src) noexcept;
+    safe_VkDeviceQueueGlobalPriorityCreateInfoEXT& operator=(safe_VkDeviceQueueGlobalPriorityCreateInfoEXT&& src) noexcept;
     safe_VkDeviceQueueGlobalPriorityCreateInfoEXT();
     ~safe_VkDeviceQueueGlobalPriorityCreateInfoEXT();
     void initialize(const VkDeviceQueueGlobalPriorityCreateInfoEXT* in_struct);
@@ -5405,6 +6015,8 @@ struct safe_VkImportMemoryHostPointerInfoEXT {
     safe_VkImportMemoryHostPointerInfoEXT(const VkImportMemoryHostPointerInfoEXT* in_struct);
     safe_VkImportMemoryHostPointerInfoEXT(const safe_VkImportMemoryHostPointerInfoEXT& src);
     safe_VkImportMemoryHostPointerInfoEXT& operator=(const safe_VkImportMemoryHostPointerInfoEXT& src);
+    safe_VkImportMemoryHostPointerInfoEXT(safe_VkImportMemoryHostPointerInfoEXT&& src) noexcept;
+    safe_VkImportMemoryHostPointerInfoEXT& operator=(safe_VkImportMemoryHostPointerInfoEXT&& src) noexcept;
     safe_VkImportMemoryHostPointerInfoEXT();
     ~safe_VkImportMemoryHostPointerInfoEXT();
     void initialize(const VkImportMemoryHostPointerInfoEXT* in_struct);
@@ -5420,6 +6032,8 @@ struct safe_VkMemoryHostPointerPropertiesEXT {
     safe_VkMemoryHostPointerPropertiesEXT(const VkMemoryHostPointerPropertiesEXT* in_struct);
     safe_VkMemoryHostPointerPropertiesEXT(const safe_VkMemoryHostPointerPropertiesEXT& src);
     safe_VkMemoryHostPointerPropertiesEXT& operator=(const safe_VkMemoryHostPointerPropertiesEXT& src);
+    safe_VkMemoryHostPointerPropertiesEXT(safe_VkMemoryHostPointerPropertiesEXT&& src) noexcept;
+    safe_VkMemoryHostPointerPropertiesEXT& operator=(safe_VkMemoryHostPointerPropertiesEXT&& src) noexcept;
     safe_VkMemoryHostPointerPropertiesEXT();
     ~safe_VkMemoryHostPointerPropertiesEXT();
     void initialize(const VkMemoryHostPointerPropertiesEXT* in_struct);
@@ -5435,6 +6049,8 @@ struct safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT {
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(const safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& src);
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& operator=(const safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& src);
+    safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& operator=(safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
     ~safe_VkPhysicalDeviceExternalMemoryHostPropertiesEXT();
     void initialize(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT* in_struct);
@@ -5450,6 +6066,8 @@ struct safe_VkCalibratedTimestampInfoEXT {
     safe_VkCalibratedTimestampInfoEXT(const VkCalibratedTimestampInfoEXT* in_struct);
     safe_VkCalibratedTimestampInfoEXT(const safe_VkCalibratedTimestampInfoEXT& src);
     safe_VkCalibratedTimestampInfoEXT& operator=(const safe_VkCalibratedTimestampInfoEXT& src);
+    safe_VkCalibratedTimestampInfoEXT(safe_VkCalibratedTimestampInfoEXT&& src) noexcept;
+    safe_VkCalibratedTimestampInfoEXT& operator=(safe_VkCalibratedTimestampInfoEXT&& src) noexcept;
     safe_VkCalibratedTimestampInfoEXT();
     ~safe_VkCalibratedTimestampInfoEXT();
     void initialize(const VkCalibratedTimestampInfoEXT* in_struct);
@@ -5478,6 +6096,8 @@ struct safe_VkPhysicalDeviceShaderCorePropertiesAMD {
     safe_VkPhysicalDeviceShaderCorePropertiesAMD(const VkPhysicalDeviceShaderCorePropertiesAMD* in_struct);
     safe_VkPhysicalDeviceShaderCorePropertiesAMD(const safe_VkPhysicalDeviceShaderCorePropertiesAMD& src);
     safe_VkPhysicalDeviceShaderCorePropertiesAMD& operator=(const safe_VkPhysicalDeviceShaderCorePropertiesAMD& src);
+    safe_VkPhysicalDeviceShaderCorePropertiesAMD(safe_VkPhysicalDeviceShaderCorePropertiesAMD&& src) noexcept;
+    safe_VkPhysicalDeviceShaderCorePropertiesAMD& operator=(safe_VkPhysicalDeviceShaderCorePropertiesAMD&& src) noexcept;
     safe_VkPhysicalDeviceShaderCorePropertiesAMD();
     ~safe_VkPhysicalDeviceShaderCorePropertiesAMD();
     void initialize(const VkPhysicalDeviceShaderCorePropertiesAMD* in_struct);
@@ -5493,6 +6113,8 @@ struct safe_VkDeviceMemoryOverallocationCreateInfoAMD {
     safe_VkDeviceMemoryOverallocationCreateInfoAMD(const VkDeviceMemoryOverallocationCreateInfoAMD* in_struct);
     safe_VkDeviceMemoryOverallocationCreateInfoAMD(const safe_VkDeviceMemoryOverallocationCreateInfoAMD& src);
     safe_VkDeviceMemoryOverallocationCreateInfoAMD& operator=(const safe_VkDeviceMemoryOverallocationCreateInfoAMD& src);
+    safe_VkDeviceMemoryOverallocationCreateInfoAMD(safe_VkDeviceMemoryOverallocationCreateInfoAMD&& src) noexcept;
+    safe_VkDeviceMemoryOverallocationCreateInfoAMD& operator=(safe_VkDeviceMemoryOverallocationCreateInfoAMD&& src) noexcept;
     safe_VkDeviceMemoryOverallocationCreateInfoAMD();
     ~safe_VkDeviceMemoryOverallocationCreateInfoAMD();
     void initialize(const VkDeviceMemoryOverallocationCreateInfoAMD* in_struct);
@@ -5508,6 +6130,8 @@ struct safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT {
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(const safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& src);
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& operator=(const safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& src);
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& operator=(safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
     ~safe_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT();
     void initialize(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* in_struct);
@@ -5524,6 +6148,8 @@ struct safe_VkPipelineVertexInputDivisorStateCreateInfoEXT {
     safe_VkPipelineVertexInputDivisorStateCreateInfoEXT(const VkPipelineVertexInputDivisorStateCreateInfoEXT* in_struct);
     safe_VkPipelineVertexInputDivisorStateCreateInfoEXT(const safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& src);
     safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& operator=(const safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& src);
+    safe_VkPipelineVertexInputDivisorStateCreateInfoEXT(safe_VkPipelineVertexInputDivisorStateCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineVertexInputDivisorStateCreateInfoEXT& operator=(safe_VkPipelineVertexInputDivisorStateCreateInfoEXT&& src) noexcept;
     safe_VkPipelineVertexInputDivisorStateCreateInfoEXT();
     ~safe_VkPipelineVertexInputDivisorStateCreateInfoEXT();
     void initialize(const VkPipelineVertexInputDivisorStateCreateInfoEXT* in_struct);
@@ -5540,6 +6166,8 @@ struct safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT {
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT(const safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& src);
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& operator=(const safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& src);
+    safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT(safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& operator=(safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT();
     ~safe_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT();
     void initialize(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT* in_struct);
@@ -5556,6 +6184,8 @@ struct safe_VkPresentFrameTokenGGP {
     safe_VkPresentFrameTokenGGP(const VkPresentFrameTokenGGP* in_struct);
     safe_VkPresentFrameTokenGGP(const safe_VkPresentFrameTokenGGP& src);
     safe_VkPresentFrameTokenGGP& operator=(const safe_VkPresentFrameTokenGGP& src);
+    safe_VkPresentFrameTokenGGP(safe_VkPresentFrameTokenGGP&& src) noexcept;
+    safe_VkPresentFrameTokenGGP& operator=(safe_VkPresentFrameTokenGGP&& src) noexcept;
     safe_VkPresentFrameTokenGGP();
     ~safe_VkPresentFrameTokenGGP();
     void initialize(const VkPresentFrameTokenGGP* in_struct);
@@ -5574,6 +6204,8 @@ struct safe_VkPipelineCreationFeedbackCreateInfoEXT {
     safe_VkPipelineCreationFeedbackCreateInfoEXT(const VkPipelineCreationFeedbackCreateInfoEXT* in_struct);
     safe_VkPipelineCreationFeedbackCreateInfoEXT(const safe_VkPipelineCreationFeedbackCreateInfoEXT& src);
     safe_VkPipelineCreationFeedbackCreateInfoEXT& operator=(const safe_VkPipelineCreationFeedbackCreateInfoEXT& src);
+    safe_VkPipelineCreationFeedbackCreateInfoEXT(safe_VkPipelineCreationFeedbackCreateInfoEXT&& src) noexcept;
+    safe_VkPipelineCreationFeedbackCreateInfoEXT& operator=(safe_VkPipelineCreationFeedbackCreateInfoEXT&& src) noexcept;
     safe_VkPipelineCreationFeedbackCreateInfoEXT();
     ~safe_VkPipelineCreationFeedbackCreateInfoEXT();
     void initialize(const VkPipelineCreationFeedbackCreateInfoEXT* in_struct);
@@ -5590,6 +6222,8 @@ struct safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV {
     safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV* in_struct);
     safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(const safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& src);
     safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& operator=(const safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& src);
+    safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV(safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& operator=(safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
     ~safe_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV();
     void initialize(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV* in_struct);
@@ -5606,6 +6240,8 @@ struct safe_VkPhysicalDeviceMeshShaderFeaturesNV {
     safe_VkPhysicalDeviceMeshShaderFeaturesNV(const VkPhysicalDeviceMeshShaderFeaturesNV* in_struct);
     safe_VkPhysicalDeviceMeshShaderFeaturesNV(const safe_VkPhysicalDeviceMeshShaderFeaturesNV& src);
     safe_VkPhysicalDeviceMeshShaderFeaturesNV& operator=(const safe_VkPhysicalDeviceMeshShaderFeaturesNV& src);
+    safe_VkPhysicalDeviceMeshShaderFeaturesNV(safe_VkPhysicalDeviceMeshShaderFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceMeshShaderFeaturesNV& operator=(safe_VkPhysicalDeviceMeshShaderFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceMeshShaderFeaturesNV();
     ~safe_VkPhysicalDeviceMeshShaderFeaturesNV();
     void initialize(const VkPhysicalDeviceMeshShaderFeaturesNV* in_struct);
@@ -5633,6 +6269,8 @@ struct safe_VkPhysicalDeviceMeshShaderPropertiesNV {
     safe_VkPhysicalDeviceMeshShaderPropertiesNV(const VkPhysicalDeviceMeshShaderPropertiesNV* in_struct);
     safe_VkPhysicalDeviceMeshShaderPropertiesNV(const safe_VkPhysicalDeviceMeshShaderPropertiesNV& src);
     safe_VkPhysicalDeviceMeshShaderPropertiesNV& operator=(const safe_VkPhysicalDeviceMeshShaderPropertiesNV& src);
+    safe_VkPhysicalDeviceMeshShaderPropertiesNV(safe_VkPhysicalDeviceMeshShaderPropertiesNV&& src) noexcept;
+    safe_VkPhysicalDeviceMeshShaderPropertiesNV& operator=(safe_VkPhysicalDeviceMeshShaderPropertiesNV&& src) noexcept;
     safe_VkPhysicalDeviceMeshShaderPropertiesNV();
     ~safe_VkPhysicalDeviceMeshShaderPropertiesNV();
     void initialize(const VkPhysicalDeviceMeshShaderPropertiesNV* in_struct);
@@ -5648,6 +6286,8 @@ struct safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV {
     safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV* in_struct);
     safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV(const safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& src);
     safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& operator=(const safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& src);
+    safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV(safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& operator=(safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV();
     ~safe_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV();
     void initialize(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV* in_struct);
@@ -5663,6 +6303,8 @@ struct safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV {
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(const VkPhysicalDeviceShaderImageFootprintFeaturesNV* in_struct);
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(const safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& src);
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& operator=(const safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& src);
+    safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV& operator=(safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
     ~safe_VkPhysicalDeviceShaderImageFootprintFeaturesNV();
     void initialize(const VkPhysicalDeviceShaderImageFootprintFeaturesNV* in_struct);
@@ -5679,6 +6321,8 @@ struct safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV {
     safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(const VkPipelineViewportExclusiveScissorStateCreateInfoNV* in_struct);
     safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(const safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& src);
     safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& operator=(const safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& src);
+    safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV(safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV& operator=(safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
     ~safe_VkPipelineViewportExclusiveScissorStateCreateInfoNV();
     void initialize(const VkPipelineViewportExclusiveScissorStateCreateInfoNV* in_struct);
@@ -5694,6 +6338,8 @@ struct safe_VkPhysicalDeviceExclusiveScissorFeaturesNV {
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(const VkPhysicalDeviceExclusiveScissorFeaturesNV* in_struct);
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(const safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& src);
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& operator=(const safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& src);
+    safe_VkPhysicalDeviceExclusiveScissorFeaturesNV(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceExclusiveScissorFeaturesNV& operator=(safe_VkPhysicalDeviceExclusiveScissorFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
     ~safe_VkPhysicalDeviceExclusiveScissorFeaturesNV();
     void initialize(const VkPhysicalDeviceExclusiveScissorFeaturesNV* in_struct);
@@ -5709,6 +6355,8 @@ struct safe_VkQueueFamilyCheckpointPropertiesNV {
     safe_VkQueueFamilyCheckpointPropertiesNV(const VkQueueFamilyCheckpointPropertiesNV* in_struct);
     safe_VkQueueFamilyCheckpointPropertiesNV(const safe_VkQueueFamilyCheckpointPropertiesNV& src);
     safe_VkQueueFamilyCheckpointPropertiesNV& operator=(const safe_VkQueueFamilyCheckpointPropertiesNV& src);
+    safe_VkQueueFamilyCheckpointPropertiesNV(safe_VkQueueFamilyCheckpointPropertiesNV&& src) noexcept;
+    safe_VkQueueFamilyCheckpointPropertiesNV& operator=(safe_VkQueueFamilyCheckpointPropertiesNV&& src) noexcept;
     safe_VkQueueFamilyCheckpointPropertiesNV();
     ~safe_VkQueueFamilyCheckpointPropertiesNV();
     void initialize(const VkQueueFamilyCheckpointPropertiesNV* in_struct);
@@ -5725,6 +6373,8 @@ struct safe_VkCheckpointDataNV {
     safe_VkCheckpointDataNV(const VkCheckpointDataNV* in_struct);
     safe_VkCheckpointDataNV(const safe_VkCheckpointDataNV& src);
     safe_VkCheckpointDataNV& operator=(const safe_VkCheckpointDataNV& src);
+    safe_VkCheckpointDataNV(safe_VkCheckpointDataNV&& src) noexcept;
+    safe_VkCheckpointDataNV& operator=(safe_VkCheckpointDataNV&& src) noexcept;
     safe_VkCheckpointDataNV();
     ~safe_VkCheckpointDataNV();
     void initialize(const VkCheckpointDataNV* in_struct);
@@ -5740,6 +6390,8 @@ struct safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL {
     safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL(const VkPhysicalDeviceShaderIntegerFunctions2INTEL* in_struct);
     safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL(const safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL& src);
     safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL& operator=(const safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL& src);
+    safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL(safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL&& src) noexcept;
+    safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL& operator=(safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL&& src) noexcept;
     safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL();
     ~safe_VkPhysicalDeviceShaderIntegerFunctions2INTEL();
     void initialize(const VkPhysicalDeviceShaderIntegerFunctions2INTEL* in_struct);
@@ -5757,6 +6409,8 @@ struct safe_VkPerformanceValueDataINTEL {
     safe_VkPerformanceValueDataINTEL(const VkPerformanceValueDataINTEL* in_struct);
     safe_VkPerformanceValueDataINTEL(const safe_VkPerformanceValueDataINTEL& src);
     safe_VkPerformanceValueDataINTEL& operator=(const safe_VkPerformanceValueDataINTEL& src);
+    safe_VkPerformanceValueDataINTEL(safe_VkPerformanceValueDataINTEL&& src) noexcept;
+    safe_VkPerformanceValueDataINTEL& operator=(safe_VkPerformanceValueDataINTEL&& src) noexcept;
     safe_VkPerformanceValueDataINTEL();
     ~safe_VkPerformanceValueDataINTEL();
     void initialize(const VkPerformanceValueDataINTEL* in_struct);
@@ -5772,6 +6426,8 @@ struct safe_VkInitializePerformanceApiInfoINTEL {
     safe_VkInitializePerformanceApiInfoINTEL(const VkInitializePerformanceApiInfoINTEL* in_struct);
     safe_VkInitializePerformanceApiInfoINTEL(const safe_VkInitializePerformanceApiInfoINTEL& src);
     safe_VkInitializePerformanceApiInfoINTEL& operator=(const safe_VkInitializePerformanceApiInfoINTEL& src);
+    safe_VkInitializePerformanceApiInfoINTEL(safe_VkInitializePerformanceApiInfoINTEL&& src) noexcept;
+    safe_VkInitializePerformanceApiInfoINTEL& operator=(safe_VkInitializePerformanceApiInfoINTEL&& src) noexcept;
     safe_VkInitializePerformanceApiInfoINTEL();
     ~safe_VkInitializePerformanceApiInfoINTEL();
     void initialize(const VkInitializePerformanceApiInfoINTEL* in_struct);
@@ -5787,6 +6443,8 @@ struct safe_VkQueryPoolCreateInfoINTEL {
     safe_VkQueryPoolCreateInfoINTEL(const VkQueryPoolCreateInfoINTEL* in_struct);
     safe_VkQueryPoolCreateInfoINTEL(const safe_VkQueryPoolCreateInfoINTEL& src);
     safe_VkQueryPoolCreateInfoINTEL& operator=(const safe_VkQueryPoolCreateInfoINTEL& src);
+    safe_VkQueryPoolCreateInfoINTEL(safe_VkQueryPoolCreateInfoINTEL&& src) noexcept;
+    safe_VkQueryPoolCreateInfoINTEL& operator=(safe_VkQueryPoolCreateInfoINTEL&& src) noexcept;
     safe_VkQueryPoolCreateInfoINTEL();
     ~safe_VkQueryPoolCreateInfoINTEL();
     void initialize(const VkQueryPoolCreateInfoINTEL* in_struct);
@@ -5802,6 +6460,8 @@ struct safe_VkPerformanceMarkerInfoINTEL {
     safe_VkPerformanceMarkerInfoINTEL(const VkPerformanceMarkerInfoINTEL* in_struct);
     safe_VkPerformanceMarkerInfoINTEL(const safe_VkPerformanceMarkerInfoINTEL& src);
     safe_VkPerformanceMarkerInfoINTEL& operator=(const safe_VkPerformanceMarkerInfoINTEL& src);
+    safe_VkPerformanceMarkerInfoINTEL(safe_VkPerformanceMarkerInfoINTEL&& src) noexcept;
+    safe_VkPerformanceMarkerInfoINTEL& operator=(safe_VkPerformanceMarkerInfoINTEL&& src) noexcept;
     safe_VkPerformanceMarkerInfoINTEL();
     ~safe_VkPerformanceMarkerInfoINTEL();
     void initialize(const VkPerformanceMarkerInfoINTEL* in_struct);
@@ -5817,6 +6477,8 @@ struct safe_VkPerformanceStreamMarkerInfoINTEL {
     safe_VkPerformanceStreamMarkerInfoINTEL(const VkPerformanceStreamMarkerInfoINTEL* in_struct);
     safe_VkPerformanceStreamMarkerInfoINTEL(const safe_VkPerformanceStreamMarkerInfoINTEL& src);
     safe_VkPerformanceStreamMarkerInfoINTEL& operator=(const safe_VkPerformanceStreamMarkerInfoINTEL& src);
+    safe_VkPerformanceStreamMarkerInfoINTEL(safe_VkPerformanceStreamMarkerInfoINTEL&& src) noexcept;
+    safe_VkPerformanceStreamMarkerInfoINTEL& operator=(safe_VkPerformanceStreamMarkerInfoINTEL&& src) noexcept;
     safe_VkPerformanceStreamMarkerInfoINTEL();
     ~safe_VkPerformanceStreamMarkerInfoINTEL();
     void initialize(const VkPerformanceStreamMarkerInfoINTEL* in_struct);
@@ -5834,6 +6496,8 @@ struct safe_VkPerformanceOverrideInfoINTEL {
     safe_VkPerformanceOverrideInfoINTEL(const VkPerformanceOverrideInfoINTEL* in_struct);
     safe_VkPerformanceOverrideInfoINTEL(const safe_VkPerformanceOverrideInfoINTEL& src);
     safe_VkPerformanceOverrideInfoINTEL& operator=(const safe_VkPerformanceOverrideInfoINTEL& src);
+    safe_VkPerformanceOverrideInfoINTEL(safe_VkPerformanceOverrideInfoINTEL&& src) noexcept;
+    safe_VkPerformanceOverrideInfoINTEL& operator=(safe_VkPerformanceOverrideInfoINTEL&& src) noexcept;
     safe_VkPerformanceOverrideInfoINTEL();
     ~safe_VkPerformanceOverrideInfoINTEL();
     void initialize(const VkPerformanceOverrideInfoINTEL* in_struct);
@@ -5849,6 +6513,8 @@ struct safe_VkPerformanceConfigurationAcquireInfoINTEL {
     safe_VkPerformanceConfigurationAcquireInfoINTEL(const VkPerformanceConfigurationAcquireInfoINTEL* in_struct);
     safe_VkPerformanceConfigurationAcquireInfoINTEL(const safe_VkPerformanceConfigurationAcquireInfoINTEL& src);
     safe_VkPerformanceConfigurationAcquireInfoINTEL& operator=(const safe_VkPerformanceConfigurationAcquireInfoINTEL& src);
+    safe_VkPerformanceConfigurationAcquireInfoINTEL(safe_VkPerformanceConfigurationAcquireInfoINTEL&& src) noexcept;
+    safe_VkPerformanceConfigurationAcquireInfoINTEL& operator=(safe_VkPerformanceConfigurationAcquireInfoINTEL&& src) noexcept;
     safe_VkPerformanceConfigurationAcquireInfoINTEL();
     ~safe_VkPerformanceConfigurationAcquireInfoINTEL();
     void initialize(const VkPerformanceConfigurationAcquireInfoINTEL* in_struct);
@@ -5867,6 +6533,8 @@ struct safe_VkPhysicalDevicePCIBusInfoPropertiesEXT {
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(const VkPhysicalDevicePCIBusInfoPropertiesEXT* in_struct);
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(const safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& src);
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& operator=(const safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& src);
+    safe_VkPhysicalDevicePCIBusInfoPropertiesEXT(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDevicePCIBusInfoPropertiesEXT& operator=(safe_VkPhysicalDevicePCIBusInfoPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
     ~safe_VkPhysicalDevicePCIBusInfoPropertiesEXT();
     void initialize(const VkPhysicalDevicePCIBusInfoPropertiesEXT* in_struct);
@@ -5882,6 +6550,8 @@ struct safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD {
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(const VkDisplayNativeHdrSurfaceCapabilitiesAMD* in_struct);
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(const safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& src);
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& operator=(const safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& src);
+    safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& src) noexcept;
+    safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD& operator=(safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD&& src) noexcept;
     safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
     ~safe_VkDisplayNativeHdrSurfaceCapabilitiesAMD();
     void initialize(const VkDisplayNativeHdrSurfaceCapabilitiesAMD* in_struct);
@@ -5897,6 +6567,8 @@ struct safe_VkSwapchainDisplayNativeHdrCreateInfoAMD {
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(const VkSwapchainDisplayNativeHdrCreateInfoAMD* in_struct);
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(const safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& src);
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& operator=(const safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& src);
+    safe_VkSwapchainDisplayNativeHdrCreateInfoAMD(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& src) noexcept;
+    safe_VkSwapchainDisplayNativeHdrCreateInfoAMD& operator=(safe_VkSwapchainDisplayNativeHdrCreateInfoAMD&& src) noexcept;
     safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
     ~safe_VkSwapchainDisplayNativeHdrCreateInfoAMD();
     void initialize(const VkSwapchainDisplayNativeHdrCreateInfoAMD* in_struct);
@@ -5914,6 +6586,8 @@ struct safe_VkImagePipeSurfaceCreateInfoFUCHSIA {
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA(const VkImagePipeSurfaceCreateInfoFUCHSIA* in_struct);
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA(const safe_VkImagePipeSurfaceCreateInfoFUCHSIA& src);
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA& operator=(const safe_VkImagePipeSurfaceCreateInfoFUCHSIA& src);
+    safe_VkImagePipeSurfaceCreateInfoFUCHSIA(safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& src) noexcept;
+    safe_VkImagePipeSurfaceCreateInfoFUCHSIA& operator=(safe_VkImagePipeSurfaceCreateInfoFUCHSIA&& src) noexcept;
     safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
     ~safe_VkImagePipeSurfaceCreateInfoFUCHSIA();
     void initialize(const VkImagePipeSurfaceCreateInfoFUCHSIA* in_struct);
@@ -5932,6 +6606,8 @@ struct safe_VkMetalSurfaceCreateInfoEXT {
     safe_VkMetalSurfaceCreateInfoEXT(const VkMetalSurfaceCreateInfoEXT* in_struct);
     safe_VkMetalSurfaceCreateInfoEXT(const safe_VkMetalSurfaceCreateInfoEXT& src);
     safe_VkMetalSurfaceCreateInfoEXT& operator=(const safe_VkMetalSurfaceCreateInfoEXT& src);
+    safe_VkMetalSurfaceCreateInfoEXT(safe_VkMetalSurfaceCreateInfoEXT&& src) noexcept;
+    safe_VkMetalSurfaceCreateInfoEXT& operator=(safe_VkMetalSurfaceCreateInfoEXT&& src) noexcept;
     safe_VkMetalSurfaceCreateInfoEXT();
     ~safe_VkMetalSurfaceCreateInfoEXT();
     void initialize(const VkMetalSurfaceCreateInfoEXT* in_struct);
@@ -5950,6 +6626,8 @@ struct safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT {
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(const safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& src);
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& operator=(const safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& src);
+    safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& operator=(safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
     ~safe_VkPhysicalDeviceFragmentDensityMapFeaturesEXT();
     void initialize(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT* in_struct);
@@ -5967,6 +6645,8 @@ struct safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT {
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(const safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& src);
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& operator=(const safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& src);
+    safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& operator=(safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
     ~safe_VkPhysicalDeviceFragmentDensityMapPropertiesEXT();
     void initialize(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT* in_struct);
@@ -5982,6 +6662,8 @@ struct safe_VkRenderPassFragmentDensityMapCreateInfoEXT {
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT(const VkRenderPassFragmentDensityMapCreateInfoEXT* in_struct);
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT(const safe_VkRenderPassFragmentDensityMapCreateInfoEXT& src);
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT& operator=(const safe_VkRenderPassFragmentDensityMapCreateInfoEXT& src);
+    safe_VkRenderPassFragmentDensityMapCreateInfoEXT(safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& src) noexcept;
+    safe_VkRenderPassFragmentDensityMapCreateInfoEXT& operator=(safe_VkRenderPassFragmentDensityMapCreateInfoEXT&& src) noexcept;
     safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
     ~safe_VkRenderPassFragmentDensityMapCreateInfoEXT();
     void initialize(const VkRenderPassFragmentDensityMapCreateInfoEXT* in_struct);
@@ -5997,6 +6679,8 @@ struct safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT {
     safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT(const VkPhysicalDeviceScalarBlockLayoutFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT(const safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT& src);
     safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT& operator=(const safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT& src);
+    safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT(safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT& operator=(safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT();
     ~safe_VkPhysicalDeviceScalarBlockLayoutFeaturesEXT();
     void initialize(const VkPhysicalDeviceScalarBlockLayoutFeaturesEXT* in_struct);
@@ -6013,6 +6697,8 @@ struct safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT {
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(const VkPhysicalDeviceMemoryBudgetPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(const safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& src);
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& operator=(const safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& src);
+    safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT& operator=(safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
     ~safe_VkPhysicalDeviceMemoryBudgetPropertiesEXT();
     void initialize(const VkPhysicalDeviceMemoryBudgetPropertiesEXT* in_struct);
@@ -6028,6 +6714,8 @@ struct safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT {
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(const VkPhysicalDeviceMemoryPriorityFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(const safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& src);
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& operator=(const safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& src);
+    safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT& operator=(safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
     ~safe_VkPhysicalDeviceMemoryPriorityFeaturesEXT();
     void initialize(const VkPhysicalDeviceMemoryPriorityFeaturesEXT* in_struct);
@@ -6043,6 +6731,8 @@ struct safe_VkMemoryPriorityAllocateInfoEXT {
     safe_VkMemoryPriorityAllocateInfoEXT(const VkMemoryPriorityAllocateInfoEXT* in_struct);
     safe_VkMemoryPriorityAllocateInfoEXT(const safe_VkMemoryPriorityAllocateInfoEXT& src);
     safe_VkMemoryPriorityAllocateInfoEXT& operator=(const safe_VkMemoryPriorityAllocateInfoEXT& src);
+    safe_VkMemoryPriorityAllocateInfoEXT(safe_VkMemoryPriorityAllocateInfoEXT&& src) noexcept;
+    safe_VkMemoryPriorityAllocateInfoEXT& operator=(safe_VkMemoryPriorityAllocateInfoEXT&& src) noexcept;
     safe_VkMemoryPriorityAllocateInfoEXT();
     ~safe_VkMemoryPriorityAllocateInfoEXT();
     void initialize(const VkMemoryPriorityAllocateInfoEXT* in_struct);
@@ -6058,6 +6748,8 @@ struct safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV {
     safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV* in_struct);
     safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(const safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& src);
     safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& operator=(const safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& src);
+    safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV(safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& operator=(safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
     ~safe_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV();
     void initialize(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV* in_struct);
@@ -6075,6 +6767,8 @@ struct safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT {
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(const safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& src);
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& operator=(const safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& src);
+    safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& operator=(safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
     ~safe_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT();
     void initialize(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT* in_struct);
@@ -6090,6 +6784,8 @@ struct safe_VkBufferDeviceAddressInfoEXT {
     safe_VkBufferDeviceAddressInfoEXT(const VkBufferDeviceAddressInfoEXT* in_struct);
     safe_VkBufferDeviceAddressInfoEXT(const safe_VkBufferDeviceAddressInfoEXT& src);
     safe_VkBufferDeviceAddressInfoEXT& operator=(const safe_VkBufferDeviceAddressInfoEXT& src);
+    safe_VkBufferDeviceAddressInfoEXT(safe_VkBufferDeviceAddressInfoEXT&& src) noexcept;
+    safe_VkBufferDeviceAddressInfoEXT& operator=(safe_VkBufferDeviceAddressInfoEXT&& src) noexcept;
     safe_VkBufferDeviceAddressInfoEXT();
     ~safe_VkBufferDeviceAddressInfoEXT();
     void initialize(const VkBufferDeviceAddressInfoEXT* in_struct);
@@ -6105,6 +6801,8 @@ struct safe_VkBufferDeviceAddressCreateInfoEXT {
     safe_VkBufferDeviceAddressCreateInfoEXT(const VkBufferDeviceAddressCreateInfoEXT* in_struct);
     safe_VkBufferDeviceAddressCreateInfoEXT(const safe_VkBufferDeviceAddressCreateInfoEXT& src);
     safe_VkBufferDeviceAddressCreateInfoEXT& operator=(const safe_VkBufferDeviceAddressCreateInfoEXT& src);
+    safe_VkBufferDeviceAddressCreateInfoEXT(safe_VkBufferDeviceAddressCreateInfoEXT&& src) noexcept;
+    safe_VkBufferDeviceAddressCreateInfoEXT& operator=(safe_VkBufferDeviceAddressCreateInfoEXT&& src) noexcept;
     safe_VkBufferDeviceAddressCreateInfoEXT();
     ~safe_VkBufferDeviceAddressCreateInfoEXT();
     void initialize(const VkBufferDeviceAddressCreateInfoEXT* in_struct);
@@ -6120,6 +6818,8 @@ struct safe_VkImageStencilUsageCreateInfoEXT {
     safe_VkImageStencilUsageCreateInfoEXT(const VkImageStencilUsageCreateInfoEXT* in_struct);
     safe_VkImageStencilUsageCreateInfoEXT(const safe_VkImageStencilUsageCreateInfoEXT& src);
     safe_VkImageStencilUsageCreateInfoEXT& operator=(const safe_VkImageStencilUsageCreateInfoEXT& src);
+    safe_VkImageStencilUsageCreateInfoEXT(safe_VkImageStencilUsageCreateInfoEXT&& src) noexcept;
+    safe_VkImageStencilUsageCreateInfoEXT& operator=(safe_VkImageStencilUsageCreateInfoEXT&& src) noexcept;
     safe_VkImageStencilUsageCreateInfoEXT();
     ~safe_VkImageStencilUsageCreateInfoEXT();
     void initialize(const VkImageStencilUsageCreateInfoEXT* in_struct);
@@ -6138,6 +6838,8 @@ struct safe_VkValidationFeaturesEXT {
     safe_VkValidationFeaturesEXT(const VkValidationFeaturesEXT* in_struct);
     safe_VkValidationFeaturesEXT(const safe_VkValidationFeaturesEXT& src);
     safe_VkValidationFeaturesEXT& operator=(const safe_VkValidationFeaturesEXT& src);
+    safe_VkValidationFeaturesEXT(safe_VkValidationFeaturesEXT&& src) noexcept;
+    safe_VkValidationFeaturesEXT& operator=(safe_VkValidationFeaturesEXT&& src) noexcept;
     safe_VkValidationFeaturesEXT();
     ~safe_VkValidationFeaturesEXT();
     void initialize(const VkValidationFeaturesEXT* in_struct);
@@ -6160,6 +6862,8 @@ struct safe_VkCooperativeMatrixPropertiesNV {
     safe_VkCooperativeMatrixPropertiesNV(const VkCooperativeMatrixPropertiesNV* in_struct);
     safe_VkCooperativeMatrixPropertiesNV(const safe_VkCooperativeMatrixPropertiesNV& src);
     safe_VkCooperativeMatrixPropertiesNV& operator=(const safe_VkCooperativeMatrixPropertiesNV& src);
+    safe_VkCooperativeMatrixPropertiesNV(safe_VkCooperativeMatrixPropertiesNV&& src) noexcept;
+    safe_VkCooperativeMatrixPropertiesNV& operator=(safe_VkCooperativeMatrixPropertiesNV&& src) noexcept;
     safe_VkCooperativeMatrixPropertiesNV();
     ~safe_VkCooperativeMatrixPropertiesNV();
     void initialize(const VkCooperativeMatrixPropertiesNV* in_struct);
@@ -6176,6 +6880,8 @@ struct safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV {
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(const VkPhysicalDeviceCooperativeMatrixFeaturesNV* in_struct);
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(const safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& src);
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& operator=(const safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& src);
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV& operator=(safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
     ~safe_VkPhysicalDeviceCooperativeMatrixFeaturesNV();
     void initialize(const VkPhysicalDeviceCooperativeMatrixFeaturesNV* in_struct);
@@ -6191,6 +6897,8 @@ struct safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV {
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(const VkPhysicalDeviceCooperativeMatrixPropertiesNV* in_struct);
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(const safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& src);
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& operator=(const safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& src);
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& src) noexcept;
+    safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV& operator=(safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV&& src) noexcept;
     safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
     ~safe_VkPhysicalDeviceCooperativeMatrixPropertiesNV();
     void initialize(const VkPhysicalDeviceCooperativeMatrixPropertiesNV* in_struct);
@@ -6206,6 +6914,8 @@ struct safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV {
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(const VkPhysicalDeviceCoverageReductionModeFeaturesNV* in_struct);
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(const safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& src);
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& operator=(const safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& src);
+    safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& src) noexcept;
+    safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV& operator=(safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV&& src) noexcept;
     safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
     ~safe_VkPhysicalDeviceCoverageReductionModeFeaturesNV();
     void initialize(const VkPhysicalDeviceCoverageReductionModeFeaturesNV* in_struct);
@@ -6222,6 +6932,8 @@ struct safe_VkPipelineCoverageReductionStateCreateInfoNV {
     safe_VkPipelineCoverageReductionStateCreateInfoNV(const VkPipelineCoverageReductionStateCreateInfoNV* in_struct);
     safe_VkPipelineCoverageReductionStateCreateInfoNV(const safe_VkPipelineCoverageReductionStateCreateInfoNV& src);
     safe_VkPipelineCoverageReductionStateCreateInfoNV& operator=(const safe_VkPipelineCoverageReductionStateCreateInfoNV& src);
+    safe_VkPipelineCoverageReductionStateCreateInfoNV(safe_VkPipelineCoverageReductionStateCreateInfoNV&& src) noexcept;
+    safe_VkPipelineCoverageReductionStateCreateInfoNV& operator=(safe_VkPipelineCoverageReductionStateCreateInfoNV&& src) noexcept;
     safe_VkPipelineCoverageReductionStateCreateInfoNV();
     ~safe_VkPipelineCoverageReductionStateCreateInfoNV();
     void initialize(const VkPipelineCoverageReductionStateCreateInfoNV* in_struct);
@@ -6240,6 +6952,8 @@ struct safe_VkFramebufferMixedSamplesCombinationNV {
     safe_VkFramebufferMixedSamplesCombinationNV(const VkFramebufferMixedSamplesCombinationNV* in_struct);
     safe_VkFramebufferMixedSamplesCombinationNV(const safe_VkFramebufferMixedSamplesCombinationNV& src);
     safe_VkFramebufferMixedSamplesCombinationNV& operator=(const safe_VkFramebufferMixedSamplesCombinationNV& src);
+    safe_VkFramebufferMixedSamplesCombinationNV(safe_VkFramebufferMixedSamplesCombinationNV&& src) noexcept;
+    safe_VkFramebufferMixedSamplesCombinationNV& operator=(safe_VkFramebufferMixedSamplesCombinationNV&& src) noexcept;
     safe_VkFramebufferMixedSamplesCombinationNV();
     ~safe_VkFramebufferMixedSamplesCombinationNV();
     void initialize(const VkFramebufferMixedSamplesCombinationNV* in_struct);
@@ -6257,6 +6971,8 @@ struct safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT {
     safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(const safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& src);
     safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& operator=(const safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& src);
+    safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT(safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& operator=(safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
     ~safe_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT();
     void initialize(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT* in_struct);
@@ -6272,6 +6988,8 @@ struct safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT {
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(const safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& src);
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& operator=(const safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& src);
+    safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& operator=(safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
     ~safe_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT();
     void initialize(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT* in_struct);
@@ -6288,6 +7006,8 @@ struct safe_VkSurfaceFullScreenExclusiveInfoEXT {
     safe_VkSurfaceFullScreenExclusiveInfoEXT(const VkSurfaceFullScreenExclusiveInfoEXT* in_struct);
     safe_VkSurfaceFullScreenExclusiveInfoEXT(const safe_VkSurfaceFullScreenExclusiveInfoEXT& src);
     safe_VkSurfaceFullScreenExclusiveInfoEXT& operator=(const safe_VkSurfaceFullScreenExclusiveInfoEXT& src);
+    safe_VkSurfaceFullScreenExclusiveInfoEXT(safe_VkSurfaceFullScreenExclusiveInfoEXT&& src) noexcept;
+    safe_VkSurfaceFullScreenExclusiveInfoEXT& operator=(safe_VkSurfaceFullScreenExclusiveInfoEXT&& src) noexcept;
     safe_VkSurfaceFullScreenExclusiveInfoEXT();
     ~safe_VkSurfaceFullScreenExclusiveInfoEXT();
     void initialize(const VkSurfaceFullScreenExclusiveInfoEXT* in_struct);
@@ -6305,6 +7025,8 @@ struct safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT {
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(const VkSurfaceCapabilitiesFullScreenExclusiveEXT* in_struct);
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(const safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& src);
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& operator=(const safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& src);
+    safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& src) noexcept;
+    safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT& operator=(safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT&& src) noexcept;
     safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
     ~safe_VkSurfaceCapabilitiesFullScreenExclusiveEXT();
     void initialize(const VkSurfaceCapabilitiesFullScreenExclusiveEXT* in_struct);
@@ -6322,6 +7044,8 @@ struct safe_VkSurfaceFullScreenExclusiveWin32InfoEXT {
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(const VkSurfaceFullScreenExclusiveWin32InfoEXT* in_struct);
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(const safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& src);
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& operator=(const safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& src);
+    safe_VkSurfaceFullScreenExclusiveWin32InfoEXT(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& src) noexcept;
+    safe_VkSurfaceFullScreenExclusiveWin32InfoEXT& operator=(safe_VkSurfaceFullScreenExclusiveWin32InfoEXT&& src) noexcept;
     safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
     ~safe_VkSurfaceFullScreenExclusiveWin32InfoEXT();
     void initialize(const VkSurfaceFullScreenExclusiveWin32InfoEXT* in_struct);
@@ -6338,6 +7062,8 @@ struct safe_VkHeadlessSurfaceCreateInfoEXT {
     safe_VkHeadlessSurfaceCreateInfoEXT(const VkHeadlessSurfaceCreateInfoEXT* in_struct);
     safe_VkHeadlessSurfaceCreateInfoEXT(const safe_VkHeadlessSurfaceCreateInfoEXT& src);
     safe_VkHeadlessSurfaceCreateInfoEXT& operator=(const safe_VkHeadlessSurfaceCreateInfoEXT& src);
+    safe_VkHeadlessSurfaceCreateInfoEXT(safe_VkHeadlessSurfaceCreateInfoEXT&& src) noexcept;
+    safe_VkHeadlessSurfaceCreateInfoEXT& operator=(safe_VkHeadlessSurfaceCreateInfoEXT&& src) noexcept;
     safe_VkHeadlessSurfaceCreateInfoEXT();
     ~safe_VkHeadlessSurfaceCreateInfoEXT();
     void initialize(const VkHeadlessSurfaceCreateInfoEXT* in_struct);
@@ -6353,6 +7079,8 @@ struct safe_VkPhysicalDeviceHostQueryResetFeaturesEXT {
     safe_VkPhysicalDeviceHostQueryResetFeaturesEXT(const VkPhysicalDeviceHostQueryResetFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceHostQueryResetFeaturesEXT(const safe_VkPhysicalDeviceHostQueryResetFeaturesEXT& src);
     safe_VkPhysicalDeviceHostQueryResetFeaturesEXT& operator=(const safe_VkPhysicalDeviceHostQueryResetFeaturesEXT& src);
+    safe_VkPhysicalDeviceHostQueryResetFeaturesEXT(safe_VkPhysicalDeviceHostQueryResetFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceHostQueryResetFeaturesEXT& operator=(safe_VkPhysicalDeviceHostQueryResetFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceHostQueryResetFeaturesEXT();
     ~safe_VkPhysicalDeviceHostQueryResetFeaturesEXT();
     void initialize(const VkPhysicalDeviceHostQueryResetFeaturesEXT* in_struct);
@@ -6368,6 +7096,8 @@ struct safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT {
     safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT(const safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& src);
     safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& operator=(const safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& src);
+    safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT(safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& operator=(safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT();
     ~safe_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT();
     void initialize(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT* in_struct);
@@ -6383,6 +7113,8 @@ struct safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT {
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT* in_struct);
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(const safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& src);
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& operator=(const safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& src);
+    safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& operator=(safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT&& src) noexcept;
     safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
     ~safe_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT();
     void initialize(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT* in_struct);
@@ -6401,6 +7133,8 @@ struct safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT {
     safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT(const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT* in_struct);
     safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT(const safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& src);
     safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& operator=(const safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& src);
+    safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT(safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT&& src) noexcept;
+    safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& operator=(safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT&& src) noexcept;
     safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT();
     ~safe_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT();
     void initialize(const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT* in_struct);
@@ -3318,3 +3318,41 @@ template <typename T> T lvl_init_struct() {
     return out;
 }
 
+// One-pass index over a pNext chain.  Construction walks the chain once into a small
+// stack-resident table; each typed query then scans the captured sTypes (chains are short)
+// instead of re-chasing pointers from the chain head, which matters for calls whose
+// validation queries several different extension structs.
+class LvlChainIndex {
+  public:
+    explicit LvlChainIndex(const void *chain_head) : count_(0), overflow_(nullptr) {
+        const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(chain_head);
+        while (current) {
+            if (count_ == kMaxIndexedStructs) {
+                overflow_ = current;
+                break;
+            }
+            stypes_[count_] = current->sType;
+            structs_[count_] = current;
+            ++count_;
+            current = current->pNext;
+        }
+    }
+
+    template <typename T> const T *Find() const {
+        for (uint32_t i = 0; i < count_; ++i) {
+            if (LvlTypeMap<T>::kSType == stypes_[i]) {
+                return reinterpret_cast<const T *>(structs_[i]);
+            }
+        }
+        // Chains longer than the table are rare; search the uncaptured tail the slow way
+        return overflow_ ? lvl_find_in_chain<T>(overflow_) : nullptr;
+    }
+
+  private:
+    enum { kMaxIndexedStructs = 16 };
+    VkStructureType stypes_[kMaxIndexedStructs];
+    const VkBaseOutStructure *structs_[kMaxIndexedStructs];
+    uint32_t count_;
+    const VkBaseOutStructure *overflow_;
+};
+
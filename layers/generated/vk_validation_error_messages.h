@@ -27,7 +27,8 @@
 // Disable auto-formatting for generated file
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID string so that
+// consumers can binary search it (see log_msg in vk_layer_logging.h)
 typedef struct _vuid_spec_text_pair {
     const char * vuid;
     const char * spec_text;
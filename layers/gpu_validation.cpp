@@ -33,11 +33,35 @@
 #include "spirv-tools/instrument.hpp"
 #include <SPIRV/spirv.hpp>
 #include <algorithm>
+#include "vl_thread_pool.h"
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <cstdio>
+#include <map>
 #include <regex>
+#include <tuple>
 
 // This is the number of bindings in the debug descriptor set.
 static const uint32_t kNumBindingsInSet = 2;
 
+// Charge/release the GPU-AV memory accounting subsystem with a block's actual allocation size, so
+// the VK_LAYER_MEMORY_ACCOUNTING teardown report can attribute buffer growth.  Call the account
+// helper after a successful vmaCreateBuffer and the release helper before each vmaDestroyBuffer.
+static void GpuAccountMemoryBlock(VmaAllocator allocator, VmaAllocation allocation) {
+    VmaAllocationInfo alloc_info = {};
+    vmaGetAllocationInfo(allocator, allocation, &alloc_info);
+    VlMemAccount(kVlMemGpuValidation, static_cast<int64_t>(alloc_info.size));
+}
+
+static void GpuReleaseMemoryBlock(VmaAllocator allocator, VmaAllocation allocation) {
+    VmaAllocationInfo alloc_info = {};
+    vmaGetAllocationInfo(allocator, allocation, &alloc_info);
+    VlMemRelease(kVlMemGpuValidation, static_cast<int64_t>(alloc_info.size));
+}
+
 static const VkShaderStageFlags kShaderStageAllRayTracing =
     VK_SHADER_STAGE_ANY_HIT_BIT_NV | VK_SHADER_STAGE_CALLABLE_BIT_NV | VK_SHADER_STAGE_CLOSEST_HIT_BIT_NV |
     VK_SHADER_STAGE_INTERSECTION_BIT_NV | VK_SHADER_STAGE_MISS_BIT_NV | VK_SHADER_STAGE_RAYGEN_BIT_NV;
@@ -54,6 +78,7 @@ GpuDescriptorSetManager::~GpuDescriptorSetManager() {
 
 VkResult GpuDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescriptorPool *pool,
                                                     std::vector<VkDescriptorSet> *desc_sets) {
+    std::lock_guard<std::mutex> lock(lock_);
     const uint32_t default_pool_size = kItemsPerChunk;
     VkResult result = VK_SUCCESS;
     VkDescriptorPool pool_to_use = VK_NULL_HANDLE;
@@ -110,6 +135,7 @@ VkResult GpuDescriptorSetManager::GetDescriptorSets(uint32_t count, VkDescriptor
 }
 
 void GpuDescriptorSetManager::PutBackDescriptorSet(VkDescriptorPool desc_pool, VkDescriptorSet desc_set) {
+    std::lock_guard<std::mutex> lock(lock_);
     auto iter = desc_pool_map_.find(desc_pool);
     if (iter != desc_pool_map_.end()) {
         VkResult result = DispatchFreeDescriptorSets(dev_data_->device, desc_pool, 1, &desc_set);
@@ -336,17 +362,15 @@ void CoreChecks::GpuPostCallRecordCreateDevice(const CHECK_ENABLED *enables, con
 
 // Clean up device-related resources
 void CoreChecks::GpuPreCallRecordDestroyDevice() {
-    for (auto &queue_barrier_command_info_kv : gpu_validation_state->queue_barrier_command_infos) {
-        GpuQueueBarrierCommandInfo &queue_barrier_command_info = queue_barrier_command_info_kv.second;
-
-        DispatchFreeCommandBuffers(device, queue_barrier_command_info.barrier_command_pool, 1,
-                                   &queue_barrier_command_info.barrier_command_buffer);
-        queue_barrier_command_info.barrier_command_buffer = VK_NULL_HANDLE;
-
-        DispatchDestroyCommandPool(device, queue_barrier_command_info.barrier_command_pool, NULL);
-        queue_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
+    GpuJoinPendingReadbacks();
+    std::vector<VkFence> retired_fences;
+    {
+        std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+        retired_fences.swap(gpu_validation_state->readback_fence_free_list);
+    }
+    for (auto fence : retired_fences) {
+        DispatchDestroyFence(device, fence, nullptr);
     }
-    gpu_validation_state->queue_barrier_command_infos.clear();
     if (gpu_validation_state->debug_desc_layout) {
         DispatchDestroyDescriptorSetLayout(device, gpu_validation_state->debug_desc_layout, NULL);
         gpu_validation_state->debug_desc_layout = VK_NULL_HANDLE;
@@ -357,6 +381,16 @@ void CoreChecks::GpuPreCallRecordDestroyDevice() {
     }
     gpu_validation_state->desc_set_manager.reset();
     if (gpu_validation_state->vmaAllocator) {
+        std::vector<GpuDeviceMemoryBlock> retired_blocks;
+        {
+            std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+            retired_blocks.swap(gpu_validation_state->output_block_free_list);
+        }
+        for (auto &block : retired_blocks) {
+            vmaUnmapMemory(gpu_validation_state->vmaAllocator, block.allocation);
+            GpuReleaseMemoryBlock(gpu_validation_state->vmaAllocator, block.allocation);
+            vmaDestroyBuffer(gpu_validation_state->vmaAllocator, block.buffer, block.allocation);
+        }
         vmaDestroyAllocator(gpu_validation_state->vmaAllocator);
     }
 }
@@ -411,11 +445,13 @@ void CoreChecks::GpuResetCommandBuffer(const VkCommandBuffer commandBuffer) {
     if (gpu_validation_state->aborted) {
         return;
     }
+    // A readback worker may still be scanning this command buffer's output blocks
+    GpuJoinPendingReadbacks();
     auto gpu_buffer_list = gpu_validation_state->GetGpuBufferInfo(commandBuffer);
     for (auto buffer_info : gpu_buffer_list) {
-        vmaDestroyBuffer(gpu_validation_state->vmaAllocator, buffer_info.output_mem_block.buffer,
-                         buffer_info.output_mem_block.allocation);
+        GpuReleaseOutputBlock(buffer_info.output_mem_block);
         if (buffer_info.input_mem_block.buffer) {
+            GpuReleaseMemoryBlock(gpu_validation_state->vmaAllocator, buffer_info.input_mem_block.allocation);
             vmaDestroyBuffer(gpu_validation_state->vmaAllocator, buffer_info.input_mem_block.buffer,
                              buffer_info.input_mem_block.allocation);
         }
@@ -423,7 +459,10 @@ void CoreChecks::GpuResetCommandBuffer(const VkCommandBuffer commandBuffer) {
             gpu_validation_state->desc_set_manager->PutBackDescriptorSet(buffer_info.desc_pool, buffer_info.desc_set);
         }
     }
-    gpu_validation_state->command_buffer_map.erase(commandBuffer);
+    {
+        std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+        gpu_validation_state->command_buffer_map.erase(commandBuffer);
+    }
 }
 
 // Just gives a warning about a possible deadlock.
@@ -517,14 +556,14 @@ void CoreChecks::GpuPreCallRecordPipelineCreations(uint32_t count, const CreateI
     }
 
     // Walk through all the pipelines, make a copy of each and flag each pipeline that contains a shader that uses the debug
-    // descriptor set index.
+    // descriptor set index.  Reserve up front so growth never deep-copies the elements already captured.
+    new_pipeline_create_infos->reserve(count);
     for (uint32_t pipeline = 0; pipeline < count; ++pipeline) {
         uint32_t stageCount = Accessor::GetStageCount(pCreateInfos[pipeline]);
         new_pipeline_create_infos->push_back(Accessor::GetPipelineCI(pipe_state[pipeline].get()));
 
         bool replace_shaders = false;
-        if (pipe_state[pipeline]->active_slots.find(gpu_validation_state->desc_set_bind_index) !=
-            pipe_state[pipeline]->active_slots.end()) {
+        if (pipe_state[pipeline]->UsesDescriptorSet(gpu_validation_state->desc_set_bind_index)) {
             replace_shaders = true;
         }
         // If the app requests all available sets, the pipeline layout was not modified at pipeline layout creation and the already
@@ -601,8 +640,7 @@ void CoreChecks::GpuPostCallRecordPipelineCreations(const uint32_t count, const
         }
 
         for (uint32_t stage = 0; stage < stageCount; ++stage) {
-            if (pipeline_state->active_slots.find(gpu_validation_state->desc_set_bind_index) !=
-                pipeline_state->active_slots.end()) {
+            if (pipeline_state->UsesDescriptorSet(gpu_validation_state->desc_set_bind_index)) {
                 DispatchDestroyShaderModule(device, Accessor::GetShaderModule(pCreateInfos[pipeline], stage), pAllocator);
             }
 
@@ -619,11 +657,14 @@ void CoreChecks::GpuPostCallRecordPipelineCreations(const uint32_t count, const
             }
 
             std::vector<unsigned int> code;
+            ShaderTracker &tracker = gpu_validation_state->shader_map[shader_state->gpu_validation_shader_id];
             // Save the shader binary if debug info is present.
             // The core_validation ShaderModule tracker saves the binary too, but discards it when the ShaderModule
             // is destroyed.  Applications may destroy ShaderModules after they are placed in a pipeline and before
-            // the pipeline is used, so we have to keep another copy.
-            if (shader_state && shader_state->has_valid_spirv) {  // really checking for presense of SPIR-V code.
+            // the pipeline is used, so we have to keep another copy.  Skip the copy when this shader id was already
+            // captured -- the same module commonly lands in many pipelines.
+            const bool already_captured = (tracker.sidecar_word_count != 0) || tracker.pgm.size();
+            if (!already_captured && shader_state && shader_state->has_valid_spirv) {  // really checking for presense of SPIR-V code.
                 for (auto insn : *shader_state) {
                     if (insn.opcode() == spv::OpLine) {
                         code = shader_state->words;
@@ -631,7 +672,7 @@ void CoreChecks::GpuPostCallRecordPipelineCreations(const uint32_t count, const
                     }
                 }
             }
-            gpu_validation_state->shader_map[shader_state->gpu_validation_shader_id].pipeline = pipeline_state->pipeline;
+            tracker.pipeline = pipeline_state->pipeline;
             // Be careful to use the originally bound (instrumented) shader here, even if PreCallRecord had to back it
             // out with a non-instrumented shader.  The non-instrumented shader (found in pCreateInfo) was destroyed above.
             VkShaderModule shader_module = VK_NULL_HANDLE;
@@ -645,8 +686,15 @@ void CoreChecks::GpuPostCallRecordPipelineCreations(const uint32_t count, const
             } else {
                 assert(false);
             }
-            gpu_validation_state->shader_map[shader_state->gpu_validation_shader_id].shader_module = shader_module;
-            gpu_validation_state->shader_map[shader_state->gpu_validation_shader_id].pgm = std::move(code);
+            tracker.shader_module = shader_module;
+            if (code.size()) {
+                // Spill the debug SPIR-V to the sidecar; keep it resident only if the spill failed
+                if (gpu_validation_state->debug_sidecar.Append(code, &tracker.sidecar_offset)) {
+                    tracker.sidecar_word_count = static_cast<uint32_t>(code.size());
+                } else {
+                    tracker.pgm = std::move(code);
+                }
+            }
         }
     }
 }
@@ -663,11 +711,142 @@ void CoreChecks::GpuPreCallRecordDestroyPipeline(const VkPipeline pipeline) {
 }
 
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
+// Instrumented SPIR-V keyed by (module hash, embedded shader id, descriptor bind slot, pass
+// options).  The instrumentation output is deterministic in these inputs, so when an identical
+// module is recreated with the same id assignment -- typical for apps that tear down and rebuild
+// their device on display changes, recreating modules in the same order -- the spirv-opt pass can
+// be skipped.  Process-global so the cache survives the device.
+typedef std::tuple<uint32_t, uint32_t, uint32_t, uint32_t> GpuInstrumentedShaderKey;
+static std::mutex gpu_instrumented_cache_lock;
+static std::map<GpuInstrumentedShaderKey, std::vector<unsigned int>> gpu_instrumented_cache;
+
+// Optional disk tier, stored next to the shader validation result cache.  Entries are
+// self-describing (the key fields are per entry), so one file serves devices with different
+// bind slots.
+static const uint32_t kGpuInstrumentedCacheMagic = 0x43495647;  // "GVIC"
+static const uint32_t kGpuInstrumentedCacheVersion = 1;
+
+// 64-bit file positioning for the debug sidecar; the spill can exceed what long holds on LLP64
+static int GpuSidecarSeek(FILE *file, uint64_t offset) {
+#if defined(_WIN32)
+    return _fseeki64(file, static_cast<int64_t>(offset), SEEK_SET);
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+}
+
+GpuShaderDebugSidecar::~GpuShaderDebugSidecar() {
+    if (file_) fclose(file_);
+}
+
+bool GpuShaderDebugSidecar::Append(const std::vector<unsigned int> &pgm, uint64_t *offset) {
+    std::lock_guard<std::mutex> lock(lock_);
+    if (!file_ && !open_failed_) {
+        // tmpfile() is unlinked at creation, so the spill can never outlive the process.  If it
+        // fails (e.g. an unwritable temp directory), remember that and stop retrying.
+        file_ = tmpfile();
+        open_failed_ = (file_ == nullptr);
+    }
+    if (!file_) return false;
+    if (0 != GpuSidecarSeek(file_, size_)) return false;
+    if (fwrite(pgm.data(), sizeof(unsigned int), pgm.size(), file_) != pgm.size()) return false;
+    fflush(file_);  // make the bytes visible to a later mapping of the file
+    *offset = size_;
+    size_ += pgm.size() * sizeof(unsigned int);
+    return true;
+}
+
+std::vector<unsigned int> GpuShaderDebugSidecar::Fetch(uint64_t offset, uint32_t word_count) const {
+    std::vector<unsigned int> pgm;
+    std::lock_guard<std::mutex> lock(lock_);
+    if (!file_ || !word_count) return pgm;
+    const size_t byte_count = word_count * sizeof(unsigned int);
+#if !defined(_WIN32)
+    // Map only the pages covering the requested module, so an error decode reads back just the
+    // faulted module rather than paging the whole spill
+    const uint64_t page_mask = static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) - 1;
+    const uint64_t map_base = offset & ~page_mask;
+    const size_t map_size = static_cast<size_t>(offset - map_base) + byte_count;
+    void *mapping = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fileno(file_), static_cast<off_t>(map_base));
+    if (mapping != MAP_FAILED) {
+        const unsigned int *words =
+            reinterpret_cast<const unsigned int *>(static_cast<const char *>(mapping) + (offset - map_base));
+        pgm.assign(words, words + word_count);
+        munmap(mapping, map_size);
+        return pgm;
+    }
+#endif
+    if (0 == GpuSidecarSeek(file_, offset)) {
+        pgm.resize(word_count);
+        if (fread(pgm.data(), sizeof(unsigned int), word_count, file_) != word_count) pgm.clear();
+    }
+    return pgm;
+}
+
+void GpuLoadInstrumentedShaderCache(const std::string &path) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) return;
+    uint32_t header[2] = {};
+    if (fread(header, sizeof(uint32_t), 2, file) == 2 && header[0] == kGpuInstrumentedCacheMagic &&
+        header[1] == kGpuInstrumentedCacheVersion) {
+        for (;;) {
+            uint32_t entry[5];  // hash, shader id, bind slot, options, word count
+            if (fread(entry, sizeof(uint32_t), 5, file) != 5) break;
+            std::vector<unsigned int> pgm(entry[4]);
+            if (fread(pgm.data(), sizeof(uint32_t), entry[4], file) != entry[4]) break;
+            std::lock_guard<std::mutex> lock(gpu_instrumented_cache_lock);
+            gpu_instrumented_cache[std::make_tuple(entry[0], entry[1], entry[2], entry[3])] = std::move(pgm);
+        }
+    }
+    fclose(file);
+}
+
+void GpuWriteInstrumentedShaderCache(const std::string &path) {
+    std::lock_guard<std::mutex> lock(gpu_instrumented_cache_lock);
+    if (gpu_instrumented_cache.empty()) return;
+    std::string temp_path = path + ".tmp";
+    FILE *file = fopen(temp_path.c_str(), "wb");
+    if (!file) return;
+    uint32_t header[2] = {kGpuInstrumentedCacheMagic, kGpuInstrumentedCacheVersion};
+    bool written = fwrite(header, sizeof(uint32_t), 2, file) == 2;
+    for (auto const &entry : gpu_instrumented_cache) {
+        if (!written) break;
+        uint32_t fields[5] = {std::get<0>(entry.first), std::get<1>(entry.first), std::get<2>(entry.first),
+                              std::get<3>(entry.first), static_cast<uint32_t>(entry.second.size())};
+        written &= fwrite(fields, sizeof(uint32_t), 5, file) == 5;
+        written &= fwrite(entry.second.data(), sizeof(uint32_t), entry.second.size(), file) == entry.second.size();
+    }
+    written &= (0 == fclose(file));
+    if (written) {
+#if defined(_WIN32)
+        remove(path.c_str());  // rename() can't replace an existing file here
+#endif
+        rename(temp_path.c_str(), path.c_str());
+    } else {
+        remove(temp_path.c_str());
+    }
+}
+
 bool CoreChecks::GpuInstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo, std::vector<unsigned int> &new_pgm,
                                      uint32_t *unique_shader_id) {
     if (gpu_validation_state->aborted) return false;
     if (pCreateInfo->pCode[0] != spv::MagicNumber) return false;
 
+    // If descriptor indexing is enabled, enable length checks and updated descriptor checks
+    const bool descriptor_indexing = device_extensions.vk_ext_descriptor_indexing;
+    const GpuInstrumentedShaderKey cache_key =
+        std::make_tuple(ValidationCache::MakeShaderHash(pCreateInfo), gpu_validation_state->unique_shader_module_id,
+                        gpu_validation_state->desc_set_bind_index, static_cast<uint32_t>(descriptor_indexing));
+    {
+        std::lock_guard<std::mutex> lock(gpu_instrumented_cache_lock);
+        auto it = gpu_instrumented_cache.find(cache_key);
+        if (it != gpu_instrumented_cache.end()) {
+            new_pgm = it->second;
+            *unique_shader_id = gpu_validation_state->unique_shader_module_id++;
+            return true;
+        }
+    }
+
     // Load original shader SPIR-V
     uint32_t num_words = static_cast<uint32_t>(pCreateInfo->codeSize / 4);
     new_pgm.clear();
@@ -676,8 +855,6 @@ bool CoreChecks::GpuInstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo
 
     // Call the optimizer to instrument the shader.
     // Use the unique_shader_module_id as a shader ID so we can look up its handle later in the shader_map.
-    // If descriptor indexing is enabled, enable length checks and updated descriptor checks
-    const bool descriptor_indexing = device_extensions.vk_ext_descriptor_indexing;
     using namespace spvtools;
     spv_target_env target_env = SPV_ENV_VULKAN_1_1;
     Optimizer optimizer(target_env);
@@ -689,6 +866,9 @@ bool CoreChecks::GpuInstrumentShader(const VkShaderModuleCreateInfo *pCreateInfo
     if (!pass) {
         ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT, VK_NULL_HANDLE,
                            "Failure to instrument shader.  Proceeding with non-instrumented shader.");
+    } else {
+        std::lock_guard<std::mutex> lock(gpu_instrumented_cache_lock);
+        gpu_instrumented_cache[cache_key] = new_pgm;
     }
     *unique_shader_id = gpu_validation_state->unique_shader_module_id++;
     return pass;
@@ -1085,7 +1265,11 @@ void CoreChecks::AnalyzeAndReportError(CMD_BUFFER_STATE *cb_node, VkQueue queue,
     if (it != gpu_validation_state->shader_map.end()) {
         shader_module_handle = it->second.shader_module;
         pipeline_handle = it->second.pipeline;
-        pgm = it->second.pgm;
+        if (it->second.sidecar_word_count) {
+            pgm = gpu_validation_state->debug_sidecar.Fetch(it->second.sidecar_offset, it->second.sidecar_word_count);
+        } else {
+            pgm = it->second.pgm;
+        }
     }
     GenerateValidationMessage(debug_record, validation_message, vuid_msg);
     GenerateStageMessage(debug_record, stage_message);
@@ -1101,46 +1285,55 @@ void CoreChecks::AnalyzeAndReportError(CMD_BUFFER_STATE *cb_node, VkQueue queue,
     memset(debug_output_buffer, 0, sizeof(uint32_t) * words_to_clear);
 }
 
-// For the given command buffer, map its debug data buffers and read their contents for analysis.
-void CoreChecks::ProcessInstrumentationBuffer(VkQueue queue, CMD_BUFFER_STATE *cb_node) {
-    auto gpu_buffer_list = gpu_validation_state->GetGpuBufferInfo(cb_node->commandBuffer);
-    if (cb_node && (cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd) && gpu_buffer_list.size() > 0) {
-        VkResult result;
-        char *pData;
-        uint32_t draw_index = 0;
-        uint32_t compute_index = 0;
-        uint32_t ray_trace_index = 0;
-
-        for (auto &buffer_info : gpu_buffer_list) {
-            result = vmaMapMemory(gpu_validation_state->vmaAllocator, buffer_info.output_mem_block.allocation, (void **)&pData);
-            // Analyze debug output buffer
-            if (result == VK_SUCCESS) {
-                uint32_t operation_index = 0;
-                if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                    operation_index = draw_index;
-                } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                    operation_index = compute_index;
-                } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                    operation_index = ray_trace_index;
-                } else {
-                    assert(false);
-                }
-
-                AnalyzeAndReportError(cb_node, queue, buffer_info.pipeline_bind_point, operation_index, (uint32_t *)pData);
-                vmaUnmapMemory(gpu_validation_state->vmaAllocator, buffer_info.output_mem_block.allocation);
-            }
+// For the given command buffer, snapshot its debug output blocks for the readback worker.
+void CoreChecks::GpuGatherReadbackBlocks(CMD_BUFFER_STATE *cb_node, std::vector<GpuReadbackBlock> *blocks) {
+    if (!cb_node || !(cb_node->hasDrawCmd || cb_node->hasTraceRaysCmd || cb_node->hasDispatchCmd)) return;
+    uint32_t draw_index = 0;
+    uint32_t compute_index = 0;
+    uint32_t ray_trace_index = 0;
+
+    for (auto &buffer_info : gpu_validation_state->GetGpuBufferInfo(cb_node->commandBuffer)) {
+        uint32_t operation_index = 0;
+        if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+            operation_index = draw_index++;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
+            operation_index = compute_index++;
+        } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
+            operation_index = ray_trace_index++;
+        } else {
+            assert(false);
+        }
+        GpuReadbackBlock block = {cb_node->commandBuffer, buffer_info.pipeline_bind_point, operation_index,
+                                  (const uint32_t *)buffer_info.output_mem_block.mapped};
+        blocks->push_back(block);
+    }
+}
 
-            if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
-                draw_index++;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_COMPUTE) {
-                compute_index++;
-            } else if (buffer_info.pipeline_bind_point == VK_PIPELINE_BIND_POINT_RAY_TRACING_NV) {
-                ray_trace_index++;
-            } else {
-                assert(false);
-            }
+// Collect results from the readback workers and report them on the calling (app) thread.  Called
+// before anything a worker may still be reading can be recycled or torn down: the next submit,
+// command buffer reset, and device destruction.
+void CoreChecks::GpuJoinPendingReadbacks() {
+    // Held across the drain: a caller arriving while another thread is already waiting on the
+    // swapped-out readbacks must not return until those workers are done, since it may be about
+    // to recycle blocks they are still scanning.
+    std::lock_guard<std::mutex> join_lock(gpu_validation_state->readback_join_lock);
+    std::vector<GpuPendingReadback> pending;
+    {
+        std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+        if (gpu_validation_state->pending_readbacks.empty()) return;
+        pending.swap(gpu_validation_state->pending_readbacks);
+    }
+    for (auto &readback : pending) {
+        auto results = readback.results.get();
+        for (auto &result : results) {
+            auto cb_node = GetCBState(result.command_buffer);
+            AnalyzeAndReportError(cb_node, result.queue, result.pipeline_bind_point, result.operation_index, result.data.data());
         }
     }
+    std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+    for (auto &readback : pending) {
+        gpu_validation_state->readback_fence_free_list.push_back(readback.fence);
+    }
 }
 
 // For the given command buffer, map its debug data buffers and update the status of any update after bind descriptors
@@ -1161,76 +1354,34 @@ void CoreChecks::UpdateInstrumentationBuffer(CMD_BUFFER_STATE *cb_node) {
     }
 }
 
-// Submit a memory barrier on graphics queues.
-// Lazy-create and record the needed command buffer.
-void CoreChecks::SubmitBarrier(VkQueue queue) {
-    auto queue_barrier_command_info_it =
-        gpu_validation_state->queue_barrier_command_infos.emplace(queue, GpuQueueBarrierCommandInfo{});
-    if (queue_barrier_command_info_it.second) {
-        GpuQueueBarrierCommandInfo &quere_barrier_command_info = queue_barrier_command_info_it.first->second;
-
-        uint32_t queue_family_index = 0;
-
-        auto queue_state_it = queueMap.find(queue);
-        if (queue_state_it != queueMap.end()) {
-            queue_family_index = queue_state_it->second.queueFamilyIndex;
-        }
-
-        VkResult result = VK_SUCCESS;
-
-        VkCommandPoolCreateInfo pool_create_info = {};
-        pool_create_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        pool_create_info.queueFamilyIndex = queue_family_index;
-        result = DispatchCreateCommandPool(device, &pool_create_info, nullptr, &quere_barrier_command_info.barrier_command_pool);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
-                               "Unable to create command pool for barrier CB.");
-            quere_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
-            return;
-        }
-
-        VkCommandBufferAllocateInfo buffer_alloc_info = {};
-        buffer_alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        buffer_alloc_info.commandPool = quere_barrier_command_info.barrier_command_pool;
-        buffer_alloc_info.commandBufferCount = 1;
-        buffer_alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        result = DispatchAllocateCommandBuffers(device, &buffer_alloc_info, &quere_barrier_command_info.barrier_command_buffer);
-        if (result != VK_SUCCESS) {
-            ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
-                               "Unable to create barrier command buffer.");
-            DispatchDestroyCommandPool(device, quere_barrier_command_info.barrier_command_pool, nullptr);
-            quere_barrier_command_info.barrier_command_pool = VK_NULL_HANDLE;
-            quere_barrier_command_info.barrier_command_buffer = VK_NULL_HANDLE;
-            return;
-        }
-
-        // Hook up command buffer dispatch
-        gpu_validation_state->vkSetDeviceLoaderData(device, quere_barrier_command_info.barrier_command_buffer);
-
-        // Record a global memory barrier to force availability of device memory operations to the host domain.
-        VkCommandBufferBeginInfo command_buffer_begin_info = {};
-        command_buffer_begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        result = DispatchBeginCommandBuffer(quere_barrier_command_info.barrier_command_buffer, &command_buffer_begin_info);
-        if (result == VK_SUCCESS) {
-            VkMemoryBarrier memory_barrier = {};
-            memory_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-            memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
-            memory_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
-
-            DispatchCmdPipelineBarrier(quere_barrier_command_info.barrier_command_buffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-                                       VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &memory_barrier, 0, nullptr, 0, nullptr);
-            DispatchEndCommandBuffer(quere_barrier_command_info.barrier_command_buffer);
+// Record a global memory barrier that makes the instrumentation writes available to the host at
+// the end of any primary command buffer carrying GPU-AV output blocks (directly or through
+// executed secondaries).  Folding the barrier into the app's own command buffer keeps GPU-AV from
+// wrapping every vkQueueSubmit in a separate barrier submission.
+void CoreChecks::GpuPreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer) {
+    if (gpu_validation_state->aborted) return;
+    auto cb_node = GetCBState(commandBuffer);
+    if (!cb_node) return;
+    // Secondaries may still be inside a render pass here; their blocks are covered by the
+    // barrier recorded into the primary that executes them.
+    if (cb_node->createInfo.level != VK_COMMAND_BUFFER_LEVEL_PRIMARY) return;
+    bool has_blocks = !gpu_validation_state->GetGpuBufferInfo(commandBuffer).empty();
+    if (!has_blocks) {
+        for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
+            if (!gpu_validation_state->GetGpuBufferInfo(secondaryCmdBuffer->commandBuffer).empty()) {
+                has_blocks = true;
+                break;
+            }
         }
     }
-
-    GpuQueueBarrierCommandInfo &quere_barrier_command_info = queue_barrier_command_info_it.first->second;
-    if (quere_barrier_command_info.barrier_command_buffer != VK_NULL_HANDLE) {
-        VkSubmitInfo submit_info = {};
-        submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submit_info.commandBufferCount = 1;
-        submit_info.pCommandBuffers = &quere_barrier_command_info.barrier_command_buffer;
-        DispatchQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
-    }
+    if (!has_blocks) return;
+
+    VkMemoryBarrier memory_barrier = {};
+    memory_barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    memory_barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+    memory_barrier.dstAccessMask = VK_ACCESS_HOST_READ_BIT;
+    DispatchCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1,
+                               &memory_barrier, 0, nullptr, 0, nullptr);
 }
 
 void CoreChecks::GpuPreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
@@ -1252,20 +1403,124 @@ void CoreChecks::GpuPreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount
 void CoreChecks::GpuPostCallQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
     if (gpu_validation_state->aborted) return;
 
-    SubmitBarrier(queue);
-
-    DispatchQueueWaitIdle(queue);
+    // Report anything earlier submissions' workers found, now that we are on an app thread
+    GpuJoinPendingReadbacks();
 
+    std::vector<GpuReadbackBlock> blocks;
     for (uint32_t submit_idx = 0; submit_idx < submitCount; submit_idx++) {
         const VkSubmitInfo *submit = &pSubmits[submit_idx];
         for (uint32_t i = 0; i < submit->commandBufferCount; i++) {
             auto cb_node = GetCBState(submit->pCommandBuffers[i]);
-            ProcessInstrumentationBuffer(queue, cb_node);
+            GpuGatherReadbackBlocks(cb_node, &blocks);
             for (auto secondaryCmdBuffer : cb_node->linkedCommandBuffers) {
-                ProcessInstrumentationBuffer(queue, secondaryCmdBuffer);
+                GpuGatherReadbackBlocks(secondaryCmdBuffer, &blocks);
             }
         }
     }
+    if (blocks.empty()) return;
+
+    // Rather than stalling the submitting thread on a queue wait-idle, fence the submission and
+    // hand the output block scan to the worker queue.  The worker only copies blocks that
+    // actually contain an error record; analysis and reporting happen at the next join.
+    VkFence readback_fence = VK_NULL_HANDLE;
+    {
+        std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+        if (!gpu_validation_state->readback_fence_free_list.empty()) {
+            readback_fence = gpu_validation_state->readback_fence_free_list.back();
+            gpu_validation_state->readback_fence_free_list.pop_back();
+        }
+    }
+    if (readback_fence != VK_NULL_HANDLE) {
+        DispatchResetFences(device, 1, &readback_fence);
+    } else {
+        VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+        if (DispatchCreateFence(device, &fence_info, nullptr, &readback_fence) != VK_SUCCESS) {
+            readback_fence = VK_NULL_HANDLE;
+        }
+    }
+    if (readback_fence == VK_NULL_HANDLE || DispatchQueueSubmit(queue, 0, nullptr, readback_fence) != VK_SUCCESS) {
+        // Fall back to the old synchronous path
+        if (readback_fence != VK_NULL_HANDLE) {
+            std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+            gpu_validation_state->readback_fence_free_list.push_back(readback_fence);
+        }
+        DispatchQueueWaitIdle(queue);
+        for (auto const &block : blocks) {
+            AnalyzeAndReportError(GetCBState(block.command_buffer), queue, block.pipeline_bind_point, block.operation_index,
+                                  const_cast<uint32_t *>(block.mapped));
+        }
+        return;
+    }
+
+    VkDevice wait_device = device;
+    const uint32_t buffer_size = gpu_validation_state->output_buffer_size;
+    auto task = std::make_shared<std::packaged_task<std::vector<GpuReadbackResult>()>>(
+        [wait_device, readback_fence, queue, blocks, buffer_size]() {
+            std::vector<GpuReadbackResult> results;
+            DispatchWaitForFences(wait_device, 1, &readback_fence, VK_TRUE, UINT64_MAX);
+            for (auto const &block : blocks) {
+                // A zero first word means the shader instrumentation didn't write anything
+                if (block.mapped[0] != 0) {
+                    GpuReadbackResult result;
+                    result.queue = queue;
+                    result.command_buffer = block.command_buffer;
+                    result.pipeline_bind_point = block.pipeline_bind_point;
+                    result.operation_index = block.operation_index;
+                    result.data.assign(block.mapped, block.mapped + buffer_size / sizeof(uint32_t));
+                    results.push_back(std::move(result));
+                }
+            }
+            return results;
+        });
+    GpuPendingReadback pending = {readback_fence, task->get_future()};
+    {
+        std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+        gpu_validation_state->pending_readbacks.push_back(std::move(pending));
+    }
+    VlWorkQueue::Instance().Enqueue([task]() { (*task)(); });
+}
+
+// Hand out a persistently-mapped output block, recycling one returned at command buffer reset
+// when possible so steady-state draws skip the VMA allocate/map round trip.
+bool CoreChecks::GpuAcquireOutputBlock(GpuDeviceMemoryBlock *block) {
+    bool recycled = false;
+    {
+        std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+        if (!gpu_validation_state->output_block_free_list.empty()) {
+            *block = gpu_validation_state->output_block_free_list.back();
+            gpu_validation_state->output_block_free_list.pop_back();
+            recycled = true;
+        }
+    }
+    if (!recycled) {
+        VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+        bufferInfo.size = gpu_validation_state->output_buffer_size;
+        bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+        VmaAllocationCreateInfo allocInfo = {};
+        allocInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
+        VkResult result = vmaCreateBuffer(gpu_validation_state->vmaAllocator, &bufferInfo, &allocInfo, &block->buffer,
+                                          &block->allocation, nullptr);
+        if (result != VK_SUCCESS) return false;
+        GpuAccountMemoryBlock(gpu_validation_state->vmaAllocator, block->allocation);
+        result = vmaMapMemory(gpu_validation_state->vmaAllocator, block->allocation, &block->mapped);
+        if (result != VK_SUCCESS) {
+            GpuReleaseMemoryBlock(gpu_validation_state->vmaAllocator, block->allocation);
+            vmaDestroyBuffer(gpu_validation_state->vmaAllocator, block->buffer, block->allocation);
+            return false;
+        }
+    }
+    // Clear the output block to zeros so that only error information from the gpu will be present
+    memset(block->mapped, 0, gpu_validation_state->output_buffer_size);
+    return true;
+}
+
+void CoreChecks::GpuReleaseOutputBlock(const GpuDeviceMemoryBlock &block) {
+    GpuDeviceMemoryBlock recycled = {};
+    recycled.buffer = block.buffer;
+    recycled.allocation = block.allocation;
+    recycled.mapped = block.mapped;
+    std::lock_guard<std::mutex> lock(gpu_validation_state->shared_state_lock);
+    gpu_validation_state->output_block_free_list.push_back(recycled);
 }
 
 void CoreChecks::GpuAllocateValidationResources(const VkCommandBuffer cmd_buffer, const VkPipelineBindPoint bind_point) {
@@ -1300,30 +1555,15 @@ void CoreChecks::GpuAllocateValidationResources(const VkCommandBuffer cmd_buffer
         return;
     }
 
-    // Allocate memory for the output block that the gpu will use to return any error information
+    // Grab an output block for the gpu to return any error information in
     GpuDeviceMemoryBlock output_block = {};
-    VkBufferCreateInfo bufferInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    bufferInfo.size = gpu_validation_state->output_buffer_size;
-    bufferInfo.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    VmaAllocationCreateInfo allocInfo = {};
-    allocInfo.usage = VMA_MEMORY_USAGE_GPU_TO_CPU;
-    result = vmaCreateBuffer(gpu_validation_state->vmaAllocator, &bufferInfo, &allocInfo, &output_block.buffer,
-                             &output_block.allocation, nullptr);
-    if (result != VK_SUCCESS) {
+    if (!GpuAcquireOutputBlock(&output_block)) {
         ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device),
                            "Unable to allocate device memory.  Device could become unstable.");
         gpu_validation_state->aborted = true;
         return;
     }
 
-    // Clear the output block to zeros so that only error information from the gpu will be present
-    uint32_t *pData;
-    result = vmaMapMemory(gpu_validation_state->vmaAllocator, output_block.allocation, (void **)&pData);
-    if (result == VK_SUCCESS) {
-        memset(pData, 0, gpu_validation_state->output_buffer_size);
-        vmaUnmapMemory(gpu_validation_state->vmaAllocator, output_block.allocation);
-    }
-
     GpuDeviceMemoryBlock input_block = {};
     VkWriteDescriptorSet desc_writes[2] = {};
     uint32_t desc_count = 1;
@@ -1365,6 +1605,7 @@ void CoreChecks::GpuAllocateValidationResources(const VkCommandBuffer cmd_buffer
             gpu_validation_state->aborted = true;
             return;
         }
+        GpuAccountMemoryBlock(gpu_validation_state->vmaAllocator, input_block.allocation);
 
         // Populate input buffer first with the sizes of every descriptor in every set, then with whether
         // each element of each descriptor has been written or not.  See gpu_validation.md for a more thourough
@@ -1465,8 +1706,9 @@ void CoreChecks::GpuAllocateValidationResources(const VkCommandBuffer cmd_buffer
             .emplace_back(output_block, input_block, desc_sets[0], desc_pool, bind_point);
     } else {
         ReportSetupProblem(VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, HandleToUint64(device), "Unable to find pipeline state");
+        GpuReleaseMemoryBlock(gpu_validation_state->vmaAllocator, input_block.allocation);
         vmaDestroyBuffer(gpu_validation_state->vmaAllocator, input_block.buffer, input_block.allocation);
-        vmaDestroyBuffer(gpu_validation_state->vmaAllocator, output_block.buffer, output_block.allocation);
+        GpuReleaseOutputBlock(output_block);
         gpu_validation_state->aborted = true;
         return;
     }
@@ -22,9 +22,38 @@
 #ifndef VULKAN_GPU_VALIDATION_H
 #define VULKAN_GPU_VALIDATION_H
 
+#include <cstdio>
+#include <future>
+#include <mutex>
+
+// Sidecar spill file for shader debug SPIR-V.  GPU-AV keeps every module's debug-annotated
+// SPIR-V around for error decode, which for shader-heavy content is hundreds of megabytes that
+// are almost never read.  Instead, modules are appended to an unlinked temporary file at
+// pipeline-creation time and fetched back -- by memory-mapping just the faulted module's byte
+// range where the platform supports it -- only when a validation error actually needs source
+// correlation.  The resident cost drops to one file handle plus the per-module {offset, word
+// count} pairs in the shader map.  The file is append-only; bytes belonging to destroyed
+// pipelines are not reclaimed, which still beats keeping every module resident.
+class GpuShaderDebugSidecar {
+   public:
+    ~GpuShaderDebugSidecar();
+    // Append a module's words, storing its location in *offset.  Returns false if no sidecar
+    // file could be created; the caller should then keep the words resident instead.
+    bool Append(const std::vector<unsigned int> &pgm, uint64_t *offset);
+    // Recover the module appended at the given offset; empty on read failure.
+    std::vector<unsigned int> Fetch(uint64_t offset, uint32_t word_count) const;
+
+   private:
+    FILE *file_ = nullptr;
+    bool open_failed_ = false;
+    uint64_t size_ = 0;
+    mutable std::mutex lock_;
+};
+
 struct GpuDeviceMemoryBlock {
     VkBuffer buffer;
     VmaAllocation allocation;
+    void *mapped;  // Persistent mapping; only used for the pooled output blocks
     std::unordered_map<uint32_t, const cvdescriptorset::Descriptor *> update_at_submit;
 };
 
@@ -43,11 +72,6 @@ struct GpuBufferInfo {
           pipeline_bind_point(pipeline_bind_point){};
 };
 
-struct GpuQueueBarrierCommandInfo {
-    VkCommandPool barrier_command_pool = VK_NULL_HANDLE;
-    VkCommandBuffer barrier_command_buffer = VK_NULL_HANDLE;
-};
-
 // Class to encapsulate Descriptor Set allocation.  This manager creates and destroys Descriptor Pools
 // as needed to satisfy requests for descriptor sets.
 class GpuDescriptorSetManager {
@@ -67,6 +91,33 @@ class GpuDescriptorSetManager {
 
     CoreChecks *dev_data_;
     std::unordered_map<VkDescriptorPool, struct PoolTracker> desc_pool_map_;
+    // Sets are handed out and put back from per-command-buffer record hooks, which only hold
+    // the chassis shared lock plus the dispatched command buffer's lock
+    std::mutex lock_;
+};
+
+// One output block snapshot handed to the readback worker: where the gpu writes its error
+// records, and which operation the block belongs to.
+struct GpuReadbackBlock {
+    VkCommandBuffer command_buffer;
+    VkPipelineBindPoint pipeline_bind_point;
+    uint32_t operation_index;
+    const uint32_t *mapped;
+};
+
+// An output block the worker found an error record in, copied off the mapped memory so it can be
+// analyzed and reported from an app thread at the next join point.
+struct GpuReadbackResult {
+    VkQueue queue;
+    VkCommandBuffer command_buffer;
+    VkPipelineBindPoint pipeline_bind_point;
+    uint32_t operation_index;
+    std::vector<uint32_t> data;
+};
+
+struct GpuPendingReadback {
+    VkFence fence;
+    std::future<std::vector<GpuReadbackResult>> results;
 };
 
 struct GpuValidationState {
@@ -78,9 +129,27 @@ struct GpuValidationState {
     uint32_t desc_set_bind_index;
     uint32_t unique_shader_module_id;
     std::unordered_map<uint32_t, ShaderTracker> shader_map;
+    // Spilled debug SPIR-V backing the shader map entries (see GpuShaderDebugSidecar)
+    GpuShaderDebugSidecar debug_sidecar;
     std::unique_ptr<GpuDescriptorSetManager> desc_set_manager;
-    std::map<VkQueue, GpuQueueBarrierCommandInfo> queue_barrier_command_infos;
+    // Guards the containers shared across command buffers below: the command buffer map
+    // structure, the output block and readback fence free lists, and pending_readbacks.  vkCmd*
+    // and command buffer reset/free record hooks run under the chassis shared lock plus only the
+    // dispatched command buffer's lock, so recording threads on different command buffers can
+    // reach this state concurrently.
+    std::mutex shared_state_lock;
     std::unordered_map<VkCommandBuffer, std::vector<GpuBufferInfo>> command_buffer_map;  // gpu_buffer_list;
+    // Recycled output blocks, persistently mapped.  Blocks come back here at command buffer
+    // reset, so steady-state draws reuse a block instead of paying a VMA allocate/map/unmap
+    // round trip per draw.
+    std::vector<GpuDeviceMemoryBlock> output_block_free_list;
+    // Submissions whose output blocks a readback worker is still scanning, and the recycled
+    // fences that gate those scans.  Guarded by shared_state_lock; readback_join_lock is held
+    // across a drain so a second joiner cannot return while blocks it cares about may still be
+    // under a worker swapped out by the first.
+    std::vector<GpuPendingReadback> pending_readbacks;
+    std::vector<VkFence> readback_fence_free_list;
+    std::mutex readback_join_lock;
     uint32_t output_buffer_size;
     VmaAllocator vmaAllocator;
     PFN_vkSetDeviceLoaderData vkSetDeviceLoaderData;
@@ -92,6 +161,10 @@ struct GpuValidationState {
           vmaAllocator(vmaAllocator){};
 
     std::vector<GpuBufferInfo> &GetGpuBufferInfo(const VkCommandBuffer command_buffer) {
+        // Only the map structure needs the lock: mapped references are stable across other
+        // insertions, and the returned vector is private to whoever holds that command
+        // buffer's chassis lock
+        std::lock_guard<std::mutex> lock(shared_state_lock);
         auto buffer_list = command_buffer_map.find(command_buffer);
         if (buffer_list == command_buffer_map.end()) {
             std::vector<GpuBufferInfo> new_list{};
@@ -106,4 +179,8 @@ using mutex_t = std::mutex;
 using lock_guard_t = std::lock_guard<mutex_t>;
 using unique_lock_t = std::unique_lock<mutex_t>;
 
+// Disk tier of the process-global instrumented-SPIR-V cache (see gpu_validation.cpp)
+void GpuLoadInstrumentedShaderCache(const std::string &path);
+void GpuWriteInstrumentedShaderCache(const std::string &path);
+
 #endif  // VULKAN_GPU_VALIDATION_H
@@ -21,6 +21,8 @@
 #define HASH_UTIL_H_
 
 #define NOMINMAX
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <limits>
@@ -126,24 +128,48 @@ struct IsOrderedContainer {
 // which are invariant with resize/insert), with the hash and equality
 // template arguments wrapped in a shared pointer dereferencing
 // function object
+// Entries are never removed, which is what allows the concurrent structure below: steady-state
+// lookups run lock-free against an immutable published snapshot (a hit in any snapshot is
+// authoritative forever), and only first-inserts take a lock, striped by hash so parallel
+// creation bursts don't funnel through a single mutex.
 template <typename T, typename Hasher = std::hash<T>, typename KeyEqual = std::equal_to<T>>
 class Dictionary {
    public:
     using Def = T;
     using Id = std::shared_ptr<const Def>;
 
-    // Find the unique entry match the provided value, adding if needed
-    // TODO: segregate lookup from insert, using reader/write locks to reduce contention -- if needed
+    // Find the unique entry matching the provided value, adding if needed
     template <typename U = T>
     Id look_up(U &&value) {
-        // We create an Id from the value, which will either be retained by dict (if new) or deleted on return (if extant)
-        Id from_input = std::make_shared<T>(std::forward<U>(value));
-
-        // Insert takes care of the "unique" id part by rejecting the insert if a key matching by_value exists, but returning us
-        // the Id of the extant shared_pointer(id->def) instead.
-        // return the value of the Iterator from the <Iterator, bool> pair returned by insert
-        Guard g(lock);  // Dict isn't thread safe, and use is presumed to be multi-threaded
-        return *dict.insert(from_input).first;
+        // Non-owning alias of the input for find(); never retained by any table
+        const T &key = value;
+        const Id probe(Id(), &key);
+
+        // Lock-free fast path against the published snapshot
+        const auto snapshot = std::atomic_load(&snapshot_);
+        if (snapshot) {
+            const auto found = snapshot->find(probe);
+            if (found != snapshot->end()) return *found;
+        }
+
+        // Miss: check (and insert into) the owning shard under its stripe lock.  The Id is only
+        // created on a genuine first-insert, so extant lookups that miss a stale snapshot still
+        // avoid the allocation the old single-lock design paid on every call.
+        Shard &shard = shards_[HashKeyValue()(probe) & (kShardCount - 1)];
+        Id result;
+        bool inserted = false;
+        {
+            Guard g(shard.lock);
+            const auto found = shard.dict.find(probe);
+            if (found != shard.dict.end()) {
+                result = *found;
+            } else {
+                result = *shard.dict.insert(std::make_shared<T>(std::forward<U>(value))).first;
+                inserted = true;
+            }
+        }
+        if (inserted) MaybePublishSnapshot();
+        return result;
     }
 
    private:
@@ -156,8 +182,40 @@ class Dictionary {
     using Dict = std::unordered_set<Id, HashKeyValue, KeyValueEqual>;
     using Lock = std::mutex;
     using Guard = std::lock_guard<Lock>;
-    Lock lock;
-    Dict dict;
+
+    // Enum rather than static const members so std::max below doesn't ODR-use them
+    enum : size_t { kShardCount = 16 /* must be a power of two */, kPublishBatch = 16 };
+    struct Shard {
+        Lock lock;
+        Dict dict;
+    };
+
+    // Republish the merged snapshot once enough inserts have accumulated since the last publish.
+    // Inserts are rare after load, so the occasional O(n) rebuild amortizes away; lookups racing a
+    // rebuild simply fall through to the shard path.
+    void MaybePublishSnapshot() {
+        const size_t pending = pending_inserts_.fetch_add(1, std::memory_order_relaxed) + 1;
+        const auto snapshot = std::atomic_load(&snapshot_);
+        const size_t published = snapshot ? snapshot->size() : 0;
+        if (pending < std::max<size_t>(kPublishBatch, published / 4)) return;
+
+        Guard g(publish_lock_);
+        if (pending_inserts_.load(std::memory_order_relaxed) < std::max<size_t>(kPublishBatch, published / 4)) {
+            return;  // another thread published while we waited
+        }
+        auto next = std::make_shared<Dict>();
+        for (auto &shard : shards_) {
+            Guard sg(shard.lock);
+            next->insert(shard.dict.begin(), shard.dict.end());
+        }
+        pending_inserts_.store(0, std::memory_order_relaxed);
+        std::atomic_store(&snapshot_, std::shared_ptr<const Dict>(std::move(next)));
+    }
+
+    Shard shards_[kShardCount];
+    std::shared_ptr<const Dict> snapshot_;
+    std::atomic<size_t> pending_inserts_{0};
+    Lock publish_lock_;
 };
 }  // namespace hash_util
 
@@ -61,29 +61,52 @@ struct ObjTrackState {
     std::unique_ptr<std::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
 };
 
+typedef std::shared_ptr<ObjTrackState> ObjTrackStateSharedPtr;
+
 // Track Queue information
 struct ObjTrackQueueInfo {
     uint32_t queue_node_index;
     VkQueue queue;
 };
 
-typedef std::unordered_map<uint64_t, ObjTrackState *> object_map_type;
+// Sharded, individually locked map so concurrent ValidateObject lookups from recording threads
+// proceed without serializing; exclusive access is confined to the shard being created into or
+// destroyed from.  Values are shared_ptrs so a reader that found a node keeps it alive even if
+// another thread destroys the object while the node is being inspected.
+typedef vl_concurrent_unordered_map<uint64_t, ObjTrackStateSharedPtr> object_map_type;
 
 class ObjectLifetimes : public ValidationObject {
    public:
-    uint64_t num_objects[kVulkanObjectTypeMax + 1];
-    uint64_t num_total_objects;
-    // Vector of unordered_maps per object type to hold ObjTrackState info
-    std::vector<object_map_type> object_map;
+    // Object counts are only statistics; relaxed atomics keep them coherent without a lock
+    std::atomic<uint64_t> num_objects[kVulkanObjectTypeMax + 1];
+    std::atomic<uint64_t> num_total_objects;
+    // Array of sharded maps per object type to hold ObjTrackState info
+    object_map_type object_map[kVulkanObjectTypeMax + 1];
     // Special-case map for swapchain images
-    std::unordered_map<uint64_t, ObjTrackState *> swapchainImageMap;
-    // Map of queue information structures, one per queue
+    object_map_type swapchainImageMap;
+    // Map of queue information structures, one per queue; low-frequency, guarded by its own lock
+    std::mutex queue_info_lock;
     std::unordered_map<VkQueue, ObjTrackQueueInfo *> queue_info_map;
+    // Guards the per-descriptor-pool child_objects sets
+    std::mutex pool_children_lock;
 
     std::vector<VkQueueFamilyProperties> queue_family_properties;
 
     // Constructor for object lifetime tracking
-    ObjectLifetimes() : num_objects{}, num_total_objects(0), object_map{} { object_map.resize(kVulkanObjectTypeMax + 1); }
+    ObjectLifetimes() : num_total_objects(0) {
+        for (auto &count : num_objects) count = 0;
+    }
+
+    // Override chassis read/write locks for this validation object.
+    // This override takes a deferred lock. i.e. it is not acquired.
+    // The object maps are internally synchronized, so hooks -- including the create/destroy
+    // record hooks -- run concurrently instead of excluding every validate hook in flight.
+    std::unique_lock<std::shared_timed_mutex> write_lock() {
+        return std::unique_lock<std::shared_timed_mutex>(validation_object_mutex, std::defer_lock);
+    }
+    std::shared_lock<std::shared_timed_mutex> read_lock() {
+        return std::shared_lock<std::shared_timed_mutex>(validation_object_mutex, std::defer_lock);
+    }
 
     bool DeviceReportUndestroyedObjects(VkDevice device, VulkanObjectType object_type, const std::string &error_code);
     void DeviceDestroyUndestroyedObjects(VkDevice device, VulkanObjectType object_type);
@@ -129,20 +152,18 @@ class ObjectLifetimes : public ValidationObject {
         VkDebugReportObjectTypeEXT debug_object_type = get_debug_report_enum[object_type];
 
         // Look for object in object map
-        if (object_map[object_type].find(object_handle) == object_map[object_type].end()) {
+        if (!object_map[object_type].contains(object_handle)) {
             // If object is an image, also look for it in the swapchain image map
-            if ((object_type != kVulkanObjectTypeImage) || (swapchainImageMap.find(object_handle) == swapchainImageMap.end())) {
+            if ((object_type != kVulkanObjectTypeImage) || (!swapchainImageMap.contains(object_handle))) {
                 // Object not found, look for it in other device object maps
                 for (auto other_device_data : layer_data_map) {
                     for (auto layer_object_data : other_device_data.second->object_dispatch) {
                         if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
                             auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
                             if (object_lifetime_data && (object_lifetime_data != this)) {
-                                if (object_lifetime_data->object_map[object_type].find(object_handle) !=
-                                        object_lifetime_data->object_map[object_type].end() ||
+                                if (object_lifetime_data->object_map[object_type].contains(object_handle) ||
                                     (object_type == kVulkanObjectTypeImage &&
-                                     object_lifetime_data->swapchainImageMap.find(object_handle) !=
-                                         object_lifetime_data->swapchainImageMap.end())) {
+                                     object_lifetime_data->swapchainImageMap.contains(object_handle))) {
                                     // Object found on other device, report an error if object has a device parent error code
                                     if ((wrong_device_code != kVUIDUndefined) && (object_type != kVulkanObjectTypeSurfaceKHR)) {
                                         return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, debug_object_type, object_handle,
@@ -170,19 +191,21 @@ class ObjectLifetimes : public ValidationObject {
     void CreateObject(T1 dispatchable_object, T2 object, VulkanObjectType object_type, const VkAllocationCallbacks *pAllocator) {
         uint64_t object_handle = HandleToUint64(object);
         bool custom_allocator = (pAllocator != nullptr);
-        if (!object_map[object_type].count(object_handle)) {
-            ObjTrackState *pNewObjNode = new ObjTrackState;
+        if (!object_map[object_type].contains(object_handle)) {
+            auto pNewObjNode = std::make_shared<ObjTrackState>();
             pNewObjNode->object_type = object_type;
             pNewObjNode->status = custom_allocator ? OBJSTATUS_CUSTOM_ALLOCATOR : OBJSTATUS_NONE;
             pNewObjNode->handle = object_handle;
 
-            object_map[object_type][object_handle] = pNewObjNode;
-            num_objects[object_type]++;
-            num_total_objects++;
-
             if (object_type == kVulkanObjectTypeDescriptorPool) {
                 pNewObjNode->child_objects.reset(new std::unordered_set<uint64_t>);
             }
+
+            // insert() is atomic; if another thread raced us here, only the winner counts the object
+            if (object_map[object_type].insert(object_handle, pNewObjNode)) {
+                num_objects[object_type]++;
+                num_total_objects++;
+            }
         }
     }
 
@@ -191,27 +214,23 @@ class ObjectLifetimes : public ValidationObject {
         auto object_handle = HandleToUint64(object);
         assert(object_handle != VK_NULL_HANDLE);
 
-        auto item = object_map[object_type].find(object_handle);
-        assert(item != object_map[object_type].end());
+        auto item = object_map[object_type].pop(object_handle);
+        if (item == object_map[object_type].end()) {
+            // Two threads raced to destroy the same object; the winner already accounted for it
+            return;
+        }
 
-        ObjTrackState *pNode = item->second;
         assert(num_total_objects > 0);
-
         num_total_objects--;
-        assert(num_objects[pNode->object_type] > 0);
-
-        num_objects[pNode->object_type]--;
-
-        delete pNode;
-        object_map[object_type].erase(item);
+        assert(num_objects[item->second->object_type] > 0);
+        num_objects[item->second->object_type]--;
     }
 
     template <typename T1, typename T2>
     void RecordDestroyObject(T1 dispatchable_object, T2 object, VulkanObjectType object_type) {
         auto object_handle = HandleToUint64(object);
         if (object_handle != VK_NULL_HANDLE) {
-            auto item = object_map[object_type].find(object_handle);
-            if (item != object_map[object_type].end()) {
+            if (object_map[object_type].contains(object_handle)) {
                 DestroyObjectSilently(object, object_type);
             }
         }
@@ -229,7 +248,7 @@ class ObjectLifetimes : public ValidationObject {
         if (object_handle != VK_NULL_HANDLE) {
             auto item = object_map[object_type].find(object_handle);
             if (item != object_map[object_type].end()) {
-                ObjTrackState *pNode = item->second;
+                const ObjTrackStateSharedPtr &pNode = item->second;
                 auto allocated_with_custom = (pNode->status & OBJSTATUS_CUSTOM_ALLOCATOR) ? true : false;
                 if (allocated_with_custom && !custom_allocator && expected_custom_allocator_code != kVUIDUndefined) {
                     // This check only verifies that custom allocation callbacks were provided to both Create and Destroy calls,
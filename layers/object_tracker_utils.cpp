@@ -36,6 +36,7 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
 
 // Add new queue to head of global queue list
 void ObjectLifetimes::AddQueueInfo(VkDevice device, uint32_t queue_node_index, VkQueue queue) {
+    std::lock_guard<std::mutex> lock(queue_info_lock);
     auto queueItem = queue_info_map.find(queue);
     if (queueItem == queue_info_map.end()) {
         ObjTrackQueueInfo *p_queue_info = new ObjTrackQueueInfo;
@@ -54,26 +55,23 @@ void ObjectLifetimes::AddQueueInfo(VkDevice device, uint32_t queue_node_index, V
 
 // Destroy memRef lists and free all memory
 void ObjectLifetimes::DestroyQueueDataStructures(VkDevice device) {
-    for (auto queue_item : queue_info_map) {
-        delete queue_item.second;
+    {
+        std::lock_guard<std::mutex> lock(queue_info_lock);
+        for (auto queue_item : queue_info_map) {
+            delete queue_item.second;
+        }
+        queue_info_map.clear();
     }
-    queue_info_map.clear();
 
     // Destroy the items in the queue map
-    auto queue = object_map[kVulkanObjectTypeQueue].begin();
-    while (queue != object_map[kVulkanObjectTypeQueue].end()) {
-        uint32_t obj_index = queue->second->object_type;
-        assert(num_total_objects > 0);
-        num_total_objects--;
-        assert(num_objects[obj_index] > 0);
-        num_objects[obj_index]--;
-        delete queue->second;
-        queue = object_map[kVulkanObjectTypeQueue].erase(queue);
+    for (const auto &queue : object_map[kVulkanObjectTypeQueue].snapshot()) {
+        DestroyObjectSilently(queue.first, kVulkanObjectTypeQueue);
     }
 }
 
 // Check Queue type flags for selected queue operations
 void ObjectLifetimes::ValidateQueueFlags(VkQueue queue, const char *function) {
+    std::lock_guard<std::mutex> lock(queue_info_lock);
     auto queue_item = queue_info_map.find(queue);
     if (queue_item != queue_info_map.end()) {
         ObjTrackQueueInfo *pQueueInfo = queue_item->second;
@@ -94,8 +92,8 @@ bool ObjectLifetimes::ValidateDeviceObject(const VulkanTypedHandle &device_typed
                                            const char *wrong_device_code) {
     auto instance_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     auto instance_object_lifetime_data = GetObjectLifetimeData(instance_data->object_dispatch);
-    for (auto object : instance_object_lifetime_data->object_map[kVulkanObjectTypeDevice]) {
-        if (object.second->handle == device_typed.handle) return false;
+    if (instance_object_lifetime_data->object_map[kVulkanObjectTypeDevice].contains(device_typed.handle)) {
+        return false;
     }
     return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT, device_typed.handle,
                    invalid_handle_code, "Invalid %s.", report_data->FormatHandle(device_typed).c_str());
@@ -103,7 +101,7 @@ bool ObjectLifetimes::ValidateDeviceObject(const VulkanTypedHandle &device_typed
 
 void ObjectLifetimes::AllocateCommandBuffer(VkDevice device, const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
                                             VkCommandBufferLevel level) {
-    ObjTrackState *pNewObjNode = new ObjTrackState;
+    auto pNewObjNode = std::make_shared<ObjTrackState>();
     pNewObjNode->object_type = kVulkanObjectTypeCommandBuffer;
     pNewObjNode->handle = HandleToUint64(command_buffer);
     pNewObjNode->parent_object = HandleToUint64(command_pool);
@@ -112,16 +110,18 @@ void ObjectLifetimes::AllocateCommandBuffer(VkDevice device, const VkCommandPool
     } else {
         pNewObjNode->status = OBJSTATUS_NONE;
     }
-    object_map[kVulkanObjectTypeCommandBuffer][HandleToUint64(command_buffer)] = pNewObjNode;
-    num_objects[kVulkanObjectTypeCommandBuffer]++;
-    num_total_objects++;
+    if (object_map[kVulkanObjectTypeCommandBuffer].insert(HandleToUint64(command_buffer), pNewObjNode)) {
+        num_objects[kVulkanObjectTypeCommandBuffer]++;
+        num_total_objects++;
+    }
 }
 
 bool ObjectLifetimes::ValidateCommandBuffer(VkDevice device, VkCommandPool command_pool, VkCommandBuffer command_buffer) {
     bool skip = false;
     uint64_t object_handle = HandleToUint64(command_buffer);
-    if (object_map[kVulkanObjectTypeCommandBuffer].find(object_handle) != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-        ObjTrackState *pNode = object_map[kVulkanObjectTypeCommandBuffer][HandleToUint64(command_buffer)];
+    auto item = object_map[kVulkanObjectTypeCommandBuffer].find(object_handle);
+    if (item != object_map[kVulkanObjectTypeCommandBuffer].end()) {
+        const ObjTrackStateSharedPtr &pNode = item->second;
 
         if (pNode->parent_object != HandleToUint64(command_pool)) {
             // We know that the parent *must* be a command pool
@@ -141,19 +141,20 @@ bool ObjectLifetimes::ValidateCommandBuffer(VkDevice device, VkCommandPool comma
 }
 
 void ObjectLifetimes::AllocateDescriptorSet(VkDevice device, VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set) {
-    ObjTrackState *pNewObjNode = new ObjTrackState;
+    auto pNewObjNode = std::make_shared<ObjTrackState>();
     pNewObjNode->object_type = kVulkanObjectTypeDescriptorSet;
     pNewObjNode->status = OBJSTATUS_NONE;
     pNewObjNode->handle = HandleToUint64(descriptor_set);
     pNewObjNode->parent_object = HandleToUint64(descriptor_pool);
-    object_map[kVulkanObjectTypeDescriptorSet][HandleToUint64(descriptor_set)] = pNewObjNode;
-    num_objects[kVulkanObjectTypeDescriptorSet]++;
-    num_total_objects++;
+    if (object_map[kVulkanObjectTypeDescriptorSet].insert(HandleToUint64(descriptor_set), pNewObjNode)) {
+        num_objects[kVulkanObjectTypeDescriptorSet]++;
+        num_total_objects++;
+    }
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        ObjTrackState *pPoolNode = itr->second;
-        pPoolNode->child_objects->insert(HandleToUint64(descriptor_set));
+        std::lock_guard<std::mutex> lock(pool_children_lock);
+        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
     }
 }
 
@@ -162,7 +163,7 @@ bool ObjectLifetimes::ValidateDescriptorSet(VkDevice device, VkDescriptorPool de
     uint64_t object_handle = HandleToUint64(descriptor_set);
     auto dsItem = object_map[kVulkanObjectTypeDescriptorSet].find(object_handle);
     if (dsItem != object_map[kVulkanObjectTypeDescriptorSet].end()) {
-        ObjTrackState *pNode = dsItem->second;
+        const ObjTrackStateSharedPtr &pNode = dsItem->second;
 
         if (pNode->parent_object != HandleToUint64(descriptor_pool)) {
             // We know that the parent *must* be a descriptor pool
@@ -240,34 +241,32 @@ bool ObjectLifetimes::PreCallValidateCmdPushDescriptorSetKHR(VkCommandBuffer com
 }
 
 void ObjectLifetimes::CreateQueue(VkDevice device, VkQueue vkObj) {
-    ObjTrackState *p_obj_node = NULL;
-    auto queue_item = object_map[kVulkanObjectTypeQueue].find(HandleToUint64(vkObj));
-    if (queue_item == object_map[kVulkanObjectTypeQueue].end()) {
-        p_obj_node = new ObjTrackState;
-        object_map[kVulkanObjectTypeQueue][HandleToUint64(vkObj)] = p_obj_node;
-        num_objects[kVulkanObjectTypeQueue]++;
-        num_total_objects++;
-    } else {
-        p_obj_node = queue_item->second;
+    if (object_map[kVulkanObjectTypeQueue].contains(HandleToUint64(vkObj))) {
+        return;
     }
+    auto p_obj_node = std::make_shared<ObjTrackState>();
     p_obj_node->object_type = kVulkanObjectTypeQueue;
     p_obj_node->status = OBJSTATUS_NONE;
     p_obj_node->handle = HandleToUint64(vkObj);
+    if (object_map[kVulkanObjectTypeQueue].insert(HandleToUint64(vkObj), p_obj_node)) {
+        num_objects[kVulkanObjectTypeQueue]++;
+        num_total_objects++;
+    }
 }
 
 void ObjectLifetimes::CreateSwapchainImageObject(VkDevice dispatchable_object, VkImage swapchain_image, VkSwapchainKHR swapchain) {
-    ObjTrackState *pNewObjNode = new ObjTrackState;
+    auto pNewObjNode = std::make_shared<ObjTrackState>();
     pNewObjNode->object_type = kVulkanObjectTypeImage;
     pNewObjNode->status = OBJSTATUS_NONE;
     pNewObjNode->handle = HandleToUint64(swapchain_image);
     pNewObjNode->parent_object = HandleToUint64(swapchain);
-    swapchainImageMap[HandleToUint64(swapchain_image)] = pNewObjNode;
+    swapchainImageMap.insert(HandleToUint64(swapchain_image), pNewObjNode);
 }
 
 bool ObjectLifetimes::DeviceReportUndestroyedObjects(VkDevice device, VulkanObjectType object_type, const std::string &error_code) {
     bool skip = false;
-    for (const auto &item : object_map[object_type]) {
-        const ObjTrackState *object_info = item.second;
+    for (const auto &item : object_map[object_type].snapshot()) {
+        const ObjTrackStateSharedPtr &object_info = item.second;
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, get_debug_report_enum[object_type], object_info->handle,
                         error_code, "OBJ ERROR : For %s, %s has not been destroyed.", report_data->FormatHandle(device).c_str(),
                         report_data->FormatHandle(ObjTrackStateTypedHandle(*object_info)).c_str());
@@ -276,11 +275,8 @@ bool ObjectLifetimes::DeviceReportUndestroyedObjects(VkDevice device, VulkanObje
 }
 
 void ObjectLifetimes::DeviceDestroyUndestroyedObjects(VkDevice device, VulkanObjectType object_type) {
-    while (!object_map[object_type].empty()) {
-        auto item = object_map[object_type].begin();
-
-        ObjTrackState *object_info = item->second;
-        DestroyObjectSilently(object_info->handle, object_type);
+    for (const auto &item : object_map[object_type].snapshot()) {
+        DestroyObjectSilently(item.second->handle, object_type);
     }
 }
 
@@ -292,8 +288,8 @@ bool ObjectLifetimes::PreCallValidateDestroyInstance(VkInstance instance, const
                            kVUIDUndefined);
 
     // Validate that child devices have been destroyed
-    for (const auto &iit : object_map[kVulkanObjectTypeDevice]) {
-        ObjTrackState *pNode = iit.second;
+    for (const auto &iit : object_map[kVulkanObjectTypeDevice].snapshot()) {
+        const ObjTrackStateSharedPtr &pNode = iit.second;
 
         VkDevice device = reinterpret_cast<VkDevice>(pNode->handle);
         VkDebugReportObjectTypeEXT debug_object_type = get_debug_report_enum[pNode->object_type];
@@ -335,25 +331,18 @@ void ObjectLifetimes::PostCallRecordEnumeratePhysicalDevices(VkInstance instance
 
 void ObjectLifetimes::PreCallRecordDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
     // Destroy physical devices
-    for (auto iit = object_map[kVulkanObjectTypePhysicalDevice].begin();
-         iit != object_map[kVulkanObjectTypePhysicalDevice].end();) {
-        ObjTrackState *pNode = iit->second;
-        VkPhysicalDevice physical_device = reinterpret_cast<VkPhysicalDevice>(pNode->handle);
+    for (const auto &iit : object_map[kVulkanObjectTypePhysicalDevice].snapshot()) {
+        VkPhysicalDevice physical_device = reinterpret_cast<VkPhysicalDevice>(iit.second->handle);
         RecordDestroyObject(instance, physical_device, kVulkanObjectTypePhysicalDevice);
-        iit = object_map[kVulkanObjectTypePhysicalDevice].begin();
     }
 
     // Destroy child devices
-    for (auto iit = object_map[kVulkanObjectTypeDevice].begin(); iit != object_map[kVulkanObjectTypeDevice].end();) {
-        ObjTrackState *pNode = iit->second;
-        VkDevice device = reinterpret_cast<VkDevice>(pNode->handle);
+    for (const auto &iit : object_map[kVulkanObjectTypeDevice].snapshot()) {
+        VkDevice device = reinterpret_cast<VkDevice>(iit.second->handle);
         DestroyUndestroyedObjects(device);
 
         RecordDestroyObject(instance, device, kVulkanObjectTypeDevice);
-        iit = object_map[kVulkanObjectTypeDevice].begin();
     }
-
-    object_map[kVulkanObjectTypeDevice].clear();
 }
 
 void ObjectLifetimes::PostCallRecordDestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
@@ -445,8 +434,8 @@ bool ObjectLifetimes::PreCallValidateResetDescriptorPool(VkDevice device, VkDesc
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        ObjTrackState *pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
+        std::lock_guard<std::mutex> lock(pool_children_lock);
+        for (auto set : *itr->second->child_objects) {
             skip |= ValidateDestroyObject(device, (VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
                                           kVUIDUndefined);
         }
@@ -460,11 +449,11 @@ void ObjectLifetimes::PreCallRecordResetDescriptorPool(VkDevice device, VkDescri
     // our descriptorSet map.
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        ObjTrackState *pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
+        std::lock_guard<std::mutex> lock(pool_children_lock);
+        for (auto set : *itr->second->child_objects) {
             RecordDestroyObject(device, (VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
         }
-        pPoolNode->child_objects->clear();
+        itr->second->child_objects->clear();
     }
 }
 
@@ -474,8 +463,9 @@ bool ObjectLifetimes::PreCallValidateBeginCommandBuffer(VkCommandBuffer command_
     skip |= ValidateObject(command_buffer, command_buffer, kVulkanObjectTypeCommandBuffer, false,
                            "VUID-vkBeginCommandBuffer-commandBuffer-parameter", kVUIDUndefined);
     if (begin_info) {
-        ObjTrackState *pNode = object_map[kVulkanObjectTypeCommandBuffer][HandleToUint64(command_buffer)];
-        if ((begin_info->pInheritanceInfo) && (pNode->status & OBJSTATUS_COMMAND_BUFFER_SECONDARY) &&
+        auto item = object_map[kVulkanObjectTypeCommandBuffer].find(HandleToUint64(command_buffer));
+        if ((item != object_map[kVulkanObjectTypeCommandBuffer].end()) && (begin_info->pInheritanceInfo) &&
+            (item->second->status & OBJSTATUS_COMMAND_BUFFER_SECONDARY) &&
             (begin_info->flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)) {
             skip |= ValidateObject(command_buffer, begin_info->pInheritanceInfo->framebuffer, kVulkanObjectTypeFramebuffer, true,
                                    "VUID-VkCommandBufferBeginInfo-flags-00055", "VUID-VkCommandBufferInheritanceInfo-commonparent");
@@ -676,15 +666,9 @@ bool ObjectLifetimes::PreCallValidateDestroySwapchainKHR(VkDevice device, VkSwap
 void ObjectLifetimes::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                        const VkAllocationCallbacks *pAllocator) {
     RecordDestroyObject(device, swapchain, kVulkanObjectTypeSwapchainKHR);
-    std::unordered_map<uint64_t, ObjTrackState *>::iterator itr = swapchainImageMap.begin();
-    while (itr != swapchainImageMap.end()) {
-        ObjTrackState *pNode = (*itr).second;
-        if (pNode->parent_object == HandleToUint64(swapchain)) {
-            delete pNode;
-            auto delete_item = itr++;
-            swapchainImageMap.erase(delete_item);
-        } else {
-            ++itr;
+    for (const auto &itr : swapchainImageMap.snapshot()) {
+        if (itr.second->parent_object == HandleToUint64(swapchain)) {
+            swapchainImageMap.erase(itr.first);
         }
     }
 }
@@ -707,7 +691,7 @@ bool ObjectLifetimes::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescr
 }
 void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                                       const VkDescriptorSet *pDescriptorSets) {
-    ObjTrackState *pPoolNode = nullptr;
+    ObjTrackStateSharedPtr pPoolNode;
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
         pPoolNode = itr->second;
@@ -715,6 +699,7 @@ void ObjectLifetimes::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescrip
     for (uint32_t i = 0; i < descriptorSetCount; i++) {
         RecordDestroyObject(device, pDescriptorSets[i], kVulkanObjectTypeDescriptorSet);
         if (pPoolNode) {
+            std::lock_guard<std::mutex> lock(pool_children_lock);
             pPoolNode->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
         }
     }
@@ -731,8 +716,8 @@ bool ObjectLifetimes::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDe
 
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        ObjTrackState *pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
+        std::lock_guard<std::mutex> lock(pool_children_lock);
+        for (auto set : *itr->second->child_objects) {
             skip |= ValidateDestroyObject(device, (VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
                                           kVUIDUndefined);
         }
@@ -746,11 +731,11 @@ void ObjectLifetimes::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDesc
                                                          const VkAllocationCallbacks *pAllocator) {
     auto itr = object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
     if (itr != object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        ObjTrackState *pPoolNode = itr->second;
-        for (auto set : *pPoolNode->child_objects) {
+        std::lock_guard<std::mutex> lock(pool_children_lock);
+        for (auto set : *itr->second->child_objects) {
             RecordDestroyObject(device, (VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet);
         }
-        pPoolNode->child_objects->clear();
+        itr->second->child_objects->clear();
     }
     RecordDestroyObject(device, descriptorPool, kVulkanObjectTypeDescriptorPool);
 }
@@ -762,15 +747,11 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
                            kVUIDUndefined);
     skip |= ValidateObject(device, commandPool, kVulkanObjectTypeCommandPool, true,
                            "VUID-vkDestroyCommandPool-commandPool-parameter", "VUID-vkDestroyCommandPool-commandPool-parent");
-    auto itr = object_map[kVulkanObjectTypeCommandBuffer].begin();
-    auto del_itr = itr;
-    while (itr != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-        ObjTrackState *pNode = (*itr).second;
-        del_itr = itr++;
-        if (pNode->parent_object == HandleToUint64(commandPool)) {
-            skip |= ValidateCommandBuffer(device, commandPool, reinterpret_cast<VkCommandBuffer>((*del_itr).first));
-            skip |= ValidateDestroyObject(device, reinterpret_cast<VkCommandBuffer>((*del_itr).first),
-                                          kVulkanObjectTypeCommandBuffer, nullptr, kVUIDUndefined, kVUIDUndefined);
+    for (const auto &itr : object_map[kVulkanObjectTypeCommandBuffer].snapshot()) {
+        if (itr.second->parent_object == HandleToUint64(commandPool)) {
+            skip |= ValidateCommandBuffer(device, commandPool, reinterpret_cast<VkCommandBuffer>(itr.first));
+            skip |= ValidateDestroyObject(device, reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer,
+                                          nullptr, kVUIDUndefined, kVUIDUndefined);
         }
     }
     skip |= ValidateDestroyObject(device, commandPool, kVulkanObjectTypeCommandPool, pAllocator,
@@ -780,14 +761,10 @@ bool ObjectLifetimes::PreCallValidateDestroyCommandPool(VkDevice device, VkComma
 
 void ObjectLifetimes::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
                                                       const VkAllocationCallbacks *pAllocator) {
-    auto itr = object_map[kVulkanObjectTypeCommandBuffer].begin();
-    auto del_itr = itr;
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    while (itr != object_map[kVulkanObjectTypeCommandBuffer].end()) {
-        ObjTrackState *pNode = (*itr).second;
-        del_itr = itr++;
-        if (pNode->parent_object == HandleToUint64(commandPool)) {
-            RecordDestroyObject(device, reinterpret_cast<VkCommandBuffer>((*del_itr).first), kVulkanObjectTypeCommandBuffer);
+    for (const auto &itr : object_map[kVulkanObjectTypeCommandBuffer].snapshot()) {
+        if (itr.second->parent_object == HandleToUint64(commandPool)) {
+            RecordDestroyObject(device, reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer);
         }
     }
     RecordDestroyObject(device, commandPool, kVulkanObjectTypeCommandPool);
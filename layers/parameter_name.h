@@ -19,9 +19,9 @@
 #define PARAMETER_NAME_H
 
 #include <cassert>
-#include <sstream>
+#include <cstdio>
+#include <cstring>
 #include <string>
-#include <vector>
 
 /**
  * Parameter name string supporting deferred formatting for array subscripts.
@@ -83,25 +83,25 @@ class ParameterName {
    private:
     /// Replace the %i format specifiers in the source string with the values from the index vector.
     std::string Format() const {
-        std::string::size_type current = 0;
-        std::string::size_type last = 0;
-        std::stringstream format;
-
-        std::string source(source_);
+        std::string name;
+        name.reserve(64);  // Typical formatted names fit in the first allocation
+        const char *current = source_;
 
         for (size_t i = 0; i < num_indices_; ++i) {
-            auto index = args_[i];
-            current = source.find(IndexFormatSpecifier, last);
-            if (current == std::string::npos) {
+            const char *specifier = strstr(current, IndexFormatSpecifier);
+            if (specifier == nullptr) {
                 break;
             }
-            format << source.substr(last, (current - last)) << index;
-            last = current + strlen(IndexFormatSpecifier);
+            name.append(current, specifier);
+            char index_string[24];
+            snprintf(index_string, sizeof(index_string), "%zu", args_[i]);
+            name.append(index_string);
+            current = specifier + strlen(IndexFormatSpecifier);
         }
 
-        format << source.substr(last, std::string::npos);
+        name.append(current);
 
-        return format.str();
+        return name;
     }
 
     /// Check that the number of %i format specifiers in the source string matches the number of elements in the index vector.
@@ -109,13 +109,11 @@ class ParameterName {
         // Count the number of occurances of the format specifier
         uint32_t count = 0;
 
-        std::string source(source_);
-
-        std::string::size_type pos = source.find(IndexFormatSpecifier);
+        const char *pos = strstr(source_, IndexFormatSpecifier);
 
-        while (pos != std::string::npos) {
+        while (pos != nullptr) {
             ++count;
-            pos = source.find(IndexFormatSpecifier, pos + 1);
+            pos = strstr(pos + 1, IndexFormatSpecifier);
         }
 
         return (count == num_indices_);
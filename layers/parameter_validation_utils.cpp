@@ -35,7 +35,7 @@ inline bool in_inclusive_range(const T &value, const T &min, const T &max) {
     return !((value < min) || (max < value));
 }
 
-bool StatelessValidation::validate_string(const char *apiName, const ParameterName &stringName, const std::string &vuid,
+bool StatelessValidation::validate_string(const char *apiName, const ParameterName &stringName, const char *vuid,
                                           const char *validateString) {
     bool skip = false;
 
@@ -205,9 +205,12 @@ bool StatelessValidation::manual_PreCallValidateCreateDevice(VkPhysicalDevice ph
                         "VK_AMD_negative_viewport_height.");
     }
 
+    // Index the create-info chain once for the queries below
+    const LvlChainIndex create_info_chain(pCreateInfo->pNext);
+
     if (pCreateInfo->pNext != NULL && pCreateInfo->pEnabledFeatures) {
         // Check for get_physical_device_properties2 struct
-        const auto *features2 = lvl_find_in_chain<VkPhysicalDeviceFeatures2KHR>(pCreateInfo->pNext);
+        const auto *features2 = create_info_chain.Find<VkPhysicalDeviceFeatures2KHR>();
         if (features2) {
             // Cannot include VkPhysicalDeviceFeatures2KHR and have non-null pEnabledFeatures
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
@@ -217,7 +220,7 @@ bool StatelessValidation::manual_PreCallValidateCreateDevice(VkPhysicalDevice ph
         }
     }
 
-    auto features2 = lvl_find_in_chain<VkPhysicalDeviceFeatures2>(pCreateInfo->pNext);
+    auto features2 = create_info_chain.Find<VkPhysicalDeviceFeatures2>();
     if (features2) {
         if (!instance_extensions.vk_khr_get_physical_device_properties_2) {
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
@@ -227,8 +230,7 @@ bool StatelessValidation::manual_PreCallValidateCreateDevice(VkPhysicalDevice ph
         }
     }
 
-    auto vertex_attribute_divisor_features =
-        lvl_find_in_chain<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>(pCreateInfo->pNext);
+    auto vertex_attribute_divisor_features = create_info_chain.Find<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>();
     if (vertex_attribute_divisor_features) {
         bool extension_found = false;
         for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; ++i) {
@@ -1166,14 +1168,12 @@ bool StatelessValidation::manual_PreCallValidateCreateGraphicsPipelines(VkDevice
                         ParameterName("pCreateInfos[%i].pViewportState->flags", ParameterName::IndexVector{i}),
                         viewport_state.flags, "VUID-VkPipelineViewportStateCreateInfo-flags-zerobitmask");
 
-                    auto exclusive_scissor_struct = lvl_find_in_chain<VkPipelineViewportExclusiveScissorStateCreateInfoNV>(
-                        pCreateInfos[i].pViewportState->pNext);
-                    auto shading_rate_image_struct = lvl_find_in_chain<VkPipelineViewportShadingRateImageStateCreateInfoNV>(
-                        pCreateInfos[i].pViewportState->pNext);
-                    auto coarse_sample_order_struct = lvl_find_in_chain<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>(
-                        pCreateInfos[i].pViewportState->pNext);
-                    const auto vp_swizzle_struct =
-                        lvl_find_in_chain<VkPipelineViewportSwizzleStateCreateInfoNV>(pCreateInfos[i].pViewportState->pNext);
+                    // Index the viewport-state chain once for the extension-struct queries below
+                    const LvlChainIndex viewport_chain(pCreateInfos[i].pViewportState->pNext);
+                    auto exclusive_scissor_struct = viewport_chain.Find<VkPipelineViewportExclusiveScissorStateCreateInfoNV>();
+                    auto shading_rate_image_struct = viewport_chain.Find<VkPipelineViewportShadingRateImageStateCreateInfoNV>();
+                    auto coarse_sample_order_struct = viewport_chain.Find<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>();
+                    const auto vp_swizzle_struct = viewport_chain.Find<VkPipelineViewportSwizzleStateCreateInfoNV>();
 
                     if (!physical_device_features.multiViewport) {
                         if (viewport_state.viewportCount != 1) {
@@ -19,9 +19,13 @@
  * Author: Dave Houlton <daveh@lunarg.com>
  */
 
+#include <algorithm>
 #include <cinttypes>
 #include <cassert>
 #include <chrono>
+#include <cstdio>
+#include <future>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <string>
@@ -36,6 +40,7 @@
 #include "core_validation.h"
 #include "shader_validation.h"
 #include "spirv-tools/libspirv.h"
+#include "vl_thread_pool.h"
 #include "xxhash.h"
 
 void decoration_set::add(uint32_t decoration, uint32_t value) {
@@ -88,8 +93,6 @@ enum FORMAT_TYPE {
     FORMAT_TYPE_UINT = 4,
 };
 
-typedef std::pair<unsigned, unsigned> location_t;
-
 struct shader_stage_attributes {
     char const *const name;
     bool arrayed_input;
@@ -938,7 +941,8 @@ static bool ValidateViAgainstVsInputs(debug_report_data const *report_data, VkPi
                                       SHADER_MODULE_STATE const *vs, spirv_inst_iter entrypoint) {
     bool skip = false;
 
-    auto inputs = CollectInterfaceByLocation(vs, entrypoint, spv::StorageClassInput, false);
+    auto reflection = vs->GetReflection(entrypoint);
+    auto inputs = reflection ? reflection->inputs : CollectInterfaceByLocation(vs, entrypoint, spv::StorageClassInput, false);
 
     // Build index by location
     std::map<uint32_t, VkVertexInputAttributeDescription const *> attribs;
@@ -1014,7 +1018,8 @@ static bool ValidateFsOutputsAgainstRenderPass(debug_report_data const *report_d
 
     // TODO: dual source blend index (spv::DecIndex, zero if not provided)
 
-    auto outputs = CollectInterfaceByLocation(fs, entrypoint, spv::StorageClassOutput, false);
+    auto reflection = fs->GetReflection(entrypoint);
+    auto outputs = reflection ? reflection->outputs : CollectInterfaceByLocation(fs, entrypoint, spv::StorageClassOutput, false);
 
     auto it_a = outputs.begin();
     auto it_b = color_attachments.begin();
@@ -1275,6 +1280,27 @@ static std::unordered_set<uint32_t> MarkAccessibleIds(SHADER_MODULE_STATE const
     return ids;
 }
 
+// Build the per-entry-point reflection tables consumed by pipeline validation, so that creating
+// many pipelines against one module walks its instruction stream once rather than once per
+// pipeline.  Called from the SHADER_MODULE_STATE constructor, after BuildDefIndex().
+void SHADER_MODULE_STATE::BuildReflection() {
+    spirv_hash = XXH32(words.data(), words.size() * sizeof(uint32_t), 0);
+    for (auto const &candidate : entry_points) {
+        if (entry_point_reflection.count(candidate.second.offset)) continue;
+        auto entrypoint = at(candidate.second.offset);
+        EntryPointReflection reflection;
+        reflection.accessible_ids = MarkAccessibleIds(this, entrypoint);
+        reflection.descriptor_uses =
+            CollectInterfaceByDescriptorSlot(nullptr, this, reflection.accessible_ids, &reflection.has_writable_descriptor);
+        reflection.input_attachment_uses = CollectInterfaceByInputAttachmentIndex(this, reflection.accessible_ids);
+        reflection.inputs = CollectInterfaceByLocation(this, entrypoint, spv::StorageClassInput, false);
+        reflection.inputs_arrayed = CollectInterfaceByLocation(this, entrypoint, spv::StorageClassInput, true);
+        reflection.outputs = CollectInterfaceByLocation(this, entrypoint, spv::StorageClassOutput, false);
+        reflection.outputs_arrayed = CollectInterfaceByLocation(this, entrypoint, spv::StorageClassOutput, true);
+        entry_point_reflection.emplace(candidate.second.offset, std::move(reflection));
+    }
+}
+
 static bool ValidatePushConstantBlockAgainstPipeline(debug_report_data const *report_data,
                                                      std::vector<VkPushConstantRange> const *push_constant_ranges,
                                                      SHADER_MODULE_STATE const *src, spirv_inst_iter type,
@@ -2647,6 +2673,18 @@ bool CoreChecks::ValidatePointListShaderState(const PIPELINE_STATE *pipeline, SH
     }
     return skip;
 }
+// Find the record for the given key in a sorted (key, value) vector, inserting a
+// default-constructed one at the sort position if not present
+template <typename SortedVec>
+static typename SortedVec::value_type::second_type &FindOrInsertSorted(SortedVec &vec, uint32_t key) {
+    auto it = std::lower_bound(vec.begin(), vec.end(), key,
+                               [](const typename SortedVec::value_type &entry, uint32_t k) { return entry.first < k; });
+    if (it == vec.end() || it->first != key) {
+        it = vec.insert(it, typename SortedVec::value_type(key, typename SortedVec::value_type::second_type()));
+    }
+    return it->second;
+}
+
 void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCreateInfo const *pStage, PIPELINE_STATE *pipeline,
                                                        PIPELINE_STATE::StageState *stage_state) {
     // Validation shouldn't rely on anything in stage state being valid if the spirv isn't
@@ -2658,15 +2696,23 @@ void ValidationStateTracker::RecordPipelineShaderStage(VkPipelineShaderStageCrea
     if (entrypoint == module->end()) return;
 
     // Mark accessible ids
-    stage_state->accessible_ids = MarkAccessibleIds(module, entrypoint);
+    auto reflection = module->GetReflection(entrypoint);
+    if (reflection) {
+        stage_state->accessible_ids = reflection->accessible_ids;
+        stage_state->descriptor_uses = reflection->descriptor_uses;
+        stage_state->has_writable_descriptor = reflection->has_writable_descriptor;
+    } else {
+        stage_state->accessible_ids = MarkAccessibleIds(module, entrypoint);
+        stage_state->descriptor_uses = CollectInterfaceByDescriptorSlot(report_data, module, stage_state->accessible_ids,
+                                                                        &stage_state->has_writable_descriptor);
+    }
     ProcessExecutionModes(module, entrypoint, pipeline);
-
-    stage_state->descriptor_uses =
-        CollectInterfaceByDescriptorSlot(report_data, module, stage_state->accessible_ids, &stage_state->has_writable_descriptor);
     // Capture descriptor uses for the pipeline
     for (auto use : stage_state->descriptor_uses) {
-        // While validating shaders capture which slots are used by the pipeline
-        auto &reqs = pipeline->active_slots[use.first.first][use.first.second];
+        // While validating shaders capture which slots are used by the pipeline.  active_slots is
+        // kept sorted as it is built so the per-draw consumers can walk it linearly.
+        auto &set_bindings = FindOrInsertSorted(pipeline->active_slots, use.first.first);
+        auto &reqs = FindOrInsertSorted(set_bindings, use.first.second);
         reqs = descriptor_req(reqs | DescriptorTypeToReqs(module, use.second.type_id));
     }
 }
@@ -2745,7 +2791,9 @@ bool CoreChecks::ValidatePipelineShaderStage(VkPipelineShaderStageCreateInfo con
 
     // Validate use of input attachments against subpass structure
     if (pStage->stage == VK_SHADER_STAGE_FRAGMENT_BIT) {
-        auto input_attachment_uses = CollectInterfaceByInputAttachmentIndex(module, accessible_ids);
+        auto reflection = module->GetReflection(entrypoint);
+        auto input_attachment_uses =
+            reflection ? reflection->input_attachment_uses : CollectInterfaceByInputAttachmentIndex(module, accessible_ids);
 
         auto rpci = pipeline->rp_state->createInfo.ptr();
         auto subpass = pipeline->graphicsPipelineCI.subpass;
@@ -2781,9 +2829,16 @@ static bool ValidateInterfaceBetweenStages(debug_report_data const *report_data,
                                            shader_stage_attributes const *consumer_stage) {
     bool skip = false;
 
-    auto outputs =
-        CollectInterfaceByLocation(producer, producer_entrypoint, spv::StorageClassOutput, producer_stage->arrayed_output);
-    auto inputs = CollectInterfaceByLocation(consumer, consumer_entrypoint, spv::StorageClassInput, consumer_stage->arrayed_input);
+    auto producer_reflection = producer->GetReflection(producer_entrypoint);
+    auto outputs = producer_reflection
+                       ? (producer_stage->arrayed_output ? producer_reflection->outputs_arrayed : producer_reflection->outputs)
+                       : CollectInterfaceByLocation(producer, producer_entrypoint, spv::StorageClassOutput,
+                                                    producer_stage->arrayed_output);
+    auto consumer_reflection = consumer->GetReflection(consumer_entrypoint);
+    auto inputs = consumer_reflection
+                      ? (consumer_stage->arrayed_input ? consumer_reflection->inputs_arrayed : consumer_reflection->inputs)
+                      : CollectInterfaceByLocation(consumer, consumer_entrypoint, spv::StorageClassInput,
+                                                   consumer_stage->arrayed_input);
 
     auto a_it = outputs.begin();
     auto b_it = inputs.begin();
@@ -2990,12 +3045,107 @@ static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *p
     return nullptr;
 }
 
+// On-disk shader validation cache file header: magic, file version, device configuration.  The
+// payload is a regular ValidationCache blob, whose own header keys the spirv-tools version.
+static const uint32_t kDiskShaderCacheMagic = 0x4c435356;  // "VSCL"
+static const uint32_t kDiskShaderCacheVersion = 1;
+static const size_t kDiskShaderCacheHeaderSize = 3 * sizeof(uint32_t);
+
+// The validator layout options change what spirv-val accepts, so cached results are only reusable
+// on a device where the same options are in effect
+uint32_t CoreChecks::DiskShaderCacheConfig() const {
+    uint32_t config = 0;
+    if (api_version >= VK_API_VERSION_1_1) config |= 0x1;
+    if (device_extensions.vk_khr_relaxed_block_layout) config |= 0x2;
+    if (device_extensions.vk_khr_uniform_buffer_standard_layout &&
+        enabled_features.uniform_buffer_standard_layout.uniformBufferStandardLayout == VK_TRUE) {
+        config |= 0x4;
+    }
+    if (device_extensions.vk_ext_scalar_block_layout &&
+        enabled_features.scalar_block_layout_features.scalarBlockLayout == VK_TRUE) {
+        config |= 0x8;
+    }
+    return config;
+}
+
+void CoreChecks::InitDiskShaderValidationCache() {
+    // Process the layer settings file.  When a path is set, modules that validated cleanly on a
+    // previous run skip spirv-val entirely; the cache is written back at device destruction.
+    const char *option = getLayerOption("khronos_validation.shader_validation_cache_path");
+    if (!option || !*option) return;
+    disk_shader_cache_path = option;
+
+    VkValidationCacheCreateInfoEXT create_info = {};
+    create_info.sType = VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT;
+
+    std::vector<uint8_t> file_data;
+    FILE *file = fopen(disk_shader_cache_path.c_str(), "rb");
+    if (file) {
+        fseek(file, 0, SEEK_END);
+        long file_size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        if (file_size >= static_cast<long>(kDiskShaderCacheHeaderSize)) {
+            file_data.resize(file_size);
+            if (fread(file_data.data(), 1, file_size, file) == static_cast<size_t>(file_size)) {
+                uint32_t const *header = reinterpret_cast<uint32_t const *>(file_data.data());
+                // A stale or foreign file just means a cold start
+                if (header[0] == kDiskShaderCacheMagic && header[1] == kDiskShaderCacheVersion &&
+                    header[2] == DiskShaderCacheConfig()) {
+                    create_info.initialDataSize = file_size - kDiskShaderCacheHeaderSize;
+                    create_info.pInitialData = file_data.data() + kDiskShaderCacheHeaderSize;
+                }
+            }
+        }
+        fclose(file);
+    }
+    disk_shader_cache = CastFromHandle<ValidationCache *>(ValidationCache::Create(&create_info));
+
+    if (enabled.gpu_validation) {
+        GpuLoadInstrumentedShaderCache(disk_shader_cache_path + ".gpuav");
+    }
+}
+
+void CoreChecks::WriteDiskShaderValidationCache() {
+    if (!disk_shader_cache) return;
+    size_t data_size = 0;
+    disk_shader_cache->Write(&data_size, nullptr);
+    std::vector<uint8_t> data(kDiskShaderCacheHeaderSize + data_size);
+    uint32_t *header = reinterpret_cast<uint32_t *>(data.data());
+    header[0] = kDiskShaderCacheMagic;
+    header[1] = kDiskShaderCacheVersion;
+    header[2] = DiskShaderCacheConfig();
+    disk_shader_cache->Write(&data_size, data.data() + kDiskShaderCacheHeaderSize);
+    data.resize(kDiskShaderCacheHeaderSize + data_size);
+
+    // Write to a temporary and rename so a crash mid-write can't leave a torn cache behind
+    std::string temp_path = disk_shader_cache_path + ".tmp";
+    FILE *file = fopen(temp_path.c_str(), "wb");
+    if (file) {
+        bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+        written &= (0 == fclose(file));
+        if (written) {
+#if defined(_WIN32)
+            remove(disk_shader_cache_path.c_str());  // rename() can't replace an existing file here
+#endif
+            rename(temp_path.c_str(), disk_shader_cache_path.c_str());
+        } else {
+            remove(temp_path.c_str());
+        }
+    }
+    delete disk_shader_cache;
+    disk_shader_cache = nullptr;
+
+    if (enabled.gpu_validation) {
+        GpuWriteInstrumentedShaderCache(disk_shader_cache_path + ".gpuav");
+    }
+}
+
 bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                    const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule) {
     bool skip = false;
     spv_result_t spv_valid = SPV_SUCCESS;
 
-    if (disabled.shader_validation) {
+    if (disabled.IsDisabled(kDisableBitShaderValidation)) {
         return false;
     }
 
@@ -3009,9 +3159,14 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
     } else {
         auto cache = GetValidationCacheInfo(pCreateInfo);
         uint32_t hash = 0;
-        if (cache) {
+        if (cache || disk_shader_cache) {
             hash = ValidationCache::MakeShaderHash(pCreateInfo);
-            if (cache->Contains(hash)) return false;
+            if (cache && cache->Contains(hash)) return false;
+            if (disk_shader_cache && disk_shader_cache->Contains(hash)) {
+                // Validated cleanly on a previous run with the same spirv-tools version and options
+                if (cache) cache->Insert(hash);
+                return false;
+            }
         }
 
         // Use SPIRV-Tools validator to try and catch any issues with the module itself
@@ -3019,24 +3174,78 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
         if (api_version >= VK_API_VERSION_1_1) {
             spirv_environment = SPV_ENV_VULKAN_1_1;
         }
+        const bool relax_block_layout = device_extensions.vk_khr_relaxed_block_layout;
+        const bool uniform_standard_layout = device_extensions.vk_khr_uniform_buffer_standard_layout &&
+                                             (enabled_features.uniform_buffer_standard_layout.uniformBufferStandardLayout == VK_TRUE);
+        const bool scalar_block_layout = device_extensions.vk_ext_scalar_block_layout &&
+                                         (enabled_features.scalar_block_layout_features.scalarBlockLayout == VK_TRUE);
+        const bool report_invalid = !have_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber);
+
+        if (enabled.deferred_shader_validation) {
+            // Deferred mode: copy the blob and run spirv-val on the worker queue, overlapping it
+            // with app-side loading.  The result is joined (and any diagnostic reported) before
+            // the module can be used -- see JoinDeferredSpirvValidation().
+            std::vector<uint32_t> words(pCreateInfo->pCode, pCreateInfo->pCode + (pCreateInfo->codeSize / sizeof(uint32_t)));
+            ValidationCache *disk_cache = disk_shader_cache;
+            auto task = std::make_shared<std::packaged_task<DeferredSpirvValResult()>>(
+                [words, spirv_environment, relax_block_layout, uniform_standard_layout, scalar_block_layout, report_invalid, cache,
+                 disk_cache, hash]() {
+                    DeferredSpirvValResult deferred_result;
+                    spv_context ctx = spvContextCreate(spirv_environment);
+                    spv_const_binary_t binary{words.data(), words.size()};
+                    spv_diagnostic diag = nullptr;
+                    spv_validator_options options = spvValidatorOptionsCreate();
+                    if (relax_block_layout) {
+                        spvValidatorOptionsSetRelaxBlockLayout(options, true);
+                    }
+                    if (uniform_standard_layout) {
+                        spvValidatorOptionsSetUniformBufferStandardLayout(options, true);
+                    }
+                    if (scalar_block_layout) {
+                        spvValidatorOptionsSetScalarBlockLayout(options, true);
+                    }
+                    spv_result_t result = spvValidateWithOptions(ctx, options, &binary, &diag);
+                    if (result != SPV_SUCCESS) {
+                        if (report_invalid) {
+                            deferred_result.failed = true;
+                            deferred_result.warning = (result == SPV_WARNING);
+                            deferred_result.error = diag && diag->error ? diag->error : "(no error text)";
+                        }
+                    } else {
+                        // Inserted at join time, before any cache teardown or serialization
+                        deferred_result.cache = cache;
+                        deferred_result.disk_cache = disk_cache;
+                        deferred_result.hash = hash;
+                    }
+                    spvValidatorOptionsDestroy(options);
+                    spvDiagnosticDestroy(diag);
+                    spvContextDestroy(ctx);
+                    return deferred_result;
+                });
+            {
+                std::lock_guard<std::mutex> lock(deferred_spirv_val_lock);
+                deferred_spirv_val_results.emplace_back(task->get_future());
+            }
+            VlWorkQueue::Instance().Enqueue([task]() { (*task)(); });
+            return false;
+        }
+
         spv_context ctx = spvContextCreate(spirv_environment);
         spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
         spv_diagnostic diag = nullptr;
         spv_validator_options options = spvValidatorOptionsCreate();
-        if (device_extensions.vk_khr_relaxed_block_layout) {
+        if (relax_block_layout) {
             spvValidatorOptionsSetRelaxBlockLayout(options, true);
         }
-        if (device_extensions.vk_khr_uniform_buffer_standard_layout &&
-            enabled_features.uniform_buffer_standard_layout.uniformBufferStandardLayout == VK_TRUE) {
+        if (uniform_standard_layout) {
             spvValidatorOptionsSetUniformBufferStandardLayout(options, true);
         }
-        if (device_extensions.vk_ext_scalar_block_layout &&
-            enabled_features.scalar_block_layout_features.scalarBlockLayout == VK_TRUE) {
+        if (scalar_block_layout) {
             spvValidatorOptionsSetScalarBlockLayout(options, true);
         }
         spv_valid = spvValidateWithOptions(ctx, options, &binary, &diag);
         if (spv_valid != SPV_SUCCESS) {
-            if (!have_glsl_shader || (pCreateInfo->pCode[0] == spv::MagicNumber)) {
+            if (report_invalid) {
                 skip |=
                     log_msg(report_data, spv_valid == SPV_WARNING ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
                             VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, kVUID_Core_Shader_InconsistentSpirv,
@@ -3046,6 +3255,9 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
             if (cache) {
                 cache->Insert(hash);
             }
+            if (disk_shader_cache) {
+                disk_shader_cache->Insert(hash);
+            }
         }
 
         spvValidatorOptionsDestroy(options);
@@ -3056,6 +3268,33 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
     return skip;
 }
 
+// Join any spirv-val runs still in flight on the worker queue and report their diagnostics.
+// Called wherever deferred results can become observable: pipeline creation against the module,
+// validation cache teardown/serialization, and device destruction.  Callers hold only the shared
+// chassis lock, so the join lock is held across the drain -- a second joiner must not return
+// before results another thread swapped out have been reported and their cache entries inserted
+// (the insertions themselves go through ValidationCache's internal mutex).
+void CoreChecks::JoinDeferredSpirvValidation() {
+    std::lock_guard<std::mutex> join_lock(deferred_spirv_val_join_lock);
+    std::vector<std::future<DeferredSpirvValResult>> pending;
+    {
+        std::lock_guard<std::mutex> lock(deferred_spirv_val_lock);
+        if (deferred_spirv_val_results.empty()) return;
+        pending.swap(deferred_spirv_val_results);
+    }
+    for (auto &pending_result : pending) {
+        DeferredSpirvValResult result = pending_result.get();
+        if (result.failed) {
+            log_msg(report_data, result.warning ? VK_DEBUG_REPORT_WARNING_BIT_EXT : VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                    VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, kVUID_Core_Shader_InconsistentSpirv,
+                    "SPIR-V module not valid: %s", result.error.c_str());
+        } else {
+            if (result.cache) result.cache->Insert(result.hash);
+            if (result.disk_cache) result.disk_cache->Insert(result.hash);
+        }
+    }
+}
+
 void CoreChecks::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                  void *csm_state_data) {
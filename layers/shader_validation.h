@@ -20,7 +20,10 @@
 #ifndef VULKAN_SHADER_VALIDATION_H
 #define VULKAN_SHADER_VALIDATION_H
 
+#include <map>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <SPIRV/spirv.hpp>
 #include <generated/spirv_tools_commit_id.h>
@@ -106,6 +109,18 @@ struct decoration_set {
     void add(uint32_t decoration, uint32_t value);
 };
 
+struct interface_var {
+    uint32_t id;
+    uint32_t type_id;
+    uint32_t offset;
+    bool is_patch;
+    bool is_block_member;
+    bool is_relaxed_precision;
+    // TODO: collect the name, too? Isn't required to be present.
+};
+typedef std::pair<unsigned, unsigned> descriptor_slot_t;
+typedef std::pair<unsigned, unsigned> location_t;
+
 struct SHADER_MODULE_STATE {
     // The spirv image itself
     std::vector<uint32_t> words;
@@ -118,6 +133,25 @@ struct SHADER_MODULE_STATE {
         VkShaderStageFlags stage;
     };
     std::unordered_multimap<std::string, EntryPoint> entry_points;
+    // Reflection computed once per entry point when the module is created, so per-pipeline
+    // validation reads these tables instead of rewalking the instruction stream for every
+    // pipeline that reuses the module.  Keyed by the entry point's instruction offset.
+    struct EntryPointReflection {
+        std::unordered_set<uint32_t> accessible_ids;
+        std::vector<std::pair<descriptor_slot_t, interface_var>> descriptor_uses;
+        bool has_writable_descriptor = false;
+        std::vector<std::pair<uint32_t, interface_var>> input_attachment_uses;
+        // Location-keyed interfaces, with and without the per-vertex arrayness seen by the
+        // tessellation and geometry stages
+        std::map<location_t, interface_var> inputs;
+        std::map<location_t, interface_var> inputs_arrayed;
+        std::map<location_t, interface_var> outputs;
+        std::map<location_t, interface_var> outputs_arrayed;
+    };
+    std::unordered_map<uint32_t, EntryPointReflection> entry_point_reflection;
+    // Hash of the (preprocessed) SPIR-V words, computed alongside the reflection tables; used to
+    // key pipeline-level validation caching on module contents rather than handles
+    uint32_t spirv_hash = 0;
     bool has_valid_spirv;
     VkShaderModule vk_shader_module;
     uint32_t gpu_validation_shader_id;
@@ -175,6 +209,7 @@ struct SHADER_MODULE_STATE {
           vk_shader_module(shaderModule),
           gpu_validation_shader_id(unique_shader_id) {
         BuildDefIndex();
+        BuildReflection();
     }
 
     SHADER_MODULE_STATE() : has_valid_spirv(false), vk_shader_module(VK_NULL_HANDLE) {}
@@ -201,7 +236,13 @@ struct SHADER_MODULE_STATE {
         return at(it->second);
     }
 
+    EntryPointReflection const *GetReflection(spirv_inst_iter entrypoint) const {
+        auto it = entry_point_reflection.find(entrypoint.offset());
+        return (it != entry_point_reflection.end()) ? &it->second : nullptr;
+    }
+
     void BuildDefIndex();
+    void BuildReflection();
 };
 
 class ValidationCache {
@@ -210,6 +251,10 @@ class ValidationCache {
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     std::unordered_set<uint32_t> good_shader_hashes;
+    // vkCreateShaderModule validation runs under the shared chassis lock, so two threads
+    // creating modules against the same cache probe and insert concurrently; the set is
+    // guarded here rather than relying on callers for exclusion.
+    mutable std::mutex lock_;
     ValidationCache() {}
 
    public:
@@ -220,6 +265,7 @@ class ValidationCache {
     }
 
     void Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
+        std::lock_guard<std::mutex> guard(lock_);
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
         auto size = headerSize;
         if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
@@ -239,6 +285,7 @@ class ValidationCache {
     }
 
     void Write(size_t *pDataSize, void *pData) {
+        std::lock_guard<std::mutex> guard(lock_);
         const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
         if (!pData) {
             *pDataSize = headerSize + good_shader_hashes.size() * sizeof(uint32_t);
@@ -268,15 +315,26 @@ class ValidationCache {
     }
 
     void Merge(ValidationCache const *other) {
+        // Both sets are touched, so both locks are taken -- via std::lock, since two merges
+        // with swapped operands must not deadlock
+        std::unique_lock<std::mutex> dst_guard(lock_, std::defer_lock);
+        std::unique_lock<std::mutex> src_guard(other->lock_, std::defer_lock);
+        std::lock(dst_guard, src_guard);
         good_shader_hashes.reserve(good_shader_hashes.size() + other->good_shader_hashes.size());
         for (auto h : other->good_shader_hashes) good_shader_hashes.insert(h);
     }
 
     static uint32_t MakeShaderHash(VkShaderModuleCreateInfo const *smci);
 
-    bool Contains(uint32_t hash) { return good_shader_hashes.count(hash) != 0; }
+    bool Contains(uint32_t hash) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return good_shader_hashes.count(hash) != 0;
+    }
 
-    void Insert(uint32_t hash) { good_shader_hashes.insert(hash); }
+    void Insert(uint32_t hash) {
+        std::lock_guard<std::mutex> guard(lock_);
+        good_shader_hashes.insert(hash);
+    }
 
    private:
     void Sha1ToVkUuid(const char *sha1_str, uint8_t uuid[VK_UUID_SIZE]) {
@@ -21,12 +21,38 @@
 #ifndef SPARSE_CONTAINERS_H_
 #define SPARSE_CONTAINERS_H_
 #define NOMINMAX
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace sparse_container {
+
+// Bit scan used by the dense-mode occupancy bitmap in SparseVector below
+inline uint32_t CountTrailingZeros(uint64_t word) {
+    assert(word);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(word));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return static_cast<uint32_t>(bit);
+#else
+    uint32_t count = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
 // SparseVector:
 //
 // Defines a sparse single-dimensional container which is targeted for three distinct use cases
@@ -110,9 +136,11 @@ class SparseVector {
         if (kSparseThreshold && (count > kSparseThreshold)) {
             sparse_.reset(new SparseType());
             dense_.reset();
+            occupancy_.clear();
         } else {
             sparse_.reset();
             dense_.reset(new DenseType(count, kDefaultValue));
+            occupancy_.assign(OccupancyWordCount(count), 0);  // all entries hold kDefaultValue
         }
     }
 
@@ -187,9 +215,7 @@ class SparseVector {
         } else {
             // Note that "Dense Access" does away with the full_range_value_ logic, storing empty entries using kDefaultValue
             assert(dense_);
-            for (IndexType index = start; index < end; ++index) {
-                updated = SetDense(index, value);
-            }
+            updated = SetDenseRange(start, end, value);
         }
         return updated;
     }
@@ -215,11 +241,10 @@ class SparseVector {
         } else {
             assert(from.dense_);
             DenseType &ray = *from.dense_;
-            for (IndexType entry = from.range_min_; entry < from.range_max_; ++entry) {
-                IndexType index = entry - from.range_min_;
-                if (ray[index] != kDefaultValue) {
-                    updated |= Set(entry, ray[index]);
-                }
+            // The occupancy bitmap lets us jump straight between non-default entries
+            for (IndexType entry = from.NextOccupied(from.range_min_); entry < from.range_max_;
+                 entry = from.NextOccupied(entry + 1)) {
+                updated |= Set(entry, ray[entry - from.range_min_]);
             }
         }
         return updated;
@@ -301,6 +326,10 @@ class SparseVector {
         // in the non-delegated case we use normal accessors and skip default values.
         void SetCurrentValue() {
             the_end_ = true;
+            if (!vec_->IsSparse()) {
+                // Dense mode: word-scan the occupancy bitmap straight to the next valid entry
+                index_ = vec_->NextOccupied(index_);
+            }
             while (index_ < vec_->range_max_) {
                 value_ = vec_->Get(index_);
                 if (value_ != SparseVector::DefaultValue()) {
@@ -333,6 +362,27 @@ class SparseVector {
 
     // Data for dense mode
     std::unique_ptr<DenseType> dense_;
+    // Occupancy bitmap for dense mode: bit set iff the corresponding entry differs from
+    // kDefaultValue.  Bits past the range are always clear.
+    typedef uint64_t OccupancyWord;
+    static const size_t kOccupancyWordBits = 64;
+    std::vector<OccupancyWord> occupancy_;
+
+    static size_t OccupancyWordCount(size_t count) { return (count + kOccupancyWordBits - 1) / kOccupancyWordBits; }
+    // Mask covering bits [first, last) of a word; requires first < last <= kOccupancyWordBits
+    static OccupancyWord OccupancyRangeMask(size_t first, size_t last) {
+        OccupancyWord mask = ~OccupancyWord(0) >> (kOccupancyWordBits - (last - first));
+        return mask << first;
+    }
+    void SetOccupancyBit(size_t bit, bool occupied) {
+        OccupancyWord &word = occupancy_[bit / kOccupancyWordBits];
+        const OccupancyWord mask = OccupancyWord(1) << (bit % kOccupancyWordBits);
+        if (occupied) {
+            word |= mask;
+        } else {
+            word &= ~mask;
+        }
+    }
 
     static const ValueType &DefaultValue() {
         static ValueType value = kDefaultValue;
@@ -350,10 +400,18 @@ class SparseVector {
         // If we're using more threshold of the sparse range, convert to dense_
         if (IsSparse() && (sparse_->size() > threshold_)) {
             ValueType default_value = HasFullRange() ? full_range_value_ : kDefaultValue;
-            dense_.reset(new DenseType((range_max_ - range_min_), default_value));
+            const size_t count = range_max_ - range_min_;
+            dense_.reset(new DenseType(count, default_value));
+            const bool occupied = default_value != kDefaultValue;
+            occupancy_.assign(OccupancyWordCount(count), occupied ? ~OccupancyWord(0) : 0);
+            if (occupied) {
+                const size_t tail = count % kOccupancyWordBits;
+                if (tail) occupancy_.back() = OccupancyRangeMask(0, tail);  // bits past the range stay clear
+            }
             DenseType &ray = *dense_;
             for (auto const &item : *sparse_) {
                 ray[item.first - range_min_] = item.second;
+                SetOccupancyBit(item.first - range_min_, item.second != kDefaultValue);
             }
             sparse_.reset();
             has_full_range_value_ = false;
@@ -366,11 +424,84 @@ class SparseVector {
         ValueType &current_value = (*dense_)[index - range_min_];
         if ((kSetReplaces || current_value == kDefaultValue) && (value != current_value)) {
             current_value = value;
+            SetOccupancyBit(index - range_min_, value != kDefaultValue);
             updated = true;
         }
         return updated;
     }
 
+    // Dense access mode range setter.  The occupancy bitmap reduces the element-by-element walk
+    // to one word operation per 64 entries: the update-only-invalid semantic touches exactly the
+    // unoccupied bits, and the replace semantic needs per-entry value compares only while no
+    // difference has been proven yet.
+    bool SetDenseRange(const IndexType start, const IndexType end, const ValueType &value) {
+        bool updated = false;
+        DenseType &ray = *dense_;
+        const size_t lo = static_cast<size_t>(start - range_min_);
+        const size_t hi = static_cast<size_t>(end - range_min_);
+        const bool value_is_default = (value == kDefaultValue);
+        if (lo >= hi) return false;
+        if (!kSetReplaces && value_is_default) return false;  // only default entries are writable, and with no change
+
+        for (size_t word_index = lo / kOccupancyWordBits; word_index * kOccupancyWordBits < hi; ++word_index) {
+            const size_t word_base = word_index * kOccupancyWordBits;
+            const size_t first = (lo > word_base) ? (lo - word_base) : 0;
+            const size_t last = std::min(hi - word_base, size_t(kOccupancyWordBits));
+            const OccupancyWord mask = OccupancyRangeMask(first, last);
+            OccupancyWord &occ = occupancy_[word_index];
+            if (!kSetReplaces) {
+                // Write value (non-default, per the early out) to the unoccupied entries only
+                const OccupancyWord fresh = mask & ~occ;
+                if (!fresh) continue;
+                for (OccupancyWord bits = fresh; bits; bits &= bits - 1) {
+                    ray[word_base + CountTrailingZeros(bits)] = value;
+                }
+                occ |= fresh;
+                updated = true;
+            } else if (value_is_default) {
+                // Reset the occupied entries; untouched entries already hold the default
+                const OccupancyWord stale = mask & occ;
+                if (!stale) continue;
+                for (OccupancyWord bits = stale; bits; bits &= bits - 1) {
+                    ray[word_base + CountTrailingZeros(bits)] = value;
+                }
+                occ &= ~stale;
+                updated = true;
+            } else {
+                // Replace semantics with a non-default value: every entry ends up holding value.
+                // Any unoccupied bit proves an update; otherwise compare until one is found.
+                if (!updated && (mask & ~occ)) updated = true;
+                if (!updated) {
+                    for (OccupancyWord bits = mask & occ; bits; bits &= bits - 1) {
+                        if (ray[word_base + CountTrailingZeros(bits)] != value) {
+                            updated = true;
+                            break;
+                        }
+                    }
+                }
+                std::fill(ray.begin() + (word_base + first), ray.begin() + (word_base + last), value);
+                occ |= mask;
+            }
+        }
+        return updated;
+    }
+
+    // First index at or after the given one whose dense entry is valid (non-default), or
+    // range_max_.  Word-at-a-time scan of the occupancy bitmap.
+    IndexType NextOccupied(IndexType index) const {
+        assert(dense_);
+        if (index >= range_max_) return range_max_;
+        const size_t bit = static_cast<size_t>(index - range_min_);
+        size_t word_index = bit / kOccupancyWordBits;
+        OccupancyWord word = occupancy_[word_index] & (~OccupancyWord(0) << (bit % kOccupancyWordBits));
+        while (!word) {
+            ++word_index;
+            if (word_index >= occupancy_.size()) return range_max_;
+            word = occupancy_[word_index];
+        }
+        return static_cast<IndexType>(range_min_ + word_index * kOccupancyWordBits + CountTrailingZeros(word));
+    }
+
     // Sparse access mode setter with update full range and update semantics implemented
     bool SetSparse(IndexType index, const ValueType &value) {
         if (!kSetReplaces && HasFullRange()) {
@@ -400,5 +531,232 @@ class SparseVector {
     }
 };
 
+
+// RangeEncodedVector:
+//
+// A run-length encoded alternative to SparseVector for ranges that are typically written and
+// read in large contiguous spans -- notably image subresource layout tracking, where a barrier
+// covering a whole VkImageSubresourceRange should cost one record rather than one entry per
+// subresource.
+//
+// Values are stored as non-overlapping runs [start, end) in a std::map keyed by start index;
+// indices not covered by any run hold kDefaultValue, and adjacent runs with equal values are
+// coalesced, so a whole-range update is a single node regardless of the range size.  The update
+// semantics match SparseVector:
+//    kSetReplaces == true  -- updates replace current values
+//    kSetReplaces == false -- only indices currently at kDefaultValue are written
+//
+// Get returns the value at a single index; GetRun additionally reports how far the value
+// extends, letting traversal loops advance per-run instead of per-index.  SetRange and Merge
+// operate per-run.  The const_iterator expands runs to {index, value} pairs, skipping default
+// entries, for compatibility with SparseVector-style traversal.
+template <typename IndexType_, typename T, bool kSetReplaces, T kDefaultValue = T()>
+class RangeEncodedVector {
+   public:
+    typedef IndexType_ IndexType;
+    typedef T value_type;
+    typedef value_type ValueType;
+
+    RangeEncodedVector(IndexType start, IndexType end) : range_min_(start), range_max_(end), default_value_(kDefaultValue) {
+        assert(end > start);
+    }
+
+    const ValueType &Get(const IndexType index) const {
+        auto it = FindRunContaining(index);
+        return (it != runs_.cend()) ? it->second.value : default_value_;
+    }
+
+    // The value at index together with the (exclusive) end of the span holding that value,
+    // counting uncovered (default valued) spans between runs
+    struct RunValue {
+        IndexType end;
+        ValueType value;
+    };
+    RunValue GetRun(const IndexType index) const {
+        auto it = runs_.upper_bound(index);
+        if (it != runs_.cbegin()) {
+            auto prev = std::prev(it);
+            if (index < prev->second.end) return RunValue{prev->second.end, prev->second.value};
+        }
+        // In a gap; it extends to the next run (or the end of the valid range)
+        return RunValue{(it != runs_.cend()) ? it->first : range_max_, kDefaultValue};
+    }
+
+    bool Set(const IndexType index, const ValueType &value) { return SetRange(index, index + 1, value); }
+
+    bool SetRange(IndexType start, IndexType end, ValueType value) {
+        start = std::max(start, range_min_);
+        end = std::min(end, range_max_);
+        if (start >= end) return false;
+        return kSetReplaces ? SetRangeReplace(start, end, value) : SetRangeWriteOnce(start, end, value);
+    }
+
+    // Apply the non-default runs of another vector, one SetRange per run
+    bool Merge(const RangeEncodedVector &from) {
+        assert((range_min_ <= from.range_min_) && (range_max_ >= from.range_max_));
+        bool updated = false;
+        for (const auto &run : from.runs_) {
+            updated |= SetRange(run.first, run.second.end, run.second.value);
+        }
+        return updated;
+    }
+
+    friend class ConstIterator;
+    class ConstIterator {
+       public:
+        using IteratorValueType = std::pair<IndexType, ValueType>;
+        const IteratorValueType &operator*() const { return current_value_; }
+
+        ConstIterator &operator++() {
+            ++index_;
+            if (index_ >= it_->second.end) {
+                ++it_;
+                if (it_ == vec_->runs_.cend()) {
+                    the_end_ = true;
+                    return *this;
+                }
+                index_ = it_->first;
+            }
+            current_value_ = IteratorValueType(index_, it_->second.value);
+            return *this;
+        }
+        bool operator!=(const ConstIterator &rhs) const {
+            return (the_end_ != rhs.the_end_);  // Just good enough for cend checks
+        }
+        bool operator==(const ConstIterator &rhs) const { return (the_end_ == rhs.the_end_); }
+
+        ConstIterator(const RangeEncodedVector &vec) : vec_(&vec), the_end_(vec.runs_.empty()), it_(vec.runs_.cbegin()) {
+            if (!the_end_) {
+                index_ = it_->first;
+                current_value_ = IteratorValueType(index_, it_->second.value);
+            }
+        }
+        ConstIterator() : vec_(nullptr), the_end_(true) {}
+
+       protected:
+        const RangeEncodedVector *vec_;
+        bool the_end_;
+        typename std::map<IndexType, RunValue>::const_iterator it_;
+        IndexType index_;
+        IteratorValueType current_value_;
+    };
+    typedef ConstIterator const_iterator;
+
+    ConstIterator cbegin() const { return ConstIterator(*this); }
+    ConstIterator cend() const { return ConstIterator(); }
+
+    IndexType RangeMax() const { return range_max_; }
+    IndexType RangeMin() const { return range_min_; }
+
+   protected:
+    typedef std::map<IndexType, RunValue> RunMap;
+
+    typename RunMap::const_iterator FindRunContaining(const IndexType index) const {
+        auto it = runs_.upper_bound(index);
+        if (it != runs_.cbegin()) {
+            auto prev = std::prev(it);
+            if (index < prev->second.end) return prev;
+        }
+        return runs_.cend();
+    }
+
+    // True iff every index in [start, end) already holds value
+    bool RegionHolds(IndexType start, IndexType end, const ValueType &value) const {
+        IndexType pos = start;
+        auto it = runs_.upper_bound(start);
+        if (it != runs_.begin()) --it;
+        while (pos < end) {
+            if (it == runs_.end() || pos < it->first) {
+                // Gap at pos
+                if (!(value == kDefaultValue)) return false;
+                pos = (it == runs_.end()) ? end : it->first;
+            } else if (pos < it->second.end) {
+                if (!(it->second.value == value)) return false;
+                pos = it->second.end;
+                ++it;
+            } else {
+                ++it;
+            }
+        }
+        return true;
+    }
+
+    // Insert a run known not to overlap any existing run, coalescing with equal-valued neighbors
+    void InsertRun(IndexType start, IndexType end, const ValueType &value) {
+        if (value == kDefaultValue) return;  // Gaps represent the default value
+        auto inserted = runs_.emplace(start, RunValue{end, value}).first;
+        auto next = std::next(inserted);
+        if ((next != runs_.end()) && (next->first == end) && (next->second.value == value)) {
+            inserted->second.end = next->second.end;
+            runs_.erase(next);
+        }
+        if (inserted != runs_.begin()) {
+            auto prev = std::prev(inserted);
+            if ((prev->second.end == inserted->first) && (prev->second.value == value)) {
+                prev->second.end = inserted->second.end;
+                runs_.erase(inserted);
+            }
+        }
+    }
+
+    bool SetRangeReplace(IndexType start, IndexType end, const ValueType &value) {
+        if (RegionHolds(start, end, value)) return false;  // Preserve "was anything updated" semantics without rewriting
+
+        // Trim or split the run (if any) straddling start
+        auto it = runs_.lower_bound(start);
+        if (it != runs_.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second.end > start) {
+                const IndexType prev_end = prev->second.end;
+                const ValueType prev_value = prev->second.value;
+                prev->second.end = start;
+                if (prev_end > end) {
+                    runs_.emplace(end, RunValue{prev_end, prev_value});
+                }
+            }
+        }
+        // Remove runs inside [start, end), trimming one that extends past end
+        while ((it != runs_.end()) && (it->first < end)) {
+            if (it->second.end > end) {
+                runs_.emplace(end, RunValue{it->second.end, it->second.value});
+                it = runs_.erase(it);
+                break;
+            }
+            it = runs_.erase(it);
+        }
+        InsertRun(start, end, value);
+        return true;
+    }
+
+    bool SetRangeWriteOnce(IndexType start, IndexType end, const ValueType &value) {
+        if (value == kDefaultValue) return false;  // Default means "unset"; nothing to write
+        // Collect the uncovered gaps in [start, end) first, then fill them, so the map isn't
+        // mutated while being walked
+        std::vector<std::pair<IndexType, IndexType>> gap_runs;
+        IndexType pos = start;
+        auto it = runs_.upper_bound(start);
+        if (it != runs_.begin()) --it;
+        while (pos < end) {
+            if (it == runs_.end() || pos < it->first) {
+                const IndexType gap_end = std::min(end, (it == runs_.end()) ? range_max_ : it->first);
+                gap_runs.emplace_back(pos, gap_end);
+                pos = gap_end;
+            } else {
+                pos = std::max(pos, it->second.end);
+                ++it;
+            }
+        }
+        for (const auto &gap : gap_runs) {
+            InsertRun(gap.first, gap.second, value);
+        }
+        return !gap_runs.empty();
+    }
+
+    const IndexType range_min_;  // inclusive
+    const IndexType range_max_;  // exclusive
+    const ValueType default_value_;
+    RunMap runs_;
+};
+
 }  // namespace sparse_container
 #endif
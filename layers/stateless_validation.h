@@ -22,8 +22,11 @@
 #pragma once
 
 #include <bitset>
+#include <memory>
+#include <unordered_set>
 
 #include "parameter_name.h"
+#include "vk_layer_data.h"
 #include "vk_typemap_helper.h"
 
 // Suppress unused warning on Linux
@@ -69,6 +72,13 @@ const std::string UnsupportedStructureTypeString = "Unhandled VkStructureType";
 // String returned by string_VkResult for an unrecognized type.
 const std::string UnsupportedResultString = "Unhandled VkResult";
 
+// Disclaimer appended to pNext chain validation warnings; consumes a header version (%d) and a
+// parameter name (%s) from the log_msg argument list.
+const char kPNextDisclaimer[] =
+    "This warning is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that you are "
+    "using a struct from a private extension or an extension that was added to a later version of the Vulkan header, in which "
+    "case your use of %s is perfectly valid but is not guaranteed to work correctly with validation enabled";
+
 // The base value used when computing the offset for an enumeration token value that is added by an extension.
 // When validating enumeration tokens, any value >= to this value is considered to be provided by an extension.
 // See Appendix C.10 "Assigning Extension Token Values" from the Vulkan specification
@@ -91,7 +101,12 @@ class StatelessValidation : public ValidationObject {
 
     // Override chassis read/write locks for this validation object
     // This override takes a deferred lock. i.e. it is not acquired.
-    std::unique_lock<std::mutex> write_lock() { return std::unique_lock<std::mutex>(validation_object_mutex, std::defer_lock); }
+    std::unique_lock<std::shared_timed_mutex> write_lock() {
+        return std::unique_lock<std::shared_timed_mutex>(validation_object_mutex, std::defer_lock);
+    }
+    std::shared_lock<std::shared_timed_mutex> read_lock() {
+        return std::shared_lock<std::shared_timed_mutex>(validation_object_mutex, std::defer_lock);
+    }
 
     // Device extension properties -- storing properties gathered from VkPhysicalDeviceProperties2KHR::pNext chain
     struct DeviceExtensionProperties {
@@ -114,6 +129,143 @@ class StatelessValidation : public ValidationObject {
 
     // Constructor for stateles validation tracking
     // StatelessValidation() : {}
+
+    // Outlined error reporting for the parameter checks below.  Virtually every check passes,
+    // so each hot validate_* helper reduces to a compare and a never-taken call into one of
+    // these cold bodies; the ParameterName formatting and log_msg machinery stay out of the
+    // pass path that gets inlined into the generated entry points.
+    VL_COLD_ERROR_PATH bool report_missing_required_parameter(const char *api_name, const ParameterName &parameter_name,
+                                                              const char *vuid, const char *provided) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: required parameter %s specified as %s", api_name, parameter_name.get_name().c_str(), provided);
+    }
+
+    VL_COLD_ERROR_PATH bool report_missing_required_element(const char *api_name, const ParameterName &array_name, uint32_t index,
+                                                            const char *vuid, const char *provided) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: required parameter %s[%d] specified as %s", api_name, array_name.get_name().c_str(), index, provided);
+    }
+
+    VL_COLD_ERROR_PATH bool report_zero_required_count(const char *api_name, const ParameterName &count_name, const char *vuid) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: parameter %s must be greater than 0.", api_name, count_name.get_name().c_str());
+    }
+
+    VL_COLD_ERROR_PATH bool report_struct_type_error(const char *api_name, const ParameterName &parameter_name,
+                                                     const char *stype_name, const char *vuid) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: parameter %s->sType must be %s.", api_name, parameter_name.get_name().c_str(), stype_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_struct_type_element_error(const char *api_name, const ParameterName &array_name, uint32_t index,
+                                                             const char *stype_name, const char *vuid) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: parameter %s[%d].sType must be %s", api_name, array_name.get_name().c_str(), index, stype_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_bool32_error(const char *api_name, const ParameterName &parameter_name, VkBool32 value) {
+        return log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       kVUID_PVError_UnrecognizedValue, "%s: value of %s (%d) is neither VK_TRUE nor VK_FALSE", api_name,
+                       parameter_name.get_name().c_str(), value);
+    }
+
+    VL_COLD_ERROR_PATH bool report_ranged_enum_error(const char *api_name, const ParameterName &parameter_name,
+                                                     const char *enum_name, int32_t value, const char *vuid) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: value of %s (%d) does not fall within the begin..end range of the core %s enumeration tokens and is "
+                       "not an extension added token.",
+                       api_name, parameter_name.get_name().c_str(), value, enum_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_ranged_enum_element_error(const char *api_name, const ParameterName &array_name, uint32_t index,
+                                                             const char *enum_name, int32_t value) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       kVUID_PVError_UnrecognizedValue,
+                       "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
+                       "enumeration tokens and is not an extension added token",
+                       api_name, array_name.get_name().c_str(), index, value, enum_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_reserved_flags_error(const char *api_name, const ParameterName &parameter_name,
+                                                        const char *vuid) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: parameter %s must be 0.", api_name, parameter_name.get_name().c_str());
+    }
+
+    VL_COLD_ERROR_PATH bool report_missing_required_flags(const char *api_name, const ParameterName &parameter_name,
+                                                          const char *vuid) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       "%s: value of %s must not be 0.", api_name, parameter_name.get_name().c_str());
+    }
+
+    VL_COLD_ERROR_PATH bool report_unrecognized_flags(const char *api_name, const ParameterName &parameter_name,
+                                                      const char *flag_bits_name) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       kVUID_PVError_UnrecognizedValue,
+                       "%s: value of %s contains flag bits that are not recognized members of %s", api_name,
+                       parameter_name.get_name().c_str(), flag_bits_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_multiple_flags_error(const char *api_name, const ParameterName &parameter_name,
+                                                        const char *flag_bits_name) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       kVUID_PVError_UnrecognizedValue,
+                       "%s: value of %s contains multiple members of %s when only a single value is allowed", api_name,
+                       parameter_name.get_name().c_str(), flag_bits_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_zero_flags_element(const char *api_name, const ParameterName &array_name, uint32_t index) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       kVUID_PVError_RequiredParameter, "%s: value of %s[%d] must not be 0", api_name,
+                       array_name.get_name().c_str(), index);
+    }
+
+    VL_COLD_ERROR_PATH bool report_unrecognized_flags_element(const char *api_name, const ParameterName &array_name,
+                                                              uint32_t index, const char *flag_bits_name) {
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
+                       kVUID_PVError_UnrecognizedValue,
+                       "%s: value of %s[%d] contains flag bits that are not recognized members of %s", api_name,
+                       array_name.get_name().c_str(), index, flag_bits_name);
+    }
+
+    VL_COLD_ERROR_PATH bool report_pnext_not_null_warning(const char *api_name, const ParameterName &parameter_name,
+                                                          uint32_t header_version, const char *vuid) {
+        std::string message = "%s: value of %s must be NULL. ";
+        message += kPNextDisclaimer;
+        return log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       message.c_str(), api_name, parameter_name.get_name().c_str(), header_version,
+                       parameter_name.get_name().c_str());
+    }
+
+    VL_COLD_ERROR_PATH bool report_unexpected_pnext_type(const char *api_name, const ParameterName &parameter_name,
+                                                         VkStructureType stype, const char *allowed_struct_names,
+                                                         uint32_t header_version, const char *vuid) {
+        // The type name is only needed to build the warning message
+        std::string type_name = string_VkStructureType(stype);
+        if (type_name == UnsupportedStructureTypeString) {
+            std::string message =
+                "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures are [%s]. ";
+            message += kPNextDisclaimer;
+            return log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                           message.c_str(), api_name, parameter_name.get_name().c_str(), stype, allowed_struct_names,
+                           header_version, parameter_name.get_name().c_str());
+        }
+        std::string message = "%s: %s chain includes a structure with unexpected VkStructureType %s; Allowed structures are [%s]. ";
+        message += kPNextDisclaimer;
+        return log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
+                       message.c_str(), api_name, parameter_name.get_name().c_str(), type_name.c_str(), allowed_struct_names,
+                       header_version, parameter_name.get_name().c_str());
+    }
+
+    template <typename T>
+    VL_COLD_ERROR_PATH bool ReportGreaterThanError(const T value, const T lower_bound, const ParameterName &parameter_name,
+                                                   const char *vuid, const LogMiscParams &misc) {
+        std::ostringstream ss;
+        ss << misc.api_name << ": parameter " << parameter_name.get_name() << " (= " << value << ") is greater than "
+           << lower_bound;
+        return log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, misc.objectType, misc.srcObject, vuid, "%s", ss.str().c_str());
+    }
+
     /**
      * Validate a minimum value.
      *
@@ -126,23 +278,14 @@ class StatelessValidation : public ValidationObject {
      * @return Boolean value indicating that the call should be skipped.
      */
     template <typename T>
-    bool ValidateGreaterThan(const T value, const T lower_bound, const ParameterName &parameter_name, const std::string &vuid,
+    bool ValidateGreaterThan(const T value, const T lower_bound, const ParameterName &parameter_name, const char *vuid,
                              const LogMiscParams &misc) {
-        bool skip_call = false;
-
-        if (value <= lower_bound) {
-            std::ostringstream ss;
-            ss << misc.api_name << ": parameter " << parameter_name.get_name() << " (= " << value << ") is greater than "
-               << lower_bound;
-            skip_call |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, misc.objectType, misc.srcObject, vuid, "%s", ss.str().c_str());
-        }
-
-        return skip_call;
+        if (value > lower_bound) return false;
+        return ReportGreaterThanError(value, lower_bound, parameter_name, vuid, misc);
     }
 
     template <typename T>
-    bool ValidateGreaterThanZero(const T value, const ParameterName &parameter_name, const std::string &vuid,
+    bool ValidateGreaterThanZero(const T value, const ParameterName &parameter_name, const char *vuid,
                                  const LogMiscParams &misc) {
         return ValidateGreaterThan(value, T{0}, parameter_name, vuid, misc);
     }
@@ -157,15 +300,9 @@ class StatelessValidation : public ValidationObject {
      * @return Boolean value indicating that the call should be skipped.
      */
     bool validate_required_pointer(const char *apiName, const ParameterName &parameterName, const void *value,
-                                   const std::string &vuid) {
-        bool skip_call = false;
-
-        if (value == NULL) {
-            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
-                                 "%s: required parameter %s specified as NULL.", apiName, parameterName.get_name().c_str());
-        }
-
-        return skip_call;
+                                   const char *vuid) {
+        if (value != NULL) return false;
+        return report_missing_required_parameter(apiName, parameterName, vuid, "NULL.");
     }
 
     /**
@@ -192,16 +329,12 @@ class StatelessValidation : public ValidationObject {
 
         // Count parameters not tagged as optional cannot be 0
         if (countRequired && (count == 0)) {
-            skip_call |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, count_required_vuid,
-                        "%s: parameter %s must be greater than 0.", apiName, countName.get_name().c_str());
+            skip_call |= report_zero_required_count(apiName, countName, count_required_vuid);
         }
 
         // Array parameters not tagged as optional cannot be NULL, unless the count is 0
         if (arrayRequired && (count != 0) && (*array == NULL)) {
-            skip_call |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, array_required_vuid,
-                        "%s: required parameter %s specified as NULL.", apiName, arrayName.get_name().c_str());
+            skip_call |= report_missing_required_parameter(apiName, arrayName, array_required_vuid, "NULL.");
         }
 
         return skip_call;
@@ -234,9 +367,7 @@ class StatelessValidation : public ValidationObject {
 
         if (count == NULL) {
             if (countPtrRequired) {
-                skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                     kVUID_PVError_RequiredParameter, "%s: required parameter %s specified as NULL", apiName,
-                                     countName.get_name().c_str());
+                skip_call |= report_missing_required_parameter(apiName, countName, kVUID_PVError_RequiredParameter, "NULL");
             }
         } else {
             skip_call |= validate_array(apiName, countName, arrayName, *array ? (*count) : 0, &array, countValueRequired,
@@ -264,20 +395,15 @@ class StatelessValidation : public ValidationObject {
     template <typename T>
     bool validate_struct_type(const char *apiName, const ParameterName &parameterName, const char *sTypeName, const T *value,
                               VkStructureType sType, bool required, const char *struct_vuid, const char *stype_vuid) {
-        bool skip_call = false;
-
         if (value == NULL) {
             if (required) {
-                skip_call |=
-                    log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, struct_vuid,
-                            "%s: required parameter %s specified as NULL", apiName, parameterName.get_name().c_str());
+                return report_missing_required_parameter(apiName, parameterName, struct_vuid, "NULL");
             }
         } else if (value->sType != sType) {
-            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, stype_vuid,
-                                 "%s: parameter %s->sType must be %s.", apiName, parameterName.get_name().c_str(), sTypeName);
+            return report_struct_type_error(apiName, parameterName, sTypeName, stype_vuid);
         }
 
-        return skip_call;
+        return false;
     }
 
     /**
@@ -312,9 +438,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i].sType != sType) {
-                    skip_call |=
-                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, stype_vuid,
-                                "%s: parameter %s[%d].sType must be %s", apiName, arrayName.get_name().c_str(), i, sTypeName);
+                    skip_call |= report_struct_type_element_error(apiName, arrayName, i, sTypeName, stype_vuid);
                 }
             }
         }
@@ -351,9 +475,7 @@ class StatelessValidation : public ValidationObject {
 
         if (count == NULL) {
             if (countPtrRequired) {
-                skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                     kVUID_PVError_RequiredParameter, "%s: required parameter %s specified as NULL", apiName,
-                                     countName.get_name().c_str());
+                skip_call |= report_missing_required_parameter(apiName, countName, kVUID_PVError_RequiredParameter, "NULL");
             }
         } else {
             skip_call |= validate_struct_type_array(apiName, countName, arrayName, sTypeName, (*count), array, sType,
@@ -375,15 +497,8 @@ class StatelessValidation : public ValidationObject {
      */
     template <typename T>
     bool validate_required_handle(const char *api_name, const ParameterName &parameter_name, T value) {
-        bool skip_call = false;
-
-        if (value == VK_NULL_HANDLE) {
-            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                 kVUID_PVError_RequiredParameter, "%s: required parameter %s specified as VK_NULL_HANDLE", api_name,
-                                 parameter_name.get_name().c_str());
-        }
-
-        return skip_call;
+        if (value != VK_NULL_HANDLE) return false;
+        return report_missing_required_parameter(api_name, parameter_name, kVUID_PVError_RequiredParameter, "VK_NULL_HANDLE");
     }
 
     /**
@@ -419,10 +534,8 @@ class StatelessValidation : public ValidationObject {
             // Verify that no handles in the array are VK_NULL_HANDLE
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i] == VK_NULL_HANDLE) {
-                    skip_call |=
-                        log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                kVUID_PVError_RequiredParameter, "%s: required parameter %s[%d] specified as VK_NULL_HANDLE",
-                                api_name, array_name.get_name().c_str(), i);
+                    skip_call |= report_missing_required_element(api_name, array_name, i, kVUID_PVError_RequiredParameter,
+                                                                 "VK_NULL_HANDLE");
                 }
             }
         }
@@ -459,9 +572,7 @@ class StatelessValidation : public ValidationObject {
             // Verify that strings in the array are not NULL
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i] == NULL) {
-                    skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                         kVUID_PVError_RequiredParameter, "%s: required parameter %s[%d] specified as NULL",
-                                         apiName, arrayName.get_name().c_str(), i);
+                    skip_call |= report_missing_required_element(apiName, arrayName, i, kVUID_PVError_RequiredParameter, "NULL");
                 }
             }
         }
@@ -496,77 +607,83 @@ class StatelessValidation : public ValidationObject {
         // TODO: The valid pNext structure types are not recursive. Each structure has its own list of valid sTypes for pNext.
         // Codegen a map of vectors containing the allowable pNext types for each struct and use that here -- also simplifies parms.
         if (next != NULL) {
-            std::unordered_set<const void *> cycle_check;
-            std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
-
-            const char *disclaimer =
-                "This warning is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
-                "you "
-                "are "
-                "using a struct from a private extension or an extension that was added to a later version of the Vulkan header, "
-                "in "
-                "which "
-                "case your use of %s is perfectly valid but is not guaranteed to work correctly with validation enabled";
-
             if (allowed_type_count == 0) {
-                std::string message = "%s: value of %s must be NULL. ";
-                message += disclaimer;
-                skip_call |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
-                                     message.c_str(), api_name, parameter_name.get_name().c_str(), header_version,
-                                     parameter_name.get_name().c_str());
+                skip_call |= report_pnext_not_null_warning(api_name, parameter_name, header_version, vuid);
             } else {
                 const VkStructureType *start = allowed_types;
                 const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
-                cycle_check.insert(next);
+                // Loader structs are exempted for these two entry points only; resolve that once
+                // instead of strncmp'ing the api name for every chained struct
+                const bool is_create_instance = (strncmp(api_name, "vkCreateInstance", strlen(api_name)) == 0);
+                const bool is_create_device = (strncmp(api_name, "vkCreateDevice", strlen(api_name)) == 0);
+
+                // Track visited nodes and structure types in fixed stack arrays -- pNext chains
+                // are almost always a handful of structs, so this path makes no heap allocations.
+                // A pathologically long chain spills the bookkeeping into heap sets instead.
+                const uint32_t kStackChainLimit = 32;
+                const void *seen_nodes[kStackChainLimit];
+                VkStructureType seen_stypes[kStackChainLimit];
+                uint32_t seen_node_count = 0;
+                uint32_t seen_stype_count = 0;
+                std::unique_ptr<std::unordered_set<const void *>> overflow_nodes;
+                std::unique_ptr<std::unordered_set<VkStructureType, std::hash<int>>> overflow_stypes;
+
+                // Each helper reports whether the value was already recorded, inserting it if not
+                auto check_and_insert_node = [&](const void *node) -> bool {
+                    if (overflow_nodes) return !overflow_nodes->insert(node).second;
+                    for (uint32_t i = 0; i < seen_node_count; ++i) {
+                        if (seen_nodes[i] == node) return true;
+                    }
+                    if (seen_node_count < kStackChainLimit) {
+                        seen_nodes[seen_node_count++] = node;
+                    } else {
+                        overflow_nodes.reset(new std::unordered_set<const void *>(seen_nodes, seen_nodes + seen_node_count));
+                        overflow_nodes->insert(node);
+                    }
+                    return false;
+                };
+                auto check_and_insert_stype = [&](VkStructureType stype) -> bool {
+                    if (overflow_stypes) return !overflow_stypes->insert(stype).second;
+                    for (uint32_t i = 0; i < seen_stype_count; ++i) {
+                        if (seen_stypes[i] == stype) return true;
+                    }
+                    if (seen_stype_count < kStackChainLimit) {
+                        seen_stypes[seen_stype_count++] = stype;
+                    } else {
+                        overflow_stypes.reset(new std::unordered_set<VkStructureType, std::hash<int>>(
+                            seen_stypes, seen_stypes + seen_stype_count));
+                        overflow_stypes->insert(stype);
+                    }
+                    return false;
+                };
+
+                check_and_insert_node(next);
 
                 while (current != NULL) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        if (cycle_check.find(current->pNext) != cycle_check.end()) {
+                    if ((!is_create_instance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
+                        (!is_create_device || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
+                        if (check_and_insert_node(current->pNext)) {
                             std::string message = "%s: %s chain contains a cycle -- pNext pointer " PRIx64 " is repeated.";
                             skip_call |=
                                 log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
                                         kVUID_PVError_InvalidStructPNext, message.c_str(), api_name,
                                         parameter_name.get_name().c_str(), reinterpret_cast<uint64_t>(next));
                             break;
-                        } else {
-                            cycle_check.insert(current->pNext);
                         }
 
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end()) {
+                        if (check_and_insert_stype(current->sType)) {
                             std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
                             skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                                  VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, kVUID_PVError_InvalidStructPNext,
-                                                 message.c_str(), api_name, parameter_name.get_name().c_str(), type_name.c_str());
-                        } else {
-                            unique_stype_check.insert(current->sType);
+                                                 message.c_str(), api_name, parameter_name.get_name().c_str(),
+                                                 string_VkStructureType(current->sType));
                         }
 
                         if (std::find(start, end, current->sType) == end) {
-                            if (type_name == UnsupportedStructureTypeString) {
-                                std::string message =
-                                    "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures are "
-                                    "[%s]. ";
-                                message += disclaimer;
-                                skip_call |=
-                                    log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT,
-                                            0, vuid, message.c_str(), api_name, parameter_name.get_name().c_str(), current->sType,
-                                            allowed_struct_names, header_version, parameter_name.get_name().c_str());
-                            } else {
-                                std::string message =
-                                    "%s: %s chain includes a structure with unexpected VkStructureType %s; Allowed structures are "
-                                    "[%s]. ";
-                                message += disclaimer;
-                                skip_call |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT,
-                                                     VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid, message.c_str(), api_name,
-                                                     parameter_name.get_name().c_str(), type_name.c_str(), allowed_struct_names,
-                                                     header_version, parameter_name.get_name().c_str());
-                            }
+                            skip_call |= report_unexpected_pnext_type(api_name, parameter_name, current->sType,
+                                                                      allowed_struct_names, header_version, vuid);
                         }
                         skip_call |= ValidatePnextStructContents(api_name, parameter_name, current);
                     }
@@ -589,15 +706,8 @@ class StatelessValidation : public ValidationObject {
      * @return Boolean value indicating that the call should be skipped.
      */
     bool validate_bool32(const char *apiName, const ParameterName &parameterName, VkBool32 value) {
-        bool skip_call = false;
-
-        if ((value != VK_TRUE) && (value != VK_FALSE)) {
-            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                 kVUID_PVError_UnrecognizedValue, "%s: value of %s (%d) is neither VK_TRUE nor VK_FALSE", apiName,
-                                 parameterName.get_name().c_str(), value);
-        }
-
-        return skip_call;
+        if ((value == VK_TRUE) || (value == VK_FALSE)) return false;
+        return report_bool32_error(apiName, parameterName, value);
     }
 
     /**
@@ -617,20 +727,34 @@ class StatelessValidation : public ValidationObject {
      * @param value Enumeration value to validate.
      * @return Boolean value indicating that the call should be skipped.
      */
-    template <typename T>
-    bool validate_ranged_enum(const char *apiName, const ParameterName &parameterName, const char *enumName,
-                              const std::vector<T> &valid_values, T value, const char *vuid) {
-        bool skip = false;
+    // Membership tables for validate_ranged_enum, built the first time each enumeration is
+    // validated on this object.  The generated AllVk*Enums token lists are process-lifetime
+    // globals, so a list's address identifies its enumeration; after the first check, membership
+    // is a single hash lookup instead of a linear scan over the full token list (VkFormat alone
+    // has roughly 250 tokens and is consulted by every image and buffer creation call).
+    vl_concurrent_unordered_map<const void *, std::shared_ptr<std::unordered_set<int64_t>>> enum_membership_sets;
 
-        if (std::find(valid_values.begin(), valid_values.end(), value) == valid_values.end()) {
-            skip |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
-                        "%s: value of %s (%d) does not fall within the begin..end range of the core %s enumeration tokens and is "
-                        "not an extension added token.",
-                        apiName, parameterName.get_name().c_str(), value, enumName);
+    template <typename T>
+    bool enum_value_is_valid(const std::vector<T> &valid_values, T value) {
+        std::shared_ptr<std::unordered_set<int64_t>> members;
+        auto found = enum_membership_sets.find(&valid_values);
+        if (found != enum_membership_sets.end()) {
+            members = found->second;
+        } else {
+            members = std::make_shared<std::unordered_set<int64_t>>();
+            for (const auto valid_value : valid_values) {
+                members->insert(static_cast<int64_t>(valid_value));
+            }
+            enum_membership_sets.insert(&valid_values, members);
         }
+        return members->count(static_cast<int64_t>(value)) != 0;
+    }
 
-        return skip;
+    template <typename T>
+    bool validate_ranged_enum(const char *apiName, const ParameterName &parameterName, const char *enumName,
+                              const std::vector<T> &valid_values, T value, const char *vuid) {
+        if (enum_value_is_valid(valid_values, value)) return false;
+        return report_ranged_enum_error(apiName, parameterName, enumName, value, vuid);
     }
 
     /**
@@ -665,12 +789,8 @@ class StatelessValidation : public ValidationObject {
                                         kVUIDUndefined);
         } else {
             for (uint32_t i = 0; i < count; ++i) {
-                if (std::find(valid_values.begin(), valid_values.end(), array[i]) == valid_values.end()) {
-                    skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                         kVUID_PVError_UnrecognizedValue,
-                                         "%s: value of %s[%d] (%d) does not fall within the begin..end range of the core %s "
-                                         "enumeration tokens and is not an extension added token",
-                                         apiName, arrayName.get_name().c_str(), i, array[i], enumName);
+                if (!enum_value_is_valid(valid_values, array[i])) {
+                    skip_call |= report_ranged_enum_element_error(apiName, arrayName, i, enumName, array[i]);
                 }
             }
         }
@@ -690,14 +810,8 @@ class StatelessValidation : public ValidationObject {
      * @return Boolean value indicating that the call should be skipped.
      */
     bool validate_reserved_flags(const char *api_name, const ParameterName &parameter_name, VkFlags value, const char *vuid) {
-        bool skip_call = false;
-
-        if (value != 0) {
-            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
-                                 "%s: parameter %s must be 0.", api_name, parameter_name.get_name().c_str());
-        }
-
-        return skip_call;
+        if (value == 0) return false;
+        return report_reserved_flags_error(api_name, parameter_name, vuid);
     }
 
     /**
@@ -717,26 +831,17 @@ class StatelessValidation : public ValidationObject {
      */
     bool validate_flags(const char *api_name, const ParameterName &parameter_name, const char *flag_bits_name, VkFlags all_flags,
                         VkFlags value, bool flags_required, bool singleFlag, const char *vuid) {
-        bool skip_call = false;
-
         if (value == 0) {
             if (flags_required) {
-                skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, vuid,
-                                     "%s: value of %s must not be 0.", api_name, parameter_name.get_name().c_str());
+                return report_missing_required_flags(api_name, parameter_name, vuid);
             }
         } else if ((value & (~all_flags)) != 0) {
-            skip_call |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                        kVUID_PVError_UnrecognizedValue, "%s: value of %s contains flag bits that are not recognized members of %s",
-                        api_name, parameter_name.get_name().c_str(), flag_bits_name);
+            return report_unrecognized_flags(api_name, parameter_name, flag_bits_name);
         } else if (singleFlag && (std::bitset<sizeof(VkFlags) * 8>(value).count() > 1)) {
-            skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                 kVUID_PVError_UnrecognizedValue,
-                                 "%s: value of %s contains multiple members of %s when only a single value is allowed", api_name,
-                                 parameter_name.get_name().c_str(), flag_bits_name);
+            return report_multiple_flags_error(api_name, parameter_name, flag_bits_name);
         }
 
-        return skip_call;
+        return false;
     }
 
     /**
@@ -771,15 +876,10 @@ class StatelessValidation : public ValidationObject {
                     // Current XML registry logic for validity generation uses the array parameter's optional tag to determine if
                     // elements in the array are allowed be 0
                     if (array_required) {
-                        skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                             kVUID_PVError_RequiredParameter, "%s: value of %s[%d] must not be 0", api_name,
-                                             array_name.get_name().c_str(), i);
+                        skip_call |= report_zero_flags_element(api_name, array_name, i);
                     }
                 } else if ((array[i] & (~all_flags)) != 0) {
-                    skip_call |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                         kVUID_PVError_UnrecognizedValue,
-                                         "%s: value of %s[%d] contains flag bits that are not recognized members of %s", api_name,
-                                         array_name.get_name().c_str(), i, flag_bits_name);
+                    skip_call |= report_unrecognized_flags_element(api_name, array_name, i, flag_bits_name);
                 }
             }
         }
@@ -889,7 +989,7 @@ class StatelessValidation : public ValidationObject {
 
     bool validate_api_version(uint32_t api_version, uint32_t effective_api_version);
 
-    bool validate_string(const char *apiName, const ParameterName &stringName, const std::string &vuid, const char *validateString);
+    bool validate_string(const char *apiName, const ParameterName &stringName, const char *vuid, const char *validateString);
 
     bool ValidateCoarseSampleOrderCustomNV(const VkCoarseSampleOrderCustomNV *order);
 
@@ -902,7 +1002,7 @@ class StatelessValidation : public ValidationObject {
 
     bool ValidateAccelerationStructureInfoNV(const VkAccelerationStructureInfoNV &info);
 
-    bool OutputExtensionError(const std::string &api_name, const std::string &extension_name);
+    VL_COLD_ERROR_PATH bool OutputExtensionError(const std::string &api_name, const std::string &extension_name);
 
     void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
                                         const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass, VkResult result);
@@ -35,249 +35,279 @@ struct VULKAN_FORMAT_INFO {
 // Disable auto-formatting for this large table
 // clang-format off
 
-// Set up data structure with size(bytes) and number of channels for each Vulkan format
+// Set up data structures with size(bytes) and number of channels for each Vulkan format
 // For compressed and multi-plane formats, size is bytes per compressed or shared block
-const std::map<VkFormat, VULKAN_FORMAT_INFO> vk_format_table = {
-    {VK_FORMAT_UNDEFINED,                   {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT }},
-    {VK_FORMAT_R4G4_UNORM_PACK8,            {1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R4G4B4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_B4G4R4A4_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R5G6B5_UNORM_PACK16,         {2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_B5G6R5_UNORM_PACK16,         {2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R5G5B5A1_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_B5G5R5A1_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_A1R5G5B5_UNORM_PACK16,       {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8_UNORM,                    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SNORM,                    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_USCALED,                  {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SSCALED,                  {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_UINT,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SINT,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8_SRGB,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT}},
-    {VK_FORMAT_R8G8_UNORM,                  {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SNORM,                  {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_USCALED,                {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SSCALED,                {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_UINT,                   {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SINT,                   {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8_SRGB,                   {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R8G8B8_UNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_USCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SSCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_UINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8_SRGB,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_UNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SNORM,                {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_USCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SSCALED,              {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_UINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SINT,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_B8G8R8_SRGB,                 {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT}},
-    {VK_FORMAT_R8G8B8A8_UNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_USCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SSCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_UINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R8G8B8A8_SRGB,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_UNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SNORM,              {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_USCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SSCALED,            {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_UINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SINT,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_B8G8R8A8_SRGB,               {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_UNORM_PACK32,       {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SNORM_PACK32,       {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_USCALED_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SSCALED_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_UINT_PACK32,        {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SINT_PACK32,        {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A8B8G8R8_SRGB_PACK32,        {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_UNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_SNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_USCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_SSCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_UINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2R10G10B10_SINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_UNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_SNORM_PACK32,    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_USCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_SSCALED_PACK32,  {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_UINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_A2B10G10R10_SINT_PACK32,     {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16_UNORM,                   {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SNORM,                   {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_USCALED,                 {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SSCALED,                 {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_UINT,                    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SINT,                    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16_SFLOAT,                  {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R16G16_UNORM,                {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SNORM,                {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_USCALED,              {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SSCALED,              {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_UINT,                 {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SINT,                 {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16_SFLOAT,               {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R16G16B16_UNORM,             {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SNORM,             {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_USCALED,           {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SSCALED,           {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_UINT,              {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SINT,              {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16_SFLOAT,            {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT}},
-    {VK_FORMAT_R16G16B16A16_UNORM,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SNORM,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_USCALED,        {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SSCALED,        {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_UINT,           {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SINT,           {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R16G16B16A16_SFLOAT,         {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32_UINT,                    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R32_SINT,                    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R32_SFLOAT,                  {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R32G32_UINT,                 {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32G32_SINT,                 {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32G32_SFLOAT,               {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R32G32B32_UINT,              {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT}},
-    {VK_FORMAT_R32G32B32_SINT,              {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT}},
-    {VK_FORMAT_R32G32B32_SFLOAT,            {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT}},
-    {VK_FORMAT_R32G32B32A32_UINT,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R32G32B32A32_SINT,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R32G32B32A32_SFLOAT,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64_UINT,                    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R64_SINT,                    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R64_SFLOAT,                  {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT}},
-    {VK_FORMAT_R64G64_UINT,                 {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64G64_SINT,                 {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64G64_SFLOAT,               {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT}},
-    {VK_FORMAT_R64G64B64_UINT,              {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT}},
-    {VK_FORMAT_R64G64B64_SINT,              {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT}},
-    {VK_FORMAT_R64G64B64_SFLOAT,            {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT}},
-    {VK_FORMAT_R64G64B64A64_UINT,           {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT}},
-    {VK_FORMAT_R64G64B64A64_SINT,           {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT}},
-    {VK_FORMAT_R64G64B64A64_SFLOAT,         {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT}},
-    {VK_FORMAT_B10G11R11_UFLOAT_PACK32,     {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_E5B9G9R9_UFLOAT_PACK32,      {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_D16_UNORM,                   {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_X8_D24_UNORM_PACK32,         {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D32_SFLOAT,                  {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_S8_UINT,                     {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D16_UNORM_S8_UINT,           {3, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D24_UNORM_S8_UINT,           {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_D32_SFLOAT_S8_UINT,          {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT}},
-    {VK_FORMAT_BC1_RGB_UNORM_BLOCK,         {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT}},
-    {VK_FORMAT_BC1_RGB_SRGB_BLOCK,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT}},
-    {VK_FORMAT_BC1_RGBA_UNORM_BLOCK,        {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT}},
-    {VK_FORMAT_BC1_RGBA_SRGB_BLOCK,         {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT}},
-    {VK_FORMAT_BC2_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT}},
-    {VK_FORMAT_BC2_SRGB_BLOCK,              {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT}},
-    {VK_FORMAT_BC3_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT}},
-    {VK_FORMAT_BC3_SRGB_BLOCK,              {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT}},
-    {VK_FORMAT_BC4_UNORM_BLOCK,             {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT}},
-    {VK_FORMAT_BC4_SNORM_BLOCK,             {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT}},
-    {VK_FORMAT_BC5_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT}},
-    {VK_FORMAT_BC5_SNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT}},
-    {VK_FORMAT_BC6H_UFLOAT_BLOCK,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT}},
-    {VK_FORMAT_BC6H_SFLOAT_BLOCK,           {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT}},
-    {VK_FORMAT_BC7_UNORM_BLOCK,             {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT}},
-    {VK_FORMAT_BC7_SRGB_BLOCK,              {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK,     {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK,      {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK,   {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK,    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK,   {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT}},
-    {VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK,    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT}},
-    {VK_FORMAT_EAC_R11_UNORM_BLOCK,         {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT}},
-    {VK_FORMAT_EAC_R11_SNORM_BLOCK,         {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT}},
-    {VK_FORMAT_EAC_R11G11_UNORM_BLOCK,      {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT}},
-    {VK_FORMAT_EAC_R11G11_SNORM_BLOCK,      {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT}},
-    {VK_FORMAT_ASTC_4x4_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT}},
-    {VK_FORMAT_ASTC_4x4_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT}},
-    {VK_FORMAT_ASTC_5x4_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT}},
-    {VK_FORMAT_ASTC_5x4_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT}},
-    {VK_FORMAT_ASTC_5x5_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT}},
-    {VK_FORMAT_ASTC_5x5_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT}},
-    {VK_FORMAT_ASTC_6x5_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT}},
-    {VK_FORMAT_ASTC_6x5_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT}},
-    {VK_FORMAT_ASTC_6x6_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT}},
-    {VK_FORMAT_ASTC_6x6_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT}},
-    {VK_FORMAT_ASTC_8x5_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT}},
-    {VK_FORMAT_ASTC_8x5_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT}},
-    {VK_FORMAT_ASTC_8x6_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT}},
-    {VK_FORMAT_ASTC_8x6_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT}},
-    {VK_FORMAT_ASTC_8x8_UNORM_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT}},
-    {VK_FORMAT_ASTC_8x8_SRGB_BLOCK,         {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT}},
-    {VK_FORMAT_ASTC_10x5_UNORM_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT}},
-    {VK_FORMAT_ASTC_10x5_SRGB_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT}},
-    {VK_FORMAT_ASTC_10x6_UNORM_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT}},
-    {VK_FORMAT_ASTC_10x6_SRGB_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT}},
-    {VK_FORMAT_ASTC_10x8_UNORM_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT}},
-    {VK_FORMAT_ASTC_10x8_SRGB_BLOCK,        {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT}},
-    {VK_FORMAT_ASTC_10x10_UNORM_BLOCK,      {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT}},
-    {VK_FORMAT_ASTC_10x10_SRGB_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT}},
-    {VK_FORMAT_ASTC_12x10_UNORM_BLOCK,      {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT}},
-    {VK_FORMAT_ASTC_12x10_SRGB_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT}},
-    {VK_FORMAT_ASTC_12x12_UNORM_BLOCK,      {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT}},
-    {VK_FORMAT_ASTC_12x12_SRGB_BLOCK,       {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT}},
-    {VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_2BPP_BIT}},
-    {VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_4BPP_BIT}},
-    {VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_2BPP_BIT}},
-    {VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG, {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_4BPP_BIT}},
-    {VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_2BPP_BIT}},
-    {VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_4BPP_BIT}},
-    {VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_2BPP_BIT}},
-    {VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG,  {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_4BPP_BIT}},
-    // KHR_sampler_YCbCr_conversion extension - single-plane variants
-    // 'PACK' formats are normal, uncompressed
-    {VK_FORMAT_R10X6_UNORM_PACK16,                          {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R10X6G10X6_UNORM_2PACK16,                    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT}},
-    {VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_R10G10B10A10}},
-    {VK_FORMAT_R12X4_UNORM_PACK16,                          {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R12X4G12X4_UNORM_2PACK16,                    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT}},
-    {VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16,          {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_R12G12B12A12}},
-    // _422 formats encode 2 texels per entry with B, R components shared - treated as compressed w/ 2x1 block size
-    {VK_FORMAT_G8B8G8R8_422_UNORM,                          {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32BIT_G8B8G8R8}},
-    {VK_FORMAT_B8G8R8G8_422_UNORM,                          {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32BIT_B8G8R8G8}},
-    {VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16,      {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_G10B10G10R10}},
-    {VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16,      {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_B10G10R10G10}},
-    {VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16,      {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_G12B12G12R12}},
-    {VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16,      {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_B12G12R12G12}},
-    {VK_FORMAT_G16B16G16R16_422_UNORM,                      {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_G16B16G16R16}},
-    {VK_FORMAT_B16G16R16G16_422_UNORM,                      {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_B16G16R16G16}},
-    // KHR_sampler_YCbCr_conversion extension - multi-plane variants
-    // Formats that 'share' components among texels (_420 and _422), size represents total bytes for the smallest possible texel block
-    // _420 share B, R components within a 2x2 texel block
-    {VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM,                   {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_3PLANE_420}},
-    {VK_FORMAT_G8_B8R8_2PLANE_420_UNORM,                    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_2PLANE_420}},
-    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16,  {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_3PLANE_420}},
-    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16,   {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_2PLANE_420}},
-    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16,  {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_3PLANE_420}},
-    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16,   {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_2PLANE_420}},
-    {VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM,                {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_3PLANE_420}},
-    {VK_FORMAT_G16_B16R16_2PLANE_420_UNORM,                 {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_2PLANE_420}},
-    // _422 share B, R components within a 2x1 texel block
-    {VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM,                   {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_3PLANE_422}},
-    {VK_FORMAT_G8_B8R8_2PLANE_422_UNORM,                    {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_2PLANE_422}},
-    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16,  {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_3PLANE_422}},
-    {VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16,   {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_2PLANE_422}},
-    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16,  {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_3PLANE_422}},
-    {VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16,   {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_2PLANE_422}},
-    {VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM,                {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_3PLANE_422}},
-    {VK_FORMAT_G16_B16R16_2PLANE_422_UNORM,                 {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_2PLANE_422}},
-    // _444 do not share
-    {VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM,                   {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_3PLANE_444}},
-    {VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16,  {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_3PLANE_444}},
-    {VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16,  {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_3PLANE_444}},
-    {VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM,                {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_3PLANE_444}}
+//
+// The format info used to live in a std::map keyed by VkFormat; the hot helpers below
+// (FormatElementSize and friends) are called per-region in copy validation loops, so the
+// core formats -- a dense enum range starting at zero -- are stored in a flat array indexed
+// directly by format value, with small secondary arrays for the dense extension ranges.
+static constexpr VULKAN_FORMAT_INFO kCoreFormatTable[] = {
+    {0, 0, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_UNDEFINED
+    {1, 2, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R4G4_UNORM_PACK8
+    {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R4G4B4A4_UNORM_PACK16
+    {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_B4G4R4A4_UNORM_PACK16
+    {2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R5G6B5_UNORM_PACK16
+    {2, 3, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_B5G6R5_UNORM_PACK16
+    {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R5G5B5A1_UNORM_PACK16
+    {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_B5G5R5A1_UNORM_PACK16
+    {2, 4, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_A1R5G5B5_UNORM_PACK16
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_UNORM
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_SNORM
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_USCALED
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_SSCALED
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_UINT
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_SINT
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_8_BIT},  // VK_FORMAT_R8_SRGB
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_UNORM
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_SNORM
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_USCALED
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_SSCALED
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_UINT
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_SINT
+    {2, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R8G8_SRGB
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_UNORM
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_SNORM
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_USCALED
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_SSCALED
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_UINT
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_SINT
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_R8G8B8_SRGB
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_UNORM
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_SNORM
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_USCALED
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_SSCALED
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_UINT
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_SINT
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_24_BIT},  // VK_FORMAT_B8G8R8_SRGB
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_UNORM
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_SNORM
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_USCALED
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_SSCALED
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_UINT
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_SINT
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R8G8B8A8_SRGB
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_UNORM
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_SNORM
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_USCALED
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_SSCALED
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_UINT
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_SINT
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B8G8R8A8_SRGB
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_UNORM_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_SNORM_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_USCALED_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_SSCALED_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_UINT_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_SINT_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A8B8G8R8_SRGB_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2R10G10B10_UNORM_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2R10G10B10_SNORM_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2R10G10B10_USCALED_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2R10G10B10_SSCALED_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2R10G10B10_UINT_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2R10G10B10_SINT_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2B10G10R10_UNORM_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2B10G10R10_SNORM_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2B10G10R10_USCALED_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2B10G10R10_SSCALED_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2B10G10R10_UINT_PACK32
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_A2B10G10R10_SINT_PACK32
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_UNORM
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_SNORM
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_USCALED
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_SSCALED
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_UINT
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_SINT
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R16_SFLOAT
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_UNORM
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_SNORM
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_USCALED
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_SSCALED
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_UINT
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_SINT
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R16G16_SFLOAT
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_UNORM
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_SNORM
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_USCALED
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_SSCALED
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_UINT
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_SINT
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_48_BIT},  // VK_FORMAT_R16G16B16_SFLOAT
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_UNORM
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_SNORM
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_USCALED
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_SSCALED
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_UINT
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_SINT
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R16G16B16A16_SFLOAT
+    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R32_UINT
+    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R32_SINT
+    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R32_SFLOAT
+    {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R32G32_UINT
+    {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R32G32_SINT
+    {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R32G32_SFLOAT
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT},  // VK_FORMAT_R32G32B32_UINT
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT},  // VK_FORMAT_R32G32B32_SINT
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_96_BIT},  // VK_FORMAT_R32G32B32_SFLOAT
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},  // VK_FORMAT_R32G32B32A32_UINT
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},  // VK_FORMAT_R32G32B32A32_SINT
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},  // VK_FORMAT_R32G32B32A32_SFLOAT
+    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R64_UINT
+    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R64_SINT
+    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_64_BIT},  // VK_FORMAT_R64_SFLOAT
+    {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},  // VK_FORMAT_R64G64_UINT
+    {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},  // VK_FORMAT_R64G64_SINT
+    {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_128_BIT},  // VK_FORMAT_R64G64_SFLOAT
+    {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT},  // VK_FORMAT_R64G64B64_UINT
+    {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT},  // VK_FORMAT_R64G64B64_SINT
+    {24, 3, VK_FORMAT_COMPATIBILITY_CLASS_192_BIT},  // VK_FORMAT_R64G64B64_SFLOAT
+    {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT},  // VK_FORMAT_R64G64B64A64_UINT
+    {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT},  // VK_FORMAT_R64G64B64A64_SINT
+    {32, 4, VK_FORMAT_COMPATIBILITY_CLASS_256_BIT},  // VK_FORMAT_R64G64B64A64_SFLOAT
+    {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+    {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_E5B9G9R9_UFLOAT_PACK32
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_D16_UNORM
+    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_X8_D24_UNORM_PACK32
+    {4, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_D32_SFLOAT
+    {1, 1, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_S8_UINT
+    {3, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_D16_UNORM_S8_UINT
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_D24_UNORM_S8_UINT
+    {8, 2, VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT},  // VK_FORMAT_D32_SFLOAT_S8_UINT
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT},  // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGB_BIT},  // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT},  // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC1_RGBA_BIT},  // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT},  // VK_FORMAT_BC2_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC2_BIT},  // VK_FORMAT_BC2_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT},  // VK_FORMAT_BC3_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC3_BIT},  // VK_FORMAT_BC3_SRGB_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT},  // VK_FORMAT_BC4_UNORM_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC4_BIT},  // VK_FORMAT_BC4_SNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT},  // VK_FORMAT_BC5_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC5_BIT},  // VK_FORMAT_BC5_SNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT},  // VK_FORMAT_BC6H_UFLOAT_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC6H_BIT},  // VK_FORMAT_BC6H_SFLOAT_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT},  // VK_FORMAT_BC7_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_BC7_BIT},  // VK_FORMAT_BC7_SRGB_BLOCK
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT},  // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGB_BIT},  // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT},  // VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_RGBA_BIT},  // VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT},  // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ETC2_EAC_RGBA_BIT},  // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT},  // VK_FORMAT_EAC_R11_UNORM_BLOCK
+    {8, 1, VK_FORMAT_COMPATIBILITY_CLASS_EAC_R_BIT},  // VK_FORMAT_EAC_R11_SNORM_BLOCK
+    {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT},  // VK_FORMAT_EAC_R11G11_UNORM_BLOCK
+    {16, 2, VK_FORMAT_COMPATIBILITY_CLASS_EAC_RG_BIT},  // VK_FORMAT_EAC_R11G11_SNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT},  // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_4X4_BIT},  // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT},  // VK_FORMAT_ASTC_5x4_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X4_BIT},  // VK_FORMAT_ASTC_5x4_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT},  // VK_FORMAT_ASTC_5x5_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_5X5_BIT},  // VK_FORMAT_ASTC_5x5_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT},  // VK_FORMAT_ASTC_6x5_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X5_BIT},  // VK_FORMAT_ASTC_6x5_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT},  // VK_FORMAT_ASTC_6x6_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_6X6_BIT},  // VK_FORMAT_ASTC_6x6_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT},  // VK_FORMAT_ASTC_8x5_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X5_BIT},  // VK_FORMAT_ASTC_8x5_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT},  // VK_FORMAT_ASTC_8x6_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X6_BIT},  // VK_FORMAT_ASTC_8x6_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT},  // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_8X8_BIT},  // VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT},  // VK_FORMAT_ASTC_10x5_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X5_BIT},  // VK_FORMAT_ASTC_10x5_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT},  // VK_FORMAT_ASTC_10x6_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X6_BIT},  // VK_FORMAT_ASTC_10x6_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT},  // VK_FORMAT_ASTC_10x8_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X8_BIT},  // VK_FORMAT_ASTC_10x8_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT},  // VK_FORMAT_ASTC_10x10_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_10X10_BIT},  // VK_FORMAT_ASTC_10x10_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT},  // VK_FORMAT_ASTC_12x10_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X10_BIT},  // VK_FORMAT_ASTC_12x10_SRGB_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT},  // VK_FORMAT_ASTC_12x12_UNORM_BLOCK
+    {16, 4, VK_FORMAT_COMPATIBILITY_CLASS_ASTC_12X12_BIT},  // VK_FORMAT_ASTC_12x12_SRGB_BLOCK
 };
 
+static_assert(sizeof(kCoreFormatTable) / sizeof(kCoreFormatTable[0]) == VK_FORMAT_ASTC_12x12_SRGB_BLOCK + 1,
+              "kCoreFormatTable must cover the dense core VkFormat range");
+
+static constexpr VULKAN_FORMAT_INFO kPvrtcFormatTable[] = {
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_2BPP_BIT},  // VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_4BPP_BIT},  // VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_2BPP_BIT},  // VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_4BPP_BIT},  // VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_2BPP_BIT},  // VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC1_4BPP_BIT},  // VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_2BPP_BIT},  // VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_PVRTC2_4BPP_BIT},  // VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG
+};
+
+static_assert(sizeof(kPvrtcFormatTable) / sizeof(kPvrtcFormatTable[0]) ==
+                  VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG - VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG + 1,
+              "kPvrtcFormatTable must cover the dense PVRTC VkFormat range");
+
+static constexpr VULKAN_FORMAT_INFO kYcbcrFormatTable[] = {
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32BIT_G8B8G8R8},  // VK_FORMAT_G8B8G8R8_422_UNORM
+    {4, 4, VK_FORMAT_COMPATIBILITY_CLASS_32BIT_B8G8R8G8},  // VK_FORMAT_B8G8R8G8_422_UNORM
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_3PLANE_420},  // VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_2PLANE_420},  // VK_FORMAT_G8_B8R8_2PLANE_420_UNORM
+    {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_3PLANE_422},  // VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM
+    {4, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_2PLANE_422},  // VK_FORMAT_G8_B8R8_2PLANE_422_UNORM
+    {3, 3, VK_FORMAT_COMPATIBILITY_CLASS_8BIT_3PLANE_444},  // VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R10X6_UNORM_PACK16
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_32_BIT},  // VK_FORMAT_R10X6G10X6_UNORM_2PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_R10G10B10A10},  // VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_G10B10G10R10},  // VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_B10G10R10G10},  // VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_3PLANE_420},  // VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_2PLANE_420},  // VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_3PLANE_422},  // VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_2PLANE_422},  // VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_10BIT_3PLANE_444},  // VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16
+    {2, 1, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R12X4_UNORM_PACK16
+    {4, 2, VK_FORMAT_COMPATIBILITY_CLASS_16_BIT},  // VK_FORMAT_R12X4G12X4_UNORM_2PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_R12G12B12A12},  // VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_G12B12G12R12},  // VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_B12G12R12G12},  // VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_3PLANE_420},  // VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_2PLANE_420},  // VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_3PLANE_422},  // VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_2PLANE_422},  // VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_12BIT_3PLANE_444},  // VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_G16B16G16R16},  // VK_FORMAT_G16B16G16R16_422_UNORM
+    {8, 4, VK_FORMAT_COMPATIBILITY_CLASS_64BIT_B16G16R16G16},  // VK_FORMAT_B16G16R16G16_422_UNORM
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_3PLANE_420},  // VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM
+    {12, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_2PLANE_420},  // VK_FORMAT_G16_B16R16_2PLANE_420_UNORM
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_3PLANE_422},  // VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM
+    {8, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_2PLANE_422},  // VK_FORMAT_G16_B16R16_2PLANE_422_UNORM
+    {6, 3, VK_FORMAT_COMPATIBILITY_CLASS_16BIT_3PLANE_444},  // VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM
+};
+
+static_assert(sizeof(kYcbcrFormatTable) / sizeof(kYcbcrFormatTable[0]) ==
+                  VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM - VK_FORMAT_G8B8G8R8_422_UNORM + 1,
+              "kYcbcrFormatTable must cover the dense sampler-YCbCr-conversion VkFormat range");
+
 // Renable formatting
 // clang-format on
 
+// Constant-time format info lookup: a bounds check plus an array read, no pointer chasing.
+// Returns null for format values outside the tabulated ranges.
+static const VULKAN_FORMAT_INFO *FindFormatInfo(VkFormat format) {
+    const uint32_t index = static_cast<uint32_t>(format);
+    if (index < (sizeof(kCoreFormatTable) / sizeof(kCoreFormatTable[0]))) {
+        return &kCoreFormatTable[index];
+    }
+    if ((format >= VK_FORMAT_G8B8G8R8_422_UNORM) && (format <= VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM)) {
+        return &kYcbcrFormatTable[index - static_cast<uint32_t>(VK_FORMAT_G8B8G8R8_422_UNORM)];
+    }
+    if ((format >= VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG) && (format <= VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG)) {
+        return &kPvrtcFormatTable[index - static_cast<uint32_t>(VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG)];
+    }
+    return nullptr;
+}
+
 // Return true if format is an ETC2 or EAC compressed texture format
 VK_LAYER_EXPORT bool FormatIsCompressed_ETC2_EAC(VkFormat format) {
     bool found = false;
@@ -1148,9 +1178,9 @@ VK_LAYER_EXPORT uint32_t FormatPlaneCount(VkFormat format) {
 
 // Return format class of the specified format
 VK_LAYER_EXPORT VkFormatCompatibilityClass FormatCompatibilityClass(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.format_class;
+    const VULKAN_FORMAT_INFO *info = FindFormatInfo(format);
+    if (info) {
+        return info->format_class;
     }
     return VK_FORMAT_COMPATIBILITY_CLASS_NONE_BIT;
 }
@@ -1176,9 +1206,9 @@ VK_LAYER_EXPORT uint32_t FormatElementSize(VkFormat format, VkImageAspectFlags a
         format = FindMultiplaneCompatibleFormat(format, aspectMask);
     }
 
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.size;
+    const VULKAN_FORMAT_INFO *info = FindFormatInfo(format);
+    if (info) {
+        return info->size;
     }
     return 0;
 }
@@ -1197,9 +1227,9 @@ VK_LAYER_EXPORT double FormatTexelSize(VkFormat format) {
 
 // Return the number of channels for a given format
 uint32_t FormatChannelCount(VkFormat format) {
-    auto item = vk_format_table.find(format);
-    if (item != vk_format_table.end()) {
-        return item->second.channel_count;
+    const VULKAN_FORMAT_INFO *info = FindFormatInfo(format);
+    if (info) {
+        return info->channel_count;
     }
     return 0;
 }
@@ -20,35 +20,521 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
-// For the given data key, look up the layer_data instance from given layer_data_map
+// Shared synchronization state for GetLayerDataPtr/FreeLayerDataPtr, one instance per layer_data type.
+// The free_epoch counter is bumped every time an entry is freed so that per-thread caches of the most
+// recent lookup can be invalidated without taking the lock.
+template <typename DATA_T>
+struct LayerDataMapState {
+    static std::mutex lock;
+    static std::atomic<uint64_t> free_epoch;
+};
+template <typename DATA_T>
+std::mutex LayerDataMapState<DATA_T>::lock;
+template <typename DATA_T>
+std::atomic<uint64_t> LayerDataMapState<DATA_T>::free_epoch{0};
+
+// For the given data key, look up the layer_data instance from given layer_data_map.  This runs on
+// every intercepted entry point, so repeat lookups of the same key from the same thread are served
+// from a thread-local cache of the last result and skip the map (and its lock) entirely.
 template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    DATA_T *debug_data;
-    typename std::unordered_map<void *, DATA_T *>::const_iterator got;
+    thread_local void *cached_key = nullptr;
+    thread_local DATA_T *cached_data = nullptr;
+    thread_local uint64_t cached_epoch = 0;
 
-    /* TODO: We probably should lock here, or have caller lock */
-    got = layer_data_map.find(data_key);
+    uint64_t epoch = LayerDataMapState<DATA_T>::free_epoch.load(std::memory_order_acquire);
+    if (data_key == cached_key && epoch == cached_epoch) {
+        return cached_data;
+    }
 
-    if (got == layer_data_map.end()) {
-        debug_data = new DATA_T;
-        layer_data_map[(void *)data_key] = debug_data;
-    } else {
-        debug_data = got->second;
+    DATA_T *debug_data;
+    {
+        std::lock_guard<std::mutex> lock(LayerDataMapState<DATA_T>::lock);
+        auto got = layer_data_map.find(data_key);
+
+        if (got == layer_data_map.end()) {
+            debug_data = new DATA_T;
+            layer_data_map[(void *)data_key] = debug_data;
+        } else {
+            debug_data = got->second;
+        }
     }
 
+    cached_key = data_key;
+    cached_data = debug_data;
+    cached_epoch = epoch;
+
     return debug_data;
 }
 
 template <typename DATA_T>
 void FreeLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
-    auto got = layer_data_map.find(data_key);
-    assert(got != layer_data_map.end());
+    DATA_T *debug_data;
+    {
+        std::lock_guard<std::mutex> lock(LayerDataMapState<DATA_T>::lock);
+        auto got = layer_data_map.find(data_key);
+        assert(got != layer_data_map.end());
+
+        debug_data = got->second;
+        layer_data_map.erase(got);
+    }
+    // Invalidate any thread-local caches of this entry before the object goes away
+    LayerDataMapState<DATA_T>::free_epoch.fetch_add(1, std::memory_order_release);
 
-    delete got->second;
-    layer_data_map.erase(got);
+    delete debug_data;
 }
 
+// Open-addressing hash map for handle->state lookups.  Vulkan handles are already well-distributed
+// 64-bit values, so a lookup is one multiplicative mix plus a short linear probe over a contiguous
+// slot array -- no per-node allocation and no bucket pointer chase, which std::unordered_map pays
+// on every Get*State call.  The interface is the subset of std::unordered_map the layers use;
+// like unordered_map, iterators (but not the values a lookup returned by pointer) are invalidated
+// by rehashing inserts.
+template <typename Key, typename T>
+class vl_flat_map {
+  public:
+    typedef std::pair<const Key, T> value_type;
+
+    vl_flat_map() : size_(0), tombstones_(0), capacity_(0) {}
+    ~vl_flat_map() { DestroySlots(); }
+    vl_flat_map(const vl_flat_map &) = delete;
+    vl_flat_map &operator=(const vl_flat_map &) = delete;
+
+    template <bool IsConst>
+    class iterator_impl {
+      public:
+        typedef typename std::conditional<IsConst, const vl_flat_map, vl_flat_map>::type MapType;
+        typedef typename std::conditional<IsConst, const value_type, value_type>::type ValueType;
+
+        iterator_impl() : map_(nullptr), index_(0) {}
+        iterator_impl(MapType *map, size_t index) : map_(map), index_(index) { SkipEmpty(); }
+        // Conversion from iterator to const_iterator
+        template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+        iterator_impl(const iterator_impl<false> &other) : map_(other.map_), index_(other.index_) {}
+
+        ValueType &operator*() const { return *map_->Slot(index_); }
+        ValueType *operator->() const { return map_->Slot(index_); }
+        iterator_impl &operator++() {
+            ++index_;
+            SkipEmpty();
+            return *this;
+        }
+        bool operator==(const iterator_impl &other) const { return index_ == other.index_; }
+        bool operator!=(const iterator_impl &other) const { return index_ != other.index_; }
+
+      private:
+        void SkipEmpty() {
+            while (map_ && index_ < map_->capacity_ && map_->ctrl_[index_] != kFull) ++index_;
+        }
+        MapType *map_;
+        size_t index_;
+        friend class vl_flat_map;
+        friend class iterator_impl<true>;
+    };
+    typedef iterator_impl<false> iterator;
+    typedef iterator_impl<true> const_iterator;
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity_); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity_); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator find(const Key &key) {
+        size_t index = FindIndex(key);
+        return (index == kNotFound) ? end() : iterator(this, index);
+    }
+    const_iterator find(const Key &key) const {
+        size_t index = FindIndex(key);
+        return (index == kNotFound) ? end() : const_iterator(this, index);
+    }
+    size_t count(const Key &key) const { return (FindIndex(key) == kNotFound) ? 0 : 1; }
+
+    T &operator[](const Key &key) {
+        size_t index = FindOrInsertIndex(key);
+        return Slot(index)->second;
+    }
+
+    std::pair<iterator, bool> insert(value_type &&value) {
+        size_t index = FindIndex(value.first);
+        if (index != kNotFound) return std::make_pair(iterator(this, index), false);
+        index = FindOrInsertIndex(value.first);
+        Slot(index)->second = std::move(value.second);
+        return std::make_pair(iterator(this, index), true);
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> emplace(const Key &key, M &&value) {
+        size_t index = FindIndex(key);
+        if (index != kNotFound) return std::make_pair(iterator(this, index), false);
+        index = FindOrInsertIndex(key);
+        Slot(index)->second = std::forward<M>(value);
+        return std::make_pair(iterator(this, index), true);
+    }
+
+    size_t erase(const Key &key) {
+        size_t index = FindIndex(key);
+        if (index == kNotFound) return 0;
+        EraseIndex(index);
+        return 1;
+    }
+
+    iterator erase(const_iterator pos) {
+        size_t index = pos.index_;
+        EraseIndex(index);
+        return iterator(this, index + 1);
+    }
+
+    void clear() {
+        DestroySlots();
+        ctrl_.clear();
+        slots_.reset();
+        size_ = tombstones_ = 0;
+        capacity_ = 0;
+    }
+
+  private:
+    enum CtrlState : int8_t { kEmpty = 0, kFull = 1, kTombstone = 2 };
+    static const size_t kNotFound = SIZE_MAX;
+
+    typedef typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type SlotStorage;
+
+    value_type *Slot(size_t index) const {
+        return reinterpret_cast<value_type *>(const_cast<SlotStorage *>(&slots_[index]));
+    }
+
+    size_t Probe(const Key &key) const {
+        // Fibonacci multiplicative mix; handles convert cleanly whether pointers or uint64_t
+        return (size_t)(((uint64_t)key * 0x9E3779B97F4A7C15ULL) >> shift_);
+    }
+
+    size_t FindIndex(const Key &key) const {
+        if (capacity_ == 0) return kNotFound;
+        size_t index = Probe(key);
+        while (true) {
+            if (ctrl_[index] == kEmpty) return kNotFound;
+            if (ctrl_[index] == kFull && Slot(index)->first == key) return index;
+            index = (index + 1) & (capacity_ - 1);
+        }
+    }
+
+    size_t FindOrInsertIndex(const Key &key) {
+        // Grow at 3/4 occupancy (including tombstones, which also lengthen probes)
+        if (capacity_ == 0 || (size_ + tombstones_ + 1) * 4 > capacity_ * 3) {
+            Rehash((size_ + 1) * 2 > capacity_ ? std::max<size_t>(capacity_ * 2, 16) : capacity_);
+        }
+        size_t index = Probe(key);
+        size_t insert_index = kNotFound;
+        while (true) {
+            if (ctrl_[index] == kEmpty) {
+                if (insert_index == kNotFound) insert_index = index;
+                break;
+            }
+            if (ctrl_[index] == kFull && Slot(index)->first == key) return index;
+            if (ctrl_[index] == kTombstone && insert_index == kNotFound) insert_index = index;
+            index = (index + 1) & (capacity_ - 1);
+        }
+        if (ctrl_[insert_index] == kTombstone) tombstones_--;
+        new (Slot(insert_index)) value_type(key, T());
+        ctrl_[insert_index] = kFull;
+        size_++;
+        return insert_index;
+    }
+
+    void EraseIndex(size_t index) {
+        assert(ctrl_[index] == kFull);
+        Slot(index)->~value_type();
+        ctrl_[index] = kTombstone;
+        size_--;
+        tombstones_++;
+    }
+
+    void Rehash(size_t new_capacity) {
+        std::vector<int8_t> old_ctrl;
+        old_ctrl.swap(ctrl_);
+        std::unique_ptr<SlotStorage[]> old_slots = std::move(slots_);
+        const size_t old_capacity = capacity_;
+
+        capacity_ = new_capacity;
+        shift_ = 64;
+        for (size_t c = capacity_; c > 1; c >>= 1) shift_--;
+        ctrl_.assign(capacity_, kEmpty);
+        slots_.reset(new SlotStorage[capacity_]);
+        size_ = tombstones_ = 0;
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_ctrl[i] != kFull) continue;
+            value_type *old_slot = reinterpret_cast<value_type *>(&old_slots[i]);
+            size_t index = FindOrInsertIndexNoGrow(old_slot->first);
+            Slot(index)->second = std::move(old_slot->second);
+            old_slot->~value_type();
+        }
+    }
+
+    size_t FindOrInsertIndexNoGrow(const Key &key) {
+        size_t index = Probe(key);
+        while (ctrl_[index] != kEmpty) index = (index + 1) & (capacity_ - 1);
+        new (Slot(index)) value_type(key, T());
+        ctrl_[index] = kFull;
+        size_++;
+        return index;
+    }
+
+    void DestroySlots() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (ctrl_[i] == kFull) Slot(i)->~value_type();
+        }
+    }
+
+    std::vector<int8_t> ctrl_;
+    std::unique_ptr<SlotStorage[]> slots_;
+    size_t size_;
+    size_t tombstones_;
+    size_t capacity_;  // always zero or a power of two
+    int shift_ = 64;   // 64 - log2(capacity_), for the multiplicative probe
+};
+
+// A thread-safe unordered map intended for handle wrapping and other hot lookup paths.  The key space
+// is sharded across 2^BUCKETSLOG2 independently locked submaps, so lookups and insertions from
+// different threads rarely contend, and readers of a shard proceed concurrently under a shared lock.
+template <typename Key, typename T, int BUCKETSLOG2 = 2>
+class vl_concurrent_unordered_map {
+  public:
+    void insert_or_assign(const Key &key, const T &value) {
+        uint32_t h = ConcurrentMapHashObject(key);
+        write_lock_guard lock(locks[h].lock);
+        maps[h][key] = value;
+    }
+
+    bool insert(const Key &key, const T &value) {
+        uint32_t h = ConcurrentMapHashObject(key);
+        write_lock_guard lock(locks[h].lock);
+        auto ret = maps[h].emplace(key, value);
+        return ret.second;
+    }
+
+    // returns size_t count of erased elements
+    size_t erase(const Key &key) {
+        uint32_t h = ConcurrentMapHashObject(key);
+        write_lock_guard lock(locks[h].lock);
+        return maps[h].erase(key);
+    }
+
+    bool contains(const Key &key) const {
+        uint32_t h = ConcurrentMapHashObject(key);
+        read_lock_guard lock(locks[h].lock);
+        return maps[h].count(key) != 0;
+    }
+
+    // Lookups return a copy of the mapped value (if any) rather than an iterator, since an iterator
+    // could not be used safely once the shard lock is dropped.  FindResult mimics just enough of the
+    // unordered_map iterator interface for the existing call sites:
+    //     auto iter = map.find(key);
+    //     if (iter != map.end()) use(iter->second);
+    class FindResult {
+      public:
+        FindResult(bool found, T value) : result_(found, std::move(value)) {}
+
+        // Compare against end(), which is any FindResult with found == false
+        bool operator==(const FindResult &other) const { return result_.first == other.result_.first; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        const std::pair<bool, T> *operator->() const { return &result_; }
+
+      private:
+        // .first is the found flag, .second is a copy of the mapped value
+        std::pair<bool, T> result_;
+    };
+
+    FindResult end() const { return FindResult(false, T()); }
+
+    FindResult find(const Key &key) const {
+        uint32_t h = ConcurrentMapHashObject(key);
+        read_lock_guard lock(locks[h].lock);
+        auto itr = maps[h].find(key);
+        if (itr != maps[h].end()) {
+            return FindResult(true, itr->second);
+        }
+        return end();
+    }
+
+    // Atomically look up and remove an entry, returning the removed value (if any)
+    FindResult pop(const Key &key) {
+        uint32_t h = ConcurrentMapHashObject(key);
+        write_lock_guard lock(locks[h].lock);
+        auto itr = maps[h].find(key);
+        if (itr != maps[h].end()) {
+            FindResult ret(true, std::move(itr->second));
+            maps[h].erase(itr);
+            return ret;
+        }
+        return end();
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot() const {
+        std::vector<std::pair<const Key, T>> ret;
+        for (int h = 0; h < BUCKETS; ++h) {
+            read_lock_guard lock(locks[h].lock);
+            for (const auto &entry : maps[h]) {
+                ret.emplace_back(entry.first, entry.second);
+            }
+        }
+        return ret;
+    }
+
+  private:
+    static const int BUCKETS = (1 << BUCKETSLOG2);
+    typedef std::unique_lock<std::shared_timed_mutex> write_lock_guard;
+    typedef std::shared_lock<std::shared_timed_mutex> read_lock_guard;
+
+    vl_flat_map<Key, T> maps[BUCKETS];
+    struct {
+        mutable std::shared_timed_mutex lock;
+        // Avoid false sharing between adjacent shard locks
+        char padding[(sizeof(std::shared_timed_mutex) % 64) ? (64 - sizeof(std::shared_timed_mutex) % 64) : 64];
+    } locks[BUCKETS];
+
+    uint32_t ConcurrentMapHashObject(const Key &object) const {
+        uint64_t u64 = (uint64_t)(uintptr_t)object;
+        uint32_t hash = static_cast<uint32_t>(u64 >> 32) + static_cast<uint32_t>(u64);
+        hash ^= (hash >> BUCKETSLOG2) ^ (hash >> (2 * BUCKETSLOG2));
+        hash &= (BUCKETS - 1);
+        return hash;
+    }
+};
+
+// Generation-checked slot map used to back handle wrapping.  Because the layer invents the wrapped
+// handle values, they can encode their own storage location: the low bits of an id select a slot in
+// a slab-allocated table and the high bits carry a generation number that is bumped every time the
+// slot is recycled.  Unwrapping a handle is then an array index plus a generation compare -- no
+// hashing and no lock -- and a stale (destroyed) id reliably misses because its generation no
+// longer matches the slot.  Live slots hold an odd generation, free slots an even one, so a freed
+// slot fails lookups even before it is reused.
+class vl_slot_map {
+  public:
+    vl_slot_map() : next_unused_slot_(1) {  // slot 0 is reserved so that no valid id is 0
+        for (auto &slab : slabs_) slab = nullptr;
+    }
+
+    ~vl_slot_map() {
+        for (auto &slab : slabs_) delete[] slab.load(std::memory_order_relaxed);
+    }
+
+    // Store a value in a fresh slot and return the encoded id for it.
+    uint64_t add(uint64_t value) {
+        std::lock_guard<std::mutex> guard(slot_alloc_lock_);
+        uint32_t slot;
+        if (free_slots_.size()) {
+            slot = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            slot = next_unused_slot_++;
+            assert(slot < kMaxSlots);
+            if (!slabs_[slot >> kSlabShift].load(std::memory_order_relaxed)) {
+                slabs_[slot >> kSlabShift].store(new Slot[kSlabSize], std::memory_order_release);
+            }
+        }
+        Slot &entry = SlotRef(slot);
+        uint64_t generation = entry.generation.load(std::memory_order_relaxed) + 1;  // even (free) -> odd (live)
+        entry.value.store(value, std::memory_order_relaxed);
+        entry.generation.store(generation, std::memory_order_release);
+        return (generation << kSlotIndexBits) | slot;
+    }
+
+    // Slot index encoded in an id handed out by add().  Side tables keyed by wrapped handles can
+    // use this to turn their own lookups into direct array indexing.
+    static uint32_t SlotOfId(uint64_t id) { return static_cast<uint32_t>(id & (kMaxSlots - 1)); }
+
+    class FindResult {
+      public:
+        FindResult(bool found, uint64_t value) : result_(found, value) {}
+
+        // Compare against end(), which is any FindResult with found == false
+        bool operator==(const FindResult &other) const { return result_.first == other.result_.first; }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        const std::pair<bool, uint64_t> *operator->() const { return &result_; }
+
+      private:
+        std::pair<bool, uint64_t> result_;
+    };
+
+    FindResult end() const { return FindResult(false, 0); }
+
+    FindResult find(uint64_t id) const {
+        const Slot *entry = ValidateId(id);
+        if (!entry) return end();
+        const uint64_t generation = id >> kSlotIndexBits;
+        // Seqlock-style read: the value is only trusted if the generation is unchanged around it,
+        // so a concurrent pop-and-reuse of the slot cannot hand back the wrong handle.
+        uint64_t value = entry->value.load(std::memory_order_acquire);
+        if (entry->generation.load(std::memory_order_acquire) != generation) return end();
+        return FindResult(true, value);
+    }
+
+    // Atomically look up and remove an entry, returning the removed value (if any)
+    FindResult pop(uint64_t id) {
+        std::lock_guard<std::mutex> guard(slot_alloc_lock_);
+        Slot *entry = ValidateId(id);
+        if (!entry) return end();
+        uint64_t value = entry->value.load(std::memory_order_relaxed);
+        entry->generation.fetch_add(1, std::memory_order_release);  // odd (live) -> even (free)
+        free_slots_.push_back(static_cast<uint32_t>(id & (kMaxSlots - 1)));
+        return FindResult(true, value);
+    }
+
+    // returns size_t count of erased elements
+    size_t erase(uint64_t id) { return (pop(id) != end()) ? 1 : 0; }
+
+  private:
+    // 24 bits of slot index (16M live handles) leaves 40 bits of generation; a slot must be
+    // recycled 2^39 times before a stale id can alias, which we do not defend against.
+    static const uint32_t kSlotIndexBits = 24;
+    static const uint32_t kSlabShift = 12;
+    static const uint32_t kSlabSize = 1u << kSlabShift;
+    static const uint64_t kMaxSlots = 1ull << kSlotIndexBits;
+
+    struct Slot {
+        std::atomic<uint64_t> generation{0};
+        std::atomic<uint64_t> value{0};
+    };
+
+    Slot &SlotRef(uint32_t slot) const {
+        return slabs_[slot >> kSlabShift].load(std::memory_order_acquire)[slot & (kSlabSize - 1)];
+    }
+
+    // Decode an id and return its slot if the id is in range and its generation is current.
+    // Returns nullptr for ids we never handed out (including VK_NULL_HANDLE).
+    Slot *ValidateId(uint64_t id) const {
+        const uint64_t slot = id & (kMaxSlots - 1);
+        const uint64_t generation = id >> kSlotIndexBits;
+        if ((generation & 1) == 0) return nullptr;  // even generations are never published
+        if (!slabs_[slot >> kSlabShift].load(std::memory_order_acquire)) return nullptr;
+        Slot &entry = SlotRef(static_cast<uint32_t>(slot));
+        if (entry.generation.load(std::memory_order_acquire) != generation) return nullptr;
+        return &entry;
+    }
+
+    std::atomic<Slot *> slabs_[kMaxSlots / kSlabSize];
+    std::mutex slot_alloc_lock_;
+    std::vector<uint32_t> free_slots_;
+    uint32_t next_unused_slot_;
+};
+
 #endif  // LAYER_DATA_H
@@ -32,7 +32,11 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <thread>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -58,6 +62,18 @@
 #define DECORATE_UNUSED
 #endif
 
+// Annotation for outlined error-reporting helpers.  Validation error paths are almost never
+// taken, so keeping their string formatting and log_msg machinery in separate cold functions
+// lets the pass path of hot checks compile to a compact branch-and-fall-through sequence that
+// stays icache-resident.
+#if defined(__GNUC__) || defined(__clang__)
+#define VL_COLD_ERROR_PATH __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define VL_COLD_ERROR_PATH __declspec(noinline)
+#else
+#define VL_COLD_ERROR_PATH
+#endif
+
 #if defined __ANDROID__
 #include <android/log.h>
 #define LOGCONSOLE(...) ((void)__android_log_print(ANDROID_LOG_INFO, "VALIDATION", __VA_ARGS__))
@@ -71,6 +87,17 @@
 
 static const char DECORATE_UNUSED *kVUIDUndefined = "VUID_Undefined";
 
+// Non-owning view of a VUID string.  log_msg call sites overwhelmingly pass string literals, so
+// taking this by value avoids constructing (and heap-allocating) a std::string per message.
+struct vuid_text_view {
+    vuid_text_view(const char *str) : str_(str) {}
+    vuid_text_view(const std::string &str) : str_(str.c_str()) {}
+    const char *c_str() const { return str_; }
+
+   private:
+    const char *str_;
+};
+
 #undef DECORATE_UNUSED
 
 // TODO: Could be autogenerated for the specific handles for extra type safety...
@@ -139,17 +166,144 @@ struct LoggingLabelState {
 
 static inline int string_sprintf(std::string *output, const char *fmt, ...);
 
+// One formatted message in flight to the asynchronous drain thread
+struct AsyncLogRecord {
+    VkFlags msg_flags;
+    VkDebugReportObjectTypeEXT object_type;
+    uint64_t src_object;
+    std::string vuid_text;
+    std::string message;
+};
+
+// Bounded multi-producer single-consumer ring.  Producers claim a slot with a CAS on the tail and
+// publish it by advancing the slot's sequence number; the single consumer owns the head outright,
+// so neither side ever takes a lock.
+class AsyncLogQueue {
+   public:
+    AsyncLogQueue() {
+        for (size_t i = 0; i < kCapacity; i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Takes ownership of record on success; returns false (ring full) without blocking otherwise
+    bool TryEnqueue(AsyncLogRecord *record) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot &slot = slots_[pos & (kCapacity - 1)];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.record = record;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer only; returns null when the ring is empty
+    AsyncLogRecord *TryDequeue() {
+        Slot &slot = slots_[head_ & (kCapacity - 1)];
+        size_t seq = slot.sequence.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(head_ + 1) < 0) {
+            return nullptr;
+        }
+        AsyncLogRecord *record = slot.record;
+        slot.sequence.store(head_ + kCapacity, std::memory_order_release);
+        head_++;
+        return record;
+    }
+
+   private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        AsyncLogRecord *record;
+    };
+    static const size_t kCapacity = 1024;  // must be a power of two
+    Slot slots_[kCapacity];
+    std::atomic<size_t> tail_{0};  // next slot producers will claim
+    size_t head_ = 0;              // next slot the consumer will read
+};
+
+// Optional asynchronous delivery mode (the log_async layer option): log_msg enqueues formatted
+// records and a dedicated drain thread runs the user callbacks, so validation threads never
+// serialize behind callback execution or log I/O.  Asynchronously delivered messages cannot
+// observe a callback's bail request, so log_msg reports no bail for them.
+class AsyncLogRelay {
+   public:
+    explicit AsyncLogRelay(struct _debug_report_data *debug_data)
+        : debug_data_(debug_data), drain_thread_(&AsyncLogRelay::Run, this) {}
+    AsyncLogRelay(const AsyncLogRelay &) = delete;
+    AsyncLogRelay &operator=(const AsyncLogRelay &) = delete;
+    // Flush-on-destroy: the drain thread empties the ring before exiting
+    ~AsyncLogRelay() {
+        exiting_.store(true, std::memory_order_release);
+        wake_.notify_one();
+        drain_thread_.join();
+    }
+
+    // Takes ownership of record on success; returns false when the ring is full, in which case the
+    // caller delivers the message itself rather than dropping it or blocking on the consumer
+    bool Enqueue(AsyncLogRecord *record) { return queue_.TryEnqueue(record); }
+
+   private:
+    void Run();       // defined below debug_log_msg
+    void DrainAll();  //
+
+    struct _debug_report_data *debug_data_;
+    AsyncLogQueue queue_;
+    std::atomic<bool> exiting_{false};
+    std::mutex wake_lock_;
+    std::condition_variable wake_;
+    std::thread drain_thread_;  // last member, so everything above is ready before the thread runs
+};
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list{nullptr};
     VkLayerDbgFunctionNode *default_debug_callback_list{nullptr};
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
+    // Read without the mutex by the log_msg fast-reject path, hence atomic
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
+    // Non-null when the log_async layer option routes messages through the drain thread
+    AsyncLogRelay *async_relay{nullptr};
+    // Duplicate suppression (the duplicate_message_suppression layer option): repeats keyed by
+    // hashed VUID + object are counted instead of formatted and delivered; suppressed totals are
+    // reported when the instance is destroyed.  Mutable because log_msg sees a const instance.
+    bool duplicate_message_suppression{false};
+    struct DuplicateMessageInfo {
+        uint64_t count = 0;
+        VkDebugReportObjectTypeEXT object_type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT;
+        uint64_t src_object = 0;
+        std::string vuid;
+    };
+    mutable std::mutex duplicate_message_lock;
+    mutable std::unordered_map<uint64_t, DuplicateMessageInfo> duplicate_message_counts;
+    // Per-VUID hit counting for check telemetry: when enabled, log_msg tallies every VUID it
+    // accepts (including ones duplicate suppression later swallows) so the owning layer can rank
+    // fired checks at teardown.  See CoreChecks::DumpCheckTelemetry.
+    bool vuid_hit_counting{false};
+    mutable std::mutex vuid_hit_lock;
+    mutable std::unordered_map<std::string, uint64_t> vuid_hit_counts;
     bool g_DEBUG_REPORT{false};
     bool g_DEBUG_UTILS{false};
     bool queueLabelHasInsert{false};
     bool cmdBufLabelHasInsert{false};
-    std::unordered_map<uint64_t, VkDebugMarkerObjectNameInfoEXT> debugObjectNameMap;
-    std::unordered_map<uint64_t, VkDebugUtilsObjectNameInfoEXT> debugUtilsObjectNameMap;
+    // Object names are set rarely (typically once at resource creation) but read for every object
+    // attached to every message, so they are published as an immutable snapshot.  Readers pick up
+    // the current snapshot with an atomic shared_ptr load and probe it without taking any lock;
+    // updates copy the current snapshot under debug_report_mutex, apply the change, and swap the
+    // pointer.  Names are stored as std::string so the snapshot does not reference caller memory.
+    struct ObjectNameSnapshot {
+        std::unordered_map<uint64_t, std::string> utils_names;
+        std::unordered_map<uint64_t, std::string> marker_names;
+    };
+    std::shared_ptr<const ObjectNameSnapshot> object_names{std::make_shared<ObjectNameSnapshot>()};
     std::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debugUtilsQueueLabels;
     std::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
@@ -157,39 +311,39 @@ typedef struct _debug_report_data {
     mutable std::mutex debug_report_mutex;
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
+        if (!pNameInfo) return;
         std::unique_lock<std::mutex> lock(debug_report_mutex);
-        if (pNameInfo) {
-            debugUtilsObjectNameMap[pNameInfo->objectHandle] = *pNameInfo;
+        auto next = std::make_shared<ObjectNameSnapshot>(*std::atomic_load(&object_names));
+        if (pNameInfo->pObjectName) {
+            next->utils_names[pNameInfo->objectHandle] = pNameInfo->pObjectName;
         } else {
-            debugUtilsObjectNameMap.erase(pNameInfo->objectHandle);
+            next->utils_names.erase(pNameInfo->objectHandle);
         }
+        std::atomic_store(&object_names, std::shared_ptr<const ObjectNameSnapshot>(std::move(next)));
     }
 
     void DebugReportSetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
+        if (!pNameInfo) return;
         std::unique_lock<std::mutex> lock(debug_report_mutex);
-        if (pNameInfo) {
-            debugObjectNameMap[pNameInfo->object] = *pNameInfo;
+        auto next = std::make_shared<ObjectNameSnapshot>(*std::atomic_load(&object_names));
+        if (pNameInfo->pObjectName) {
+            next->marker_names[pNameInfo->object] = pNameInfo->pObjectName;
         } else {
-            debugObjectNameMap.erase(pNameInfo->object);
+            next->marker_names.erase(pNameInfo->object);
         }
+        std::atomic_store(&object_names, std::shared_ptr<const ObjectNameSnapshot>(std::move(next)));
     }
 
     std::string DebugReportGetUtilsObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto utils_name_iter = debugUtilsObjectNameMap.find(object);
-        if (utils_name_iter != debugUtilsObjectNameMap.end()) {
-            label = utils_name_iter->second.pObjectName;
-        }
-        return label;
+        const auto snapshot = std::atomic_load(&object_names);
+        const auto utils_name_iter = snapshot->utils_names.find(object);
+        return (utils_name_iter != snapshot->utils_names.end()) ? utils_name_iter->second : std::string();
     }
 
     std::string DebugReportGetMarkerObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto marker_name_iter = debugObjectNameMap.find(object);
-        if (marker_name_iter != debugObjectNameMap.end()) {
-            label = marker_name_iter->second.pObjectName;
-        }
-        return label;
+        const auto snapshot = std::atomic_load(&object_names);
+        const auto marker_name_iter = snapshot->marker_names.find(object);
+        return (marker_name_iter != snapshot->marker_names.end()) ? marker_name_iter->second : std::string();
     }
 
     std::string FormatHandle(const char *handle_type_name, uint64_t handle) const {
@@ -388,6 +542,32 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, VkLa
     *list_head = NULL;
 }
 
+// Format into the provided stack buffer when the result fits, falling back to a heap allocation
+// owned by heap_buffer for oversized messages.  Returns the formatted string, or null on failure.
+static inline const char *vformat_stack_or_heap(char *stack_buffer, size_t stack_size, std::unique_ptr<char[]> &heap_buffer,
+                                                const char *format, va_list argptr) {
+    va_list argcopy;
+    va_copy(argcopy, argptr);
+    int len = vsnprintf(stack_buffer, stack_size, format, argptr);
+    if ((len >= 0) && (static_cast<size_t>(len) >= stack_size)) {
+        heap_buffer.reset(new char[len + 1]);
+        vsnprintf(heap_buffer.get(), len + 1, format, argcopy);
+        va_end(argcopy);
+        return heap_buffer.get();
+    }
+    va_end(argcopy);
+    return (len < 0) ? nullptr : stack_buffer;
+}
+
+static inline const char *format_stack_or_heap(char *stack_buffer, size_t stack_size, std::unique_ptr<char[]> &heap_buffer,
+                                               const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    const char *result = vformat_stack_or_heap(stack_buffer, stack_size, heap_buffer, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
                                  uint64_t src_object, size_t location, const char *layer_prefix, const char *message,
                                  const char *text_vuid) {
@@ -429,11 +609,8 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
 
     std::vector<VkDebugUtilsLabelEXT> queue_labels;
     std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
-    std::string new_debug_report_message = "";
-    std::ostringstream oss;
 
     if (0 != src_object) {
-        oss << "Object: 0x" << std::hex << src_object;
         // If this is a queue, add any queue labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
             auto label_iter = debug_data->debugUtilsQueueLabels.find(reinterpret_cast<VkQueue>(src_object));
@@ -459,30 +636,44 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
         }
         if (!object_label.empty()) {
             object_name_info.pObjectName = object_label.c_str();
-            oss << " (Name = " << object_label << " : Type = ";
-        } else {
-            oss << " (Type = ";
         }
-        oss << std::to_string(object_type) << ")";
-    } else {
-        oss << "Object: VK_NULL_HANDLE (Type = " << std::to_string(object_type) << ")";
     }
-    new_debug_report_message += oss.str();
-    new_debug_report_message += " | ";
-    new_debug_report_message += message;
+
+    // The debug report form of the message carries the object/name info (and VUID, if any) inline.
+    // It is composed on first use so messenger-only configurations never pay for it.
+    char report_stack[1024];
+    std::unique_ptr<char[]> report_heap;
+    const char *new_debug_report_message = nullptr;
 
     while (layer_dbg_node) {
         // If the app uses the VK_EXT_debug_report extension, call all of those registered callbacks.
         if (!layer_dbg_node->is_messenger && (layer_dbg_node->report.msgFlags & msg_flags)) {
-            if (text_vuid != nullptr) {
+            if (nullptr == new_debug_report_message) {
                 // If a text vuid is supplied for the old debug report extension, prepend it to the message string
-                new_debug_report_message.insert(0, " ] ");
-                new_debug_report_message.insert(0, text_vuid);
-                new_debug_report_message.insert(0, " [ ");
+                const char *vuid_open = (text_vuid != nullptr) ? " [ " : "";
+                const char *vuid = (text_vuid != nullptr) ? text_vuid : "";
+                const char *vuid_close = (text_vuid != nullptr) ? " ] " : "";
+                if (0 == src_object) {
+                    new_debug_report_message =
+                        format_stack_or_heap(report_stack, sizeof(report_stack), report_heap,
+                                             "%s%s%sObject: VK_NULL_HANDLE (Type = %d) | %s", vuid_open, vuid, vuid_close,
+                                             static_cast<int>(object_type), message);
+                } else if (!object_label.empty()) {
+                    new_debug_report_message =
+                        format_stack_or_heap(report_stack, sizeof(report_stack), report_heap,
+                                             "%s%s%sObject: 0x%" PRIx64 " (Name = %s : Type = %d) | %s", vuid_open, vuid,
+                                             vuid_close, src_object, object_label.c_str(), static_cast<int>(object_type), message);
+                } else {
+                    new_debug_report_message =
+                        format_stack_or_heap(report_stack, sizeof(report_stack), report_heap,
+                                             "%s%s%sObject: 0x%" PRIx64 " (Type = %d) | %s", vuid_open, vuid, vuid_close,
+                                             src_object, static_cast<int>(object_type), message);
+                }
+                if (nullptr == new_debug_report_message) new_debug_report_message = message;
             }
 
             if (layer_dbg_node->report.pfnMsgCallback(msg_flags, object_type, src_object, location, 0, layer_prefix,
-                                                      new_debug_report_message.c_str(), layer_dbg_node->pUserData)) {
+                                                      new_debug_report_message, layer_dbg_node->pUserData)) {
                 bail = true;
             }
             // If the app uses the VK_EXT_debug_utils extension, call all of those registered callbacks.
@@ -499,6 +690,26 @@ static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags ms
     return bail;
 }
 
+inline void AsyncLogRelay::DrainAll() {
+    while (AsyncLogRecord *raw = queue_.TryDequeue()) {
+        std::unique_ptr<AsyncLogRecord> record(raw);
+        std::unique_lock<std::mutex> lock(debug_data_->debug_report_mutex);
+        debug_log_msg(debug_data_, record->msg_flags, record->object_type, record->src_object, 0, "Validation",
+                      record->message.c_str(), record->vuid_text.c_str());
+    }
+}
+
+inline void AsyncLogRelay::Run() {
+    while (!exiting_.load(std::memory_order_acquire)) {
+        DrainAll();
+        // Timed wait rather than a wakeup handshake keeps producers completely lock-free; the short
+        // period bounds delivery latency and costs next to nothing while idle
+        std::unique_lock<std::mutex> lock(wake_lock_);
+        wake_.wait_for(lock, std::chrono::milliseconds(1));
+    }
+    DrainAll();  // flush anything enqueued before the exit flag was raised
+}
+
 static inline void DebugAnnotFlagsToReportFlags(VkDebugUtilsMessageSeverityFlagBitsEXT da_severity,
                                                 VkDebugUtilsMessageTypeFlagsEXT da_type, VkDebugReportFlagsEXT *dr_flags) {
     *dr_flags = 0;
@@ -597,9 +808,32 @@ static inline debug_report_data *debug_utils_create_instance(
     return debug_data;
 }
 
+// Report the totals accumulated by duplicate message suppression; caller holds debug_report_mutex
+static inline void ReportDuplicateMessageCounts(debug_report_data *debug_data) {
+    std::lock_guard<std::mutex> lock(debug_data->duplicate_message_lock);
+    for (const auto &entry : debug_data->duplicate_message_counts) {
+        const auto &info = entry.second;
+        if (info.count > 1) {
+            char buffer[256];
+            snprintf(buffer, sizeof(buffer), "%" PRIu64 " duplicate messages for this VUID and object were suppressed",
+                     info.count - 1);
+            debug_log_msg(debug_data, VK_DEBUG_REPORT_INFORMATION_BIT_EXT, info.object_type, info.src_object, 0, "Validation",
+                          buffer, info.vuid.c_str());
+        }
+    }
+}
+
 static inline void layer_debug_utils_destroy_instance(debug_report_data *debug_data) {
     if (debug_data) {
+        if (debug_data->async_relay) {
+            // Flush and stop the drain thread while the callbacks it delivers to are still registered
+            delete debug_data->async_relay;
+            debug_data->async_relay = nullptr;
+        }
         std::unique_lock<std::mutex> lock(debug_data->debug_report_mutex);
+        if (debug_data->duplicate_message_suppression) {
+            ReportDuplicateMessageCounts(debug_data);
+        }
         RemoveAllMessageCallbacks(debug_data, &debug_data->default_debug_callback_list);
         RemoveAllMessageCallbacks(debug_data, &debug_data->debug_callback_list);
         lock.unlock();
@@ -909,7 +1143,7 @@ static inline void layer_disable_tmp_debug_messengers(debug_report_data *debug_d
 // Checks if the message will get logged.
 // Allows layer to defer collecting & formating data if the
 // message will be discarded.
-static inline bool will_log_msg(debug_report_data *debug_data, VkFlags msg_flags) {
+static inline bool will_log_msg(const debug_report_data *debug_data, VkFlags msg_flags) {
     VkFlags local_severity = 0;
     VkFlags local_type = 0;
     DebugReportFlagsToAnnotFlags(msg_flags, true, &local_severity, &local_type);
@@ -920,6 +1154,32 @@ static inline bool will_log_msg(debug_report_data *debug_data, VkFlags msg_flags
 
     return true;
 }
+
+// Returns true when the message is a known duplicate that should be suppressed.  This sits in
+// front of all formatting work in log_msg, so it only hashes the VUID and touches one table entry.
+static inline bool SuppressDuplicateMessage(const debug_report_data *debug_data, VkDebugReportObjectTypeEXT object_type,
+                                            uint64_t src_object, const char *vuid) {
+    // FNV-1a over the VUID string, mixed with the object handle
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char *p = vuid; *p; ++p) {
+        hash = (hash ^ (uint64_t)(unsigned char)*p) * 1099511628211ULL;
+    }
+    hash ^= src_object + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+
+    // Let an occasional repeat through so persistent issues remain visible in the stream
+    constexpr uint64_t kReminderInterval = 10000;
+
+    std::lock_guard<std::mutex> lock(debug_data->duplicate_message_lock);
+    auto &entry = debug_data->duplicate_message_counts[hash];
+    entry.count++;
+    if (entry.count == 1) {
+        entry.object_type = object_type;
+        entry.src_object = src_object;
+        entry.vuid = vuid;
+        return false;
+    }
+    return (entry.count % kReminderInterval) != 0;
+}
 #ifndef WIN32
 static inline int string_sprintf(std::string *output, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 #endif
@@ -939,62 +1199,54 @@ static inline int string_sprintf(std::string *output, const char *fmt, ...) {
     return result;
 }
 
-#ifdef WIN32
-static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
-    *strp = nullptr;
-    int size = _vscprintf(fmt, ap);
-    if (size >= 0) {
-        *strp = (char *)malloc(size + 1);
-        if (!*strp) {
-            return -1;
-        }
-        _vsnprintf(*strp, size + 1, fmt, ap);
-    }
-    return size;
-}
-#endif
-
 // Output log message via DEBUG_REPORT. Takes format and variable arg list so that output string is only computed if a message
 // needs to be logged
 #ifndef WIN32
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, const std::string &vuid_text, const char *format, ...)
+                           uint64_t src_object, vuid_text_view vuid_text, const char *format, ...)
     __attribute__((format(printf, 6, 7)));
 #endif
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, const std::string &vuid_text, const char *format, ...) {
-    if (!debug_data) return false;
-    std::unique_lock<std::mutex> lock(debug_data->debug_report_mutex);
-    VkFlags local_severity = 0;
-    VkFlags local_type = 0;
-    DebugReportFlagsToAnnotFlags(msg_flags, true, &local_severity, &local_type);
-    if (!debug_data || !(debug_data->active_severities & local_severity) || !(debug_data->active_types & local_type)) {
-        // Message is not wanted
+                           uint64_t src_object, vuid_text_view vuid_text, const char *format, ...) {
+    // Reject unwanted messages using the precomputed masks before taking the lock or formatting anything
+    if (!will_log_msg(debug_data, msg_flags)) {
+        return false;
+    }
+
+    if (debug_data->vuid_hit_counting && vuid_text.c_str() && vuid_text.c_str()[0]) {
+        std::lock_guard<std::mutex> lock(debug_data->vuid_hit_lock);
+        ++debug_data->vuid_hit_counts[vuid_text.c_str()];
+    }
+
+    if (debug_data->duplicate_message_suppression &&
+        SuppressDuplicateMessage(debug_data, object_type, src_object, vuid_text.c_str())) {
         return false;
     }
 
+    // Format the message body into a stack buffer; only oversized messages touch the heap
+    char msg_stack[1024];
+    std::unique_ptr<char[]> msg_heap;
     va_list argptr;
     va_start(argptr, format);
-    char *str;
-    if (-1 == vasprintf(&str, format, argptr)) {
-        // On failure, glibc vasprintf leaves str undefined
-        str = nullptr;
-    }
+    const char *str = vformat_stack_or_heap(msg_stack, sizeof(msg_stack), msg_heap, format, argptr);
     va_end(argptr);
-
-    std::string str_plus_spec_text(str ? str : "Allocation failure");
+    if (nullptr == str) {
+        str = "Allocation failure";
+    }
+    const char *str_plus_spec_text = str;
+    char composite_stack[2048];
+    std::unique_ptr<char[]> composite_heap;
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
-    if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table
-        // This is not fast, but it does not need to be at this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+    if ((nullptr == strstr(vuid_text.c_str(), "UNASSIGNED-")) && (nullptr == strstr(vuid_text.c_str(), kVUIDUndefined))) {
+        // The spec text table is generated sorted by VUID string, so the lookup can binary search it
+        const uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
         const char *spec_text = nullptr;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strcmp(vuid_text.c_str(), vuid_spec_text[i].vuid)) {
-                spec_text = vuid_spec_text[i].spec_text;
-                break;
-            }
+        auto lookup = std::lower_bound(
+            vuid_spec_text, vuid_spec_text + num_vuids, vuid_text.c_str(),
+            [](const vuid_spec_text_pair &entry, const char *value) { return strcmp(entry.vuid, value) < 0; });
+        if ((lookup != vuid_spec_text + num_vuids) && (0 == strcmp(lookup->vuid, vuid_text.c_str()))) {
+            spec_text = lookup->spec_text;
         }
 
         if (nullptr == spec_text) {
@@ -1002,17 +1254,27 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flag
             // Try running 'vk_validation_stats -c' to look for invalid VUID strings in the repo code
             assert(0);
         } else {
-            str_plus_spec_text += " The Vulkan spec states: ";
-            str_plus_spec_text += spec_text;
+            str_plus_spec_text = format_stack_or_heap(composite_stack, sizeof(composite_stack), composite_heap,
+                                                      "%s The Vulkan spec states: %s", str, spec_text);
+            if (nullptr == str_plus_spec_text) {
+                str_plus_spec_text = str;
+            }
         }
     }
 
-    // Append layer prefix with VUID string, pass in recovered legacy numerical VUID
-    bool result = debug_log_msg(debug_data, msg_flags, object_type, src_object, 0, "Validation", str_plus_spec_text.c_str(),
-                                vuid_text.c_str());
+    if (debug_data->async_relay) {
+        AsyncLogRecord *record = new AsyncLogRecord{msg_flags, object_type, src_object, vuid_text.c_str(), str_plus_spec_text};
+        if (debug_data->async_relay->Enqueue(record)) {
+            return false;
+        }
+        // Ring full: fall through and deliver synchronously rather than drop the message
+        delete record;
+    }
 
-    free(str);
-    return result;
+    std::unique_lock<std::mutex> lock(debug_data->debug_report_mutex);
+    // Append layer prefix with VUID string, pass in recovered legacy numerical VUID
+    return debug_log_msg(debug_data, msg_flags, object_type, src_object, 0, "Validation", str_plus_spec_text,
+                         vuid_text.c_str());
 }
 
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
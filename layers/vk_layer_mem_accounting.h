@@ -0,0 +1,133 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_MEM_ACCOUNTING_H
+#define VK_LAYER_MEM_ACCOUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Per-subsystem accounting of the layer's own memory, for attributing process RSS growth on long
+// runs to the state that holds it.  Counting is always on -- one relaxed atomic add per tracked
+// allocation -- and the report at vkDestroyDevice is only emitted when the
+// VK_LAYER_MEMORY_ACCOUNTING environment variable is set (see CoreChecks::DumpMemoryAccounting).
+enum VlMemSubsystem {
+    kVlMemCommandBufferState = 0,  // CMD_BUFFER_STATE objects
+    kVlMemDescriptorSets,          // DescriptorSet objects and their descriptor backing stores
+    kVlMemSafeStructs,             // retained create-info deep copies: arena blocks and the state objects holding them
+    kVlMemGpuValidation,           // GPU-assisted validation buffer blocks
+    kVlMemSubsystemCount,
+};
+
+struct VlMemSubsystemStats {
+    std::atomic<int64_t> bytes{0};
+    std::atomic<int64_t> allocations{0};
+};
+
+inline VlMemSubsystemStats *VlMemStats() {
+    static VlMemSubsystemStats stats[kVlMemSubsystemCount];
+    return stats;
+}
+
+inline const char *VlMemSubsystemName(uint32_t subsystem) {
+    switch (subsystem) {
+        case kVlMemCommandBufferState:
+            return "command buffer state";
+        case kVlMemDescriptorSets:
+            return "descriptor sets";
+        case kVlMemSafeStructs:
+            return "safe-struct retention";
+        case kVlMemGpuValidation:
+            return "gpu validation blocks";
+        default:
+            return "unknown";
+    }
+}
+
+inline void VlMemAccount(VlMemSubsystem subsystem, int64_t bytes) {
+    auto &stats = VlMemStats()[subsystem];
+    stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stats.allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void VlMemRelease(VlMemSubsystem subsystem, int64_t bytes) {
+    auto &stats = VlMemStats()[subsystem];
+    stats.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+    stats.allocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline bool VlMemAccountingDumpEnabled() {
+    static const bool enabled = []() {
+        const char *env = std::getenv("VK_LAYER_MEMORY_ACCOUNTING");
+        return env && env[0] && env[0] != '0';
+    }();
+    return enabled;
+}
+
+// Route a class's heap allocations to a subsystem counter.  Place in the class body; the size
+// passed to operator new is the most-derived size, so the macro also covers subclasses allocated
+// with plain new.  Objects created through std::make_shared bypass class operator new and are not
+// counted, so tracked types should be constructed with new at their creation sites.
+#define VL_MEM_ACCOUNT_CLASS(subsystem)                          \
+    static void *operator new(std::size_t size) {                \
+        VlMemAccount(subsystem, static_cast<int64_t>(size));     \
+        return ::operator new(size);                             \
+    }                                                            \
+    static void operator delete(void *ptr, std::size_t size) {   \
+        VlMemRelease(subsystem, static_cast<int64_t>(size));     \
+        ::operator delete(ptr);                                  \
+    }
+
+// STL-compatible allocator charging a subsystem counter, for threading accounting through an
+// individual container when the per-class hook is too coarse
+template <typename T, VlMemSubsystem Subsystem>
+class vl_counting_allocator {
+   public:
+    typedef T value_type;
+
+    vl_counting_allocator() = default;
+    template <typename U>
+    vl_counting_allocator(const vl_counting_allocator<U, Subsystem> &) {}
+
+    template <typename U>
+    struct rebind {
+        typedef vl_counting_allocator<U, Subsystem> other;
+    };
+
+    T *allocate(std::size_t n) {
+        VlMemAccount(Subsystem, static_cast<int64_t>(n * sizeof(T)));
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T *p, std::size_t n) {
+        VlMemRelease(Subsystem, static_cast<int64_t>(n * sizeof(T)));
+        ::operator delete(p);
+    }
+};
+
+template <typename T, typename U, VlMemSubsystem Subsystem>
+bool operator==(const vl_counting_allocator<T, Subsystem> &, const vl_counting_allocator<U, Subsystem> &) {
+    return true;
+}
+template <typename T, typename U, VlMemSubsystem Subsystem>
+bool operator!=(const vl_counting_allocator<T, Subsystem> &, const vl_counting_allocator<U, Subsystem> &) {
+    return false;
+}
+
+#endif  // VK_LAYER_MEM_ACCOUNTING_H
@@ -105,6 +105,28 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
     VkLayerDbgActionFlags debug_action = GetLayerOptionFlags(debug_action_key, debug_actions_option_definitions, 0);
     // Flag as default if these settings are not from a vk_layer_settings.txt file
     bool default_layer_callback = (debug_action & VK_DBG_LAYER_ACTION_DEFAULT) ? true : false;
+
+    // Optional asynchronous delivery: messages are queued to a drain thread instead of running the
+    // callbacks on the validating thread (see AsyncLogRelay).  Callback bail requests are not
+    // observable in this mode.
+    std::string log_async_key = layer_identifier;
+    log_async_key.append(".log_async");
+    const char *log_async = getLayerOption(log_async_key.c_str());
+    if (log_async && ((0 == strcmp(log_async, "TRUE")) || (0 == strcmp(log_async, "true")) || (0 == strcmp(log_async, "1")))) {
+        if (nullptr == report_data->async_relay) {
+            report_data->async_relay = new AsyncLogRelay(report_data);
+        }
+    }
+
+    // Optional duplicate suppression: repeats of the same VUID on the same object are counted
+    // rather than formatted and delivered, with totals reported at instance destroy
+    std::string dedup_key = layer_identifier;
+    dedup_key.append(".duplicate_message_suppression");
+    const char *dedup = getLayerOption(dedup_key.c_str());
+    if (dedup && ((0 == strcmp(dedup, "TRUE")) || (0 == strcmp(dedup, "true")) || (0 == strcmp(dedup, "1")))) {
+        report_data->duplicate_message_suppression = true;
+    }
+
     VkDebugUtilsMessengerCreateInfoEXT dbgCreateInfo;
     memset(&dbgCreateInfo, 0, sizeof(dbgCreateInfo));
     dbgCreateInfo.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CREATE_INFO_EXT;
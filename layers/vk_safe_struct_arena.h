@@ -0,0 +1,245 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_SAFE_STRUCT_ARENA_H
+#define VK_SAFE_STRUCT_ARENA_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "vk_layer_mem_accounting.h"
+
+// Bump allocator backing vk_safe_struct deep copies.  Deep-copying a create-info chain performs
+// many small allocations (one per pointed-to member); when a safe_struct_arena_scope is active on
+// the calling thread those allocations are carved out of large contiguous blocks owned by the
+// arena instead of hitting the heap individually, and the whole chain is released in one shot when
+// the arena is destroyed.  Every allocation carries a small header recording whether it came from
+// an arena, so a safe struct built under a scope can still be destroyed safely after the scope has
+// ended (its member frees become no-ops and the arena reclaims the memory).
+class safe_struct_arena {
+  public:
+    explicit safe_struct_arena(size_t block_size = 64 * 1024, VlMemSubsystem subsystem = kVlMemSafeStructs)
+        : head_(nullptr), block_size_(block_size), subsystem_(subsystem) {}
+    ~safe_struct_arena() { Reset(); }
+
+    safe_struct_arena(const safe_struct_arena &) = delete;
+    safe_struct_arena &operator=(const safe_struct_arena &) = delete;
+
+    void *Alloc(size_t size) {
+        // Keep every allocation maximally aligned, like operator new
+        const size_t align = alignof(std::max_align_t);
+        size = (size + align - 1) & ~(align - 1);
+        if (!head_ || (head_->used + size > head_->capacity)) {
+            size_t capacity = (size > block_size_) ? size : block_size_;
+            VlMemAccount(subsystem_, static_cast<int64_t>(sizeof(Block) + capacity));
+            Block *block = static_cast<Block *>(::operator new(sizeof(Block) + capacity));
+            block->next = head_;
+            block->used = 0;
+            block->capacity = capacity;
+            head_ = block;
+        }
+        void *ret = head_->data + head_->used;
+        head_->used += size;
+        return ret;
+    }
+
+    // Release all blocks at once.  Objects allocated from the arena must already be destructed (or
+    // be trivially destructible) -- the arena does not run destructors.
+    void Reset() {
+        while (head_) {
+            Block *next = head_->next;
+            VlMemRelease(subsystem_, static_cast<int64_t>(sizeof(Block) + head_->capacity));
+            ::operator delete(head_);
+            head_ = next;
+        }
+    }
+
+    // Mark all blocks empty for reuse without returning them to the heap.  Same destructor caveat
+    // as Reset().
+    void Rewind() {
+        for (Block *block = head_; block; block = block->next) {
+            block->used = 0;
+        }
+    }
+
+  private:
+    struct alignas(std::max_align_t) Block {
+        Block *next;
+        size_t used;
+        size_t capacity;
+        alignas(std::max_align_t) char data[1];
+    };
+    Block *head_;
+    size_t block_size_;
+    VlMemSubsystem subsystem_;
+};
+
+// RAII scope routing this thread's safe-struct allocations into the given arena.  Scopes nest; the
+// previous arena (if any) is restored on destruction.
+class safe_struct_arena_scope {
+  public:
+    explicit safe_struct_arena_scope(safe_struct_arena *arena) : previous_(CurrentSlot()) { CurrentSlot() = arena; }
+    ~safe_struct_arena_scope() { CurrentSlot() = previous_; }
+
+    safe_struct_arena_scope(const safe_struct_arena_scope &) = delete;
+    safe_struct_arena_scope &operator=(const safe_struct_arena_scope &) = delete;
+
+    static safe_struct_arena *Current() { return CurrentSlot(); }
+
+  private:
+    static safe_struct_arena *&CurrentSlot() {
+        static thread_local safe_struct_arena *current_arena = nullptr;
+        return current_arena;
+    }
+    safe_struct_arena *previous_;
+};
+
+// Scope for transient safe-struct copies that never outlive the current API call, such as the
+// handle-wrapping layer's local deep copies.  Allocations are routed into a per-thread arena whose
+// blocks are retained between calls and simply rewound when the outermost scope ends, so at steady
+// state these captures perform no heap allocation at all.
+class safe_struct_transient_arena_scope {
+  public:
+    safe_struct_transient_arena_scope()
+        : outermost_(safe_struct_arena_scope::Current() != ThreadArena()), scope_(ThreadArena()) {}
+    ~safe_struct_transient_arena_scope() {
+        if (outermost_) ThreadArena()->Rewind();
+    }
+
+    safe_struct_transient_arena_scope(const safe_struct_transient_arena_scope &) = delete;
+    safe_struct_transient_arena_scope &operator=(const safe_struct_transient_arena_scope &) = delete;
+
+  private:
+    static safe_struct_arena *ThreadArena() {
+        static thread_local safe_struct_arena arena;
+        return &arena;
+    }
+    bool outermost_;
+    safe_struct_arena_scope scope_;
+};
+
+// Fixed-capacity stack storage with heap fallback for the temporary arrays the handle-wrapping
+// layer builds to pass unwrapped handles (or shallow safe-struct copies) down the chain.  The
+// counts seen in steady-state recording -- a handful of descriptor sets per bind, a dozen or so
+// barriers per transition, a few submit batches -- fit in the inline buffer, so those calls never
+// touch the heap just to translate handles; larger counts fall back to a single heap block.
+template <typename T, size_t N = 16>
+class vl_transient_array {
+  public:
+    vl_transient_array() : ptr_(nullptr), count_(0) {}
+    ~vl_transient_array() {
+        if (!ptr_) return;
+        for (size_t i = count_; i > 0; --i) {
+            ptr_[i - 1].~T();
+        }
+        if (ptr_ != reinterpret_cast<T *>(stack_storage_)) ::operator delete(ptr_);
+    }
+
+    vl_transient_array(const vl_transient_array &) = delete;
+    vl_transient_array &operator=(const vl_transient_array &) = delete;
+
+    // Allocate and default-construct count elements; called at most once per instance
+    T *alloc(size_t count) {
+        assert(!ptr_);
+        ptr_ = (count <= N) ? reinterpret_cast<T *>(stack_storage_) : static_cast<T *>(::operator new(count * sizeof(T)));
+        count_ = count;
+        for (size_t i = 0; i < count; ++i) {
+            new (ptr_ + i) T;
+        }
+        return ptr_;
+    }
+
+  private:
+    alignas(T) char stack_storage_[N * sizeof(T)];
+    T *ptr_;
+    size_t count_;
+};
+
+// Allocation helpers used by the generated safe-struct code in place of new/delete.  Each
+// allocation is prefixed with a header recording the element count and whether the memory came
+// from an arena, so the matching free knows how many destructors to run and whether to return the
+// memory to the heap.
+namespace vl_safe_struct_internal {
+
+struct alignas(std::max_align_t) AllocHeader {
+    size_t count;
+    size_t from_arena;
+};
+
+inline void *AllocBytes(size_t bytes, size_t count) {
+    safe_struct_arena *arena = safe_struct_arena_scope::Current();
+    AllocHeader *header;
+    if (arena) {
+        header = static_cast<AllocHeader *>(arena->Alloc(sizeof(AllocHeader) + bytes));
+    } else {
+        header = static_cast<AllocHeader *>(::operator new(sizeof(AllocHeader) + bytes));
+    }
+    header->count = count;
+    header->from_arena = arena ? 1 : 0;
+    return header + 1;
+}
+
+inline AllocHeader *HeaderOf(const void *ptr) {
+    return const_cast<AllocHeader *>(static_cast<const AllocHeader *>(ptr) - 1);
+}
+
+}  // namespace vl_safe_struct_internal
+
+template <typename T, typename... Args>
+T *vl_safe_new(Args &&... args) {
+    void *mem = vl_safe_struct_internal::AllocBytes(sizeof(T), 1);
+    return new (mem) T(std::forward<Args>(args)...);
+}
+
+template <typename T>
+T *vl_safe_new_array(size_t count) {
+    T *array = static_cast<T *>(vl_safe_struct_internal::AllocBytes(count * sizeof(T), count));
+    if (!std::is_trivially_default_constructible<T>::value) {
+        for (size_t i = 0; i < count; ++i) {
+            new (array + i) T;
+        }
+    }
+    return array;
+}
+
+template <typename T>
+void vl_safe_delete(const T *ptr) {
+    if (!ptr) return;
+    T *obj = const_cast<T *>(ptr);
+    obj->~T();
+    vl_safe_struct_internal::AllocHeader *header = vl_safe_struct_internal::HeaderOf(obj);
+    if (!header->from_arena) ::operator delete(header);
+}
+
+template <typename T>
+void vl_safe_delete_array(const T *ptr) {
+    if (!ptr) return;
+    T *array = const_cast<T *>(ptr);
+    vl_safe_struct_internal::AllocHeader *header = vl_safe_struct_internal::HeaderOf(array);
+    if (!std::is_trivially_destructible<T>::value) {
+        for (size_t i = header->count; i > 0; --i) {
+            array[i - 1].~T();
+        }
+    }
+    if (!header->from_arena) ::operator delete(header);
+}
+
+#endif  // VK_SAFE_STRUCT_ARENA_H
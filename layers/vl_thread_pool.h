@@ -0,0 +1,196 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VL_THREAD_POOL_H
+#define VL_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A small shared worker pool for validation work that is independent across elements, such as the
+// per-command-buffer checks of a queue submission.  Work is handed out as an atomically sliced
+// index range and the calling thread participates, so ParallelFor never blocks on an idle pool
+// and degrades to a plain loop when the pool is empty, the range is trivial, or another thread is
+// already dispatching.  Workers must only read state that the caller guarantees stable for the
+// duration of the call (e.g. by holding the validation object's read lock across ParallelFor).
+class VlThreadPool {
+   public:
+    static VlThreadPool &Instance() {
+        static VlThreadPool pool;
+        return pool;
+    }
+
+    // Invoke func(index) for every index in [0, count), distributed across the workers and the
+    // calling thread.  Returns after all invocations have completed.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func) {
+        if (0 == count) return;
+        if (workers_.empty() || count < 2 || !dispatch_lock_.try_lock()) {
+            for (uint32_t i = 0; i < count; ++i) func(i);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(state_lock_);
+            func_ = &func;
+            range_base_ = next_index_.load();
+            range_end_ = range_base_ + count;
+            completed_.store(0);
+            generation_++;
+        }
+        wake_.notify_all();
+        RunSlice(func);
+        while (completed_.load() != count) std::this_thread::yield();
+        // Make sure no worker is still inside the slice loop before the range can be reused
+        while (active_workers_.load() != 0) std::this_thread::yield();
+        {
+            std::lock_guard<std::mutex> lock(state_lock_);
+            func_ = nullptr;
+        }
+        dispatch_lock_.unlock();
+    }
+
+   private:
+    VlThreadPool() {
+        auto hw_threads = std::thread::hardware_concurrency();
+        // Leave a core for the calling thread and don't scale past the point of diminishing
+        // returns for the short ranges validation hands out
+        uint32_t worker_count = (hw_threads > 1) ? std::min(hw_threads - 1, 7u) : 0;
+        workers_.reserve(worker_count);
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+    ~VlThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(state_lock_);
+            shutdown_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_) worker.join();
+    }
+    VlThreadPool(const VlThreadPool &) = delete;
+    VlThreadPool &operator=(const VlThreadPool &) = delete;
+
+    void WorkerLoop() {
+        uint64_t seen_generation = 0;
+        for (;;) {
+            const std::function<void(uint32_t)> *func = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(state_lock_);
+                wake_.wait(lock, [this, seen_generation]() { return shutdown_ || (func_ && generation_ != seen_generation); });
+                if (shutdown_) return;
+                seen_generation = generation_;
+                func = func_;
+                active_workers_++;
+            }
+            RunSlice(*func);
+            active_workers_--;
+        }
+    }
+
+    void RunSlice(const std::function<void(uint32_t)> &func) {
+        for (;;) {
+            const uint64_t index = next_index_.fetch_add(1);
+            if (index >= range_end_) return;
+            func(static_cast<uint32_t>(index - range_base_));
+            completed_.fetch_add(1);
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex dispatch_lock_;  // Held across one ParallelFor; contenders fall back to inline loops
+    std::mutex state_lock_;
+    std::condition_variable wake_;
+    const std::function<void(uint32_t)> *func_ = nullptr;
+    // The claim counter is monotonic (never reset) so a straggling worker from a finished range
+    // can never claim an index from the next one
+    std::atomic<uint64_t> next_index_{0};
+    uint64_t range_base_ = 0;
+    uint64_t range_end_ = 0;
+    std::atomic<uint32_t> completed_{0};
+    std::atomic<uint32_t> active_workers_{0};
+    uint64_t generation_ = 0;
+    bool shutdown_ = false;
+};
+
+// A FIFO queue with dedicated worker threads, for validation work that is deferred past the API
+// call that produced it (e.g. spirv-val offloaded from vkCreateShaderModule).  Jobs must be
+// self-contained closures -- they run after the triggering call has returned, so they may not
+// reference caller-owned memory.  The producer is responsible for joining on job results before
+// they become observable; jobs still queued at shutdown are drained, not dropped.
+class VlWorkQueue {
+   public:
+    static VlWorkQueue &Instance() {
+        static VlWorkQueue queue;
+        return queue;
+    }
+
+    void Enqueue(std::function<void()> job) {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            jobs_.emplace_back(std::move(job));
+        }
+        wake_.notify_one();
+    }
+
+   private:
+    VlWorkQueue() {
+        auto hw_threads = std::thread::hardware_concurrency();
+        uint32_t worker_count = (hw_threads > 1) ? std::min(hw_threads - 1, 3u) : 1;
+        workers_.reserve(worker_count);
+        for (uint32_t i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+    ~VlWorkQueue() {
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            shutdown_ = true;
+        }
+        wake_.notify_all();
+        for (auto &worker : workers_) worker.join();
+    }
+    VlWorkQueue(const VlWorkQueue &) = delete;
+    VlWorkQueue &operator=(const VlWorkQueue &) = delete;
+
+    void WorkerLoop() {
+        for (;;) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(lock_);
+                wake_.wait(lock, [this]() { return shutdown_ || !jobs_.empty(); });
+                if (jobs_.empty()) return;  // shutdown, queue drained
+                job = std::move(jobs_.front());
+                jobs_.pop_front();
+            }
+            job();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> jobs_;
+    std::mutex lock_;
+    std::condition_variable wake_;
+    bool shutdown_ = false;
+};
+
+#endif  // VL_THREAD_POOL_H
@@ -382,20 +382,18 @@ class HelperFileOutputGenerator(OutputGenerator):
         if (bitsIndex != -1):
             outstring += '\n'
             flagsName = groupName[0:bitsIndex] + "s" +  groupName[bitsIndex+4:]
+            # Size the stack buffer in the std::string form to hold every defined bit name joined,
+            # plus one "Unhandled" entry for a stray bit; anything past that truncates safely.
+            flag_buffer_len = sum(len(item) + 1 for item in sorted(value_list)) + len('Unhandled %s' % groupName) + 2
+            outstring += 'static inline const char* string_%s(%s input_value, char *buffer, size_t buffer_size)\n' % (flagsName, flagsName)
+            outstring += '{\n'
+            outstring += '    return string_flags_into(input_value, string_%s, buffer, buffer_size);\n' % groupName
+            outstring += '}\n'
+            outstring += '\n'
             outstring += 'static inline std::string string_%s(%s input_value)\n' % (flagsName, flagsName)
             outstring += '{\n'
-            outstring += '    std::string ret;\n'
-            outstring += '    int index = 0;\n'
-            outstring += '    while(input_value) {\n'
-            outstring += '        if (input_value & 1) {\n'
-            outstring += '            if( !ret.empty()) ret.append("|");\n'
-            outstring += '            ret.append(string_%s(static_cast<%s>(1 << index)));\n' % (groupName, groupName)
-            outstring += '        }\n'
-            outstring += '        ++index;\n'
-            outstring += '        input_value >>= 1;\n'
-            outstring += '    }\n'
-            outstring += '    if( ret.empty()) ret.append(string_%s(static_cast<%s>(0)));\n' % (groupName, groupName)
-            outstring += '    return ret;\n'
+            outstring += '    char buffer[%d];\n' % flag_buffer_len
+            outstring += '    return string_%s(input_value, buffer, sizeof(buffer));\n' % flagsName
             outstring += '}\n'
 
         if self.featureExtraProtect is not None:
@@ -430,6 +428,33 @@ class HelperFileOutputGenerator(OutputGenerator):
             enum_string_helper_header += '#include <string>\n'
             enum_string_helper_header += '#include <vulkan/vulkan.h>\n'
             enum_string_helper_header += '\n'
+            enum_string_helper_header += '// Shared writer behind the string_Vk*Flags(value, buffer, buffer_size) helpers below: renders\n'
+            enum_string_helper_header += '// the set bit names \'|\'-separated into the caller\'s buffer and returns it.  Never allocates,\n'
+            enum_string_helper_header += '// so logging paths can render flags without heap traffic; output is always NUL-terminated and\n'
+            enum_string_helper_header += '// truncates if the buffer is too small.\n'
+            enum_string_helper_header += 'template <typename BitsType>\n'
+            enum_string_helper_header += 'static inline const char* string_flags_into(VkFlags input_value, const char* (*string_bits)(BitsType), char *buffer,\n'
+            enum_string_helper_header += '                                            size_t buffer_size)\n'
+            enum_string_helper_header += '{\n'
+            enum_string_helper_header += '    if (buffer_size == 0) return "";\n'
+            enum_string_helper_header += '    size_t used = 0;\n'
+            enum_string_helper_header += '    int index = 0;\n'
+            enum_string_helper_header += '    while(input_value) {\n'
+            enum_string_helper_header += '        if (input_value & 1) {\n'
+            enum_string_helper_header += '            const char* name = string_bits(static_cast<BitsType>(1 << index));\n'
+            enum_string_helper_header += '            if ((used != 0) && (used + 1 < buffer_size)) buffer[used++] = \'|\';\n'
+            enum_string_helper_header += '            while (*name && (used + 1 < buffer_size)) buffer[used++] = *name++;\n'
+            enum_string_helper_header += '        }\n'
+            enum_string_helper_header += '        ++index;\n'
+            enum_string_helper_header += '        input_value >>= 1;\n'
+            enum_string_helper_header += '    }\n'
+            enum_string_helper_header += '    if (used == 0) {\n'
+            enum_string_helper_header += '        const char* name = string_bits(static_cast<BitsType>(0));\n'
+            enum_string_helper_header += '        while (*name && (used + 1 < buffer_size)) buffer[used++] = *name++;\n'
+            enum_string_helper_header += '    }\n'
+            enum_string_helper_header += '    buffer[used] = \'\\0\';\n'
+            enum_string_helper_header += '    return buffer;\n'
+            enum_string_helper_header += '}\n'
             enum_string_helper_header += self.enum_output
             enum_string_helper_header += self.DeIndexPhysDevFeatures()
             return enum_string_helper_header
@@ -475,6 +500,8 @@ class HelperFileOutputGenerator(OutputGenerator):
                 safe_struct_header += '    safe_%s(const %s* in_struct%s);\n' % (item.name, item.name, self.custom_construct_params.get(item.name, ''))
                 safe_struct_header += '    safe_%s(const safe_%s& src);\n' % (item.name, item.name)
                 safe_struct_header += '    safe_%s& operator=(const safe_%s& src);\n' % (item.name, item.name)
+                safe_struct_header += '    safe_%s(safe_%s&& src) noexcept;\n' % (item.name, item.name)
+                safe_struct_header += '    safe_%s& operator=(safe_%s&& src) noexcept;\n' % (item.name, item.name)
                 safe_struct_header += '    safe_%s();\n' % item.name
                 safe_struct_header += '    ~safe_%s();\n' % item.name
                 safe_struct_header += '    void initialize(const %s* in_struct%s);\n' % (item.name, self.custom_construct_params.get(item.name, ''))
@@ -890,7 +917,9 @@ class HelperFileOutputGenerator(OutputGenerator):
     def GenerateSafeStructHelperSource(self):
         safe_struct_helper_source = '\n'
         safe_struct_helper_source += '#include "vk_safe_struct.h"\n'
+        safe_struct_helper_source += '#include "vk_safe_struct_arena.h"\n'
         safe_struct_helper_source += '#include <string.h>\n'
+        safe_struct_helper_source += '#include <new>\n'
         safe_struct_helper_source += '\n'
         safe_struct_helper_source += self.GenerateSafeStructSource()
         return safe_struct_helper_source
@@ -934,10 +963,8 @@ class HelperFileOutputGenerator(OutputGenerator):
                     '        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:\n'
                     '        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:\n'
                     '        if (descriptorCount && in_struct->pImageInfo) {\n'
-                    '            pImageInfo = new VkDescriptorImageInfo[descriptorCount];\n'
-                    '            for (uint32_t i=0; i<descriptorCount; ++i) {\n'
-                    '                pImageInfo[i] = in_struct->pImageInfo[i];\n'
-                    '            }\n'
+                    '            pImageInfo = vl_safe_new_array<VkDescriptorImageInfo>(descriptorCount);\n'
+                    '            memcpy ((void *)pImageInfo, (void *)in_struct->pImageInfo, sizeof(VkDescriptorImageInfo)*descriptorCount);\n'
                     '        }\n'
                     '        break;\n'
                     '        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:\n'
@@ -945,19 +972,15 @@ class HelperFileOutputGenerator(OutputGenerator):
                     '        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:\n'
                     '        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:\n'
                     '        if (descriptorCount && in_struct->pBufferInfo) {\n'
-                    '            pBufferInfo = new VkDescriptorBufferInfo[descriptorCount];\n'
-                    '            for (uint32_t i=0; i<descriptorCount; ++i) {\n'
-                    '                pBufferInfo[i] = in_struct->pBufferInfo[i];\n'
-                    '            }\n'
+                    '            pBufferInfo = vl_safe_new_array<VkDescriptorBufferInfo>(descriptorCount);\n'
+                    '            memcpy ((void *)pBufferInfo, (void *)in_struct->pBufferInfo, sizeof(VkDescriptorBufferInfo)*descriptorCount);\n'
                     '        }\n'
                     '        break;\n'
                     '        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:\n'
                     '        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:\n'
                     '        if (descriptorCount && in_struct->pTexelBufferView) {\n'
-                    '            pTexelBufferView = new VkBufferView[descriptorCount];\n'
-                    '            for (uint32_t i=0; i<descriptorCount; ++i) {\n'
-                    '                pTexelBufferView[i] = in_struct->pTexelBufferView[i];\n'
-                    '            }\n'
+                    '            pTexelBufferView = vl_safe_new_array<VkBufferView>(descriptorCount);\n'
+                    '            memcpy ((void *)pTexelBufferView, (void *)in_struct->pTexelBufferView, sizeof(VkBufferView)*descriptorCount);\n'
                     '        }\n'
                     '        break;\n'
                     '        default:\n'
@@ -965,23 +988,23 @@ class HelperFileOutputGenerator(OutputGenerator):
                     '    }\n',
                 'VkShaderModuleCreateInfo' :
                     '    if (in_struct->pCode) {\n'
-                    '        pCode = reinterpret_cast<uint32_t *>(new uint8_t[codeSize]);\n'
+                    '        pCode = reinterpret_cast<uint32_t *>(vl_safe_new_array<uint8_t>(codeSize));\n'
                     '        memcpy((void *)pCode, (void *)in_struct->pCode, codeSize);\n'
                     '    }\n',
                 # VkGraphicsPipelineCreateInfo is special case because its pointers may be non-null but ignored
                 'VkGraphicsPipelineCreateInfo' :
                     '    if (stageCount && in_struct->pStages) {\n'
-                    '        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];\n'
+                    '        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);\n'
                     '        for (uint32_t i=0; i<stageCount; ++i) {\n'
                     '            pStages[i].initialize(&in_struct->pStages[i]);\n'
                     '        }\n'
                     '    }\n'
                     '    if (in_struct->pVertexInputState)\n'
-                    '        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(in_struct->pVertexInputState);\n'
+                    '        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(in_struct->pVertexInputState);\n'
                     '    else\n'
                     '        pVertexInputState = NULL;\n'
                     '    if (in_struct->pInputAssemblyState)\n'
-                    '        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(in_struct->pInputAssemblyState);\n'
+                    '        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(in_struct->pInputAssemblyState);\n'
                     '    else\n'
                     '        pInputAssemblyState = NULL;\n'
                     '    bool has_tessellation_stage = false;\n'
@@ -990,7 +1013,7 @@ class HelperFileOutputGenerator(OutputGenerator):
                     '            if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)\n'
                     '                has_tessellation_stage = true;\n'
                     '    if (in_struct->pTessellationState && has_tessellation_stage)\n'
-                    '        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(in_struct->pTessellationState);\n'
+                    '        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(in_struct->pTessellationState);\n'
                     '    else\n'
                     '        pTessellationState = NULL; // original pTessellationState pointer ignored\n'
                     '    bool has_rasterization = in_struct->pRasterizationState ? !in_struct->pRasterizationState->rasterizerDiscardEnable : false;\n'
@@ -1005,41 +1028,41 @@ class HelperFileOutputGenerator(OutputGenerator):
                     '                if (in_struct->pDynamicState->pDynamicStates[i] == VK_DYNAMIC_STATE_SCISSOR)\n'
                     '                    is_dynamic_scissors = true;\n'
                     '        }\n'
-                    '        pViewportState = new safe_VkPipelineViewportStateCreateInfo(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);\n'
+                    '        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(in_struct->pViewportState, is_dynamic_viewports, is_dynamic_scissors);\n'
                     '    } else\n'
                     '        pViewportState = NULL; // original pViewportState pointer ignored\n'
                     '    if (in_struct->pRasterizationState)\n'
-                    '        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(in_struct->pRasterizationState);\n'
+                    '        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(in_struct->pRasterizationState);\n'
                     '    else\n'
                     '        pRasterizationState = NULL;\n'
                     '    if (in_struct->pMultisampleState && has_rasterization)\n'
-                    '        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(in_struct->pMultisampleState);\n'
+                    '        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(in_struct->pMultisampleState);\n'
                     '    else\n'
                     '        pMultisampleState = NULL; // original pMultisampleState pointer ignored\n'
                     '    // needs a tracked subpass state uses_depthstencil_attachment\n'
                     '    if (in_struct->pDepthStencilState && has_rasterization && uses_depthstencil_attachment)\n'
-                    '        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(in_struct->pDepthStencilState);\n'
+                    '        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(in_struct->pDepthStencilState);\n'
                     '    else\n'
                     '        pDepthStencilState = NULL; // original pDepthStencilState pointer ignored\n'
                     '    // needs a tracked subpass state usesColorAttachment\n'
                     '    if (in_struct->pColorBlendState && has_rasterization && uses_color_attachment)\n'
-                    '        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(in_struct->pColorBlendState);\n'
+                    '        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(in_struct->pColorBlendState);\n'
                     '    else\n'
                     '        pColorBlendState = NULL; // original pColorBlendState pointer ignored\n'
                     '    if (in_struct->pDynamicState)\n'
-                    '        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(in_struct->pDynamicState);\n'
+                    '        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(in_struct->pDynamicState);\n'
                     '    else\n'
                     '        pDynamicState = NULL;\n',
                  # VkPipelineViewportStateCreateInfo is special case because its pointers may be non-null but ignored
                 'VkPipelineViewportStateCreateInfo' :
                     '    if (in_struct->pViewports && !is_dynamic_viewports) {\n'
-                    '        pViewports = new VkViewport[in_struct->viewportCount];\n'
+                    '        pViewports = vl_safe_new_array<VkViewport>(in_struct->viewportCount);\n'
                     '        memcpy ((void *)pViewports, (void *)in_struct->pViewports, sizeof(VkViewport)*in_struct->viewportCount);\n'
                     '    }\n'
                     '    else\n'
                     '        pViewports = NULL;\n'
                     '    if (in_struct->pScissors && !is_dynamic_scissors) {\n'
-                    '        pScissors = new VkRect2D[in_struct->scissorCount];\n'
+                    '        pScissors = vl_safe_new_array<VkRect2D>(in_struct->scissorCount);\n'
                     '        memcpy ((void *)pScissors, (void *)in_struct->pScissors, sizeof(VkRect2D)*in_struct->scissorCount);\n'
                     '    }\n'
                     '    else\n'
@@ -1048,10 +1071,8 @@ class HelperFileOutputGenerator(OutputGenerator):
                 'VkDescriptorSetLayoutBinding' :
                     '    const bool sampler_type = in_struct->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || in_struct->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;\n'
                     '    if (descriptorCount && in_struct->pImmutableSamplers && sampler_type) {\n'
-                    '        pImmutableSamplers = new VkSampler[descriptorCount];\n'
-                    '        for (uint32_t i=0; i<descriptorCount; ++i) {\n'
-                    '            pImmutableSamplers[i] = in_struct->pImmutableSamplers[i];\n'
-                    '        }\n'
+                    '        pImmutableSamplers = vl_safe_new_array<VkSampler>(descriptorCount);\n'
+                    '        memcpy ((void *)pImmutableSamplers, (void *)in_struct->pImmutableSamplers, sizeof(VkSampler)*descriptorCount);\n'
                     '    }\n',
             }
 
@@ -1059,17 +1080,17 @@ class HelperFileOutputGenerator(OutputGenerator):
                 # VkGraphicsPipelineCreateInfo is special case because it has custom construct parameters
                 'VkGraphicsPipelineCreateInfo' :
                     '    if (stageCount && src.pStages) {\n'
-                    '        pStages = new safe_VkPipelineShaderStageCreateInfo[stageCount];\n'
+                    '        pStages = vl_safe_new_array<safe_VkPipelineShaderStageCreateInfo>(stageCount);\n'
                     '        for (uint32_t i=0; i<stageCount; ++i) {\n'
                     '            pStages[i].initialize(&src.pStages[i]);\n'
                     '        }\n'
                     '    }\n'
                     '    if (src.pVertexInputState)\n'
-                    '        pVertexInputState = new safe_VkPipelineVertexInputStateCreateInfo(*src.pVertexInputState);\n'
+                    '        pVertexInputState = vl_safe_new<safe_VkPipelineVertexInputStateCreateInfo>(*src.pVertexInputState);\n'
                     '    else\n'
                     '        pVertexInputState = NULL;\n'
                     '    if (src.pInputAssemblyState)\n'
-                    '        pInputAssemblyState = new safe_VkPipelineInputAssemblyStateCreateInfo(*src.pInputAssemblyState);\n'
+                    '        pInputAssemblyState = vl_safe_new<safe_VkPipelineInputAssemblyStateCreateInfo>(*src.pInputAssemblyState);\n'
                     '    else\n'
                     '        pInputAssemblyState = NULL;\n'
                     '    bool has_tessellation_stage = false;\n'
@@ -1078,44 +1099,44 @@ class HelperFileOutputGenerator(OutputGenerator):
                     '            if (pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT || pStages[i].stage == VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)\n'
                     '                has_tessellation_stage = true;\n'
                     '    if (src.pTessellationState && has_tessellation_stage)\n'
-                    '        pTessellationState = new safe_VkPipelineTessellationStateCreateInfo(*src.pTessellationState);\n'
+                    '        pTessellationState = vl_safe_new<safe_VkPipelineTessellationStateCreateInfo>(*src.pTessellationState);\n'
                     '    else\n'
                     '        pTessellationState = NULL; // original pTessellationState pointer ignored\n'
                     '    bool has_rasterization = src.pRasterizationState ? !src.pRasterizationState->rasterizerDiscardEnable : false;\n'
                     '    if (src.pViewportState && has_rasterization) {\n'
-                    '        pViewportState = new safe_VkPipelineViewportStateCreateInfo(*src.pViewportState);\n'
+                    '        pViewportState = vl_safe_new<safe_VkPipelineViewportStateCreateInfo>(*src.pViewportState);\n'
                     '    } else\n'
                     '        pViewportState = NULL; // original pViewportState pointer ignored\n'
                     '    if (src.pRasterizationState)\n'
-                    '        pRasterizationState = new safe_VkPipelineRasterizationStateCreateInfo(*src.pRasterizationState);\n'
+                    '        pRasterizationState = vl_safe_new<safe_VkPipelineRasterizationStateCreateInfo>(*src.pRasterizationState);\n'
                     '    else\n'
                     '        pRasterizationState = NULL;\n'
                     '    if (src.pMultisampleState && has_rasterization)\n'
-                    '        pMultisampleState = new safe_VkPipelineMultisampleStateCreateInfo(*src.pMultisampleState);\n'
+                    '        pMultisampleState = vl_safe_new<safe_VkPipelineMultisampleStateCreateInfo>(*src.pMultisampleState);\n'
                     '    else\n'
                     '        pMultisampleState = NULL; // original pMultisampleState pointer ignored\n'
                     '    if (src.pDepthStencilState && has_rasterization)\n'
-                    '        pDepthStencilState = new safe_VkPipelineDepthStencilStateCreateInfo(*src.pDepthStencilState);\n'
+                    '        pDepthStencilState = vl_safe_new<safe_VkPipelineDepthStencilStateCreateInfo>(*src.pDepthStencilState);\n'
                     '    else\n'
                     '        pDepthStencilState = NULL; // original pDepthStencilState pointer ignored\n'
                     '    if (src.pColorBlendState && has_rasterization)\n'
-                    '        pColorBlendState = new safe_VkPipelineColorBlendStateCreateInfo(*src.pColorBlendState);\n'
+                    '        pColorBlendState = vl_safe_new<safe_VkPipelineColorBlendStateCreateInfo>(*src.pColorBlendState);\n'
                     '    else\n'
                     '        pColorBlendState = NULL; // original pColorBlendState pointer ignored\n'
                     '    if (src.pDynamicState)\n'
-                    '        pDynamicState = new safe_VkPipelineDynamicStateCreateInfo(*src.pDynamicState);\n'
+                    '        pDynamicState = vl_safe_new<safe_VkPipelineDynamicStateCreateInfo>(*src.pDynamicState);\n'
                     '    else\n'
                     '        pDynamicState = NULL;\n',
                  # VkPipelineViewportStateCreateInfo is special case because it has custom construct parameters
                 'VkPipelineViewportStateCreateInfo' :
                     '    if (src.pViewports) {\n'
-                    '        pViewports = new VkViewport[src.viewportCount];\n'
+                    '        pViewports = vl_safe_new_array<VkViewport>(src.viewportCount);\n'
                     '        memcpy ((void *)pViewports, (void *)src.pViewports, sizeof(VkViewport)*src.viewportCount);\n'
                     '    }\n'
                     '    else\n'
                     '        pViewports = NULL;\n'
                     '    if (src.pScissors) {\n'
-                    '        pScissors = new VkRect2D[src.scissorCount];\n'
+                    '        pScissors = vl_safe_new_array<VkRect2D>(src.scissorCount);\n'
                     '        memcpy ((void *)pScissors, (void *)src.pScissors, sizeof(VkRect2D)*src.scissorCount);\n'
                     '    }\n'
                     '    else\n'
@@ -1124,7 +1145,7 @@ class HelperFileOutputGenerator(OutputGenerator):
 
             custom_destruct_txt = {'VkShaderModuleCreateInfo' :
                                    '    if (pCode)\n'
-                                   '        delete[] reinterpret_cast<const uint8_t *>(pCode);\n' }
+                                   '        vl_safe_delete_array(reinterpret_cast<const uint8_t *>(pCode));\n' }
 
             for member in item.members:
                 m_type = member.type
@@ -1148,52 +1169,48 @@ class HelperFileOutputGenerator(OutputGenerator):
                             if 'pNext' != member.name and 'void' not in m_type:
                                 if not member.isstaticarray and (member.len is None or '/' in member.len):
                                     construct_txt += '    if (in_struct->%s) {\n' % member.name
-                                    construct_txt += '        %s = new %s(*in_struct->%s);\n' % (member.name, m_type, member.name)
+                                    construct_txt += '        %s = vl_safe_new<%s>(*in_struct->%s);\n' % (member.name, m_type, member.name)
                                     construct_txt += '    }\n'
                                     destruct_txt += '    if (%s)\n' % member.name
-                                    destruct_txt += '        delete %s;\n' % member.name
+                                    destruct_txt += '        vl_safe_delete(%s);\n' % member.name
                                 else:
                                     construct_txt += '    if (in_struct->%s) {\n' % member.name
-                                    construct_txt += '        %s = new %s[in_struct->%s];\n' % (member.name, m_type, member.len)
+                                    construct_txt += '        %s = vl_safe_new_array<%s>(in_struct->%s);\n' % (member.name, m_type, member.len)
                                     construct_txt += '        memcpy ((void *)%s, (void *)in_struct->%s, sizeof(%s)*in_struct->%s);\n' % (member.name, member.name, m_type, member.len)
                                     construct_txt += '    }\n'
                                     destruct_txt += '    if (%s)\n' % member.name
-                                    destruct_txt += '        delete[] %s;\n' % member.name
+                                    destruct_txt += '        vl_safe_delete_array(%s);\n' % member.name
                 elif member.isstaticarray or member.len is not None:
                     if member.len is None:
-                        # Extract length of static array by grabbing val between []
-                        static_array_size = re.match(r"[^[]*\[([^]]*)\]", member.cdecl)
-                        construct_txt += '    for (uint32_t i=0; i<%s; ++i) {\n' % static_array_size.group(1)
-                        construct_txt += '        %s[i] = in_struct->%s[i];\n' % (member.name, member.name)
-                        construct_txt += '    }\n'
+                        # Static arrays are always plain data straight from vulkan.h -- one memcpy
+                        # instead of an element loop
+                        construct_txt += '    memcpy (%s, in_struct->%s, sizeof(%s));\n' % (member.name, member.name, member.name)
                     else:
                         # Init array ptr to NULL
                         default_init_list += '\n    %s(nullptr),' % member.name
                         init_list += '\n    %s(nullptr),' % member.name
                         init_func_txt += '    %s = nullptr;\n' % member.name
-                        array_element = 'in_struct->%s[i]' % member.name
-                        if member.type in self.structNames:
-                            member_index = next((i for i, v in enumerate(self.structMembers) if v[0] == member.type), None)
-                            if member_index is not None and self.NeedSafeStruct(self.structMembers[member_index]) == True:
-                                array_element = '%s(&in_struct->safe_%s[i])' % (member.type, member.name)
                         construct_txt += '    if (%s && in_struct->%s) {\n' % (member.len, member.name)
-                        construct_txt += '        %s = new %s[%s];\n' % (member.name, m_type, member.len)
+                        construct_txt += '        %s = vl_safe_new_array<%s>(%s);\n' % (member.name, m_type, member.len)
                         destruct_txt += '    if (%s)\n' % member.name
-                        destruct_txt += '        delete[] %s;\n' % member.name
-                        construct_txt += '        for (uint32_t i=0; i<%s; ++i) {\n' % (member.len)
+                        destruct_txt += '        vl_safe_delete_array(%s);\n' % member.name
                         if 'safe_' in m_type:
+                            construct_txt += '        for (uint32_t i=0; i<%s; ++i) {\n' % (member.len)
                             construct_txt += '            %s[i].initialize(&in_struct->%s[i]);\n' % (member.name, member.name)
+                            construct_txt += '        }\n'
                         else:
-                            construct_txt += '            %s[i] = %s;\n' % (member.name, array_element)
-                        construct_txt += '        }\n'
+                            # Any element type that reaches this path without a safe_ conversion is
+                            # plain data (handles, enums, PODs from vulkan.h) -- one memcpy instead
+                            # of an element loop
+                            construct_txt += '        memcpy ((void *)%s, (void *)in_struct->%s, sizeof(%s)*%s);\n' % (member.name, member.name, m_type, member.len)
                         construct_txt += '    }\n'
                 elif member.ispointer == True:
                     construct_txt += '    if (in_struct->%s)\n' % member.name
-                    construct_txt += '        %s = new %s(in_struct->%s);\n' % (member.name, m_type, member.name)
+                    construct_txt += '        %s = vl_safe_new<%s>(in_struct->%s);\n' % (member.name, m_type, member.name)
                     construct_txt += '    else\n'
                     construct_txt += '        %s = NULL;\n' % member.name
                     destruct_txt += '    if (%s)\n' % member.name
-                    destruct_txt += '        delete %s;\n' % member.name
+                    destruct_txt += '        vl_safe_delete(%s);\n' % member.name
                 elif 'safe_' in m_type:
                     init_list += '\n    %s(&in_struct->%s),' % (member.name, member.name)
                     init_func_txt += '    %s.initialize(&in_struct->%s);\n' % (member.name, member.name)
@@ -1220,6 +1237,12 @@ class HelperFileOutputGenerator(OutputGenerator):
             copy_assign_txt = '    if (&src == this) return *this;\n\n' + destruct_txt + '\n' + copy_construct_init + copy_construct_txt + '\n    return *this;'
             safe_struct_body.append("\n%s::%s(const %s& src)\n{\n%s%s}" % (ss_name, ss_name, ss_name, copy_construct_init, copy_construct_txt)) # Copy constructor
             safe_struct_body.append("\n%s& %s::operator=(const %s& src)\n{\n%s\n}" % (ss_name, ss_name, ss_name, copy_assign_txt)) # Copy assignment operator
+            # Move construction/assignment relocate the source: safe structs are flat aggregates of
+            # values and owned raw pointers (no virtuals, no self-references), so a bitwise copy
+            # transfers ownership and re-default-constructing the source disarms its destructor.
+            move_steal_txt = '    memcpy(static_cast<void *>(this), &src, sizeof(%s));\n    new (&src) %s();\n' % (ss_name, ss_name)
+            safe_struct_body.append("\n%s::%s(%s&& src) noexcept\n{\n%s}" % (ss_name, ss_name, ss_name, move_steal_txt)) # Move constructor
+            safe_struct_body.append("\n%s& %s::operator=(%s&& src) noexcept\n{\n    if (&src == this) return *this;\n\n    this->~%s();\n%s\n    return *this;\n}" % (ss_name, ss_name, ss_name, ss_name, move_steal_txt)) # Move assignment operator
             safe_struct_body.append("\n%s::~%s()\n{\n%s}" % (ss_name, ss_name, destruct_txt))
             safe_struct_body.append("\nvoid %s::initialize(const %s* in_struct%s)\n{\n%s%s}" % (ss_name, item.name, self.custom_construct_params.get(item.name, ''), init_func_txt, construct_txt))
             # Copy initializer uses same txt as copy constructor but has a ptr and not a reference
@@ -1244,6 +1267,7 @@ class HelperFileOutputGenerator(OutputGenerator):
         idname_func = fprefix + 'stype_name'
         find_func = fprefix + 'find_in_chain'
         init_func = fprefix + 'init_struct'
+        index_class = prefix + 'ChainIndex'
 
         explanatory_comment = '\n'.join((
                 '// These empty generic templates are specialized for each type with sType',
@@ -1292,6 +1316,44 @@ class HelperFileOutputGenerator(OutputGenerator):
             '    out.sType = {type_map}<T>::kSType;',
             '    return out;',
             '}}',
+            '',
+            '// One-pass index over a pNext chain.  Construction walks the chain once into a small',
+            '// stack-resident table; each typed query then scans the captured sTypes (chains are short)',
+            '// instead of re-chasing pointers from the chain head, which matters for calls whose',
+            '// validation queries several different extension structs.',
+            'class {index_class} {{',
+            '  public:',
+            '    explicit {index_class}(const void *chain_head) : count_(0), overflow_(nullptr) {{',
+            '        const {header} *current = reinterpret_cast<const {header} *>(chain_head);',
+            '        while (current) {{',
+            '            if (count_ == kMaxIndexedStructs) {{',
+            '                overflow_ = current;',
+            '                break;',
+            '            }}',
+            '            stypes_[count_] = current->sType;',
+            '            structs_[count_] = current;',
+            '            ++count_;',
+            '            current = current->pNext;',
+            '        }}',
+            '    }}',
+            '',
+            '    template <typename T> const T *Find() const {{',
+            '        for (uint32_t i = 0; i < count_; ++i) {{',
+            '            if ({type_map}<T>::{id_member} == stypes_[i]) {{',
+            '                return reinterpret_cast<const T *>(structs_[i]);',
+            '            }}',
+            '        }}',
+            '        // Chains longer than the table are rare; search the uncaptured tail the slow way',
+            '        return overflow_ ? {find_func}<T>(overflow_) : nullptr;',
+            '    }}',
+            '',
+            '  private:',
+            '    enum {{ kMaxIndexedStructs = 16 }};',
+            '    VkStructureType stypes_[kMaxIndexedStructs];',
+            '    const {header} *structs_[kMaxIndexedStructs];',
+            '    uint32_t count_;',
+            '    const {header} *overflow_;',
+            '}};',
 
             ''))
 
@@ -1327,7 +1389,7 @@ class HelperFileOutputGenerator(OutputGenerator):
         code.append('\n'.join((
             utilities_format.format(id_member=id_member, id_map=idmap, type_map=typemap,
                 type_member=type_member, header=generic_header, typename_func=typename_func, idname_func=idname_func,
-                find_func=find_func, init_func=init_func), ''
+                find_func=find_func, init_func=init_func, index_class=index_class), ''
             )))
 
         return "\n".join(code)
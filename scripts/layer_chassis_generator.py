@@ -143,6 +143,8 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkCreatePipelineLayout',
         'vkCreateShaderModule',
         'vkAllocateDescriptorSets',
+        'vkCreateRenderPass',
+        'vkCreateRenderPass2KHR',
         # ValidationCache functions do not get dispatched
         'vkCreateValidationCacheEXT',
         'vkDestroyValidationCacheEXT',
@@ -195,10 +197,14 @@ class LayerChassisOutputGenerator(OutputGenerator):
     precallvalidate_loop = "for (auto intercept : layer_data->object_dispatch) {"
     precallrecord_loop = precallvalidate_loop
     postcallrecord_loop = "for (auto intercept : layer_data->object_dispatch) {"
+    # Hooks dispatched through a per-entry-point intercept vector rather than the full object_dispatch walk
+    intercept_vector_loop = "for (auto intercept : layer_data->intercept_vectors[InterceptId%s]) {"
 
     inline_custom_header_preamble = """
 #define NOMINMAX
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <cinttypes>
 #include <stdio.h>
 #include <stdlib.h>
@@ -223,10 +229,6 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_extension_helper.h"
 #include "vk_safe_struct.h"
 #include "vk_typemap_helper.h"
-
-
-extern uint64_t global_unique_id;
-extern std::unordered_map<uint64_t, uint64_t> unique_id_mapping;
 """
 
     inline_custom_header_class_definition = """
@@ -241,9 +243,24 @@ enum LayerObjectTypeId {
     LayerObjectTypeCoreValidation,              // Instance or device core validation layer object
 };
 
+// Precomputed decode plan entry for a descriptor update template: everything about one decoded
+// VkWriteDescriptorSet except the per-call pData pointer arithmetic
+struct TEMPLATE_DECODE_ENTRY {
+    VkDescriptorType descriptor_type;
+    uint32_t dst_binding;
+    uint32_t dst_array_element;
+    uint32_t descriptor_count;
+    size_t data_offset;
+};
+
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
+    // Flattened write list (binding rollover resolved) computed once at creation, since templates
+    // are immutable.  Empty for push descriptor templates, whose effective set layout is only
+    // known at record time, and updates then fall back to a full decode.
+    std::vector<TEMPLATE_DECODE_ENTRY> decode_plan;
+    uint32_t decode_plan_inline_count = 0;
 
     TEMPLATE_STATE(VkDescriptorUpdateTemplateKHR update_template, safe_VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
         : desc_update_template(update_template), create_info(*pCreateInfo) {}
@@ -264,6 +281,22 @@ typedef enum ValidationCheckDisables {
 } ValidationCheckDisables;
 
 
+// Dense bit index per CHECK_DISABLED field, for the packed mirror below
+typedef enum DisableCheckBits {
+    kDisableBitCommandBufferState = 0,
+    kDisableBitObjectInUse,
+    kDisableBitIdleDescriptorSet,
+    kDisableBitPushConstantRange,
+    kDisableBitQueryValidation,
+    kDisableBitObjectTracking,
+    kDisableBitCoreChecks,
+    kDisableBitThreadSafety,
+    kDisableBitStatelessChecks,
+    kDisableBitHandleWrapping,
+    kDisableBitShaderValidation,
+    kDisableBitCount
+} DisableCheckBits;
+
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // These bools are all "false" by default meaning that all checks are enabled. Enum values can be specified
 // via the vk_layer_setting.txt config file or at CreateInstance time via the VK_EXT_validation_features extension
@@ -281,14 +314,37 @@ struct CHECK_DISABLED {
     bool handle_wrapping;                           // Disable unique handles/handle wrapping
     bool shader_validation;                         // Skip validation for shaders
 
+    // Dense mirror of the bools above, indexed by DisableCheckBits and packed by Finalize() once
+    // settings processing is done at instance creation.  Hot check sites test one bit of this
+    // cached word (IsDisabled) instead of loading a scattered bool per check.
+    uint32_t bits;
+
     void SetAll(bool value) { std::fill(&command_buffer_state, &shader_validation + 1, value); }
+
+    void Finalize() {
+        static_assert(kDisableBitCount <= 32, "DisableCheckBits must fit the packed word");
+        bits = (uint32_t(command_buffer_state) << kDisableBitCommandBufferState) |
+               (uint32_t(object_in_use) << kDisableBitObjectInUse) |
+               (uint32_t(idle_descriptor_set) << kDisableBitIdleDescriptorSet) |
+               (uint32_t(push_constant_range) << kDisableBitPushConstantRange) |
+               (uint32_t(query_validation) << kDisableBitQueryValidation) |
+               (uint32_t(object_tracking) << kDisableBitObjectTracking) |
+               (uint32_t(core_checks) << kDisableBitCoreChecks) |
+               (uint32_t(thread_safety) << kDisableBitThreadSafety) |
+               (uint32_t(stateless_checks) << kDisableBitStatelessChecks) |
+               (uint32_t(handle_wrapping) << kDisableBitHandleWrapping) |
+               (uint32_t(shader_validation) << kDisableBitShaderValidation);
+    }
+    bool IsDisabled(DisableCheckBits bit) const { return (bits >> bit) & 1u; }
 };
 
 struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
+    bool deferred_shader_validation;                // Offload spirv-val to worker threads, joined before first use
+    bool deferred_cb_validation;                    // Capture draw-time checks at record, run them at submit on the worker pool
 
-    void SetAll(bool value) { std::fill(&gpu_validation, &gpu_validation_reserve_binding_slot + 1, value); }
+    void SetAll(bool value) { std::fill(&gpu_validation, &deferred_cb_validation + 1, value); }
 };
 
 // Layer chassis validation object base class definition
@@ -315,6 +371,17 @@ class ValidationObject {
         std::vector<ValidationObject*> object_dispatch;
         LayerObjectTypeId container_type;
 
+        // Per-entry-point dispatch vectors, indexed by InterceptId.  Built once the final object_dispatch
+        // contents are known -- see InitObjectDispatchVectors() in chassis.cpp.
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
+        void InitObjectDispatchVectors();
+
+        // Devirtualized fast path: when exactly one validation object is enabled,
+        // InitObjectDispatchVectors() caches it here and the generated entry points call into the
+        // concrete class directly -- see the VVL_FUSED_* macros in chassis.cpp.
+        ValidationObject* fused_object = nullptr;
+        LayerObjectTypeId fused_object_type = LayerObjectTypeInstance;
+
         std::string layer_name = "CHASSIS";
 
         // Constructor
@@ -322,9 +389,31 @@ class ValidationObject {
         // Destructor
         virtual ~ValidationObject() {};
 
-        std::mutex validation_object_mutex;
-        virtual std::unique_lock<std::mutex> write_lock() {
-            return std::unique_lock<std::mutex>(validation_object_mutex);
+        // Reader/writer lock for validation object state.  PreCallValidate* hooks are read-only by design
+        // and take the shared lock, so multiple threads can validate concurrently; the record-phase hooks
+        // that mutate layer state take the exclusive lock.
+        std::shared_timed_mutex validation_object_mutex;
+        virtual std::unique_lock<std::shared_timed_mutex> write_lock() {
+            return std::unique_lock<std::shared_timed_mutex>(validation_object_mutex);
+        }
+        virtual std::shared_lock<std::shared_timed_mutex> read_lock() {
+            return std::shared_lock<std::shared_timed_mutex>(validation_object_mutex);
+        }
+
+        // RAII lock bundle for the record phase of commands dispatched on a VkCommandBuffer.  The default
+        // implementation falls back to the exclusive validation object lock.  Layers that keep
+        // command-buffer-scoped state override this to hold the device lock shared (so handle
+        // create/destroy still excludes recording) and serialize on the individual command buffer instead,
+        // letting different threads record into different command buffers in parallel.
+        struct CommandBufferWriteLock {
+            std::unique_lock<std::shared_timed_mutex> exclusive_lock;
+            std::shared_lock<std::shared_timed_mutex> shared_lock;
+            std::unique_lock<std::mutex> cb_lock;
+        };
+        virtual CommandBufferWriteLock cb_write_lock(VkCommandBuffer commandBuffer) {
+            CommandBufferWriteLock lock;
+            lock.exclusive_lock = write_lock();
+            return lock;
         }
 
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
@@ -353,26 +442,93 @@ class ValidationObject {
         // Map of wrapped descriptor pools to set of wrapped descriptor sets allocated from each pool
         std::unordered_map<VkDescriptorPool, std::unordered_set<VkDescriptorSet>> pool_descriptor_sets_map;
 
+        // Slot map of wrapped unique IDs to the driver handles they stand for.  Ids encode their
+        // own slot index and generation, so unwrapping is an array index plus a generation compare
+        // with no hashing, no lock, and reliable detection of destroyed ids.  Each dispatch object
+        // owns the map for the handles created from it, so recording threads on one device never
+        // touch another device's map.  Instance-scoped handle types (surfaces, displays, debug
+        // callbacks) always resolve through the instance's map -- see UnwrapInstanceScoped().
+        vl_slot_map unique_id_mapping;
+        // Instance-level dispatch object owning the map for instance-scoped handles; null on the
+        // instance object itself.  Set when the device-level chassis is created.
+        ValidationObject* instance_wrap_state = nullptr;
+
+        vl_slot_map &InstanceWrapMap() {
+            return instance_wrap_state ? instance_wrap_state->unique_id_mapping : unique_id_mapping;
+        }
 
-        // Unwrap a handle.  Must hold lock.
+        // Unwrap a handle.
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
-            // TODO: don't use operator[] here.
-            return (HandleType)unique_id_mapping[reinterpret_cast<uint64_t const &>(wrappedHandle)];
+            auto iter = unique_id_mapping.find(reinterpret_cast<uint64_t const &>(wrappedHandle));
+            if (iter == unique_id_mapping.end()) return (HandleType)0;
+            return (HandleType)iter->second;
+        }
+
+        // Unwrap a handle whose type is created at instance scope.  Such handles can legally be
+        // referenced by device-level calls (a surface in vkCreateSwapchainKHR, a display in
+        // vkDisplayPowerControlEXT), so they always resolve through the instance's map.
+        template <typename HandleType>
+        HandleType UnwrapInstanceScoped(HandleType wrappedHandle) {
+            vl_slot_map &wrap_map = InstanceWrapMap();
+            auto iter = wrap_map.find(reinterpret_cast<uint64_t const &>(wrappedHandle));
+            if (iter == wrap_map.end()) return (HandleType)0;
+            return (HandleType)iter->second;
+        }
+
+        // Instance-scoped handle types resolve exclusively through the instance's map, everything
+        // else through this object's.  Fresh slot maps mint identical id sequences, so probing the
+        // wrong map first can resolve a handle to an unrelated object of another scope.
+        static bool HandleTypeIsInstanceScoped(VkObjectType object_type) {
+            switch (object_type) {
+                case VK_OBJECT_TYPE_SURFACE_KHR:
+                case VK_OBJECT_TYPE_DISPLAY_KHR:
+                case VK_OBJECT_TYPE_DISPLAY_MODE_KHR:
+                case VK_OBJECT_TYPE_DEBUG_UTILS_MESSENGER_EXT:
+                case VK_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+        static bool HandleTypeIsInstanceScoped(VkDebugReportObjectTypeEXT object_type) {
+            switch (object_type) {
+                case VK_DEBUG_REPORT_OBJECT_TYPE_SURFACE_KHR_EXT:
+                case VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_KHR_EXT:
+                case VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_MODE_KHR_EXT:
+                case VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT_EXT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // Look up a wrapped handle on behalf of the debug-utils naming entry points, routed to
+        // the one map its object type can live in.
+        bool FindWrappedHandleScoped(uint64_t wrapped_handle, bool instance_scoped, uint64_t *unwrapped) {
+            vl_slot_map &wrap_map = instance_scoped ? InstanceWrapMap() : unique_id_mapping;
+            auto iter = wrap_map.find(wrapped_handle);
+            if (iter == wrap_map.end()) return false;
+            *unwrapped = iter->second;
+            return true;
+        }
+        bool FindWrappedHandle(uint64_t wrapped_handle, VkObjectType object_type, uint64_t *unwrapped) {
+            return FindWrappedHandleScoped(wrapped_handle, HandleTypeIsInstanceScoped(object_type), unwrapped);
+        }
+        bool FindWrappedHandle(uint64_t wrapped_handle, VkDebugReportObjectTypeEXT object_type, uint64_t *unwrapped) {
+            return FindWrappedHandleScoped(wrapped_handle, HandleTypeIsInstanceScoped(object_type), unwrapped);
         }
 
-        // Wrap a newly created handle with a new unique ID, and return the new ID -- must hold lock.
+        // Wrap a newly created handle with a new unique ID, and return the new ID.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
+            auto unique_id = unique_id_mapping.add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             return (HandleType)unique_id;
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup. Must hold lock.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
+            auto unique_id = InstanceWrapMap().add(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping[newlyCreatedHandle] = unique_id;
             return (VkDisplayKHR)unique_id;
         }
@@ -418,6 +574,7 @@ class ValidationObject {
 
 #include <string.h>
 #include <mutex>
+#include <type_traits>
 
 #define VALIDATION_ERROR_MAP_IMPL
 
@@ -426,11 +583,6 @@ class ValidationObject {
 
 std::unordered_map<void*, ValidationObject*> layer_data_map;
 
-// Global unique object identifier.  All increments must be guarded by a lock.
-uint64_t global_unique_id = 1;
-// Map uniqueID to actual object handle
-std::unordered_map<uint64_t, uint64_t> unique_id_mapping;
-
 // TODO: This variable controls handle wrapping -- in the future it should be hooked
 //       up to the new VALIDATION_FEATURES extension. Temporarily, control with a compile-time flag.
 #if defined(LAYER_CHASSIS_CAN_WRAP_HANDLES)
@@ -474,6 +626,97 @@ bool wrap_handles = false;
 #include "core_validation.h"
 #endif
 
+// Compile-time override detection for the dispatch machinery: &Derived::Hook has type
+// bool (ValidationObject::*)(...) unless Derived declares its own override.
+#if BUILD_THREAD_SAFETY
+#define OVERRIDES_THREADING(name) (!std::is_same<decltype(&ThreadSafety::name), decltype(&ValidationObject::name)>::value)
+#else
+#define OVERRIDES_THREADING(name) false
+#endif
+#if BUILD_PARAMETER_VALIDATION
+#define OVERRIDES_PARAMETER_VALIDATION(name) (!std::is_same<decltype(&StatelessValidation::name), decltype(&ValidationObject::name)>::value)
+#else
+#define OVERRIDES_PARAMETER_VALIDATION(name) false
+#endif
+#if BUILD_OBJECT_TRACKER
+#define OVERRIDES_OBJECT_TRACKER(name) (!std::is_same<decltype(&ObjectLifetimes::name), decltype(&ValidationObject::name)>::value)
+#else
+#define OVERRIDES_OBJECT_TRACKER(name) false
+#endif
+#if BUILD_CORE_VALIDATION
+#define OVERRIDES_CORE_VALIDATION(name) (!std::is_same<decltype(&CoreChecks::name), decltype(&ValidationObject::name)>::value)
+#else
+#define OVERRIDES_CORE_VALIDATION(name) false
+#endif
+
+// Devirtualized single-object dispatch.  When exactly one validation object is enabled (the most
+// common production configuration), InitObjectDispatchVectors() caches it in fused_object and the
+// generated entry points dispatch through VVL_FUSED_DISPATCH instead of iterating the intercept
+// vectors.  The qualified hook calls resolve statically, so the compiler can inline the hook body,
+// and the OVERRIDES_* guards constant-fold each case away entirely when the class does not
+// override the hook -- no loop, no virtual dispatch, no lock acquisition for empty hooks.
+#if BUILD_THREAD_SAFETY
+#define VVL_FUSED_CASE_THREADING(assign, layer_data, lock_expr, hook, params)      \\
+    case LayerObjectTypeThreading:                                                 \\
+        if (OVERRIDES_THREADING(hook)) {                                           \\
+            auto fused = static_cast<ThreadSafety *>((layer_data)->fused_object);  \\
+            auto lock = fused->lock_expr;                                          \\
+            assign fused->ThreadSafety::hook params;                               \\
+        }                                                                          \\
+        break;
+#else
+#define VVL_FUSED_CASE_THREADING(assign, layer_data, lock_expr, hook, params)
+#endif
+#if BUILD_PARAMETER_VALIDATION
+#define VVL_FUSED_CASE_PARAMETER_VALIDATION(assign, layer_data, lock_expr, hook, params) \\
+    case LayerObjectTypeParameterValidation:                                             \\
+        if (OVERRIDES_PARAMETER_VALIDATION(hook)) {                                      \\
+            auto fused = static_cast<StatelessValidation *>((layer_data)->fused_object); \\
+            auto lock = fused->lock_expr;                                                \\
+            assign fused->StatelessValidation::hook params;                              \\
+        }                                                                                \\
+        break;
+#else
+#define VVL_FUSED_CASE_PARAMETER_VALIDATION(assign, layer_data, lock_expr, hook, params)
+#endif
+#if BUILD_OBJECT_TRACKER
+#define VVL_FUSED_CASE_OBJECT_TRACKER(assign, layer_data, lock_expr, hook, params)  \\
+    case LayerObjectTypeObjectTracker:                                              \\
+        if (OVERRIDES_OBJECT_TRACKER(hook)) {                                       \\
+            auto fused = static_cast<ObjectLifetimes *>((layer_data)->fused_object); \\
+            auto lock = fused->lock_expr;                                           \\
+            assign fused->ObjectLifetimes::hook params;                             \\
+        }                                                                           \\
+        break;
+#else
+#define VVL_FUSED_CASE_OBJECT_TRACKER(assign, layer_data, lock_expr, hook, params)
+#endif
+#if BUILD_CORE_VALIDATION
+#define VVL_FUSED_CASE_CORE_VALIDATION(assign, layer_data, lock_expr, hook, params) \\
+    case LayerObjectTypeCoreValidation:                                             \\
+        if (OVERRIDES_CORE_VALIDATION(hook)) {                                      \\
+            auto fused = static_cast<CoreChecks *>((layer_data)->fused_object);     \\
+            auto lock = fused->lock_expr;                                           \\
+            assign fused->CoreChecks::hook params;                                  \\
+        }                                                                           \\
+        break;
+#else
+#define VVL_FUSED_CASE_CORE_VALIDATION(assign, layer_data, lock_expr, hook, params)
+#endif
+
+#define VVL_FUSED_DISPATCH(assign, layer_data, lock_expr, hook, params)                  \\
+    switch ((layer_data)->fused_object_type) {                                           \\
+        VVL_FUSED_CASE_THREADING(assign, layer_data, lock_expr, hook, params)            \\
+        VVL_FUSED_CASE_PARAMETER_VALIDATION(assign, layer_data, lock_expr, hook, params) \\
+        VVL_FUSED_CASE_OBJECT_TRACKER(assign, layer_data, lock_expr, hook, params)       \\
+        VVL_FUSED_CASE_CORE_VALIDATION(assign, layer_data, lock_expr, hook, params)      \\
+        default: {                                                                       \\
+            auto fused = (layer_data)->fused_object;                                     \\
+            auto lock = fused->lock_expr;                                                \\
+            assign fused->hook params;                                                   \\
+        } break;                                                                         \\
+    }
+
 namespace vulkan_layer_chassis {
 
 using std::unordered_map;
@@ -494,7 +737,8 @@ typedef struct {
     void* funcptr;
 } function_data;
 
-extern const std::unordered_map<std::string, function_data> name_to_funcptr_map;
+// Allocation-free lookup of an intercepted entry point by name, returns null when not intercepted
+const function_data* GetFunctionData(const char *funcName);
 
 // Manually written functions
 
@@ -726,12 +970,12 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, cons
     if (!ApiParentExtensionEnabled(funcName, &layer_data->device_extensions)) {
         return nullptr;
     }
-    const auto &item = name_to_funcptr_map.find(funcName);
-    if (item != name_to_funcptr_map.end()) {
-        if (item->second.is_instance_api) {
+    const auto *item = GetFunctionData(funcName);
+    if (item != nullptr) {
+        if (item->is_instance_api) {
             return nullptr;
         } else {
-            return reinterpret_cast<PFN_vkVoidFunction>(item->second.funcptr);
+            return reinterpret_cast<PFN_vkVoidFunction>(item->funcptr);
         }
     }
     auto &table = layer_data->device_dispatch_table;
@@ -740,9 +984,9 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, cons
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *funcName) {
-    const auto &item = name_to_funcptr_map.find(funcName);
-    if (item != name_to_funcptr_map.end()) {
-        return reinterpret_cast<PFN_vkVoidFunction>(item->second.funcptr);
+    const auto *item = GetFunctionData(funcName);
+    if (item != nullptr) {
+        return reinterpret_cast<PFN_vkVoidFunction>(item->funcptr);
     }
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     auto &table = layer_data->instance_dispatch_table;
@@ -798,6 +1042,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
         SetValidationFlags(&local_disables, validation_flags_ext);
     }
     ProcessConfigAndEnvSettings(OBJECT_LAYER_DESCRIPTION, &local_enables, &local_disables);
+    local_disables.Finalize();
 
     // Create temporary dispatch vector for pre-calls until instance is created
     std::vector<ValidationObject*> local_object_dispatch;
@@ -855,6 +1100,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 
     framework->object_dispatch = local_object_dispatch;
     framework->container_type = LayerObjectTypeInstance;
+    framework->InitObjectDispatchVectors();
     framework->disabled = local_disables;
     framework->enabled = local_enables;
 
@@ -906,21 +1152,27 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(instance);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
-    """ + precallvalidate_loop + """
-        auto lock = intercept->write_lock();
+    VVL_PHASE_BEGIN(InterceptIdPreCallValidateDestroyInstance);
+    """ + (intercept_vector_loop % 'PreCallValidateDestroyInstance') + """
+        auto lock = intercept->read_lock();
         intercept->PreCallValidateDestroyInstance(instance, pAllocator);
     }
-    """ + precallrecord_loop + """
+    VVL_PHASE_END(InterceptIdPreCallValidateDestroyInstance);
+    VVL_PHASE_BEGIN(InterceptIdPreCallRecordDestroyInstance);
+    """ + (intercept_vector_loop % 'PreCallRecordDestroyInstance') + """
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
+    VVL_PHASE_END(InterceptIdPreCallRecordDestroyInstance);
 
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
 
-    """ + postcallrecord_loop + """
+    VVL_PHASE_BEGIN(InterceptIdPostCallRecordDestroyInstance);
+    """ + (intercept_vector_loop % 'PostCallRecordDestroyInstance') + """
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
+    VVL_PHASE_END(InterceptIdPostCallRecordDestroyInstance);
     // Clean up logging callback, if any
     while (layer_data->logging_messenger.size() > 0) {
         VkDebugUtilsMessengerEXT messenger = layer_data->logging_messenger.back();
@@ -935,6 +1187,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     layer_debug_utils_destroy_instance(layer_data->report_data);
 
+#if defined(VALIDATION_PHASE_TIMING)
+    PhaseTimingDump();
+#endif
+
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -972,7 +1228,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
@@ -1000,6 +1256,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     device_interceptor->device = *pDevice;
     device_interceptor->physical_device = gpu;
     device_interceptor->instance = instance_interceptor->instance;
+    device_interceptor->instance_wrap_state = instance_interceptor;
     device_interceptor->report_data = layer_debug_utils_create_device(instance_interceptor->report_data, *pDevice);
 
     // Note that this defines the order in which the layer validation objects are called
@@ -1049,6 +1306,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         dev_intercept->device_extensions = device_interceptor->device_extensions;
     }
 
+    device_interceptor->InitObjectDispatchVectors();
+
     for (auto intercept : instance_interceptor->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
@@ -1062,22 +1321,28 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(device);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
-    """ + precallvalidate_loop + """
-        auto lock = intercept->write_lock();
+    VVL_PHASE_BEGIN(InterceptIdPreCallValidateDestroyDevice);
+    """ + (intercept_vector_loop % 'PreCallValidateDestroyDevice') + """
+        auto lock = intercept->read_lock();
         intercept->PreCallValidateDestroyDevice(device, pAllocator);
     }
-    """ + precallrecord_loop + """
+    VVL_PHASE_END(InterceptIdPreCallValidateDestroyDevice);
+    VVL_PHASE_BEGIN(InterceptIdPreCallRecordDestroyDevice);
+    """ + (intercept_vector_loop % 'PreCallRecordDestroyDevice') + """
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
+    VVL_PHASE_END(InterceptIdPreCallRecordDestroyDevice);
     layer_debug_utils_destroy_device(device);
 
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
-    """ + postcallrecord_loop + """
+    VVL_PHASE_BEGIN(InterceptIdPostCallRecordDestroyDevice);
+    """ + (intercept_vector_loop % 'PostCallRecordDestroyDevice') + """
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
+    VVL_PHASE_END(InterceptIdPostCallRecordDestroyDevice);
 
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
@@ -1108,7 +1373,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     cgpl_state.pCreateInfos = pCreateInfos;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &cgpl_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
@@ -1147,7 +1412,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     ccpl_state.pCreateInfos = pCreateInfos;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &ccpl_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
@@ -1183,7 +1448,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     crtpl_state.pCreateInfos = pCreateInfos;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos,
                                                                       pAllocator, pPipelines, &crtpl_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -1219,20 +1484,24 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     create_pipeline_layout_api_state cpl_state{};
     cpl_state.modified_create_info = *pCreateInfo;
 
-    for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+    VVL_PHASE_BEGIN(InterceptIdPreCallValidateCreatePipelineLayout);
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallValidateCreatePipelineLayout]) {
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
+    VVL_PHASE_END(InterceptIdPreCallValidateCreatePipelineLayout);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
-    for (auto intercept : layer_data->object_dispatch) {
+    VVL_PHASE_BEGIN(InterceptIdPostCallRecordCreatePipelineLayout);
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPostCallRecordCreatePipelineLayout]) {
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
+    VVL_PHASE_END(InterceptIdPostCallRecordCreatePipelineLayout);
     return result;
 }
 
@@ -1254,7 +1523,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
@@ -1284,14 +1553,16 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 #endif
 
     for (auto intercept : layer_data->object_dispatch) {
-        auto lock = intercept->write_lock();
+        auto lock = intercept->read_lock();
         skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, &ads_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
-    for (auto intercept : layer_data->object_dispatch) {
+    VVL_PHASE_BEGIN(InterceptIdPreCallRecordAllocateDescriptorSets);
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordAllocateDescriptorSets]) {
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
+    VVL_PHASE_END(InterceptIdPreCallRecordAllocateDescriptorSets);
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     for (auto intercept : layer_data->object_dispatch) {
         auto lock = intercept->write_lock();
@@ -1300,6 +1571,74 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     return result;
 }
 
+// These APIs save the core_validation render pass state object across the down-chain call, so the
+// RenderPass2 conversion and safe-struct capture of the create info happen only once per call
+VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
+    VkDevice                                    device,
+    const VkRenderPassCreateInfo*               pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkRenderPass*                               pRenderPass) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    bool skip = false;
+
+#ifdef BUILD_CORE_VALIDATION
+    create_render_pass_api_state crp_state{};
+#else
+    struct crp_state {} crp_state;
+#endif
+
+    for (auto intercept : layer_data->object_dispatch) {
+        auto lock = intercept->read_lock();
+        skip |= intercept->PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, &crp_state);
+        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    }
+    VVL_PHASE_BEGIN(InterceptIdPreCallRecordCreateRenderPass);
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass]) {
+        auto lock = intercept->write_lock();
+        intercept->PreCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+    }
+    VVL_PHASE_END(InterceptIdPreCallRecordCreateRenderPass);
+    VkResult result = DispatchCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+    for (auto intercept : layer_data->object_dispatch) {
+        auto lock = intercept->write_lock();
+        intercept->PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result, &crp_state);
+    }
+    return result;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
+    VkDevice                                    device,
+    const VkRenderPassCreateInfo2KHR*           pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkRenderPass*                               pRenderPass) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    bool skip = false;
+
+#ifdef BUILD_CORE_VALIDATION
+    create_render_pass_api_state crp_state{};
+#else
+    struct crp_state {} crp_state;
+#endif
+
+    for (auto intercept : layer_data->object_dispatch) {
+        auto lock = intercept->read_lock();
+        skip |= intercept->PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, &crp_state);
+        if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
+    }
+    VVL_PHASE_BEGIN(InterceptIdPreCallRecordCreateRenderPass2KHR);
+    for (auto intercept : layer_data->intercept_vectors[InterceptIdPreCallRecordCreateRenderPass2KHR]) {
+        auto lock = intercept->write_lock();
+        intercept->PreCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+    }
+    VVL_PHASE_END(InterceptIdPreCallRecordCreateRenderPass2KHR);
+    VkResult result = DispatchCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+    for (auto intercept : layer_data->object_dispatch) {
+        auto lock = intercept->write_lock();
+        intercept->PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result, &crp_state);
+    }
+    return result;
+}
+
 
 
 
@@ -1431,6 +1770,22 @@ VKAPI_ATTR VkResult VKAPI_CALL GetValidationCacheDataEXT(
             PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result);
         };
 
+        // Allow additional state parameter for CreateRenderPass
+        virtual bool PreCallValidateCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, void* crp_state)  {
+            return PreCallValidateCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+        };
+        virtual void PostCallRecordCreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result, void* crp_state) {
+            PostCallRecordCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass, result);
+        };
+
+        // Allow additional state parameter for CreateRenderPass2KHR
+        virtual bool PreCallValidateCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, void* crp_state)  {
+            return PreCallValidateCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass);
+        };
+        virtual void PostCallRecordCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2KHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass, VkResult result, void* crp_state) {
+            PostCallRecordCreateRenderPass2KHR(device, pCreateInfo, pAllocator, pRenderPass, result);
+        };
+
         // Modify a parameter to CreateDevice
         virtual void PreCallRecordCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice, std::unique_ptr<safe_VkDeviceCreateInfo> &modified_create_info) {
             PreCallRecordCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
@@ -1496,8 +1851,134 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
         self.intercepts = []
+        # Ordered list of (hook_name, feature_protect) for InterceptId generation.  The Destroy hooks and
+        # the hot CreatePipelineLayout/AllocateDescriptorSets phases are pre-seeded because their
+        # manually-written bodies also dispatch through intercept_vectors.
+        self.intercept_ids = [(hook, None) for hook in ('PreCallValidateDestroyInstance', 'PreCallRecordDestroyInstance',
+                                                        'PostCallRecordDestroyInstance', 'PreCallValidateDestroyDevice',
+                                                        'PreCallRecordDestroyDevice', 'PostCallRecordDestroyDevice',
+                                                        'PreCallValidateCreatePipelineLayout', 'PostCallRecordCreatePipelineLayout',
+                                                        'PreCallRecordAllocateDescriptorSets')]
         self.layer_factory = ''                     # String containing base layer factory class definition
 
+    # Phases of manually-written bodies that dispatch through intercept_vectors at the function's
+    # registry position rather than via the pre-seeded list above
+    manual_intercept_ids = {
+        'vkCreateRenderPass': ('PreCallRecordCreateRenderPass',),
+        'vkCreateRenderPass2KHR': ('PreCallRecordCreateRenderPass2KHR',),
+    }
+
+    # Record a Pre/Post hook name for InterceptId enum and dispatch vector generation
+    def RecordInterceptId(self, hook_name):
+        self.intercept_ids.append((hook_name, self.featureExtraProtect))
+
+    # Generate the InterceptId enum used to index ValidationObject::intercept_vectors.  Entries are emitted
+    # unconditionally so vector indices are identical across platforms.
+    def GenerateInterceptIdEnum(self):
+        out = []
+        out.append('')
+        out.append('// Identifies the Pre/Post hook a generated entry point is dispatching; used to index')
+        out.append('// ValidationObject::intercept_vectors.')
+        out.append('typedef enum InterceptId {')
+        for hook_name, protect in self.intercept_ids:
+            out.append('    InterceptId%s,' % hook_name)
+        out.append('    InterceptIdCount,')
+        out.append('} InterceptId;')
+        out.append('')
+        out.append(self.inline_phase_timing_header)
+        return '\n'.join(out)
+
+    # Generate the VALIDATION_PHASE_TIMING counter implementation and the InterceptId name table
+    def GeneratePhaseTimingSource(self):
+        out = []
+        out.append('')
+        out.append('#if defined(VALIDATION_PHASE_TIMING)')
+        out.append('')
+        out.append('#include <chrono>')
+        out.append('#include <cstdio>')
+        out.append('#include <cstdlib>')
+        out.append('#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))')
+        out.append('#include <intrin.h>')
+        out.append('#elif defined(__i386__) || defined(__x86_64__)')
+        out.append('#include <x86intrin.h>')
+        out.append('#endif')
+        out.append('')
+        out.append('// Phase names indexed by InterceptId, for the CSV dump')
+        out.append('static const char *const intercept_id_names[InterceptIdCount] = {')
+        for hook_name, protect in self.intercept_ids:
+            out.append('    "%s",' % hook_name)
+        out.append('};')
+        out.append('')
+        out.append('static std::mutex phase_timing_lock;')
+        out.append('// Counters merged back from threads that have already exited')
+        out.append('static PhaseTimingRecord phase_timing_retired[InterceptIdCount];')
+        out.append('static std::vector<PhaseTimingBuffer *> phase_timing_buffers;')
+        out.append(self.inline_phase_timing_source)
+        return '\n'.join(out)
+
+    # Generate ValidationObject::InitObjectDispatchVectors().  Override detection relies on the fact that
+    # &Derived::Hook has type bool (ValidationObject::*)(...) unless Derived declares its own override.
+    def GenerateInitObjectDispatchVectors(self):
+        out = []
+        out.append('')
+        out.append('// Fill in the per-entry-point dispatch vectors.  Each vector contains only the enabled validation objects')
+        out.append('// that actually override the corresponding Pre/Post hook, so entry points with no real interceptor')
+        out.append('// skip the dispatch loops entirely and trampoline straight to the driver.')
+        out.append('void ValidationObject::InitObjectDispatchVectors() {')
+        out.append('    intercept_vectors.clear();')
+        out.append('    intercept_vectors.resize(InterceptIdCount);')
+        out.append('')
+        out.append('    // Cache the lone validation object for the devirtualized entry-point fast path')
+        out.append('    if (object_dispatch.size() == 1) {')
+        out.append('        fused_object = object_dispatch[0];')
+        out.append('        fused_object_type = fused_object->container_type;')
+        out.append('    } else {')
+        out.append('        fused_object = nullptr;')
+        out.append('    }')
+        out.append('')
+        out.append('    auto init_intercept_vector = [this](InterceptId id, bool threading_overrides, bool parameter_validation_overrides,')
+        out.append('                                        bool object_tracker_overrides, bool core_validation_overrides) {')
+        out.append('        std::vector<ValidationObject*> &dispatch_vector = intercept_vectors[id];')
+        out.append('        for (auto item : object_dispatch) {')
+        out.append('            switch (item->container_type) {')
+        out.append('                case LayerObjectTypeThreading:')
+        out.append('                    if (threading_overrides) dispatch_vector.push_back(item);')
+        out.append('                    break;')
+        out.append('                case LayerObjectTypeParameterValidation:')
+        out.append('                    if (parameter_validation_overrides) dispatch_vector.push_back(item);')
+        out.append('                    break;')
+        out.append('                case LayerObjectTypeObjectTracker:')
+        out.append('                    if (object_tracker_overrides) dispatch_vector.push_back(item);')
+        out.append('                    break;')
+        out.append('                case LayerObjectTypeCoreValidation:')
+        out.append('                    if (core_validation_overrides) dispatch_vector.push_back(item);')
+        out.append('                    break;')
+        out.append('                default:')
+        out.append('                    // Unknown validation object types get called unconditionally')
+        out.append('                    dispatch_vector.push_back(item);')
+        out.append('                    break;')
+        out.append('            }')
+        out.append('        }')
+        out.append('    };')
+        out.append('')
+        out.append('#define BUILD_DISPATCH_VECTOR(name) \\')
+        out.append('    init_intercept_vector(InterceptId##name, OVERRIDES_THREADING(name), OVERRIDES_PARAMETER_VALIDATION(name), \\')
+        out.append('                          OVERRIDES_OBJECT_TRACKER(name), OVERRIDES_CORE_VALIDATION(name));')
+        cur_protect = None
+        for hook_name, protect in self.intercept_ids:
+            if protect != cur_protect:
+                if cur_protect is not None:
+                    out.append('#endif // %s' % cur_protect)
+                if protect is not None:
+                    out.append('#ifdef %s' % protect)
+                cur_protect = protect
+            out.append('    BUILD_DISPATCH_VECTOR(%s);' % hook_name)
+        if cur_protect is not None:
+            out.append('#endif // %s' % cur_protect)
+        out.append('#undef BUILD_DISPATCH_VECTOR')
+        out.append('}')
+        return '\n'.join(out)
+
     # Check if the parameter passed in is a pointer to an array
     def paramIsArray(self, param):
         return param.attrib.get('len') is not None
@@ -1510,6 +1991,161 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 ispointer = True
         return ispointer
 
+
+    inline_custom_name_lookup = """
+// Open-addressed hash table over name_to_funcptr_table, built once on first use.  Lookups hash the
+// incoming name in place (FNV-1a) and probe linearly, so resolving an entry point performs no heap
+// allocation and no std::string construction.
+static uint32_t FuncNameHash(const char *name) {
+    uint32_t hash = 2166136261u;
+    for (const char *p = name; *p; ++p) {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+    }
+    return hash;
+}
+
+namespace {
+struct FunctionNameTable {
+    // Next power of two at least twice the entry count, to keep probe sequences short
+    static const uint32_t kSize = 1024;
+    static_assert(kSize >= 2 * (sizeof(name_to_funcptr_table) / sizeof(name_to_funcptr_table[0])),
+                  "function name hash table is overloaded");
+    const function_table_entry *slots[kSize];
+
+    FunctionNameTable() {
+        for (uint32_t i = 0; i < kSize; ++i) slots[i] = nullptr;
+        for (const auto &entry : name_to_funcptr_table) {
+            uint32_t slot = FuncNameHash(entry.name) & (kSize - 1);
+            while (slots[slot] != nullptr) slot = (slot + 1) & (kSize - 1);
+            slots[slot] = &entry;
+        }
+    }
+
+    const function_data *Find(const char *name) const {
+        uint32_t slot = FuncNameHash(name) & (kSize - 1);
+        while (slots[slot] != nullptr) {
+            if (strcmp(slots[slot]->name, name) == 0) return &slots[slot]->data;
+            slot = (slot + 1) & (kSize - 1);
+        }
+        return nullptr;
+    }
+};
+}  // anonymous namespace
+
+const function_data *GetFunctionData(const char *funcName) {
+    static const FunctionNameTable name_table;
+    return name_table.Find(funcName);
+}
+"""
+
+    inline_phase_timing_header = """
+// Optional per-entry-point phase timing, enabled by building with -DVALIDATION_PHASE_TIMING.  Each
+// intercepted phase (PreCallValidate / PreCallRecord / PostCallRecord, keyed by InterceptId)
+// accumulates its call count plus total and max elapsed cycles into per-thread buffers, merged and
+// dumped as CSV when the last instance is destroyed.
+#if defined(VALIDATION_PHASE_TIMING)
+
+struct PhaseTimingRecord {
+    uint64_t count;
+    uint64_t total_cycles;
+    uint64_t max_cycles;
+};
+
+class PhaseTimingBuffer {
+  public:
+    PhaseTimingBuffer();
+    ~PhaseTimingBuffer();
+    static PhaseTimingBuffer &Get();
+    PhaseTimingRecord records[InterceptIdCount];
+};
+
+uint64_t PhaseTimingNow();
+void PhaseTimingAccumulate(InterceptId id, uint64_t cycles);
+// Write "entry_point_phase,count,total_cycles,max_cycles" CSV to the file named by the
+// VK_LAYER_PHASE_TIMING_FILE environment variable, or to stderr if it is unset
+void PhaseTimingDump();
+
+#define VVL_PHASE_BEGIN(id) uint64_t vvl_phase_start_##id = PhaseTimingNow()
+#define VVL_PHASE_END(id) PhaseTimingAccumulate(id, PhaseTimingNow() - vvl_phase_start_##id)
+
+#else
+
+#define VVL_PHASE_BEGIN(id)
+#define VVL_PHASE_END(id)
+
+#endif  // VALIDATION_PHASE_TIMING"""
+
+    inline_phase_timing_source = """
+uint64_t PhaseTimingNow() {
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+PhaseTimingBuffer::PhaseTimingBuffer() {
+    memset(records, 0, sizeof(records));
+    std::lock_guard<std::mutex> lock(phase_timing_lock);
+    phase_timing_buffers.push_back(this);
+}
+
+PhaseTimingBuffer::~PhaseTimingBuffer() {
+    std::lock_guard<std::mutex> lock(phase_timing_lock);
+    for (int id = 0; id < InterceptIdCount; ++id) {
+        phase_timing_retired[id].count += records[id].count;
+        phase_timing_retired[id].total_cycles += records[id].total_cycles;
+        if (records[id].max_cycles > phase_timing_retired[id].max_cycles) {
+            phase_timing_retired[id].max_cycles = records[id].max_cycles;
+        }
+    }
+    for (auto iter = phase_timing_buffers.begin(); iter != phase_timing_buffers.end(); ++iter) {
+        if (*iter == this) {
+            phase_timing_buffers.erase(iter);
+            break;
+        }
+    }
+}
+
+PhaseTimingBuffer &PhaseTimingBuffer::Get() {
+    static thread_local PhaseTimingBuffer buffer;
+    return buffer;
+}
+
+void PhaseTimingAccumulate(InterceptId id, uint64_t cycles) {
+    PhaseTimingRecord &record = PhaseTimingBuffer::Get().records[id];
+    record.count++;
+    record.total_cycles += cycles;
+    if (cycles > record.max_cycles) record.max_cycles = cycles;
+}
+
+void PhaseTimingDump() {
+    std::lock_guard<std::mutex> lock(phase_timing_lock);
+    PhaseTimingRecord merged[InterceptIdCount];
+    memcpy(merged, phase_timing_retired, sizeof(merged));
+    for (auto buffer : phase_timing_buffers) {
+        for (int id = 0; id < InterceptIdCount; ++id) {
+            merged[id].count += buffer->records[id].count;
+            merged[id].total_cycles += buffer->records[id].total_cycles;
+            if (buffer->records[id].max_cycles > merged[id].max_cycles) {
+                merged[id].max_cycles = buffer->records[id].max_cycles;
+            }
+        }
+    }
+    const char *path = getenv("VK_LAYER_PHASE_TIMING_FILE");
+    FILE *out = path ? fopen(path, "w") : stderr;
+    if (!out) out = stderr;
+    fprintf(out, "entry_point_phase,count,total_cycles,max_cycles\\n");
+    for (int id = 0; id < InterceptIdCount; ++id) {
+        if (merged[id].count == 0) continue;
+        fprintf(out, "%s,%llu,%llu,%llu\\n", intercept_id_names[id], (unsigned long long)merged[id].count,
+                (unsigned long long)merged[id].total_cycles, (unsigned long long)merged[id].max_cycles);
+    }
+    if (out != stderr) fclose(out);
+}
+
+#endif  // VALIDATION_PHASE_TIMING"""
     #
     #
     def beginFile(self, genOpts):
@@ -1534,10 +2170,16 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         self.newline()
         if not self.header:
             # Record intercepted procedures
-            write('// Map of intercepted ApiName to its associated function data', file=self.outFile)
-            write('const std::unordered_map<std::string, function_data> name_to_funcptr_map = {', file=self.outFile)
+            write('typedef struct {', file=self.outFile)
+            write('    const char* name;', file=self.outFile)
+            write('    function_data data;', file=self.outFile)
+            write('} function_table_entry;', file=self.outFile)
+            self.newline()
+            write('// Table of intercepted ApiNames and their associated function data', file=self.outFile)
+            write('static const function_table_entry name_to_funcptr_table[] = {', file=self.outFile)
             write('\n'.join(self.intercepts), file=self.outFile)
             write('};\n', file=self.outFile)
+            write(self.inline_custom_name_lookup, file=self.outFile)
             self.newline()
             write('} // namespace vulkan_layer_chassis', file=self.outFile)
         if self.header:
@@ -1547,8 +2189,11 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             self.layer_factory += '};\n\n'
             self.layer_factory += 'extern std::unordered_map<void*, ValidationObject*> layer_data_map;'
             write(self.layer_factory, file=self.outFile)
+            write(self.GenerateInterceptIdEnum(), file=self.outFile)
         else:
             write(self.inline_custom_source_postamble, file=self.outFile)
+            write(self.GenerateInitObjectDispatchVectors(), file=self.outFile)
+            write(self.GeneratePhaseTimingSource(), file=self.outFile)
         # Finish processing in superclass
         OutputGenerator.endFile(self)
 
@@ -1650,6 +2295,15 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
             if (self.featureExtraProtect != None):
                 self.layer_factory += '#endif\n'
+            # The InterceptId enum is emitted during the header pass, so mirror the id recording the
+            # source pass performs for generated entry points (manual bodies record their ids separately)
+            if name not in self.manual_functions:
+                self.RecordInterceptId('PreCallValidate%s' % name[2:])
+                self.RecordInterceptId('PreCallRecord%s' % name[2:])
+                self.RecordInterceptId('PostCallRecord%s' % name[2:])
+            else:
+                for hook_name in self.manual_intercept_ids.get(name, ()):
+                    self.RecordInterceptId(hook_name)
             return
 
         is_instance = 'false'
@@ -1658,6 +2312,8 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             is_instance = 'true'
 
         if name in self.manual_functions:
+            for hook_name in self.manual_intercept_ids.get(name, ()):
+                self.RecordInterceptId(hook_name)
             if 'ValidationCache' not in name:
                 self.intercepts += [ '    {"%s", {%s, (void*)%s}},' % (name, is_instance, name[2:]) ]
             else:
@@ -1702,18 +2358,40 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         # Set up skip and locking
         self.appendSection('command', '    bool skip = false;')
 
-        # Generate pre-call validation source code
-        self.appendSection('command', '    %s' % self.precallvalidate_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
-        self.appendSection('command', '        skip |= intercept->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
+        # Generate pre-call validation source code.  Each phase gets a devirtualized fast path for
+        # single-object configurations plus the generic intercept vector loop.
+        self.RecordInterceptId('PreCallValidate%s' % api_function_name[2:])
+        self.appendSection('command', '    VVL_PHASE_BEGIN(InterceptIdPreCallValidate%s);' % api_function_name[2:])
+        self.appendSection('command', '    if (layer_data->fused_object) {')
+        self.appendSection('command', '        VVL_FUSED_DISPATCH(skip |=, layer_data, read_lock(), PreCallValidate%s, (%s));' % (api_function_name[2:], paramstext))
         self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
+        self.appendSection('command', '    } else {')
+        self.appendSection('command', '        %s' % (self.intercept_vector_loop % ('PreCallValidate%s' % api_function_name[2:])))
+        self.appendSection('command', '            auto lock = intercept->read_lock();')
+        self.appendSection('command', '            skip |= intercept->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
+        self.appendSection('command', '            if (skip) %s' % return_map[resulttype.text])
+        self.appendSection('command', '        }')
         self.appendSection('command', '    }')
+        self.appendSection('command', '    VVL_PHASE_END(InterceptIdPreCallValidate%s);' % api_function_name[2:])
+
+        # Commands recording into a VkCommandBuffer lock the command buffer rather than the whole device
+        record_lock_expr = 'write_lock()'
+        if dispatchable_type == 'VkCommandBuffer':
+            record_lock_expr = 'cb_write_lock(%s)' % dispatchable_name
+        record_lock = 'auto lock = intercept->%s;' % record_lock_expr
 
         # Generate pre-call state recording source code
-        self.appendSection('command', '    %s' % self.precallrecord_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
-        self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
+        self.RecordInterceptId('PreCallRecord%s' % api_function_name[2:])
+        self.appendSection('command', '    VVL_PHASE_BEGIN(InterceptIdPreCallRecord%s);' % api_function_name[2:])
+        self.appendSection('command', '    if (layer_data->fused_object) {')
+        self.appendSection('command', '        VVL_FUSED_DISPATCH(, layer_data, %s, PreCallRecord%s, (%s));' % (record_lock_expr, api_function_name[2:], paramstext))
+        self.appendSection('command', '    } else {')
+        self.appendSection('command', '        %s' % (self.intercept_vector_loop % ('PreCallRecord%s' % api_function_name[2:])))
+        self.appendSection('command', '            %s' % record_lock)
+        self.appendSection('command', '            intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
+        self.appendSection('command', '        }')
         self.appendSection('command', '    }')
+        self.appendSection('command', '    VVL_PHASE_END(InterceptIdPreCallRecord%s);' % api_function_name[2:])
 
         # Insert pre-dispatch debug utils function call
         if name in self.pre_dispatch_debug_utils_functions:
@@ -1727,13 +2405,20 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
 
         # Generate post-call object processing source code
-        self.appendSection('command', '    %s' % self.postcallrecord_loop)
+        self.RecordInterceptId('PostCallRecord%s' % api_function_name[2:])
+        self.appendSection('command', '    VVL_PHASE_BEGIN(InterceptIdPostCallRecord%s);' % api_function_name[2:])
         returnparam = ''
         if (resulttype.text == 'VkResult'):
             returnparam = ', result'
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
-        self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
+        self.appendSection('command', '    if (layer_data->fused_object) {')
+        self.appendSection('command', '        VVL_FUSED_DISPATCH(, layer_data, %s, PostCallRecord%s, (%s%s));' % (record_lock_expr, api_function_name[2:], paramstext, returnparam))
+        self.appendSection('command', '    } else {')
+        self.appendSection('command', '        %s' % (self.intercept_vector_loop % ('PostCallRecord%s' % api_function_name[2:])))
+        self.appendSection('command', '            %s' % record_lock)
+        self.appendSection('command', '            intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
+        self.appendSection('command', '        }')
         self.appendSection('command', '    }')
+        self.appendSection('command', '    VVL_PHASE_END(InterceptIdPostCallRecord%s);' % api_function_name[2:])
         # Return result variable, if any.
         if (resulttype.text != 'void'):
             self.appendSection('command', '    return result;')
@@ -149,7 +149,9 @@ class ThreadOutputGenerator(OutputGenerator):
     inline_custom_header_preamble = """
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <vector>
 #include <unordered_set>
@@ -186,10 +188,26 @@ static const char DECORATE_UNUSED *kVUID_Threading_SingleThreadReuse = "UNASSIGN
 
 #undef DECORATE_UNUSED
 
+// Fast-path state for a use entry; see counter<>::StartWrite.  The low two bits encode the
+// mode and the remaining bits carry a compact tag identifying the owning thread.
+static const uint64_t kUseModeMask = 3;
+static const uint64_t kUseNormal = 0;  // counts are exact; all access is under the stripe lock
+static const uint64_t kUseParked = 1;  // entry holds a phantom write use for the owner thread
+static const uint64_t kUseActive = 2;  // the owner thread is inside a call on the object
+
+// Compact per-thread tag for fast_state, assigned on first use and never zero or reused.
+static inline uint64_t GetUseThreadTag() {
+    static std::atomic<uint64_t> next_tag(1);
+    thread_local uint64_t tag = 0;
+    if (tag == 0) tag = next_tag.fetch_add(1) << 2;
+    return tag;
+}
+
 struct object_use_data {
     loader_platform_thread_id thread;
     int reader_count;
     int writer_count;
+    std::atomic<uint64_t> fast_state{kUseNormal};
 };
 
 // This is a wrapper around unordered_map that optimizes for the common case
@@ -248,26 +266,128 @@ public:
     const char *typeName;
     VkDebugReportObjectTypeEXT objectType;
     debug_report_data **report_data;
-    small_unordered_map<T, object_use_data> uses;
-    std::mutex counter_lock;
-    std::condition_variable counter_condition;
+    // Counter state is striped by handle value, so Start/Finish calls on distinct handles from
+    // distinct threads take distinct locks on distinct cache lines.  Each stripe carries its own
+    // condition variable plus a count of waiters, so the Finish paths only pay for a notify when
+    // some thread is actually blocked on a collision.
+    static const int kShardsLog2 = 4;
+    struct alignas(64) CounterShard {
+        small_unordered_map<T, object_use_data *> uses;
+        std::mutex lock;
+        std::condition_variable condition;
+        uint32_t waiter_count = 0;
+        // Use entries are allocated from a per-stripe pool and recycled rather than freed, so a
+        // stale node pointer in some thread's fast-use cache can always be safely inspected --
+        // its tagged fast_state can no longer match once the node is retired or reused.
+        std::vector<std::unique_ptr<object_use_data>> node_pool;
+        std::vector<object_use_data *> free_nodes;
+    };
+    CounterShard shards[1 << kShardsLog2];
+
+    CounterShard &ShardFor(T object) {
+        uint64_t u64 = (uint64_t)(object);
+        uint32_t hash = static_cast<uint32_t>(u64 >> 32) + static_cast<uint32_t>(u64);
+        hash ^= (hash >> kShardsLog2) ^ (hash >> (2 * kShardsLog2));
+        return shards[hash & ((1 << kShardsLog2) - 1)];
+    }
+
+    // Per-thread MRU cache of the entry this thread last parked (see FinishWrite), so a thread
+    // recording thousands of consecutive vkCmd* calls into the same command buffer revalidates
+    // it with a pointer compare and one compare-and-swap instead of a lock and a hash lookup.
+    struct FastUseCache {
+        const void *counter_instance = nullptr;
+        T object = T();
+        object_use_data *node = nullptr;
+    };
+    static FastUseCache &GetFastUseCache() {
+        thread_local FastUseCache cache;
+        return cache;
+    }
+
+    object_use_data *MakeUseData(CounterShard &shard, T object) {
+        object_use_data *node;
+        if (shard.free_nodes.size()) {
+            node = shard.free_nodes.back();
+            shard.free_nodes.pop_back();
+            node->fast_state.store(kUseNormal, std::memory_order_relaxed);
+        } else {
+            shard.node_pool.emplace_back(new object_use_data);
+            node = shard.node_pool.back().get();
+        }
+        shard.uses[object] = node;
+        return node;
+    }
+
+    void EraseUseData(CounterShard &shard, T object) {
+        shard.free_nodes.push_back(shard.uses[object]);
+        shard.uses.erase(object);
+    }
+
+    // Retire a parked phantom write use, or drop an active fast-mode use back to normal locked
+    // bookkeeping, so the logic below always sees exact counts.  Caller holds the stripe lock.
+    void RetireParkedUse(CounterShard &shard, T object) {
+        if (!shard.uses.contains(object)) {
+            return;
+        }
+        object_use_data *use_data = shard.uses[object];
+        uint64_t state = use_data->fast_state.load(std::memory_order_acquire);
+        while ((state & kUseModeMask) != kUseNormal) {
+            if (!use_data->fast_state.compare_exchange_weak(state, kUseNormal, std::memory_order_acq_rel)) {
+                continue;
+            }
+            if ((state & kUseModeMask) == kUseParked) {
+                // The phantom write use is gone; drop the entry if nothing real remains.
+                use_data->writer_count -= 1;
+                if ((use_data->reader_count == 0) && (use_data->writer_count == 0)) {
+                    EraseUseData(shard, object);
+                }
+            }
+            // kUseActive is a real in-flight use by the owner thread; clearing fast mode is
+            // enough, its Finish will now take the locked path.
+            return;
+        }
+    }
 
+    // Retire whatever use this thread still has parked before it parks a new one.  Called before
+    // the new object's stripe lock is taken, so only one stripe lock is ever held at a time.
+    void EvictParkedUse() {
+        FastUseCache &cache = GetFastUseCache();
+        if (cache.counter_instance != this || cache.node == nullptr) {
+            return;
+        }
+        CounterShard &shard = ShardFor(cache.object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        RetireParkedUse(shard, cache.object);
+        cache.counter_instance = nullptr;
+        cache.node = nullptr;
+    }
 
     void StartWrite(T object) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        FastUseCache &cache = GetFastUseCache();
+        if (cache.counter_instance == this && cache.object == object) {
+            // Steady-state path: re-open our own parked write use with a single CAS.
+            uint64_t expected = GetUseThreadTag() | kUseParked;
+            if (cache.node->fast_state.compare_exchange_strong(expected, GetUseThreadTag() | kUseActive,
+                                                               std::memory_order_acq_rel)) {
+                return;
+            }
+        }
         bool skip = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (!uses.contains(object)) {
+        CounterShard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        RetireParkedUse(shard, object);
+        if (!shard.uses.contains(object)) {
             // There is no current use of the object.  Record writer thread.
-            struct object_use_data *use_data = &uses[object];
+            object_use_data *use_data = MakeUseData(shard, object);
             use_data->reader_count = 0;
             use_data->writer_count = 1;
             use_data->thread = tid;
         } else {
-            struct object_use_data *use_data = &uses[object];
+            object_use_data *use_data = shard.uses[object];
             if (use_data->reader_count == 0) {
                 // There are no readers.  Two writers just collided.
                 if (use_data->thread != tid) {
@@ -278,11 +398,13 @@ public:
                         typeName, (uint64_t)use_data->thread, (uint64_t)tid);
                     if (skip) {
                         // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.contains(object)) {
-                            counter_condition.wait(lock);
+                        shard.waiter_count += 1;
+                        while (shard.uses.contains(object)) {
+                            shard.condition.wait(lock);
                         }
+                        shard.waiter_count -= 1;
                         // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
+                        object_use_data *new_use_data = MakeUseData(shard, object);
                         new_use_data->thread = tid;
                         new_use_data->reader_count = 0;
                         new_use_data->writer_count = 1;
@@ -306,11 +428,13 @@ public:
                         typeName, (uint64_t)use_data->thread, (uint64_t)tid);
                     if (skip) {
                         // Wait for thread-safe access to object instead of skipping call.
-                        while (uses.contains(object)) {
-                            counter_condition.wait(lock);
+                        shard.waiter_count += 1;
+                        while (shard.uses.contains(object)) {
+                            shard.condition.wait(lock);
                         }
+                        shard.waiter_count -= 1;
                         // There is now no current use of the object.  Record writer thread.
-                        struct object_use_data *new_use_data = &uses[object];
+                        object_use_data *new_use_data = MakeUseData(shard, object);
                         new_use_data->thread = tid;
                         new_use_data->reader_count = 0;
                         new_use_data->writer_count = 1;
@@ -332,15 +456,44 @@ public:
         if (object == VK_NULL_HANDLE) {
             return;
         }
+        FastUseCache &cache = GetFastUseCache();
+        if (cache.counter_instance == this && cache.object == object) {
+            // Steady-state path: park our write use again with a single CAS.
+            uint64_t expected = GetUseThreadTag() | kUseActive;
+            if (cache.node->fast_state.compare_exchange_strong(expected, GetUseThreadTag() | kUseParked,
+                                                               std::memory_order_acq_rel)) {
+                return;
+            }
+        }
+        // Parking below overwrites the cache slot, so retire any previously parked object first.
+        EvictParkedUse();
         // Object is no longer in use
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].writer_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
+        CounterShard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        RetireParkedUse(shard, object);
+        if (!shard.uses.contains(object)) {
+            return;
+        }
+        object_use_data *use_data = shard.uses[object];
+        use_data->writer_count -= 1;
+        if ((use_data->reader_count == 0) && (use_data->writer_count == 0)) {
+            if (shard.waiter_count == 0) {
+                // Park the entry with a phantom write use instead of erasing it, so the next call
+                // on this object from this thread can re-open it without the lock.
+                use_data->writer_count = 1;
+                use_data->thread = loader_platform_get_thread_id();
+                use_data->fast_state.store(GetUseThreadTag() | kUseParked, std::memory_order_release);
+                cache.counter_instance = this;
+                cache.object = object;
+                cache.node = use_data;
+            } else {
+                EraseUseData(shard, object);
+            }
         }
         // Notify any waiting threads that this object may be safe to use
+        const bool notify = shard.waiter_count > 0;
         lock.unlock();
-        counter_condition.notify_all();
+        if (notify) shard.condition.notify_all();
     }
 
     void StartRead(T object) {
@@ -349,50 +502,61 @@ public:
         }
         bool skip = false;
         loader_platform_thread_id tid = loader_platform_get_thread_id();
-        std::unique_lock<std::mutex> lock(counter_lock);
-        if (!uses.contains(object)) {
+        CounterShard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        RetireParkedUse(shard, object);
+        if (!shard.uses.contains(object)) {
             // There is no current use of the object.  Record reader count
-            struct object_use_data *use_data = &uses[object];
+            object_use_data *use_data = MakeUseData(shard, object);
             use_data->reader_count = 1;
             use_data->writer_count = 0;
             use_data->thread = tid;
-        } else if (uses[object].writer_count > 0 && uses[object].thread != tid) {
+        } else if (shard.uses[object]->writer_count > 0 && shard.uses[object]->thread != tid) {
             // There is a writer of the object.
             skip |= false;
             log_msg(*report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, objectType, (uint64_t)(object), kVUID_Threading_MultipleThreads,
                 "THREADING ERROR : object of type %s is simultaneously used in "
                 "thread 0x%" PRIx64 " and thread 0x%" PRIx64,
-                typeName, (uint64_t)uses[object].thread, (uint64_t)tid);
+                typeName, (uint64_t)shard.uses[object]->thread, (uint64_t)tid);
             if (skip) {
                 // Wait for thread-safe access to object instead of skipping call.
-                while (uses.contains(object)) {
-                    counter_condition.wait(lock);
+                shard.waiter_count += 1;
+                while (shard.uses.contains(object)) {
+                    shard.condition.wait(lock);
                 }
+                shard.waiter_count -= 1;
                 // There is no current use of the object.  Record reader count
-                struct object_use_data *use_data = &uses[object];
+                object_use_data *use_data = MakeUseData(shard, object);
                 use_data->reader_count = 1;
                 use_data->writer_count = 0;
                 use_data->thread = tid;
             } else {
-                uses[object].reader_count += 1;
+                shard.uses[object]->reader_count += 1;
             }
         } else {
             // There are other readers of the object.  Increase reader count
-            uses[object].reader_count += 1;
+            shard.uses[object]->reader_count += 1;
         }
     }
     void FinishRead(T object) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        std::unique_lock<std::mutex> lock(counter_lock);
-        uses[object].reader_count -= 1;
-        if ((uses[object].reader_count == 0) && (uses[object].writer_count == 0)) {
-            uses.erase(object);
+        CounterShard &shard = ShardFor(object);
+        std::unique_lock<std::mutex> lock(shard.lock);
+        RetireParkedUse(shard, object);
+        if (!shard.uses.contains(object)) {
+            return;
+        }
+        object_use_data *use_data = shard.uses[object];
+        use_data->reader_count -= 1;
+        if ((use_data->reader_count == 0) && (use_data->writer_count == 0)) {
+            EraseUseData(shard, object);
         }
         // Notify any waiting threads that this object may be safe to use
+        const bool notify = shard.waiter_count > 0;
         lock.unlock();
-        counter_condition.notify_all();
+        if (notify) shard.condition.notify_all();
     }
     counter(const char *name = "", VkDebugReportObjectTypeEXT type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, debug_report_data **rep_data = nullptr) {
         typeName = name;
@@ -408,8 +572,11 @@ public:
 
     // Override chassis read/write locks for this validation object
     // This override takes a deferred lock. i.e. it is not acquired.
-    std::unique_lock<std::mutex> write_lock() {
-        return std::unique_lock<std::mutex>(validation_object_mutex, std::defer_lock);
+    std::unique_lock<std::shared_timed_mutex> write_lock() {
+        return std::unique_lock<std::shared_timed_mutex>(validation_object_mutex, std::defer_lock);
+    }
+    std::shared_lock<std::shared_timed_mutex> read_lock() {
+        return std::shared_lock<std::shared_timed_mutex>(validation_object_mutex, std::defer_lock);
     }
 
     std::mutex command_pool_lock;
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Shared harness for the layer benchmarks (layer_overhead_benchmarks.cpp and friends): result
+// checking, the minimal SPIR-V module, and the instance/device/descriptor bring-up all of them
+// drive against the mock ICD with the validation layer enabled.
+
+#ifndef LAYER_BENCHMARK_COMMON_H
+#define LAYER_BENCHMARK_COMMON_H
+
+#include <vulkan/vulkan.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#define CHECK_RESULT(expr)                                                              \
+    do {                                                                                \
+        VkResult check_result_ = (expr);                                                \
+        if (check_result_ != VK_SUCCESS) {                                              \
+            fprintf(stderr, "%s failed (%d) at %s:%d\n", #expr, (int)check_result_,     \
+                    __FILE__, __LINE__);                                                \
+            abort();                                                                    \
+        }                                                                               \
+    } while (0)
+
+// Minimal valid vertex shader ("void main() {}"), hand-assembled so the benchmarks do not depend
+// on glslang.  Pipelines built from it enable rasterizer discard, so no fragment stage is needed.
+static const uint32_t kMinimalVertSpv[] = {
+    0x07230203, 0x00010000, 0x00000000, 0x00000006, 0x00000000,  // header, bound = 6
+    0x00020011, 0x00000001,                                      // OpCapability Shader
+    0x0003000e, 0x00000000, 0x00000001,                          // OpMemoryModel Logical GLSL450
+    0x0005000f, 0x00000000, 0x00000004, 0x6e69616d, 0x00000000,  // OpEntryPoint Vertex %4 "main"
+    0x00020013, 0x00000002,                                      // %2 = OpTypeVoid
+    0x00030021, 0x00000003, 0x00000002,                          // %3 = OpTypeFunction %2
+    0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003,  // %4 = OpFunction %2 None %3
+    0x000200f8, 0x00000005,                                      // %5 = OpLabel
+    0x000100fd,                                                  // OpReturn
+    0x00010038,                                                  // OpFunctionEnd
+};
+
+// Instance and device bring-up common to every benchmark: an instance with the validation layer
+// enabled, the first physical device (the mock ICD's), its first graphics-capable queue family,
+// and one device with one queue.  The destructor runs after any derived context's, so derived
+// classes only clean up the objects they added.
+struct BenchmarkDeviceBase {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkPhysicalDevice gpu = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    VkQueue queue = VK_NULL_HANDLE;
+    uint32_t queue_family = 0;
+
+    explicit BenchmarkDeviceBase(const char *app_name) {
+        const char *layer_name = "VK_LAYER_KHRONOS_validation";
+        VkApplicationInfo app_info = {};
+        app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+        app_info.pApplicationName = app_name;
+        app_info.apiVersion = VK_API_VERSION_1_1;
+        VkInstanceCreateInfo instance_info = {};
+        instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+        instance_info.pApplicationInfo = &app_info;
+        instance_info.enabledLayerCount = 1;
+        instance_info.ppEnabledLayerNames = &layer_name;
+        CHECK_RESULT(vkCreateInstance(&instance_info, nullptr, &instance));
+
+        uint32_t gpu_count = 1;
+        VkResult result = vkEnumeratePhysicalDevices(instance, &gpu_count, &gpu);
+        if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || gpu_count == 0) {
+            fprintf(stderr, "No physical device; set VK_ICD_FILENAMES to the mock ICD manifest\n");
+            abort();
+        }
+
+        uint32_t family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, nullptr);
+        std::vector<VkQueueFamilyProperties> families(family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(gpu, &family_count, families.data());
+        for (uint32_t i = 0; i < family_count; ++i) {
+            if (families[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) {
+                queue_family = i;
+                break;
+            }
+        }
+
+        float priority = 1.0f;
+        VkDeviceQueueCreateInfo queue_info = {};
+        queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queue_info.queueFamilyIndex = queue_family;
+        queue_info.queueCount = 1;
+        queue_info.pQueuePriorities = &priority;
+        VkDeviceCreateInfo device_info = {};
+        device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        device_info.queueCreateInfoCount = 1;
+        device_info.pQueueCreateInfos = &queue_info;
+        CHECK_RESULT(vkCreateDevice(gpu, &device_info, nullptr, &device));
+        vkGetDeviceQueue(device, queue_family, 0, &queue);
+    }
+
+    ~BenchmarkDeviceBase() {
+        vkDestroyDevice(device, nullptr);
+        vkDestroyInstance(instance, nullptr);
+    }
+};
+
+// Number of descriptor sets BenchmarkContext allocates and binds per vkCmdBindDescriptorSets
+static const uint32_t kDescriptorSetCount = 4;
+
+// Shared device-level state for the recording benchmarks, built once for all threads of a
+// benchmark run: a pipeline layout with kDescriptorSetCount uniform-buffer sets (allocated and
+// written), a zero-attachment render pass and framebuffer, and a rasterizer-discard pipeline
+struct BenchmarkContext : BenchmarkDeviceBase {
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkDescriptorSet descriptor_sets[kDescriptorSetCount] = {};
+    VkBuffer uniform_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory uniform_memory = VK_NULL_HANDLE;
+
+    VkShaderModule vert_module = VK_NULL_HANDLE;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    VkPipeline pipeline = VK_NULL_HANDLE;
+
+    explicit BenchmarkContext(const char *app_name) : BenchmarkDeviceBase(app_name) {
+        CreateDescriptorState();
+        CreatePipelineState();
+    }
+
+    void CreateDescriptorState() {
+        VkDescriptorSetLayoutBinding binding = {};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        VkDescriptorSetLayoutCreateInfo layout_info = {};
+        layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layout_info.bindingCount = 1;
+        layout_info.pBindings = &binding;
+        CHECK_RESULT(vkCreateDescriptorSetLayout(device, &layout_info, nullptr, &set_layout));
+
+        VkDescriptorSetLayout set_layouts[kDescriptorSetCount];
+        for (uint32_t i = 0; i < kDescriptorSetCount; ++i) set_layouts[i] = set_layout;
+        VkPipelineLayoutCreateInfo pipeline_layout_info = {};
+        pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_info.setLayoutCount = kDescriptorSetCount;
+        pipeline_layout_info.pSetLayouts = set_layouts;
+        CHECK_RESULT(vkCreatePipelineLayout(device, &pipeline_layout_info, nullptr, &pipeline_layout));
+
+        VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kDescriptorSetCount};
+        VkDescriptorPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        pool_info.maxSets = kDescriptorSetCount;
+        pool_info.poolSizeCount = 1;
+        pool_info.pPoolSizes = &pool_size;
+        CHECK_RESULT(vkCreateDescriptorPool(device, &pool_info, nullptr, &descriptor_pool));
+
+        VkDescriptorSetAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        alloc_info.descriptorPool = descriptor_pool;
+        alloc_info.descriptorSetCount = kDescriptorSetCount;
+        alloc_info.pSetLayouts = set_layouts;
+        CHECK_RESULT(vkAllocateDescriptorSets(device, &alloc_info, descriptor_sets));
+
+        VkBufferCreateInfo buffer_info = {};
+        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_info.size = 256;
+        buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        CHECK_RESULT(vkCreateBuffer(device, &buffer_info, nullptr, &uniform_buffer));
+        VkMemoryRequirements reqs;
+        vkGetBufferMemoryRequirements(device, uniform_buffer, &reqs);
+        VkMemoryAllocateInfo mem_info = {};
+        mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        mem_info.allocationSize = reqs.size ? reqs.size : 256;
+        CHECK_RESULT(vkAllocateMemory(device, &mem_info, nullptr, &uniform_memory));
+        CHECK_RESULT(vkBindBufferMemory(device, uniform_buffer, uniform_memory, 0));
+
+        VkDescriptorBufferInfo descriptor_buffer = {uniform_buffer, 0, VK_WHOLE_SIZE};
+        VkWriteDescriptorSet writes[kDescriptorSetCount] = {};
+        for (uint32_t i = 0; i < kDescriptorSetCount; ++i) {
+            writes[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[i].dstSet = descriptor_sets[i];
+            writes[i].dstBinding = 0;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[i].pBufferInfo = &descriptor_buffer;
+        }
+        vkUpdateDescriptorSets(device, kDescriptorSetCount, writes, 0, nullptr);
+    }
+
+    void CreatePipelineState() {
+        VkShaderModuleCreateInfo module_info = {};
+        module_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        module_info.codeSize = sizeof(kMinimalVertSpv);
+        module_info.pCode = kMinimalVertSpv;
+        CHECK_RESULT(vkCreateShaderModule(device, &module_info, nullptr, &vert_module));
+
+        // Zero-attachment render pass and framebuffer, just enough to put a command buffer inside
+        // a render pass instance for vkCmdDraw
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        VkRenderPassCreateInfo rp_info = {};
+        rp_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        rp_info.subpassCount = 1;
+        rp_info.pSubpasses = &subpass;
+        CHECK_RESULT(vkCreateRenderPass(device, &rp_info, nullptr, &render_pass));
+
+        VkFramebufferCreateInfo fb_info = {};
+        fb_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        fb_info.renderPass = render_pass;
+        fb_info.width = 64;
+        fb_info.height = 64;
+        fb_info.layers = 1;
+        CHECK_RESULT(vkCreateFramebuffer(device, &fb_info, nullptr, &framebuffer));
+
+        CHECK_RESULT(CreatePipeline(&pipeline));
+    }
+
+    VkResult CreatePipeline(VkPipeline *out_pipeline) const {
+        VkPipelineShaderStageCreateInfo stage = {};
+        stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stage.module = vert_module;
+        stage.pName = "main";
+
+        VkPipelineVertexInputStateCreateInfo vertex_input = {};
+        vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+        input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        VkPipelineRasterizationStateCreateInfo rasterization = {};
+        rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterization.rasterizerDiscardEnable = VK_TRUE;
+        rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization.cullMode = VK_CULL_MODE_BACK_BIT;
+        rasterization.frontFace = VK_FRONT_FACE_CLOCKWISE;
+        rasterization.lineWidth = 1.0f;
+
+        VkGraphicsPipelineCreateInfo pipeline_info = {};
+        pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipeline_info.stageCount = 1;
+        pipeline_info.pStages = &stage;
+        pipeline_info.pVertexInputState = &vertex_input;
+        pipeline_info.pInputAssemblyState = &input_assembly;
+        pipeline_info.pRasterizationState = &rasterization;
+        pipeline_info.layout = pipeline_layout;
+        pipeline_info.renderPass = render_pass;
+        return vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, out_pipeline);
+    }
+
+    ~BenchmarkContext() {
+        vkDestroyPipeline(device, pipeline, nullptr);
+        vkDestroyFramebuffer(device, framebuffer, nullptr);
+        vkDestroyRenderPass(device, render_pass, nullptr);
+        vkDestroyShaderModule(device, vert_module, nullptr);
+        vkDestroyBuffer(device, uniform_buffer, nullptr);
+        vkFreeMemory(device, uniform_memory, nullptr);
+        vkDestroyDescriptorPool(device, descriptor_pool, nullptr);
+        vkDestroyPipelineLayout(device, pipeline_layout, nullptr);
+        vkDestroyDescriptorSetLayout(device, set_layout, nullptr);
+    }
+};
+
+#endif  // LAYER_BENCHMARK_COMMON_H
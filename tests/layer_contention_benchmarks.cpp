@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Multithreaded contention benchmarks for the validation layer stack.
+//
+// Where layer_overhead_benchmarks.cpp measures ns/call, these measure how per-thread throughput
+// scales when N threads record command streams into separate command pools through the real layer
+// stack -- the pattern our scalability work (thread_safety counters, the handle-wrapping
+// unique_id_mapping, the chassis device lock) is supposed to serve.  Each benchmark runs from 1 to
+// 16 threads; google-benchmark reports per-thread time, and the "lock_wait_frac" counter is the
+// fraction of wall time the thread spent off-CPU (wall minus thread CPU time), which under a null
+// driver is almost entirely time blocked on layer-internal locks.  A scalability regression shows
+// up as per-thread time growing with the thread count and lock_wait_frac climbing.
+//
+// Run against the mock ICD from VulkanTools, e.g.:
+//
+//     VK_ICD_FILENAMES=/path/to/VkICD_mock_icd.json \
+//     VK_LAYER_PATH=<build>/layers \
+//     ./vk_layer_contention_benchmarks
+//
+// Build with -DBUILD_BENCHMARKS=ON (requires google-benchmark).
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <map>
+#include <mutex>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#include "layer_benchmark_common.h"
+
+namespace {
+
+// CPU time consumed by the calling thread, in seconds.  The difference between wall time and this
+// is time the thread spent blocked (for these benchmarks: waiting on layer locks).
+double ThreadCpuSeconds() {
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) return 0.0;
+    ULARGE_INTEGER k, u;
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return (k.QuadPart + u.QuadPart) * 100e-9;
+#else
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return 0.0;
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+// Per-thread recording state: each thread records into its own command pool, the externally
+// synchronized pattern the layer is supposed to let scale
+struct ThreadStream {
+    const BenchmarkContext *ctx = nullptr;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+    uint32_t recorded_batches = 0;
+    bool in_render_pass = false;
+
+    static const uint32_t kResetInterval = 64;  // batches between command buffer resets
+
+    void Init(const BenchmarkContext *context) {
+        ctx = context;
+        VkCommandPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_info.queueFamilyIndex = ctx->queue_family;
+        CHECK_RESULT(vkCreateCommandPool(ctx->device, &pool_info, nullptr, &pool));
+        VkCommandBufferAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.commandPool = pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        CHECK_RESULT(vkAllocateCommandBuffers(ctx->device, &alloc_info, &cb));
+    }
+
+    void Begin(bool render_pass) {
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        CHECK_RESULT(vkBeginCommandBuffer(cb, &begin_info));
+        if (render_pass) {
+            VkRenderPassBeginInfo rp_begin = {};
+            rp_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            rp_begin.renderPass = ctx->render_pass;
+            rp_begin.framebuffer = ctx->framebuffer;
+            rp_begin.renderArea.extent = {64, 64};
+            vkCmdBeginRenderPass(cb, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+        }
+        in_render_pass = render_pass;
+        recorded_batches = 0;
+    }
+
+    void BatchRecorded() {
+        if (++recorded_batches < kResetInterval) return;
+        if (in_render_pass) vkCmdEndRenderPass(cb);
+        CHECK_RESULT(vkEndCommandBuffer(cb));
+        CHECK_RESULT(vkResetCommandBuffer(cb, 0));
+        Begin(in_render_pass);
+    }
+
+    void End() {
+        if (in_render_pass) vkCmdEndRenderPass(cb);
+        CHECK_RESULT(vkEndCommandBuffer(cb));
+        CHECK_RESULT(vkResetCommandBuffer(cb, 0));
+    }
+
+    void Destroy() {
+        if (pool != VK_NULL_HANDLE) vkDestroyCommandPool(ctx->device, pool, nullptr);
+        pool = VK_NULL_HANDLE;
+        cb = VK_NULL_HANDLE;
+    }
+};
+
+// All threads share one BenchmarkContext and bind the same pipeline, layout, and descriptor
+// sets, so the thread_safety read counters and the wrapping map are probed with shared handles
+// -- the worst case for the layer's internal synchronization.
+class LayerContention : public benchmark::Fixture {
+  public:
+    void SetUp(const benchmark::State &state) override {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (ref_count_++ == 0) ctx_ = new BenchmarkContext("vk_layer_contention_benchmarks");
+        streams_[state.thread_index].Init(ctx_);
+    }
+
+    void TearDown(const benchmark::State &state) override {
+        std::lock_guard<std::mutex> guard(lock_);
+        streams_[state.thread_index].Destroy();
+        if (--ref_count_ == 0) {
+            delete ctx_;
+            ctx_ = nullptr;
+            streams_.clear();
+        }
+    }
+
+    ThreadStream &Stream(const benchmark::State &state) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return streams_[state.thread_index];
+    }
+
+  protected:
+    static std::mutex lock_;
+    static BenchmarkContext *ctx_;
+    static int ref_count_;
+    static std::map<int, ThreadStream> streams_;
+};
+
+std::mutex LayerContention::lock_;
+BenchmarkContext *LayerContention::ctx_ = nullptr;
+int LayerContention::ref_count_ = 0;
+std::map<int, ThreadStream> LayerContention::streams_;
+
+// Wall/CPU bracketing for one thread of a benchmark loop; reports the blocked-time fraction
+struct LockWaitProbe {
+    std::chrono::steady_clock::time_point wall_start = std::chrono::steady_clock::now();
+    double cpu_start = ThreadCpuSeconds();
+
+    void Report(benchmark::State &state) const {
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+        const double cpu = ThreadCpuSeconds() - cpu_start;
+        state.counters["lock_wait_frac"] = (wall > 0.0) ? std::max(0.0, (wall - cpu) / wall) : 0.0;
+    }
+};
+
+}  // namespace
+
+// Command recording proper: a draw-style batch (bind pipeline, bind sets, several draws) per
+// iteration, all handles shared between threads.  This is the stream whose per-call dispatch
+// crosses thread_safety's counters and the wrapping map on every handle argument.
+BENCHMARK_DEFINE_F(LayerContention, CmdDrawStream)(benchmark::State &state) {
+    ThreadStream &stream = Stream(state);
+    stream.Begin(true);
+    LockWaitProbe probe;
+    for (auto _ : state) {
+        vkCmdBindPipeline(stream.cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx_->pipeline);
+        vkCmdBindDescriptorSets(stream.cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx_->pipeline_layout, 0, kDescriptorSetCount,
+                                ctx_->descriptor_sets, 0, nullptr);
+        for (int draw = 0; draw < 4; ++draw) {
+            vkCmdDraw(stream.cb, 3, 1, 0, 0);
+        }
+        stream.BatchRecorded();
+    }
+    probe.Report(state);
+    state.SetItemsProcessed(state.iterations() * 6);  // six vkCmd* calls per iteration
+    stream.End();
+}
+BENCHMARK_REGISTER_F(LayerContention, CmdDrawStream)->ThreadRange(1, 16)->UseRealTime();
+
+// Bind-only stream: maximizes handle-argument density (layout plus four sets per call), so the
+// per-call cost is dominated by unwrap lookups and state-object resolution rather than draw
+// validation
+BENCHMARK_DEFINE_F(LayerContention, CmdBindStream)(benchmark::State &state) {
+    ThreadStream &stream = Stream(state);
+    stream.Begin(false);
+    LockWaitProbe probe;
+    for (auto _ : state) {
+        vkCmdBindDescriptorSets(stream.cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx_->pipeline_layout, 0, kDescriptorSetCount,
+                                ctx_->descriptor_sets, 0, nullptr);
+        stream.BatchRecorded();
+    }
+    probe.Report(state);
+    state.SetItemsProcessed(state.iterations());
+    stream.End();
+}
+BENCHMARK_REGISTER_F(LayerContention, CmdBindStream)->ThreadRange(1, 16)->UseRealTime();
+
+// Command buffer allocate/free churn from per-thread pools.  The pools are externally
+// synchronized per thread, but every allocation and free crosses the device-scope maps and the
+// wrapping id allocator, so this isolates create/destroy-path lock contention from recording.
+BENCHMARK_DEFINE_F(LayerContention, CommandBufferAllocFree)(benchmark::State &state) {
+    ThreadStream &stream = Stream(state);
+    VkCommandBufferAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = stream.pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = 1;
+    LockWaitProbe probe;
+    for (auto _ : state) {
+        VkCommandBuffer cb = VK_NULL_HANDLE;
+        CHECK_RESULT(vkAllocateCommandBuffers(ctx_->device, &alloc_info, &cb));
+        vkFreeCommandBuffers(ctx_->device, stream.pool, 1, &cb);
+    }
+    probe.Report(state);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(LayerContention, CommandBufferAllocFree)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
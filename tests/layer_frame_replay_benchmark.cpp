@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Draw-heavy frame replay harness for CoreChecks overhead.
+//
+// Microbenchmarks of single entry points miss state-dependent cost: what a vkCmdDraw costs in
+// ValidateCmdBufDrawState depends on the bound descriptor sets, the render pass, and the
+// pipeline.  This harness records a parameterized synthetic frame -- P pipelines x S descriptor
+// sets x D draws, with sets holding both buffer and sampled-image descriptors -- and replays it
+// through the layer stack every iteration, reporting ms/frame plus a per-phase breakdown
+// (record vs submit) as counters.  It is the acceptance workload for changes to
+// drawdispatch.cpp and descriptor_sets.cpp: run it before and after on the same parameters.
+//
+// Run against the mock ICD from VulkanTools, e.g.:
+//
+//     VK_ICD_FILENAMES=/path/to/VkICD_mock_icd.json \
+//     VK_LAYER_PATH=<build>/layers \
+//     ./vk_layer_frame_replay_benchmark
+//
+// Build with -DBUILD_BENCHMARKS=ON (requires google-benchmark).
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+#include "layer_benchmark_common.h"
+
+namespace {
+
+// One synthetic frame's worth of state: P pipelines, S descriptor sets (each with a uniform
+// buffer and a sampled image, so draw validation exercises both the buffer and image paths plus
+// image layout checks), one render pass, one command buffer.
+class FrameReplayContext : public BenchmarkDeviceBase {
+  public:
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+    VkPipelineLayout pipeline_layout = VK_NULL_HANDLE;
+    VkDescriptorPool descriptor_pool = VK_NULL_HANDLE;
+    VkSampler sampler = VK_NULL_HANDLE;
+    VkBuffer uniform_buffer = VK_NULL_HANDLE;
+    VkDeviceMemory uniform_memory = VK_NULL_HANDLE;
+
+    VkShaderModule vert_module = VK_NULL_HANDLE;
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+
+    std::vector<VkPipeline> pipelines;
+    std::vector<VkDescriptorSet> descriptor_sets;
+    std::vector<VkImage> images;
+    std::vector<VkDeviceMemory> image_memories;
+    std::vector<VkImageView> image_views;
+
+    FrameReplayContext(uint32_t pipeline_count, uint32_t set_count)
+        : BenchmarkDeviceBase("vk_layer_frame_replay_benchmark") {
+        CreateDescriptorState(set_count);
+        CreateRenderState();
+        CreatePipelines(pipeline_count);
+        TransitionImages();
+    }
+
+    void CreateDescriptorState(uint32_t set_count) {
+        VkDescriptorSetLayoutBinding bindings[2] = {};
+        bindings[0].binding = 0;
+        bindings[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        bindings[0].descriptorCount = 1;
+        bindings[0].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        bindings[1].binding = 1;
+        bindings[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        bindings[1].descriptorCount = 1;
+        bindings[1].stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        VkDescriptorSetLayoutCreateInfo layout_info = {};
+        layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layout_info.bindingCount = 2;
+        layout_info.pBindings = bindings;
+        CHECK_RESULT(vkCreateDescriptorSetLayout(device, &layout_info, nullptr, &set_layout));
+
+        VkPipelineLayoutCreateInfo pipeline_layout_info = {};
+        pipeline_layout_info.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        pipeline_layout_info.setLayoutCount = 1;
+        pipeline_layout_info.pSetLayouts = &set_layout;
+        CHECK_RESULT(vkCreatePipelineLayout(device, &pipeline_layout_info, nullptr, &pipeline_layout));
+
+        VkDescriptorPoolSize pool_sizes[2] = {
+            {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, set_count},
+            {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, set_count},
+        };
+        VkDescriptorPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        pool_info.maxSets = set_count;
+        pool_info.poolSizeCount = 2;
+        pool_info.pPoolSizes = pool_sizes;
+        CHECK_RESULT(vkCreateDescriptorPool(device, &pool_info, nullptr, &descriptor_pool));
+
+        std::vector<VkDescriptorSetLayout> set_layouts(set_count, set_layout);
+        descriptor_sets.resize(set_count);
+        VkDescriptorSetAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        alloc_info.descriptorPool = descriptor_pool;
+        alloc_info.descriptorSetCount = set_count;
+        alloc_info.pSetLayouts = set_layouts.data();
+        CHECK_RESULT(vkAllocateDescriptorSets(device, &alloc_info, descriptor_sets.data()));
+
+        VkBufferCreateInfo buffer_info = {};
+        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_info.size = 256;
+        buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        CHECK_RESULT(vkCreateBuffer(device, &buffer_info, nullptr, &uniform_buffer));
+        VkMemoryRequirements reqs;
+        vkGetBufferMemoryRequirements(device, uniform_buffer, &reqs);
+        VkMemoryAllocateInfo mem_info = {};
+        mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        mem_info.allocationSize = reqs.size ? reqs.size : 256;
+        CHECK_RESULT(vkAllocateMemory(device, &mem_info, nullptr, &uniform_memory));
+        CHECK_RESULT(vkBindBufferMemory(device, uniform_buffer, uniform_memory, 0));
+
+        VkSamplerCreateInfo sampler_info = {};
+        sampler_info.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        sampler_info.magFilter = VK_FILTER_NEAREST;
+        sampler_info.minFilter = VK_FILTER_NEAREST;
+        sampler_info.maxLod = 1.0f;
+        CHECK_RESULT(vkCreateSampler(device, &sampler_info, nullptr, &sampler));
+
+        // One sampled image per descriptor set, so each set's draw validation touches a distinct
+        // image's layout state
+        images.resize(set_count);
+        image_memories.resize(set_count);
+        image_views.resize(set_count);
+        for (uint32_t i = 0; i < set_count; ++i) {
+            VkImageCreateInfo image_info = {};
+            image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+            image_info.imageType = VK_IMAGE_TYPE_2D;
+            image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            image_info.extent = {16, 16, 1};
+            image_info.mipLevels = 1;
+            image_info.arrayLayers = 1;
+            image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+            image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+            image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+            image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            CHECK_RESULT(vkCreateImage(device, &image_info, nullptr, &images[i]));
+            VkMemoryRequirements image_reqs;
+            vkGetImageMemoryRequirements(device, images[i], &image_reqs);
+            VkMemoryAllocateInfo image_mem_info = {};
+            image_mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+            image_mem_info.allocationSize = image_reqs.size ? image_reqs.size : 4096;
+            CHECK_RESULT(vkAllocateMemory(device, &image_mem_info, nullptr, &image_memories[i]));
+            CHECK_RESULT(vkBindImageMemory(device, images[i], image_memories[i], 0));
+
+            VkImageViewCreateInfo view_info = {};
+            view_info.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            view_info.image = images[i];
+            view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            view_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+            CHECK_RESULT(vkCreateImageView(device, &view_info, nullptr, &image_views[i]));
+        }
+
+        VkDescriptorBufferInfo descriptor_buffer = {uniform_buffer, 0, VK_WHOLE_SIZE};
+        for (uint32_t i = 0; i < set_count; ++i) {
+            VkDescriptorImageInfo descriptor_image = {sampler, image_views[i], VK_IMAGE_LAYOUT_GENERAL};
+            VkWriteDescriptorSet writes[2] = {};
+            writes[0].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[0].dstSet = descriptor_sets[i];
+            writes[0].dstBinding = 0;
+            writes[0].descriptorCount = 1;
+            writes[0].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[0].pBufferInfo = &descriptor_buffer;
+            writes[1].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[1].dstSet = descriptor_sets[i];
+            writes[1].dstBinding = 1;
+            writes[1].descriptorCount = 1;
+            writes[1].descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            writes[1].pImageInfo = &descriptor_image;
+            vkUpdateDescriptorSets(device, 2, writes, 0, nullptr);
+        }
+    }
+
+    void CreateRenderState() {
+        VkShaderModuleCreateInfo module_info = {};
+        module_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        module_info.codeSize = sizeof(kMinimalVertSpv);
+        module_info.pCode = kMinimalVertSpv;
+        CHECK_RESULT(vkCreateShaderModule(device, &module_info, nullptr, &vert_module));
+
+        VkSubpassDescription subpass = {};
+        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        VkRenderPassCreateInfo rp_info = {};
+        rp_info.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        rp_info.subpassCount = 1;
+        rp_info.pSubpasses = &subpass;
+        CHECK_RESULT(vkCreateRenderPass(device, &rp_info, nullptr, &render_pass));
+
+        VkFramebufferCreateInfo fb_info = {};
+        fb_info.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        fb_info.renderPass = render_pass;
+        fb_info.width = 64;
+        fb_info.height = 64;
+        fb_info.layers = 1;
+        CHECK_RESULT(vkCreateFramebuffer(device, &fb_info, nullptr, &framebuffer));
+
+        VkCommandPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_info.queueFamilyIndex = queue_family;
+        CHECK_RESULT(vkCreateCommandPool(device, &pool_info, nullptr, &pool));
+        VkCommandBufferAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.commandPool = pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        CHECK_RESULT(vkAllocateCommandBuffers(device, &alloc_info, &cb));
+    }
+
+    void CreatePipelines(uint32_t pipeline_count) {
+        VkPipelineShaderStageCreateInfo stage = {};
+        stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+        stage.module = vert_module;
+        stage.pName = "main";
+        VkPipelineVertexInputStateCreateInfo vertex_input = {};
+        vertex_input.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+        VkPipelineInputAssemblyStateCreateInfo input_assembly = {};
+        input_assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+        input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        VkPipelineRasterizationStateCreateInfo rasterization = {};
+        rasterization.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+        rasterization.rasterizerDiscardEnable = VK_TRUE;
+        rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+        rasterization.cullMode = VK_CULL_MODE_BACK_BIT;
+        rasterization.frontFace = VK_FRONT_FACE_CLOCKWISE;
+        rasterization.lineWidth = 1.0f;
+        VkGraphicsPipelineCreateInfo pipeline_info = {};
+        pipeline_info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        pipeline_info.stageCount = 1;
+        pipeline_info.pStages = &stage;
+        pipeline_info.pVertexInputState = &vertex_input;
+        pipeline_info.pInputAssemblyState = &input_assembly;
+        pipeline_info.pRasterizationState = &rasterization;
+        pipeline_info.layout = pipeline_layout;
+        pipeline_info.renderPass = render_pass;
+
+        pipelines.resize(pipeline_count);
+        for (uint32_t i = 0; i < pipeline_count; ++i) {
+            CHECK_RESULT(vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, nullptr, &pipelines[i]));
+        }
+    }
+
+    // One-time transition of every sampled image to GENERAL so the descriptor layout matches the
+    // tracked layout and frame replay stays free of validation errors (and their logging cost)
+    void TransitionImages() {
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        CHECK_RESULT(vkBeginCommandBuffer(cb, &begin_info));
+        std::vector<VkImageMemoryBarrier> barriers(images.size());
+        for (size_t i = 0; i < images.size(); ++i) {
+            barriers[i].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barriers[i].srcAccessMask = 0;
+            barriers[i].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+            barriers[i].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            barriers[i].newLayout = VK_IMAGE_LAYOUT_GENERAL;
+            barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barriers[i].image = images[i];
+            barriers[i].subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        }
+        vkCmdPipelineBarrier(cb, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 0, nullptr, 0,
+                             nullptr, static_cast<uint32_t>(barriers.size()), barriers.data());
+        CHECK_RESULT(vkEndCommandBuffer(cb));
+        VkSubmitInfo submit = {};
+        submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submit.commandBufferCount = 1;
+        submit.pCommandBuffers = &cb;
+        CHECK_RESULT(vkQueueSubmit(queue, 1, &submit, VK_NULL_HANDLE));
+        vkQueueWaitIdle(queue);
+        CHECK_RESULT(vkResetCommandBuffer(cb, 0));
+    }
+
+    ~FrameReplayContext() {
+        for (auto pipeline : pipelines) vkDestroyPipeline(device, pipeline, nullptr);
+        for (auto view : image_views) vkDestroyImageView(device, view, nullptr);
+        for (auto image : images) vkDestroyImage(device, image, nullptr);
+        for (auto memory : image_memories) vkFreeMemory(device, memory, nullptr);
+        vkDestroyCommandPool(device, pool, nullptr);
+        vkDestroyFramebuffer(device, framebuffer, nullptr);
+        vkDestroyRenderPass(device, render_pass, nullptr);
+        vkDestroyShaderModule(device, vert_module, nullptr);
+        vkDestroySampler(device, sampler, nullptr);
+        vkDestroyBuffer(device, uniform_buffer, nullptr);
+        vkFreeMemory(device, uniform_memory, nullptr);
+        vkDestroyDescriptorPool(device, descriptor_pool, nullptr);
+        vkDestroyPipelineLayout(device, pipeline_layout, nullptr);
+        vkDestroyDescriptorSetLayout(device, set_layout, nullptr);
+    }
+};
+
+}  // namespace
+
+// One iteration == one frame: record D draws cycling through P pipelines and S descriptor sets,
+// submit, wait.  Time per iteration is ms/frame; the record_ms and submit_ms counters break that
+// down per phase (averaged over iterations).
+static void FrameReplay(benchmark::State &state) {
+    const uint32_t pipeline_count = static_cast<uint32_t>(state.range(0));
+    const uint32_t set_count = static_cast<uint32_t>(state.range(1));
+    const uint32_t draw_count = static_cast<uint32_t>(state.range(2));
+    FrameReplayContext ctx(pipeline_count, set_count);
+
+    using Clock = std::chrono::steady_clock;
+    double record_seconds = 0.0;
+    double submit_seconds = 0.0;
+
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    VkRenderPassBeginInfo rp_begin = {};
+    rp_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    rp_begin.renderPass = ctx.render_pass;
+    rp_begin.framebuffer = ctx.framebuffer;
+    rp_begin.renderArea.extent = {64, 64};
+    VkSubmitInfo submit = {};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &ctx.cb;
+
+    for (auto _ : state) {
+        const Clock::time_point record_start = Clock::now();
+        CHECK_RESULT(vkBeginCommandBuffer(ctx.cb, &begin_info));
+        vkCmdBeginRenderPass(ctx.cb, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+        uint32_t pipeline_index = pipeline_count;  // force a bind on the first draw
+        uint32_t set_index = set_count;
+        for (uint32_t draw = 0; draw < draw_count; ++draw) {
+            // Cycle pipelines and sets at different strides so most draws rebind something,
+            // matching the shape of a real sorted draw loop
+            const uint32_t want_pipeline = draw % pipeline_count;
+            const uint32_t want_set = (draw / 2) % set_count;
+            if (want_pipeline != pipeline_index) {
+                vkCmdBindPipeline(ctx.cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx.pipelines[want_pipeline]);
+                pipeline_index = want_pipeline;
+            }
+            if (want_set != set_index) {
+                vkCmdBindDescriptorSets(ctx.cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx.pipeline_layout, 0, 1,
+                                        &ctx.descriptor_sets[want_set], 0, nullptr);
+                set_index = want_set;
+            }
+            vkCmdDraw(ctx.cb, 3, 1, 0, 0);
+        }
+        vkCmdEndRenderPass(ctx.cb);
+        CHECK_RESULT(vkEndCommandBuffer(ctx.cb));
+        const Clock::time_point submit_start = Clock::now();
+        CHECK_RESULT(vkQueueSubmit(ctx.queue, 1, &submit, VK_NULL_HANDLE));
+        vkQueueWaitIdle(ctx.queue);
+        const Clock::time_point frame_end = Clock::now();
+        CHECK_RESULT(vkResetCommandBuffer(ctx.cb, 0));
+
+        record_seconds += std::chrono::duration<double>(submit_start - record_start).count();
+        submit_seconds += std::chrono::duration<double>(frame_end - submit_start).count();
+    }
+
+    const double frames = static_cast<double>(state.iterations() ? state.iterations() : 1);
+    state.counters["record_ms"] = 1e3 * record_seconds / frames;
+    state.counters["submit_ms"] = 1e3 * submit_seconds / frames;
+    state.counters["draws_per_s"] =
+        benchmark::Counter(static_cast<double>(state.iterations()) * draw_count, benchmark::Counter::kIsRate);
+}
+// Args: {pipelines P, descriptor sets S, draws D}.  The first entry is the standard acceptance
+// workload; the others bracket it with a small-state and a large-state frame.
+BENCHMARK(FrameReplay)
+    ->Args({16, 64, 2000})
+    ->Args({4, 8, 500})
+    ->Args({64, 256, 8000})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
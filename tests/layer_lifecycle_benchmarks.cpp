@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Object lifecycle churn benchmarks for the validation layer stack.
+//
+// Streaming-style engines create and destroy thousands of buffers, views, and descriptor sets a
+// second; on that path layer overhead is dominated by map insert/erase and state-object
+// allocation in ObjectLifetimes and ValidationStateTracker rather than per-call validation.
+// These benchmarks measure creates+destroys/sec per handle type through the real layer stack
+// against a null driver, single-threaded and with several threads churning concurrently, so the
+// slot-map and shard work has an acceptance metric.  The reported items/sec is
+// create+destroy pairs per second (per thread for the multithreaded variants).
+//
+// Run against the mock ICD from VulkanTools, e.g.:
+//
+//     VK_ICD_FILENAMES=/path/to/VkICD_mock_icd.json \
+//     VK_LAYER_PATH=<build>/layers \
+//     ./vk_layer_lifecycle_benchmarks
+//
+// Build with -DBUILD_BENCHMARKS=ON (requires google-benchmark).
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+
+#include "layer_benchmark_common.h"
+
+namespace {
+
+// Shared instance/device plus the long-lived objects the churned ones hang off of (memory for
+// buffer binds, a buffer for views, a set layout for descriptor sets)
+struct LifecycleContext : BenchmarkDeviceBase {
+    VkDeviceMemory buffer_memory = VK_NULL_HANDLE;
+    VkBuffer texel_buffer = VK_NULL_HANDLE;
+    VkDescriptorSetLayout set_layout = VK_NULL_HANDLE;
+
+    static const VkDeviceSize kBufferBytes = 4096;
+
+    LifecycleContext() : BenchmarkDeviceBase("vk_layer_lifecycle_benchmarks") {
+        // A texel buffer for view churn, bound so the views are fully valid
+        VkBufferCreateInfo buffer_info = {};
+        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_info.size = kBufferBytes;
+        buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT;
+        CHECK_RESULT(vkCreateBuffer(device, &buffer_info, nullptr, &texel_buffer));
+        VkMemoryRequirements reqs;
+        vkGetBufferMemoryRequirements(device, texel_buffer, &reqs);
+        VkMemoryAllocateInfo mem_info = {};
+        mem_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        mem_info.allocationSize = reqs.size ? reqs.size : kBufferBytes;
+        CHECK_RESULT(vkAllocateMemory(device, &mem_info, nullptr, &buffer_memory));
+        CHECK_RESULT(vkBindBufferMemory(device, texel_buffer, buffer_memory, 0));
+
+        VkDescriptorSetLayoutBinding binding = {};
+        binding.binding = 0;
+        binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        binding.descriptorCount = 1;
+        binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+        VkDescriptorSetLayoutCreateInfo layout_info = {};
+        layout_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layout_info.bindingCount = 1;
+        layout_info.pBindings = &binding;
+        CHECK_RESULT(vkCreateDescriptorSetLayout(device, &layout_info, nullptr, &set_layout));
+    }
+
+    ~LifecycleContext() {
+        vkDestroyDescriptorSetLayout(device, set_layout, nullptr);
+        vkDestroyBuffer(device, texel_buffer, nullptr);
+        vkFreeMemory(device, buffer_memory, nullptr);
+    }
+};
+
+class LifecycleChurn : public benchmark::Fixture {
+  public:
+    void SetUp(const benchmark::State &) override {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (ref_count_++ == 0) ctx_ = new LifecycleContext;
+    }
+
+    void TearDown(const benchmark::State &) override {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (--ref_count_ == 0) {
+            delete ctx_;
+            ctx_ = nullptr;
+        }
+    }
+
+  protected:
+    static std::mutex lock_;
+    static LifecycleContext *ctx_;
+    static int ref_count_;
+};
+
+std::mutex LifecycleChurn::lock_;
+LifecycleContext *LifecycleChurn::ctx_ = nullptr;
+int LifecycleChurn::ref_count_ = 0;
+
+}  // namespace
+
+// Buffers: create, bind memory, destroy.  The bind is included because streaming allocators
+// always bind immediately, and it doubles the state-tracker traffic per object.
+BENCHMARK_DEFINE_F(LifecycleChurn, BufferCreateBindDestroy)(benchmark::State &state) {
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = 256;
+    buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    for (auto _ : state) {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        CHECK_RESULT(vkCreateBuffer(ctx_->device, &buffer_info, nullptr, &buffer));
+        CHECK_RESULT(vkBindBufferMemory(ctx_->device, buffer, ctx_->buffer_memory, 0));
+        vkDestroyBuffer(ctx_->device, buffer, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(LifecycleChurn, BufferCreateBindDestroy)->ThreadRange(1, 8)->UseRealTime();
+
+// Buffer views over a shared long-lived buffer
+BENCHMARK_DEFINE_F(LifecycleChurn, BufferViewCreateDestroy)(benchmark::State &state) {
+    VkBufferViewCreateInfo view_info = {};
+    view_info.sType = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO;
+    view_info.buffer = ctx_->texel_buffer;
+    view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    view_info.range = VK_WHOLE_SIZE;
+    for (auto _ : state) {
+        VkBufferView view = VK_NULL_HANDLE;
+        CHECK_RESULT(vkCreateBufferView(ctx_->device, &view_info, nullptr, &view));
+        vkDestroyBufferView(ctx_->device, view, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(LifecycleChurn, BufferViewCreateDestroy)->ThreadRange(1, 8)->UseRealTime();
+
+// Images: the heaviest per-object state in the tracker (format/usage validation plus the
+// subresource layout bookkeeping created at bind/first use)
+BENCHMARK_DEFINE_F(LifecycleChurn, ImageCreateDestroy)(benchmark::State &state) {
+    VkImageCreateInfo image_info = {};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = {64, 64, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    for (auto _ : state) {
+        VkImage image = VK_NULL_HANDLE;
+        CHECK_RESULT(vkCreateImage(ctx_->device, &image_info, nullptr, &image));
+        vkDestroyImage(ctx_->device, image, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(LifecycleChurn, ImageCreateDestroy)->ThreadRange(1, 8)->UseRealTime();
+
+// Descriptor sets: allocate and free a batch from a per-thread pool, the streaming-system
+// pattern.  Batch size matches a typical material's set count.
+BENCHMARK_DEFINE_F(LifecycleChurn, DescriptorSetAllocFree)(benchmark::State &state) {
+    const uint32_t kBatch = 8;
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kBatch};
+    VkDescriptorPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    pool_info.maxSets = kBatch;
+    pool_info.poolSizeCount = 1;
+    pool_info.pPoolSizes = &pool_size;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    CHECK_RESULT(vkCreateDescriptorPool(ctx_->device, &pool_info, nullptr, &pool));
+
+    VkDescriptorSetLayout layouts[kBatch];
+    for (uint32_t i = 0; i < kBatch; ++i) layouts[i] = ctx_->set_layout;
+    VkDescriptorSetAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorPool = pool;
+    alloc_info.descriptorSetCount = kBatch;
+    alloc_info.pSetLayouts = layouts;
+
+    for (auto _ : state) {
+        VkDescriptorSet sets[kBatch];
+        CHECK_RESULT(vkAllocateDescriptorSets(ctx_->device, &alloc_info, sets));
+        CHECK_RESULT(vkFreeDescriptorSets(ctx_->device, pool, kBatch, sets));
+    }
+    state.SetItemsProcessed(state.iterations() * kBatch);
+    vkDestroyDescriptorPool(ctx_->device, pool, nullptr);
+}
+BENCHMARK_REGISTER_F(LifecycleChurn, DescriptorSetAllocFree)->ThreadRange(1, 8)->UseRealTime();
+
+// Semaphores/fences: the smallest state objects, so this isolates pure map and id-allocator
+// cost from state-object construction
+BENCHMARK_DEFINE_F(LifecycleChurn, SemaphoreCreateDestroy)(benchmark::State &state) {
+    VkSemaphoreCreateInfo semaphore_info = {};
+    semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    for (auto _ : state) {
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        CHECK_RESULT(vkCreateSemaphore(ctx_->device, &semaphore_info, nullptr, &semaphore));
+        vkDestroySemaphore(ctx_->device, semaphore, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(LifecycleChurn, SemaphoreCreateDestroy)->ThreadRange(1, 8)->UseRealTime();
+
+// Mixed churn: every thread cycles through all the handle types above, approximating a frame of
+// streaming traffic; the interleaving keeps several shard locks and maps warm at once
+BENCHMARK_DEFINE_F(LifecycleChurn, MixedChurn)(benchmark::State &state) {
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.size = 256;
+    buffer_info.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    VkBufferViewCreateInfo view_info = {};
+    view_info.sType = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO;
+    view_info.buffer = ctx_->texel_buffer;
+    view_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    view_info.range = VK_WHOLE_SIZE;
+    VkSemaphoreCreateInfo semaphore_info = {};
+    semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    for (auto _ : state) {
+        VkBuffer buffer = VK_NULL_HANDLE;
+        VkBufferView view = VK_NULL_HANDLE;
+        VkSemaphore semaphore = VK_NULL_HANDLE;
+        CHECK_RESULT(vkCreateBuffer(ctx_->device, &buffer_info, nullptr, &buffer));
+        CHECK_RESULT(vkCreateBufferView(ctx_->device, &view_info, nullptr, &view));
+        CHECK_RESULT(vkCreateSemaphore(ctx_->device, &semaphore_info, nullptr, &semaphore));
+        vkDestroySemaphore(ctx_->device, semaphore, nullptr);
+        vkDestroyBufferView(ctx_->device, view, nullptr);
+        vkDestroyBuffer(ctx_->device, buffer, nullptr);
+    }
+    state.SetItemsProcessed(state.iterations() * 3);
+    state.counters["objects_per_s"] =
+        benchmark::Counter(static_cast<double>(state.iterations()) * 3, benchmark::Counter::kIsRate);
+}
+BENCHMARK_REGISTER_F(LifecycleChurn, MixedChurn)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CPU-overhead microbenchmarks for the validation layer stack.
+//
+// These measure ns/call of the hot entry points with the layer enabled, driven against a null
+// driver so the numbers are dominated by layer overhead rather than driver work.  Run with the
+// mock ICD from VulkanTools and this repo's layer build, e.g.:
+//
+//     VK_ICD_FILENAMES=/path/to/VkICD_mock_icd.json \
+//     VK_LAYER_PATH=<build>/layers \
+//     ./vk_layer_overhead_benchmarks
+//
+// Each benchmark also runs at several thread counts to expose lock contention inside the layer.
+// Build with -DBUILD_BENCHMARKS=ON (requires google-benchmark).
+
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <mutex>
+
+#include "layer_benchmark_common.h"
+
+namespace {
+
+// Per-thread recording state.  Command buffers are periodically reset so recording cost stays
+// representative without growing without bound.
+struct ThreadRecorder {
+    const BenchmarkContext *ctx = nullptr;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VkCommandBuffer cb = VK_NULL_HANDLE;
+    uint32_t recorded = 0;
+    bool in_render_pass = false;
+
+    static const uint32_t kResetInterval = 2048;
+
+    void Init(const BenchmarkContext *context) {
+        ctx = context;
+        VkCommandPoolCreateInfo pool_info = {};
+        pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        pool_info.queueFamilyIndex = ctx->queue_family;
+        CHECK_RESULT(vkCreateCommandPool(ctx->device, &pool_info, nullptr, &pool));
+        VkCommandBufferAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.commandPool = pool;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandBufferCount = 1;
+        CHECK_RESULT(vkAllocateCommandBuffers(ctx->device, &alloc_info, &cb));
+    }
+
+    // (Re)starts recording; optionally inside the render pass with the pipeline bound
+    void Begin(bool render_pass) {
+        VkCommandBufferBeginInfo begin_info = {};
+        begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        CHECK_RESULT(vkBeginCommandBuffer(cb, &begin_info));
+        if (render_pass) {
+            VkRenderPassBeginInfo rp_begin = {};
+            rp_begin.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+            rp_begin.renderPass = ctx->render_pass;
+            rp_begin.framebuffer = ctx->framebuffer;
+            rp_begin.renderArea.extent = {64, 64};
+            vkCmdBeginRenderPass(cb, &rp_begin, VK_SUBPASS_CONTENTS_INLINE);
+            vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx->pipeline);
+        }
+        in_render_pass = render_pass;
+        recorded = 0;
+    }
+
+    // Call once per recorded command; resets and restarts the command buffer every kResetInterval
+    // commands so its memory footprint stays bounded
+    void Recorded() {
+        if (++recorded < kResetInterval) return;
+        if (in_render_pass) vkCmdEndRenderPass(cb);
+        CHECK_RESULT(vkEndCommandBuffer(cb));
+        CHECK_RESULT(vkResetCommandBuffer(cb, 0));
+        Begin(in_render_pass);
+    }
+
+    void Destroy() {
+        if (pool != VK_NULL_HANDLE) vkDestroyCommandPool(ctx->device, pool, nullptr);
+        pool = VK_NULL_HANDLE;
+        cb = VK_NULL_HANDLE;
+    }
+};
+
+class LayerOverhead : public benchmark::Fixture {
+  public:
+    void SetUp(const benchmark::State &state) override {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (ref_count_++ == 0) ctx_ = new BenchmarkContext("vk_layer_overhead_benchmarks");
+        recorders_[state.thread_index].Init(ctx_);
+    }
+
+    void TearDown(const benchmark::State &state) override {
+        std::lock_guard<std::mutex> guard(lock_);
+        recorders_[state.thread_index].Destroy();
+        if (--ref_count_ == 0) {
+            delete ctx_;
+            ctx_ = nullptr;
+            recorders_.clear();
+        }
+    }
+
+    ThreadRecorder &Recorder(const benchmark::State &state) {
+        std::lock_guard<std::mutex> guard(lock_);
+        return recorders_[state.thread_index];
+    }
+
+  protected:
+    static std::mutex lock_;
+    static BenchmarkContext *ctx_;
+    static int ref_count_;
+    static std::map<int, ThreadRecorder> recorders_;
+};
+
+std::mutex LayerOverhead::lock_;
+BenchmarkContext *LayerOverhead::ctx_ = nullptr;
+int LayerOverhead::ref_count_ = 0;
+std::map<int, ThreadRecorder> LayerOverhead::recorders_;
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(LayerOverhead, CmdBindDescriptorSets)(benchmark::State &state) {
+    ThreadRecorder &rec = Recorder(state);
+    rec.Begin(false);
+    for (auto _ : state) {
+        vkCmdBindDescriptorSets(rec.cb, VK_PIPELINE_BIND_POINT_GRAPHICS, ctx_->pipeline_layout, 0, kDescriptorSetCount,
+                                ctx_->descriptor_sets, 0, nullptr);
+        rec.Recorded();
+    }
+    CHECK_RESULT(vkEndCommandBuffer(rec.cb));
+    CHECK_RESULT(vkResetCommandBuffer(rec.cb, 0));
+}
+BENCHMARK_REGISTER_F(LayerOverhead, CmdBindDescriptorSets)->ThreadRange(1, 4);
+
+BENCHMARK_DEFINE_F(LayerOverhead, CmdDraw)(benchmark::State &state) {
+    ThreadRecorder &rec = Recorder(state);
+    rec.Begin(true);
+    for (auto _ : state) {
+        vkCmdDraw(rec.cb, 3, 1, 0, 0);
+        rec.Recorded();
+    }
+    vkCmdEndRenderPass(rec.cb);
+    CHECK_RESULT(vkEndCommandBuffer(rec.cb));
+    CHECK_RESULT(vkResetCommandBuffer(rec.cb, 0));
+}
+BENCHMARK_REGISTER_F(LayerOverhead, CmdDraw)->ThreadRange(1, 4);
+
+BENCHMARK_DEFINE_F(LayerOverhead, CmdPipelineBarrier)(benchmark::State &state) {
+    ThreadRecorder &rec = Recorder(state);
+    rec.Begin(false);
+    VkMemoryBarrier barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    for (auto _ : state) {
+        vkCmdPipelineBarrier(rec.cb, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 1, &barrier, 0,
+                             nullptr, 0, nullptr);
+        rec.Recorded();
+    }
+    CHECK_RESULT(vkEndCommandBuffer(rec.cb));
+    CHECK_RESULT(vkResetCommandBuffer(rec.cb, 0));
+}
+BENCHMARK_REGISTER_F(LayerOverhead, CmdPipelineBarrier)->ThreadRange(1, 4);
+
+BENCHMARK_DEFINE_F(LayerOverhead, QueueSubmit)(benchmark::State &state) {
+    // Queues require external synchronization, so concurrent submitters serialize on this lock;
+    // the multithreaded variants measure layer overhead under that contention pattern
+    static std::mutex queue_lock;
+    ThreadRecorder &rec = Recorder(state);
+    rec.Begin(false);
+    CHECK_RESULT(vkEndCommandBuffer(rec.cb));
+    VkSubmitInfo submit = {};
+    submit.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit.commandBufferCount = 1;
+    submit.pCommandBuffers = &rec.cb;
+    uint32_t submitted = 0;
+    for (auto _ : state) {
+        std::lock_guard<std::mutex> guard(queue_lock);
+        CHECK_RESULT(vkQueueSubmit(ctx_->queue, 1, &submit, VK_NULL_HANDLE));
+        if (++submitted % 64 == 0) vkQueueWaitIdle(ctx_->queue);
+    }
+    {
+        std::lock_guard<std::mutex> guard(queue_lock);
+        vkQueueWaitIdle(ctx_->queue);
+    }
+    CHECK_RESULT(vkResetCommandBuffer(rec.cb, 0));
+}
+BENCHMARK_REGISTER_F(LayerOverhead, QueueSubmit)->ThreadRange(1, 4);
+
+BENCHMARK_DEFINE_F(LayerOverhead, CreateGraphicsPipelines)(benchmark::State &state) {
+    for (auto _ : state) {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        CHECK_RESULT(ctx_->CreatePipeline(&pipeline));
+        vkDestroyPipeline(ctx_->device, pipeline, nullptr);
+    }
+}
+BENCHMARK_REGISTER_F(LayerOverhead, CreateGraphicsPipelines)->ThreadRange(1, 4);
+
+BENCHMARK_MAIN();